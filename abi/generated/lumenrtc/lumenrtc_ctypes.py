@@ -93,6 +93,24 @@ class DtlsTransportState(IntEnum):
     CLOSED = 3
     FAILED = 4
 
+class FactoryThreadMode(IntEnum):
+    DEDICATED = 0
+    SHARED = 1
+    POOLED = 2
+
+class FrameCryptionState(IntEnum):
+    NEW = 0
+    OK = 1
+    ENCRYPTION_FAILED = 2
+    DECRYPTION_FAILED = 3
+    MISSING_KEY = 4
+    KEY_RATCHETED = 5
+    INTERNAL_ERROR = 6
+
+class FrameCryptoAlgorithm(IntEnum):
+    GCM = 0
+    CBC = 1
+
 class IceConnectionState(IntEnum):
     NEW = 0
     CHECKING = 1
@@ -114,6 +132,12 @@ class IceTransportsType(IntEnum):
     NO_HOST = 2
     ALL = 3
 
+class LayerDecisionReason(IntEnum):
+    BANDWIDTH = 0
+    LOSS = 1
+    RTT = 2
+    CPU = 3
+
 class LogSeverity(IntEnum):
     VERBOSE = 0
     INFO = 1
@@ -139,6 +163,11 @@ class PeerConnectionState(IntEnum):
     FAILED = 4
     CLOSED = 5
 
+class RecordingSyncPolicy(IntEnum):
+    NONE = 0
+    ON_STOP = 1
+    INTERVAL = 2
+
 class Result(IntEnum):
     OK = 0
     ERROR = 1
@@ -172,10 +201,37 @@ class TcpCandidatePolicy(IntEnum):
     ENABLED = 0
     DISABLED = 1
 
+class ThreadRole(IntEnum):
+    WORKER = 0
+    SIGNALING = 1
+    NETWORK = 2
+    CAPTURE = 3
+
+class ThreadTuningFailure(IntEnum):
+    AFFINITY_FAILED = 1
+    NICE_FAILED = 2
+    REALTIME_FAILED = 4
+
+class TraceStage(IntEnum):
+    DESKTOP_CAPTURE = 0
+    DESKTOP_CONVERT = 1
+    CAPTURE_ADAPT = 2
+    VIDEO_SINK_ADAPTER = 3
+    VIDEO_SINK_CALLBACK = 4
+    AUDIO_SINK_ADAPTER = 5
+    AUDIO_SINK_CALLBACK = 6
+
 class TrackState(IntEnum):
     LIVE = 0
     ENDED = 1
 
+class VideoPixelFormat(IntEnum):
+    NATIVE = 0
+    I420 = 1
+    NV12 = 2
+    ARGB = 3
+    BGRA = 4
+
 
 # ---------------------------------------------------------------------------
 # Opaque handle types
@@ -190,7 +246,13 @@ class DesktopCapturerHandle(ctypes.c_void_p): pass
 class DesktopDeviceHandle(ctypes.c_void_p): pass
 class DesktopMediaListHandle(ctypes.c_void_p): pass
 class DtmfSenderHandle(ctypes.c_void_p): pass
+class EncodedFrameRecorderHandle(ctypes.c_void_p): pass
+class EncodedFrameSinkHandle(ctypes.c_void_p): pass
+class EncodedFrameHandle(ctypes.c_void_p): pass
 class FactoryHandle(ctypes.c_void_p): pass
+class FrameCryptorHandle(ctypes.c_void_p): pass
+class KeyProviderHandle(ctypes.c_void_p): pass
+class LayerControllerHandle(ctypes.c_void_p): pass
 class MediaConstraintsHandle(ctypes.c_void_p): pass
 class MediaSourceHandle(ctypes.c_void_p): pass
 class MediaStreamHandle(ctypes.c_void_p): pass
@@ -198,6 +260,7 @@ class PeerConnectionHandle(ctypes.c_void_p): pass
 class RtpReceiverHandle(ctypes.c_void_p): pass
 class RtpSenderHandle(ctypes.c_void_p): pass
 class RtpTransceiverHandle(ctypes.c_void_p): pass
+class SessionTemplateHandle(ctypes.c_void_p): pass
 class VideoCapturerHandle(ctypes.c_void_p): pass
 class VideoDeviceHandle(ctypes.c_void_p): pass
 class VideoFrameHandle(ctypes.c_void_p): pass
@@ -215,15 +278,27 @@ SdpErrorCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_char_p)
 VoidCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p)
 PeerConnectionStateCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_int)
 IceCandidateCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_char_p, ctypes.c_int, ctypes.c_char_p)
+IceCandidatesCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_char_p, ctypes.POINTER(ctypes.c_int), ctypes.c_char_p, ctypes.c_uint32)
+BandwidthEstimateCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_double, ctypes.c_double)
+LayerDecisionCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_double, ctypes.c_double)
 DataChannelStateCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_int)
 DataChannelMessageCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint8), ctypes.c_int, ctypes.c_int)
 AudioFrameCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_int, ctypes.c_int, ctypes.c_size_t, ctypes.c_size_t)
 VideoFrameCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, VideoFrameHandle)
+EncodedFrameCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, EncodedFrameHandle)
 TrackCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, RtpTransceiverHandle, RtpReceiverHandle)
 StatsSuccessCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_char_p)
 StatsFailureCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_char_p)
 LogMessageCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_char_p)
 DtmfToneCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_char_p, ctypes.c_char_p)
+AudioSourceCreatedCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, AudioSourceHandle)
+AudioTrackCreatedCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, AudioTrackHandle)
+VideoSourceCreatedCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, VideoSourceHandle)
+VideoTrackCreatedCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, VideoTrackHandle)
+VideoCapturerCreatedCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, VideoCapturerHandle)
+VideoCaptureStartedCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_int)
+DesktopCaptureStateCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_int)
+FrameCryptionStateCb = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_char_p, ctypes.c_int)
 
 
 # ---------------------------------------------------------------------------
@@ -243,12 +318,28 @@ class AudioSinkCallbacks(ctypes.Structure):
         ("on_data", ctypes.c_void_p),
     ]
 
+class CertificateCacheOptions(ctypes.Structure):
+    _fields_: list = [
+        ("enabled", ctypes.c_bool),
+        ("size", ctypes.c_int),
+        ("rotation_interval_ms", ctypes.c_int64),
+    ]
+
 class DataChannelCallbacks(ctypes.Structure):
     _fields_: list = [
         ("on_state_change", ctypes.c_void_p),
         ("on_message", ctypes.c_void_p),
     ]
 
+class DecodeOnDemandStats(ctypes.Structure):
+    _fields_: list = [
+        ("frames_decoded", ctypes.c_uint64),
+        ("frames_skipped", ctypes.c_uint64),
+        ("key_frame_requests", ctypes.c_uint64),
+        ("enabled", ctypes.c_bool),
+        ("skipping", ctypes.c_bool),
+    ]
+
 class DtlsTransportInfo(ctypes.Structure):
     _fields_: list = [
         ("state", ctypes.c_int),
@@ -261,6 +352,70 @@ class DtmfSenderCallbacks(ctypes.Structure):
         ("on_tone_change", ctypes.c_void_p),
     ]
 
+class EncodedFrameInfo(ctypes.Structure):
+    _fields_: list = [
+        ("media_type", ctypes.c_int),
+        ("rtp_timestamp", ctypes.c_uint32),
+        ("ssrc", ctypes.c_uint32),
+        ("payload_type", ctypes.c_int),
+        ("is_key_frame", ctypes.c_bool),
+        ("width", ctypes.c_int),
+        ("height", ctypes.c_int),
+        ("frame_id", ctypes.c_int64),
+        ("spatial_index", ctypes.c_int),
+        ("temporal_index", ctypes.c_int),
+        ("dependency_count", ctypes.c_uint32),
+    ]
+
+class EncodedFrameRecorderOptions(ctypes.Structure):
+    _fields_: list = [
+        ("max_queued_bytes", ctypes.c_uint32),
+        ("write_buffer_bytes", ctypes.c_uint32),
+        ("sync_policy", ctypes.c_int),
+        ("sync_interval_ms", ctypes.c_uint32),
+    ]
+
+class EncodedFrameRecorderStats(ctypes.Structure):
+    _fields_: list = [
+        ("frames_written", ctypes.c_uint64),
+        ("bytes_written", ctypes.c_uint64),
+        ("frames_dropped", ctypes.c_uint64),
+        ("queued_bytes", ctypes.c_uint64),
+        ("write_failed", ctypes.c_bool),
+    ]
+
+class ThreadConfig(ctypes.Structure):
+    _fields_: list = [
+        ("cpu_mask", ctypes.c_uint64),
+        ("set_nice", ctypes.c_bool),
+        ("nice", ctypes.c_int),
+        ("realtime", ctypes.c_bool),
+        ("realtime_priority", ctypes.c_int),
+    ]
+
+class VirtualNetworkOptions(ctypes.Structure):
+    _fields_: list = [
+        ("enabled", ctypes.c_bool),
+        ("latency_ms", ctypes.c_int),
+        ("jitter_ms", ctypes.c_int),
+        ("loss_rate", ctypes.c_double),
+        ("bandwidth_bps", ctypes.c_int64),
+    ]
+
+class FactoryOptions(ctypes.Structure):
+    _fields_: list = [
+        ("thread_mode", ctypes.c_int),
+        ("thread_pool_size", ctypes.c_int),
+        ("network_thread_count", ctypes.c_int),
+        ("pin_network_threads", ctypes.c_bool),
+        ("network_first_cpu", ctypes.c_int),
+        ("worker_thread", ThreadConfig),
+        ("signaling_thread", ThreadConfig),
+        ("network_thread", ThreadConfig),
+        ("capture_thread", ThreadConfig),
+        ("virtual_network", VirtualNetworkOptions),
+    ]
+
 class IceServer(ctypes.Structure):
     _fields_: list = [
         ("uri", ctypes.c_char_p),
@@ -268,6 +423,31 @@ class IceServer(ctypes.Structure):
         ("password", ctypes.c_char_p),
     ]
 
+class KeyProviderOptions(ctypes.Structure):
+    _fields_: list = [
+        ("shared_key", ctypes.c_bool),
+        ("ratchet_salt", ctypes.POINTER(ctypes.c_uint8)),
+        ("ratchet_salt_len", ctypes.c_uint32),
+        ("uncrypted_magic_bytes", ctypes.POINTER(ctypes.c_uint8)),
+        ("uncrypted_magic_bytes_len", ctypes.c_uint32),
+        ("ratchet_window_size", ctypes.c_int),
+        ("failure_tolerance", ctypes.c_int),
+        ("key_ring_size", ctypes.c_int),
+        ("discard_frame_when_cryptor_not_ready", ctypes.c_bool),
+    ]
+
+class LayerControllerOptions(ctypes.Structure):
+    _fields_: list = [
+        ("interval_ms", ctypes.c_uint32),
+        ("up_headroom", ctypes.c_double),
+        ("down_headroom", ctypes.c_double),
+        ("up_hold_ms", ctypes.c_uint32),
+        ("down_hold_ms", ctypes.c_uint32),
+        ("max_loss_rate", ctypes.c_double),
+        ("max_rtt_increase_ms", ctypes.c_uint32),
+        ("ignore_cpu", ctypes.c_bool),
+    ]
+
 class PeerConnectionCallbacks(ctypes.Structure):
     _fields_: list = [
         ("on_signaling_state", ctypes.c_void_p),
@@ -283,6 +463,16 @@ class PeerConnectionCallbacks(ctypes.Structure):
         ("on_renegotiation_needed", ctypes.c_void_p),
     ]
 
+class PeerConnectionPoolStats(ctypes.Structure):
+    _fields_: list = [
+        ("hits", ctypes.c_uint64),
+        ("misses", ctypes.c_uint64),
+        ("created", ctypes.c_uint64),
+        ("discarded", ctypes.c_uint64),
+        ("available", ctypes.c_uint32),
+        ("target_size", ctypes.c_uint32),
+    ]
+
 class RtcConfig(ctypes.Structure):
     _fields_: list = [
         ("ice_servers", IceServer * 8),
@@ -347,11 +537,63 @@ class RtpTransceiverInit(ctypes.Structure):
         ("send_encoding_count", ctypes.c_uint32),
     ]
 
+class SessionTemplateStats(ctypes.Structure):
+    _fields_: list = [
+        ("hits", ctypes.c_uint64),
+        ("misses", ctypes.c_uint64),
+        ("template_size", ctypes.c_uint32),
+    ]
+
+class ThreadReport(ctypes.Structure):
+    _fields_: list = [
+        ("applied", ctypes.c_bool),
+        ("cpu_mask", ctypes.c_uint64),
+        ("nice", ctypes.c_int),
+        ("realtime", ctypes.c_bool),
+        ("priority", ctypes.c_int),
+        ("failures", ctypes.c_int),
+    ]
+
+class TraceEvent(ctypes.Structure):
+    _fields_: list = [
+        ("start_us", ctypes.c_int64),
+        ("duration_us", ctypes.c_int64),
+        ("frame_timestamp_us", ctypes.c_int64),
+        ("source_id", ctypes.c_uint64),
+        ("thread_id", ctypes.c_uint32),
+        ("stage", ctypes.c_int),
+    ]
+
+class UdpMuxOptions(ctypes.Structure):
+    _fields_: list = [
+        ("enabled", ctypes.c_bool),
+        ("port", ctypes.c_int),
+    ]
+
+class UdpMuxStats(ctypes.Structure):
+    _fields_: list = [
+        ("address_hits", ctypes.c_uint64),
+        ("ufrag_hits", ctypes.c_uint64),
+        ("misses", ctypes.c_uint64),
+        ("endpoints", ctypes.c_uint32),
+        ("ports", ctypes.c_uint32),
+    ]
+
 class VideoSinkCallbacks(ctypes.Structure):
     _fields_: list = [
         ("on_frame", ctypes.c_void_p),
     ]
 
+class VideoSinkWants(ctypes.Structure):
+    _fields_: list = [
+        ("max_pixel_count", ctypes.c_uint32),
+        ("max_framerate", ctypes.c_uint32),
+        ("resolution_alignment", ctypes.c_uint32),
+        ("format", ctypes.c_int),
+        ("width", ctypes.c_uint32),
+        ("height", ctypes.c_uint32),
+    ]
+
 
 # ---------------------------------------------------------------------------
 # Function bindings
@@ -420,16 +662,24 @@ def _bind_all(lib: ctypes.CDLL) -> None:
     lib.lrtc_data_channel_send.argtypes = [DataChannelHandle, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32, ctypes.c_int]
     lib.lrtc_data_channel_set_callbacks.restype = None
     lib.lrtc_data_channel_set_callbacks.argtypes = [DataChannelHandle, ctypes.POINTER(DataChannelCallbacks), ctypes.c_void_p]
+    lib.lrtc_desktop_capturer_get_thread_report.restype = ctypes.c_int
+    lib.lrtc_desktop_capturer_get_thread_report.argtypes = [DesktopCapturerHandle, ctypes.POINTER(ThreadReport)]
     lib.lrtc_desktop_capturer_is_running.restype = ctypes.c_bool
     lib.lrtc_desktop_capturer_is_running.argtypes = [DesktopCapturerHandle]
     lib.lrtc_desktop_capturer_release.restype = None
     lib.lrtc_desktop_capturer_release.argtypes = [DesktopCapturerHandle]
     lib.lrtc_desktop_capturer_start.restype = ctypes.c_int
     lib.lrtc_desktop_capturer_start.argtypes = [DesktopCapturerHandle, ctypes.c_uint32]
+    lib.lrtc_desktop_capturer_start_async.restype = ctypes.c_int
+    lib.lrtc_desktop_capturer_start_async.argtypes = [DesktopCapturerHandle, ctypes.c_uint32, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_desktop_capturer_start_region.restype = ctypes.c_int
     lib.lrtc_desktop_capturer_start_region.argtypes = [DesktopCapturerHandle, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32]
+    lib.lrtc_desktop_capturer_start_region_async.restype = ctypes.c_int
+    lib.lrtc_desktop_capturer_start_region_async.argtypes = [DesktopCapturerHandle, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_desktop_capturer_stop.restype = None
     lib.lrtc_desktop_capturer_stop.argtypes = [DesktopCapturerHandle]
+    lib.lrtc_desktop_capturer_stop_async.restype = ctypes.c_int
+    lib.lrtc_desktop_capturer_stop_async.argtypes = [DesktopCapturerHandle, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_desktop_device_create_capturer.restype = DesktopCapturerHandle
     lib.lrtc_desktop_device_create_capturer.argtypes = [DesktopDeviceHandle, MediaSourceHandle, ctypes.c_bool]
     lib.lrtc_desktop_device_get_media_list.restype = DesktopMediaListHandle
@@ -460,40 +710,144 @@ def _bind_all(lib: ctypes.CDLL) -> None:
     lib.lrtc_dtmf_sender_set_callbacks.argtypes = [DtmfSenderHandle, ctypes.POINTER(DtmfSenderCallbacks), ctypes.c_void_p]
     lib.lrtc_dtmf_sender_tones.restype = ctypes.c_int32
     lib.lrtc_dtmf_sender_tones.argtypes = [DtmfSenderHandle, ctypes.c_char_p, ctypes.c_uint32]
+    lib.lrtc_encoded_frame_data.restype = ctypes.POINTER(ctypes.c_uint8)
+    lib.lrtc_encoded_frame_data.argtypes = [EncodedFrameHandle]
+    lib.lrtc_encoded_frame_get_dependencies.restype = ctypes.c_uint32
+    lib.lrtc_encoded_frame_get_dependencies.argtypes = [EncodedFrameHandle, ctypes.POINTER(ctypes.c_int64), ctypes.c_uint32]
+    lib.lrtc_encoded_frame_get_info.restype = ctypes.c_int
+    lib.lrtc_encoded_frame_get_info.argtypes = [EncodedFrameHandle, ctypes.POINTER(EncodedFrameInfo)]
+    lib.lrtc_encoded_frame_get_mime_type.restype = ctypes.c_int32
+    lib.lrtc_encoded_frame_get_mime_type.argtypes = [EncodedFrameHandle, ctypes.c_char_p, ctypes.c_uint32]
+    lib.lrtc_encoded_frame_recorder_create.restype = EncodedFrameRecorderHandle
+    lib.lrtc_encoded_frame_recorder_create.argtypes = [ctypes.c_char_p, ctypes.POINTER(EncodedFrameRecorderOptions)]
+    lib.lrtc_encoded_frame_recorder_get_stats.restype = ctypes.c_int
+    lib.lrtc_encoded_frame_recorder_get_stats.argtypes = [EncodedFrameRecorderHandle, ctypes.POINTER(EncodedFrameRecorderStats)]
+    lib.lrtc_encoded_frame_recorder_release.restype = None
+    lib.lrtc_encoded_frame_recorder_release.argtypes = [EncodedFrameRecorderHandle]
+    lib.lrtc_encoded_frame_recorder_stop.restype = ctypes.c_int
+    lib.lrtc_encoded_frame_recorder_stop.argtypes = [EncodedFrameRecorderHandle]
+    lib.lrtc_encoded_frame_release.restype = None
+    lib.lrtc_encoded_frame_release.argtypes = [EncodedFrameHandle]
+    lib.lrtc_encoded_frame_retain.restype = EncodedFrameHandle
+    lib.lrtc_encoded_frame_retain.argtypes = [EncodedFrameHandle]
+    lib.lrtc_encoded_frame_sink_create.restype = EncodedFrameSinkHandle
+    lib.lrtc_encoded_frame_sink_create.argtypes = [ctypes.c_void_p, ctypes.c_void_p]
+    lib.lrtc_encoded_frame_sink_release.restype = None
+    lib.lrtc_encoded_frame_sink_release.argtypes = [EncodedFrameSinkHandle]
+    lib.lrtc_encoded_frame_size.restype = ctypes.c_uint32
+    lib.lrtc_encoded_frame_size.argtypes = [EncodedFrameHandle]
+    lib.lrtc_factory_configure_certificate_cache.restype = ctypes.c_int
+    lib.lrtc_factory_configure_certificate_cache.argtypes = [FactoryHandle, ctypes.POINTER(CertificateCacheOptions)]
+    lib.lrtc_factory_configure_peer_connection_pool.restype = ctypes.c_int
+    lib.lrtc_factory_configure_peer_connection_pool.argtypes = [FactoryHandle, ctypes.POINTER(RtcConfig), MediaConstraintsHandle, ctypes.c_int]
+    lib.lrtc_factory_configure_udp_mux.restype = ctypes.c_int
+    lib.lrtc_factory_configure_udp_mux.argtypes = [FactoryHandle, ctypes.POINTER(UdpMuxOptions)]
     lib.lrtc_factory_create.restype = FactoryHandle
     lib.lrtc_factory_create.argtypes = []
     lib.lrtc_factory_create_audio_source.restype = AudioSourceHandle
     lib.lrtc_factory_create_audio_source.argtypes = [FactoryHandle, ctypes.c_char_p, ctypes.c_int, ctypes.POINTER(AudioOptions)]
+    lib.lrtc_factory_create_audio_source_async.restype = ctypes.c_int
+    lib.lrtc_factory_create_audio_source_async.argtypes = [FactoryHandle, ctypes.c_char_p, ctypes.c_int, ctypes.POINTER(AudioOptions), ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_factory_create_audio_track.restype = AudioTrackHandle
     lib.lrtc_factory_create_audio_track.argtypes = [FactoryHandle, AudioSourceHandle, ctypes.c_char_p]
+    lib.lrtc_factory_create_audio_track_async.restype = ctypes.c_int
+    lib.lrtc_factory_create_audio_track_async.argtypes = [FactoryHandle, AudioSourceHandle, ctypes.c_char_p, ctypes.c_void_p, ctypes.c_void_p]
+    lib.lrtc_factory_create_custom_video_source.restype = VideoSourceHandle
+    lib.lrtc_factory_create_custom_video_source.argtypes = [FactoryHandle, ctypes.c_char_p, ctypes.c_bool]
     lib.lrtc_factory_create_desktop_source.restype = VideoSourceHandle
     lib.lrtc_factory_create_desktop_source.argtypes = [FactoryHandle, DesktopCapturerHandle, ctypes.c_char_p, MediaConstraintsHandle]
+    lib.lrtc_factory_create_desktop_source_async.restype = ctypes.c_int
+    lib.lrtc_factory_create_desktop_source_async.argtypes = [FactoryHandle, DesktopCapturerHandle, ctypes.c_char_p, MediaConstraintsHandle, ctypes.c_void_p, ctypes.c_void_p]
+    lib.lrtc_factory_create_encoded_video_source.restype = VideoSourceHandle
+    lib.lrtc_factory_create_encoded_video_source.argtypes = [FactoryHandle, ctypes.c_char_p, ctypes.c_char_p]
     lib.lrtc_factory_create_stream.restype = MediaStreamHandle
     lib.lrtc_factory_create_stream.argtypes = [FactoryHandle, ctypes.c_char_p]
     lib.lrtc_factory_create_video_source.restype = VideoSourceHandle
     lib.lrtc_factory_create_video_source.argtypes = [FactoryHandle, VideoCapturerHandle, ctypes.c_char_p, MediaConstraintsHandle]
+    lib.lrtc_factory_create_video_source_async.restype = ctypes.c_int
+    lib.lrtc_factory_create_video_source_async.argtypes = [FactoryHandle, VideoCapturerHandle, ctypes.c_char_p, MediaConstraintsHandle, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_factory_create_video_track.restype = VideoTrackHandle
     lib.lrtc_factory_create_video_track.argtypes = [FactoryHandle, VideoSourceHandle, ctypes.c_char_p]
+    lib.lrtc_factory_create_video_track_async.restype = ctypes.c_int
+    lib.lrtc_factory_create_video_track_async.argtypes = [FactoryHandle, VideoSourceHandle, ctypes.c_char_p, ctypes.c_void_p, ctypes.c_void_p]
+    lib.lrtc_factory_create_with_options.restype = FactoryHandle
+    lib.lrtc_factory_create_with_options.argtypes = [ctypes.POINTER(FactoryOptions), FactoryHandle]
+    lib.lrtc_factory_export_certificate_pem.restype = ctypes.c_int32
+    lib.lrtc_factory_export_certificate_pem.argtypes = [FactoryHandle, ctypes.c_char_p, ctypes.c_uint32]
     lib.lrtc_factory_get_audio_device.restype = AudioDeviceHandle
     lib.lrtc_factory_get_audio_device.argtypes = [FactoryHandle]
     lib.lrtc_factory_get_desktop_device.restype = DesktopDeviceHandle
     lib.lrtc_factory_get_desktop_device.argtypes = [FactoryHandle]
+    lib.lrtc_factory_get_peer_connection_pool_stats.restype = ctypes.c_int
+    lib.lrtc_factory_get_peer_connection_pool_stats.argtypes = [FactoryHandle, ctypes.POINTER(PeerConnectionPoolStats)]
     lib.lrtc_factory_get_rtp_receiver_capabilities.restype = None
     lib.lrtc_factory_get_rtp_receiver_capabilities.argtypes = [FactoryHandle, ctypes.c_int, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_factory_get_rtp_sender_capabilities.restype = None
     lib.lrtc_factory_get_rtp_sender_capabilities.argtypes = [FactoryHandle, ctypes.c_int, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_factory_get_rtp_sender_codec_mime_types.restype = None
     lib.lrtc_factory_get_rtp_sender_codec_mime_types.argtypes = [FactoryHandle, ctypes.c_int, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p]
+    lib.lrtc_factory_get_thread_report.restype = ctypes.c_int
+    lib.lrtc_factory_get_thread_report.argtypes = [FactoryHandle, ctypes.c_int, ctypes.c_uint32, ctypes.POINTER(ThreadReport)]
+    lib.lrtc_factory_get_udp_mux_stats.restype = ctypes.c_int
+    lib.lrtc_factory_get_udp_mux_stats.argtypes = [FactoryHandle, ctypes.POINTER(UdpMuxStats)]
     lib.lrtc_factory_get_video_device.restype = VideoDeviceHandle
     lib.lrtc_factory_get_video_device.argtypes = [FactoryHandle]
+    lib.lrtc_factory_import_certificate_pem.restype = ctypes.c_int
+    lib.lrtc_factory_import_certificate_pem.argtypes = [FactoryHandle, ctypes.c_char_p]
     lib.lrtc_factory_initialize.restype = ctypes.c_int
     lib.lrtc_factory_initialize.argtypes = [FactoryHandle]
     lib.lrtc_factory_release.restype = None
     lib.lrtc_factory_release.argtypes = [FactoryHandle]
+    lib.lrtc_factory_set_virtual_network_conditions.restype = ctypes.c_int
+    lib.lrtc_factory_set_virtual_network_conditions.argtypes = [FactoryHandle, ctypes.POINTER(VirtualNetworkOptions)]
     lib.lrtc_factory_terminate.restype = None
     lib.lrtc_factory_terminate.argtypes = [FactoryHandle]
+    lib.lrtc_frame_cryptor_create_for_receiver.restype = FrameCryptorHandle
+    lib.lrtc_frame_cryptor_create_for_receiver.argtypes = [RtpReceiverHandle, ctypes.c_char_p, ctypes.c_int, KeyProviderHandle]
+    lib.lrtc_frame_cryptor_create_for_sender.restype = FrameCryptorHandle
+    lib.lrtc_frame_cryptor_create_for_sender.argtypes = [RtpSenderHandle, ctypes.c_char_p, ctypes.c_int, KeyProviderHandle]
+    lib.lrtc_frame_cryptor_get_enabled.restype = ctypes.c_bool
+    lib.lrtc_frame_cryptor_get_enabled.argtypes = [FrameCryptorHandle]
+    lib.lrtc_frame_cryptor_get_key_index.restype = ctypes.c_int
+    lib.lrtc_frame_cryptor_get_key_index.argtypes = [FrameCryptorHandle]
+    lib.lrtc_frame_cryptor_release.restype = None
+    lib.lrtc_frame_cryptor_release.argtypes = [FrameCryptorHandle]
+    lib.lrtc_frame_cryptor_set_enabled.restype = ctypes.c_int
+    lib.lrtc_frame_cryptor_set_enabled.argtypes = [FrameCryptorHandle, ctypes.c_bool]
+    lib.lrtc_frame_cryptor_set_key_index.restype = ctypes.c_int
+    lib.lrtc_frame_cryptor_set_key_index.argtypes = [FrameCryptorHandle, ctypes.c_int]
+    lib.lrtc_frame_cryptor_set_observer.restype = None
+    lib.lrtc_frame_cryptor_set_observer.argtypes = [FrameCryptorHandle, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_initialize.restype = ctypes.c_int
     lib.lrtc_initialize.argtypes = []
+    lib.lrtc_key_provider_create.restype = KeyProviderHandle
+    lib.lrtc_key_provider_create.argtypes = [ctypes.POINTER(KeyProviderOptions)]
+    lib.lrtc_key_provider_decrypt.restype = ctypes.c_int32
+    lib.lrtc_key_provider_decrypt.argtypes = [KeyProviderHandle, ctypes.c_char_p, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32]
+    lib.lrtc_key_provider_encrypt.restype = ctypes.c_int32
+    lib.lrtc_key_provider_encrypt.argtypes = [KeyProviderHandle, ctypes.c_char_p, ctypes.c_int, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32, ctypes.c_uint32]
+    lib.lrtc_key_provider_export_key.restype = ctypes.c_int32
+    lib.lrtc_key_provider_export_key.argtypes = [KeyProviderHandle, ctypes.c_char_p, ctypes.c_int, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32]
+    lib.lrtc_key_provider_export_shared_key.restype = ctypes.c_int32
+    lib.lrtc_key_provider_export_shared_key.argtypes = [KeyProviderHandle, ctypes.c_int, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32]
+    lib.lrtc_key_provider_ratchet_key.restype = ctypes.c_int
+    lib.lrtc_key_provider_ratchet_key.argtypes = [KeyProviderHandle, ctypes.c_char_p, ctypes.c_int]
+    lib.lrtc_key_provider_ratchet_shared_key.restype = ctypes.c_int
+    lib.lrtc_key_provider_ratchet_shared_key.argtypes = [KeyProviderHandle, ctypes.c_int]
+    lib.lrtc_key_provider_release.restype = None
+    lib.lrtc_key_provider_release.argtypes = [KeyProviderHandle]
+    lib.lrtc_key_provider_set_key.restype = ctypes.c_int
+    lib.lrtc_key_provider_set_key.argtypes = [KeyProviderHandle, ctypes.c_char_p, ctypes.c_int, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32]
+    lib.lrtc_key_provider_set_shared_key.restype = ctypes.c_int
+    lib.lrtc_key_provider_set_shared_key.argtypes = [KeyProviderHandle, ctypes.c_int, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32]
+    lib.lrtc_key_provider_set_sif_trailer.restype = None
+    lib.lrtc_key_provider_set_sif_trailer.argtypes = [KeyProviderHandle, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32]
+    lib.lrtc_layer_controller_get_level.restype = ctypes.c_int
+    lib.lrtc_layer_controller_get_level.argtypes = [LayerControllerHandle]
+    lib.lrtc_layer_controller_get_max_level.restype = ctypes.c_int
+    lib.lrtc_layer_controller_get_max_level.argtypes = [LayerControllerHandle]
+    lib.lrtc_layer_controller_release.restype = None
+    lib.lrtc_layer_controller_release.argtypes = [LayerControllerHandle]
     lib.lrtc_logging_remove_callback.restype = None
     lib.lrtc_logging_remove_callback.argtypes = []
     lib.lrtc_logging_set_callback.restype = None
@@ -542,6 +896,8 @@ def _bind_all(lib: ctypes.CDLL) -> None:
     lib.lrtc_peer_connection_add_ice_candidate.argtypes = [PeerConnectionHandle, ctypes.c_char_p, ctypes.c_int, ctypes.c_char_p]
     lib.lrtc_peer_connection_add_ice_candidate_ex.restype = ctypes.c_int
     lib.lrtc_peer_connection_add_ice_candidate_ex.argtypes = [PeerConnectionHandle, ctypes.c_char_p, ctypes.c_int, ctypes.c_char_p]
+    lib.lrtc_peer_connection_add_ice_candidates.restype = ctypes.c_int
+    lib.lrtc_peer_connection_add_ice_candidates.argtypes = [PeerConnectionHandle, ctypes.c_char_p, ctypes.POINTER(ctypes.c_int), ctypes.c_char_p, ctypes.c_uint32, ctypes.POINTER(ctypes.c_int)]
     lib.lrtc_peer_connection_add_stream.restype = ctypes.c_bool
     lib.lrtc_peer_connection_add_stream.argtypes = [PeerConnectionHandle, MediaStreamHandle]
     lib.lrtc_peer_connection_add_transceiver.restype = RtpTransceiverHandle
@@ -558,30 +914,54 @@ def _bind_all(lib: ctypes.CDLL) -> None:
     lib.lrtc_peer_connection_add_video_track_transceiver_with_init.argtypes = [PeerConnectionHandle, VideoTrackHandle, ctypes.POINTER(RtpTransceiverInit)]
     lib.lrtc_peer_connection_close.restype = None
     lib.lrtc_peer_connection_close.argtypes = [PeerConnectionHandle]
+    lib.lrtc_peer_connection_connect_loopback.restype = None
+    lib.lrtc_peer_connection_connect_loopback.argtypes = [PeerConnectionHandle, PeerConnectionHandle, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p]
+    lib.lrtc_peer_connection_copy_local_description.restype = ctypes.c_int32
+    lib.lrtc_peer_connection_copy_local_description.argtypes = [PeerConnectionHandle, ctypes.c_char_p, ctypes.c_uint32]
+    lib.lrtc_peer_connection_copy_local_description_type.restype = ctypes.c_int32
+    lib.lrtc_peer_connection_copy_local_description_type.argtypes = [PeerConnectionHandle, ctypes.c_char_p, ctypes.c_uint32]
+    lib.lrtc_peer_connection_copy_remote_description.restype = ctypes.c_int32
+    lib.lrtc_peer_connection_copy_remote_description.argtypes = [PeerConnectionHandle, ctypes.c_char_p, ctypes.c_uint32]
+    lib.lrtc_peer_connection_copy_remote_description_type.restype = ctypes.c_int32
+    lib.lrtc_peer_connection_copy_remote_description_type.argtypes = [PeerConnectionHandle, ctypes.c_char_p, ctypes.c_uint32]
     lib.lrtc_peer_connection_create.restype = PeerConnectionHandle
     lib.lrtc_peer_connection_create.argtypes = [FactoryHandle, ctypes.POINTER(RtcConfig), MediaConstraintsHandle, ctypes.POINTER(PeerConnectionCallbacks), ctypes.c_void_p]
     lib.lrtc_peer_connection_create_answer.restype = None
     lib.lrtc_peer_connection_create_answer.argtypes = [PeerConnectionHandle, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p, MediaConstraintsHandle]
     lib.lrtc_peer_connection_create_data_channel.restype = DataChannelHandle
     lib.lrtc_peer_connection_create_data_channel.argtypes = [PeerConnectionHandle, ctypes.c_char_p, ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_char_p, ctypes.c_int, ctypes.c_int]
+    lib.lrtc_peer_connection_create_keyed.restype = PeerConnectionHandle
+    lib.lrtc_peer_connection_create_keyed.argtypes = [FactoryHandle, ctypes.c_char_p, ctypes.POINTER(RtcConfig), MediaConstraintsHandle, ctypes.POINTER(PeerConnectionCallbacks), ctypes.c_void_p]
+    lib.lrtc_peer_connection_create_layer_controller.restype = LayerControllerHandle
+    lib.lrtc_peer_connection_create_layer_controller.argtypes = [PeerConnectionHandle, RtpSenderHandle, ctypes.POINTER(LayerControllerOptions), ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_peer_connection_create_offer.restype = None
     lib.lrtc_peer_connection_create_offer.argtypes = [PeerConnectionHandle, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p, MediaConstraintsHandle]
+    lib.lrtc_peer_connection_create_pooled.restype = PeerConnectionHandle
+    lib.lrtc_peer_connection_create_pooled.argtypes = [FactoryHandle, ctypes.POINTER(PeerConnectionCallbacks), ctypes.c_void_p]
+    lib.lrtc_peer_connection_create_templated_offer.restype = None
+    lib.lrtc_peer_connection_create_templated_offer.argtypes = [PeerConnectionHandle, SessionTemplateHandle, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p, MediaConstraintsHandle]
     lib.lrtc_peer_connection_get_local_description.restype = None
     lib.lrtc_peer_connection_get_local_description.argtypes = [PeerConnectionHandle, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_peer_connection_get_receiver.restype = RtpReceiverHandle
     lib.lrtc_peer_connection_get_receiver.argtypes = [PeerConnectionHandle, ctypes.c_uint32]
     lib.lrtc_peer_connection_get_receiver_stats.restype = None
     lib.lrtc_peer_connection_get_receiver_stats.argtypes = [PeerConnectionHandle, RtpReceiverHandle, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p]
+    lib.lrtc_peer_connection_get_receivers.restype = ctypes.c_uint32
+    lib.lrtc_peer_connection_get_receivers.argtypes = [PeerConnectionHandle, ctypes.POINTER(RtpReceiverHandle), ctypes.c_uint32]
     lib.lrtc_peer_connection_get_remote_description.restype = None
     lib.lrtc_peer_connection_get_remote_description.argtypes = [PeerConnectionHandle, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_peer_connection_get_sender.restype = RtpSenderHandle
     lib.lrtc_peer_connection_get_sender.argtypes = [PeerConnectionHandle, ctypes.c_uint32]
     lib.lrtc_peer_connection_get_sender_stats.restype = None
     lib.lrtc_peer_connection_get_sender_stats.argtypes = [PeerConnectionHandle, RtpSenderHandle, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p]
+    lib.lrtc_peer_connection_get_senders.restype = ctypes.c_uint32
+    lib.lrtc_peer_connection_get_senders.argtypes = [PeerConnectionHandle, ctypes.POINTER(RtpSenderHandle), ctypes.c_uint32]
     lib.lrtc_peer_connection_get_stats.restype = None
     lib.lrtc_peer_connection_get_stats.argtypes = [PeerConnectionHandle, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_peer_connection_get_transceiver.restype = RtpTransceiverHandle
     lib.lrtc_peer_connection_get_transceiver.argtypes = [PeerConnectionHandle, ctypes.c_uint32]
+    lib.lrtc_peer_connection_get_transceivers.restype = ctypes.c_uint32
+    lib.lrtc_peer_connection_get_transceivers.argtypes = [PeerConnectionHandle, ctypes.POINTER(RtpTransceiverHandle), ctypes.c_uint32]
     lib.lrtc_peer_connection_receiver_count.restype = ctypes.c_uint32
     lib.lrtc_peer_connection_receiver_count.argtypes = [PeerConnectionHandle]
     lib.lrtc_peer_connection_release.restype = None
@@ -594,10 +974,14 @@ def _bind_all(lib: ctypes.CDLL) -> None:
     lib.lrtc_peer_connection_restart_ice.argtypes = [PeerConnectionHandle]
     lib.lrtc_peer_connection_sender_count.restype = ctypes.c_uint32
     lib.lrtc_peer_connection_sender_count.argtypes = [PeerConnectionHandle]
+    lib.lrtc_peer_connection_set_bandwidth_observer.restype = None
+    lib.lrtc_peer_connection_set_bandwidth_observer.argtypes = [PeerConnectionHandle, ctypes.c_uint32, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_peer_connection_set_callbacks.restype = None
     lib.lrtc_peer_connection_set_callbacks.argtypes = [PeerConnectionHandle, ctypes.POINTER(PeerConnectionCallbacks), ctypes.c_void_p]
     lib.lrtc_peer_connection_set_codec_preferences.restype = ctypes.c_int
     lib.lrtc_peer_connection_set_codec_preferences.argtypes = [PeerConnectionHandle, ctypes.c_int, ctypes.c_char_p, ctypes.c_uint32]
+    lib.lrtc_peer_connection_set_ice_candidate_batching.restype = None
+    lib.lrtc_peer_connection_set_ice_candidate_batching.argtypes = [PeerConnectionHandle, ctypes.c_uint32, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_peer_connection_set_local_description.restype = None
     lib.lrtc_peer_connection_set_local_description.argtypes = [PeerConnectionHandle, ctypes.c_char_p, ctypes.c_char_p, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_peer_connection_set_remote_description.restype = None
@@ -610,6 +994,8 @@ def _bind_all(lib: ctypes.CDLL) -> None:
     lib.lrtc_rtp_receiver_encoding_count.argtypes = [RtpReceiverHandle]
     lib.lrtc_rtp_receiver_get_audio_track.restype = AudioTrackHandle
     lib.lrtc_rtp_receiver_get_audio_track.argtypes = [RtpReceiverHandle]
+    lib.lrtc_rtp_receiver_get_decode_stats.restype = ctypes.c_int
+    lib.lrtc_rtp_receiver_get_decode_stats.argtypes = [RtpReceiverHandle, ctypes.POINTER(DecodeOnDemandStats)]
     lib.lrtc_rtp_receiver_get_degradation_preference.restype = ctypes.c_int
     lib.lrtc_rtp_receiver_get_degradation_preference.argtypes = [RtpReceiverHandle]
     lib.lrtc_rtp_receiver_get_dtls_info.restype = ctypes.c_int
@@ -634,6 +1020,14 @@ def _bind_all(lib: ctypes.CDLL) -> None:
     lib.lrtc_rtp_receiver_get_video_track.argtypes = [RtpReceiverHandle]
     lib.lrtc_rtp_receiver_release.restype = None
     lib.lrtc_rtp_receiver_release.argtypes = [RtpReceiverHandle]
+    lib.lrtc_rtp_receiver_request_key_frame.restype = ctypes.c_int
+    lib.lrtc_rtp_receiver_request_key_frame.argtypes = [RtpReceiverHandle]
+    lib.lrtc_rtp_receiver_set_decode_on_demand.restype = ctypes.c_int
+    lib.lrtc_rtp_receiver_set_decode_on_demand.argtypes = [RtpReceiverHandle, ctypes.c_bool]
+    lib.lrtc_rtp_receiver_set_encoded_frame_recorder.restype = ctypes.c_int
+    lib.lrtc_rtp_receiver_set_encoded_frame_recorder.argtypes = [RtpReceiverHandle, EncodedFrameRecorderHandle]
+    lib.lrtc_rtp_receiver_set_encoded_frame_sink.restype = ctypes.c_int
+    lib.lrtc_rtp_receiver_set_encoded_frame_sink.argtypes = [RtpReceiverHandle, EncodedFrameSinkHandle]
     lib.lrtc_rtp_receiver_set_jitter_buffer_min_delay.restype = ctypes.c_int
     lib.lrtc_rtp_receiver_set_jitter_buffer_min_delay.argtypes = [RtpReceiverHandle, ctypes.c_double]
     lib.lrtc_rtp_receiver_stream_count.restype = ctypes.c_uint32
@@ -674,10 +1068,18 @@ def _bind_all(lib: ctypes.CDLL) -> None:
     lib.lrtc_rtp_sender_replace_audio_track.argtypes = [RtpSenderHandle, AudioTrackHandle]
     lib.lrtc_rtp_sender_replace_video_track.restype = ctypes.c_int
     lib.lrtc_rtp_sender_replace_video_track.argtypes = [RtpSenderHandle, VideoTrackHandle]
+    lib.lrtc_rtp_sender_send_encoded_audio.restype = ctypes.c_int
+    lib.lrtc_rtp_sender_send_encoded_audio.argtypes = [RtpSenderHandle, ctypes.c_char_p, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32, ctypes.c_uint32]
+    lib.lrtc_rtp_sender_send_encoded_frame.restype = ctypes.c_int
+    lib.lrtc_rtp_sender_send_encoded_frame.argtypes = [RtpSenderHandle, EncodedFrameHandle]
+    lib.lrtc_rtp_sender_set_encoded_frame_input.restype = ctypes.c_int
+    lib.lrtc_rtp_sender_set_encoded_frame_input.argtypes = [RtpSenderHandle, ctypes.c_bool]
     lib.lrtc_rtp_sender_set_encoding_parameters.restype = ctypes.c_int
     lib.lrtc_rtp_sender_set_encoding_parameters.argtypes = [RtpSenderHandle, ctypes.POINTER(RtpEncodingSettings)]
     lib.lrtc_rtp_sender_set_encoding_parameters_at.restype = ctypes.c_int
     lib.lrtc_rtp_sender_set_encoding_parameters_at.argtypes = [RtpSenderHandle, ctypes.c_uint32, ctypes.POINTER(RtpEncodingSettings)]
+    lib.lrtc_rtp_sender_set_encodings.restype = ctypes.c_int
+    lib.lrtc_rtp_sender_set_encodings.argtypes = [RtpSenderHandle, ctypes.POINTER(RtpEncodingSettings), ctypes.c_uint32, ctypes.c_int]
     lib.lrtc_rtp_sender_set_stream_ids.restype = ctypes.c_int
     lib.lrtc_rtp_sender_set_stream_ids.argtypes = [RtpSenderHandle, ctypes.c_char_p, ctypes.c_uint32]
     lib.lrtc_rtp_sender_stream_id_count.restype = ctypes.c_uint32
@@ -708,18 +1110,42 @@ def _bind_all(lib: ctypes.CDLL) -> None:
     lib.lrtc_rtp_transceiver_set_direction.argtypes = [RtpTransceiverHandle, ctypes.c_int, ctypes.c_char_p, ctypes.c_uint32]
     lib.lrtc_rtp_transceiver_stop.restype = ctypes.c_int
     lib.lrtc_rtp_transceiver_stop.argtypes = [RtpTransceiverHandle, ctypes.c_char_p, ctypes.c_uint32]
+    lib.lrtc_session_template_create.restype = SessionTemplateHandle
+    lib.lrtc_session_template_create.argtypes = []
+    lib.lrtc_session_template_get_stats.restype = ctypes.c_int
+    lib.lrtc_session_template_get_stats.argtypes = [SessionTemplateHandle, ctypes.POINTER(SessionTemplateStats)]
+    lib.lrtc_session_template_release.restype = None
+    lib.lrtc_session_template_release.argtypes = [SessionTemplateHandle]
+    lib.lrtc_session_template_reset.restype = None
+    lib.lrtc_session_template_reset.argtypes = [SessionTemplateHandle]
     lib.lrtc_terminate.restype = None
     lib.lrtc_terminate.argtypes = []
+    lib.lrtc_trace_drain.restype = ctypes.c_uint32
+    lib.lrtc_trace_drain.argtypes = [ctypes.POINTER(TraceEvent), ctypes.c_uint32]
+    lib.lrtc_trace_dropped_count.restype = ctypes.c_uint64
+    lib.lrtc_trace_dropped_count.argtypes = []
+    lib.lrtc_trace_format_chrome_json.restype = ctypes.c_int32
+    lib.lrtc_trace_format_chrome_json.argtypes = [ctypes.POINTER(TraceEvent), ctypes.c_uint32, ctypes.c_char_p, ctypes.c_uint32]
+    lib.lrtc_trace_start.restype = ctypes.c_int
+    lib.lrtc_trace_start.argtypes = [ctypes.c_uint32]
+    lib.lrtc_trace_stop.restype = None
+    lib.lrtc_trace_stop.argtypes = []
     lib.lrtc_video_capturer_capture_started.restype = ctypes.c_bool
     lib.lrtc_video_capturer_capture_started.argtypes = [VideoCapturerHandle]
     lib.lrtc_video_capturer_release.restype = None
     lib.lrtc_video_capturer_release.argtypes = [VideoCapturerHandle]
     lib.lrtc_video_capturer_start.restype = ctypes.c_bool
     lib.lrtc_video_capturer_start.argtypes = [VideoCapturerHandle]
+    lib.lrtc_video_capturer_start_async.restype = ctypes.c_int
+    lib.lrtc_video_capturer_start_async.argtypes = [VideoCapturerHandle, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_video_capturer_stop.restype = None
     lib.lrtc_video_capturer_stop.argtypes = [VideoCapturerHandle]
+    lib.lrtc_video_capturer_stop_async.restype = ctypes.c_int
+    lib.lrtc_video_capturer_stop_async.argtypes = [VideoCapturerHandle, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_video_device_create_capturer.restype = VideoCapturerHandle
     lib.lrtc_video_device_create_capturer.argtypes = [VideoDeviceHandle, ctypes.c_char_p, ctypes.c_uint32, ctypes.c_size_t, ctypes.c_size_t, ctypes.c_size_t]
+    lib.lrtc_video_device_create_capturer_async.restype = ctypes.c_int
+    lib.lrtc_video_device_create_capturer_async.argtypes = [VideoDeviceHandle, ctypes.c_char_p, ctypes.c_uint32, ctypes.c_size_t, ctypes.c_size_t, ctypes.c_size_t, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_video_device_get_device_name.restype = ctypes.c_int32
     lib.lrtc_video_device_get_device_name.argtypes = [VideoDeviceHandle, ctypes.c_uint32, ctypes.c_char_p, ctypes.c_uint32, ctypes.c_char_p, ctypes.c_uint32]
     lib.lrtc_video_device_number_of_devices.restype = ctypes.c_uint32
@@ -734,6 +1160,8 @@ def _bind_all(lib: ctypes.CDLL) -> None:
     lib.lrtc_video_frame_data_v.argtypes = [VideoFrameHandle]
     lib.lrtc_video_frame_data_y.restype = ctypes.POINTER(ctypes.c_uint8)
     lib.lrtc_video_frame_data_y.argtypes = [VideoFrameHandle]
+    lib.lrtc_video_frame_format.restype = ctypes.c_int
+    lib.lrtc_video_frame_format.argtypes = [VideoFrameHandle]
     lib.lrtc_video_frame_height.restype = ctypes.c_int
     lib.lrtc_video_frame_height.argtypes = [VideoFrameHandle]
     lib.lrtc_video_frame_release.restype = None
@@ -752,10 +1180,24 @@ def _bind_all(lib: ctypes.CDLL) -> None:
     lib.lrtc_video_frame_width.argtypes = [VideoFrameHandle]
     lib.lrtc_video_sink_create.restype = VideoSinkHandle
     lib.lrtc_video_sink_create.argtypes = [ctypes.POINTER(VideoSinkCallbacks), ctypes.c_void_p]
+    lib.lrtc_video_sink_create_with_wants.restype = VideoSinkHandle
+    lib.lrtc_video_sink_create_with_wants.argtypes = [ctypes.POINTER(VideoSinkCallbacks), ctypes.POINTER(VideoSinkWants), ctypes.c_void_p]
     lib.lrtc_video_sink_release.restype = None
     lib.lrtc_video_sink_release.argtypes = [VideoSinkHandle]
+    lib.lrtc_video_source_dropped_count.restype = ctypes.c_uint64
+    lib.lrtc_video_source_dropped_count.argtypes = [VideoSourceHandle]
+    lib.lrtc_video_source_push_argb.restype = ctypes.c_int
+    lib.lrtc_video_source_push_argb.argtypes = [VideoSourceHandle, ctypes.POINTER(ctypes.c_uint8), ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_int64, ctypes.c_void_p, ctypes.c_void_p]
+    lib.lrtc_video_source_push_encoded.restype = ctypes.c_int
+    lib.lrtc_video_source_push_encoded.argtypes = [VideoSourceHandle, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32, ctypes.c_int, ctypes.c_int, ctypes.c_bool, ctypes.c_int64]
+    lib.lrtc_video_source_push_i420.restype = ctypes.c_int
+    lib.lrtc_video_source_push_i420.argtypes = [VideoSourceHandle, ctypes.POINTER(ctypes.c_uint8), ctypes.c_int, ctypes.POINTER(ctypes.c_uint8), ctypes.c_int, ctypes.POINTER(ctypes.c_uint8), ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_int64, ctypes.c_void_p, ctypes.c_void_p]
+    lib.lrtc_video_source_push_nv12.restype = ctypes.c_int
+    lib.lrtc_video_source_push_nv12.argtypes = [VideoSourceHandle, ctypes.POINTER(ctypes.c_uint8), ctypes.c_int, ctypes.POINTER(ctypes.c_uint8), ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_int64, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_video_source_release.restype = None
     lib.lrtc_video_source_release.argtypes = [VideoSourceHandle]
+    lib.lrtc_video_source_set_key_frame_request_callback.restype = ctypes.c_int
+    lib.lrtc_video_source_set_key_frame_request_callback.argtypes = [VideoSourceHandle, ctypes.c_void_p, ctypes.c_void_p]
     lib.lrtc_video_track_add_sink.restype = None
     lib.lrtc_video_track_add_sink.argtypes = [VideoTrackHandle, VideoSinkHandle]
     lib.lrtc_video_track_get_enabled.restype = ctypes.c_int
@@ -982,18 +1424,30 @@ class DesktopCapturer:
             get_lib().lrtc_desktop_capturer_release(self._h)
             self._h = None
 
+    def get_thread_report(self, out_report: Any) -> Any:
+        return get_lib().lrtc_desktop_capturer_get_thread_report(self._h, out_report)
+
     def is_running(self) -> bool:
         return get_lib().lrtc_desktop_capturer_is_running(self._h)
 
     def start(self, fps: int) -> Any:
         return get_lib().lrtc_desktop_capturer_start(self._h, fps)
 
+    def start_async(self, fps: int, callback: Any, user_data: int) -> Any:
+        return get_lib().lrtc_desktop_capturer_start_async(self._h, fps, callback, user_data)
+
     def start_region(self, fps: int, x: int, y: int, w: int, h: int) -> Any:
         return get_lib().lrtc_desktop_capturer_start_region(self._h, fps, x, y, w, h)
 
+    def start_region_async(self, fps: int, x: int, y: int, w: int, h: int, callback: Any, user_data: int) -> Any:
+        return get_lib().lrtc_desktop_capturer_start_region_async(self._h, fps, x, y, w, h, callback, user_data)
+
     def stop(self) -> None:
         get_lib().lrtc_desktop_capturer_stop(self._h)
 
+    def stop_async(self, callback: Any, user_data: int) -> Any:
+        return get_lib().lrtc_desktop_capturer_stop_async(self._h, callback, user_data)
+
 
 class DesktopDevice:
     """Managed wrapper for lrtc_desktop_device_t."""
@@ -1103,6 +1557,103 @@ class DtmfSender:
         return get_lib().lrtc_dtmf_sender_tones(self._h, buffer, buffer_len)
 
 
+class EncodedFrameRecorder:
+    """Managed wrapper for lrtc_encoded_frame_recorder_t."""
+
+    def __init__(self, _handle: EncodedFrameRecorderHandle) -> None:
+        self._h = _handle
+
+    def __del__(self) -> None:
+        self.release()
+
+    def __enter__(self) -> "EncodedFrameRecorder":
+        return self
+
+    def __exit__(self, *_: Any) -> None:
+        self.release()
+
+    def __bool__(self) -> bool:
+        return bool(self._h)
+
+    def release(self) -> None:
+        if self._h:
+            get_lib().lrtc_encoded_frame_recorder_release(self._h)
+            self._h = None
+
+    def get_stats(self, out_stats: Any) -> Any:
+        return get_lib().lrtc_encoded_frame_recorder_get_stats(self._h, out_stats)
+
+    def stop(self) -> Any:
+        return get_lib().lrtc_encoded_frame_recorder_stop(self._h)
+
+
+class EncodedFrameSink:
+    """Managed wrapper for lrtc_encoded_frame_sink_t."""
+
+    def __init__(self, _handle: EncodedFrameSinkHandle) -> None:
+        self._h = _handle
+
+    def __del__(self) -> None:
+        self.release()
+
+    def __enter__(self) -> "EncodedFrameSink":
+        return self
+
+    def __exit__(self, *_: Any) -> None:
+        self.release()
+
+    def __bool__(self) -> bool:
+        return bool(self._h)
+
+    def release(self) -> None:
+        if self._h:
+            get_lib().lrtc_encoded_frame_sink_release(self._h)
+            self._h = None
+
+
+class EncodedFrame:
+    """Managed wrapper for lrtc_encoded_frame_t."""
+
+    def __init__(self, _handle: EncodedFrameHandle) -> None:
+        self._h = _handle
+
+    def __del__(self) -> None:
+        self.release()
+
+    def __enter__(self) -> "EncodedFrame":
+        return self
+
+    def __exit__(self, *_: Any) -> None:
+        self.release()
+
+    def __bool__(self) -> bool:
+        return bool(self._h)
+
+    def release(self) -> None:
+        if self._h:
+            get_lib().lrtc_encoded_frame_release(self._h)
+            self._h = None
+
+    def retain(self) -> None:
+        if self._h:
+            get_lib().lrtc_encoded_frame_retain(self._h)
+
+    def data(self) -> int:
+        return get_lib().lrtc_encoded_frame_data(self._h)
+
+    def get_dependencies(self, out_frame_ids: int, capacity: int) -> int:
+        return get_lib().lrtc_encoded_frame_get_dependencies(self._h, out_frame_ids, capacity)
+
+    def get_info(self, out_info: Any) -> Any:
+        return get_lib().lrtc_encoded_frame_get_info(self._h, out_info)
+
+    def get_mime_type(self, buffer: Optional[bytes], buffer_len: int) -> int:
+        return get_lib().lrtc_encoded_frame_get_mime_type(self._h, buffer, buffer_len)
+
+    def size(self) -> int:
+        return get_lib().lrtc_encoded_frame_size(self._h)
+
+
 class Factory:
     """Managed wrapper for lrtc_factory_t."""
 
@@ -1126,30 +1677,66 @@ class Factory:
             get_lib().lrtc_factory_release(self._h)
             self._h = None
 
+    def configure_certificate_cache(self, options: Any) -> Any:
+        return get_lib().lrtc_factory_configure_certificate_cache(self._h, options)
+
+    def configure_peer_connection_pool(self, config: Any, constraints: Optional[MediaConstraintsHandle], size: int) -> Any:
+        return get_lib().lrtc_factory_configure_peer_connection_pool(self._h, config, constraints, size)
+
+    def configure_udp_mux(self, options: Any) -> Any:
+        return get_lib().lrtc_factory_configure_udp_mux(self._h, options)
+
     def create_audio_source(self, label: Optional[bytes], source_type: Any, options: Any) -> Optional[AudioSourceHandle]:
         return get_lib().lrtc_factory_create_audio_source(self._h, label, source_type, options)
 
+    def create_audio_source_async(self, label: Optional[bytes], source_type: Any, options: Any, callback: Any, user_data: int) -> Any:
+        return get_lib().lrtc_factory_create_audio_source_async(self._h, label, source_type, options, callback, user_data)
+
     def create_audio_track(self, source: Optional[AudioSourceHandle], track_id: Optional[bytes]) -> Optional[AudioTrackHandle]:
         return get_lib().lrtc_factory_create_audio_track(self._h, source, track_id)
 
+    def create_audio_track_async(self, source: Optional[AudioSourceHandle], track_id: Optional[bytes], callback: Any, user_data: int) -> Any:
+        return get_lib().lrtc_factory_create_audio_track_async(self._h, source, track_id, callback, user_data)
+
+    def create_custom_video_source(self, label: Optional[bytes], is_screencast: bool) -> Optional[VideoSourceHandle]:
+        return get_lib().lrtc_factory_create_custom_video_source(self._h, label, is_screencast)
+
     def create_desktop_source(self, capturer: Optional[DesktopCapturerHandle], label: Optional[bytes], constraints: Optional[MediaConstraintsHandle]) -> Optional[VideoSourceHandle]:
         return get_lib().lrtc_factory_create_desktop_source(self._h, capturer, label, constraints)
 
+    def create_desktop_source_async(self, capturer: Optional[DesktopCapturerHandle], label: Optional[bytes], constraints: Optional[MediaConstraintsHandle], callback: Any, user_data: int) -> Any:
+        return get_lib().lrtc_factory_create_desktop_source_async(self._h, capturer, label, constraints, callback, user_data)
+
+    def create_encoded_video_source(self, label: Optional[bytes], codec: Optional[bytes]) -> Optional[VideoSourceHandle]:
+        return get_lib().lrtc_factory_create_encoded_video_source(self._h, label, codec)
+
     def create_stream(self, stream_id: Optional[bytes]) -> Optional[MediaStreamHandle]:
         return get_lib().lrtc_factory_create_stream(self._h, stream_id)
 
     def create_video_source(self, capturer: Optional[VideoCapturerHandle], label: Optional[bytes], constraints: Optional[MediaConstraintsHandle]) -> Optional[VideoSourceHandle]:
         return get_lib().lrtc_factory_create_video_source(self._h, capturer, label, constraints)
 
+    def create_video_source_async(self, capturer: Optional[VideoCapturerHandle], label: Optional[bytes], constraints: Optional[MediaConstraintsHandle], callback: Any, user_data: int) -> Any:
+        return get_lib().lrtc_factory_create_video_source_async(self._h, capturer, label, constraints, callback, user_data)
+
     def create_video_track(self, source: Optional[VideoSourceHandle], track_id: Optional[bytes]) -> Optional[VideoTrackHandle]:
         return get_lib().lrtc_factory_create_video_track(self._h, source, track_id)
 
+    def create_video_track_async(self, source: Optional[VideoSourceHandle], track_id: Optional[bytes], callback: Any, user_data: int) -> Any:
+        return get_lib().lrtc_factory_create_video_track_async(self._h, source, track_id, callback, user_data)
+
+    def export_certificate_pem(self, buffer: Optional[bytes], buffer_len: int) -> int:
+        return get_lib().lrtc_factory_export_certificate_pem(self._h, buffer, buffer_len)
+
     def get_audio_device(self) -> Optional[AudioDeviceHandle]:
         return get_lib().lrtc_factory_get_audio_device(self._h)
 
     def get_desktop_device(self) -> Optional[DesktopDeviceHandle]:
         return get_lib().lrtc_factory_get_desktop_device(self._h)
 
+    def get_peer_connection_pool_stats(self, out_stats: Any) -> Any:
+        return get_lib().lrtc_factory_get_peer_connection_pool_stats(self._h, out_stats)
+
     def get_rtp_receiver_capabilities(self, media_type: Any, success: Any, failure: Any, user_data: int) -> None:
         get_lib().lrtc_factory_get_rtp_receiver_capabilities(self._h, media_type, success, failure, user_data)
 
@@ -1159,18 +1746,156 @@ class Factory:
     def get_rtp_sender_codec_mime_types(self, media_type: Any, success: Any, failure: Any, user_data: int) -> None:
         get_lib().lrtc_factory_get_rtp_sender_codec_mime_types(self._h, media_type, success, failure, user_data)
 
+    def get_thread_report(self, role: Any, index: int, out_report: Any) -> Any:
+        return get_lib().lrtc_factory_get_thread_report(self._h, role, index, out_report)
+
+    def get_udp_mux_stats(self, out_stats: Any) -> Any:
+        return get_lib().lrtc_factory_get_udp_mux_stats(self._h, out_stats)
+
     def get_video_device(self) -> Optional[VideoDeviceHandle]:
         return get_lib().lrtc_factory_get_video_device(self._h)
 
+    def import_certificate_pem(self, pem: Optional[bytes]) -> Any:
+        return get_lib().lrtc_factory_import_certificate_pem(self._h, pem)
+
     def initialize(self) -> Any:
         return get_lib().lrtc_factory_initialize(self._h)
 
+    def set_virtual_network_conditions(self, options: Any) -> Any:
+        return get_lib().lrtc_factory_set_virtual_network_conditions(self._h, options)
+
     def terminate(self) -> None:
         get_lib().lrtc_factory_terminate(self._h)
 
     def lrtc_peer_connection_create(self, config: Any, constraints: Optional[MediaConstraintsHandle], callbacks: Any, user_data: int) -> Optional[PeerConnectionHandle]:
         return get_lib().lrtc_peer_connection_create(self._h, config, constraints, callbacks, user_data)
 
+    def lrtc_peer_connection_create_keyed(self, network_key: Optional[bytes], config: Any, constraints: Optional[MediaConstraintsHandle], callbacks: Any, user_data: int) -> Optional[PeerConnectionHandle]:
+        return get_lib().lrtc_peer_connection_create_keyed(self._h, network_key, config, constraints, callbacks, user_data)
+
+    def lrtc_peer_connection_create_pooled(self, callbacks: Any, user_data: int) -> Optional[PeerConnectionHandle]:
+        return get_lib().lrtc_peer_connection_create_pooled(self._h, callbacks, user_data)
+
+
+class FrameCryptor:
+    """Managed wrapper for lrtc_frame_cryptor_t."""
+
+    def __init__(self, _handle: FrameCryptorHandle) -> None:
+        self._h = _handle
+
+    def __del__(self) -> None:
+        self.release()
+
+    def __enter__(self) -> "FrameCryptor":
+        return self
+
+    def __exit__(self, *_: Any) -> None:
+        self.release()
+
+    def __bool__(self) -> bool:
+        return bool(self._h)
+
+    def release(self) -> None:
+        if self._h:
+            get_lib().lrtc_frame_cryptor_release(self._h)
+            self._h = None
+
+    def get_enabled(self) -> bool:
+        return get_lib().lrtc_frame_cryptor_get_enabled(self._h)
+
+    def get_key_index(self) -> int:
+        return get_lib().lrtc_frame_cryptor_get_key_index(self._h)
+
+    def set_enabled(self, enabled: bool) -> Any:
+        return get_lib().lrtc_frame_cryptor_set_enabled(self._h, enabled)
+
+    def set_key_index(self, index: int) -> Any:
+        return get_lib().lrtc_frame_cryptor_set_key_index(self._h, index)
+
+    def set_observer(self, callback: Any, user_data: int) -> None:
+        get_lib().lrtc_frame_cryptor_set_observer(self._h, callback, user_data)
+
+
+class KeyProvider:
+    """Managed wrapper for lrtc_key_provider_t."""
+
+    def __init__(self, _handle: KeyProviderHandle) -> None:
+        self._h = _handle
+
+    def __del__(self) -> None:
+        self.release()
+
+    def __enter__(self) -> "KeyProvider":
+        return self
+
+    def __exit__(self, *_: Any) -> None:
+        self.release()
+
+    def __bool__(self) -> bool:
+        return bool(self._h)
+
+    def release(self) -> None:
+        if self._h:
+            get_lib().lrtc_key_provider_release(self._h)
+            self._h = None
+
+    def decrypt(self, participant_id: Optional[bytes], data: int, size: int) -> int:
+        return get_lib().lrtc_key_provider_decrypt(self._h, participant_id, data, size)
+
+    def encrypt(self, participant_id: Optional[bytes], key_index: int, data: int, size: int, capacity: int) -> int:
+        return get_lib().lrtc_key_provider_encrypt(self._h, participant_id, key_index, data, size, capacity)
+
+    def export_key(self, participant_id: Optional[bytes], key_index: int, buffer: int, buffer_len: int) -> int:
+        return get_lib().lrtc_key_provider_export_key(self._h, participant_id, key_index, buffer, buffer_len)
+
+    def export_shared_key(self, key_index: int, buffer: int, buffer_len: int) -> int:
+        return get_lib().lrtc_key_provider_export_shared_key(self._h, key_index, buffer, buffer_len)
+
+    def ratchet_key(self, participant_id: Optional[bytes], key_index: int) -> Any:
+        return get_lib().lrtc_key_provider_ratchet_key(self._h, participant_id, key_index)
+
+    def ratchet_shared_key(self, key_index: int) -> Any:
+        return get_lib().lrtc_key_provider_ratchet_shared_key(self._h, key_index)
+
+    def set_key(self, participant_id: Optional[bytes], key_index: int, key: int, key_len: int) -> Any:
+        return get_lib().lrtc_key_provider_set_key(self._h, participant_id, key_index, key, key_len)
+
+    def set_shared_key(self, key_index: int, key: int, key_len: int) -> Any:
+        return get_lib().lrtc_key_provider_set_shared_key(self._h, key_index, key, key_len)
+
+    def set_sif_trailer(self, trailer: int, trailer_len: int) -> None:
+        get_lib().lrtc_key_provider_set_sif_trailer(self._h, trailer, trailer_len)
+
+
+class LayerController:
+    """Managed wrapper for lrtc_layer_controller_t."""
+
+    def __init__(self, _handle: LayerControllerHandle) -> None:
+        self._h = _handle
+
+    def __del__(self) -> None:
+        self.release()
+
+    def __enter__(self) -> "LayerController":
+        return self
+
+    def __exit__(self, *_: Any) -> None:
+        self.release()
+
+    def __bool__(self) -> bool:
+        return bool(self._h)
+
+    def release(self) -> None:
+        if self._h:
+            get_lib().lrtc_layer_controller_release(self._h)
+            self._h = None
+
+    def get_level(self) -> int:
+        return get_lib().lrtc_layer_controller_get_level(self._h)
+
+    def get_max_level(self) -> int:
+        return get_lib().lrtc_layer_controller_get_max_level(self._h)
+
 
 class MediaConstraints:
     """Managed wrapper for lrtc_media_constraints_t."""
@@ -1312,6 +2037,9 @@ class PeerConnection:
     def add_ice_candidate_ex(self, sdp_mid: Optional[bytes], sdp_mline_index: int, candidate: Optional[bytes]) -> int:
         return get_lib().lrtc_peer_connection_add_ice_candidate_ex(self._h, sdp_mid, sdp_mline_index, candidate)
 
+    def add_ice_candidates(self, sdp_mids: Optional[bytes], sdp_mline_indexes: int, candidates: Optional[bytes], count: int, out_applied: int) -> int:
+        return get_lib().lrtc_peer_connection_add_ice_candidates(self._h, sdp_mids, sdp_mline_indexes, candidates, count, out_applied)
+
     def add_stream(self, stream: Optional[MediaStreamHandle]) -> bool:
         return get_lib().lrtc_peer_connection_add_stream(self._h, stream)
 
@@ -1336,15 +2064,36 @@ class PeerConnection:
     def close(self) -> None:
         get_lib().lrtc_peer_connection_close(self._h)
 
+    def connect_loopback(self, answerer: Optional[PeerConnectionHandle], success: Any, failure: Any, user_data: int) -> None:
+        get_lib().lrtc_peer_connection_connect_loopback(self._h, answerer, success, failure, user_data)
+
+    def copy_local_description(self, buffer: Optional[bytes], buffer_len: int) -> int:
+        return get_lib().lrtc_peer_connection_copy_local_description(self._h, buffer, buffer_len)
+
+    def copy_local_description_type(self, buffer: Optional[bytes], buffer_len: int) -> int:
+        return get_lib().lrtc_peer_connection_copy_local_description_type(self._h, buffer, buffer_len)
+
+    def copy_remote_description(self, buffer: Optional[bytes], buffer_len: int) -> int:
+        return get_lib().lrtc_peer_connection_copy_remote_description(self._h, buffer, buffer_len)
+
+    def copy_remote_description_type(self, buffer: Optional[bytes], buffer_len: int) -> int:
+        return get_lib().lrtc_peer_connection_copy_remote_description_type(self._h, buffer, buffer_len)
+
     def create_answer(self, success: Any, failure: Any, user_data: int, constraints: Optional[MediaConstraintsHandle]) -> None:
         get_lib().lrtc_peer_connection_create_answer(self._h, success, failure, user_data, constraints)
 
     def create_data_channel(self, label: Optional[bytes], ordered: int, reliable: int, max_retransmit_time: int, max_retransmits: int, protocol: Optional[bytes], negotiated: int, id: int) -> Optional[DataChannelHandle]:
         return get_lib().lrtc_peer_connection_create_data_channel(self._h, label, ordered, reliable, max_retransmit_time, max_retransmits, protocol, negotiated, id)
 
+    def create_layer_controller(self, sender: Optional[RtpSenderHandle], options: Any, callback: Any, user_data: int) -> Optional[LayerControllerHandle]:
+        return get_lib().lrtc_peer_connection_create_layer_controller(self._h, sender, options, callback, user_data)
+
     def create_offer(self, success: Any, failure: Any, user_data: int, constraints: Optional[MediaConstraintsHandle]) -> None:
         get_lib().lrtc_peer_connection_create_offer(self._h, success, failure, user_data, constraints)
 
+    def create_templated_offer(self, session_template: Optional[SessionTemplateHandle], success: Any, failure: Any, user_data: int, constraints: Optional[MediaConstraintsHandle]) -> None:
+        get_lib().lrtc_peer_connection_create_templated_offer(self._h, session_template, success, failure, user_data, constraints)
+
     def get_local_description(self, success: Any, failure: Any, user_data: int) -> None:
         get_lib().lrtc_peer_connection_get_local_description(self._h, success, failure, user_data)
 
@@ -1354,6 +2103,9 @@ class PeerConnection:
     def get_receiver_stats(self, receiver: Optional[RtpReceiverHandle], success: Any, failure: Any, user_data: int) -> None:
         get_lib().lrtc_peer_connection_get_receiver_stats(self._h, receiver, success, failure, user_data)
 
+    def get_receivers(self, out_receivers: int, capacity: int) -> int:
+        return get_lib().lrtc_peer_connection_get_receivers(self._h, out_receivers, capacity)
+
     def get_remote_description(self, success: Any, failure: Any, user_data: int) -> None:
         get_lib().lrtc_peer_connection_get_remote_description(self._h, success, failure, user_data)
 
@@ -1363,12 +2115,18 @@ class PeerConnection:
     def get_sender_stats(self, sender: Optional[RtpSenderHandle], success: Any, failure: Any, user_data: int) -> None:
         get_lib().lrtc_peer_connection_get_sender_stats(self._h, sender, success, failure, user_data)
 
+    def get_senders(self, out_senders: int, capacity: int) -> int:
+        return get_lib().lrtc_peer_connection_get_senders(self._h, out_senders, capacity)
+
     def get_stats(self, success: Any, failure: Any, user_data: int) -> None:
         get_lib().lrtc_peer_connection_get_stats(self._h, success, failure, user_data)
 
     def get_transceiver(self, index: int) -> Optional[RtpTransceiverHandle]:
         return get_lib().lrtc_peer_connection_get_transceiver(self._h, index)
 
+    def get_transceivers(self, out_transceivers: int, capacity: int) -> int:
+        return get_lib().lrtc_peer_connection_get_transceivers(self._h, out_transceivers, capacity)
+
     def receiver_count(self) -> int:
         return get_lib().lrtc_peer_connection_receiver_count(self._h)
 
@@ -1384,12 +2142,18 @@ class PeerConnection:
     def sender_count(self) -> int:
         return get_lib().lrtc_peer_connection_sender_count(self._h)
 
+    def set_bandwidth_observer(self, interval_ms: int, callback: Any, user_data: int) -> None:
+        get_lib().lrtc_peer_connection_set_bandwidth_observer(self._h, interval_ms, callback, user_data)
+
     def set_callbacks(self, callbacks: Any, user_data: int) -> None:
         get_lib().lrtc_peer_connection_set_callbacks(self._h, callbacks, user_data)
 
     def set_codec_preferences(self, media_type: Any, mime_types: Optional[bytes], mime_type_count: int) -> int:
         return get_lib().lrtc_peer_connection_set_codec_preferences(self._h, media_type, mime_types, mime_type_count)
 
+    def set_ice_candidate_batching(self, window_ms: int, callback: Any, user_data: int) -> None:
+        get_lib().lrtc_peer_connection_set_ice_candidate_batching(self._h, window_ms, callback, user_data)
+
     def set_local_description(self, sdp: Optional[bytes], type: Optional[bytes], success: Any, failure: Any, user_data: int) -> None:
         get_lib().lrtc_peer_connection_set_local_description(self._h, sdp, type, success, failure, user_data)
 
@@ -1432,6 +2196,9 @@ class RtpReceiver:
     def get_audio_track(self) -> Optional[AudioTrackHandle]:
         return get_lib().lrtc_rtp_receiver_get_audio_track(self._h)
 
+    def get_decode_stats(self, out_stats: Any) -> Any:
+        return get_lib().lrtc_rtp_receiver_get_decode_stats(self._h, out_stats)
+
     def get_degradation_preference(self) -> int:
         return get_lib().lrtc_rtp_receiver_get_degradation_preference(self._h)
 
@@ -1465,6 +2232,18 @@ class RtpReceiver:
     def get_video_track(self) -> Optional[VideoTrackHandle]:
         return get_lib().lrtc_rtp_receiver_get_video_track(self._h)
 
+    def request_key_frame(self) -> Any:
+        return get_lib().lrtc_rtp_receiver_request_key_frame(self._h)
+
+    def set_decode_on_demand(self, enabled: bool) -> Any:
+        return get_lib().lrtc_rtp_receiver_set_decode_on_demand(self._h, enabled)
+
+    def set_encoded_frame_recorder(self, recorder: Optional[EncodedFrameRecorderHandle]) -> Any:
+        return get_lib().lrtc_rtp_receiver_set_encoded_frame_recorder(self._h, recorder)
+
+    def set_encoded_frame_sink(self, sink: Optional[EncodedFrameSinkHandle]) -> Any:
+        return get_lib().lrtc_rtp_receiver_set_encoded_frame_sink(self._h, sink)
+
     def set_jitter_buffer_min_delay(self, delay_seconds: float) -> int:
         return get_lib().lrtc_rtp_receiver_set_jitter_buffer_min_delay(self._h, delay_seconds)
 
@@ -1474,6 +2253,9 @@ class RtpReceiver:
     def stream_id_count(self) -> int:
         return get_lib().lrtc_rtp_receiver_stream_id_count(self._h)
 
+    def lrtc_frame_cryptor_create_for_receiver(self, participant_id: Optional[bytes], algorithm: int, key_provider: Optional[KeyProviderHandle]) -> Optional[FrameCryptorHandle]:
+        return get_lib().lrtc_frame_cryptor_create_for_receiver(self._h, participant_id, algorithm, key_provider)
+
 
 class RtpSender:
     """Managed wrapper for lrtc_rtp_sender_t."""
@@ -1546,18 +2328,33 @@ class RtpSender:
     def replace_video_track(self, track: Optional[VideoTrackHandle]) -> int:
         return get_lib().lrtc_rtp_sender_replace_video_track(self._h, track)
 
+    def send_encoded_audio(self, mime_type: Optional[bytes], data: int, size: int, rtp_timestamp: int) -> Any:
+        return get_lib().lrtc_rtp_sender_send_encoded_audio(self._h, mime_type, data, size, rtp_timestamp)
+
+    def send_encoded_frame(self, frame: Optional[EncodedFrameHandle]) -> Any:
+        return get_lib().lrtc_rtp_sender_send_encoded_frame(self._h, frame)
+
+    def set_encoded_frame_input(self, enabled: bool) -> Any:
+        return get_lib().lrtc_rtp_sender_set_encoded_frame_input(self._h, enabled)
+
     def set_encoding_parameters(self, settings: Any) -> int:
         return get_lib().lrtc_rtp_sender_set_encoding_parameters(self._h, settings)
 
     def set_encoding_parameters_at(self, index: int, settings: Any) -> int:
         return get_lib().lrtc_rtp_sender_set_encoding_parameters_at(self._h, index, settings)
 
+    def set_encodings(self, settings: Any, count: int, degradation_preference: int) -> Any:
+        return get_lib().lrtc_rtp_sender_set_encodings(self._h, settings, count, degradation_preference)
+
     def set_stream_ids(self, stream_ids: Optional[bytes], stream_id_count: int) -> int:
         return get_lib().lrtc_rtp_sender_set_stream_ids(self._h, stream_ids, stream_id_count)
 
     def stream_id_count(self) -> int:
         return get_lib().lrtc_rtp_sender_stream_id_count(self._h)
 
+    def lrtc_frame_cryptor_create_for_sender(self, participant_id: Optional[bytes], algorithm: int, key_provider: Optional[KeyProviderHandle]) -> Optional[FrameCryptorHandle]:
+        return get_lib().lrtc_frame_cryptor_create_for_sender(self._h, participant_id, algorithm, key_provider)
+
 
 class RtpTransceiver:
     """Managed wrapper for lrtc_rtp_transceiver_t."""
@@ -1619,6 +2416,36 @@ class RtpTransceiver:
         return get_lib().lrtc_rtp_transceiver_stop(self._h, error, error_len)
 
 
+class SessionTemplate:
+    """Managed wrapper for lrtc_session_template_t."""
+
+    def __init__(self, _handle: SessionTemplateHandle) -> None:
+        self._h = _handle
+
+    def __del__(self) -> None:
+        self.release()
+
+    def __enter__(self) -> "SessionTemplate":
+        return self
+
+    def __exit__(self, *_: Any) -> None:
+        self.release()
+
+    def __bool__(self) -> bool:
+        return bool(self._h)
+
+    def release(self) -> None:
+        if self._h:
+            get_lib().lrtc_session_template_release(self._h)
+            self._h = None
+
+    def get_stats(self, out_stats: Any) -> Any:
+        return get_lib().lrtc_session_template_get_stats(self._h, out_stats)
+
+    def reset(self) -> None:
+        get_lib().lrtc_session_template_reset(self._h)
+
+
 class VideoCapturer:
     """Managed wrapper for lrtc_video_capturer_t."""
 
@@ -1648,9 +2475,15 @@ class VideoCapturer:
     def start(self) -> bool:
         return get_lib().lrtc_video_capturer_start(self._h)
 
+    def start_async(self, callback: Any, user_data: int) -> Any:
+        return get_lib().lrtc_video_capturer_start_async(self._h, callback, user_data)
+
     def stop(self) -> None:
         get_lib().lrtc_video_capturer_stop(self._h)
 
+    def stop_async(self, callback: Any, user_data: int) -> Any:
+        return get_lib().lrtc_video_capturer_stop_async(self._h, callback, user_data)
+
 
 class VideoDevice:
     """Managed wrapper for lrtc_video_device_t."""
@@ -1678,6 +2511,9 @@ class VideoDevice:
     def create_capturer(self, name: Optional[bytes], index: int, width: int, height: int, target_fps: int) -> Optional[VideoCapturerHandle]:
         return get_lib().lrtc_video_device_create_capturer(self._h, name, index, width, height, target_fps)
 
+    def create_capturer_async(self, name: Optional[bytes], index: int, width: int, height: int, target_fps: int, callback: Any, user_data: int) -> Any:
+        return get_lib().lrtc_video_device_create_capturer_async(self._h, name, index, width, height, target_fps, callback, user_data)
+
     def get_device_name(self, index: int, name: Optional[bytes], name_length: int, unique_id: Optional[bytes], unique_id_length: int) -> int:
         return get_lib().lrtc_video_device_get_device_name(self._h, index, name, name_length, unique_id, unique_id_length)
 
@@ -1724,6 +2560,9 @@ class VideoFrame:
     def data_y(self) -> int:
         return get_lib().lrtc_video_frame_data_y(self._h)
 
+    def format(self) -> int:
+        return get_lib().lrtc_video_frame_format(self._h)
+
     def height(self) -> int:
         return get_lib().lrtc_video_frame_height(self._h)
 
@@ -1790,6 +2629,24 @@ class VideoSource:
             get_lib().lrtc_video_source_release(self._h)
             self._h = None
 
+    def dropped_count(self) -> int:
+        return get_lib().lrtc_video_source_dropped_count(self._h)
+
+    def push_argb(self, data: int, stride: int, width: int, height: int, format: int, timestamp_us: int, release: Any, user_data: int) -> int:
+        return get_lib().lrtc_video_source_push_argb(self._h, data, stride, width, height, format, timestamp_us, release, user_data)
+
+    def push_encoded(self, data: int, size: int, width: int, height: int, key_frame: bool, timestamp_us: int) -> int:
+        return get_lib().lrtc_video_source_push_encoded(self._h, data, size, width, height, key_frame, timestamp_us)
+
+    def push_i420(self, data_y: int, stride_y: int, data_u: int, stride_u: int, data_v: int, stride_v: int, width: int, height: int, timestamp_us: int, release: Any, user_data: int) -> int:
+        return get_lib().lrtc_video_source_push_i420(self._h, data_y, stride_y, data_u, stride_u, data_v, stride_v, width, height, timestamp_us, release, user_data)
+
+    def push_nv12(self, data_y: int, stride_y: int, data_uv: int, stride_uv: int, width: int, height: int, timestamp_us: int, release: Any, user_data: int) -> int:
+        return get_lib().lrtc_video_source_push_nv12(self._h, data_y, stride_y, data_uv, stride_uv, width, height, timestamp_us, release, user_data)
+
+    def set_key_frame_request_callback(self, callback: Any, user_data: int) -> Any:
+        return get_lib().lrtc_video_source_set_key_frame_request_callback(self._h, callback, user_data)
+
 
 class VideoTrack:
     """Managed wrapper for lrtc_video_track_t."""
@@ -1852,12 +2709,24 @@ def abi_version_string(buffer: Optional[bytes], buffer_len: int) -> int:
 def audio_sink_create(callbacks: Any, user_data: int) -> Optional[AudioSinkHandle]:
     return get_lib().lrtc_audio_sink_create(callbacks, user_data)
 
+def encoded_frame_recorder_create(path: Optional[bytes], options: Any) -> Optional[EncodedFrameRecorderHandle]:
+    return get_lib().lrtc_encoded_frame_recorder_create(path, options)
+
+def encoded_frame_sink_create(callback: Any, user_data: int) -> Optional[EncodedFrameSinkHandle]:
+    return get_lib().lrtc_encoded_frame_sink_create(callback, user_data)
+
 def factory_create() -> Optional[FactoryHandle]:
     return get_lib().lrtc_factory_create()
 
+def factory_create_with_options(options: Any, share_with: Optional[FactoryHandle]) -> Optional[FactoryHandle]:
+    return get_lib().lrtc_factory_create_with_options(options, share_with)
+
 def initialize() -> Any:
     return get_lib().lrtc_initialize()
 
+def key_provider_create(options: Any) -> Optional[KeyProviderHandle]:
+    return get_lib().lrtc_key_provider_create(options)
+
 def logging_remove_callback() -> None:
     get_lib().lrtc_logging_remove_callback()
 
@@ -1879,9 +2748,30 @@ def media_constraints_create() -> Optional[MediaConstraintsHandle]:
 def media_constraints_release(constraints: Optional[MediaConstraintsHandle]) -> None:
     get_lib().lrtc_media_constraints_release(constraints)
 
+def session_template_create() -> Optional[SessionTemplateHandle]:
+    return get_lib().lrtc_session_template_create()
+
 def terminate() -> None:
     get_lib().lrtc_terminate()
 
+def trace_drain(events: Any, capacity: int) -> int:
+    return get_lib().lrtc_trace_drain(events, capacity)
+
+def trace_dropped_count() -> int:
+    return get_lib().lrtc_trace_dropped_count()
+
+def trace_format_chrome_json(events: Any, count: int, buffer: Optional[bytes], buffer_len: int) -> int:
+    return get_lib().lrtc_trace_format_chrome_json(events, count, buffer, buffer_len)
+
+def trace_start(capacity: int) -> Any:
+    return get_lib().lrtc_trace_start(capacity)
+
+def trace_stop() -> None:
+    get_lib().lrtc_trace_stop()
+
 def video_sink_create(callbacks: Any, user_data: int) -> Optional[VideoSinkHandle]:
     return get_lib().lrtc_video_sink_create(callbacks, user_data)
 
+def video_sink_create_with_wants(callbacks: Any, wants: Any, user_data: int) -> Optional[VideoSinkHandle]:
+    return get_lib().lrtc_video_sink_create_with_wants(callbacks, wants, user_data)
+
@@ -81,6 +81,33 @@ const (
     DtlsTransportStateFailed DtlsTransportState = 4
 )
 
+type FactoryThreadMode int32
+
+const (
+    FactoryThreadModeDedicated FactoryThreadMode = 0
+    FactoryThreadModeShared FactoryThreadMode = 1
+    FactoryThreadModePooled FactoryThreadMode = 2
+)
+
+type FrameCryptionState int32
+
+const (
+    FrameCryptionStateNew FrameCryptionState = 0
+    FrameCryptionStateOk FrameCryptionState = 1
+    FrameCryptionStateEncryptionFailed FrameCryptionState = 2
+    FrameCryptionStateDecryptionFailed FrameCryptionState = 3
+    FrameCryptionStateMissingKey FrameCryptionState = 4
+    FrameCryptionStateKeyRatcheted FrameCryptionState = 5
+    FrameCryptionStateInternalError FrameCryptionState = 6
+)
+
+type FrameCryptoAlgorithm int32
+
+const (
+    FrameCryptoAlgorithmGcm FrameCryptoAlgorithm = 0
+    FrameCryptoAlgorithmCbc FrameCryptoAlgorithm = 1
+)
+
 type IceConnectionState int32
 
 const (
@@ -111,6 +138,15 @@ const (
     IceTransportsTypeAll IceTransportsType = 3
 )
 
+type LayerDecisionReason int32
+
+const (
+    LayerDecisionReasonBandwidth LayerDecisionReason = 0
+    LayerDecisionReasonLoss LayerDecisionReason = 1
+    LayerDecisionReasonRtt LayerDecisionReason = 2
+    LayerDecisionReasonCpu LayerDecisionReason = 3
+)
+
 type LogSeverity int32
 
 const (
@@ -148,6 +184,14 @@ const (
     PeerConnectionStateClosed PeerConnectionState = 5
 )
 
+type RecordingSyncPolicy int32
+
+const (
+    RecordingSyncPolicyNone RecordingSyncPolicy = 0
+    RecordingSyncPolicyOnStop RecordingSyncPolicy = 1
+    RecordingSyncPolicyInterval RecordingSyncPolicy = 2
+)
+
 type Result int32
 
 const (
@@ -199,6 +243,35 @@ const (
     TcpCandidatePolicyDisabled TcpCandidatePolicy = 1
 )
 
+type ThreadRole int32
+
+const (
+    ThreadRoleWorker ThreadRole = 0
+    ThreadRoleSignaling ThreadRole = 1
+    ThreadRoleNetwork ThreadRole = 2
+    ThreadRoleCapture ThreadRole = 3
+)
+
+type ThreadTuningFailure int32
+
+const (
+    ThreadTuningFailureAffinityFailed ThreadTuningFailure = 1
+    ThreadTuningFailureNiceFailed ThreadTuningFailure = 2
+    ThreadTuningFailureRealtimeFailed ThreadTuningFailure = 4
+)
+
+type TraceStage int32
+
+const (
+    TraceStageDesktopCapture TraceStage = 0
+    TraceStageDesktopConvert TraceStage = 1
+    TraceStageCaptureAdapt TraceStage = 2
+    TraceStageVideoSinkAdapter TraceStage = 3
+    TraceStageVideoSinkCallback TraceStage = 4
+    TraceStageAudioSinkAdapter TraceStage = 5
+    TraceStageAudioSinkCallback TraceStage = 6
+)
+
 type TrackState int32
 
 const (
@@ -206,6 +279,16 @@ const (
     TrackStateEnded TrackState = 1
 )
 
+type VideoPixelFormat int32
+
+const (
+    VideoPixelFormatNative VideoPixelFormat = 0
+    VideoPixelFormatI420 VideoPixelFormat = 1
+    VideoPixelFormatNv12 VideoPixelFormat = 2
+    VideoPixelFormatArgb VideoPixelFormat = 3
+    VideoPixelFormatBgra VideoPixelFormat = 4
+)
+
 // ── Opaque handles ────────────────────────────────────────────────────────────────────────
 
 // AudioDevice wraps lrtc_audio_device_t*.
@@ -428,6 +511,11 @@ func (h *DesktopCapturer) Close() {
     }
 }
 
+// GetThreadReport calls lrtc_desktop_capturer_get_thread_report.
+func (h *DesktopCapturer) GetThreadReport(out_report unsafe.Pointer) int32 {
+    return int32(C.lrtc_desktop_capturer_get_thread_report(h.ptr, out_report))
+}
+
 // IsRunning calls lrtc_desktop_capturer_is_running.
 func (h *DesktopCapturer) IsRunning() bool {
     return C.lrtc_desktop_capturer_is_running(h.ptr) != 0
@@ -438,16 +526,31 @@ func (h *DesktopCapturer) Start(fps uint32) int32 {
     return int32(C.lrtc_desktop_capturer_start(h.ptr, (C.uint)(fps)))
 }
 
+// StartAsync calls lrtc_desktop_capturer_start_async.
+func (h *DesktopCapturer) StartAsync(fps uint32, callback int32, user_data unsafe.Pointer) int32 {
+    return int32(C.lrtc_desktop_capturer_start_async(h.ptr, (C.uint)(fps), (C.int)(callback), user_data))
+}
+
 // StartRegion calls lrtc_desktop_capturer_start_region.
 func (h *DesktopCapturer) StartRegion(fps uint32, x uint32, y uint32, w uint32, h uint32) int32 {
     return int32(C.lrtc_desktop_capturer_start_region(h.ptr, (C.uint)(fps), (C.uint)(x), (C.uint)(y), (C.uint)(w), (C.uint)(h)))
 }
 
+// StartRegionAsync calls lrtc_desktop_capturer_start_region_async.
+func (h *DesktopCapturer) StartRegionAsync(fps uint32, x uint32, y uint32, w uint32, h uint32, callback int32, user_data unsafe.Pointer) int32 {
+    return int32(C.lrtc_desktop_capturer_start_region_async(h.ptr, (C.uint)(fps), (C.uint)(x), (C.uint)(y), (C.uint)(w), (C.uint)(h), (C.int)(callback), user_data))
+}
+
 // Stop calls lrtc_desktop_capturer_stop.
 func (h *DesktopCapturer) Stop() {
     C.lrtc_desktop_capturer_stop(h.ptr)
 }
 
+// StopAsync calls lrtc_desktop_capturer_stop_async.
+func (h *DesktopCapturer) StopAsync(callback int32, user_data unsafe.Pointer) int32 {
+    return int32(C.lrtc_desktop_capturer_stop_async(h.ptr, (C.int)(callback), user_data))
+}
+
 // DesktopDevice wraps lrtc_desktop_device_t*.
 type DesktopDevice struct {
     ptr *C.lrtc_desktop_device_t
@@ -565,6 +668,105 @@ func (h *DtmfSender) Tones(buffer string, buffer_len uint32) int32 {
     return int32(C.lrtc_dtmf_sender_tones(h.ptr, C.CString(buffer), (C.uint)(buffer_len)))
 }
 
+// EncodedFrameRecorder wraps lrtc_encoded_frame_recorder_t*.
+type EncodedFrameRecorder struct {
+    ptr *C.lrtc_encoded_frame_recorder_t
+}
+
+// NewEncodedFrameRecorder creates a new EncodedFrameRecorder.
+func NewEncodedFrameRecorder(path string, options unsafe.Pointer) *EncodedFrameRecorder {
+    h := &EncodedFrameRecorder{ptr: C.lrtc_encoded_frame_recorder_create(C.CString(path), options)}
+    runtime.SetFinalizer(h, (*EncodedFrameRecorder).Close)
+    return h
+}
+
+// Close releases the native resource.
+func (h *EncodedFrameRecorder) Close() {
+    if h.ptr != nil {
+        C.lrtc_encoded_frame_recorder_release(h.ptr)
+        h.ptr = nil
+    }
+}
+
+// GetStats calls lrtc_encoded_frame_recorder_get_stats.
+func (h *EncodedFrameRecorder) GetStats(out_stats unsafe.Pointer) int32 {
+    return int32(C.lrtc_encoded_frame_recorder_get_stats(h.ptr, out_stats))
+}
+
+// Stop calls lrtc_encoded_frame_recorder_stop.
+func (h *EncodedFrameRecorder) Stop() int32 {
+    return int32(C.lrtc_encoded_frame_recorder_stop(h.ptr))
+}
+
+// EncodedFrameSink wraps lrtc_encoded_frame_sink_t*.
+type EncodedFrameSink struct {
+    ptr *C.lrtc_encoded_frame_sink_t
+}
+
+// NewEncodedFrameSink creates a new EncodedFrameSink.
+func NewEncodedFrameSink(callback int32, user_data unsafe.Pointer) *EncodedFrameSink {
+    h := &EncodedFrameSink{ptr: C.lrtc_encoded_frame_sink_create((C.int)(callback), user_data)}
+    runtime.SetFinalizer(h, (*EncodedFrameSink).Close)
+    return h
+}
+
+// Close releases the native resource.
+func (h *EncodedFrameSink) Close() {
+    if h.ptr != nil {
+        C.lrtc_encoded_frame_sink_release(h.ptr)
+        h.ptr = nil
+    }
+}
+
+// EncodedFrame wraps lrtc_encoded_frame_t*.
+type EncodedFrame struct {
+    ptr *C.lrtc_encoded_frame_t
+}
+
+// NewEncodedFrame creates a new EncodedFrame.
+// Note: no create function found in IDL.
+func NewEncodedFrame() *EncodedFrame {
+    return &EncodedFrame{}
+}
+
+// Close releases the native resource.
+func (h *EncodedFrame) Close() {
+    if h.ptr != nil {
+        C.lrtc_encoded_frame_release(h.ptr)
+        h.ptr = nil
+    }
+}
+
+// Data calls lrtc_encoded_frame_data.
+func (h *EncodedFrame) Data() *uint8 {
+    return *uint8(C.lrtc_encoded_frame_data(h.ptr))
+}
+
+// GetDependencies calls lrtc_encoded_frame_get_dependencies.
+func (h *EncodedFrame) GetDependencies(out_frame_ids *int64, capacity uint32) uint32 {
+    return uint32(C.lrtc_encoded_frame_get_dependencies(h.ptr, (*C.longlong)(out_frame_ids), (C.uint)(capacity)))
+}
+
+// GetInfo calls lrtc_encoded_frame_get_info.
+func (h *EncodedFrame) GetInfo(out_info unsafe.Pointer) int32 {
+    return int32(C.lrtc_encoded_frame_get_info(h.ptr, out_info))
+}
+
+// GetMimeType calls lrtc_encoded_frame_get_mime_type.
+func (h *EncodedFrame) GetMimeType(buffer string, buffer_len uint32) int32 {
+    return int32(C.lrtc_encoded_frame_get_mime_type(h.ptr, C.CString(buffer), (C.uint)(buffer_len)))
+}
+
+// Retain calls lrtc_encoded_frame_retain.
+func (h *EncodedFrame) Retain() *EncodedFrame {
+    return *EncodedFrame(C.lrtc_encoded_frame_retain(h.ptr))
+}
+
+// Size calls lrtc_encoded_frame_size.
+func (h *EncodedFrame) Size() uint32 {
+    return uint32(C.lrtc_encoded_frame_size(h.ptr))
+}
+
 // Factory wraps lrtc_factory_t*.
 type Factory struct {
     ptr *C.lrtc_factory_t
@@ -585,21 +787,61 @@ func (h *Factory) Close() {
     }
 }
 
+// ConfigureCertificateCache calls lrtc_factory_configure_certificate_cache.
+func (h *Factory) ConfigureCertificateCache(options unsafe.Pointer) int32 {
+    return int32(C.lrtc_factory_configure_certificate_cache(h.ptr, options))
+}
+
+// ConfigurePeerConnectionPool calls lrtc_factory_configure_peer_connection_pool.
+func (h *Factory) ConfigurePeerConnectionPool(config unsafe.Pointer, constraints *MediaConstraints, size int32) int32 {
+    return int32(C.lrtc_factory_configure_peer_connection_pool(h.ptr, config, (*C.lrtc_media_constraints_t)(constraints), (C.int)(size)))
+}
+
+// ConfigureUdpMux calls lrtc_factory_configure_udp_mux.
+func (h *Factory) ConfigureUdpMux(options unsafe.Pointer) int32 {
+    return int32(C.lrtc_factory_configure_udp_mux(h.ptr, options))
+}
+
 // CreateAudioSource calls lrtc_factory_create_audio_source.
 func (h *Factory) CreateAudioSource(label string, source_type int32, options unsafe.Pointer) *AudioSource {
     return *AudioSource(C.lrtc_factory_create_audio_source(h.ptr, C.CString(label), (C.int)(source_type), options))
 }
 
+// CreateAudioSourceAsync calls lrtc_factory_create_audio_source_async.
+func (h *Factory) CreateAudioSourceAsync(label string, source_type int32, options unsafe.Pointer, callback int32, user_data unsafe.Pointer) int32 {
+    return int32(C.lrtc_factory_create_audio_source_async(h.ptr, C.CString(label), (C.int)(source_type), options, (C.int)(callback), user_data))
+}
+
 // CreateAudioTrack calls lrtc_factory_create_audio_track.
 func (h *Factory) CreateAudioTrack(source *AudioSource, track_id string) *AudioTrack {
     return *AudioTrack(C.lrtc_factory_create_audio_track(h.ptr, (*C.lrtc_audio_source_t)(source), C.CString(track_id)))
 }
 
+// CreateAudioTrackAsync calls lrtc_factory_create_audio_track_async.
+func (h *Factory) CreateAudioTrackAsync(source *AudioSource, track_id string, callback int32, user_data unsafe.Pointer) int32 {
+    return int32(C.lrtc_factory_create_audio_track_async(h.ptr, (*C.lrtc_audio_source_t)(source), C.CString(track_id), (C.int)(callback), user_data))
+}
+
+// CreateCustomVideoSource calls lrtc_factory_create_custom_video_source.
+func (h *Factory) CreateCustomVideoSource(label string, is_screencast bool) *VideoSource {
+    return *VideoSource(C.lrtc_factory_create_custom_video_source(h.ptr, C.CString(label), (C.bool)(is_screencast)))
+}
+
 // CreateDesktopSource calls lrtc_factory_create_desktop_source.
 func (h *Factory) CreateDesktopSource(capturer *DesktopCapturer, label string, constraints *MediaConstraints) *VideoSource {
     return *VideoSource(C.lrtc_factory_create_desktop_source(h.ptr, (*C.lrtc_desktop_capturer_t)(capturer), C.CString(label), (*C.lrtc_media_constraints_t)(constraints)))
 }
 
+// CreateDesktopSourceAsync calls lrtc_factory_create_desktop_source_async.
+func (h *Factory) CreateDesktopSourceAsync(capturer *DesktopCapturer, label string, constraints *MediaConstraints, callback int32, user_data unsafe.Pointer) int32 {
+    return int32(C.lrtc_factory_create_desktop_source_async(h.ptr, (*C.lrtc_desktop_capturer_t)(capturer), C.CString(label), (*C.lrtc_media_constraints_t)(constraints), (C.int)(callback), user_data))
+}
+
+// CreateEncodedVideoSource calls lrtc_factory_create_encoded_video_source.
+func (h *Factory) CreateEncodedVideoSource(label string, codec string) *VideoSource {
+    return *VideoSource(C.lrtc_factory_create_encoded_video_source(h.ptr, C.CString(label), C.CString(codec)))
+}
+
 // CreateStream calls lrtc_factory_create_stream.
 func (h *Factory) CreateStream(stream_id string) *MediaStream {
     return *MediaStream(C.lrtc_factory_create_stream(h.ptr, C.CString(stream_id)))
@@ -610,11 +852,26 @@ func (h *Factory) CreateVideoSource(capturer *VideoCapturer, label string, const
     return *VideoSource(C.lrtc_factory_create_video_source(h.ptr, (*C.lrtc_video_capturer_t)(capturer), C.CString(label), (*C.lrtc_media_constraints_t)(constraints)))
 }
 
+// CreateVideoSourceAsync calls lrtc_factory_create_video_source_async.
+func (h *Factory) CreateVideoSourceAsync(capturer *VideoCapturer, label string, constraints *MediaConstraints, callback int32, user_data unsafe.Pointer) int32 {
+    return int32(C.lrtc_factory_create_video_source_async(h.ptr, (*C.lrtc_video_capturer_t)(capturer), C.CString(label), (*C.lrtc_media_constraints_t)(constraints), (C.int)(callback), user_data))
+}
+
 // CreateVideoTrack calls lrtc_factory_create_video_track.
 func (h *Factory) CreateVideoTrack(source *VideoSource, track_id string) *VideoTrack {
     return *VideoTrack(C.lrtc_factory_create_video_track(h.ptr, (*C.lrtc_video_source_t)(source), C.CString(track_id)))
 }
 
+// CreateVideoTrackAsync calls lrtc_factory_create_video_track_async.
+func (h *Factory) CreateVideoTrackAsync(source *VideoSource, track_id string, callback int32, user_data unsafe.Pointer) int32 {
+    return int32(C.lrtc_factory_create_video_track_async(h.ptr, (*C.lrtc_video_source_t)(source), C.CString(track_id), (C.int)(callback), user_data))
+}
+
+// ExportCertificatePem calls lrtc_factory_export_certificate_pem.
+func (h *Factory) ExportCertificatePem(buffer string, buffer_len uint32) int32 {
+    return int32(C.lrtc_factory_export_certificate_pem(h.ptr, C.CString(buffer), (C.uint)(buffer_len)))
+}
+
 // GetAudioDevice calls lrtc_factory_get_audio_device.
 func (h *Factory) GetAudioDevice() *AudioDevice {
     return *AudioDevice(C.lrtc_factory_get_audio_device(h.ptr))
@@ -625,6 +882,11 @@ func (h *Factory) GetDesktopDevice() *DesktopDevice {
     return *DesktopDevice(C.lrtc_factory_get_desktop_device(h.ptr))
 }
 
+// GetPeerConnectionPoolStats calls lrtc_factory_get_peer_connection_pool_stats.
+func (h *Factory) GetPeerConnectionPoolStats(out_stats unsafe.Pointer) int32 {
+    return int32(C.lrtc_factory_get_peer_connection_pool_stats(h.ptr, out_stats))
+}
+
 // GetRtpReceiverCapabilities calls lrtc_factory_get_rtp_receiver_capabilities.
 func (h *Factory) GetRtpReceiverCapabilities(media_type int32, success int32, failure int32, user_data unsafe.Pointer) {
     C.lrtc_factory_get_rtp_receiver_capabilities(h.ptr, (C.int)(media_type), (C.int)(success), (C.int)(failure), user_data)
@@ -640,16 +902,36 @@ func (h *Factory) GetRtpSenderCodecMimeTypes(media_type int32, success int32, fa
     C.lrtc_factory_get_rtp_sender_codec_mime_types(h.ptr, (C.int)(media_type), (C.int)(success), (C.int)(failure), user_data)
 }
 
+// GetThreadReport calls lrtc_factory_get_thread_report.
+func (h *Factory) GetThreadReport(role int32, index uint32, out_report unsafe.Pointer) int32 {
+    return int32(C.lrtc_factory_get_thread_report(h.ptr, (C.int)(role), (C.uint)(index), out_report))
+}
+
+// GetUdpMuxStats calls lrtc_factory_get_udp_mux_stats.
+func (h *Factory) GetUdpMuxStats(out_stats unsafe.Pointer) int32 {
+    return int32(C.lrtc_factory_get_udp_mux_stats(h.ptr, out_stats))
+}
+
 // GetVideoDevice calls lrtc_factory_get_video_device.
 func (h *Factory) GetVideoDevice() *VideoDevice {
     return *VideoDevice(C.lrtc_factory_get_video_device(h.ptr))
 }
 
+// ImportCertificatePem calls lrtc_factory_import_certificate_pem.
+func (h *Factory) ImportCertificatePem(pem string) int32 {
+    return int32(C.lrtc_factory_import_certificate_pem(h.ptr, C.CString(pem)))
+}
+
 // Initialize calls lrtc_factory_initialize.
 func (h *Factory) Initialize() int32 {
     return int32(C.lrtc_factory_initialize(h.ptr))
 }
 
+// SetVirtualNetworkConditions calls lrtc_factory_set_virtual_network_conditions.
+func (h *Factory) SetVirtualNetworkConditions(options unsafe.Pointer) int32 {
+    return int32(C.lrtc_factory_set_virtual_network_conditions(h.ptr, options))
+}
+
 // Terminate calls lrtc_factory_terminate.
 func (h *Factory) Terminate() {
     C.lrtc_factory_terminate(h.ptr)
@@ -660,6 +942,154 @@ func (h *Factory) LrtcPeerConnectionCreate(config unsafe.Pointer, constraints *M
     return *PeerConnection(C.lrtc_peer_connection_create(h.ptr, config, (*C.lrtc_media_constraints_t)(constraints), callbacks, user_data))
 }
 
+// LrtcPeerConnectionCreateKeyed calls lrtc_peer_connection_create_keyed.
+func (h *Factory) LrtcPeerConnectionCreateKeyed(network_key string, config unsafe.Pointer, constraints *MediaConstraints, callbacks unsafe.Pointer, user_data unsafe.Pointer) *PeerConnection {
+    return *PeerConnection(C.lrtc_peer_connection_create_keyed(h.ptr, C.CString(network_key), config, (*C.lrtc_media_constraints_t)(constraints), callbacks, user_data))
+}
+
+// LrtcPeerConnectionCreatePooled calls lrtc_peer_connection_create_pooled.
+func (h *Factory) LrtcPeerConnectionCreatePooled(callbacks unsafe.Pointer, user_data unsafe.Pointer) *PeerConnection {
+    return *PeerConnection(C.lrtc_peer_connection_create_pooled(h.ptr, callbacks, user_data))
+}
+
+// FrameCryptor wraps lrtc_frame_cryptor_t*.
+type FrameCryptor struct {
+    ptr *C.lrtc_frame_cryptor_t
+}
+
+// NewFrameCryptor creates a new FrameCryptor.
+// Note: no create function found in IDL.
+func NewFrameCryptor() *FrameCryptor {
+    return &FrameCryptor{}
+}
+
+// Close releases the native resource.
+func (h *FrameCryptor) Close() {
+    if h.ptr != nil {
+        C.lrtc_frame_cryptor_release(h.ptr)
+        h.ptr = nil
+    }
+}
+
+// GetEnabled calls lrtc_frame_cryptor_get_enabled.
+func (h *FrameCryptor) GetEnabled() bool {
+    return C.lrtc_frame_cryptor_get_enabled(h.ptr) != 0
+}
+
+// GetKeyIndex calls lrtc_frame_cryptor_get_key_index.
+func (h *FrameCryptor) GetKeyIndex() int32 {
+    return int32(C.lrtc_frame_cryptor_get_key_index(h.ptr))
+}
+
+// SetEnabled calls lrtc_frame_cryptor_set_enabled.
+func (h *FrameCryptor) SetEnabled(enabled bool) int32 {
+    return int32(C.lrtc_frame_cryptor_set_enabled(h.ptr, (C.bool)(enabled)))
+}
+
+// SetKeyIndex calls lrtc_frame_cryptor_set_key_index.
+func (h *FrameCryptor) SetKeyIndex(index int32) int32 {
+    return int32(C.lrtc_frame_cryptor_set_key_index(h.ptr, (C.int)(index)))
+}
+
+// SetObserver calls lrtc_frame_cryptor_set_observer.
+func (h *FrameCryptor) SetObserver(callback int32, user_data unsafe.Pointer) {
+    C.lrtc_frame_cryptor_set_observer(h.ptr, (C.int)(callback), user_data)
+}
+
+// KeyProvider wraps lrtc_key_provider_t*.
+type KeyProvider struct {
+    ptr *C.lrtc_key_provider_t
+}
+
+// NewKeyProvider creates a new KeyProvider.
+func NewKeyProvider(options unsafe.Pointer) *KeyProvider {
+    h := &KeyProvider{ptr: C.lrtc_key_provider_create(options)}
+    runtime.SetFinalizer(h, (*KeyProvider).Close)
+    return h
+}
+
+// Close releases the native resource.
+func (h *KeyProvider) Close() {
+    if h.ptr != nil {
+        C.lrtc_key_provider_release(h.ptr)
+        h.ptr = nil
+    }
+}
+
+// Decrypt calls lrtc_key_provider_decrypt.
+func (h *KeyProvider) Decrypt(participant_id string, data *uint8, size uint32) int32 {
+    return int32(C.lrtc_key_provider_decrypt(h.ptr, C.CString(participant_id), (*C.uchar)(data), (C.uint)(size)))
+}
+
+// Encrypt calls lrtc_key_provider_encrypt.
+func (h *KeyProvider) Encrypt(participant_id string, key_index int32, data *uint8, size uint32, capacity uint32) int32 {
+    return int32(C.lrtc_key_provider_encrypt(h.ptr, C.CString(participant_id), (C.int)(key_index), (*C.uchar)(data), (C.uint)(size), (C.uint)(capacity)))
+}
+
+// ExportKey calls lrtc_key_provider_export_key.
+func (h *KeyProvider) ExportKey(participant_id string, key_index int32, buffer *uint8, buffer_len uint32) int32 {
+    return int32(C.lrtc_key_provider_export_key(h.ptr, C.CString(participant_id), (C.int)(key_index), (*C.uchar)(buffer), (C.uint)(buffer_len)))
+}
+
+// ExportSharedKey calls lrtc_key_provider_export_shared_key.
+func (h *KeyProvider) ExportSharedKey(key_index int32, buffer *uint8, buffer_len uint32) int32 {
+    return int32(C.lrtc_key_provider_export_shared_key(h.ptr, (C.int)(key_index), (*C.uchar)(buffer), (C.uint)(buffer_len)))
+}
+
+// RatchetKey calls lrtc_key_provider_ratchet_key.
+func (h *KeyProvider) RatchetKey(participant_id string, key_index int32) int32 {
+    return int32(C.lrtc_key_provider_ratchet_key(h.ptr, C.CString(participant_id), (C.int)(key_index)))
+}
+
+// RatchetSharedKey calls lrtc_key_provider_ratchet_shared_key.
+func (h *KeyProvider) RatchetSharedKey(key_index int32) int32 {
+    return int32(C.lrtc_key_provider_ratchet_shared_key(h.ptr, (C.int)(key_index)))
+}
+
+// SetKey calls lrtc_key_provider_set_key.
+func (h *KeyProvider) SetKey(participant_id string, key_index int32, key *uint8, key_len uint32) int32 {
+    return int32(C.lrtc_key_provider_set_key(h.ptr, C.CString(participant_id), (C.int)(key_index), (*C.uchar)(key), (C.uint)(key_len)))
+}
+
+// SetSharedKey calls lrtc_key_provider_set_shared_key.
+func (h *KeyProvider) SetSharedKey(key_index int32, key *uint8, key_len uint32) int32 {
+    return int32(C.lrtc_key_provider_set_shared_key(h.ptr, (C.int)(key_index), (*C.uchar)(key), (C.uint)(key_len)))
+}
+
+// SetSifTrailer calls lrtc_key_provider_set_sif_trailer.
+func (h *KeyProvider) SetSifTrailer(trailer *uint8, trailer_len uint32) {
+    C.lrtc_key_provider_set_sif_trailer(h.ptr, (*C.uchar)(trailer), (C.uint)(trailer_len))
+}
+
+// LayerController wraps lrtc_layer_controller_t*.
+type LayerController struct {
+    ptr *C.lrtc_layer_controller_t
+}
+
+// NewLayerController creates a new LayerController.
+// Note: no create function found in IDL.
+func NewLayerController() *LayerController {
+    return &LayerController{}
+}
+
+// Close releases the native resource.
+func (h *LayerController) Close() {
+    if h.ptr != nil {
+        C.lrtc_layer_controller_release(h.ptr)
+        h.ptr = nil
+    }
+}
+
+// GetLevel calls lrtc_layer_controller_get_level.
+func (h *LayerController) GetLevel() int32 {
+    return int32(C.lrtc_layer_controller_get_level(h.ptr))
+}
+
+// GetMaxLevel calls lrtc_layer_controller_get_max_level.
+func (h *LayerController) GetMaxLevel() int32 {
+    return int32(C.lrtc_layer_controller_get_max_level(h.ptr))
+}
+
 // MediaConstraints wraps lrtc_media_constraints_t*.
 type MediaConstraints struct {
     ptr *C.lrtc_media_constraints_t
@@ -812,6 +1242,11 @@ func (h *PeerConnection) AddIceCandidateEx(sdp_mid string, sdp_mline_index int32
     return int32(C.lrtc_peer_connection_add_ice_candidate_ex(h.ptr, C.CString(sdp_mid), (C.int)(sdp_mline_index), C.CString(candidate)))
 }
 
+// AddIceCandidates calls lrtc_peer_connection_add_ice_candidates.
+func (h *PeerConnection) AddIceCandidates(sdp_mids string, sdp_mline_indexes *int32, candidates string, count uint32, out_applied *int32) int32 {
+    return int32(C.lrtc_peer_connection_add_ice_candidates(h.ptr, C.CString(sdp_mids), (*C.int)(sdp_mline_indexes), C.CString(candidates), (C.uint)(count), (*C.int)(out_applied)))
+}
+
 // AddStream calls lrtc_peer_connection_add_stream.
 func (h *PeerConnection) AddStream(stream *MediaStream) bool {
     return C.lrtc_peer_connection_add_stream(h.ptr, (*C.lrtc_media_stream_t)(stream)) != 0
@@ -852,6 +1287,31 @@ func (h *PeerConnection) Close() {
     C.lrtc_peer_connection_close(h.ptr)
 }
 
+// ConnectLoopback calls lrtc_peer_connection_connect_loopback.
+func (h *PeerConnection) ConnectLoopback(answerer *PeerConnection, success int32, failure int32, user_data unsafe.Pointer) {
+    C.lrtc_peer_connection_connect_loopback(h.ptr, (*C.lrtc_peer_connection_t)(answerer), (C.int)(success), (C.int)(failure), user_data)
+}
+
+// CopyLocalDescription calls lrtc_peer_connection_copy_local_description.
+func (h *PeerConnection) CopyLocalDescription(buffer string, buffer_len uint32) int32 {
+    return int32(C.lrtc_peer_connection_copy_local_description(h.ptr, C.CString(buffer), (C.uint)(buffer_len)))
+}
+
+// CopyLocalDescriptionType calls lrtc_peer_connection_copy_local_description_type.
+func (h *PeerConnection) CopyLocalDescriptionType(buffer string, buffer_len uint32) int32 {
+    return int32(C.lrtc_peer_connection_copy_local_description_type(h.ptr, C.CString(buffer), (C.uint)(buffer_len)))
+}
+
+// CopyRemoteDescription calls lrtc_peer_connection_copy_remote_description.
+func (h *PeerConnection) CopyRemoteDescription(buffer string, buffer_len uint32) int32 {
+    return int32(C.lrtc_peer_connection_copy_remote_description(h.ptr, C.CString(buffer), (C.uint)(buffer_len)))
+}
+
+// CopyRemoteDescriptionType calls lrtc_peer_connection_copy_remote_description_type.
+func (h *PeerConnection) CopyRemoteDescriptionType(buffer string, buffer_len uint32) int32 {
+    return int32(C.lrtc_peer_connection_copy_remote_description_type(h.ptr, C.CString(buffer), (C.uint)(buffer_len)))
+}
+
 // CreateAnswer calls lrtc_peer_connection_create_answer.
 func (h *PeerConnection) CreateAnswer(success int32, failure int32, user_data unsafe.Pointer, constraints *MediaConstraints) {
     C.lrtc_peer_connection_create_answer(h.ptr, (C.int)(success), (C.int)(failure), user_data, (*C.lrtc_media_constraints_t)(constraints))
@@ -862,11 +1322,21 @@ func (h *PeerConnection) CreateDataChannel(label string, ordered int32, reliable
     return *DataChannel(C.lrtc_peer_connection_create_data_channel(h.ptr, C.CString(label), (C.int)(ordered), (C.int)(reliable), (C.int)(max_retransmit_time), (C.int)(max_retransmits), C.CString(protocol), (C.int)(negotiated), (C.int)(id)))
 }
 
+// CreateLayerController calls lrtc_peer_connection_create_layer_controller.
+func (h *PeerConnection) CreateLayerController(sender *RtpSender, options unsafe.Pointer, callback int32, user_data unsafe.Pointer) *LayerController {
+    return *LayerController(C.lrtc_peer_connection_create_layer_controller(h.ptr, (*C.lrtc_rtp_sender_t)(sender), options, (C.int)(callback), user_data))
+}
+
 // CreateOffer calls lrtc_peer_connection_create_offer.
 func (h *PeerConnection) CreateOffer(success int32, failure int32, user_data unsafe.Pointer, constraints *MediaConstraints) {
     C.lrtc_peer_connection_create_offer(h.ptr, (C.int)(success), (C.int)(failure), user_data, (*C.lrtc_media_constraints_t)(constraints))
 }
 
+// CreateTemplatedOffer calls lrtc_peer_connection_create_templated_offer.
+func (h *PeerConnection) CreateTemplatedOffer(session_template *SessionTemplate, success int32, failure int32, user_data unsafe.Pointer, constraints *MediaConstraints) {
+    C.lrtc_peer_connection_create_templated_offer(h.ptr, (*C.lrtc_session_template_t)(session_template), (C.int)(success), (C.int)(failure), user_data, (*C.lrtc_media_constraints_t)(constraints))
+}
+
 // GetLocalDescription calls lrtc_peer_connection_get_local_description.
 func (h *PeerConnection) GetLocalDescription(success int32, failure int32, user_data unsafe.Pointer) {
     C.lrtc_peer_connection_get_local_description(h.ptr, (C.int)(success), (C.int)(failure), user_data)
@@ -882,6 +1352,11 @@ func (h *PeerConnection) GetReceiverStats(receiver *RtpReceiver, success int32,
     C.lrtc_peer_connection_get_receiver_stats(h.ptr, (*C.lrtc_rtp_receiver_t)(receiver), (C.int)(success), (C.int)(failure), user_data)
 }
 
+// GetReceivers calls lrtc_peer_connection_get_receivers.
+func (h *PeerConnection) GetReceivers(out_receivers *RtpReceiver, capacity uint32) uint32 {
+    return uint32(C.lrtc_peer_connection_get_receivers(h.ptr, (*C.lrtc_rtp_receiver_t)(out_receivers), (C.uint)(capacity)))
+}
+
 // GetRemoteDescription calls lrtc_peer_connection_get_remote_description.
 func (h *PeerConnection) GetRemoteDescription(success int32, failure int32, user_data unsafe.Pointer) {
     C.lrtc_peer_connection_get_remote_description(h.ptr, (C.int)(success), (C.int)(failure), user_data)
@@ -897,6 +1372,11 @@ func (h *PeerConnection) GetSenderStats(sender *RtpSender, success int32, failur
     C.lrtc_peer_connection_get_sender_stats(h.ptr, (*C.lrtc_rtp_sender_t)(sender), (C.int)(success), (C.int)(failure), user_data)
 }
 
+// GetSenders calls lrtc_peer_connection_get_senders.
+func (h *PeerConnection) GetSenders(out_senders *RtpSender, capacity uint32) uint32 {
+    return uint32(C.lrtc_peer_connection_get_senders(h.ptr, (*C.lrtc_rtp_sender_t)(out_senders), (C.uint)(capacity)))
+}
+
 // GetStats calls lrtc_peer_connection_get_stats.
 func (h *PeerConnection) GetStats(success int32, failure int32, user_data unsafe.Pointer) {
     C.lrtc_peer_connection_get_stats(h.ptr, (C.int)(success), (C.int)(failure), user_data)
@@ -907,6 +1387,11 @@ func (h *PeerConnection) GetTransceiver(index uint32) *RtpTransceiver {
     return *RtpTransceiver(C.lrtc_peer_connection_get_transceiver(h.ptr, (C.uint)(index)))
 }
 
+// GetTransceivers calls lrtc_peer_connection_get_transceivers.
+func (h *PeerConnection) GetTransceivers(out_transceivers *RtpTransceiver, capacity uint32) uint32 {
+    return uint32(C.lrtc_peer_connection_get_transceivers(h.ptr, (*C.lrtc_rtp_transceiver_t)(out_transceivers), (C.uint)(capacity)))
+}
+
 // ReceiverCount calls lrtc_peer_connection_receiver_count.
 func (h *PeerConnection) ReceiverCount() uint32 {
     return uint32(C.lrtc_peer_connection_receiver_count(h.ptr))
@@ -932,6 +1417,11 @@ func (h *PeerConnection) SenderCount() uint32 {
     return uint32(C.lrtc_peer_connection_sender_count(h.ptr))
 }
 
+// SetBandwidthObserver calls lrtc_peer_connection_set_bandwidth_observer.
+func (h *PeerConnection) SetBandwidthObserver(interval_ms uint32, callback int32, user_data unsafe.Pointer) {
+    C.lrtc_peer_connection_set_bandwidth_observer(h.ptr, (C.uint)(interval_ms), (C.int)(callback), user_data)
+}
+
 // SetCallbacks calls lrtc_peer_connection_set_callbacks.
 func (h *PeerConnection) SetCallbacks(callbacks unsafe.Pointer, user_data unsafe.Pointer) {
     C.lrtc_peer_connection_set_callbacks(h.ptr, callbacks, user_data)
@@ -942,6 +1432,11 @@ func (h *PeerConnection) SetCodecPreferences(media_type int32, mime_types string
     return int32(C.lrtc_peer_connection_set_codec_preferences(h.ptr, (C.int)(media_type), C.CString(mime_types), (C.uint)(mime_type_count)))
 }
 
+// SetIceCandidateBatching calls lrtc_peer_connection_set_ice_candidate_batching.
+func (h *PeerConnection) SetIceCandidateBatching(window_ms uint32, callback int32, user_data unsafe.Pointer) {
+    C.lrtc_peer_connection_set_ice_candidate_batching(h.ptr, (C.uint)(window_ms), (C.int)(callback), user_data)
+}
+
 // SetLocalDescription calls lrtc_peer_connection_set_local_description.
 func (h *PeerConnection) SetLocalDescription(sdp string, type string, success int32, failure int32, user_data unsafe.Pointer) {
     C.lrtc_peer_connection_set_local_description(h.ptr, C.CString(sdp), C.CString(type), (C.int)(success), (C.int)(failure), user_data)
@@ -991,6 +1486,11 @@ func (h *RtpReceiver) GetAudioTrack() *AudioTrack {
     return *AudioTrack(C.lrtc_rtp_receiver_get_audio_track(h.ptr))
 }
 
+// GetDecodeStats calls lrtc_rtp_receiver_get_decode_stats.
+func (h *RtpReceiver) GetDecodeStats(out_stats unsafe.Pointer) int32 {
+    return int32(C.lrtc_rtp_receiver_get_decode_stats(h.ptr, out_stats))
+}
+
 // GetDegradationPreference calls lrtc_rtp_receiver_get_degradation_preference.
 func (h *RtpReceiver) GetDegradationPreference() int32 {
     return int32(C.lrtc_rtp_receiver_get_degradation_preference(h.ptr))
@@ -1046,6 +1546,26 @@ func (h *RtpReceiver) GetVideoTrack() *VideoTrack {
     return *VideoTrack(C.lrtc_rtp_receiver_get_video_track(h.ptr))
 }
 
+// RequestKeyFrame calls lrtc_rtp_receiver_request_key_frame.
+func (h *RtpReceiver) RequestKeyFrame() int32 {
+    return int32(C.lrtc_rtp_receiver_request_key_frame(h.ptr))
+}
+
+// SetDecodeOnDemand calls lrtc_rtp_receiver_set_decode_on_demand.
+func (h *RtpReceiver) SetDecodeOnDemand(enabled bool) int32 {
+    return int32(C.lrtc_rtp_receiver_set_decode_on_demand(h.ptr, (C.bool)(enabled)))
+}
+
+// SetEncodedFrameRecorder calls lrtc_rtp_receiver_set_encoded_frame_recorder.
+func (h *RtpReceiver) SetEncodedFrameRecorder(recorder *EncodedFrameRecorder) int32 {
+    return int32(C.lrtc_rtp_receiver_set_encoded_frame_recorder(h.ptr, (*C.lrtc_encoded_frame_recorder_t)(recorder)))
+}
+
+// SetEncodedFrameSink calls lrtc_rtp_receiver_set_encoded_frame_sink.
+func (h *RtpReceiver) SetEncodedFrameSink(sink *EncodedFrameSink) int32 {
+    return int32(C.lrtc_rtp_receiver_set_encoded_frame_sink(h.ptr, (*C.lrtc_encoded_frame_sink_t)(sink)))
+}
+
 // SetJitterBufferMinDelay calls lrtc_rtp_receiver_set_jitter_buffer_min_delay.
 func (h *RtpReceiver) SetJitterBufferMinDelay(delay_seconds float64) int32 {
     return int32(C.lrtc_rtp_receiver_set_jitter_buffer_min_delay(h.ptr, (C.double)(delay_seconds)))
@@ -1061,6 +1581,11 @@ func (h *RtpReceiver) StreamIdCount() uint32 {
     return uint32(C.lrtc_rtp_receiver_stream_id_count(h.ptr))
 }
 
+// LrtcFrameCryptorCreateForReceiver calls lrtc_frame_cryptor_create_for_receiver.
+func (h *RtpReceiver) LrtcFrameCryptorCreateForReceiver(participant_id string, algorithm int32, key_provider *KeyProvider) *FrameCryptor {
+    return *FrameCryptor(C.lrtc_frame_cryptor_create_for_receiver(h.ptr, C.CString(participant_id), (C.int)(algorithm), (*C.lrtc_key_provider_t)(key_provider)))
+}
+
 // RtpSender wraps lrtc_rtp_sender_t*.
 type RtpSender struct {
     ptr *C.lrtc_rtp_sender_t
@@ -1160,6 +1685,21 @@ func (h *RtpSender) ReplaceVideoTrack(track *VideoTrack) int32 {
     return int32(C.lrtc_rtp_sender_replace_video_track(h.ptr, (*C.lrtc_video_track_t)(track)))
 }
 
+// SendEncodedAudio calls lrtc_rtp_sender_send_encoded_audio.
+func (h *RtpSender) SendEncodedAudio(mime_type string, data *uint8, size uint32, rtp_timestamp uint32) int32 {
+    return int32(C.lrtc_rtp_sender_send_encoded_audio(h.ptr, C.CString(mime_type), (*C.uchar)(data), (C.uint)(size), (C.uint)(rtp_timestamp)))
+}
+
+// SendEncodedFrame calls lrtc_rtp_sender_send_encoded_frame.
+func (h *RtpSender) SendEncodedFrame(frame *EncodedFrame) int32 {
+    return int32(C.lrtc_rtp_sender_send_encoded_frame(h.ptr, (*C.lrtc_encoded_frame_t)(frame)))
+}
+
+// SetEncodedFrameInput calls lrtc_rtp_sender_set_encoded_frame_input.
+func (h *RtpSender) SetEncodedFrameInput(enabled bool) int32 {
+    return int32(C.lrtc_rtp_sender_set_encoded_frame_input(h.ptr, (C.bool)(enabled)))
+}
+
 // SetEncodingParameters calls lrtc_rtp_sender_set_encoding_parameters.
 func (h *RtpSender) SetEncodingParameters(settings unsafe.Pointer) int32 {
     return int32(C.lrtc_rtp_sender_set_encoding_parameters(h.ptr, settings))
@@ -1170,6 +1710,11 @@ func (h *RtpSender) SetEncodingParametersAt(index uint32, settings unsafe.Pointe
     return int32(C.lrtc_rtp_sender_set_encoding_parameters_at(h.ptr, (C.uint)(index), settings))
 }
 
+// SetEncodings calls lrtc_rtp_sender_set_encodings.
+func (h *RtpSender) SetEncodings(settings unsafe.Pointer, count uint32, degradation_preference int32) int32 {
+    return int32(C.lrtc_rtp_sender_set_encodings(h.ptr, settings, (C.uint)(count), (C.int)(degradation_preference)))
+}
+
 // SetStreamIds calls lrtc_rtp_sender_set_stream_ids.
 func (h *RtpSender) SetStreamIds(stream_ids string, stream_id_count uint32) int32 {
     return int32(C.lrtc_rtp_sender_set_stream_ids(h.ptr, C.CString(stream_ids), (C.uint)(stream_id_count)))
@@ -1180,6 +1725,11 @@ func (h *RtpSender) StreamIdCount() uint32 {
     return uint32(C.lrtc_rtp_sender_stream_id_count(h.ptr))
 }
 
+// LrtcFrameCryptorCreateForSender calls lrtc_frame_cryptor_create_for_sender.
+func (h *RtpSender) LrtcFrameCryptorCreateForSender(participant_id string, algorithm int32, key_provider *KeyProvider) *FrameCryptor {
+    return *FrameCryptor(C.lrtc_frame_cryptor_create_for_sender(h.ptr, C.CString(participant_id), (C.int)(algorithm), (*C.lrtc_key_provider_t)(key_provider)))
+}
+
 // RtpTransceiver wraps lrtc_rtp_transceiver_t*.
 type RtpTransceiver struct {
     ptr *C.lrtc_rtp_transceiver_t
@@ -1259,6 +1809,36 @@ func (h *RtpTransceiver) Stop(error string, error_len uint32) int32 {
     return int32(C.lrtc_rtp_transceiver_stop(h.ptr, C.CString(error), (C.uint)(error_len)))
 }
 
+// SessionTemplate wraps lrtc_session_template_t*.
+type SessionTemplate struct {
+    ptr *C.lrtc_session_template_t
+}
+
+// NewSessionTemplate creates a new SessionTemplate.
+func NewSessionTemplate() *SessionTemplate {
+    h := &SessionTemplate{ptr: C.lrtc_session_template_create()}
+    runtime.SetFinalizer(h, (*SessionTemplate).Close)
+    return h
+}
+
+// Close releases the native resource.
+func (h *SessionTemplate) Close() {
+    if h.ptr != nil {
+        C.lrtc_session_template_release(h.ptr)
+        h.ptr = nil
+    }
+}
+
+// GetStats calls lrtc_session_template_get_stats.
+func (h *SessionTemplate) GetStats(out_stats unsafe.Pointer) int32 {
+    return int32(C.lrtc_session_template_get_stats(h.ptr, out_stats))
+}
+
+// Reset calls lrtc_session_template_reset.
+func (h *SessionTemplate) Reset() {
+    C.lrtc_session_template_reset(h.ptr)
+}
+
 // VideoCapturer wraps lrtc_video_capturer_t*.
 type VideoCapturer struct {
     ptr *C.lrtc_video_capturer_t
@@ -1288,11 +1868,21 @@ func (h *VideoCapturer) Start() bool {
     return C.lrtc_video_capturer_start(h.ptr) != 0
 }
 
+// StartAsync calls lrtc_video_capturer_start_async.
+func (h *VideoCapturer) StartAsync(callback int32, user_data unsafe.Pointer) int32 {
+    return int32(C.lrtc_video_capturer_start_async(h.ptr, (C.int)(callback), user_data))
+}
+
 // Stop calls lrtc_video_capturer_stop.
 func (h *VideoCapturer) Stop() {
     C.lrtc_video_capturer_stop(h.ptr)
 }
 
+// StopAsync calls lrtc_video_capturer_stop_async.
+func (h *VideoCapturer) StopAsync(callback int32, user_data unsafe.Pointer) int32 {
+    return int32(C.lrtc_video_capturer_stop_async(h.ptr, (C.int)(callback), user_data))
+}
+
 // VideoDevice wraps lrtc_video_device_t*.
 type VideoDevice struct {
     ptr *C.lrtc_video_device_t
@@ -1317,6 +1907,11 @@ func (h *VideoDevice) CreateCapturer(name string, index uint32, width uintptr, h
     return *VideoCapturer(C.lrtc_video_device_create_capturer(h.ptr, C.CString(name), (C.uint)(index), (C.size_t)(width), (C.size_t)(height), (C.size_t)(target_fps)))
 }
 
+// CreateCapturerAsync calls lrtc_video_device_create_capturer_async.
+func (h *VideoDevice) CreateCapturerAsync(name string, index uint32, width uintptr, height uintptr, target_fps uintptr, callback int32, user_data unsafe.Pointer) int32 {
+    return int32(C.lrtc_video_device_create_capturer_async(h.ptr, C.CString(name), (C.uint)(index), (C.size_t)(width), (C.size_t)(height), (C.size_t)(target_fps), (C.int)(callback), user_data))
+}
+
 // GetDeviceName calls lrtc_video_device_get_device_name.
 func (h *VideoDevice) GetDeviceName(index uint32, name string, name_length uint32, unique_id string, unique_id_length uint32) int32 {
     return int32(C.lrtc_video_device_get_device_name(h.ptr, (C.uint)(index), C.CString(name), (C.uint)(name_length), C.CString(unique_id), (C.uint)(unique_id_length)))
@@ -1366,6 +1961,11 @@ func (h *VideoFrame) DataY() *uint8 {
     return *uint8(C.lrtc_video_frame_data_y(h.ptr))
 }
 
+// Format calls lrtc_video_frame_format.
+func (h *VideoFrame) Format() int32 {
+    return int32(C.lrtc_video_frame_format(h.ptr))
+}
+
 // Height calls lrtc_video_frame_height.
 func (h *VideoFrame) Height() int32 {
     return int32(C.lrtc_video_frame_height(h.ptr))
@@ -1440,6 +2040,36 @@ func (h *VideoSource) Close() {
     }
 }
 
+// DroppedCount calls lrtc_video_source_dropped_count.
+func (h *VideoSource) DroppedCount() uint64 {
+    return uint64(C.lrtc_video_source_dropped_count(h.ptr))
+}
+
+// PushArgb calls lrtc_video_source_push_argb.
+func (h *VideoSource) PushArgb(data *uint8, stride int32, width int32, height int32, format int32, timestamp_us int64, release int32, user_data unsafe.Pointer) int32 {
+    return int32(C.lrtc_video_source_push_argb(h.ptr, (*C.uchar)(data), (C.int)(stride), (C.int)(width), (C.int)(height), (C.int)(format), (C.longlong)(timestamp_us), (C.int)(release), user_data))
+}
+
+// PushEncoded calls lrtc_video_source_push_encoded.
+func (h *VideoSource) PushEncoded(data *uint8, size uint32, width int32, height int32, key_frame bool, timestamp_us int64) int32 {
+    return int32(C.lrtc_video_source_push_encoded(h.ptr, (*C.uchar)(data), (C.uint)(size), (C.int)(width), (C.int)(height), (C.bool)(key_frame), (C.longlong)(timestamp_us)))
+}
+
+// PushI420 calls lrtc_video_source_push_i420.
+func (h *VideoSource) PushI420(data_y *uint8, stride_y int32, data_u *uint8, stride_u int32, data_v *uint8, stride_v int32, width int32, height int32, timestamp_us int64, release int32, user_data unsafe.Pointer) int32 {
+    return int32(C.lrtc_video_source_push_i420(h.ptr, (*C.uchar)(data_y), (C.int)(stride_y), (*C.uchar)(data_u), (C.int)(stride_u), (*C.uchar)(data_v), (C.int)(stride_v), (C.int)(width), (C.int)(height), (C.longlong)(timestamp_us), (C.int)(release), user_data))
+}
+
+// PushNv12 calls lrtc_video_source_push_nv12.
+func (h *VideoSource) PushNv12(data_y *uint8, stride_y int32, data_uv *uint8, stride_uv int32, width int32, height int32, timestamp_us int64, release int32, user_data unsafe.Pointer) int32 {
+    return int32(C.lrtc_video_source_push_nv12(h.ptr, (*C.uchar)(data_y), (C.int)(stride_y), (*C.uchar)(data_uv), (C.int)(stride_uv), (C.int)(width), (C.int)(height), (C.longlong)(timestamp_us), (C.int)(release), user_data))
+}
+
+// SetKeyFrameRequestCallback calls lrtc_video_source_set_key_frame_request_callback.
+func (h *VideoSource) SetKeyFrameRequestCallback(callback int32, user_data unsafe.Pointer) int32 {
+    return int32(C.lrtc_video_source_set_key_frame_request_callback(h.ptr, (C.int)(callback), user_data))
+}
+
 // VideoTrack wraps lrtc_video_track_t*.
 type VideoTrack struct {
     ptr *C.lrtc_video_track_t
@@ -1511,6 +2141,11 @@ func AbiVersionString(buffer string, buffer_len uint32) int32 {
     return int32(C.lrtc_abi_version_string(C.CString(buffer), (C.uint)(buffer_len)))
 }
 
+// FactoryCreateWithOptions calls lrtc_factory_create_with_options.
+func FactoryCreateWithOptions(options unsafe.Pointer, share_with *Factory) *Factory {
+    return *Factory(C.lrtc_factory_create_with_options(options, (*C.lrtc_factory_t)(share_with)))
+}
+
 // Initialize calls lrtc_initialize.
 func Initialize() int32 {
     return int32(C.lrtc_initialize())
@@ -1551,3 +2186,33 @@ func Terminate() {
     C.lrtc_terminate()
 }
 
+// TraceDrain calls lrtc_trace_drain.
+func TraceDrain(events unsafe.Pointer, capacity uint32) uint32 {
+    return uint32(C.lrtc_trace_drain(events, (C.uint)(capacity)))
+}
+
+// TraceDroppedCount calls lrtc_trace_dropped_count.
+func TraceDroppedCount() uint64 {
+    return uint64(C.lrtc_trace_dropped_count())
+}
+
+// TraceFormatChromeJson calls lrtc_trace_format_chrome_json.
+func TraceFormatChromeJson(events unsafe.Pointer, count uint32, buffer string, buffer_len uint32) int32 {
+    return int32(C.lrtc_trace_format_chrome_json(events, (C.uint)(count), C.CString(buffer), (C.uint)(buffer_len)))
+}
+
+// TraceStart calls lrtc_trace_start.
+func TraceStart(capacity uint32) int32 {
+    return int32(C.lrtc_trace_start((C.uint)(capacity)))
+}
+
+// TraceStop calls lrtc_trace_stop.
+func TraceStop() {
+    C.lrtc_trace_stop()
+}
+
+// VideoSinkCreateWithWants calls lrtc_video_sink_create_with_wants.
+func VideoSinkCreateWithWants(callbacks unsafe.Pointer, wants unsafe.Pointer, user_data unsafe.Pointer) *VideoSink {
+    return *VideoSink(C.lrtc_video_sink_create_with_wants(callbacks, wants, user_data))
+}
+
@@ -84,6 +84,33 @@ pub enum DtlsTransportState {
     Failed = 4,
 }
 
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum FactoryThreadMode {
+    Dedicated = 0,
+    Shared = 1,
+    Pooled = 2,
+}
+
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum FrameCryptionState {
+    New = 0,
+    Ok = 1,
+    EncryptionFailed = 2,
+    DecryptionFailed = 3,
+    MissingKey = 4,
+    KeyRatcheted = 5,
+    InternalError = 6,
+}
+
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum FrameCryptoAlgorithm {
+    Gcm = 0,
+    Cbc = 1,
+}
+
 #[repr(C)]
 #[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
 pub enum IceConnectionState {
@@ -114,6 +141,15 @@ pub enum IceTransportsType {
     All = 3,
 }
 
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum LayerDecisionReason {
+    Bandwidth = 0,
+    Loss = 1,
+    Rtt = 2,
+    Cpu = 3,
+}
+
 #[repr(C)]
 #[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
 pub enum LogSeverity {
@@ -151,6 +187,14 @@ pub enum PeerConnectionState {
     Closed = 5,
 }
 
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum RecordingSyncPolicy {
+    None = 0,
+    OnStop = 1,
+    Interval = 2,
+}
+
 #[repr(C)]
 #[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
 pub enum Result {
@@ -202,6 +246,35 @@ pub enum TcpCandidatePolicy {
     Disabled = 1,
 }
 
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum ThreadRole {
+    Worker = 0,
+    Signaling = 1,
+    Network = 2,
+    Capture = 3,
+}
+
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum ThreadTuningFailure {
+    AffinityFailed = 1,
+    NiceFailed = 2,
+    RealtimeFailed = 4,
+}
+
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum TraceStage {
+    DesktopCapture = 0,
+    DesktopConvert = 1,
+    CaptureAdapt = 2,
+    VideoSinkAdapter = 3,
+    VideoSinkCallback = 4,
+    AudioSinkAdapter = 5,
+    AudioSinkCallback = 6,
+}
+
 #[repr(C)]
 #[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
 pub enum TrackState {
@@ -209,6 +282,16 @@ pub enum TrackState {
     Ended = 1,
 }
 
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum VideoPixelFormat {
+    Native = 0,
+    I420 = 1,
+    Nv12 = 2,
+    Argb = 3,
+    Bgra = 4,
+}
+
 // ---------------------------------------------------------------------------
 // Opaque handle types
 // ---------------------------------------------------------------------------
@@ -249,10 +332,34 @@ pub type DesktopMediaListPtr = *mut LrtcDesktopMediaList;
 pub struct LrtcDtmfSender { _opaque: [u8; 0] }
 pub type DtmfSenderPtr = *mut LrtcDtmfSender;
 
+#[repr(C)]
+pub struct LrtcEncodedFrameRecorder { _opaque: [u8; 0] }
+pub type EncodedFrameRecorderPtr = *mut LrtcEncodedFrameRecorder;
+
+#[repr(C)]
+pub struct LrtcEncodedFrameSink { _opaque: [u8; 0] }
+pub type EncodedFrameSinkPtr = *mut LrtcEncodedFrameSink;
+
+#[repr(C)]
+pub struct LrtcEncodedFrame { _opaque: [u8; 0] }
+pub type EncodedFramePtr = *mut LrtcEncodedFrame;
+
 #[repr(C)]
 pub struct LrtcFactory { _opaque: [u8; 0] }
 pub type FactoryPtr = *mut LrtcFactory;
 
+#[repr(C)]
+pub struct LrtcFrameCryptor { _opaque: [u8; 0] }
+pub type FrameCryptorPtr = *mut LrtcFrameCryptor;
+
+#[repr(C)]
+pub struct LrtcKeyProvider { _opaque: [u8; 0] }
+pub type KeyProviderPtr = *mut LrtcKeyProvider;
+
+#[repr(C)]
+pub struct LrtcLayerController { _opaque: [u8; 0] }
+pub type LayerControllerPtr = *mut LrtcLayerController;
+
 #[repr(C)]
 pub struct LrtcMediaConstraints { _opaque: [u8; 0] }
 pub type MediaConstraintsPtr = *mut LrtcMediaConstraints;
@@ -281,6 +388,10 @@ pub type RtpSenderPtr = *mut LrtcRtpSender;
 pub struct LrtcRtpTransceiver { _opaque: [u8; 0] }
 pub type RtpTransceiverPtr = *mut LrtcRtpTransceiver;
 
+#[repr(C)]
+pub struct LrtcSessionTemplate { _opaque: [u8; 0] }
+pub type SessionTemplatePtr = *mut LrtcSessionTemplate;
+
 #[repr(C)]
 pub struct LrtcVideoCapturer { _opaque: [u8; 0] }
 pub type VideoCapturerPtr = *mut LrtcVideoCapturer;
@@ -314,15 +425,27 @@ pub type SdpErrorCb = Option<unsafe extern "C" fn(user_data: *mut c_void, error:
 pub type VoidCb = Option<unsafe extern "C" fn(user_data: *mut c_void)>;
 pub type PeerConnectionStateCb = Option<unsafe extern "C" fn(user_data: *mut c_void, state: c_int)>;
 pub type IceCandidateCb = Option<unsafe extern "C" fn(user_data: *mut c_void, sdp_mid: *const c_char, sdp_mline_index: c_int, candidate: *const c_char)>;
+pub type IceCandidatesCb = Option<unsafe extern "C" fn(user_data: *mut c_void, sdp_mids: *const c_char, sdp_mline_indexes: *const c_int, candidates: *const c_char, count: u32)>;
+pub type BandwidthEstimateCb = Option<unsafe extern "C" fn(user_data: *mut c_void, target_bitrate_bps: c_int, stable_target_bitrate_bps: c_int, encoder_target_bitrate_bps: c_int, encoder_count: c_int, rtt_ms: c_double, loss_rate: c_double)>;
+pub type LayerDecisionCb = Option<unsafe extern "C" fn(user_data: *mut c_void, reason: c_int, previous_level: c_int, level: c_int, target_bitrate_bps: c_int, loss_rate: c_double, rtt_ms: c_double)>;
 pub type DataChannelStateCb = Option<unsafe extern "C" fn(user_data: *mut c_void, state: c_int)>;
 pub type DataChannelMessageCb = Option<unsafe extern "C" fn(user_data: *mut c_void, data: *const u8, length: c_int, binary: c_int)>;
 pub type AudioFrameCb = Option<unsafe extern "C" fn(user_data: *mut c_void, audio_data: *const c_void, bits_per_sample: c_int, sample_rate: c_int, number_of_channels: size_t, number_of_frames: size_t)>;
 pub type VideoFrameCb = Option<unsafe extern "C" fn(user_data: *mut c_void, frame: VideoFramePtr)>;
+pub type EncodedFrameCb = Option<unsafe extern "C" fn(user_data: *mut c_void, frame: EncodedFramePtr)>;
 pub type TrackCb = Option<unsafe extern "C" fn(user_data: *mut c_void, transceiver: RtpTransceiverPtr, receiver: RtpReceiverPtr)>;
 pub type StatsSuccessCb = Option<unsafe extern "C" fn(user_data: *mut c_void, json: *const c_char)>;
 pub type StatsFailureCb = Option<unsafe extern "C" fn(user_data: *mut c_void, error: *const c_char)>;
 pub type LogMessageCb = Option<unsafe extern "C" fn(user_data: *mut c_void, message: *const c_char)>;
 pub type DtmfToneCb = Option<unsafe extern "C" fn(user_data: *mut c_void, tone: *const c_char, tone_buffer: *const c_char)>;
+pub type AudioSourceCreatedCb = Option<unsafe extern "C" fn(user_data: *mut c_void, source: AudioSourcePtr)>;
+pub type AudioTrackCreatedCb = Option<unsafe extern "C" fn(user_data: *mut c_void, track: AudioTrackPtr)>;
+pub type VideoSourceCreatedCb = Option<unsafe extern "C" fn(user_data: *mut c_void, source: VideoSourcePtr)>;
+pub type VideoTrackCreatedCb = Option<unsafe extern "C" fn(user_data: *mut c_void, track: VideoTrackPtr)>;
+pub type VideoCapturerCreatedCb = Option<unsafe extern "C" fn(user_data: *mut c_void, capturer: VideoCapturerPtr)>;
+pub type VideoCaptureStartedCb = Option<unsafe extern "C" fn(user_data: *mut c_void, started: c_int)>;
+pub type DesktopCaptureStateCb = Option<unsafe extern "C" fn(user_data: *mut c_void, state: c_int)>;
+pub type FrameCryptionStateCb = Option<unsafe extern "C" fn(user_data: *mut c_void, participant_id: *const c_char, state: c_int)>;
 
 // ---------------------------------------------------------------------------
 // Structs
@@ -341,12 +464,28 @@ pub struct LrtcAudioSinkCallbacks {
     pub on_data: *mut c_void,
 }
 
+#[repr(C)]
+pub struct LrtcCertificateCacheOptions {
+    pub enabled: c_bool,
+    pub size: c_int,
+    pub rotation_interval_ms: i64,
+}
+
 #[repr(C)]
 pub struct LrtcDataChannelCallbacks {
     pub on_state_change: *mut c_void,
     pub on_message: *mut c_void,
 }
 
+#[repr(C)]
+pub struct LrtcDecodeOnDemandStats {
+    pub frames_decoded: u64,
+    pub frames_skipped: u64,
+    pub key_frame_requests: u64,
+    pub enabled: c_bool,
+    pub skipping: c_bool,
+}
+
 #[repr(C)]
 pub struct LrtcDtlsTransportInfo {
     pub state: c_int,
@@ -359,6 +498,52 @@ pub struct LrtcDtmfSenderCallbacks {
     pub on_tone_change: *mut c_void,
 }
 
+#[repr(C)]
+pub struct LrtcEncodedFrameInfo {
+    pub media_type: c_int,
+    pub rtp_timestamp: u32,
+    pub ssrc: u32,
+    pub payload_type: c_int,
+    pub is_key_frame: c_bool,
+    pub width: c_int,
+    pub height: c_int,
+    pub frame_id: i64,
+    pub spatial_index: c_int,
+    pub temporal_index: c_int,
+    pub dependency_count: u32,
+}
+
+#[repr(C)]
+pub struct LrtcEncodedFrameRecorderOptions {
+    pub max_queued_bytes: u32,
+    pub write_buffer_bytes: u32,
+    pub sync_policy: *mut c_void,
+    pub sync_interval_ms: u32,
+}
+
+#[repr(C)]
+pub struct LrtcEncodedFrameRecorderStats {
+    pub frames_written: u64,
+    pub bytes_written: u64,
+    pub frames_dropped: u64,
+    pub queued_bytes: u64,
+    pub write_failed: c_bool,
+}
+
+#[repr(C)]
+pub struct LrtcFactoryOptions {
+    pub thread_mode: *mut c_void,
+    pub thread_pool_size: c_int,
+    pub network_thread_count: c_int,
+    pub pin_network_threads: c_bool,
+    pub network_first_cpu: c_int,
+    pub worker_thread: LrtcThreadConfig,
+    pub signaling_thread: LrtcThreadConfig,
+    pub network_thread: LrtcThreadConfig,
+    pub capture_thread: LrtcThreadConfig,
+    pub virtual_network: LrtcVirtualNetworkOptions,
+}
+
 #[repr(C)]
 pub struct LrtcIceServer {
     pub uri: *const c_char,
@@ -366,6 +551,31 @@ pub struct LrtcIceServer {
     pub password: *const c_char,
 }
 
+#[repr(C)]
+pub struct LrtcKeyProviderOptions {
+    pub shared_key: c_bool,
+    pub ratchet_salt: *const u8,
+    pub ratchet_salt_len: u32,
+    pub uncrypted_magic_bytes: *const u8,
+    pub uncrypted_magic_bytes_len: u32,
+    pub ratchet_window_size: c_int,
+    pub failure_tolerance: c_int,
+    pub key_ring_size: c_int,
+    pub discard_frame_when_cryptor_not_ready: c_bool,
+}
+
+#[repr(C)]
+pub struct LrtcLayerControllerOptions {
+    pub interval_ms: u32,
+    pub up_headroom: c_double,
+    pub down_headroom: c_double,
+    pub up_hold_ms: u32,
+    pub down_hold_ms: u32,
+    pub max_loss_rate: c_double,
+    pub max_rtt_increase_ms: u32,
+    pub ignore_cpu: c_bool,
+}
+
 #[repr(C)]
 pub struct LrtcPeerConnectionCallbacks {
     pub on_signaling_state: *mut c_void,
@@ -381,6 +591,16 @@ pub struct LrtcPeerConnectionCallbacks {
     pub on_renegotiation_needed: *mut Void(*onRenegotiationNeeded)(void,
 }
 
+#[repr(C)]
+pub struct LrtcPeerConnectionPoolStats {
+    pub hits: u64,
+    pub misses: u64,
+    pub created: u64,
+    pub discarded: u64,
+    pub available: u32,
+    pub target_size: u32,
+}
+
 #[repr(C)]
 pub struct LrtcRtcConfig {
     pub ice_servers: *mut c_void,
@@ -445,11 +665,81 @@ pub struct LrtcRtpTransceiverInit {
     pub send_encoding_count: u32,
 }
 
+#[repr(C)]
+pub struct LrtcSessionTemplateStats {
+    pub hits: u64,
+    pub misses: u64,
+    pub template_size: u32,
+}
+
+#[repr(C)]
+pub struct LrtcThreadConfig {
+    pub cpu_mask: u64,
+    pub set_nice: c_bool,
+    pub nice: c_int,
+    pub realtime: c_bool,
+    pub realtime_priority: c_int,
+}
+
+#[repr(C)]
+pub struct LrtcThreadReport {
+    pub applied: c_bool,
+    pub cpu_mask: u64,
+    pub nice: c_int,
+    pub realtime: c_bool,
+    pub priority: c_int,
+    pub failures: c_int,
+}
+
+#[repr(C)]
+pub struct LrtcTraceEvent {
+    pub start_us: i64,
+    pub duration_us: i64,
+    pub frame_timestamp_us: i64,
+    pub source_id: u64,
+    pub thread_id: u32,
+    pub stage: *mut c_void,
+}
+
+#[repr(C)]
+pub struct LrtcUdpMuxOptions {
+    pub enabled: c_bool,
+    pub port: c_int,
+}
+
+#[repr(C)]
+pub struct LrtcUdpMuxStats {
+    pub address_hits: u64,
+    pub ufrag_hits: u64,
+    pub misses: u64,
+    pub endpoints: u32,
+    pub ports: u32,
+}
+
 #[repr(C)]
 pub struct LrtcVideoSinkCallbacks {
     pub on_frame: *mut c_void,
 }
 
+#[repr(C)]
+pub struct LrtcVideoSinkWants {
+    pub max_pixel_count: u32,
+    pub max_framerate: u32,
+    pub resolution_alignment: u32,
+    pub format: *mut c_void,
+    pub width: u32,
+    pub height: u32,
+}
+
+#[repr(C)]
+pub struct LrtcVirtualNetworkOptions {
+    pub enabled: c_bool,
+    pub latency_ms: c_int,
+    pub jitter_ms: c_int,
+    pub loss_rate: c_double,
+    pub bandwidth_bps: i64,
+}
+
 // ---------------------------------------------------------------------------
 // FFI extern block
 // ---------------------------------------------------------------------------
@@ -487,11 +777,15 @@ extern "C" {
     pub fn lrtc_data_channel_release(channel: DataChannelPtr);
     pub fn lrtc_data_channel_send(channel: DataChannelPtr, data: *const u8, size: u32, binary: c_int);
     pub fn lrtc_data_channel_set_callbacks(channel: DataChannelPtr, callbacks: *const LrtcDataChannelCallbacks, user_data: *mut c_void);
+    pub fn lrtc_desktop_capturer_get_thread_report(capturer: DesktopCapturerPtr, out_report: *mut LrtcThreadReport) -> *mut c_void;
     pub fn lrtc_desktop_capturer_is_running(capturer: DesktopCapturerPtr) -> c_bool;
     pub fn lrtc_desktop_capturer_release(capturer: DesktopCapturerPtr);
     pub fn lrtc_desktop_capturer_start(capturer: DesktopCapturerPtr, fps: u32) -> *mut c_void;
+    pub fn lrtc_desktop_capturer_start_async(capturer: DesktopCapturerPtr, fps: u32, callback: *mut c_void, user_data: *mut c_void) -> *mut c_void;
     pub fn lrtc_desktop_capturer_start_region(capturer: DesktopCapturerPtr, fps: u32, x: u32, y: u32, w: u32, h: u32) -> *mut c_void;
+    pub fn lrtc_desktop_capturer_start_region_async(capturer: DesktopCapturerPtr, fps: u32, x: u32, y: u32, w: u32, h: u32, callback: *mut c_void, user_data: *mut c_void) -> *mut c_void;
     pub fn lrtc_desktop_capturer_stop(capturer: DesktopCapturerPtr);
+    pub fn lrtc_desktop_capturer_stop_async(capturer: DesktopCapturerPtr, callback: *mut c_void, user_data: *mut c_void) -> *mut c_void;
     pub fn lrtc_desktop_device_create_capturer(device: DesktopDevicePtr, source: MediaSourcePtr, show_cursor: c_bool) -> DesktopCapturerPtr;
     pub fn lrtc_desktop_device_get_media_list(device: DesktopDevicePtr, type: *mut c_void) -> DesktopMediaListPtr;
     pub fn lrtc_desktop_device_release(device: DesktopDevicePtr);
@@ -507,23 +801,75 @@ extern "C" {
     pub fn lrtc_dtmf_sender_release(sender: DtmfSenderPtr);
     pub fn lrtc_dtmf_sender_set_callbacks(sender: DtmfSenderPtr, callbacks: *const LrtcDtmfSenderCallbacks, user_data: *mut c_void);
     pub fn lrtc_dtmf_sender_tones(sender: DtmfSenderPtr, buffer: *const c_char, buffer_len: u32) -> i32;
+    pub fn lrtc_encoded_frame_data(frame: EncodedFramePtr) -> *const u8;
+    pub fn lrtc_encoded_frame_get_dependencies(frame: EncodedFramePtr, out_frame_ids: *mut i64, capacity: u32) -> u32;
+    pub fn lrtc_encoded_frame_get_info(frame: EncodedFramePtr, out_info: *mut LrtcEncodedFrameInfo) -> *mut c_void;
+    pub fn lrtc_encoded_frame_get_mime_type(frame: EncodedFramePtr, buffer: *const c_char, buffer_len: u32) -> i32;
+    pub fn lrtc_encoded_frame_recorder_create(path: *const c_char, options: *const LrtcEncodedFrameRecorderOptions) -> EncodedFrameRecorderPtr;
+    pub fn lrtc_encoded_frame_recorder_get_stats(recorder: EncodedFrameRecorderPtr, out_stats: *mut LrtcEncodedFrameRecorderStats) -> *mut c_void;
+    pub fn lrtc_encoded_frame_recorder_release(recorder: EncodedFrameRecorderPtr);
+    pub fn lrtc_encoded_frame_recorder_stop(recorder: EncodedFrameRecorderPtr) -> *mut c_void;
+    pub fn lrtc_encoded_frame_release(frame: EncodedFramePtr);
+    pub fn lrtc_encoded_frame_retain(frame: EncodedFramePtr) -> EncodedFramePtr;
+    pub fn lrtc_encoded_frame_sink_create(callback: *mut c_void, user_data: *mut c_void) -> EncodedFrameSinkPtr;
+    pub fn lrtc_encoded_frame_sink_release(sink: EncodedFrameSinkPtr);
+    pub fn lrtc_encoded_frame_size(frame: EncodedFramePtr) -> u32;
+    pub fn lrtc_factory_configure_certificate_cache(factory: FactoryPtr, options: *const LrtcCertificateCacheOptions) -> *mut c_void;
+    pub fn lrtc_factory_configure_peer_connection_pool(factory: FactoryPtr, config: *const LrtcRtcConfig, constraints: MediaConstraintsPtr, size: c_int) -> *mut c_void;
+    pub fn lrtc_factory_configure_udp_mux(factory: FactoryPtr, options: *const LrtcUdpMuxOptions) -> *mut c_void;
     pub fn lrtc_factory_create() -> FactoryPtr;
     pub fn lrtc_factory_create_audio_source(factory: FactoryPtr, label: *const c_char, source_type: *mut c_void, options: *const LrtcAudioOptions) -> AudioSourcePtr;
+    pub fn lrtc_factory_create_audio_source_async(factory: FactoryPtr, label: *const c_char, source_type: *mut c_void, options: *const LrtcAudioOptions, callback: *mut c_void, user_data: *mut c_void) -> *mut c_void;
     pub fn lrtc_factory_create_audio_track(factory: FactoryPtr, source: AudioSourcePtr, track_id: *const c_char) -> AudioTrackPtr;
+    pub fn lrtc_factory_create_audio_track_async(factory: FactoryPtr, source: AudioSourcePtr, track_id: *const c_char, callback: *mut c_void, user_data: *mut c_void) -> *mut c_void;
+    pub fn lrtc_factory_create_custom_video_source(factory: FactoryPtr, label: *const c_char, is_screencast: c_bool) -> VideoSourcePtr;
     pub fn lrtc_factory_create_desktop_source(factory: FactoryPtr, capturer: DesktopCapturerPtr, label: *const c_char, constraints: MediaConstraintsPtr) -> VideoSourcePtr;
+    pub fn lrtc_factory_create_desktop_source_async(factory: FactoryPtr, capturer: DesktopCapturerPtr, label: *const c_char, constraints: MediaConstraintsPtr, callback: *mut c_void, user_data: *mut c_void) -> *mut c_void;
+    pub fn lrtc_factory_create_encoded_video_source(factory: FactoryPtr, label: *const c_char, codec: *const c_char) -> VideoSourcePtr;
     pub fn lrtc_factory_create_stream(factory: FactoryPtr, stream_id: *const c_char) -> MediaStreamPtr;
     pub fn lrtc_factory_create_video_source(factory: FactoryPtr, capturer: VideoCapturerPtr, label: *const c_char, constraints: MediaConstraintsPtr) -> VideoSourcePtr;
+    pub fn lrtc_factory_create_video_source_async(factory: FactoryPtr, capturer: VideoCapturerPtr, label: *const c_char, constraints: MediaConstraintsPtr, callback: *mut c_void, user_data: *mut c_void) -> *mut c_void;
     pub fn lrtc_factory_create_video_track(factory: FactoryPtr, source: VideoSourcePtr, track_id: *const c_char) -> VideoTrackPtr;
+    pub fn lrtc_factory_create_video_track_async(factory: FactoryPtr, source: VideoSourcePtr, track_id: *const c_char, callback: *mut c_void, user_data: *mut c_void) -> *mut c_void;
+    pub fn lrtc_factory_create_with_options(options: *const LrtcFactoryOptions, share_with: FactoryPtr) -> FactoryPtr;
+    pub fn lrtc_factory_export_certificate_pem(factory: FactoryPtr, buffer: *const c_char, buffer_len: u32) -> i32;
     pub fn lrtc_factory_get_audio_device(factory: FactoryPtr) -> AudioDevicePtr;
     pub fn lrtc_factory_get_desktop_device(factory: FactoryPtr) -> DesktopDevicePtr;
+    pub fn lrtc_factory_get_peer_connection_pool_stats(factory: FactoryPtr, out_stats: *mut LrtcPeerConnectionPoolStats) -> *mut c_void;
     pub fn lrtc_factory_get_rtp_receiver_capabilities(factory: FactoryPtr, media_type: *mut c_void, success: *mut c_void, failure: *mut c_void, user_data: *mut c_void);
     pub fn lrtc_factory_get_rtp_sender_capabilities(factory: FactoryPtr, media_type: *mut c_void, success: *mut c_void, failure: *mut c_void, user_data: *mut c_void);
     pub fn lrtc_factory_get_rtp_sender_codec_mime_types(factory: FactoryPtr, media_type: *mut c_void, success: *mut c_void, failure: *mut c_void, user_data: *mut c_void);
+    pub fn lrtc_factory_get_thread_report(factory: FactoryPtr, role: *mut c_void, index: u32, out_report: *mut LrtcThreadReport) -> *mut c_void;
+    pub fn lrtc_factory_get_udp_mux_stats(factory: FactoryPtr, out_stats: *mut LrtcUdpMuxStats) -> *mut c_void;
     pub fn lrtc_factory_get_video_device(factory: FactoryPtr) -> VideoDevicePtr;
+    pub fn lrtc_factory_import_certificate_pem(factory: FactoryPtr, pem: *const c_char) -> *mut c_void;
     pub fn lrtc_factory_initialize(factory: FactoryPtr) -> *mut c_void;
     pub fn lrtc_factory_release(factory: FactoryPtr);
+    pub fn lrtc_factory_set_virtual_network_conditions(factory: FactoryPtr, options: *const LrtcVirtualNetworkOptions) -> *mut c_void;
     pub fn lrtc_factory_terminate(factory: FactoryPtr);
+    pub fn lrtc_frame_cryptor_create_for_receiver(receiver: RtpReceiverPtr, participant_id: *const c_char, algorithm: c_int, key_provider: KeyProviderPtr) -> FrameCryptorPtr;
+    pub fn lrtc_frame_cryptor_create_for_sender(sender: RtpSenderPtr, participant_id: *const c_char, algorithm: c_int, key_provider: KeyProviderPtr) -> FrameCryptorPtr;
+    pub fn lrtc_frame_cryptor_get_enabled(cryptor: FrameCryptorPtr) -> c_bool;
+    pub fn lrtc_frame_cryptor_get_key_index(cryptor: FrameCryptorPtr) -> c_int;
+    pub fn lrtc_frame_cryptor_release(cryptor: FrameCryptorPtr);
+    pub fn lrtc_frame_cryptor_set_enabled(cryptor: FrameCryptorPtr, enabled: c_bool) -> *mut c_void;
+    pub fn lrtc_frame_cryptor_set_key_index(cryptor: FrameCryptorPtr, index: c_int) -> *mut c_void;
+    pub fn lrtc_frame_cryptor_set_observer(cryptor: FrameCryptorPtr, callback: *mut c_void, user_data: *mut c_void);
     pub fn lrtc_initialize() -> *mut c_void;
+    pub fn lrtc_key_provider_create(options: *const LrtcKeyProviderOptions) -> KeyProviderPtr;
+    pub fn lrtc_key_provider_decrypt(provider: KeyProviderPtr, participant_id: *const c_char, data: *mut u8, size: u32) -> i32;
+    pub fn lrtc_key_provider_encrypt(provider: KeyProviderPtr, participant_id: *const c_char, key_index: c_int, data: *mut u8, size: u32, capacity: u32) -> i32;
+    pub fn lrtc_key_provider_export_key(provider: KeyProviderPtr, participant_id: *const c_char, key_index: c_int, buffer: *mut u8, buffer_len: u32) -> i32;
+    pub fn lrtc_key_provider_export_shared_key(provider: KeyProviderPtr, key_index: c_int, buffer: *mut u8, buffer_len: u32) -> i32;
+    pub fn lrtc_key_provider_ratchet_key(provider: KeyProviderPtr, participant_id: *const c_char, key_index: c_int) -> *mut c_void;
+    pub fn lrtc_key_provider_ratchet_shared_key(provider: KeyProviderPtr, key_index: c_int) -> *mut c_void;
+    pub fn lrtc_key_provider_release(provider: KeyProviderPtr);
+    pub fn lrtc_key_provider_set_key(provider: KeyProviderPtr, participant_id: *const c_char, key_index: c_int, key: *const u8, key_len: u32) -> *mut c_void;
+    pub fn lrtc_key_provider_set_shared_key(provider: KeyProviderPtr, key_index: c_int, key: *const u8, key_len: u32) -> *mut c_void;
+    pub fn lrtc_key_provider_set_sif_trailer(provider: KeyProviderPtr, trailer: *const u8, trailer_len: u32);
+    pub fn lrtc_layer_controller_get_level(controller: LayerControllerPtr) -> c_int;
+    pub fn lrtc_layer_controller_get_max_level(controller: LayerControllerPtr) -> c_int;
+    pub fn lrtc_layer_controller_release(controller: LayerControllerPtr);
     pub fn lrtc_logging_remove_callback();
     pub fn lrtc_logging_set_callback(severity: c_int, callback: *mut c_void, user_data: *mut c_void);
     pub fn lrtc_logging_set_min_level(severity: c_int);
@@ -548,6 +894,7 @@ extern "C" {
     pub fn lrtc_peer_connection_add_audio_track_transceiver_with_init(pc: PeerConnectionPtr, track: AudioTrackPtr, init: *const LrtcRtpTransceiverInit) -> RtpTransceiverPtr;
     pub fn lrtc_peer_connection_add_ice_candidate(pc: PeerConnectionPtr, sdp_mid: *const c_char, sdp_mline_index: c_int, candidate: *const c_char);
     pub fn lrtc_peer_connection_add_ice_candidate_ex(pc: PeerConnectionPtr, sdp_mid: *const c_char, sdp_mline_index: c_int, candidate: *const c_char) -> c_int;
+    pub fn lrtc_peer_connection_add_ice_candidates(pc: PeerConnectionPtr, sdp_mids: *const c_char, sdp_mline_indexes: *const c_int, candidates: *const c_char, count: u32, out_applied: *mut c_int) -> c_int;
     pub fn lrtc_peer_connection_add_stream(pc: PeerConnectionPtr, stream: MediaStreamPtr) -> c_bool;
     pub fn lrtc_peer_connection_add_transceiver(pc: PeerConnectionPtr, media_type: *mut c_void) -> RtpTransceiverPtr;
     pub fn lrtc_peer_connection_add_transceiver_with_init(pc: PeerConnectionPtr, media_type: *mut c_void, init: *const LrtcRtpTransceiverInit) -> RtpTransceiverPtr;
@@ -556,32 +903,47 @@ extern "C" {
     pub fn lrtc_peer_connection_add_video_track_transceiver(pc: PeerConnectionPtr, track: VideoTrackPtr) -> RtpTransceiverPtr;
     pub fn lrtc_peer_connection_add_video_track_transceiver_with_init(pc: PeerConnectionPtr, track: VideoTrackPtr, init: *const LrtcRtpTransceiverInit) -> RtpTransceiverPtr;
     pub fn lrtc_peer_connection_close(pc: PeerConnectionPtr);
+    pub fn lrtc_peer_connection_connect_loopback(offerer: PeerConnectionPtr, answerer: PeerConnectionPtr, success: *mut c_void, failure: *mut c_void, user_data: *mut c_void);
+    pub fn lrtc_peer_connection_copy_local_description(pc: PeerConnectionPtr, buffer: *const c_char, buffer_len: u32) -> i32;
+    pub fn lrtc_peer_connection_copy_local_description_type(pc: PeerConnectionPtr, buffer: *const c_char, buffer_len: u32) -> i32;
+    pub fn lrtc_peer_connection_copy_remote_description(pc: PeerConnectionPtr, buffer: *const c_char, buffer_len: u32) -> i32;
+    pub fn lrtc_peer_connection_copy_remote_description_type(pc: PeerConnectionPtr, buffer: *const c_char, buffer_len: u32) -> i32;
     pub fn lrtc_peer_connection_create(factory: FactoryPtr, config: *const LrtcRtcConfig, constraints: MediaConstraintsPtr, callbacks: *const LrtcPeerConnectionCallbacks, user_data: *mut c_void) -> PeerConnectionPtr;
     pub fn lrtc_peer_connection_create_answer(pc: PeerConnectionPtr, success: *mut c_void, failure: *mut c_void, user_data: *mut c_void, constraints: MediaConstraintsPtr);
     pub fn lrtc_peer_connection_create_data_channel(pc: PeerConnectionPtr, label: *const c_char, ordered: c_int, reliable: c_int, max_retransmit_time: c_int, max_retransmits: c_int, protocol: *const c_char, negotiated: c_int, id: c_int) -> DataChannelPtr;
+    pub fn lrtc_peer_connection_create_keyed(factory: FactoryPtr, network_key: *const c_char, config: *const LrtcRtcConfig, constraints: MediaConstraintsPtr, callbacks: *const LrtcPeerConnectionCallbacks, user_data: *mut c_void) -> PeerConnectionPtr;
+    pub fn lrtc_peer_connection_create_layer_controller(pc: PeerConnectionPtr, sender: RtpSenderPtr, options: *const LrtcLayerControllerOptions, callback: *mut c_void, user_data: *mut c_void) -> LayerControllerPtr;
     pub fn lrtc_peer_connection_create_offer(pc: PeerConnectionPtr, success: *mut c_void, failure: *mut c_void, user_data: *mut c_void, constraints: MediaConstraintsPtr);
+    pub fn lrtc_peer_connection_create_pooled(factory: FactoryPtr, callbacks: *const LrtcPeerConnectionCallbacks, user_data: *mut c_void) -> PeerConnectionPtr;
+    pub fn lrtc_peer_connection_create_templated_offer(pc: PeerConnectionPtr, session_template: SessionTemplatePtr, success: *mut c_void, failure: *mut c_void, user_data: *mut c_void, constraints: MediaConstraintsPtr);
     pub fn lrtc_peer_connection_get_local_description(pc: PeerConnectionPtr, success: *mut c_void, failure: *mut c_void, user_data: *mut c_void);
     pub fn lrtc_peer_connection_get_receiver(pc: PeerConnectionPtr, index: u32) -> RtpReceiverPtr;
     pub fn lrtc_peer_connection_get_receiver_stats(pc: PeerConnectionPtr, receiver: RtpReceiverPtr, success: *mut c_void, failure: *mut c_void, user_data: *mut c_void);
+    pub fn lrtc_peer_connection_get_receivers(pc: PeerConnectionPtr, out_receivers: *mut RtpReceiverPtr, capacity: u32) -> u32;
     pub fn lrtc_peer_connection_get_remote_description(pc: PeerConnectionPtr, success: *mut c_void, failure: *mut c_void, user_data: *mut c_void);
     pub fn lrtc_peer_connection_get_sender(pc: PeerConnectionPtr, index: u32) -> RtpSenderPtr;
     pub fn lrtc_peer_connection_get_sender_stats(pc: PeerConnectionPtr, sender: RtpSenderPtr, success: *mut c_void, failure: *mut c_void, user_data: *mut c_void);
+    pub fn lrtc_peer_connection_get_senders(pc: PeerConnectionPtr, out_senders: *mut RtpSenderPtr, capacity: u32) -> u32;
     pub fn lrtc_peer_connection_get_stats(pc: PeerConnectionPtr, success: *mut c_void, failure: *mut c_void, user_data: *mut c_void);
     pub fn lrtc_peer_connection_get_transceiver(pc: PeerConnectionPtr, index: u32) -> RtpTransceiverPtr;
+    pub fn lrtc_peer_connection_get_transceivers(pc: PeerConnectionPtr, out_transceivers: *mut RtpTransceiverPtr, capacity: u32) -> u32;
     pub fn lrtc_peer_connection_receiver_count(pc: PeerConnectionPtr) -> u32;
     pub fn lrtc_peer_connection_release(pc: PeerConnectionPtr);
     pub fn lrtc_peer_connection_remove_stream(pc: PeerConnectionPtr, stream: MediaStreamPtr) -> c_bool;
     pub fn lrtc_peer_connection_remove_track(pc: PeerConnectionPtr, sender: RtpSenderPtr) -> c_int;
     pub fn lrtc_peer_connection_restart_ice(pc: PeerConnectionPtr);
     pub fn lrtc_peer_connection_sender_count(pc: PeerConnectionPtr) -> u32;
+    pub fn lrtc_peer_connection_set_bandwidth_observer(pc: PeerConnectionPtr, interval_ms: u32, callback: *mut c_void, user_data: *mut c_void);
     pub fn lrtc_peer_connection_set_callbacks(pc: PeerConnectionPtr, callbacks: *const LrtcPeerConnectionCallbacks, user_data: *mut c_void);
     pub fn lrtc_peer_connection_set_codec_preferences(pc: PeerConnectionPtr, media_type: *mut c_void, mime_types: *const c_char, mime_type_count: u32) -> c_int;
+    pub fn lrtc_peer_connection_set_ice_candidate_batching(pc: PeerConnectionPtr, window_ms: u32, callback: *mut c_void, user_data: *mut c_void);
     pub fn lrtc_peer_connection_set_local_description(pc: PeerConnectionPtr, sdp: *const c_char, type: *const c_char, success: *mut c_void, failure: *mut c_void, user_data: *mut c_void);
     pub fn lrtc_peer_connection_set_remote_description(pc: PeerConnectionPtr, sdp: *const c_char, type: *const c_char, success: *mut c_void, failure: *mut c_void, user_data: *mut c_void);
     pub fn lrtc_peer_connection_set_transceiver_codec_preferences(pc: PeerConnectionPtr, transceiver: RtpTransceiverPtr, mime_types: *const c_char, mime_type_count: u32) -> c_int;
     pub fn lrtc_peer_connection_transceiver_count(pc: PeerConnectionPtr) -> u32;
     pub fn lrtc_rtp_receiver_encoding_count(receiver: RtpReceiverPtr) -> u32;
     pub fn lrtc_rtp_receiver_get_audio_track(receiver: RtpReceiverPtr) -> AudioTrackPtr;
+    pub fn lrtc_rtp_receiver_get_decode_stats(receiver: RtpReceiverPtr, out_stats: *mut LrtcDecodeOnDemandStats) -> *mut c_void;
     pub fn lrtc_rtp_receiver_get_degradation_preference(receiver: RtpReceiverPtr) -> c_int;
     pub fn lrtc_rtp_receiver_get_dtls_info(receiver: RtpReceiverPtr, info: *mut LrtcDtlsTransportInfo) -> c_int;
     pub fn lrtc_rtp_receiver_get_encoding_info(receiver: RtpReceiverPtr, index: u32, info: *mut LrtcRtpEncodingInfo) -> c_int;
@@ -594,6 +956,10 @@ extern "C" {
     pub fn lrtc_rtp_receiver_get_stream_id(receiver: RtpReceiverPtr, index: u32, buffer: *const c_char, buffer_len: u32) -> i32;
     pub fn lrtc_rtp_receiver_get_video_track(receiver: RtpReceiverPtr) -> VideoTrackPtr;
     pub fn lrtc_rtp_receiver_release(receiver: RtpReceiverPtr);
+    pub fn lrtc_rtp_receiver_request_key_frame(receiver: RtpReceiverPtr) -> *mut c_void;
+    pub fn lrtc_rtp_receiver_set_decode_on_demand(receiver: RtpReceiverPtr, enabled: c_bool) -> *mut c_void;
+    pub fn lrtc_rtp_receiver_set_encoded_frame_recorder(receiver: RtpReceiverPtr, recorder: EncodedFrameRecorderPtr) -> *mut c_void;
+    pub fn lrtc_rtp_receiver_set_encoded_frame_sink(receiver: RtpReceiverPtr, sink: EncodedFrameSinkPtr) -> *mut c_void;
     pub fn lrtc_rtp_receiver_set_jitter_buffer_min_delay(receiver: RtpReceiverPtr, delay_seconds: c_double) -> c_int;
     pub fn lrtc_rtp_receiver_stream_count(receiver: RtpReceiverPtr) -> u32;
     pub fn lrtc_rtp_receiver_stream_id_count(receiver: RtpReceiverPtr) -> u32;
@@ -614,8 +980,12 @@ extern "C" {
     pub fn lrtc_rtp_sender_release(sender: RtpSenderPtr);
     pub fn lrtc_rtp_sender_replace_audio_track(sender: RtpSenderPtr, track: AudioTrackPtr) -> c_int;
     pub fn lrtc_rtp_sender_replace_video_track(sender: RtpSenderPtr, track: VideoTrackPtr) -> c_int;
+    pub fn lrtc_rtp_sender_send_encoded_audio(sender: RtpSenderPtr, mime_type: *const c_char, data: *const u8, size: u32, rtp_timestamp: u32) -> *mut c_void;
+    pub fn lrtc_rtp_sender_send_encoded_frame(sender: RtpSenderPtr, frame: EncodedFramePtr) -> *mut c_void;
+    pub fn lrtc_rtp_sender_set_encoded_frame_input(sender: RtpSenderPtr, enabled: c_bool) -> *mut c_void;
     pub fn lrtc_rtp_sender_set_encoding_parameters(sender: RtpSenderPtr, settings: *const LrtcRtpEncodingSettings) -> c_int;
     pub fn lrtc_rtp_sender_set_encoding_parameters_at(sender: RtpSenderPtr, index: u32, settings: *const LrtcRtpEncodingSettings) -> c_int;
+    pub fn lrtc_rtp_sender_set_encodings(sender: RtpSenderPtr, settings: *const LrtcRtpEncodingSettings, count: u32, degradation_preference: c_int) -> *mut c_void;
     pub fn lrtc_rtp_sender_set_stream_ids(sender: RtpSenderPtr, stream_ids: *const c_char, stream_id_count: u32) -> c_int;
     pub fn lrtc_rtp_sender_stream_id_count(sender: RtpSenderPtr) -> u32;
     pub fn lrtc_rtp_transceiver_get_current_direction(transceiver: RtpTransceiverPtr) -> c_int;
@@ -631,12 +1001,24 @@ extern "C" {
     pub fn lrtc_rtp_transceiver_release(transceiver: RtpTransceiverPtr);
     pub fn lrtc_rtp_transceiver_set_direction(transceiver: RtpTransceiverPtr, direction: c_int, error: *const c_char, error_len: u32) -> c_int;
     pub fn lrtc_rtp_transceiver_stop(transceiver: RtpTransceiverPtr, error: *const c_char, error_len: u32) -> c_int;
+    pub fn lrtc_session_template_create() -> SessionTemplatePtr;
+    pub fn lrtc_session_template_get_stats(session_template: SessionTemplatePtr, out_stats: *mut LrtcSessionTemplateStats) -> *mut c_void;
+    pub fn lrtc_session_template_release(session_template: SessionTemplatePtr);
+    pub fn lrtc_session_template_reset(session_template: SessionTemplatePtr);
     pub fn lrtc_terminate();
+    pub fn lrtc_trace_drain(events: *mut LrtcTraceEvent, capacity: u32) -> u32;
+    pub fn lrtc_trace_dropped_count() -> u64;
+    pub fn lrtc_trace_format_chrome_json(events: *const LrtcTraceEvent, count: u32, buffer: *const c_char, buffer_len: u32) -> i32;
+    pub fn lrtc_trace_start(capacity: u32) -> *mut c_void;
+    pub fn lrtc_trace_stop();
     pub fn lrtc_video_capturer_capture_started(capturer: VideoCapturerPtr) -> c_bool;
     pub fn lrtc_video_capturer_release(capturer: VideoCapturerPtr);
     pub fn lrtc_video_capturer_start(capturer: VideoCapturerPtr) -> c_bool;
+    pub fn lrtc_video_capturer_start_async(capturer: VideoCapturerPtr, callback: *mut c_void, user_data: *mut c_void) -> *mut c_void;
     pub fn lrtc_video_capturer_stop(capturer: VideoCapturerPtr);
+    pub fn lrtc_video_capturer_stop_async(capturer: VideoCapturerPtr, callback: *mut c_void, user_data: *mut c_void) -> *mut c_void;
     pub fn lrtc_video_device_create_capturer(device: VideoDevicePtr, name: *const c_char, index: u32, width: size_t, height: size_t, target_fps: size_t) -> VideoCapturerPtr;
+    pub fn lrtc_video_device_create_capturer_async(device: VideoDevicePtr, name: *const c_char, index: u32, width: size_t, height: size_t, target_fps: size_t, callback: *mut c_void, user_data: *mut c_void) -> *mut c_void;
     pub fn lrtc_video_device_get_device_name(device: VideoDevicePtr, index: u32, name: *const c_char, name_length: u32, unique_id: *const c_char, unique_id_length: u32) -> i32;
     pub fn lrtc_video_device_number_of_devices(device: VideoDevicePtr) -> u32;
     pub fn lrtc_video_device_release(device: VideoDevicePtr);
@@ -644,6 +1026,7 @@ extern "C" {
     pub fn lrtc_video_frame_data_u(frame: VideoFramePtr) -> *const u8;
     pub fn lrtc_video_frame_data_v(frame: VideoFramePtr) -> *const u8;
     pub fn lrtc_video_frame_data_y(frame: VideoFramePtr) -> *const u8;
+    pub fn lrtc_video_frame_format(frame: VideoFramePtr) -> c_int;
     pub fn lrtc_video_frame_height(frame: VideoFramePtr) -> c_int;
     pub fn lrtc_video_frame_release(frame: VideoFramePtr);
     pub fn lrtc_video_frame_retain(frame: VideoFramePtr) -> VideoFramePtr;
@@ -653,8 +1036,15 @@ extern "C" {
     pub fn lrtc_video_frame_to_argb(frame: VideoFramePtr, dst_argb: *mut u8, dst_stride_argb: c_int, dest_width: c_int, dest_height: c_int, format: c_int) -> c_int;
     pub fn lrtc_video_frame_width(frame: VideoFramePtr) -> c_int;
     pub fn lrtc_video_sink_create(callbacks: *const LrtcVideoSinkCallbacks, user_data: *mut c_void) -> VideoSinkPtr;
+    pub fn lrtc_video_sink_create_with_wants(callbacks: *const LrtcVideoSinkCallbacks, wants: *const LrtcVideoSinkWants, user_data: *mut c_void) -> VideoSinkPtr;
     pub fn lrtc_video_sink_release(sink: VideoSinkPtr);
+    pub fn lrtc_video_source_dropped_count(source: VideoSourcePtr) -> u64;
+    pub fn lrtc_video_source_push_argb(source: VideoSourcePtr, data: *const u8, stride: c_int, width: c_int, height: c_int, format: c_int, timestamp_us: i64, release: *mut c_void, user_data: *mut c_void) -> c_int;
+    pub fn lrtc_video_source_push_encoded(source: VideoSourcePtr, data: *const u8, size: u32, width: c_int, height: c_int, key_frame: c_bool, timestamp_us: i64) -> c_int;
+    pub fn lrtc_video_source_push_i420(source: VideoSourcePtr, data_y: *const u8, stride_y: c_int, data_u: *const u8, stride_u: c_int, data_v: *const u8, stride_v: c_int, width: c_int, height: c_int, timestamp_us: i64, release: *mut c_void, user_data: *mut c_void) -> c_int;
+    pub fn lrtc_video_source_push_nv12(source: VideoSourcePtr, data_y: *const u8, stride_y: c_int, data_uv: *const u8, stride_uv: c_int, width: c_int, height: c_int, timestamp_us: i64, release: *mut c_void, user_data: *mut c_void) -> c_int;
     pub fn lrtc_video_source_release(source: VideoSourcePtr);
+    pub fn lrtc_video_source_set_key_frame_request_callback(source: VideoSourcePtr, callback: *mut c_void, user_data: *mut c_void) -> *mut c_void;
     pub fn lrtc_video_track_add_sink(track: VideoTrackPtr, sink: VideoSinkPtr);
     pub fn lrtc_video_track_get_enabled(track: VideoTrackPtr) -> c_int;
     pub fn lrtc_video_track_get_id(track: VideoTrackPtr, buffer: *const c_char, buffer_len: u32) -> i32;
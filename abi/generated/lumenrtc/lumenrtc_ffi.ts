@@ -55,6 +55,27 @@ export enum DtlsTransportState {
   Failed = 4,
 }
 
+export enum FactoryThreadMode {
+  Dedicated = 0,
+  Shared = 1,
+  Pooled = 2,
+}
+
+export enum FrameCryptionState {
+  New = 0,
+  Ok = 1,
+  EncryptionFailed = 2,
+  DecryptionFailed = 3,
+  MissingKey = 4,
+  KeyRatcheted = 5,
+  InternalError = 6,
+}
+
+export enum FrameCryptoAlgorithm {
+  Gcm = 0,
+  Cbc = 1,
+}
+
 export enum IceConnectionState {
   New = 0,
   Checking = 1,
@@ -79,6 +100,13 @@ export enum IceTransportsType {
   All = 3,
 }
 
+export enum LayerDecisionReason {
+  Bandwidth = 0,
+  Loss = 1,
+  Rtt = 2,
+  Cpu = 3,
+}
+
 export enum LogSeverity {
   Verbose = 0,
   Info = 1,
@@ -108,6 +136,12 @@ export enum PeerConnectionState {
   Closed = 5,
 }
 
+export enum RecordingSyncPolicy {
+  None = 0,
+  OnStop = 1,
+  Interval = 2,
+}
+
 export enum Result {
   Ok = 0,
   Error = 1,
@@ -147,11 +181,42 @@ export enum TcpCandidatePolicy {
   Disabled = 1,
 }
 
+export enum ThreadRole {
+  Worker = 0,
+  Signaling = 1,
+  Network = 2,
+  Capture = 3,
+}
+
+export enum ThreadTuningFailure {
+  AffinityFailed = 1,
+  NiceFailed = 2,
+  RealtimeFailed = 4,
+}
+
+export enum TraceStage {
+  DesktopCapture = 0,
+  DesktopConvert = 1,
+  CaptureAdapt = 2,
+  VideoSinkAdapter = 3,
+  VideoSinkCallback = 4,
+  AudioSinkAdapter = 5,
+  AudioSinkCallback = 6,
+}
+
 export enum TrackState {
   Live = 0,
   Ended = 1,
 }
 
+export enum VideoPixelFormat {
+  Native = 0,
+  I420 = 1,
+  Nv12 = 2,
+  Argb = 3,
+  Bgra = 4,
+}
+
 // ── Opaque handles ────────────────────────────────────────────────────────────────────────
 
 export type AudioDeviceHandle = ref.Pointer<unknown>;
@@ -181,9 +246,27 @@ export const DesktopMediaListHandleType = ref.refType(ref.types.void);
 export type DtmfSenderHandle = ref.Pointer<unknown>;
 export const DtmfSenderHandleType = ref.refType(ref.types.void);
 
+export type EncodedFrameRecorderHandle = ref.Pointer<unknown>;
+export const EncodedFrameRecorderHandleType = ref.refType(ref.types.void);
+
+export type EncodedFrameSinkHandle = ref.Pointer<unknown>;
+export const EncodedFrameSinkHandleType = ref.refType(ref.types.void);
+
+export type EncodedFrameHandle = ref.Pointer<unknown>;
+export const EncodedFrameHandleType = ref.refType(ref.types.void);
+
 export type FactoryHandle = ref.Pointer<unknown>;
 export const FactoryHandleType = ref.refType(ref.types.void);
 
+export type FrameCryptorHandle = ref.Pointer<unknown>;
+export const FrameCryptorHandleType = ref.refType(ref.types.void);
+
+export type KeyProviderHandle = ref.Pointer<unknown>;
+export const KeyProviderHandleType = ref.refType(ref.types.void);
+
+export type LayerControllerHandle = ref.Pointer<unknown>;
+export const LayerControllerHandleType = ref.refType(ref.types.void);
+
 export type MediaConstraintsHandle = ref.Pointer<unknown>;
 export const MediaConstraintsHandleType = ref.refType(ref.types.void);
 
@@ -205,6 +288,9 @@ export const RtpSenderHandleType = ref.refType(ref.types.void);
 export type RtpTransceiverHandle = ref.Pointer<unknown>;
 export const RtpTransceiverHandleType = ref.refType(ref.types.void);
 
+export type SessionTemplateHandle = ref.Pointer<unknown>;
+export const SessionTemplateHandleType = ref.refType(ref.types.void);
+
 export type VideoCapturerHandle = ref.Pointer<unknown>;
 export const VideoCapturerHandleType = ref.refType(ref.types.void);
 
@@ -230,15 +316,27 @@ export type SdpErrorCb = (user_data: ref.Pointer<unknown>, error: string) => voi
 export type VoidCb = (user_data: ref.Pointer<unknown>) => void;
 export type PeerConnectionStateCb = (user_data: ref.Pointer<unknown>, state: number) => void;
 export type IceCandidateCb = (user_data: ref.Pointer<unknown>, sdp_mid: string, sdp_mline_index: number, candidate: string) => void;
+export type IceCandidatesCb = (user_data: ref.Pointer<unknown>, sdp_mids: string, sdp_mline_indexes: ref.Pointer<unknown>, candidates: string, count: number) => void;
+export type BandwidthEstimateCb = (user_data: ref.Pointer<unknown>, target_bitrate_bps: number, stable_target_bitrate_bps: number, encoder_target_bitrate_bps: number, encoder_count: number, rtt_ms: number, loss_rate: number) => void;
+export type LayerDecisionCb = (user_data: ref.Pointer<unknown>, reason: number, previous_level: number, level: number, target_bitrate_bps: number, loss_rate: number, rtt_ms: number) => void;
 export type DataChannelStateCb = (user_data: ref.Pointer<unknown>, state: number) => void;
 export type DataChannelMessageCb = (user_data: ref.Pointer<unknown>, data: ref.Pointer<unknown>, length: number, binary: number) => void;
 export type AudioFrameCb = (user_data: ref.Pointer<unknown>, audio_data: ref.Pointer<unknown>, bits_per_sample: number, sample_rate: number, number_of_channels: number, number_of_frames: number) => void;
 export type VideoFrameCb = (user_data: ref.Pointer<unknown>, frame: VideoFrameHandle) => void;
+export type EncodedFrameCb = (user_data: ref.Pointer<unknown>, frame: EncodedFrameHandle) => void;
 export type TrackCb = (user_data: ref.Pointer<unknown>, transceiver: RtpTransceiverHandle, receiver: RtpReceiverHandle) => void;
 export type StatsSuccessCb = (user_data: ref.Pointer<unknown>, json: string) => void;
 export type StatsFailureCb = (user_data: ref.Pointer<unknown>, error: string) => void;
 export type LogMessageCb = (user_data: ref.Pointer<unknown>, message: string) => void;
 export type DtmfToneCb = (user_data: ref.Pointer<unknown>, tone: string, tone_buffer: string) => void;
+export type AudioSourceCreatedCb = (user_data: ref.Pointer<unknown>, source: AudioSourceHandle) => void;
+export type AudioTrackCreatedCb = (user_data: ref.Pointer<unknown>, track: AudioTrackHandle) => void;
+export type VideoSourceCreatedCb = (user_data: ref.Pointer<unknown>, source: VideoSourceHandle) => void;
+export type VideoTrackCreatedCb = (user_data: ref.Pointer<unknown>, track: VideoTrackHandle) => void;
+export type VideoCapturerCreatedCb = (user_data: ref.Pointer<unknown>, capturer: VideoCapturerHandle) => void;
+export type VideoCaptureStartedCb = (user_data: ref.Pointer<unknown>, started: number) => void;
+export type DesktopCaptureStateCb = (user_data: ref.Pointer<unknown>, state: number) => void;
+export type FrameCryptionStateCb = (user_data: ref.Pointer<unknown>, participant_id: string, state: number) => void;
 
 // ── Structs ─────────────────────────────────────────────────────────────────────────────────
 
@@ -247,16 +345,33 @@ export type DtmfToneCb = (user_data: ref.Pointer<unknown>, tone: string, tone_bu
 
 // export interface AudioOptions { ... }  // manual implementation needed
 // export interface AudioSinkCallbacks { ... }  // manual implementation needed
+// export interface CertificateCacheOptions { ... }  // manual implementation needed
 // export interface DataChannelCallbacks { ... }  // manual implementation needed
+// export interface DecodeOnDemandStats { ... }  // manual implementation needed
 // export interface DtlsTransportInfo { ... }  // manual implementation needed
 // export interface DtmfSenderCallbacks { ... }  // manual implementation needed
+// export interface EncodedFrameInfo { ... }  // manual implementation needed
+// export interface EncodedFrameRecorderOptions { ... }  // manual implementation needed
+// export interface EncodedFrameRecorderStats { ... }  // manual implementation needed
+// export interface FactoryOptions { ... }  // manual implementation needed
 // export interface IceServer { ... }  // manual implementation needed
+// export interface KeyProviderOptions { ... }  // manual implementation needed
+// export interface LayerControllerOptions { ... }  // manual implementation needed
 // export interface PeerConnectionCallbacks { ... }  // manual implementation needed
+// export interface PeerConnectionPoolStats { ... }  // manual implementation needed
 // export interface RtcConfig { ... }  // manual implementation needed
 // export interface RtpEncodingInfo { ... }  // manual implementation needed
 // export interface RtpEncodingSettings { ... }  // manual implementation needed
 // export interface RtpTransceiverInit { ... }  // manual implementation needed
+// export interface SessionTemplateStats { ... }  // manual implementation needed
+// export interface ThreadConfig { ... }  // manual implementation needed
+// export interface ThreadReport { ... }  // manual implementation needed
+// export interface TraceEvent { ... }  // manual implementation needed
+// export interface UdpMuxOptions { ... }  // manual implementation needed
+// export interface UdpMuxStats { ... }  // manual implementation needed
 // export interface VideoSinkCallbacks { ... }  // manual implementation needed
+// export interface VideoSinkWants { ... }  // manual implementation needed
+// export interface VirtualNetworkOptions { ... }  // manual implementation needed
 
 // ── Library declaration ────────────────────────────────────────────────────────────────────
 
@@ -293,11 +408,15 @@ export function loadLibrary(libraryPath: string) {
     'lrtc_data_channel_release': ['void', [DataChannelHandleType]],
     'lrtc_data_channel_send': ['void', [DataChannelHandleType, 'pointer', 'uint32', 'int32']],
     'lrtc_data_channel_set_callbacks': ['void', [DataChannelHandleType, 'pointer', 'pointer']],
+    'lrtc_desktop_capturer_get_thread_report': ['int32', [DesktopCapturerHandleType, 'pointer']],
     'lrtc_desktop_capturer_is_running': ['bool', [DesktopCapturerHandleType]],
     'lrtc_desktop_capturer_release': ['void', [DesktopCapturerHandleType]],
     'lrtc_desktop_capturer_start': ['int32', [DesktopCapturerHandleType, 'uint32']],
+    'lrtc_desktop_capturer_start_async': ['int32', [DesktopCapturerHandleType, 'uint32', 'int32', 'pointer']],
     'lrtc_desktop_capturer_start_region': ['int32', [DesktopCapturerHandleType, 'uint32', 'uint32', 'uint32', 'uint32', 'uint32']],
+    'lrtc_desktop_capturer_start_region_async': ['int32', [DesktopCapturerHandleType, 'uint32', 'uint32', 'uint32', 'uint32', 'uint32', 'int32', 'pointer']],
     'lrtc_desktop_capturer_stop': ['void', [DesktopCapturerHandleType]],
+    'lrtc_desktop_capturer_stop_async': ['int32', [DesktopCapturerHandleType, 'int32', 'pointer']],
     'lrtc_desktop_device_create_capturer': [DesktopCapturerHandleType, [DesktopDeviceHandleType, MediaSourceHandleType, 'bool']],
     'lrtc_desktop_device_get_media_list': [DesktopMediaListHandleType, [DesktopDeviceHandleType, 'int32']],
     'lrtc_desktop_device_release': ['void', [DesktopDeviceHandleType]],
@@ -313,23 +432,75 @@ export function loadLibrary(libraryPath: string) {
     'lrtc_dtmf_sender_release': ['void', [DtmfSenderHandleType]],
     'lrtc_dtmf_sender_set_callbacks': ['void', [DtmfSenderHandleType, 'pointer', 'pointer']],
     'lrtc_dtmf_sender_tones': ['int32', [DtmfSenderHandleType, 'string', 'uint32']],
+    'lrtc_encoded_frame_data': ['pointer', [EncodedFrameHandleType]],
+    'lrtc_encoded_frame_get_dependencies': ['uint32', [EncodedFrameHandleType, 'pointer', 'uint32']],
+    'lrtc_encoded_frame_get_info': ['int32', [EncodedFrameHandleType, 'pointer']],
+    'lrtc_encoded_frame_get_mime_type': ['int32', [EncodedFrameHandleType, 'string', 'uint32']],
+    'lrtc_encoded_frame_recorder_create': [EncodedFrameRecorderHandleType, ['string', 'pointer']],
+    'lrtc_encoded_frame_recorder_get_stats': ['int32', [EncodedFrameRecorderHandleType, 'pointer']],
+    'lrtc_encoded_frame_recorder_release': ['void', [EncodedFrameRecorderHandleType]],
+    'lrtc_encoded_frame_recorder_stop': ['int32', [EncodedFrameRecorderHandleType]],
+    'lrtc_encoded_frame_release': ['void', [EncodedFrameHandleType]],
+    'lrtc_encoded_frame_retain': [EncodedFrameHandleType, [EncodedFrameHandleType]],
+    'lrtc_encoded_frame_sink_create': [EncodedFrameSinkHandleType, ['int32', 'pointer']],
+    'lrtc_encoded_frame_sink_release': ['void', [EncodedFrameSinkHandleType]],
+    'lrtc_encoded_frame_size': ['uint32', [EncodedFrameHandleType]],
+    'lrtc_factory_configure_certificate_cache': ['int32', [FactoryHandleType, 'pointer']],
+    'lrtc_factory_configure_peer_connection_pool': ['int32', [FactoryHandleType, 'pointer', MediaConstraintsHandleType, 'int32']],
+    'lrtc_factory_configure_udp_mux': ['int32', [FactoryHandleType, 'pointer']],
     'lrtc_factory_create': [FactoryHandleType, []],
     'lrtc_factory_create_audio_source': [AudioSourceHandleType, [FactoryHandleType, 'string', 'int32', 'pointer']],
+    'lrtc_factory_create_audio_source_async': ['int32', [FactoryHandleType, 'string', 'int32', 'pointer', 'int32', 'pointer']],
     'lrtc_factory_create_audio_track': [AudioTrackHandleType, [FactoryHandleType, AudioSourceHandleType, 'string']],
+    'lrtc_factory_create_audio_track_async': ['int32', [FactoryHandleType, AudioSourceHandleType, 'string', 'int32', 'pointer']],
+    'lrtc_factory_create_custom_video_source': [VideoSourceHandleType, [FactoryHandleType, 'string', 'bool']],
     'lrtc_factory_create_desktop_source': [VideoSourceHandleType, [FactoryHandleType, DesktopCapturerHandleType, 'string', MediaConstraintsHandleType]],
+    'lrtc_factory_create_desktop_source_async': ['int32', [FactoryHandleType, DesktopCapturerHandleType, 'string', MediaConstraintsHandleType, 'int32', 'pointer']],
+    'lrtc_factory_create_encoded_video_source': [VideoSourceHandleType, [FactoryHandleType, 'string', 'string']],
     'lrtc_factory_create_stream': [MediaStreamHandleType, [FactoryHandleType, 'string']],
     'lrtc_factory_create_video_source': [VideoSourceHandleType, [FactoryHandleType, VideoCapturerHandleType, 'string', MediaConstraintsHandleType]],
+    'lrtc_factory_create_video_source_async': ['int32', [FactoryHandleType, VideoCapturerHandleType, 'string', MediaConstraintsHandleType, 'int32', 'pointer']],
     'lrtc_factory_create_video_track': [VideoTrackHandleType, [FactoryHandleType, VideoSourceHandleType, 'string']],
+    'lrtc_factory_create_video_track_async': ['int32', [FactoryHandleType, VideoSourceHandleType, 'string', 'int32', 'pointer']],
+    'lrtc_factory_create_with_options': [FactoryHandleType, ['pointer', FactoryHandleType]],
+    'lrtc_factory_export_certificate_pem': ['int32', [FactoryHandleType, 'string', 'uint32']],
     'lrtc_factory_get_audio_device': [AudioDeviceHandleType, [FactoryHandleType]],
     'lrtc_factory_get_desktop_device': [DesktopDeviceHandleType, [FactoryHandleType]],
+    'lrtc_factory_get_peer_connection_pool_stats': ['int32', [FactoryHandleType, 'pointer']],
     'lrtc_factory_get_rtp_receiver_capabilities': ['void', [FactoryHandleType, 'int32', 'int32', 'int32', 'pointer']],
     'lrtc_factory_get_rtp_sender_capabilities': ['void', [FactoryHandleType, 'int32', 'int32', 'int32', 'pointer']],
     'lrtc_factory_get_rtp_sender_codec_mime_types': ['void', [FactoryHandleType, 'int32', 'int32', 'int32', 'pointer']],
+    'lrtc_factory_get_thread_report': ['int32', [FactoryHandleType, 'int32', 'uint32', 'pointer']],
+    'lrtc_factory_get_udp_mux_stats': ['int32', [FactoryHandleType, 'pointer']],
     'lrtc_factory_get_video_device': [VideoDeviceHandleType, [FactoryHandleType]],
+    'lrtc_factory_import_certificate_pem': ['int32', [FactoryHandleType, 'string']],
     'lrtc_factory_initialize': ['int32', [FactoryHandleType]],
     'lrtc_factory_release': ['void', [FactoryHandleType]],
+    'lrtc_factory_set_virtual_network_conditions': ['int32', [FactoryHandleType, 'pointer']],
     'lrtc_factory_terminate': ['void', [FactoryHandleType]],
+    'lrtc_frame_cryptor_create_for_receiver': [FrameCryptorHandleType, [RtpReceiverHandleType, 'string', 'int32', KeyProviderHandleType]],
+    'lrtc_frame_cryptor_create_for_sender': [FrameCryptorHandleType, [RtpSenderHandleType, 'string', 'int32', KeyProviderHandleType]],
+    'lrtc_frame_cryptor_get_enabled': ['bool', [FrameCryptorHandleType]],
+    'lrtc_frame_cryptor_get_key_index': ['int32', [FrameCryptorHandleType]],
+    'lrtc_frame_cryptor_release': ['void', [FrameCryptorHandleType]],
+    'lrtc_frame_cryptor_set_enabled': ['int32', [FrameCryptorHandleType, 'bool']],
+    'lrtc_frame_cryptor_set_key_index': ['int32', [FrameCryptorHandleType, 'int32']],
+    'lrtc_frame_cryptor_set_observer': ['void', [FrameCryptorHandleType, 'int32', 'pointer']],
     'lrtc_initialize': ['int32', []],
+    'lrtc_key_provider_create': [KeyProviderHandleType, ['pointer']],
+    'lrtc_key_provider_decrypt': ['int32', [KeyProviderHandleType, 'string', 'pointer', 'uint32']],
+    'lrtc_key_provider_encrypt': ['int32', [KeyProviderHandleType, 'string', 'int32', 'pointer', 'uint32', 'uint32']],
+    'lrtc_key_provider_export_key': ['int32', [KeyProviderHandleType, 'string', 'int32', 'pointer', 'uint32']],
+    'lrtc_key_provider_export_shared_key': ['int32', [KeyProviderHandleType, 'int32', 'pointer', 'uint32']],
+    'lrtc_key_provider_ratchet_key': ['int32', [KeyProviderHandleType, 'string', 'int32']],
+    'lrtc_key_provider_ratchet_shared_key': ['int32', [KeyProviderHandleType, 'int32']],
+    'lrtc_key_provider_release': ['void', [KeyProviderHandleType]],
+    'lrtc_key_provider_set_key': ['int32', [KeyProviderHandleType, 'string', 'int32', 'pointer', 'uint32']],
+    'lrtc_key_provider_set_shared_key': ['int32', [KeyProviderHandleType, 'int32', 'pointer', 'uint32']],
+    'lrtc_key_provider_set_sif_trailer': ['void', [KeyProviderHandleType, 'pointer', 'uint32']],
+    'lrtc_layer_controller_get_level': ['int32', [LayerControllerHandleType]],
+    'lrtc_layer_controller_get_max_level': ['int32', [LayerControllerHandleType]],
+    'lrtc_layer_controller_release': ['void', [LayerControllerHandleType]],
     'lrtc_logging_remove_callback': ['void', []],
     'lrtc_logging_set_callback': ['void', ['int32', 'int32', 'pointer']],
     'lrtc_logging_set_min_level': ['void', ['int32']],
@@ -354,6 +525,7 @@ export function loadLibrary(libraryPath: string) {
     'lrtc_peer_connection_add_audio_track_transceiver_with_init': [RtpTransceiverHandleType, [PeerConnectionHandleType, AudioTrackHandleType, 'pointer']],
     'lrtc_peer_connection_add_ice_candidate': ['void', [PeerConnectionHandleType, 'string', 'int32', 'string']],
     'lrtc_peer_connection_add_ice_candidate_ex': ['int32', [PeerConnectionHandleType, 'string', 'int32', 'string']],
+    'lrtc_peer_connection_add_ice_candidates': ['int32', [PeerConnectionHandleType, 'string', 'pointer', 'string', 'uint32', 'pointer']],
     'lrtc_peer_connection_add_stream': ['bool', [PeerConnectionHandleType, MediaStreamHandleType]],
     'lrtc_peer_connection_add_transceiver': [RtpTransceiverHandleType, [PeerConnectionHandleType, 'int32']],
     'lrtc_peer_connection_add_transceiver_with_init': [RtpTransceiverHandleType, [PeerConnectionHandleType, 'int32', 'pointer']],
@@ -362,32 +534,47 @@ export function loadLibrary(libraryPath: string) {
     'lrtc_peer_connection_add_video_track_transceiver': [RtpTransceiverHandleType, [PeerConnectionHandleType, VideoTrackHandleType]],
     'lrtc_peer_connection_add_video_track_transceiver_with_init': [RtpTransceiverHandleType, [PeerConnectionHandleType, VideoTrackHandleType, 'pointer']],
     'lrtc_peer_connection_close': ['void', [PeerConnectionHandleType]],
+    'lrtc_peer_connection_connect_loopback': ['void', [PeerConnectionHandleType, PeerConnectionHandleType, 'int32', 'int32', 'pointer']],
+    'lrtc_peer_connection_copy_local_description': ['int32', [PeerConnectionHandleType, 'string', 'uint32']],
+    'lrtc_peer_connection_copy_local_description_type': ['int32', [PeerConnectionHandleType, 'string', 'uint32']],
+    'lrtc_peer_connection_copy_remote_description': ['int32', [PeerConnectionHandleType, 'string', 'uint32']],
+    'lrtc_peer_connection_copy_remote_description_type': ['int32', [PeerConnectionHandleType, 'string', 'uint32']],
     'lrtc_peer_connection_create': [PeerConnectionHandleType, [FactoryHandleType, 'pointer', MediaConstraintsHandleType, 'pointer', 'pointer']],
     'lrtc_peer_connection_create_answer': ['void', [PeerConnectionHandleType, 'int32', 'int32', 'pointer', MediaConstraintsHandleType]],
     'lrtc_peer_connection_create_data_channel': [DataChannelHandleType, [PeerConnectionHandleType, 'string', 'int32', 'int32', 'int32', 'int32', 'string', 'int32', 'int32']],
+    'lrtc_peer_connection_create_keyed': [PeerConnectionHandleType, [FactoryHandleType, 'string', 'pointer', MediaConstraintsHandleType, 'pointer', 'pointer']],
+    'lrtc_peer_connection_create_layer_controller': [LayerControllerHandleType, [PeerConnectionHandleType, RtpSenderHandleType, 'pointer', 'int32', 'pointer']],
     'lrtc_peer_connection_create_offer': ['void', [PeerConnectionHandleType, 'int32', 'int32', 'pointer', MediaConstraintsHandleType]],
+    'lrtc_peer_connection_create_pooled': [PeerConnectionHandleType, [FactoryHandleType, 'pointer', 'pointer']],
+    'lrtc_peer_connection_create_templated_offer': ['void', [PeerConnectionHandleType, SessionTemplateHandleType, 'int32', 'int32', 'pointer', MediaConstraintsHandleType]],
     'lrtc_peer_connection_get_local_description': ['void', [PeerConnectionHandleType, 'int32', 'int32', 'pointer']],
     'lrtc_peer_connection_get_receiver': [RtpReceiverHandleType, [PeerConnectionHandleType, 'uint32']],
     'lrtc_peer_connection_get_receiver_stats': ['void', [PeerConnectionHandleType, RtpReceiverHandleType, 'int32', 'int32', 'pointer']],
+    'lrtc_peer_connection_get_receivers': ['uint32', [PeerConnectionHandleType, 'pointer', 'uint32']],
     'lrtc_peer_connection_get_remote_description': ['void', [PeerConnectionHandleType, 'int32', 'int32', 'pointer']],
     'lrtc_peer_connection_get_sender': [RtpSenderHandleType, [PeerConnectionHandleType, 'uint32']],
     'lrtc_peer_connection_get_sender_stats': ['void', [PeerConnectionHandleType, RtpSenderHandleType, 'int32', 'int32', 'pointer']],
+    'lrtc_peer_connection_get_senders': ['uint32', [PeerConnectionHandleType, 'pointer', 'uint32']],
     'lrtc_peer_connection_get_stats': ['void', [PeerConnectionHandleType, 'int32', 'int32', 'pointer']],
     'lrtc_peer_connection_get_transceiver': [RtpTransceiverHandleType, [PeerConnectionHandleType, 'uint32']],
+    'lrtc_peer_connection_get_transceivers': ['uint32', [PeerConnectionHandleType, 'pointer', 'uint32']],
     'lrtc_peer_connection_receiver_count': ['uint32', [PeerConnectionHandleType]],
     'lrtc_peer_connection_release': ['void', [PeerConnectionHandleType]],
     'lrtc_peer_connection_remove_stream': ['bool', [PeerConnectionHandleType, MediaStreamHandleType]],
     'lrtc_peer_connection_remove_track': ['int32', [PeerConnectionHandleType, RtpSenderHandleType]],
     'lrtc_peer_connection_restart_ice': ['void', [PeerConnectionHandleType]],
     'lrtc_peer_connection_sender_count': ['uint32', [PeerConnectionHandleType]],
+    'lrtc_peer_connection_set_bandwidth_observer': ['void', [PeerConnectionHandleType, 'uint32', 'int32', 'pointer']],
     'lrtc_peer_connection_set_callbacks': ['void', [PeerConnectionHandleType, 'pointer', 'pointer']],
     'lrtc_peer_connection_set_codec_preferences': ['int32', [PeerConnectionHandleType, 'int32', 'string', 'uint32']],
+    'lrtc_peer_connection_set_ice_candidate_batching': ['void', [PeerConnectionHandleType, 'uint32', 'int32', 'pointer']],
     'lrtc_peer_connection_set_local_description': ['void', [PeerConnectionHandleType, 'string', 'string', 'int32', 'int32', 'pointer']],
     'lrtc_peer_connection_set_remote_description': ['void', [PeerConnectionHandleType, 'string', 'string', 'int32', 'int32', 'pointer']],
     'lrtc_peer_connection_set_transceiver_codec_preferences': ['int32', [PeerConnectionHandleType, RtpTransceiverHandleType, 'string', 'uint32']],
     'lrtc_peer_connection_transceiver_count': ['uint32', [PeerConnectionHandleType]],
     'lrtc_rtp_receiver_encoding_count': ['uint32', [RtpReceiverHandleType]],
     'lrtc_rtp_receiver_get_audio_track': [AudioTrackHandleType, [RtpReceiverHandleType]],
+    'lrtc_rtp_receiver_get_decode_stats': ['int32', [RtpReceiverHandleType, 'pointer']],
     'lrtc_rtp_receiver_get_degradation_preference': ['int32', [RtpReceiverHandleType]],
     'lrtc_rtp_receiver_get_dtls_info': ['int32', [RtpReceiverHandleType, 'pointer']],
     'lrtc_rtp_receiver_get_encoding_info': ['int32', [RtpReceiverHandleType, 'uint32', 'pointer']],
@@ -400,6 +587,10 @@ export function loadLibrary(libraryPath: string) {
     'lrtc_rtp_receiver_get_stream_id': ['int32', [RtpReceiverHandleType, 'uint32', 'string', 'uint32']],
     'lrtc_rtp_receiver_get_video_track': [VideoTrackHandleType, [RtpReceiverHandleType]],
     'lrtc_rtp_receiver_release': ['void', [RtpReceiverHandleType]],
+    'lrtc_rtp_receiver_request_key_frame': ['int32', [RtpReceiverHandleType]],
+    'lrtc_rtp_receiver_set_decode_on_demand': ['int32', [RtpReceiverHandleType, 'bool']],
+    'lrtc_rtp_receiver_set_encoded_frame_recorder': ['int32', [RtpReceiverHandleType, EncodedFrameRecorderHandleType]],
+    'lrtc_rtp_receiver_set_encoded_frame_sink': ['int32', [RtpReceiverHandleType, EncodedFrameSinkHandleType]],
     'lrtc_rtp_receiver_set_jitter_buffer_min_delay': ['int32', [RtpReceiverHandleType, 'double']],
     'lrtc_rtp_receiver_stream_count': ['uint32', [RtpReceiverHandleType]],
     'lrtc_rtp_receiver_stream_id_count': ['uint32', [RtpReceiverHandleType]],
@@ -420,8 +611,12 @@ export function loadLibrary(libraryPath: string) {
     'lrtc_rtp_sender_release': ['void', [RtpSenderHandleType]],
     'lrtc_rtp_sender_replace_audio_track': ['int32', [RtpSenderHandleType, AudioTrackHandleType]],
     'lrtc_rtp_sender_replace_video_track': ['int32', [RtpSenderHandleType, VideoTrackHandleType]],
+    'lrtc_rtp_sender_send_encoded_audio': ['int32', [RtpSenderHandleType, 'string', 'pointer', 'uint32', 'uint32']],
+    'lrtc_rtp_sender_send_encoded_frame': ['int32', [RtpSenderHandleType, EncodedFrameHandleType]],
+    'lrtc_rtp_sender_set_encoded_frame_input': ['int32', [RtpSenderHandleType, 'bool']],
     'lrtc_rtp_sender_set_encoding_parameters': ['int32', [RtpSenderHandleType, 'pointer']],
     'lrtc_rtp_sender_set_encoding_parameters_at': ['int32', [RtpSenderHandleType, 'uint32', 'pointer']],
+    'lrtc_rtp_sender_set_encodings': ['int32', [RtpSenderHandleType, 'pointer', 'uint32', 'int32']],
     'lrtc_rtp_sender_set_stream_ids': ['int32', [RtpSenderHandleType, 'string', 'uint32']],
     'lrtc_rtp_sender_stream_id_count': ['uint32', [RtpSenderHandleType]],
     'lrtc_rtp_transceiver_get_current_direction': ['int32', [RtpTransceiverHandleType]],
@@ -437,12 +632,24 @@ export function loadLibrary(libraryPath: string) {
     'lrtc_rtp_transceiver_release': ['void', [RtpTransceiverHandleType]],
     'lrtc_rtp_transceiver_set_direction': ['int32', [RtpTransceiverHandleType, 'int32', 'string', 'uint32']],
     'lrtc_rtp_transceiver_stop': ['int32', [RtpTransceiverHandleType, 'string', 'uint32']],
+    'lrtc_session_template_create': [SessionTemplateHandleType, []],
+    'lrtc_session_template_get_stats': ['int32', [SessionTemplateHandleType, 'pointer']],
+    'lrtc_session_template_release': ['void', [SessionTemplateHandleType]],
+    'lrtc_session_template_reset': ['void', [SessionTemplateHandleType]],
     'lrtc_terminate': ['void', []],
+    'lrtc_trace_drain': ['uint32', ['pointer', 'uint32']],
+    'lrtc_trace_dropped_count': ['uint64', []],
+    'lrtc_trace_format_chrome_json': ['int32', ['pointer', 'uint32', 'string', 'uint32']],
+    'lrtc_trace_start': ['int32', ['uint32']],
+    'lrtc_trace_stop': ['void', []],
     'lrtc_video_capturer_capture_started': ['bool', [VideoCapturerHandleType]],
     'lrtc_video_capturer_release': ['void', [VideoCapturerHandleType]],
     'lrtc_video_capturer_start': ['bool', [VideoCapturerHandleType]],
+    'lrtc_video_capturer_start_async': ['int32', [VideoCapturerHandleType, 'int32', 'pointer']],
     'lrtc_video_capturer_stop': ['void', [VideoCapturerHandleType]],
+    'lrtc_video_capturer_stop_async': ['int32', [VideoCapturerHandleType, 'int32', 'pointer']],
     'lrtc_video_device_create_capturer': [VideoCapturerHandleType, [VideoDeviceHandleType, 'string', 'uint32', 'size_t', 'size_t', 'size_t']],
+    'lrtc_video_device_create_capturer_async': ['int32', [VideoDeviceHandleType, 'string', 'uint32', 'size_t', 'size_t', 'size_t', 'int32', 'pointer']],
     'lrtc_video_device_get_device_name': ['int32', [VideoDeviceHandleType, 'uint32', 'string', 'uint32', 'string', 'uint32']],
     'lrtc_video_device_number_of_devices': ['uint32', [VideoDeviceHandleType]],
     'lrtc_video_device_release': ['void', [VideoDeviceHandleType]],
@@ -450,6 +657,7 @@ export function loadLibrary(libraryPath: string) {
     'lrtc_video_frame_data_u': ['pointer', [VideoFrameHandleType]],
     'lrtc_video_frame_data_v': ['pointer', [VideoFrameHandleType]],
     'lrtc_video_frame_data_y': ['pointer', [VideoFrameHandleType]],
+    'lrtc_video_frame_format': ['int32', [VideoFrameHandleType]],
     'lrtc_video_frame_height': ['int32', [VideoFrameHandleType]],
     'lrtc_video_frame_release': ['void', [VideoFrameHandleType]],
     'lrtc_video_frame_retain': [VideoFrameHandleType, [VideoFrameHandleType]],
@@ -459,8 +667,15 @@ export function loadLibrary(libraryPath: string) {
     'lrtc_video_frame_to_argb': ['int32', [VideoFrameHandleType, 'pointer', 'int32', 'int32', 'int32', 'int32']],
     'lrtc_video_frame_width': ['int32', [VideoFrameHandleType]],
     'lrtc_video_sink_create': [VideoSinkHandleType, ['pointer', 'pointer']],
+    'lrtc_video_sink_create_with_wants': [VideoSinkHandleType, ['pointer', 'pointer', 'pointer']],
     'lrtc_video_sink_release': ['void', [VideoSinkHandleType]],
+    'lrtc_video_source_dropped_count': ['uint64', [VideoSourceHandleType]],
+    'lrtc_video_source_push_argb': ['int32', [VideoSourceHandleType, 'pointer', 'int32', 'int32', 'int32', 'int32', 'int64', 'int32', 'pointer']],
+    'lrtc_video_source_push_encoded': ['int32', [VideoSourceHandleType, 'pointer', 'uint32', 'int32', 'int32', 'bool', 'int64']],
+    'lrtc_video_source_push_i420': ['int32', [VideoSourceHandleType, 'pointer', 'int32', 'pointer', 'int32', 'pointer', 'int32', 'int32', 'int32', 'int64', 'int32', 'pointer']],
+    'lrtc_video_source_push_nv12': ['int32', [VideoSourceHandleType, 'pointer', 'int32', 'pointer', 'int32', 'int32', 'int32', 'int64', 'int32', 'pointer']],
     'lrtc_video_source_release': ['void', [VideoSourceHandleType]],
+    'lrtc_video_source_set_key_frame_request_callback': ['int32', [VideoSourceHandleType, 'int32', 'pointer']],
     'lrtc_video_track_add_sink': ['void', [VideoTrackHandleType, VideoSinkHandleType]],
     'lrtc_video_track_get_enabled': ['int32', [VideoTrackHandleType]],
     'lrtc_video_track_get_id': ['int32', [VideoTrackHandleType, 'string', 'uint32']],
@@ -674,6 +889,10 @@ export class DesktopCapturer {
     this.dispose();
   }
 
+  getThreadReport(out_report: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_desktop_capturer_get_thread_report(this.handle, out_report);
+  }
+
   isRunning(): boolean {
     return this.lib.lrtc_desktop_capturer_is_running(this.handle);
   }
@@ -682,14 +901,26 @@ export class DesktopCapturer {
     return this.lib.lrtc_desktop_capturer_start(this.handle, fps);
   }
 
+  startAsync(fps: number, callback: unknown, user_data: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_desktop_capturer_start_async(this.handle, fps, callback, user_data);
+  }
+
   startRegion(fps: number, x: number, y: number, w: number, h: number): unknown {
     return this.lib.lrtc_desktop_capturer_start_region(this.handle, fps, x, y, w, h);
   }
 
+  startRegionAsync(fps: number, x: number, y: number, w: number, h: number, callback: unknown, user_data: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_desktop_capturer_start_region_async(this.handle, fps, x, y, w, h, callback, user_data);
+  }
+
   stop(): void {
     this.lib.lrtc_desktop_capturer_stop(this.handle);
   }
 
+  stopAsync(callback: unknown, user_data: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_desktop_capturer_stop_async(this.handle, callback, user_data);
+  }
+
 }
 
 export class DesktopDevice {
@@ -800,6 +1031,92 @@ export class DtmfSender {
 
 }
 
+export class EncodedFrameRecorder {
+  private readonly handle: EncodedFrameRecorderHandle;
+  private readonly lib: ReturnType<typeof loadLibrary>;
+
+  constructor(lib: ReturnType<typeof loadLibrary>, path: string, options: ref.Pointer<unknown>) {
+    this.lib = lib;
+    this.handle = this.lib.lrtc_encoded_frame_recorder_create(path, options);
+  }
+
+  dispose(): void {
+    this.lib.lrtc_encoded_frame_recorder_release(this.handle);
+  }
+
+  [Symbol.dispose](): void {
+    this.dispose();
+  }
+
+  getStats(out_stats: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_encoded_frame_recorder_get_stats(this.handle, out_stats);
+  }
+
+  stop(): unknown {
+    return this.lib.lrtc_encoded_frame_recorder_stop(this.handle);
+  }
+
+}
+
+export class EncodedFrameSink {
+  private readonly handle: EncodedFrameSinkHandle;
+  private readonly lib: ReturnType<typeof loadLibrary>;
+
+  constructor(lib: ReturnType<typeof loadLibrary>, callback: unknown, user_data: ref.Pointer<unknown>) {
+    this.lib = lib;
+    this.handle = this.lib.lrtc_encoded_frame_sink_create(callback, user_data);
+  }
+
+  dispose(): void {
+    this.lib.lrtc_encoded_frame_sink_release(this.handle);
+  }
+
+  [Symbol.dispose](): void {
+    this.dispose();
+  }
+
+}
+
+export class EncodedFrame {
+  private readonly handle: EncodedFrameHandle;
+  private readonly lib: ReturnType<typeof loadLibrary>;
+
+  constructor(lib: ReturnType<typeof loadLibrary>) {
+    this.lib = lib;
+    // Note: no create function found in IDL — provide handle externally
+    this.handle = null as unknown as EncodedFrameHandle;
+  }
+
+  dispose(): void {
+    this.lib.lrtc_encoded_frame_release(this.handle);
+  }
+
+  [Symbol.dispose](): void {
+    this.dispose();
+  }
+
+  data(): ref.Pointer<unknown> {
+    return this.lib.lrtc_encoded_frame_data(this.handle);
+  }
+
+  getDependencies(out_frame_ids: ref.Pointer<unknown>, capacity: number): number {
+    return this.lib.lrtc_encoded_frame_get_dependencies(this.handle, out_frame_ids, capacity);
+  }
+
+  getInfo(out_info: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_encoded_frame_get_info(this.handle, out_info);
+  }
+
+  getMimeType(buffer: string, buffer_len: number): number {
+    return this.lib.lrtc_encoded_frame_get_mime_type(this.handle, buffer, buffer_len);
+  }
+
+  size(): number {
+    return this.lib.lrtc_encoded_frame_size(this.handle);
+  }
+
+}
+
 export class Factory {
   private readonly handle: FactoryHandle;
   private readonly lib: ReturnType<typeof loadLibrary>;
@@ -817,18 +1134,50 @@ export class Factory {
     this.dispose();
   }
 
+  configureCertificateCache(options: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_factory_configure_certificate_cache(this.handle, options);
+  }
+
+  configurePeerConnectionPool(config: ref.Pointer<unknown>, constraints: MediaConstraintsHandle, size: number): unknown {
+    return this.lib.lrtc_factory_configure_peer_connection_pool(this.handle, config, constraints, size);
+  }
+
+  configureUdpMux(options: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_factory_configure_udp_mux(this.handle, options);
+  }
+
   createAudioSource(label: string, source_type: unknown, options: ref.Pointer<unknown>): AudioSourceHandle {
     return this.lib.lrtc_factory_create_audio_source(this.handle, label, source_type, options);
   }
 
+  createAudioSourceAsync(label: string, source_type: unknown, options: ref.Pointer<unknown>, callback: unknown, user_data: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_factory_create_audio_source_async(this.handle, label, source_type, options, callback, user_data);
+  }
+
   createAudioTrack(source: AudioSourceHandle, track_id: string): AudioTrackHandle {
     return this.lib.lrtc_factory_create_audio_track(this.handle, source, track_id);
   }
 
+  createAudioTrackAsync(source: AudioSourceHandle, track_id: string, callback: unknown, user_data: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_factory_create_audio_track_async(this.handle, source, track_id, callback, user_data);
+  }
+
+  createCustomVideoSource(label: string, is_screencast: boolean): VideoSourceHandle {
+    return this.lib.lrtc_factory_create_custom_video_source(this.handle, label, is_screencast);
+  }
+
   createDesktopSource(capturer: DesktopCapturerHandle, label: string, constraints: MediaConstraintsHandle): VideoSourceHandle {
     return this.lib.lrtc_factory_create_desktop_source(this.handle, capturer, label, constraints);
   }
 
+  createDesktopSourceAsync(capturer: DesktopCapturerHandle, label: string, constraints: MediaConstraintsHandle, callback: unknown, user_data: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_factory_create_desktop_source_async(this.handle, capturer, label, constraints, callback, user_data);
+  }
+
+  createEncodedVideoSource(label: string, codec: string): VideoSourceHandle {
+    return this.lib.lrtc_factory_create_encoded_video_source(this.handle, label, codec);
+  }
+
   createStream(stream_id: string): MediaStreamHandle {
     return this.lib.lrtc_factory_create_stream(this.handle, stream_id);
   }
@@ -837,10 +1186,22 @@ export class Factory {
     return this.lib.lrtc_factory_create_video_source(this.handle, capturer, label, constraints);
   }
 
+  createVideoSourceAsync(capturer: VideoCapturerHandle, label: string, constraints: MediaConstraintsHandle, callback: unknown, user_data: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_factory_create_video_source_async(this.handle, capturer, label, constraints, callback, user_data);
+  }
+
   createVideoTrack(source: VideoSourceHandle, track_id: string): VideoTrackHandle {
     return this.lib.lrtc_factory_create_video_track(this.handle, source, track_id);
   }
 
+  createVideoTrackAsync(source: VideoSourceHandle, track_id: string, callback: unknown, user_data: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_factory_create_video_track_async(this.handle, source, track_id, callback, user_data);
+  }
+
+  exportCertificatePem(buffer: string, buffer_len: number): number {
+    return this.lib.lrtc_factory_export_certificate_pem(this.handle, buffer, buffer_len);
+  }
+
   getAudioDevice(): AudioDeviceHandle {
     return this.lib.lrtc_factory_get_audio_device(this.handle);
   }
@@ -849,6 +1210,10 @@ export class Factory {
     return this.lib.lrtc_factory_get_desktop_device(this.handle);
   }
 
+  getPeerConnectionPoolStats(out_stats: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_factory_get_peer_connection_pool_stats(this.handle, out_stats);
+  }
+
   getRtpReceiverCapabilities(media_type: unknown, success: unknown, failure: unknown, user_data: ref.Pointer<unknown>): void {
     this.lib.lrtc_factory_get_rtp_receiver_capabilities(this.handle, media_type, success, failure, user_data);
   }
@@ -861,14 +1226,30 @@ export class Factory {
     this.lib.lrtc_factory_get_rtp_sender_codec_mime_types(this.handle, media_type, success, failure, user_data);
   }
 
+  getThreadReport(role: unknown, index: number, out_report: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_factory_get_thread_report(this.handle, role, index, out_report);
+  }
+
+  getUdpMuxStats(out_stats: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_factory_get_udp_mux_stats(this.handle, out_stats);
+  }
+
   getVideoDevice(): VideoDeviceHandle {
     return this.lib.lrtc_factory_get_video_device(this.handle);
   }
 
+  importCertificatePem(pem: string): unknown {
+    return this.lib.lrtc_factory_import_certificate_pem(this.handle, pem);
+  }
+
   initialize(): unknown {
     return this.lib.lrtc_factory_initialize(this.handle);
   }
 
+  setVirtualNetworkConditions(options: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_factory_set_virtual_network_conditions(this.handle, options);
+  }
+
   terminate(): void {
     this.lib.lrtc_factory_terminate(this.handle);
   }
@@ -877,6 +1258,137 @@ export class Factory {
     return this.lib.lrtc_peer_connection_create(this.handle, config, constraints, callbacks, user_data);
   }
 
+  lrtcPeerConnectionCreateKeyed(network_key: string, config: ref.Pointer<unknown>, constraints: MediaConstraintsHandle, callbacks: ref.Pointer<unknown>, user_data: ref.Pointer<unknown>): PeerConnectionHandle {
+    return this.lib.lrtc_peer_connection_create_keyed(this.handle, network_key, config, constraints, callbacks, user_data);
+  }
+
+  lrtcPeerConnectionCreatePooled(callbacks: ref.Pointer<unknown>, user_data: ref.Pointer<unknown>): PeerConnectionHandle {
+    return this.lib.lrtc_peer_connection_create_pooled(this.handle, callbacks, user_data);
+  }
+
+}
+
+export class FrameCryptor {
+  private readonly handle: FrameCryptorHandle;
+  private readonly lib: ReturnType<typeof loadLibrary>;
+
+  constructor(lib: ReturnType<typeof loadLibrary>) {
+    this.lib = lib;
+    // Note: no create function found in IDL — provide handle externally
+    this.handle = null as unknown as FrameCryptorHandle;
+  }
+
+  dispose(): void {
+    this.lib.lrtc_frame_cryptor_release(this.handle);
+  }
+
+  [Symbol.dispose](): void {
+    this.dispose();
+  }
+
+  getEnabled(): boolean {
+    return this.lib.lrtc_frame_cryptor_get_enabled(this.handle);
+  }
+
+  getKeyIndex(): number {
+    return this.lib.lrtc_frame_cryptor_get_key_index(this.handle);
+  }
+
+  setEnabled(enabled: boolean): unknown {
+    return this.lib.lrtc_frame_cryptor_set_enabled(this.handle, enabled);
+  }
+
+  setKeyIndex(index: number): unknown {
+    return this.lib.lrtc_frame_cryptor_set_key_index(this.handle, index);
+  }
+
+  setObserver(callback: unknown, user_data: ref.Pointer<unknown>): void {
+    this.lib.lrtc_frame_cryptor_set_observer(this.handle, callback, user_data);
+  }
+
+}
+
+export class KeyProvider {
+  private readonly handle: KeyProviderHandle;
+  private readonly lib: ReturnType<typeof loadLibrary>;
+
+  constructor(lib: ReturnType<typeof loadLibrary>, options: ref.Pointer<unknown>) {
+    this.lib = lib;
+    this.handle = this.lib.lrtc_key_provider_create(options);
+  }
+
+  dispose(): void {
+    this.lib.lrtc_key_provider_release(this.handle);
+  }
+
+  [Symbol.dispose](): void {
+    this.dispose();
+  }
+
+  decrypt(participant_id: string, data: ref.Pointer<unknown>, size: number): number {
+    return this.lib.lrtc_key_provider_decrypt(this.handle, participant_id, data, size);
+  }
+
+  encrypt(participant_id: string, key_index: number, data: ref.Pointer<unknown>, size: number, capacity: number): number {
+    return this.lib.lrtc_key_provider_encrypt(this.handle, participant_id, key_index, data, size, capacity);
+  }
+
+  exportKey(participant_id: string, key_index: number, buffer: ref.Pointer<unknown>, buffer_len: number): number {
+    return this.lib.lrtc_key_provider_export_key(this.handle, participant_id, key_index, buffer, buffer_len);
+  }
+
+  exportSharedKey(key_index: number, buffer: ref.Pointer<unknown>, buffer_len: number): number {
+    return this.lib.lrtc_key_provider_export_shared_key(this.handle, key_index, buffer, buffer_len);
+  }
+
+  ratchetKey(participant_id: string, key_index: number): unknown {
+    return this.lib.lrtc_key_provider_ratchet_key(this.handle, participant_id, key_index);
+  }
+
+  ratchetSharedKey(key_index: number): unknown {
+    return this.lib.lrtc_key_provider_ratchet_shared_key(this.handle, key_index);
+  }
+
+  setKey(participant_id: string, key_index: number, key: ref.Pointer<unknown>, key_len: number): unknown {
+    return this.lib.lrtc_key_provider_set_key(this.handle, participant_id, key_index, key, key_len);
+  }
+
+  setSharedKey(key_index: number, key: ref.Pointer<unknown>, key_len: number): unknown {
+    return this.lib.lrtc_key_provider_set_shared_key(this.handle, key_index, key, key_len);
+  }
+
+  setSifTrailer(trailer: ref.Pointer<unknown>, trailer_len: number): void {
+    this.lib.lrtc_key_provider_set_sif_trailer(this.handle, trailer, trailer_len);
+  }
+
+}
+
+export class LayerController {
+  private readonly handle: LayerControllerHandle;
+  private readonly lib: ReturnType<typeof loadLibrary>;
+
+  constructor(lib: ReturnType<typeof loadLibrary>) {
+    this.lib = lib;
+    // Note: no create function found in IDL — provide handle externally
+    this.handle = null as unknown as LayerControllerHandle;
+  }
+
+  dispose(): void {
+    this.lib.lrtc_layer_controller_release(this.handle);
+  }
+
+  [Symbol.dispose](): void {
+    this.dispose();
+  }
+
+  getLevel(): number {
+    return this.lib.lrtc_layer_controller_get_level(this.handle);
+  }
+
+  getMaxLevel(): number {
+    return this.lib.lrtc_layer_controller_get_max_level(this.handle);
+  }
+
 }
 
 export class MediaConstraints {
@@ -1016,6 +1528,10 @@ export class PeerConnection {
     return this.lib.lrtc_peer_connection_add_ice_candidate_ex(this.handle, sdp_mid, sdp_mline_index, candidate);
   }
 
+  addIceCandidates(sdp_mids: string, sdp_mline_indexes: ref.Pointer<unknown>, candidates: string, count: number, out_applied: ref.Pointer<unknown>): number {
+    return this.lib.lrtc_peer_connection_add_ice_candidates(this.handle, sdp_mids, sdp_mline_indexes, candidates, count, out_applied);
+  }
+
   addStream(stream: MediaStreamHandle): boolean {
     return this.lib.lrtc_peer_connection_add_stream(this.handle, stream);
   }
@@ -1048,6 +1564,26 @@ export class PeerConnection {
     this.lib.lrtc_peer_connection_close(this.handle);
   }
 
+  connectLoopback(answerer: PeerConnectionHandle, success: unknown, failure: unknown, user_data: ref.Pointer<unknown>): void {
+    this.lib.lrtc_peer_connection_connect_loopback(this.handle, answerer, success, failure, user_data);
+  }
+
+  copyLocalDescription(buffer: string, buffer_len: number): number {
+    return this.lib.lrtc_peer_connection_copy_local_description(this.handle, buffer, buffer_len);
+  }
+
+  copyLocalDescriptionType(buffer: string, buffer_len: number): number {
+    return this.lib.lrtc_peer_connection_copy_local_description_type(this.handle, buffer, buffer_len);
+  }
+
+  copyRemoteDescription(buffer: string, buffer_len: number): number {
+    return this.lib.lrtc_peer_connection_copy_remote_description(this.handle, buffer, buffer_len);
+  }
+
+  copyRemoteDescriptionType(buffer: string, buffer_len: number): number {
+    return this.lib.lrtc_peer_connection_copy_remote_description_type(this.handle, buffer, buffer_len);
+  }
+
   createAnswer(success: unknown, failure: unknown, user_data: ref.Pointer<unknown>, constraints: MediaConstraintsHandle): void {
     this.lib.lrtc_peer_connection_create_answer(this.handle, success, failure, user_data, constraints);
   }
@@ -1056,10 +1592,18 @@ export class PeerConnection {
     return this.lib.lrtc_peer_connection_create_data_channel(this.handle, label, ordered, reliable, max_retransmit_time, max_retransmits, protocol, negotiated, id);
   }
 
+  createLayerController(sender: RtpSenderHandle, options: ref.Pointer<unknown>, callback: unknown, user_data: ref.Pointer<unknown>): LayerControllerHandle {
+    return this.lib.lrtc_peer_connection_create_layer_controller(this.handle, sender, options, callback, user_data);
+  }
+
   createOffer(success: unknown, failure: unknown, user_data: ref.Pointer<unknown>, constraints: MediaConstraintsHandle): void {
     this.lib.lrtc_peer_connection_create_offer(this.handle, success, failure, user_data, constraints);
   }
 
+  createTemplatedOffer(session_template: SessionTemplateHandle, success: unknown, failure: unknown, user_data: ref.Pointer<unknown>, constraints: MediaConstraintsHandle): void {
+    this.lib.lrtc_peer_connection_create_templated_offer(this.handle, session_template, success, failure, user_data, constraints);
+  }
+
   getLocalDescription(success: unknown, failure: unknown, user_data: ref.Pointer<unknown>): void {
     this.lib.lrtc_peer_connection_get_local_description(this.handle, success, failure, user_data);
   }
@@ -1072,6 +1616,10 @@ export class PeerConnection {
     this.lib.lrtc_peer_connection_get_receiver_stats(this.handle, receiver, success, failure, user_data);
   }
 
+  getReceivers(out_receivers: ref.Pointer<unknown>, capacity: number): number {
+    return this.lib.lrtc_peer_connection_get_receivers(this.handle, out_receivers, capacity);
+  }
+
   getRemoteDescription(success: unknown, failure: unknown, user_data: ref.Pointer<unknown>): void {
     this.lib.lrtc_peer_connection_get_remote_description(this.handle, success, failure, user_data);
   }
@@ -1084,6 +1632,10 @@ export class PeerConnection {
     this.lib.lrtc_peer_connection_get_sender_stats(this.handle, sender, success, failure, user_data);
   }
 
+  getSenders(out_senders: ref.Pointer<unknown>, capacity: number): number {
+    return this.lib.lrtc_peer_connection_get_senders(this.handle, out_senders, capacity);
+  }
+
   getStats(success: unknown, failure: unknown, user_data: ref.Pointer<unknown>): void {
     this.lib.lrtc_peer_connection_get_stats(this.handle, success, failure, user_data);
   }
@@ -1092,6 +1644,10 @@ export class PeerConnection {
     return this.lib.lrtc_peer_connection_get_transceiver(this.handle, index);
   }
 
+  getTransceivers(out_transceivers: ref.Pointer<unknown>, capacity: number): number {
+    return this.lib.lrtc_peer_connection_get_transceivers(this.handle, out_transceivers, capacity);
+  }
+
   receiverCount(): number {
     return this.lib.lrtc_peer_connection_receiver_count(this.handle);
   }
@@ -1112,6 +1668,10 @@ export class PeerConnection {
     return this.lib.lrtc_peer_connection_sender_count(this.handle);
   }
 
+  setBandwidthObserver(interval_ms: number, callback: unknown, user_data: ref.Pointer<unknown>): void {
+    this.lib.lrtc_peer_connection_set_bandwidth_observer(this.handle, interval_ms, callback, user_data);
+  }
+
   setCallbacks(callbacks: ref.Pointer<unknown>, user_data: ref.Pointer<unknown>): void {
     this.lib.lrtc_peer_connection_set_callbacks(this.handle, callbacks, user_data);
   }
@@ -1120,6 +1680,10 @@ export class PeerConnection {
     return this.lib.lrtc_peer_connection_set_codec_preferences(this.handle, media_type, mime_types, mime_type_count);
   }
 
+  setIceCandidateBatching(window_ms: number, callback: unknown, user_data: ref.Pointer<unknown>): void {
+    this.lib.lrtc_peer_connection_set_ice_candidate_batching(this.handle, window_ms, callback, user_data);
+  }
+
   setLocalDescription(sdp: string, type: string, success: unknown, failure: unknown, user_data: ref.Pointer<unknown>): void {
     this.lib.lrtc_peer_connection_set_local_description(this.handle, sdp, type, success, failure, user_data);
   }
@@ -1164,6 +1728,10 @@ export class RtpReceiver {
     return this.lib.lrtc_rtp_receiver_get_audio_track(this.handle);
   }
 
+  getDecodeStats(out_stats: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_rtp_receiver_get_decode_stats(this.handle, out_stats);
+  }
+
   getDegradationPreference(): number {
     return this.lib.lrtc_rtp_receiver_get_degradation_preference(this.handle);
   }
@@ -1208,6 +1776,22 @@ export class RtpReceiver {
     return this.lib.lrtc_rtp_receiver_get_video_track(this.handle);
   }
 
+  requestKeyFrame(): unknown {
+    return this.lib.lrtc_rtp_receiver_request_key_frame(this.handle);
+  }
+
+  setDecodeOnDemand(enabled: boolean): unknown {
+    return this.lib.lrtc_rtp_receiver_set_decode_on_demand(this.handle, enabled);
+  }
+
+  setEncodedFrameRecorder(recorder: EncodedFrameRecorderHandle): unknown {
+    return this.lib.lrtc_rtp_receiver_set_encoded_frame_recorder(this.handle, recorder);
+  }
+
+  setEncodedFrameSink(sink: EncodedFrameSinkHandle): unknown {
+    return this.lib.lrtc_rtp_receiver_set_encoded_frame_sink(this.handle, sink);
+  }
+
   setJitterBufferMinDelay(delay_seconds: number): number {
     return this.lib.lrtc_rtp_receiver_set_jitter_buffer_min_delay(this.handle, delay_seconds);
   }
@@ -1220,6 +1804,10 @@ export class RtpReceiver {
     return this.lib.lrtc_rtp_receiver_stream_id_count(this.handle);
   }
 
+  lrtcFrameCryptorCreateForReceiver(participant_id: string, algorithm: number, key_provider: KeyProviderHandle): FrameCryptorHandle {
+    return this.lib.lrtc_frame_cryptor_create_for_receiver(this.handle, participant_id, algorithm, key_provider);
+  }
+
 }
 
 export class RtpSender {
@@ -1304,6 +1892,18 @@ export class RtpSender {
     return this.lib.lrtc_rtp_sender_replace_video_track(this.handle, track);
   }
 
+  sendEncodedAudio(mime_type: string, data: ref.Pointer<unknown>, size: number, rtp_timestamp: number): unknown {
+    return this.lib.lrtc_rtp_sender_send_encoded_audio(this.handle, mime_type, data, size, rtp_timestamp);
+  }
+
+  sendEncodedFrame(frame: EncodedFrameHandle): unknown {
+    return this.lib.lrtc_rtp_sender_send_encoded_frame(this.handle, frame);
+  }
+
+  setEncodedFrameInput(enabled: boolean): unknown {
+    return this.lib.lrtc_rtp_sender_set_encoded_frame_input(this.handle, enabled);
+  }
+
   setEncodingParameters(settings: ref.Pointer<unknown>): number {
     return this.lib.lrtc_rtp_sender_set_encoding_parameters(this.handle, settings);
   }
@@ -1312,6 +1912,10 @@ export class RtpSender {
     return this.lib.lrtc_rtp_sender_set_encoding_parameters_at(this.handle, index, settings);
   }
 
+  setEncodings(settings: ref.Pointer<unknown>, count: number, degradation_preference: number): unknown {
+    return this.lib.lrtc_rtp_sender_set_encodings(this.handle, settings, count, degradation_preference);
+  }
+
   setStreamIds(stream_ids: string, stream_id_count: number): number {
     return this.lib.lrtc_rtp_sender_set_stream_ids(this.handle, stream_ids, stream_id_count);
   }
@@ -1320,6 +1924,10 @@ export class RtpSender {
     return this.lib.lrtc_rtp_sender_stream_id_count(this.handle);
   }
 
+  lrtcFrameCryptorCreateForSender(participant_id: string, algorithm: number, key_provider: KeyProviderHandle): FrameCryptorHandle {
+    return this.lib.lrtc_frame_cryptor_create_for_sender(this.handle, participant_id, algorithm, key_provider);
+  }
+
 }
 
 export class RtpTransceiver {
@@ -1390,6 +1998,33 @@ export class RtpTransceiver {
 
 }
 
+export class SessionTemplate {
+  private readonly handle: SessionTemplateHandle;
+  private readonly lib: ReturnType<typeof loadLibrary>;
+
+  constructor(lib: ReturnType<typeof loadLibrary>) {
+    this.lib = lib;
+    this.handle = this.lib.lrtc_session_template_create();
+  }
+
+  dispose(): void {
+    this.lib.lrtc_session_template_release(this.handle);
+  }
+
+  [Symbol.dispose](): void {
+    this.dispose();
+  }
+
+  getStats(out_stats: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_session_template_get_stats(this.handle, out_stats);
+  }
+
+  reset(): void {
+    this.lib.lrtc_session_template_reset(this.handle);
+  }
+
+}
+
 export class VideoCapturer {
   private readonly handle: VideoCapturerHandle;
   private readonly lib: ReturnType<typeof loadLibrary>;
@@ -1416,10 +2051,18 @@ export class VideoCapturer {
     return this.lib.lrtc_video_capturer_start(this.handle);
   }
 
+  startAsync(callback: unknown, user_data: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_video_capturer_start_async(this.handle, callback, user_data);
+  }
+
   stop(): void {
     this.lib.lrtc_video_capturer_stop(this.handle);
   }
 
+  stopAsync(callback: unknown, user_data: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_video_capturer_stop_async(this.handle, callback, user_data);
+  }
+
 }
 
 export class VideoDevice {
@@ -1444,6 +2087,10 @@ export class VideoDevice {
     return this.lib.lrtc_video_device_create_capturer(this.handle, name, index, width, height, target_fps);
   }
 
+  createCapturerAsync(name: string, index: number, width: number, height: number, target_fps: number, callback: unknown, user_data: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_video_device_create_capturer_async(this.handle, name, index, width, height, target_fps, callback, user_data);
+  }
+
   getDeviceName(index: number, name: string, name_length: number, unique_id: string, unique_id_length: number): number {
     return this.lib.lrtc_video_device_get_device_name(this.handle, index, name, name_length, unique_id, unique_id_length);
   }
@@ -1488,6 +2135,10 @@ export class VideoFrame {
     return this.lib.lrtc_video_frame_data_y(this.handle);
   }
 
+  format(): number {
+    return this.lib.lrtc_video_frame_format(this.handle);
+  }
+
   height(): number {
     return this.lib.lrtc_video_frame_height(this.handle);
   }
@@ -1551,6 +2202,30 @@ export class VideoSource {
     this.dispose();
   }
 
+  droppedCount(): number {
+    return this.lib.lrtc_video_source_dropped_count(this.handle);
+  }
+
+  pushArgb(data: ref.Pointer<unknown>, stride: number, width: number, height: number, format: number, timestamp_us: number, release: unknown, user_data: ref.Pointer<unknown>): number {
+    return this.lib.lrtc_video_source_push_argb(this.handle, data, stride, width, height, format, timestamp_us, release, user_data);
+  }
+
+  pushEncoded(data: ref.Pointer<unknown>, size: number, width: number, height: number, key_frame: boolean, timestamp_us: number): number {
+    return this.lib.lrtc_video_source_push_encoded(this.handle, data, size, width, height, key_frame, timestamp_us);
+  }
+
+  pushI420(data_y: ref.Pointer<unknown>, stride_y: number, data_u: ref.Pointer<unknown>, stride_u: number, data_v: ref.Pointer<unknown>, stride_v: number, width: number, height: number, timestamp_us: number, release: unknown, user_data: ref.Pointer<unknown>): number {
+    return this.lib.lrtc_video_source_push_i420(this.handle, data_y, stride_y, data_u, stride_u, data_v, stride_v, width, height, timestamp_us, release, user_data);
+  }
+
+  pushNv12(data_y: ref.Pointer<unknown>, stride_y: number, data_uv: ref.Pointer<unknown>, stride_uv: number, width: number, height: number, timestamp_us: number, release: unknown, user_data: ref.Pointer<unknown>): number {
+    return this.lib.lrtc_video_source_push_nv12(this.handle, data_y, stride_y, data_uv, stride_uv, width, height, timestamp_us, release, user_data);
+  }
+
+  setKeyFrameRequestCallback(callback: unknown, user_data: ref.Pointer<unknown>): unknown {
+    return this.lib.lrtc_video_source_set_key_frame_request_callback(this.handle, callback, user_data);
+  }
+
 }
 
 export class VideoTrack {
@@ -43,6 +43,18 @@ class LumenRtcBridgeRuntime {
   LUMENRTC_BRIDGE_API static scoped_refptr<RTCPeerConnectionFactory>
   CreateRTCPeerConnectionFactory();
 
+  /**
+   * @brief Creates a new WebRTC PeerConnectionFactory that may run on shared
+   * worker and network threads.
+   *
+   * @param options Thread placement, see RTCFactoryThreadOptions.
+   * @return The new factory, or nullptr if |options| asks to share the
+   * threads of a factory that is not initialized or if the pool could not
+   * start its threads.
+   */
+  LUMENRTC_BRIDGE_API static scoped_refptr<RTCPeerConnectionFactory>
+  CreateRTCPeerConnectionFactory(const RTCFactoryThreadOptions& options);
+
   /**
    * @brief Terminates the WebRTC PeerConnectionFactory and threads.
    *
@@ -28,6 +28,11 @@ class RTCDesktopCapturer : public RefCountInterface {
    */
   enum CaptureState { CS_RUNNING, CS_STOPPED, CS_FAILED };
 
+  /**
+   * @brief Completion callback of StartAsync().
+   */
+  typedef fixed_size_function<void(CaptureState state)> OnStarted;
+
  public:
   /**
    * @brief Registers the given observer for desktop capture events.
@@ -71,6 +76,36 @@ class RTCDesktopCapturer : public RefCountInterface {
    */
   virtual void Stop() = 0;
 
+  /**
+   * @brief Non-blocking Start(uint32_t).
+   *
+   * Runs Start() on the signaling thread, which also invokes @p callback and
+   * the observer; do not block in either.
+   *
+   * @param fps The desired frame rate.
+   * @param callback Receives the capture state after the attempt.
+   */
+  virtual void StartAsync(uint32_t fps, OnStarted callback) = 0;
+
+  /**
+   * @brief Non-blocking Start() of a capture region.
+   *
+   * @param fps The desired frame rate.
+   * @param x The left-most pixel coordinate of the capture region.
+   * @param y The top-most pixel coordinate of the capture region.
+   * @param w The width of the capture region.
+   * @param h The height of the capture region.
+   * @param callback Receives the capture state after the attempt.
+   */
+  virtual void StartAsync(uint32_t fps, uint32_t x, uint32_t y, uint32_t w,
+                          uint32_t h, OnStarted callback) = 0;
+
+  /**
+   * @brief Non-blocking Stop(); @p callback runs on the signaling thread
+   *        once the observer was notified.
+   */
+  virtual void StopAsync(OnCaptureStopped callback) = 0;
+
   /**
    * @brief Checks if desktop capture is currently running.
    *
@@ -86,6 +121,14 @@ class RTCDesktopCapturer : public RefCountInterface {
    */
   virtual scoped_refptr<MediaSource> source() = 0;
 
+  /**
+   * @brief Reports the scheduling of the capture thread.
+   *
+   * @return The affinity and priority the capture thread runs with after the
+   *         factory's capture RTCThreadTuning was applied.
+   */
+  virtual RTCThreadReport GetThreadReport() = 0;
+
   /**
    * @brief Destroys the RTCDesktopCapturer object.
    */
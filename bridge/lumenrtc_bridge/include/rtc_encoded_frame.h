@@ -0,0 +1,76 @@
+#ifndef LUMENRTC_BRIDGE_RTC_ENCODED_FRAME_HXX
+#define LUMENRTC_BRIDGE_RTC_ENCODED_FRAME_HXX
+
+#include "base/refcount.h"
+#include "base/scoped_ref_ptr.h"
+#include "rtc_types.h"
+
+namespace lumenrtc_bridge {
+
+/**
+ * A received frame between depacketization and decoding; see
+ * RTCRtpReceiver::SetEncodedFrameObserver(). data() is the receiver's own
+ * buffer, valid while a reference is held, and is shared rather than copied
+ * by RTCRtpSender::SendEncodedFrame(). When the last reference goes the
+ * frame continues to the receiver's decoder, so it should not be held for
+ * longer than it takes to forward it.
+ */
+class RTCEncodedFrame : public RefCountInterface {
+ public:
+  virtual RTCMediaType media_type() const = 0;
+
+  virtual const uint8_t* data() const = 0;
+
+  virtual size_t size() const = 0;
+
+  virtual uint32_t rtp_timestamp() const = 0;
+
+  virtual uint32_t ssrc() const = 0;
+
+  /** Payload type on the receiving connection. */
+  virtual uint8_t payload_type() const = 0;
+
+  /** For example "video/VP8" or "audio/opus". */
+  virtual const string mime_type() const = 0;
+
+  /** Always false for audio. */
+  virtual bool is_key_frame() const = 0;
+
+  /** Zero for audio. */
+  virtual int width() const = 0;
+
+  virtual int height() const = 0;
+
+  /**
+   * Frame id from the dependency descriptor or generic frame descriptor;
+   * -1 when the stream carries neither.
+   */
+  virtual int64_t frame_id() const = 0;
+
+  /** Zero for a stream without layers. */
+  virtual int spatial_index() const = 0;
+
+  virtual int temporal_index() const = 0;
+
+  /** Ids of the frames this one references. */
+  virtual const vector<int64_t> dependencies() const = 0;
+
+ protected:
+  virtual ~RTCEncodedFrame() {}
+};
+
+class RTCEncodedFrameObserver {
+ public:
+  /**
+   * Runs on a WebRTC thread for every frame the receiver assembles. Frames
+   * of one receiver arrive in order and one at a time.
+   */
+  virtual void OnEncodedFrame(scoped_refptr<RTCEncodedFrame> frame) = 0;
+
+ protected:
+  virtual ~RTCEncodedFrameObserver() {}
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // LUMENRTC_BRIDGE_RTC_ENCODED_FRAME_HXX
@@ -0,0 +1,44 @@
+#ifndef LUMENRTC_BRIDGE_RTC_ENCODED_FRAME_RECORDER_HXX
+#define LUMENRTC_BRIDGE_RTC_ENCODED_FRAME_RECORDER_HXX
+
+#include "rtc_encoded_frame.h"
+#include "rtc_types.h"
+
+namespace lumenrtc_bridge {
+
+/**
+ * Writes the encoded frames of one receiver to a file without decoding
+ * them; attach it with RTCRtpReceiver::SetEncodedFrameObserver(). The
+ * container follows the MIME type of the first frame: IVF for VP8, VP9 and
+ * AV1, an Annex B elementary stream for H.264 and H.265, and Ogg for Opus.
+ * Frames of other codecs, or of a codec other than the first, are dropped.
+ * Video is recorded from the first key frame on; call
+ * RTCRtpReceiver::RequestKeyFrame() to start sooner.
+ *
+ * Frames are copied and released at once, so the receiver's decoder is not
+ * held up; a dedicated thread does the formatting and file I/O. Gaps in an
+ * Opus stream are filled with lost-packet markers so its duration stays
+ * that of the call.
+ */
+class RTCEncodedFrameRecorder : public RTCEncodedFrameObserver,
+                                public RefCountInterface {
+ public:
+  /** Creates or truncates |path|; null if it cannot be opened. */
+  LUMENRTC_BRIDGE_API static scoped_refptr<RTCEncodedFrameRecorder> Create(
+      const string path, const RTCEncodedFrameRecorderOptions& options);
+
+  /**
+   * Writes the queued frames, completes the container and closes the file.
+   * Frames arriving later are dropped. Returns false if a write failed.
+   */
+  virtual bool Stop() = 0;
+
+  virtual RTCEncodedFrameRecorderStats GetStats() = 0;
+
+ protected:
+  virtual ~RTCEncodedFrameRecorder() {}
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // LUMENRTC_BRIDGE_RTC_ENCODED_FRAME_RECORDER_HXX
@@ -16,6 +16,8 @@ enum class Algorithm {
 
 #define DEFAULT_KEYRING_SIZE 16
 #define MAX_KEYRING_SIZE 255
+// Bytes an encrypted frame or payload is larger than the plain one.
+#define FRAME_CRYPTO_OVERHEAD 30
 
 struct KeyProviderOptions {
   bool shared_key;
@@ -36,12 +38,19 @@ struct KeyProviderOptions {
   KeyProviderOptions(KeyProviderOptions& copy)
       : shared_key(copy.shared_key),
         ratchet_salt(copy.ratchet_salt),
+        uncrypted_magic_bytes(copy.uncrypted_magic_bytes),
         ratchet_window_size(copy.ratchet_window_size),
         failure_tolerance(copy.failure_tolerance),
-        key_ring_size(copy.key_ring_size) {}
+        key_ring_size(copy.key_ring_size),
+        discard_frame_when_cryptor_not_ready(
+            copy.discard_frame_when_cryptor_not_ready) {}
 };
 
 /// Shared secret key for frame encryption.
+///
+/// Keys are stretched with PBKDF2 when set, which takes tens of
+/// milliseconds; frames never wait for it. Indexes run from 0 to
+/// key_ring_size - 1.
 class KeyProvider : public RefCountInterface {
  public:
   LUMENRTC_BRIDGE_API static scoped_refptr<KeyProvider> Create(KeyProviderOptions*);
@@ -64,6 +73,19 @@ class KeyProvider : public RefCountInterface {
 
   virtual void SetSifTrailer(vector<uint8_t> trailer) = 0;
 
+  /// Encrypts |size| bytes at |data| in place with key |key_index| of
+  /// |participant_id|, laid out like a frame, for payloads sent outside RTP
+  /// such as data channel messages. |capacity| is at least |size| +
+  /// FRAME_CRYPTO_OVERHEAD. Returns the encrypted size, or -1.
+  virtual int EncryptPayload(const string participant_id, int key_index,
+                             uint8_t* data, size_t size,
+                             size_t capacity) = 0;
+
+  /// Decrypts in place what EncryptPayload() made. Returns the plain size,
+  /// or -1.
+  virtual int DecryptPayload(const string participant_id, uint8_t* data,
+                             size_t size) = 0;
+
  protected:
   virtual ~KeyProvider() {}
 };
@@ -87,7 +109,8 @@ class RTCFrameCryptorObserver : public RefCountInterface {
   virtual ~RTCFrameCryptorObserver() {}
 };
 
-/// Frame encryption/decryption.
+/// Frame encryption/decryption with AES-GCM, in place and without locks
+/// shared with other cryptors. Frames pass unchanged until enabled.
 ///
 class RTCFrameCryptor : public RefCountInterface {
  public:
@@ -99,6 +122,7 @@ class RTCFrameCryptor : public RefCountInterface {
 
   /// Set the key index for the sender or receiver.
   /// If the key index is not set, the key index will be set to 0.
+  /// Returns false if |index| is outside the key provider's key_ring_size.
   virtual bool SetKeyIndex(int index) = 0;
 
   /// Get the key index for the sender or receiver.
@@ -115,6 +139,8 @@ class RTCFrameCryptor : public RefCountInterface {
   virtual ~RTCFrameCryptor() {}
 };
 
+/// Only Algorithm::kAesGcm is supported; the factory returns null for
+/// anything else.
 class FrameCryptorFactory {
  public:
   /// Create a frame cyrptor for [RTCRtpSender].
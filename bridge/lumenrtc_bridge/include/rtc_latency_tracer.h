@@ -0,0 +1,103 @@
+#ifndef LUMENRTC_BRIDGE_RTC_LATENCY_TRACER_HXX
+#define LUMENRTC_BRIDGE_RTC_LATENCY_TRACER_HXX
+
+#include "rtc_types.h"
+
+namespace lumenrtc_bridge {
+
+/**
+ * Pipeline stages that record latency events. Values are part of the C ABI
+ * (lrtc_trace_stage).
+ */
+enum class RTCTraceStage : uint32_t {
+  kDesktopCapture = 0,  // RTCDesktopCapturerImpl::OnCaptureResult
+  kDesktopConvert,      // Desktop frame to I420 conversion.
+  kCaptureAdapt,        // VideoCapturer::OnFrame (adapt and broadcast).
+  kVideoSinkAdapter,    // VideoSinkAdapter::OnFrame (wrap and fan out).
+  kVideoSinkCallback,   // Application video sink callback.
+  kAudioSinkAdapter,    // Audio track sink fan out.
+  kAudioSinkCallback,   // Application audio sink callback.
+};
+
+struct RTCTraceEvent {
+  // Monotonic, same timebase as webrtc::TimeMicros().
+  int64_t start_us = 0;
+  int64_t duration_us = 0;
+  // Media timestamp of the frame, so stages of one frame can be correlated.
+  // Zero for audio.
+  int64_t frame_timestamp_us = 0;
+  // Object that recorded the event (capturer, adapter or sink).
+  uint64_t source_id = 0;
+  uint32_t thread_id = 0;
+  RTCTraceStage stage = RTCTraceStage::kDesktopCapture;
+};
+
+/**
+ * Process-wide buffer of pipeline latency events. Recording is a single
+ * relaxed atomic load while tracing is stopped. Each recording thread writes
+ * to a ring of its own without locking; Drain() merges the rings by start
+ * time. When a thread's ring is full, its new events are dropped and
+ * counted.
+ */
+class RTCLatencyTracer {
+ public:
+  // |capacity| events per recording thread.
+  LUMENRTC_BRIDGE_API static bool Start(size_t capacity);
+  LUMENRTC_BRIDGE_API static void Stop();
+  LUMENRTC_BRIDGE_API static bool IsEnabled();
+
+  /**
+   * Moves up to |capacity| of the oldest buffered events into |events| and
+   * returns how many were written.
+   */
+  LUMENRTC_BRIDGE_API static size_t Drain(RTCTraceEvent* events,
+                                          size_t capacity);
+
+  // Events dropped because a thread's ring was full since the last Start().
+  LUMENRTC_BRIDGE_API static uint64_t DroppedCount();
+
+  LUMENRTC_BRIDGE_API static void Record(RTCTraceStage stage,
+                                         const void* source,
+                                         int64_t start_us,
+                                         int64_t frame_timestamp_us);
+
+  LUMENRTC_BRIDGE_API static int64_t NowUs();
+};
+
+/**
+ * Records the lifetime of the enclosing scope as one event.
+ */
+class RTCTraceScope {
+ public:
+  RTCTraceScope(RTCTraceStage stage, const void* source,
+                int64_t frame_timestamp_us = 0)
+      : stage_(stage),
+        source_(source),
+        frame_timestamp_us_(frame_timestamp_us),
+        start_us_(RTCLatencyTracer::IsEnabled() ? RTCLatencyTracer::NowUs()
+                                                : -1) {}
+
+  ~RTCTraceScope() {
+    if (start_us_ >= 0) {
+      RTCLatencyTracer::Record(stage_, source_, start_us_,
+                               frame_timestamp_us_);
+    }
+  }
+
+  void set_frame_timestamp_us(int64_t timestamp_us) {
+    frame_timestamp_us_ = timestamp_us;
+  }
+
+  RTCTraceScope(const RTCTraceScope&) = delete;
+  RTCTraceScope& operator=(const RTCTraceScope&) = delete;
+
+ private:
+  const RTCTraceStage stage_;
+  const void* const source_;
+  int64_t frame_timestamp_us_;
+  const int64_t start_us_;
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // LUMENRTC_BRIDGE_RTC_LATENCY_TRACER_HXX
@@ -0,0 +1,52 @@
+#ifndef LUMENRTC_BRIDGE_RTC_LAYER_CONTROLLER_HXX
+#define LUMENRTC_BRIDGE_RTC_LAYER_CONTROLLER_HXX
+
+#include "rtc_types.h"
+
+namespace lumenrtc_bridge {
+
+class RTCLayerControllerObserver {
+ public:
+  /** Runs on the signaling thread after the change was applied. */
+  virtual void OnLayerDecision(const RTCLayerDecision& decision) = 0;
+
+ protected:
+  virtual ~RTCLayerControllerObserver() {}
+};
+
+/**
+ * Switches the layers of a video sender as its connection's conditions
+ * change; see RTCPeerConnection::CreateLayerController(). Every interval it
+ * weighs the bandwidth estimate, the loss and RTT history and whether the
+ * encoder is CPU limited. A simulcast sender gains or loses its layers from
+ * the top (the least scaled down); a sender with a single SVC encoding has
+ * the spatial layer count of its scalability mode changed. Layers are
+ * dropped once a problem has lasted RTCLayerControllerOptions::down_hold_ms,
+ * and added back once the next layer has fit for up_hold_ms. All changes of
+ * one decision are applied with a single SetParameters() call.
+ */
+class RTCLayerController : public RefCountInterface {
+ public:
+  /** Active simulcast layers, or spatial layers of the SVC encoding. */
+  virtual int level() = 0;
+
+  /** Highest level, from the encodings the controller was created with. */
+  virtual int max_level() = 0;
+
+  virtual void RegisterObserver(RTCLayerControllerObserver* observer) = 0;
+
+  virtual void UnregisterObserver() = 0;
+
+  /**
+   * Stops deciding; the layers are left as they are. The observer is not
+   * called once this returns.
+   */
+  virtual void Stop() = 0;
+
+ protected:
+  virtual ~RTCLayerController() {}
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // LUMENRTC_BRIDGE_RTC_LAYER_CONTROLLER_HXX
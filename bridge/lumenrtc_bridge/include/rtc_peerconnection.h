@@ -4,11 +4,13 @@
 #include "rtc_audio_track.h"
 #include "rtc_data_channel.h"
 #include "rtc_ice_candidate.h"
+#include "rtc_layer_controller.h"
 #include "rtc_media_stream.h"
 #include "rtc_mediaconstraints.h"
 #include "rtc_rtp_sender.h"
 #include "rtc_rtp_transceiver.h"
 #include "rtc_session_description.h"
+#include "rtc_session_template.h"
 #include "rtc_video_source.h"
 #include "rtc_video_track.h"
 
@@ -150,6 +152,24 @@ class RTCPeerConnectionObserver {
 
   virtual void OnIceCandidate(scoped_refptr<RTCIceCandidate> candidate) = 0;
 
+  /**
+   * Local candidates coalesced by RTCPeerConnection::SetIceCandidateBatchWindow(),
+   * in gathering order. The default reports them one by one.
+   */
+  virtual void OnIceCandidates(
+      vector<scoped_refptr<RTCIceCandidate>> candidates) {
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      OnIceCandidate(candidates[i]);
+    }
+  }
+
+  /**
+   * Latest estimate, at most once per
+   * RTCPeerConnection::SetBandwidthEstimateInterval(). Runs on the signaling
+   * thread.
+   */
+  virtual void OnBandwidthEstimate(const RTCBandwidthEstimate& /*estimate*/) {}
+
   virtual void OnAddStream(scoped_refptr<RTCMediaStream> stream) = 0;
 
   virtual void OnRemoveStream(scoped_refptr<RTCMediaStream> stream) = 0;
@@ -189,6 +209,18 @@ class RTCPeerConnection : public RefCountInterface {
                             OnSdpCreateFailure failure,
                             scoped_refptr<RTCMediaConstraints> constraints) = 0;
 
+  /**
+   * Creates an offer and sets it as the local description without the SDP
+   * round trip of CreateOffer() followed by SetLocalDescription(). The text
+   * passed to |success|, once the description is set, is rendered from
+   * |session_template| when the offer has its shape; a null template
+   * serializes the offer in full.
+   */
+  virtual void CreateTemplatedOffer(
+      scoped_refptr<RTCSessionTemplate> session_template,
+      OnSdpCreateSuccess success, OnSdpCreateFailure failure,
+      scoped_refptr<RTCMediaConstraints> constraints) = 0;
+
   virtual void RestartIce() = 0;
 
   virtual void Close() = 0;
@@ -207,9 +239,66 @@ class RTCPeerConnection : public RefCountInterface {
   virtual void GetRemoteDescription(OnGetSdpSuccess success,
                                     OnGetSdpFailure failure) = 0;
 
+  /**
+   * Reads the current local or remote description without callbacks;
+   * returns false when none is set. The text is kept until the description
+   * changes, so a size query followed by a copy serializes it once.
+   */
+  virtual bool CopyLocalDescription(string& sdp, string& type) = 0;
+
+  virtual bool CopyRemoteDescription(string& sdp, string& type) = 0;
+
   virtual bool AddCandidate(const string mid, int mid_mline_index,
                             const string candiate) = 0;
 
+  /**
+   * Applies a burst of remote candidates with one hop to the signaling
+   * thread. Returns how many were applied; null or rejected candidates are
+   * skipped. If |applied| is not null it receives one entry per candidate,
+   * 1 if it was applied and 0 if not.
+   */
+  virtual int AddCandidates(
+      const vector<scoped_refptr<RTCIceCandidate>> candidates,
+      int* applied) = 0;
+
+  /**
+   * Holds local candidates for up to |window_ms| after the first one and
+   * reports them with a single RTCPeerConnectionObserver::OnIceCandidates()
+   * call. Pending candidates are flushed when gathering completes. 0, the
+   * default, reports each candidate as it is gathered.
+   */
+  virtual void SetIceCandidateBatchWindow(int window_ms) = 0;
+
+  /**
+   * Reports changes of the send-side bandwidth estimate, the video encoder
+   * targets and the RTT through RTCPeerConnectionObserver::OnBandwidthEstimate(),
+   * with at least |interval_ms| between reports. Changes within an interval
+   * are folded into the next report. 0, the default, stops reporting.
+   */
+  virtual void SetBandwidthEstimateInterval(int interval_ms) = 0;
+
+  /**
+   * Starts switching the layers of video |sender| on this connection's
+   * bandwidth estimate, loss, RTT and CPU state. Null if |sender| is not a
+   * video sender of this connection, or has a single encoding without a
+   * multi-layer scalability mode. The controller runs until
+   * RTCLayerController::Stop() or its last reference is released.
+   */
+  virtual scoped_refptr<RTCLayerController> CreateLayerController(
+      scoped_refptr<RTCRtpSender> sender,
+      const RTCLayerControllerOptions& options) = 0;
+
+  /**
+   * Negotiates this connection as offerer with |answerer| inside the process:
+   * descriptions and ICE candidates are handed over directly instead of
+   * going through the application's signaling channel. |success| runs once
+   * both descriptions are applied; candidates keep flowing until either side
+   * is closed. Candidates are still reported to the observers.
+   */
+  virtual void ConnectLoopback(scoped_refptr<RTCPeerConnection> answerer,
+                               OnSetSdpSuccess success,
+                               OnSetSdpFailure failure) = 0;
+
   virtual void RegisterRTCPeerConnectionObserver(
       RTCPeerConnectionObserver* observer) = 0;
 
@@ -254,6 +343,17 @@ class RTCPeerConnection : public RefCountInterface {
 
   virtual vector<scoped_refptr<RTCRtpReceiver>> receivers() = 0;
 
+  /**
+   * Entry |index| of the list the last senders(), transceivers() or
+   * receivers() call returned, without asking the signaling thread again;
+   * null past its end. For count-then-index enumeration.
+   */
+  virtual scoped_refptr<RTCRtpSender> sender_at(uint32_t index) = 0;
+
+  virtual scoped_refptr<RTCRtpTransceiver> transceiver_at(uint32_t index) = 0;
+
+  virtual scoped_refptr<RTCRtpReceiver> receiver_at(uint32_t index) = 0;
+
   virtual RTCSignalingState signaling_state() = 0;
 
   virtual RTCIceConnectionState ice_connection_state() = 0;
@@ -20,6 +20,18 @@ class RTCAudioProcessing;
 class RTCVideoDevice;
 class RTCRtpCapabilities;
 
+typedef fixed_size_function<void(scoped_refptr<RTCAudioSource> source)>
+    OnAudioSourceCreated;
+
+typedef fixed_size_function<void(scoped_refptr<RTCVideoSource> source)>
+    OnVideoSourceCreated;
+
+typedef fixed_size_function<void(scoped_refptr<RTCAudioTrack> track)>
+    OnAudioTrackCreated;
+
+typedef fixed_size_function<void(scoped_refptr<RTCVideoTrack> track)>
+    OnVideoTrackCreated;
+
 class RTCPeerConnectionFactory : public RefCountInterface {
  public:
   virtual bool Initialize() = 0;
@@ -30,6 +42,16 @@ class RTCPeerConnectionFactory : public RefCountInterface {
       const RTCConfiguration& configuration,
       scoped_refptr<RTCMediaConstraints> constraints) = 0;
 
+  /**
+   * Same as Create(), but a factory with several network threads places the
+   * connection by hashing |network_key| instead of round-robin, so
+   * connections sharing a key also share a network thread.
+   */
+  virtual scoped_refptr<RTCPeerConnection> Create(
+      const RTCConfiguration& configuration,
+      scoped_refptr<RTCMediaConstraints> constraints,
+      const string network_key) = 0;
+
   virtual void Delete(scoped_refptr<RTCPeerConnection> peerconnection) = 0;
 
   virtual scoped_refptr<RTCAudioDevice> GetAudioDevice() = 0;
@@ -49,6 +71,20 @@ class RTCPeerConnectionFactory : public RefCountInterface {
   virtual scoped_refptr<RTCVideoSource> CreateVideoSource(
       scoped_refptr<RTCVideoCapturer> capturer, const string video_source_label,
       scoped_refptr<RTCMediaConstraints> constraints) = 0;
+
+  virtual scoped_refptr<RTCVideoSource> CreateCustomVideoSource(
+      const string video_source_label, bool is_screencast) = 0;
+
+  /**
+   * Creates a source fed with already encoded access units through
+   * RTCVideoSource::PushEncodedFrame(). Senders of its track send the units
+   * as they are, without running their encoder. |codec| is "H264" or "VP8";
+   * returns null for any other codec. The sender must negotiate the same
+   * codec, e.g. through RTCRtpTransceiver::SetCodecPreferences(); units of
+   * another codec are dropped.
+   */
+  virtual scoped_refptr<RTCVideoSource> CreateEncodedVideoSource(
+      const string video_source_label, const string codec) = 0;
 #ifdef RTC_DESKTOP_DEVICE
   virtual scoped_refptr<RTCVideoSource> CreateDesktopSource(
       scoped_refptr<RTCDesktopCapturer> capturer,
@@ -64,11 +100,180 @@ class RTCPeerConnectionFactory : public RefCountInterface {
   virtual scoped_refptr<RTCMediaStream> CreateStream(
       const string stream_id) = 0;
 
+  /**
+   * Non-blocking variants of the Create*Source() and Create*Track() calls
+   * above. Each queues the call on the signaling thread, which hands the
+   * result, or null on failure, to |callback|; do not block in it. Return
+   * false before Initialize(), in which case |callback| is not invoked.
+   * Requests still queued when the factory terminates complete with null.
+   */
+  virtual bool CreateAudioSourceAsync(const string audio_source_label,
+                                      RTCAudioSource::SourceType source_type,
+                                      RTCAudioOptions options,
+                                      OnAudioSourceCreated callback) = 0;
+
+  virtual bool CreateVideoSourceAsync(
+      scoped_refptr<RTCVideoCapturer> capturer, const string video_source_label,
+      scoped_refptr<RTCMediaConstraints> constraints,
+      OnVideoSourceCreated callback) = 0;
+#ifdef RTC_DESKTOP_DEVICE
+  virtual bool CreateDesktopSourceAsync(
+      scoped_refptr<RTCDesktopCapturer> capturer,
+      const string video_source_label,
+      scoped_refptr<RTCMediaConstraints> constraints,
+      OnVideoSourceCreated callback) = 0;
+#endif
+  virtual bool CreateAudioTrackAsync(scoped_refptr<RTCAudioSource> source,
+                                     const string track_id,
+                                     OnAudioTrackCreated callback) = 0;
+
+  virtual bool CreateVideoTrackAsync(scoped_refptr<RTCVideoSource> source,
+                                     const string track_id,
+                                     OnVideoTrackCreated callback) = 0;
+
   virtual scoped_refptr<RTCRtpCapabilities> GetRtpSenderCapabilities(
       RTCMediaType media_type) = 0;
 
   virtual scoped_refptr<RTCRtpCapabilities> GetRtpReceiverCapabilities(
       RTCMediaType media_type) = 0;
+
+  /**
+   * Reports the scheduling a factory thread runs with. |index| selects the
+   * network thread and is ignored for other roles. Capture threads belong to
+   * desktop capturers; see RTCDesktopCapturer::GetThreadReport(). Returns
+   * false for an unknown role or index, or before Initialize().
+   */
+  virtual bool GetThreadReport(RTCThreadRole role, size_t index,
+                               RTCThreadReport* report) = 0;
+
+  /**
+   * Changes the conditions of the virtual network this factory runs on.
+   * Returns false if the factory was not created with a virtual network,
+   * before Initialize(), or if a value is out of range. |enabled| is ignored.
+   */
+  virtual bool SetVirtualNetworkConditions(
+      const RTCVirtualNetworkOptions& options) = 0;
+
+  /**
+   * Keeps |size| peer connections built from |configuration| warm so
+   * CreatePooled() can hand one out without waiting for certificate
+   * generation and ICE gathering. The pool refills on the signaling thread
+   * as connections are taken. An ice_candidate_pool_size below 1 is raised
+   * to 1. Reconfiguring closes the warm connections built for the previous
+   * configuration; a size of 0 disables the pool. Returns false before
+   * Initialize() or if |size| is negative or above 64.
+   */
+  virtual bool ConfigurePeerConnectionPool(
+      const RTCConfiguration& configuration,
+      scoped_refptr<RTCMediaConstraints> constraints, int size) = 0;
+
+  /**
+   * Takes a warm connection from the pool, or creates one from the pool's
+   * configuration if none is ready. Returns null while the pool is disabled.
+   * Register an observer before driving the connection; events raised while
+   * it was warming are not replayed.
+   */
+  virtual scoped_refptr<RTCPeerConnection> CreatePooled() = 0;
+
+  virtual RTCPeerConnectionPoolStats GetPeerConnectionPoolStats() = 0;
+
+  /**
+   * Shares ECDSA DTLS certificates between the connections this factory
+   * creates instead of generating one per connection. Applies to
+   * connections created afterwards. Returns false if |options| is out of
+   * range.
+   */
+  virtual bool ConfigureCertificateCache(
+      const RTCCertificateCacheOptions& options) = 0;
+
+  /**
+   * Adds a certificate from a PEM bundle holding its private key and
+   * certificate. Imported certificates take the place of generated ones and
+   * are never rotated. Enables the cache if it was off.
+   */
+  virtual bool ImportCertificate(const string pem) = 0;
+
+  /**
+   * The certificate new connections get first, as a PEM bundle (private key,
+   * then certificate). Empty while the cache is disabled.
+   */
+  virtual string ExportCertificate() = 0;
+
+  /**
+   * Gathers host candidates for connections created afterwards on one UDP
+   * port per network thread, demultiplexed by remote address and ICE ufrag,
+   * instead of a port per connection. Only IPv4 host candidates are
+   * gathered, so use it on a server with a reachable address and with
+   * max-bundle. Disabling keeps ports bound until their connections close.
+   * Returns false before Initialize(), on a virtual network, or if a port is
+   * out of range or taken.
+   */
+  virtual bool ConfigureUdpMux(const RTCUdpMuxOptions& options) = 0;
+
+  virtual RTCUdpMuxStats GetUdpMuxStats() = 0;
+};
+
+/**
+ * Selects where a factory's worker and network threads come from. The
+ * signaling thread, which runs application callbacks, is always owned by the
+ * factory so one tenant cannot stall another.
+ */
+struct RTCFactoryThreadOptions {
+  enum class Mode {
+    /** The factory starts its own worker, signaling and network threads. */
+    kDedicated,
+    /** Reuse the worker and network threads of |share_with|. */
+    kShared,
+    /** Take worker and network threads from the process-wide pool. */
+    kPooled,
+  };
+
+  Mode mode = Mode::kDedicated;
+
+  /** Initialized factory whose threads are reused in kShared mode. */
+  scoped_refptr<RTCPeerConnectionFactory> share_with;
+
+  /**
+   * Maximum number of worker/network thread pairs in the pool; 0 sizes it
+   * from the core count. Only the first pooled factory sets the size.
+   */
+  int pool_size = 0;
+
+  /**
+   * Network threads started for a new thread group (kDedicated, or the first
+   * pooled factory landing on a new group). Each network thread backs its own
+   * WebRTC factory shard; peer connections are spread across them.
+   * Device audio is serviced by the first shard only: connections on other
+   * shards send custom audio sources and receive video normally, but do not
+   * capture from or play out to the audio device.
+   */
+  int network_thread_count = 1;
+
+  /**
+   * When >= 0, network thread i is pinned to CPU (network_first_cpu + i)
+   * modulo the processor count. Pinning is best effort.
+   */
+  int network_first_cpu = -1;
+
+  /**
+   * Per-role scheduling. Worker and network tunings take effect only for
+   * threads this factory's group starts; a factory reusing running threads
+   * (kShared, or a pooled group that already exists) reports what the
+   * starting factory applied.
+   */
+  RTCThreadTuning worker_thread;
+  RTCThreadTuning signaling_thread;
+  RTCThreadTuning network_thread;
+  RTCThreadTuning capture_thread;
+
+  /**
+   * Runs the network thread on a simulated network for deterministic
+   * loopback tests and benchmarks. Forces a single network thread. A kPooled
+   * factory with a virtual network gets a dedicated group instead, so it
+   * never joins real tenants. Requires the bridge to be built with
+   * lumenrtc_bridge_virtual_network; otherwise creation fails.
+   */
+  RTCVirtualNetworkOptions virtual_network;
 };
 
 }  // namespace lumenrtc_bridge
@@ -3,6 +3,7 @@
 
 #include "base/refcount.h"
 #include "base/scoped_ref_ptr.h"
+#include "rtc_encoded_frame.h"
 #include "rtc_rtp_parameters.h"
 #include "rtc_types.h"
 
@@ -45,6 +46,35 @@ class RTCRtpReceiver : public RefCountInterface {
 
   virtual void SetJitterBufferMinimumDelay(double delay_seconds) = 0;
 
+  /**
+   * Hands every encoded frame to |observer| before it is decoded; null
+   * detaches. Once the observer is detached, or while it holds no
+   * reference, frames go to the decoder as before. Must not be called from
+   * the observer.
+   */
+  virtual void SetEncodedFrameObserver(RTCEncodedFrameObserver* observer) = 0;
+
+  /**
+   * Detaches |observer| from every receiver it is set on and returns once no
+   * call to it is running. Call before destroying an observer that may still
+   * be attached; not from the observer itself.
+   */
+  LUMENRTC_BRIDGE_API static void DetachEncodedFrameObserver(
+      RTCEncodedFrameObserver* observer);
+
+  /** Asks the remote sender for a key frame. False for audio receivers. */
+  virtual bool RequestKeyFrame() = 0;
+
+  /**
+   * While enabled, video frames received while no renderer is attached to
+   * the receiver's track are not decoded. Attaching a renderer requests a
+   * key frame, and decoding resumes with it. Frames still reach an encoded
+   * frame observer as received. False for audio receivers.
+   */
+  virtual bool SetDecodeOnDemand(bool enabled) = 0;
+
+  virtual RTCDecodeOnDemandStats GetDecodeOnDemandStats() = 0;
+
   // virtual Vector<RtpSource> GetSources() const = 0;
 
   // virtual void SetFrameDecryptor(
@@ -3,6 +3,7 @@
 
 #include "base/refcount.h"
 #include "base/scoped_ref_ptr.h"
+#include "rtc_encoded_frame.h"
 #include "rtc_rtp_parameters.h"
 #include "rtc_types.h"
 
@@ -39,6 +40,36 @@ class RTCRtpSender : public RefCountInterface {
       const scoped_refptr<RTCRtpParameters> parameters) = 0;
 
   virtual scoped_refptr<RTCDtmfSender> dtmf_sender() const = 0;
+
+  /**
+   * While enabled the sender packetizes frames passed to SendEncodedFrame()
+   * and drops what its own encoder produces. The sender's negotiated
+   * payload types are read here, so enable it after negotiation and again
+   * after a renegotiation that changes codecs. Enabling fails while the
+   * sender has no negotiated codec.
+   */
+  virtual bool SetEncodedFrameInput(bool enabled) = 0;
+
+  /**
+   * Sends |frame|, taken from a receiver, without decoding or re-encoding
+   * it. The payload is shared with the receiver. False if input is not
+   * enabled, the frame's codec was not negotiated on this sender or the
+   * sender is not sending yet. A simulcast sender sends on its first
+   * stream. Safe to call from an RTCEncodedFrameObserver.
+   */
+  virtual bool SendEncodedFrame(scoped_refptr<RTCEncodedFrame> frame) = 0;
+
+  /**
+   * Sends one encoded audio frame, e.g. an Opus packet read from a file,
+   * through an audio sender with encoded frame input enabled. |mime_type|
+   * picks the negotiated payload type, e.g. "audio/opus". |rtp_timestamp|
+   * advances in the codec's clock rate. The data is copied before the call
+   * returns. WebRTC only starts an audio sender that has a track, so attach
+   * one; its own audio is dropped. False under the same conditions as
+   * SendEncodedFrame().
+   */
+  virtual bool SendEncodedAudio(const string mime_type, const uint8_t* data,
+                                size_t size, uint32_t rtp_timestamp) = 0;
 };
 
 }  // namespace lumenrtc_bridge
@@ -0,0 +1,35 @@
+#ifndef LUMENRTC_BRIDGE_RTC_SESSION_TEMPLATE_HXX
+#define LUMENRTC_BRIDGE_RTC_SESSION_TEMPLATE_HXX
+
+#include "rtc_types.h"
+
+namespace lumenrtc_bridge {
+
+/**
+ * Offer text shared by identically configured peer connections; see
+ * RTCPeerConnection::CreateTemplatedOffer(). The first offer is serialized
+ * in full and cached. Later offers with the same shape (m-sections, codecs,
+ * header extensions, transports, simulcast layers and rids, streams and SSRC
+ * counts) are rendered by
+ * substituting the per-connection fields into the cached text: session id
+ * and version, ICE ufrag and password, DTLS fingerprint, SSRCs, CNAME and
+ * msid. An offer of another shape, or one already carrying candidates, is
+ * serialized in full; a different shape replaces the cached text.
+ * Safe to share across threads and factories.
+ */
+class RTCSessionTemplate : public RefCountInterface {
+ public:
+  LUMENRTC_BRIDGE_API static scoped_refptr<RTCSessionTemplate> Create();
+
+  virtual RTCSessionTemplateStats GetStats() = 0;
+
+  /** Drops the cached text; the next offer is serialized in full. */
+  virtual void Reset() = 0;
+
+ protected:
+  virtual ~RTCSessionTemplate() {}
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // LUMENRTC_BRIDGE_RTC_SESSION_TEMPLATE_HXX
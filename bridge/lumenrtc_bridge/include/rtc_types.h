@@ -121,6 +121,283 @@ struct RTCAudioOptions {
   bool highpass_filter = false;
 };
 
+enum class RTCThreadRole { kWorker, kSignaling, kNetwork, kCapture };
+
+/**
+ * Scheduling applied to a bridge thread as soon as it starts, before it runs
+ * any WebRTC work.
+ */
+struct RTCThreadTuning {
+  /** Bit i allows CPU i; 0 leaves affinity untouched. */
+  uint64_t cpu_mask = 0;
+
+  /** Applies |nice| (-20..19 on POSIX, mapped to a priority class on Windows). */
+  bool set_nice = false;
+  int nice = 0;
+
+  /** Switches the thread to SCHED_FIFO (time-critical priority on Windows). */
+  bool realtime = false;
+  int realtime_priority = 1;
+};
+
+/**
+ * What a thread actually runs with after RTCThreadTuning was applied, read
+ * back from the OS.
+ */
+struct RTCThreadReport {
+  enum Failure {
+    kAffinityFailed = 1 << 0,
+    kNiceFailed = 1 << 1,
+    kRealtimeFailed = 1 << 2,
+  };
+
+  /** False if the thread has not started yet. */
+  bool applied = false;
+  uint64_t cpu_mask = 0;
+  int nice = 0;
+  bool realtime = false;
+  int priority = 0;
+  /** Bitwise OR of Failure for requested settings the OS rejected. */
+  int failures = 0;
+};
+
+/**
+ * Simulated network that replaces the sockets of a factory's network thread.
+ * Connections on it only reach other connections on the same virtual network
+ * (the same factory, or factories sharing its threads), never the host.
+ * Conditions apply to every packet crossing the network.
+ */
+struct RTCVirtualNetworkOptions {
+  bool enabled = false;
+  /** One way delay added to each packet. */
+  int latency_ms = 0;
+  /** Standard deviation of the delay, normally distributed. */
+  int jitter_ms = 0;
+  /** Probability in [0, 1] that a packet is dropped. */
+  double loss_rate = 0.0;
+  /** Send rate cap per socket; 0 is unlimited. */
+  int64_t bandwidth_bps = 0;
+};
+
+/**
+ * DTLS certificate reuse across a factory's peer connections; see
+ * RTCPeerConnectionFactory::ConfigureCertificateCache().
+ */
+struct RTCCertificateCacheOptions {
+  bool enabled = false;
+  /** Certificates handed out round-robin, 1 to 16. */
+  int size = 1;
+  /**
+   * Age after which a certificate is replaced on its next use; 0 keeps it
+   * until it expires.
+   */
+  int64_t rotation_interval_ms = 0;
+};
+
+/**
+ * Counters of a factory's warm peer connection pool; see
+ * RTCPeerConnectionFactory::ConfigurePeerConnectionPool().
+ */
+struct RTCPeerConnectionPoolStats {
+  /** CreatePooled() calls served by a warm connection. */
+  uint64_t hits = 0;
+  /** CreatePooled() calls that found the pool empty and created one. */
+  uint64_t misses = 0;
+  /** Connections warmed in the background. */
+  uint64_t created = 0;
+  /** Warm connections closed because the pool was reconfigured. */
+  uint64_t discarded = 0;
+  /** Warm connections ready to hand out. */
+  uint32_t available = 0;
+  uint32_t target_size = 0;
+};
+
+/**
+ * Single UDP port shared by a factory's peer connections; see
+ * RTCPeerConnectionFactory::ConfigureUdpMux().
+ */
+struct RTCUdpMuxOptions {
+  bool enabled = false;
+  /** Port of the first network thread; network thread i listens on port + i. */
+  int port = 0;
+};
+
+/** Counters summed over a factory's UDP mux ports. */
+struct RTCUdpMuxStats {
+  /** Packets routed by their remote address. */
+  uint64_t address_hits = 0;
+  /** STUN packets routed by the ufrag in their USERNAME attribute. */
+  uint64_t ufrag_hits = 0;
+  /** Packets dropped because neither matched a connection. */
+  uint64_t misses = 0;
+  /** Connection sockets currently sharing the ports. */
+  uint32_t endpoints = 0;
+  /** Bound mux ports. */
+  uint32_t ports = 0;
+};
+
+/** Counters of an RTCSessionTemplate. */
+struct RTCSessionTemplateStats {
+  /** Offers rendered from the cached text. */
+  uint64_t hits = 0;
+  /** Offers serialized in full because none was cached or the shape differed. */
+  uint64_t misses = 0;
+  /** Length of the cached offer; 0 if none. */
+  uint32_t template_size = 0;
+};
+
+/**
+ * Send-side bandwidth estimate of a connection; see
+ * RTCPeerConnection::SetBandwidthEstimateInterval().
+ */
+struct RTCBandwidthEstimate {
+  /** Rate the congestion controller lets the connection send at. */
+  int target_bitrate_bps = 0;
+  /** Smoothed target rate, slow to follow short dips. */
+  int stable_target_bitrate_bps = 0;
+  /** Bitrate handed to the video encoders, summed over |encoder_count|. */
+  int encoder_target_bitrate_bps = 0;
+  int encoder_count = 0;
+  /** Round trip time seen by the congestion controller. */
+  double rtt_ms = 0;
+  /** Fraction of packets reported lost, 0 to 1. */
+  double loss_rate = 0;
+};
+
+/**
+ * Tuning of an RTCLayerController; see
+ * RTCPeerConnection::CreateLayerController().
+ */
+struct RTCLayerControllerOptions {
+  /** Period of the decisions. */
+  int interval_ms = 250;
+  /** Target rate over the cost of the next layer needed to add it. */
+  double up_headroom = 1.25;
+  /** Target rate over the cost of the active layers below which one is dropped. */
+  double down_headroom = 1.0;
+  /** How long a layer must fit before it is added. */
+  int up_hold_ms = 3000;
+  /** How long bandwidth, loss or RTT must be bad before a layer is dropped. */
+  int down_hold_ms = 500;
+  /** Mean loss rate over the last two seconds that drops a layer. */
+  double max_loss_rate = 0.1;
+  /** RTT rise over the lowest RTT of the last ten seconds that drops a layer. */
+  int max_rtt_increase_ms = 150;
+  /** Ignores the encoder reporting that it is CPU limited. */
+  bool ignore_cpu = false;
+};
+
+/** Why an RTCLayerController changed the active layers. */
+enum class RTCLayerDecisionReason {
+  kBandwidth = 0,
+  kLoss = 1,
+  kRtt = 2,
+  kCpu = 3,
+};
+
+/** A layer change applied by an RTCLayerController. */
+struct RTCLayerDecision {
+  RTCLayerDecisionReason reason = RTCLayerDecisionReason::kBandwidth;
+  /** Active simulcast layers, or spatial layers of an SVC encoding. */
+  int previous_level = 0;
+  int level = 0;
+  /** Inputs the decision was made on. */
+  int target_bitrate_bps = 0;
+  double loss_rate = 0;
+  double rtt_ms = 0;
+};
+
+/** When an RTCEncodedFrameRecorder forces its file to disk. */
+enum class RTCRecordingSyncPolicy {
+  /** Write-back is left to the OS; Stop() only flushes. */
+  kNone = 0,
+  /** Once, when the recording is stopped. */
+  kOnStop = 1,
+  /** sync_interval_ms after data was written, and when stopped. */
+  kInterval = 2,
+};
+
+/**
+ * Tuning of an RTCEncodedFrameRecorder; see
+ * RTCEncodedFrameRecorder::Create().
+ */
+struct RTCEncodedFrameRecorderOptions {
+  /**
+   * Frames waiting for the writer thread beyond this many bytes are
+   * dropped; video then skips to the next key frame.
+   */
+  size_t max_queued_bytes = 8 * 1024 * 1024;
+  /** Size of the buffer in front of the file. */
+  size_t write_buffer_bytes = 256 * 1024;
+  RTCRecordingSyncPolicy sync_policy = RTCRecordingSyncPolicy::kOnStop;
+  int sync_interval_ms = 1000;
+};
+
+/** Counters of an RTCEncodedFrameRecorder. */
+struct RTCEncodedFrameRecorderStats {
+  uint64_t frames_written = 0;
+  /** File size, containers included. */
+  uint64_t bytes_written = 0;
+  /**
+   * Frames not recorded: the queue was full, a video delta came before a
+   * key frame, or the codec differed from the first frame's.
+   */
+  uint64_t frames_dropped = 0;
+  /** Bytes of frames waiting for the writer thread. */
+  uint64_t queued_bytes = 0;
+  /** A write or sync failed; nothing is written after it. */
+  bool write_failed = false;
+};
+
+/** Memory layout of a video frame's pixels. */
+enum class RTCVideoPixelFormat {
+  /**
+   * Whatever the source produced. A frame in a layout not listed here is
+   * delivered as I420.
+   */
+  kNative,
+  kI420,
+  /** A Y plane followed by an interleaved UV plane. */
+  kNV12,
+  /** 32-bit pixels in libyuv's naming: B, G, R, A in memory. */
+  kARGB,
+  /** A, R, G, B in memory. */
+  kBGRA,
+};
+
+/**
+ * What a video renderer needs; see RTCVideoTrack::AddRenderer(). Zero
+ * fields mean no limit.
+ */
+struct RTCVideoSinkWants {
+  /** Frames larger than this are scaled down, keeping their aspect. */
+  int max_pixel_count = 0;
+  int max_framerate = 0;
+  /** Delivered widths and heights are multiples of this. */
+  int resolution_alignment = 1;
+  /** Layout frames are converted to before delivery. */
+  RTCVideoPixelFormat format = RTCVideoPixelFormat::kNative;
+  /**
+   * Exact size frames are scaled to, aspect aside; overrides
+   * |max_pixel_count| and |resolution_alignment| when both are set.
+   */
+  int width = 0;
+  int height = 0;
+};
+
+/** See RTCRtpReceiver::SetDecodeOnDemand(). */
+struct RTCDecodeOnDemandStats {
+  /** Video frames handed to the decoder. */
+  uint64_t frames_decoded = 0;
+  /** Video frames received while no renderer was attached, not decoded. */
+  uint64_t frames_skipped = 0;
+  /** Key frames asked for to resume decoding. */
+  uint64_t key_frame_requests = 0;
+  bool enabled = false;
+  /** Frames are being skipped, or decoding waits for a key frame. */
+  bool skipping = false;
+};
+
 }  // namespace lumenrtc_bridge
 
 #endif  // LUMENRTC_BRIDGE_RTC_TYPES_HXX
@@ -5,6 +5,10 @@
 
 namespace lumenrtc_bridge {
 
+typedef fixed_size_function<void(bool started)> OnCaptureStarted;
+
+typedef fixed_size_function<void()> OnCaptureStopped;
+
 class RTCVideoCapturer : public RefCountInterface {
  public:
   virtual ~RTCVideoCapturer() {}
@@ -14,8 +18,17 @@ class RTCVideoCapturer : public RefCountInterface {
   virtual bool CaptureStarted() = 0;
 
   virtual void StopCapture() = 0;
+
+  // Non-blocking StartCapture()/StopCapture(). The work runs on the worker
+  // thread, which also invokes |callback|; do not block in it.
+  virtual void StartCaptureAsync(OnCaptureStarted callback) = 0;
+
+  virtual void StopCaptureAsync(OnCaptureStopped callback) = 0;
 };
 
+typedef fixed_size_function<void(scoped_refptr<RTCVideoCapturer> capturer)>
+    OnVideoCapturerCreated;
+
 class RTCVideoDevice : public RefCountInterface {
  public:
   virtual uint32_t NumberOfDevices() = 0;
@@ -32,6 +45,13 @@ class RTCVideoDevice : public RefCountInterface {
                                                  size_t height,
                                                  size_t target_fps) = 0;
 
+  // Non-blocking Create(). Opens the device on the worker thread and hands
+  // the capturer, or null on failure, to |callback| there. Returns false if
+  // the request could not be queued; |callback| is not invoked then.
+  virtual bool CreateAsync(const char* name, uint32_t index, size_t width,
+                           size_t height, size_t target_fps,
+                           OnVideoCapturerCreated callback) = 0;
+
  protected:
   virtual ~RTCVideoDevice() {}
 };
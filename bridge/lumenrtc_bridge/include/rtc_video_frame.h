@@ -33,6 +33,14 @@ class RTCVideoFrame : public RefCountInterface {
 
   virtual VideoRotation rotation() = 0;
 
+  // Capture time on the webrtc::TimeMicros() clock.
+  virtual int64_t timestamp_us() const = 0;
+
+  // Layout of the planes below. I420 has Y, U and V; NV12 has Y and UV in
+  // the U plane; kARGB and kBGRA have all pixels in the Y plane. kNative
+  // frames have no readable planes.
+  virtual RTCVideoPixelFormat format() const = 0;
+
   // Returns pointer to the pixel data for a given plane. The memory is owned by
   // the VideoFrameBuffer object and must not be freed by the caller.
   virtual const uint8_t* DataY() const = 0;
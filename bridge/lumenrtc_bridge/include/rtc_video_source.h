@@ -5,9 +5,93 @@
 
 namespace lumenrtc_bridge {
 
+/**
+ * The RTCVideoSource class represents the origin of a video track. Sources
+ * created from a capturer pull frames from a device; custom sources are fed
+ * by the application through the Push*Frame methods, and encoded sources
+ * through PushEncodedFrame.
+ */
 class RTCVideoSource : public RefCountInterface {
  public:
-  ~RTCVideoSource() {}
+  enum SourceType { kCapturer, kCustom, kEncoded };
+
+  /**
+   * Invoked exactly once when the source no longer references a pushed
+   * buffer. It may run before Push*Frame returns (when the frame is copied,
+   * scaled or dropped) or later on a WebRTC thread (zero-copy path).
+   */
+  typedef void (*FrameReleaseCallback)(void* user_data);
+
+  /**
+   * Invoked on a WebRTC thread when a receiver of an encoded source's track
+   * needs a key frame.
+   */
+  typedef void (*KeyFrameRequestCallback)(void* user_data);
+
+ public:
+  virtual SourceType GetSourceType() const = 0;
+
+  /**
+   * Pushes an I420 frame into a custom source. When |release| is set and the
+   * frame needs no adaptation, the planes are wrapped without copying and
+   * must stay valid until |release| is invoked. Returns false (and never
+   * invokes |release|) if the source is not custom, the arguments are
+   * invalid or the frame was dropped for lack of a pooled buffer; see
+   * dropped_frames().
+   */
+  virtual bool PushI420Frame(const uint8_t* data_y, int stride_y,
+                             const uint8_t* data_u, int stride_u,
+                             const uint8_t* data_v, int stride_v, int width,
+                             int height, int64_t timestamp_us,
+                             FrameReleaseCallback release,
+                             void* user_data) = 0;
+
+  /**
+   * Same as PushI420Frame for NV12 (interleaved UV) input.
+   */
+  virtual bool PushNV12Frame(const uint8_t* data_y, int stride_y,
+                             const uint8_t* data_uv, int stride_uv, int width,
+                             int height, int64_t timestamp_us,
+                             FrameReleaseCallback release,
+                             void* user_data) = 0;
+
+  /**
+   * Pushes a packed 32-bit frame laid out as described by |type| (same
+   * values as RTCVideoFrame::Type). Packed input is always converted, so the
+   * buffer is released before this call returns.
+   */
+  virtual bool PushARGBFrame(const uint8_t* data, int stride, int width,
+                             int height, int type, int64_t timestamp_us,
+                             FrameReleaseCallback release,
+                             void* user_data) = 0;
+
+  /**
+   * Frames a custom source dropped because all of its pooled buffers were
+   * still held by the encoder or renderers. Always 0 for other sources.
+   */
+  virtual uint64_t dropped_frames() const = 0;
+
+  /**
+   * Pushes one encoded access unit into a source created with
+   * CreateEncodedVideoSource(). The data is copied before the call returns;
+   * H.264 units are Annex B byte streams. Senders skip delta units until
+   * the next key frame when a receiver has lost the stream. Returns false
+   * if the source is not encoded or the arguments are invalid.
+   */
+  virtual bool PushEncodedFrame(const uint8_t* data, size_t size, int width,
+                                int height, bool key_frame,
+                                int64_t timestamp_us) = 0;
+
+  /**
+   * Sets the callback an encoded source invokes when a key frame is needed;
+   * null clears it. Returns once a running call has finished. Returns false
+   * if the source is not encoded.
+   */
+  virtual bool SetKeyFrameRequestCallback(KeyFrameRequestCallback callback,
+                                          void* user_data) = 0;
+
+ protected:
+  virtual ~RTCVideoSource() {}
 };
 }  // namespace lumenrtc_bridge
 
@@ -13,6 +13,18 @@ class RTCVideoTrack : public RTCMediaTrack {
   virtual void AddRenderer(
       RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer) = 0;
 
+  /**
+   * Adds |renderer|, or updates its wants if already added. Frames are
+   * scaled down and thinned out for it natively; renderers wanting the same
+   * size share one scaled frame. The wants of all renderers also reach the
+   * track's source. A local source adapts to the most restrictive wants of
+   * all its sinks, which include the encoder of a track being sent, so a
+   * capped preview of a sent track caps what is sent as well.
+   */
+  virtual void AddRenderer(
+      RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer,
+      const RTCVideoSinkWants& wants) = 0;
+
   virtual void RemoveRenderer(
       RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer) = 0;
 
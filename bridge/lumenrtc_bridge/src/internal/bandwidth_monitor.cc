@@ -0,0 +1,239 @@
+#include "src/internal/bandwidth_monitor.h"
+
+#include <utility>
+
+#include "api/scoped_refptr.h"
+#include "api/video/video_bitrate_allocator.h"
+#include "rtc_base/checks.h"
+
+namespace lumenrtc_bridge {
+namespace {
+
+class MonitoredNetworkController : public webrtc::NetworkControllerInterface {
+ public:
+  MonitoredNetworkController(
+      std::unique_ptr<webrtc::NetworkControllerInterface> controller,
+      webrtc::scoped_refptr<BandwidthMonitor> monitor)
+      : controller_(std::move(controller)), monitor_(std::move(monitor)) {}
+
+  webrtc::NetworkControlUpdate OnNetworkAvailability(
+      webrtc::NetworkAvailability msg) override {
+    return Observe(controller_->OnNetworkAvailability(msg));
+  }
+  webrtc::NetworkControlUpdate OnNetworkRouteChange(
+      webrtc::NetworkRouteChange msg) override {
+    return Observe(controller_->OnNetworkRouteChange(msg));
+  }
+  webrtc::NetworkControlUpdate OnProcessInterval(
+      webrtc::ProcessInterval msg) override {
+    return Observe(controller_->OnProcessInterval(msg));
+  }
+  webrtc::NetworkControlUpdate OnRoundTripTimeUpdate(
+      webrtc::RoundTripTimeUpdate msg) override {
+    return Observe(controller_->OnRoundTripTimeUpdate(msg));
+  }
+  webrtc::NetworkControlUpdate OnSentPacket(webrtc::SentPacket msg) override {
+    return Observe(controller_->OnSentPacket(msg));
+  }
+  webrtc::NetworkControlUpdate OnReceivedPacket(
+      webrtc::ReceivedPacket msg) override {
+    return Observe(controller_->OnReceivedPacket(msg));
+  }
+  webrtc::NetworkControlUpdate OnStreamsConfig(
+      webrtc::StreamsConfig msg) override {
+    return Observe(controller_->OnStreamsConfig(msg));
+  }
+  webrtc::NetworkControlUpdate OnTargetRateConstraints(
+      webrtc::TargetRateConstraints msg) override {
+    return Observe(controller_->OnTargetRateConstraints(msg));
+  }
+  webrtc::NetworkControlUpdate OnTransportLossReport(
+      webrtc::TransportLossReport msg) override {
+    return Observe(controller_->OnTransportLossReport(msg));
+  }
+  webrtc::NetworkControlUpdate OnTransportPacketsFeedback(
+      webrtc::TransportPacketsFeedback msg) override {
+    return Observe(controller_->OnTransportPacketsFeedback(msg));
+  }
+  webrtc::NetworkControlUpdate OnNetworkStateEstimate(
+      webrtc::NetworkStateEstimate msg) override {
+    return Observe(controller_->OnNetworkStateEstimate(msg));
+  }
+
+ private:
+  webrtc::NetworkControlUpdate Observe(webrtc::NetworkControlUpdate update) {
+    if (update.target_rate) {
+      monitor_->OnTargetRate(*update.target_rate);
+    }
+    return update;
+  }
+
+  const std::unique_ptr<webrtc::NetworkControllerInterface> controller_;
+  const webrtc::scoped_refptr<BandwidthMonitor> monitor_;
+};
+
+class MonitoredNetworkControllerFactory
+    : public webrtc::NetworkControllerFactoryInterface {
+ public:
+  MonitoredNetworkControllerFactory(
+      std::unique_ptr<webrtc::NetworkControllerFactoryInterface> factory,
+      webrtc::scoped_refptr<BandwidthMonitor> monitor)
+      : factory_(std::move(factory)), monitor_(std::move(monitor)) {}
+
+  std::unique_ptr<webrtc::NetworkControllerInterface> Create(
+      webrtc::NetworkControllerConfig config) override {
+    return std::make_unique<MonitoredNetworkController>(
+        factory_->Create(config), monitor_);
+  }
+
+  webrtc::TimeDelta GetProcessInterval() const override {
+    return factory_->GetProcessInterval();
+  }
+
+ private:
+  const std::unique_ptr<webrtc::NetworkControllerFactoryInterface> factory_;
+  const webrtc::scoped_refptr<BandwidthMonitor> monitor_;
+};
+
+class MonitoredVideoBitrateAllocator : public webrtc::VideoBitrateAllocator {
+ public:
+  MonitoredVideoBitrateAllocator(
+      std::unique_ptr<webrtc::VideoBitrateAllocator> allocator,
+      webrtc::scoped_refptr<BandwidthMonitor> monitor)
+      : allocator_(std::move(allocator)), monitor_(std::move(monitor)) {}
+
+  ~MonitoredVideoBitrateAllocator() override {
+    monitor_->OnEncoderRemoved(this);
+  }
+
+  webrtc::VideoBitrateAllocation Allocate(
+      webrtc::VideoBitrateAllocationParameters parameters) override {
+    webrtc::VideoBitrateAllocation allocation =
+        allocator_->Allocate(parameters);
+    monitor_->OnEncoderTarget(this,
+                              static_cast<int>(allocation.get_sum_bps()));
+    return allocation;
+  }
+
+  void SetLegacyConferenceMode(bool mode) override {
+    allocator_->SetLegacyConferenceMode(mode);
+  }
+
+ private:
+  const std::unique_ptr<webrtc::VideoBitrateAllocator> allocator_;
+  const webrtc::scoped_refptr<BandwidthMonitor> monitor_;
+};
+
+class MonitoredVideoBitrateAllocatorFactory
+    : public webrtc::VideoBitrateAllocatorFactory {
+ public:
+  MonitoredVideoBitrateAllocatorFactory(
+      std::unique_ptr<webrtc::VideoBitrateAllocatorFactory> factory,
+      webrtc::scoped_refptr<BandwidthMonitor> monitor)
+      : factory_(std::move(factory)), monitor_(std::move(monitor)) {}
+
+  std::unique_ptr<webrtc::VideoBitrateAllocator> Create(
+      const webrtc::Environment& env,
+      const webrtc::VideoCodec& codec) override {
+    return std::make_unique<MonitoredVideoBitrateAllocator>(
+        factory_->Create(env, codec), monitor_);
+  }
+
+ private:
+  const std::unique_ptr<webrtc::VideoBitrateAllocatorFactory> factory_;
+  const webrtc::scoped_refptr<BandwidthMonitor> monitor_;
+};
+
+bool SameEstimate(const RTCBandwidthEstimate& a,
+                  const RTCBandwidthEstimate& b) {
+  return a.target_bitrate_bps == b.target_bitrate_bps &&
+         a.stable_target_bitrate_bps == b.stable_target_bitrate_bps &&
+         a.encoder_target_bitrate_bps == b.encoder_target_bitrate_bps &&
+         a.encoder_count == b.encoder_count && a.rtt_ms == b.rtt_ms &&
+         a.loss_rate == b.loss_rate;
+}
+
+}  // namespace
+
+BandwidthMonitor::BandwidthMonitor(std::function<void()> on_change)
+    : on_change_(std::move(on_change)) {}
+
+std::unique_ptr<webrtc::NetworkControllerFactoryInterface>
+BandwidthMonitor::WrapNetworkControllerFactory(
+    std::unique_ptr<webrtc::NetworkControllerFactoryInterface> factory) {
+  RTC_DCHECK(factory);
+  return std::make_unique<MonitoredNetworkControllerFactory>(
+      std::move(factory), webrtc::scoped_refptr<BandwidthMonitor>(this));
+}
+
+std::unique_ptr<webrtc::VideoBitrateAllocatorFactory>
+BandwidthMonitor::WrapVideoBitrateAllocatorFactory(
+    std::unique_ptr<webrtc::VideoBitrateAllocatorFactory> factory) {
+  RTC_DCHECK(factory);
+  return std::make_unique<MonitoredVideoBitrateAllocatorFactory>(
+      std::move(factory), webrtc::scoped_refptr<BandwidthMonitor>(this));
+}
+
+RTCBandwidthEstimate BandwidthMonitor::Estimate() {
+  webrtc::MutexLock lock(&mutex_);
+  return estimate_;
+}
+
+void BandwidthMonitor::Detach() {
+  webrtc::MutexLock lock(&mutex_);
+  on_change_ = nullptr;
+}
+
+void BandwidthMonitor::OnTargetRate(const webrtc::TargetTransferRate& rate) {
+  webrtc::MutexLock lock(&mutex_);
+  RTCBandwidthEstimate estimate = estimate_;
+  estimate.target_bitrate_bps = static_cast<int>(rate.target_rate.bps());
+  estimate.stable_target_bitrate_bps =
+      static_cast<int>(rate.stable_target_rate.bps());
+  if (rate.network_estimate.round_trip_time.IsFinite()) {
+    estimate.rtt_ms = rate.network_estimate.round_trip_time.ms<double>();
+  }
+  estimate.loss_rate = rate.network_estimate.loss_rate_ratio;
+  Update(estimate);
+}
+
+void BandwidthMonitor::OnEncoderTarget(const void* encoder, int bitrate_bps) {
+  webrtc::MutexLock lock(&mutex_);
+  auto it = encoder_targets_.find(encoder);
+  if (it != encoder_targets_.end() && it->second == bitrate_bps) {
+    return;
+  }
+  encoder_targets_[encoder] = bitrate_bps;
+  RTCBandwidthEstimate estimate = estimate_;
+  estimate.encoder_target_bitrate_bps = 0;
+  for (const auto& target : encoder_targets_) {
+    estimate.encoder_target_bitrate_bps += target.second;
+  }
+  estimate.encoder_count = static_cast<int>(encoder_targets_.size());
+  Update(estimate);
+}
+
+void BandwidthMonitor::OnEncoderRemoved(const void* encoder) {
+  webrtc::MutexLock lock(&mutex_);
+  auto it = encoder_targets_.find(encoder);
+  if (it == encoder_targets_.end()) {
+    return;
+  }
+  RTCBandwidthEstimate estimate = estimate_;
+  estimate.encoder_target_bitrate_bps -= it->second;
+  estimate.encoder_count -= 1;
+  encoder_targets_.erase(it);
+  Update(estimate);
+}
+
+void BandwidthMonitor::Update(const RTCBandwidthEstimate& estimate) {
+  if (SameEstimate(estimate, estimate_)) {
+    return;
+  }
+  estimate_ = estimate;
+  if (on_change_) {
+    on_change_();
+  }
+}
+
+}  // namespace lumenrtc_bridge
@@ -0,0 +1,58 @@
+#ifndef INTERNAL_BANDWIDTH_MONITOR_H_
+#define INTERNAL_BANDWIDTH_MONITOR_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+
+#include "api/ref_counted_base.h"
+#include "api/transport/network_control.h"
+#include "api/video/video_bitrate_allocator_factory.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_types.h"
+
+namespace lumenrtc_bridge {
+
+// Send-side estimate of one connection, taken from inside WebRTC rather than
+// from getStats(): the congestion controller and the video bitrate
+// allocators of the connection are wrapped and report every update here.
+//
+// Both wrappers hold a reference, so the monitor outlives whichever of the
+// connection and its call is destroyed last.
+class BandwidthMonitor : public webrtc::RefCountedBase {
+ public:
+  // |on_change| runs on a WebRTC thread, under the monitor's lock, whenever
+  // the estimate differs from the last one; it should only schedule work.
+  explicit BandwidthMonitor(std::function<void()> on_change);
+
+  std::unique_ptr<webrtc::NetworkControllerFactoryInterface>
+  WrapNetworkControllerFactory(
+      std::unique_ptr<webrtc::NetworkControllerFactoryInterface> factory);
+
+  std::unique_ptr<webrtc::VideoBitrateAllocatorFactory>
+  WrapVideoBitrateAllocatorFactory(
+      std::unique_ptr<webrtc::VideoBitrateAllocatorFactory> factory);
+
+  RTCBandwidthEstimate Estimate();
+
+  // Stops |on_change| calls; updates are still recorded.
+  void Detach();
+
+  void OnTargetRate(const webrtc::TargetTransferRate& rate);
+  void OnEncoderTarget(const void* encoder, int bitrate_bps);
+  void OnEncoderRemoved(const void* encoder);
+
+ private:
+  void Update(const RTCBandwidthEstimate& estimate)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  webrtc::Mutex mutex_;
+  std::function<void()> on_change_ RTC_GUARDED_BY(mutex_);
+  RTCBandwidthEstimate estimate_ RTC_GUARDED_BY(mutex_);
+  // Last allocation of each live video encoder.
+  std::map<const void*, int> encoder_targets_ RTC_GUARDED_BY(mutex_);
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // INTERNAL_BANDWIDTH_MONITOR_H_
@@ -0,0 +1,139 @@
+#include "src/internal/certificate_cache.h"
+
+#include <optional>
+
+#include "rtc_base/rtc_certificate_generator.h"
+#include "rtc_base/ssl_identity.h"
+#include "rtc_base/time_utils.h"
+
+namespace lumenrtc_bridge {
+
+namespace {
+
+constexpr char kBeginCertificate[] = "-----BEGIN CERTIFICATE-----";
+constexpr char kEndCertificate[] = "-----END CERTIFICATE-----";
+
+}  // namespace
+
+bool CertificateCache::Configure(const RTCCertificateCacheOptions& options) {
+  if (options.enabled &&
+      (options.size < 1 || options.size > kMaxSize ||
+       options.rotation_interval_ms < 0)) {
+    return false;
+  }
+  webrtc::MutexLock lock(&mutex_);
+  enabled_ = options.enabled;
+  rotation_interval_ms_ = options.rotation_interval_ms;
+  ++generation_;
+  slots_.clear();
+  if (enabled_) {
+    slots_.resize(static_cast<size_t>(options.size));
+  }
+  next_ = 0;
+  return true;
+}
+
+webrtc::scoped_refptr<webrtc::RTCCertificate> CertificateCache::Next() {
+  size_t index;
+  {
+    webrtc::MutexLock lock(&mutex_);
+    if (!enabled_) {
+      return nullptr;
+    }
+    if (!imported_.empty()) {
+      return imported_[next_++ % imported_.size()];
+    }
+    index = next_++ % slots_.size();
+  }
+  return Ensure(index);
+}
+
+webrtc::scoped_refptr<webrtc::RTCCertificate> CertificateCache::Ensure(
+    size_t index) {
+  const int64_t now_ms = webrtc::TimeMillis();
+  uint64_t generation;
+  {
+    webrtc::MutexLock lock(&mutex_);
+    if (index >= slots_.size()) {
+      return nullptr;
+    }
+    Slot& slot = slots_[index];
+    const bool stale =
+        !slot.certificate || slot.certificate->HasExpired(now_ms) ||
+        (rotation_interval_ms_ > 0 &&
+         now_ms - slot.created_ms >= rotation_interval_ms_);
+    if (!stale || slot.generating) {
+      return slot.certificate;
+    }
+    slot.generating = true;
+    generation = generation_;
+  }
+
+  // Key generation is the expensive part; keep it outside the lock so other
+  // slots keep serving.
+  webrtc::scoped_refptr<webrtc::RTCCertificate> certificate =
+      webrtc::RTCCertificateGenerator::GenerateCertificate(
+          webrtc::KeyParams::ECDSA(), std::nullopt);
+
+  webrtc::MutexLock lock(&mutex_);
+  if (generation != generation_ || index >= slots_.size()) {
+    return certificate;
+  }
+  Slot& slot = slots_[index];
+  slot.generating = false;
+  if (certificate) {
+    slot.certificate = certificate;
+    slot.created_ms = now_ms;
+  }
+  return slot.certificate;
+}
+
+bool CertificateCache::Import(const std::string& pem) {
+  const size_t begin = pem.find(kBeginCertificate);
+  const size_t end = pem.find(kEndCertificate, begin);
+  if (begin == std::string::npos || end == std::string::npos) {
+    return false;
+  }
+  const size_t cert_end = end + sizeof(kEndCertificate) - 1;
+  const std::string certificate_pem = pem.substr(begin, cert_end - begin);
+  const std::string private_key_pem =
+      pem.substr(0, begin) + pem.substr(cert_end);
+  webrtc::scoped_refptr<webrtc::RTCCertificate> certificate =
+      webrtc::RTCCertificate::FromPEM(
+          webrtc::RTCCertificatePEM(private_key_pem, certificate_pem));
+  if (!certificate) {
+    return false;
+  }
+
+  webrtc::MutexLock lock(&mutex_);
+  imported_.push_back(certificate);
+  if (!enabled_) {
+    enabled_ = true;
+    ++generation_;
+    slots_.assign(1, Slot());
+  }
+  return true;
+}
+
+std::string CertificateCache::Export() {
+  webrtc::scoped_refptr<webrtc::RTCCertificate> certificate;
+  {
+    webrtc::MutexLock lock(&mutex_);
+    if (!enabled_) {
+      return std::string();
+    }
+    if (!imported_.empty()) {
+      certificate = imported_.front();
+    }
+  }
+  if (!certificate) {
+    certificate = Ensure(0);
+  }
+  if (!certificate) {
+    return std::string();
+  }
+  webrtc::RTCCertificatePEM pem = certificate->ToPEM();
+  return pem.private_key() + pem.certificate();
+}
+
+}  // namespace lumenrtc_bridge
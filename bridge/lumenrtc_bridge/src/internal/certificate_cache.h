@@ -0,0 +1,66 @@
+#ifndef INTERNAL_CERTIFICATE_CACHE_H_
+#define INTERNAL_CERTIFICATE_CACHE_H_
+
+#include <string>
+#include <vector>
+
+#include "api/scoped_refptr.h"
+#include "rtc_base/rtc_certificate.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_types.h"
+
+namespace lumenrtc_bridge {
+
+// DTLS certificates shared by the peer connections of one factory, so a
+// reconnect storm does not generate one ECDSA key per connection.
+//
+// Generated certificates live in |size| slots handed out round-robin. A slot
+// is regenerated on first use after its rotation interval (or the
+// certificate itself) expires; until the new one is ready, callers keep
+// getting the old one. Imported certificates replace the generated set and
+// are never rotated.
+class CertificateCache {
+ public:
+  static constexpr int kMaxSize = 16;
+
+  // Returns false if |options| is out of range. Disabling keeps imported
+  // certificates for a later re-enable but drops generated ones.
+  bool Configure(const RTCCertificateCacheOptions& options);
+
+  // Next certificate in the rotation. Null when disabled, or while the very
+  // first certificate of a slot is being generated by another caller; the
+  // connection then generates its own as it would without a cache.
+  webrtc::scoped_refptr<webrtc::RTCCertificate> Next();
+
+  // Takes a PEM bundle with one private key and one certificate block, in
+  // either order. Enables the cache if it was off.
+  bool Import(const std::string& pem);
+
+  // The first certificate of the rotation as a PEM bundle (private key, then
+  // certificate), generating it if needed. Empty while disabled.
+  std::string Export();
+
+ private:
+  struct Slot {
+    webrtc::scoped_refptr<webrtc::RTCCertificate> certificate;
+    int64_t created_ms = 0;
+    bool generating = false;
+  };
+
+  webrtc::scoped_refptr<webrtc::RTCCertificate> Ensure(size_t index);
+
+  webrtc::Mutex mutex_;
+  bool enabled_ RTC_GUARDED_BY(mutex_) = false;
+  int64_t rotation_interval_ms_ RTC_GUARDED_BY(mutex_) = 0;
+  // Bumped by Configure() so a generation started under the old layout does
+  // not land in a reused slot.
+  uint64_t generation_ RTC_GUARDED_BY(mutex_) = 0;
+  std::vector<Slot> slots_ RTC_GUARDED_BY(mutex_);
+  std::vector<webrtc::scoped_refptr<webrtc::RTCCertificate>> imported_
+      RTC_GUARDED_BY(mutex_);
+  size_t next_ RTC_GUARDED_BY(mutex_) = 0;
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // INTERNAL_CERTIFICATE_CACHE_H_
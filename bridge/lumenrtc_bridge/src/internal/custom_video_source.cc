@@ -0,0 +1,288 @@
+#include "src/internal/custom_video_source.h"
+
+#include <utility>
+
+#include "api/make_ref_counted.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/nv12_buffer.h"
+#include "api/video/video_frame.h"
+#include "api/video/video_rotation.h"
+#include "common_video/include/video_frame_buffer.h"
+#include "rtc_base/logging.h"
+#include "third_party/libyuv/include/libyuv.h"
+
+namespace webrtc {
+namespace internal {
+
+namespace {
+
+// Upper bound of frames in flight (encoder queue + local renderers) before a
+// push falls back to dropping instead of growing the pool.
+constexpr size_t kMaxPooledBuffers = 8;
+
+// Packed layouts accepted by PushARGB, mirroring RTCVideoFrame::Type.
+enum PackedType { kPackedARGB = 0, kPackedBGRA, kPackedABGR, kPackedRGBA };
+
+// NV12 view over caller-owned memory. |no_longer_used| runs when the last
+// reference goes away.
+class WrappedNV12Buffer : public webrtc::NV12BufferInterface {
+ public:
+  WrappedNV12Buffer(int width, int height, const uint8_t* data_y,
+                    int stride_y, const uint8_t* data_uv, int stride_uv,
+                    std::function<void()> no_longer_used)
+      : width_(width),
+        height_(height),
+        data_y_(data_y),
+        stride_y_(stride_y),
+        data_uv_(data_uv),
+        stride_uv_(stride_uv),
+        no_longer_used_(std::move(no_longer_used)) {}
+
+  ~WrappedNV12Buffer() override { no_longer_used_(); }
+
+  int width() const override { return width_; }
+  int height() const override { return height_; }
+  const uint8_t* DataY() const override { return data_y_; }
+  const uint8_t* DataUV() const override { return data_uv_; }
+  int StrideY() const override { return stride_y_; }
+  int StrideUV() const override { return stride_uv_; }
+
+  webrtc::scoped_refptr<webrtc::I420BufferInterface> ToI420() override {
+    webrtc::scoped_refptr<webrtc::I420Buffer> i420 =
+        webrtc::I420Buffer::Create(width_, height_);
+    libyuv::NV12ToI420(data_y_, stride_y_, data_uv_, stride_uv_,
+                       i420->MutableDataY(), i420->StrideY(),
+                       i420->MutableDataU(), i420->StrideU(),
+                       i420->MutableDataV(), i420->StrideV(), width_, height_);
+    return i420;
+  }
+
+ private:
+  const int width_;
+  const int height_;
+  const uint8_t* const data_y_;
+  const int stride_y_;
+  const uint8_t* const data_uv_;
+  const int stride_uv_;
+  std::function<void()> no_longer_used_;
+};
+
+int PackedToI420(int type, const uint8_t* src, int src_stride,
+                 webrtc::I420Buffer* dst) {
+  switch (type) {
+    case kPackedARGB:
+      return libyuv::ARGBToI420(src, src_stride, dst->MutableDataY(),
+                                dst->StrideY(), dst->MutableDataU(),
+                                dst->StrideU(), dst->MutableDataV(),
+                                dst->StrideV(), dst->width(), dst->height());
+    case kPackedBGRA:
+      return libyuv::BGRAToI420(src, src_stride, dst->MutableDataY(),
+                                dst->StrideY(), dst->MutableDataU(),
+                                dst->StrideU(), dst->MutableDataV(),
+                                dst->StrideV(), dst->width(), dst->height());
+    case kPackedABGR:
+      return libyuv::ABGRToI420(src, src_stride, dst->MutableDataY(),
+                                dst->StrideY(), dst->MutableDataU(),
+                                dst->StrideU(), dst->MutableDataV(),
+                                dst->StrideV(), dst->width(), dst->height());
+    case kPackedRGBA:
+      return libyuv::RGBAToI420(src, src_stride, dst->MutableDataY(),
+                                dst->StrideY(), dst->MutableDataU(),
+                                dst->StrideU(), dst->MutableDataV(),
+                                dst->StrideV(), dst->width(), dst->height());
+    default:
+      return -1;
+  }
+}
+
+void RunRelease(CustomVideoSource::ReleaseFunctor& release) {
+  if (release) {
+    release();
+  }
+}
+
+}  // namespace
+
+CustomVideoSource::CustomVideoSource(bool is_screencast)
+    : is_screencast_(is_screencast),
+      buffer_pool_(/*zero_initialize=*/false, kMaxPooledBuffers) {}
+
+CustomVideoSource::~CustomVideoSource() = default;
+
+bool CustomVideoSource::Adapt(int width, int height, int64_t timestamp_us,
+                              Adaptation* out) {
+  if (!AdaptFrame(width, height, timestamp_us, &out->out_width,
+                  &out->out_height, &out->crop_width, &out->crop_height,
+                  &out->crop_x, &out->crop_y)) {
+    return false;
+  }
+  // Keep chroma sampling aligned when cropping 4:2:0 input.
+  out->crop_x &= ~1;
+  out->crop_y &= ~1;
+  return true;
+}
+
+void CustomVideoSource::Deliver(
+    webrtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer,
+    int64_t timestamp_us) {
+  dropping_ = false;
+  OnFrame(webrtc::VideoFrame::Builder()
+              .set_video_frame_buffer(std::move(buffer))
+              .set_rotation(webrtc::kVideoRotation_0)
+              .set_timestamp_us(timestamp_us)
+              .build());
+}
+
+void CustomVideoSource::DropFrame() {
+  if (!dropping_) {
+    RTC_LOG(LS_WARNING) << "Custom video source is dropping frames: all "
+                        << kMaxPooledBuffers << " pooled buffers are in use";
+    dropping_ = true;
+  }
+  dropped_frames_.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool CustomVideoSource::PushI420(const uint8_t* data_y, int stride_y,
+                                 const uint8_t* data_u, int stride_u,
+                                 const uint8_t* data_v, int stride_v,
+                                 int width, int height, int64_t timestamp_us,
+                                 ReleaseFunctor release) {
+  if (!data_y || !data_u || !data_v || width <= 0 || height <= 0) {
+    return false;
+  }
+  webrtc::MutexLock lock(&mutex_);
+  Adaptation a;
+  if (!Adapt(width, height, timestamp_us, &a)) {
+    RunRelease(release);
+    return true;
+  }
+
+  const bool passthrough = a.out_width == width && a.out_height == height;
+  if (passthrough && release) {
+    Deliver(webrtc::WrapI420Buffer(width, height, data_y, stride_y, data_u,
+                                   stride_u, data_v, stride_v,
+                                   std::move(release)),
+            timestamp_us);
+    return true;
+  }
+
+  webrtc::scoped_refptr<webrtc::I420Buffer> buffer =
+      buffer_pool_.CreateI420Buffer(a.out_width, a.out_height);
+  if (!buffer) {
+    DropFrame();
+    return false;
+  }
+  if (passthrough) {
+    libyuv::I420Copy(data_y, stride_y, data_u, stride_u, data_v, stride_v,
+                     buffer->MutableDataY(), buffer->StrideY(),
+                     buffer->MutableDataU(), buffer->StrideU(),
+                     buffer->MutableDataV(), buffer->StrideV(), width, height);
+  } else {
+    const int uv_offset_x = a.crop_x / 2;
+    const int uv_offset_y = a.crop_y / 2;
+    libyuv::I420Scale(
+        data_y + a.crop_y * stride_y + a.crop_x, stride_y,
+        data_u + uv_offset_y * stride_u + uv_offset_x, stride_u,
+        data_v + uv_offset_y * stride_v + uv_offset_x, stride_v, a.crop_width,
+        a.crop_height, buffer->MutableDataY(), buffer->StrideY(),
+        buffer->MutableDataU(), buffer->StrideU(), buffer->MutableDataV(),
+        buffer->StrideV(), a.out_width, a.out_height, libyuv::kFilterBox);
+  }
+  RunRelease(release);
+  Deliver(buffer, timestamp_us);
+  return true;
+}
+
+bool CustomVideoSource::PushNV12(const uint8_t* data_y, int stride_y,
+                                 const uint8_t* data_uv, int stride_uv,
+                                 int width, int height, int64_t timestamp_us,
+                                 ReleaseFunctor release) {
+  if (!data_y || !data_uv || width <= 0 || height <= 0) {
+    return false;
+  }
+  webrtc::MutexLock lock(&mutex_);
+  Adaptation a;
+  if (!Adapt(width, height, timestamp_us, &a)) {
+    RunRelease(release);
+    return true;
+  }
+
+  const bool passthrough = a.out_width == width && a.out_height == height;
+  if (passthrough && release) {
+    Deliver(webrtc::make_ref_counted<WrappedNV12Buffer>(
+                width, height, data_y, stride_y, data_uv, stride_uv,
+                std::move(release)),
+            timestamp_us);
+    return true;
+  }
+
+  webrtc::scoped_refptr<webrtc::NV12Buffer> buffer =
+      buffer_pool_.CreateNV12Buffer(a.out_width, a.out_height);
+  if (!buffer) {
+    DropFrame();
+    return false;
+  }
+  if (passthrough) {
+    libyuv::NV12Copy(data_y, stride_y, data_uv, stride_uv,
+                     buffer->MutableDataY(), buffer->StrideY(),
+                     buffer->MutableDataUV(), buffer->StrideUV(), width,
+                     height);
+  } else {
+    libyuv::NV12Scale(
+        data_y + a.crop_y * stride_y + a.crop_x, stride_y,
+        data_uv + (a.crop_y / 2) * stride_uv + a.crop_x, stride_uv,
+        a.crop_width, a.crop_height, buffer->MutableDataY(),
+        buffer->StrideY(), buffer->MutableDataUV(), buffer->StrideUV(),
+        a.out_width, a.out_height, libyuv::kFilterBox);
+  }
+  RunRelease(release);
+  Deliver(buffer, timestamp_us);
+  return true;
+}
+
+bool CustomVideoSource::PushARGB(const uint8_t* data, int stride, int width,
+                                 int height, int type, int64_t timestamp_us,
+                                 ReleaseFunctor release) {
+  if (!data || width <= 0 || height <= 0 || type < kPackedARGB ||
+      type > kPackedRGBA) {
+    return false;
+  }
+  webrtc::MutexLock lock(&mutex_);
+  Adaptation a;
+  if (!Adapt(width, height, timestamp_us, &a)) {
+    RunRelease(release);
+    return true;
+  }
+
+  webrtc::scoped_refptr<webrtc::I420Buffer> buffer =
+      buffer_pool_.CreateI420Buffer(a.out_width, a.out_height);
+  if (!buffer) {
+    DropFrame();
+    return false;
+  }
+
+  const uint8_t* src = data;
+  int src_stride = stride;
+  if (a.out_width != width || a.out_height != height) {
+    // Scale the packed pixels first so the colour conversion only runs on
+    // the output resolution. ARGBScale is byte-order agnostic.
+    const int scratch_stride = a.out_width * 4;
+    argb_scratch_.resize(static_cast<size_t>(scratch_stride) * a.out_height);
+    libyuv::ARGBScale(data + a.crop_y * stride + a.crop_x * 4, stride,
+                      a.crop_width, a.crop_height, argb_scratch_.data(),
+                      scratch_stride, a.out_width, a.out_height,
+                      libyuv::kFilterBox);
+    src = argb_scratch_.data();
+    src_stride = scratch_stride;
+  }
+  const bool converted =
+      PackedToI420(type, src, src_stride, buffer.get()) == 0;
+  RunRelease(release);
+  if (converted) {
+    Deliver(buffer, timestamp_us);
+  }
+  return true;
+}
+
+}  // namespace internal
+}  // namespace webrtc
@@ -0,0 +1,91 @@
+#ifndef INTERNAL_CUSTOM_VIDEO_SOURCE_H_
+#define INTERNAL_CUSTOM_VIDEO_SOURCE_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include "api/scoped_refptr.h"
+#include "api/video/video_frame_buffer.h"
+#include "common_video/include/video_frame_buffer_pool.h"
+#include "media/base/adapted_video_track_source.h"
+#include "rtc_base/synchronization/mutex.h"
+
+namespace webrtc {
+namespace internal {
+
+// Video track source fed by the application instead of a capture device.
+//
+// Every pushed frame first goes through AdaptFrame(), so the aggregated
+// VideoSinkWants (max pixels, frame rate, resolution alignment) are applied
+// before any pixel is touched: frames the sinks do not want are dropped and
+// oversized frames are cropped/scaled straight out of the caller's planes.
+// Frames that need no adaptation are wrapped zero-copy when the caller hands
+// over a release functor, and copied into pooled buffers otherwise.
+//
+// Push methods may be called from any thread; concurrent pushes serialize on
+// an internal mutex.
+class CustomVideoSource : public webrtc::AdaptedVideoTrackSource {
+ public:
+  using ReleaseFunctor = std::function<void()>;
+
+  explicit CustomVideoSource(bool is_screencast);
+  ~CustomVideoSource() override;
+
+  bool PushI420(const uint8_t* data_y, int stride_y, const uint8_t* data_u,
+                int stride_u, const uint8_t* data_v, int stride_v, int width,
+                int height, int64_t timestamp_us, ReleaseFunctor release);
+
+  bool PushNV12(const uint8_t* data_y, int stride_y, const uint8_t* data_uv,
+                int stride_uv, int width, int height, int64_t timestamp_us,
+                ReleaseFunctor release);
+
+  // |type| follows lumenrtc_bridge::RTCVideoFrame::Type.
+  bool PushARGB(const uint8_t* data, int stride, int width, int height,
+                int type, int64_t timestamp_us, ReleaseFunctor release);
+
+  // Frames dropped because every pooled buffer was still in use; frames
+  // dropped to honor sink wants are not counted.
+  uint64_t dropped_frames() const {
+    return dropped_frames_.load(std::memory_order_relaxed);
+  }
+
+  // VideoTrackSourceInterface
+  bool is_screencast() const override { return is_screencast_; }
+  std::optional<bool> needs_denoising() const override { return false; }
+  SourceState state() const override { return kLive; }
+  bool remote() const override { return false; }
+
+ private:
+  struct Adaptation {
+    int out_width = 0;
+    int out_height = 0;
+    int crop_width = 0;
+    int crop_height = 0;
+    int crop_x = 0;
+    int crop_y = 0;
+  };
+
+  // Returns false when the frame should be dropped to honor sink wants.
+  bool Adapt(int width, int height, int64_t timestamp_us, Adaptation* out);
+  void Deliver(webrtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer,
+               int64_t timestamp_us) RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  // Counts a frame the pool had no buffer for and logs the first of a run.
+  void DropFrame() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  const bool is_screencast_;
+  webrtc::Mutex mutex_;
+  webrtc::VideoFrameBufferPool buffer_pool_ RTC_GUARDED_BY(mutex_);
+  // Scaled packed pixels for PushARGB, reused across frames.
+  std::vector<uint8_t> argb_scratch_ RTC_GUARDED_BY(mutex_);
+  // Set by a drop and cleared by the next delivered frame.
+  bool dropping_ RTC_GUARDED_BY(mutex_) = false;
+  std::atomic<uint64_t> dropped_frames_{0};
+};
+
+}  // namespace internal
+}  // namespace webrtc
+
+#endif  // INTERNAL_CUSTOM_VIDEO_SOURCE_H_
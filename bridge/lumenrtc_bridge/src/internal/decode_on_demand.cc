@@ -0,0 +1,119 @@
+#include "src/internal/decode_on_demand.h"
+
+#include <string.h>
+
+#include <unordered_map>
+#include <utility>
+
+#include "modules/video_coding/include/video_error_codes.h"
+#include "rtc_base/synchronization/mutex.h"
+
+namespace lumenrtc_bridge {
+
+namespace {
+
+// No VP8, VP9, AV1 or H.264 frame is exactly these bytes.
+constexpr uint8_t kUndecodedMarker[] = {'L', 'u', 'm', 'e', 'n', 'R', 'T', 'C',
+                                        ' ', 'n', 'o', 'd', 'e', 'c', 'o', 'd'};
+
+webrtc::Mutex& RendererCountMutex() {
+  static webrtc::Mutex* mutex = new webrtc::Mutex();
+  return *mutex;
+}
+
+std::unordered_map<const webrtc::VideoTrackInterface*, int>&
+RendererCounts() {
+  static auto* counts =
+      new std::unordered_map<const webrtc::VideoTrackInterface*, int>();
+  return *counts;
+}
+
+bool IsUndecodedMarker(const webrtc::EncodedImage& image) {
+  return image.size() == sizeof(kUndecodedMarker) &&
+         memcmp(image.data(), kUndecodedMarker, sizeof(kUndecodedMarker)) ==
+             0;
+}
+
+}  // namespace
+
+void AddVideoRenderer(const webrtc::VideoTrackInterface* track) {
+  webrtc::MutexLock lock(&RendererCountMutex());
+  ++RendererCounts()[track];
+}
+
+void RemoveVideoRenderer(const webrtc::VideoTrackInterface* track) {
+  webrtc::MutexLock lock(&RendererCountMutex());
+  auto it = RendererCounts().find(track);
+  if (it != RendererCounts().end() && --it->second <= 0) {
+    // Erased at zero, so a later track at the same address starts clean.
+    RendererCounts().erase(it);
+  }
+}
+
+bool HasVideoRenderers(const webrtc::VideoTrackInterface* track) {
+  webrtc::MutexLock lock(&RendererCountMutex());
+  return RendererCounts().count(track) != 0;
+}
+
+void MarkFrameUndecoded(webrtc::TransformableFrameInterface* frame) {
+  frame->SetData(kUndecodedMarker);
+}
+
+SkippingVideoDecoderFactory::SkippingVideoDecoderFactory(
+    std::unique_ptr<webrtc::VideoDecoderFactory> factory)
+    : factory_(std::move(factory)) {}
+
+std::vector<webrtc::SdpVideoFormat>
+SkippingVideoDecoderFactory::GetSupportedFormats() const {
+  return factory_->GetSupportedFormats();
+}
+
+webrtc::VideoDecoderFactory::CodecSupport
+SkippingVideoDecoderFactory::QueryCodecSupport(
+    const webrtc::SdpVideoFormat& format, bool reference_scaling) const {
+  return factory_->QueryCodecSupport(format, reference_scaling);
+}
+
+std::unique_ptr<webrtc::VideoDecoder> SkippingVideoDecoderFactory::Create(
+    const webrtc::Environment& env, const webrtc::SdpVideoFormat& format) {
+  std::unique_ptr<webrtc::VideoDecoder> decoder = factory_->Create(env, format);
+  if (!decoder) {
+    return nullptr;
+  }
+  return std::make_unique<SkippingVideoDecoder>(std::move(decoder));
+}
+
+SkippingVideoDecoder::SkippingVideoDecoder(
+    std::unique_ptr<webrtc::VideoDecoder> decoder)
+    : decoder_(std::move(decoder)) {}
+
+bool SkippingVideoDecoder::Configure(const Settings& settings) {
+  return decoder_->Configure(settings);
+}
+
+int32_t SkippingVideoDecoder::Decode(const webrtc::EncodedImage& input_image,
+                                     int64_t render_time_ms) {
+  // Anything but OK would make the receive stream request a key frame.
+  if (IsUndecodedMarker(input_image)) {
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+  return decoder_->Decode(input_image, render_time_ms);
+}
+
+int32_t SkippingVideoDecoder::RegisterDecodeCompleteCallback(
+    webrtc::DecodedImageCallback* callback) {
+  return decoder_->RegisterDecodeCompleteCallback(callback);
+}
+
+int32_t SkippingVideoDecoder::Release() { return decoder_->Release(); }
+
+webrtc::VideoDecoder::DecoderInfo SkippingVideoDecoder::GetDecoderInfo()
+    const {
+  return decoder_->GetDecoderInfo();
+}
+
+const char* SkippingVideoDecoder::ImplementationName() const {
+  return decoder_->ImplementationName();
+}
+
+}  // namespace lumenrtc_bridge
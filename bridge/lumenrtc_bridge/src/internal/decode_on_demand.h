@@ -0,0 +1,70 @@
+#ifndef INTERNAL_DECODE_ON_DEMAND_H_
+#define INTERNAL_DECODE_ON_DEMAND_H_
+
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/frame_transformer_interface.h"
+#include "api/media_stream_interface.h"
+#include "api/video/encoded_image.h"
+#include "api/video_codecs/sdp_video_format.h"
+#include "api/video_codecs/video_decoder.h"
+#include "api/video_codecs/video_decoder_factory.h"
+
+namespace lumenrtc_bridge {
+
+// Renderers attached to |track| through any of its VideoSinkAdapters. A
+// receiver decoding on demand checks this for every frame.
+void AddVideoRenderer(const webrtc::VideoTrackInterface* track);
+void RemoveVideoRenderer(const webrtc::VideoTrackInterface* track);
+bool HasVideoRenderers(const webrtc::VideoTrackInterface* track);
+
+// Replaces the payload of a received frame with a marker that a
+// SkippingVideoDecoder accepts without decoding. The frame still passes the
+// frame buffer, so the receive stream sees a steady stream of decodable
+// frames and does not ask the sender for key frames, as it would if the
+// frame were dropped.
+void MarkFrameUndecoded(webrtc::TransformableFrameInterface* frame);
+
+// Wraps each decoder of |factory| in a SkippingVideoDecoder.
+class SkippingVideoDecoderFactory : public webrtc::VideoDecoderFactory {
+ public:
+  explicit SkippingVideoDecoderFactory(
+      std::unique_ptr<webrtc::VideoDecoderFactory> factory);
+
+  std::vector<webrtc::SdpVideoFormat> GetSupportedFormats() const override;
+  CodecSupport QueryCodecSupport(const webrtc::SdpVideoFormat& format,
+                                 bool reference_scaling) const override;
+  std::unique_ptr<webrtc::VideoDecoder> Create(
+      const webrtc::Environment& env,
+      const webrtc::SdpVideoFormat& format) override;
+
+ private:
+  const std::unique_ptr<webrtc::VideoDecoderFactory> factory_;
+};
+
+// Reports frames marked by MarkFrameUndecoded() as decoded without output
+// and hands every other frame to the wrapped decoder.
+class SkippingVideoDecoder : public webrtc::VideoDecoder {
+ public:
+  explicit SkippingVideoDecoder(std::unique_ptr<webrtc::VideoDecoder> decoder);
+
+  bool Configure(const Settings& settings) override;
+  int32_t Decode(const webrtc::EncodedImage& input_image,
+                 int64_t render_time_ms) override;
+  int32_t RegisterDecodeCompleteCallback(
+      webrtc::DecodedImageCallback* callback) override;
+  int32_t Release() override;
+  DecoderInfo GetDecoderInfo() const override;
+  const char* ImplementationName() const override;
+
+ private:
+  const std::unique_ptr<webrtc::VideoDecoder> decoder_;
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // INTERNAL_DECODE_ON_DEMAND_H_
@@ -0,0 +1,560 @@
+#include "src/internal/encoded_frame_forwarding.h"
+
+#include <memory>
+#include <optional>
+
+#include "absl/strings/ascii.h"
+#include "api/task_queue/task_queue_base.h"
+#include "base/refcountedobject.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/ref_counted_object.h"
+#include "rtc_base/time_utils.h"
+#include "rtc_encoded_frame_impl.h"
+#include "src/internal/decode_on_demand.h"
+
+namespace lumenrtc_bridge {
+namespace {
+
+// How often a receiver that resumes decoding repeats its key frame request
+// until one arrives.
+constexpr int64_t kKeyFrameRetryMs = 1000;
+
+// Hands frames to a decoder as undecoded markers, after the observer, if
+// any, has seen them as received.
+class UndecodedFrameCallback : public webrtc::TransformedFrameCallback {
+ public:
+  explicit UndecodedFrameCallback(
+      webrtc::scoped_refptr<webrtc::TransformedFrameCallback> decoder)
+      : decoder_(std::move(decoder)) {}
+
+  void OnTransformedFrame(
+      std::unique_ptr<webrtc::TransformableFrameInterface> frame) override {
+    MarkFrameUndecoded(frame.get());
+    decoder_->OnTransformedFrame(std::move(frame));
+  }
+
+ private:
+  const webrtc::scoped_refptr<webrtc::TransformedFrameCallback> decoder_;
+};
+
+// A received frame as one sender sees it: the payload and metadata are read
+// from the shared RTCEncodedFrameImpl, while the payload type and SSRC are
+// the sender's. Its direction is neither sender nor receiver, which makes
+// the packetizer take everything through the public frame interface.
+template <typename Interface>
+class ForwardedFrame : public Interface {
+ public:
+  ForwardedFrame(scoped_refptr<RTCEncodedFrameImpl> source,
+                 uint8_t payload_type, uint32_t ssrc)
+      : source_(std::move(source)), payload_type_(payload_type), ssrc_(ssrc) {}
+
+  webrtc::ArrayView<const uint8_t> GetData() const override {
+    if (data_) {
+      return *data_;
+    }
+    return source_->frame()->GetData();
+  }
+  // The payload is shared with the receiver and other senders, so a new one,
+  // such as the encrypted payload, is this frame's own.
+  void SetData(webrtc::ArrayView<const uint8_t> data) override {
+    data_.emplace(data.data(), data.size());
+  }
+  uint8_t GetPayloadType() const override { return payload_type_; }
+  uint32_t GetSsrc() const override { return ssrc_; }
+  uint32_t GetTimestamp() const override {
+    return source_->frame()->GetTimestamp();
+  }
+  void SetRTPTimestamp(uint32_t timestamp) override {}
+  std::string GetMimeType() const override {
+    return source_->frame()->GetMimeType();
+  }
+  std::optional<webrtc::Timestamp> ReceiveTime() const override {
+    return std::nullopt;
+  }
+  std::optional<webrtc::Timestamp> CaptureTime() const override {
+    return source_->frame()->CaptureTime();
+  }
+  std::optional<webrtc::TimeDelta> SenderCaptureTimeOffset() const override {
+    return source_->frame()->SenderCaptureTimeOffset();
+  }
+
+ protected:
+  const Interface* source() const {
+    return static_cast<const Interface*>(source_->frame());
+  }
+
+ private:
+  const scoped_refptr<RTCEncodedFrameImpl> source_;
+  const uint8_t payload_type_;
+  const uint32_t ssrc_;
+  std::optional<webrtc::Buffer> data_;
+};
+
+class ForwardedVideoFrame
+    : public ForwardedFrame<webrtc::TransformableVideoFrameInterface> {
+ public:
+  using ForwardedFrame::ForwardedFrame;
+
+  bool IsKeyFrame() const override { return source()->IsKeyFrame(); }
+  webrtc::VideoFrameMetadata Metadata() const override {
+    webrtc::VideoFrameMetadata metadata = source()->Metadata();
+    metadata.SetSsrc(GetSsrc());
+    return metadata;
+  }
+  void SetMetadata(const webrtc::VideoFrameMetadata& metadata) override {}
+};
+
+class ForwardedAudioFrame
+    : public ForwardedFrame<webrtc::TransformableAudioFrameInterface> {
+ public:
+  using ForwardedFrame::ForwardedFrame;
+
+  webrtc::ArrayView<const uint32_t> GetContributingSources() const override {
+    return source()->GetContributingSources();
+  }
+  const std::optional<uint16_t> SequenceNumber() const override {
+    return source()->SequenceNumber();
+  }
+  std::optional<uint64_t> AbsoluteCaptureTimestamp() const override {
+    return source()->AbsoluteCaptureTimestamp();
+  }
+  FrameType Type() const override { return source()->Type(); }
+  std::optional<uint8_t> AudioLevel() const override {
+    return source()->AudioLevel();
+  }
+};
+
+// An encoded audio frame supplied by the application rather than a receiver.
+class IngestedAudioFrame : public webrtc::TransformableAudioFrameInterface {
+ public:
+  IngestedAudioFrame(webrtc::ArrayView<const uint8_t> data,
+                     std::string mime_type, uint8_t payload_type,
+                     uint32_t ssrc, uint32_t rtp_timestamp)
+      : data_(data.data(), data.size()),
+        mime_type_(std::move(mime_type)),
+        payload_type_(payload_type),
+        ssrc_(ssrc),
+        rtp_timestamp_(rtp_timestamp) {}
+
+  webrtc::ArrayView<const uint8_t> GetData() const override { return data_; }
+  void SetData(webrtc::ArrayView<const uint8_t> data) override {
+    data_.SetData(data.data(), data.size());
+  }
+  uint8_t GetPayloadType() const override { return payload_type_; }
+  uint32_t GetSsrc() const override { return ssrc_; }
+  uint32_t GetTimestamp() const override { return rtp_timestamp_; }
+  void SetRTPTimestamp(uint32_t timestamp) override {
+    rtp_timestamp_ = timestamp;
+  }
+  std::string GetMimeType() const override { return mime_type_; }
+  std::optional<webrtc::Timestamp> ReceiveTime() const override {
+    return std::nullopt;
+  }
+  std::optional<webrtc::Timestamp> CaptureTime() const override {
+    return std::nullopt;
+  }
+  std::optional<webrtc::TimeDelta> SenderCaptureTimeOffset() const override {
+    return std::nullopt;
+  }
+  webrtc::ArrayView<const uint32_t> GetContributingSources() const override {
+    return {};
+  }
+  const std::optional<uint16_t> SequenceNumber() const override {
+    return std::nullopt;
+  }
+  std::optional<uint64_t> AbsoluteCaptureTimestamp() const override {
+    return std::nullopt;
+  }
+  FrameType Type() const override { return FrameType::kAudioFrameSpeech; }
+  std::optional<uint8_t> AudioLevel() const override { return std::nullopt; }
+
+ private:
+  webrtc::Buffer data_;
+  const std::string mime_type_;
+  const uint8_t payload_type_;
+  const uint32_t ssrc_;
+  uint32_t rtp_timestamp_;
+};
+
+// Transformers by the native sender or receiver they were installed on.
+template <typename Transformer>
+struct TransformerRegistry {
+  webrtc::Mutex mutex;
+  std::map<const void*,
+           webrtc::scoped_refptr<webrtc::RefCountedObject<Transformer>>>
+      transformers RTC_GUARDED_BY(mutex);
+};
+
+template <typename Transformer>
+TransformerRegistry<Transformer>& Registry() {
+  static auto* registry = new TransformerRegistry<Transformer>();
+  return *registry;
+}
+
+// An entry referenced only by the map belongs to a destroyed sender or
+// receiver, since a live one holds its transformer; the address may have
+// been reused, so such entries are dropped first.
+template <typename Transformer>
+void DropUnused(TransformerRegistry<Transformer>& registry)
+    RTC_EXCLUSIVE_LOCKS_REQUIRED(registry.mutex) {
+  for (auto it = registry.transformers.begin();
+       it != registry.transformers.end();) {
+    if (it->second->HasOneRef()) {
+      it = registry.transformers.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+template <typename Transformer>
+webrtc::scoped_refptr<Transformer> FindTransformer(const void* native,
+                                                   RTCMediaType media_type,
+                                                   bool create,
+                                                   bool* created) {
+  TransformerRegistry<Transformer>& registry = Registry<Transformer>();
+  webrtc::MutexLock lock(&registry.mutex);
+  DropUnused(registry);
+  auto it = registry.transformers.find(native);
+  if (it != registry.transformers.end()) {
+    return it->second;
+  }
+  if (!create) {
+    return nullptr;
+  }
+  webrtc::scoped_refptr<webrtc::RefCountedObject<Transformer>> transformer(
+      new webrtc::RefCountedObject<Transformer>(media_type));
+  registry.transformers.emplace(native, transformer);
+  *created = true;
+  return transformer;
+}
+
+}  // namespace
+
+std::vector<webrtc::scoped_refptr<EncodedFrameTap>> AllEncodedFrameTaps() {
+  TransformerRegistry<EncodedFrameTap>& registry = Registry<EncodedFrameTap>();
+  webrtc::MutexLock lock(&registry.mutex);
+  DropUnused(registry);
+  std::vector<webrtc::scoped_refptr<EncodedFrameTap>> taps;
+  taps.reserve(registry.transformers.size());
+  for (const auto& entry : registry.transformers) {
+    taps.push_back(entry.second);
+  }
+  return taps;
+}
+
+webrtc::scoped_refptr<EncodedFrameTap> FindEncodedFrameTap(
+    webrtc::RtpReceiverInterface* receiver, bool create, bool* created) {
+  // media_type() is a proxied call; only make it when creating.
+  return FindTransformer<EncodedFrameTap>(
+      receiver,
+      create ? static_cast<RTCMediaType>(receiver->media_type())
+             : RTCMediaType::UNSUPPORTED,
+      create, created);
+}
+
+webrtc::scoped_refptr<EncodedFrameInjector> FindEncodedFrameInjector(
+    webrtc::RtpSenderInterface* sender, bool create, bool* created) {
+  return FindTransformer<EncodedFrameInjector>(
+      sender,
+      create ? static_cast<RTCMediaType>(sender->media_type())
+             : RTCMediaType::UNSUPPORTED,
+      create, created);
+}
+
+EncodedFrameTap::EncodedFrameTap(RTCMediaType media_type)
+    : media_type_(media_type) {}
+
+void EncodedFrameTap::SetObserver(RTCEncodedFrameObserver* observer) {
+  webrtc::MutexLock lock(&observer_mutex_);
+  observer_ = observer;
+}
+
+void EncodedFrameTap::ClearObserver(const RTCEncodedFrameObserver* observer) {
+  webrtc::MutexLock lock(&observer_mutex_);
+  if (observer_ == observer) {
+    observer_ = nullptr;
+  }
+}
+
+void EncodedFrameTap::SetDecodeOnDemand(
+    bool enabled, webrtc::scoped_refptr<webrtc::VideoTrackInterface> track) {
+  webrtc::MutexLock lock(&mutex_);
+  decode_on_demand_ = enabled;
+  demand_track_ = std::move(track);
+}
+
+RTCDecodeOnDemandStats EncodedFrameTap::GetDecodeOnDemandStats() {
+  webrtc::MutexLock lock(&mutex_);
+  RTCDecodeOnDemandStats stats;
+  stats.frames_decoded = frames_decoded_;
+  stats.frames_skipped = frames_skipped_;
+  stats.key_frame_requests = key_frame_requests_;
+  stats.enabled = decode_on_demand_;
+  stats.skipping = skipping_;
+  return stats;
+}
+
+void EncodedFrameTap::SetFrameCrypto(
+    webrtc::scoped_refptr<FrameCrypto> crypto) {
+  webrtc::MutexLock lock(&mutex_);
+  crypto_ = std::move(crypto);
+}
+
+void EncodedFrameTap::ClearFrameCrypto(const FrameCrypto* crypto) {
+  webrtc::MutexLock lock(&mutex_);
+  if (crypto_.get() == crypto) {
+    crypto_ = nullptr;
+  }
+}
+
+bool EncodedFrameTap::ShouldDecode(
+    const webrtc::TransformableFrameInterface& frame) {
+  const bool wanted = !decode_on_demand_ || !demand_track_ ||
+                      HasVideoRenderers(demand_track_.get());
+  if (!wanted) {
+    skipping_ = true;
+  } else if (skipping_ &&
+             static_cast<const webrtc::TransformableVideoFrameInterface&>(
+                 frame)
+                 .IsKeyFrame()) {
+    skipping_ = false;
+  }
+  if (!skipping_) {
+    ++frames_decoded_;
+    return true;
+  }
+  ++frames_skipped_;
+  // The decoder missed the frames in between, so only a key frame can
+  // resume it.
+  const int64_t now_ms = webrtc::TimeMillis();
+  if (wanted && now_ms - last_key_frame_request_ms_ >= kKeyFrameRetryMs) {
+    last_key_frame_request_ms_ = now_ms;
+    ++key_frame_requests_;
+    webrtc::scoped_refptr<webrtc::VideoTrackSourceInterface> source(
+        demand_track_->GetSource());
+    webrtc::TaskQueueBase* queue = webrtc::TaskQueueBase::Current();
+    if (source && queue) {
+      // Posted, since the request reaches into the receive stream that is
+      // delivering this frame.
+      queue->PostTask([source] { source->GenerateKeyFrame(); });
+    } else if (source) {
+      source->GenerateKeyFrame();
+    }
+  }
+  return false;
+}
+
+void EncodedFrameTap::Transform(
+    std::unique_ptr<webrtc::TransformableFrameInterface> frame) {
+  webrtc::scoped_refptr<webrtc::TransformedFrameCallback> decoder;
+  webrtc::scoped_refptr<FrameCrypto> crypto;
+  {
+    webrtc::MutexLock lock(&mutex_);
+    auto it = decoders_.find(frame->GetSsrc());
+    if (it == decoders_.end() && decoders_.size() == 1) {
+      it = decoders_.begin();
+    }
+    if (it == decoders_.end()) {
+      return;
+    }
+    decoder = it->second;
+    if (media_type_ == RTCMediaType::VIDEO && !ShouldDecode(*frame)) {
+      decoder = webrtc::scoped_refptr<webrtc::TransformedFrameCallback>(
+          new webrtc::RefCountedObject<UndecodedFrameCallback>(
+              std::move(decoder)));
+    }
+    crypto = crypto_;
+  }
+  if (crypto && !crypto->Decrypt(frame.get())) {
+    return;
+  }
+  webrtc::MutexLock lock(&observer_mutex_);
+  if (!observer_) {
+    decoder->OnTransformedFrame(std::move(frame));
+    return;
+  }
+  observer_->OnEncodedFrame(
+      scoped_refptr<RTCEncodedFrame>(new RefCountedObject<RTCEncodedFrameImpl>(
+          std::move(frame), media_type_, std::move(decoder))));
+}
+
+void EncodedFrameTap::RegisterTransformedFrameCallback(
+    webrtc::scoped_refptr<webrtc::TransformedFrameCallback> callback) {
+  RegisterTransformedFrameSinkCallback(std::move(callback), 0);
+}
+
+void EncodedFrameTap::RegisterTransformedFrameSinkCallback(
+    webrtc::scoped_refptr<webrtc::TransformedFrameCallback> callback,
+    uint32_t ssrc) {
+  webrtc::MutexLock lock(&mutex_);
+  decoders_[ssrc] = std::move(callback);
+}
+
+void EncodedFrameTap::UnregisterTransformedFrameCallback() {
+  UnregisterTransformedFrameSinkCallback(0);
+}
+
+void EncodedFrameTap::UnregisterTransformedFrameSinkCallback(uint32_t ssrc) {
+  webrtc::MutexLock lock(&mutex_);
+  decoders_.erase(ssrc);
+}
+
+EncodedFrameInjector::EncodedFrameInjector(RTCMediaType media_type)
+    : media_type_(media_type) {}
+
+void EncodedFrameInjector::Enable(
+    std::map<std::string, uint8_t> payload_types) {
+  webrtc::MutexLock lock(&mutex_);
+  enabled_ = true;
+  payload_types_ = std::move(payload_types);
+}
+
+void EncodedFrameInjector::Disable() {
+  webrtc::MutexLock lock(&mutex_);
+  enabled_ = false;
+}
+
+void EncodedFrameInjector::SetFrameCrypto(
+    webrtc::scoped_refptr<FrameCrypto> crypto) {
+  webrtc::MutexLock lock(&mutex_);
+  crypto_ = std::move(crypto);
+}
+
+void EncodedFrameInjector::ClearFrameCrypto(const FrameCrypto* crypto) {
+  webrtc::MutexLock lock(&mutex_);
+  if (crypto_.get() == crypto) {
+    crypto_ = nullptr;
+  }
+}
+
+bool EncodedFrameInjector::Send(scoped_refptr<RTCEncodedFrameImpl> frame) {
+  if (!frame || frame->media_type() != media_type_) {
+    return false;
+  }
+  webrtc::scoped_refptr<webrtc::TransformedFrameCallback> packetizer;
+  webrtc::scoped_refptr<FrameCrypto> crypto;
+  uint8_t payload_type = 0;
+  uint32_t ssrc = 0;
+  if (!Route(frame->frame()->GetMimeType(), &payload_type, &ssrc, &packetizer,
+             &crypto)) {
+    return false;
+  }
+  std::unique_ptr<webrtc::TransformableFrameInterface> forwarded;
+  if (media_type_ == RTCMediaType::VIDEO) {
+    forwarded = std::make_unique<ForwardedVideoFrame>(std::move(frame),
+                                                      payload_type, ssrc);
+  } else {
+    forwarded = std::make_unique<ForwardedAudioFrame>(std::move(frame),
+                                                      payload_type, ssrc);
+  }
+  if (crypto && !crypto->Encrypt(forwarded.get())) {
+    return false;
+  }
+  packetizer->OnTransformedFrame(std::move(forwarded));
+  return true;
+}
+
+bool EncodedFrameInjector::SendAudio(const std::string& mime_type,
+                                     webrtc::ArrayView<const uint8_t> data,
+                                     uint32_t rtp_timestamp) {
+  if (media_type_ != RTCMediaType::AUDIO) {
+    return false;
+  }
+  webrtc::scoped_refptr<webrtc::TransformedFrameCallback> packetizer;
+  webrtc::scoped_refptr<FrameCrypto> crypto;
+  uint8_t payload_type = 0;
+  uint32_t ssrc = 0;
+  if (!Route(mime_type, &payload_type, &ssrc, &packetizer, &crypto)) {
+    return false;
+  }
+  auto frame = std::make_unique<IngestedAudioFrame>(
+      data, mime_type, payload_type, ssrc, rtp_timestamp);
+  if (crypto && !crypto->Encrypt(frame.get())) {
+    return false;
+  }
+  packetizer->OnTransformedFrame(std::move(frame));
+  return true;
+}
+
+bool EncodedFrameInjector::Route(
+    const std::string& mime_type, uint8_t* payload_type, uint32_t* ssrc,
+    webrtc::scoped_refptr<webrtc::TransformedFrameCallback>* packetizer,
+    webrtc::scoped_refptr<FrameCrypto>* crypto) {
+  webrtc::MutexLock lock(&mutex_);
+  if (!enabled_ || packetizers_.empty()) {
+    return false;
+  }
+  auto it = payload_types_.find(absl::AsciiStrToLower(mime_type));
+  if (it == payload_types_.end()) {
+    return false;
+  }
+  *payload_type = it->second;
+  *ssrc = packetizers_.front().first;
+  *packetizer = packetizers_.front().second;
+  *crypto = crypto_;
+  return true;
+}
+
+void EncodedFrameInjector::Transform(
+    std::unique_ptr<webrtc::TransformableFrameInterface> frame) {
+  webrtc::scoped_refptr<webrtc::TransformedFrameCallback> packetizer;
+  webrtc::scoped_refptr<FrameCrypto> crypto;
+  {
+    webrtc::MutexLock lock(&mutex_);
+    if (enabled_) {
+      return;
+    }
+    packetizer = Packetizer(frame->GetSsrc());
+    crypto = crypto_;
+  }
+  if (!packetizer || (crypto && !crypto->Encrypt(frame.get()))) {
+    return;
+  }
+  packetizer->OnTransformedFrame(std::move(frame));
+}
+
+void EncodedFrameInjector::RegisterTransformedFrameCallback(
+    webrtc::scoped_refptr<webrtc::TransformedFrameCallback> callback) {
+  RegisterTransformedFrameSinkCallback(std::move(callback), 0);
+}
+
+void EncodedFrameInjector::RegisterTransformedFrameSinkCallback(
+    webrtc::scoped_refptr<webrtc::TransformedFrameCallback> callback,
+    uint32_t ssrc) {
+  webrtc::MutexLock lock(&mutex_);
+  for (auto& entry : packetizers_) {
+    if (entry.first == ssrc) {
+      entry.second = std::move(callback);
+      return;
+    }
+  }
+  packetizers_.emplace_back(ssrc, std::move(callback));
+}
+
+void EncodedFrameInjector::UnregisterTransformedFrameCallback() {
+  UnregisterTransformedFrameSinkCallback(0);
+}
+
+void EncodedFrameInjector::UnregisterTransformedFrameSinkCallback(
+    uint32_t ssrc) {
+  webrtc::MutexLock lock(&mutex_);
+  for (auto it = packetizers_.begin(); it != packetizers_.end(); ++it) {
+    if (it->first == ssrc) {
+      packetizers_.erase(it);
+      return;
+    }
+  }
+}
+
+webrtc::scoped_refptr<webrtc::TransformedFrameCallback>
+EncodedFrameInjector::Packetizer(uint32_t ssrc) {
+  for (const auto& entry : packetizers_) {
+    if (entry.first == ssrc) {
+      return entry.second;
+    }
+  }
+  return packetizers_.empty() ? nullptr : packetizers_.front().second;
+}
+
+}  // namespace lumenrtc_bridge
@@ -0,0 +1,165 @@
+#ifndef INTERNAL_ENCODED_FRAME_FORWARDING_H_
+#define INTERNAL_ENCODED_FRAME_FORWARDING_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/frame_transformer_interface.h"
+#include "api/media_stream_interface.h"
+#include "api/rtp_receiver_interface.h"
+#include "api/rtp_sender_interface.h"
+#include "api/scoped_refptr.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_encoded_frame.h"
+#include "rtc_types.h"
+#include "src/internal/frame_crypto.h"
+
+namespace lumenrtc_bridge {
+
+class RTCEncodedFrameImpl;
+
+// Installed on a receiver between depacketizer and decoder. Without an
+// observer frames pass straight through; with one each frame is wrapped in
+// an RTCEncodedFrameImpl that returns it to the decoder when released.
+//
+// While decoding on demand, video frames of a track that no renderer is
+// attached to reach the decoder as undecoded markers; once a renderer is
+// attached again the tap asks for a key frame and resumes decoding with it.
+//
+// With a FrameCrypto set, frames are decrypted before anything else sees
+// them and dropped if that fails.
+//
+// WebRTC cannot take a transformer off a receiver again, so once installed
+// the tap stays for the receiver's lifetime.
+class EncodedFrameTap : public webrtc::FrameTransformerInterface {
+ public:
+  explicit EncodedFrameTap(RTCMediaType media_type);
+
+  // Returns once no call to the previous observer is running.
+  void SetObserver(RTCEncodedFrameObserver* observer);
+  // Like SetObserver(nullptr) if |observer| is still the one set.
+  void ClearObserver(const RTCEncodedFrameObserver* observer);
+  // |track| is the receiver's track; its renderers decide what is decoded.
+  void SetDecodeOnDemand(
+      bool enabled, webrtc::scoped_refptr<webrtc::VideoTrackInterface> track);
+  RTCDecodeOnDemandStats GetDecodeOnDemandStats();
+  // Null stops decrypting.
+  void SetFrameCrypto(webrtc::scoped_refptr<FrameCrypto> crypto);
+  // Stops decrypting if |crypto| is still the one set.
+  void ClearFrameCrypto(const FrameCrypto* crypto);
+
+  void Transform(
+      std::unique_ptr<webrtc::TransformableFrameInterface> frame) override;
+  void RegisterTransformedFrameCallback(
+      webrtc::scoped_refptr<webrtc::TransformedFrameCallback> callback)
+      override;
+  void RegisterTransformedFrameSinkCallback(
+      webrtc::scoped_refptr<webrtc::TransformedFrameCallback> callback,
+      uint32_t ssrc) override;
+  void UnregisterTransformedFrameCallback() override;
+  void UnregisterTransformedFrameSinkCallback(uint32_t ssrc) override;
+
+ private:
+  // Whether |frame| is decoded; may ask for a key frame.
+  bool ShouldDecode(const webrtc::TransformableFrameInterface& frame)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  const RTCMediaType media_type_;
+  webrtc::Mutex mutex_;
+  // Keyed by SSRC; audio receivers register a single callback under 0.
+  std::map<uint32_t, webrtc::scoped_refptr<webrtc::TransformedFrameCallback>>
+      decoders_ RTC_GUARDED_BY(mutex_);
+  bool decode_on_demand_ RTC_GUARDED_BY(mutex_) = false;
+  webrtc::scoped_refptr<webrtc::VideoTrackInterface> demand_track_
+      RTC_GUARDED_BY(mutex_);
+  // Set from the first skipped frame until the next key frame is decoded.
+  bool skipping_ RTC_GUARDED_BY(mutex_) = false;
+  int64_t last_key_frame_request_ms_ RTC_GUARDED_BY(mutex_) = 0;
+  uint64_t frames_decoded_ RTC_GUARDED_BY(mutex_) = 0;
+  uint64_t frames_skipped_ RTC_GUARDED_BY(mutex_) = 0;
+  uint64_t key_frame_requests_ RTC_GUARDED_BY(mutex_) = 0;
+  webrtc::scoped_refptr<FrameCrypto> crypto_ RTC_GUARDED_BY(mutex_);
+  // Held while the observer runs.
+  webrtc::Mutex observer_mutex_;
+  RTCEncodedFrameObserver* observer_ RTC_GUARDED_BY(observer_mutex_) =
+      nullptr;
+};
+
+// Installed on a sender between encoder and packetizer. While enabled the
+// encoder's own frames are dropped and Send() feeds frames taken from a
+// receiver, or SendAudio() frames supplied by the application, to the
+// packetizer instead; otherwise it passes frames through. With a
+// FrameCrypto set, every frame is encrypted on its way to the packetizer.
+class EncodedFrameInjector : public webrtc::FrameTransformerInterface {
+ public:
+  explicit EncodedFrameInjector(RTCMediaType media_type);
+
+  // |payload_types| maps lower-case MIME types to the sender's negotiated
+  // payload types.
+  void Enable(std::map<std::string, uint8_t> payload_types);
+  void Disable();
+  // Null stops encrypting.
+  void SetFrameCrypto(webrtc::scoped_refptr<FrameCrypto> crypto);
+  // Stops encrypting if |crypto| is still the one set.
+  void ClearFrameCrypto(const FrameCrypto* crypto);
+
+  bool Send(scoped_refptr<RTCEncodedFrameImpl> frame);
+  // Copies |data| into a new audio frame; for audio injectors only.
+  bool SendAudio(const std::string& mime_type,
+                 webrtc::ArrayView<const uint8_t> data,
+                 uint32_t rtp_timestamp);
+
+  void Transform(
+      std::unique_ptr<webrtc::TransformableFrameInterface> frame) override;
+  void RegisterTransformedFrameCallback(
+      webrtc::scoped_refptr<webrtc::TransformedFrameCallback> callback)
+      override;
+  void RegisterTransformedFrameSinkCallback(
+      webrtc::scoped_refptr<webrtc::TransformedFrameCallback> callback,
+      uint32_t ssrc) override;
+  void UnregisterTransformedFrameCallback() override;
+  void UnregisterTransformedFrameSinkCallback(uint32_t ssrc) override;
+
+ private:
+  webrtc::scoped_refptr<webrtc::TransformedFrameCallback> Packetizer(
+      uint32_t ssrc) RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  // Finds where an injected frame of |mime_type| goes and what encrypts it;
+  // false while disabled, unregistered or for a codec that was not
+  // negotiated.
+  bool Route(const std::string& mime_type, uint8_t* payload_type,
+             uint32_t* ssrc,
+             webrtc::scoped_refptr<webrtc::TransformedFrameCallback>*
+                 packetizer,
+             webrtc::scoped_refptr<FrameCrypto>* crypto);
+
+  const RTCMediaType media_type_;
+  webrtc::Mutex mutex_;
+  bool enabled_ RTC_GUARDED_BY(mutex_) = false;
+  std::map<std::string, uint8_t> payload_types_ RTC_GUARDED_BY(mutex_);
+  webrtc::scoped_refptr<FrameCrypto> crypto_ RTC_GUARDED_BY(mutex_);
+  // In registration order, so the first entry is the first stream.
+  std::vector<std::pair<
+      uint32_t, webrtc::scoped_refptr<webrtc::TransformedFrameCallback>>>
+      packetizers_ RTC_GUARDED_BY(mutex_);
+};
+
+// Transformers are looked up by native object because a sender or receiver
+// can have several wrappers, and WebRTC keeps only the last transformer it
+// was given. Without one, |create| makes it and sets |*created|; the caller
+// then installs it.
+webrtc::scoped_refptr<EncodedFrameTap> FindEncodedFrameTap(
+    webrtc::RtpReceiverInterface* receiver, bool create, bool* created);
+webrtc::scoped_refptr<EncodedFrameInjector> FindEncodedFrameInjector(
+    webrtc::RtpSenderInterface* sender, bool create, bool* created);
+
+// Every tap of a live receiver.
+std::vector<webrtc::scoped_refptr<EncodedFrameTap>> AllEncodedFrameTaps();
+
+}  // namespace lumenrtc_bridge
+
+#endif  // INTERNAL_ENCODED_FRAME_FORWARDING_H_
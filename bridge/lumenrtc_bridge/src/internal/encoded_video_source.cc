@@ -0,0 +1,355 @@
+#include "src/internal/encoded_video_source.h"
+
+#include <unordered_set>
+#include <utility>
+
+#include "absl/strings/match.h"
+#include "api/make_ref_counted.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/video_frame.h"
+#include "modules/video_coding/include/video_codec_interface.h"
+#include "modules/video_coding/include/video_error_codes.h"
+#include "rtc_base/logging.h"
+
+namespace lumenrtc_bridge {
+
+namespace {
+
+// The encoder cannot tell buffer classes apart without RTTI, so live
+// EncodedVideoBuffers are registered by address.
+webrtc::Mutex& BufferRegistryMutex() {
+  static webrtc::Mutex* mutex = new webrtc::Mutex();
+  return *mutex;
+}
+
+std::unordered_set<const webrtc::VideoFrameBuffer*>& BufferRegistry() {
+  static auto* buffers =
+      new std::unordered_set<const webrtc::VideoFrameBuffer*>();
+  return *buffers;
+}
+
+}  // namespace
+
+EncodedVideoSource::EncodedVideoSource(std::string codec)
+    : codec_(std::move(codec)) {}
+
+EncodedVideoSource::~EncodedVideoSource() = default;
+
+bool EncodedVideoSource::IsSupportedCodec(const std::string& codec) {
+  return absl::EqualsIgnoreCase(codec, "H264") ||
+         absl::EqualsIgnoreCase(codec, "VP8");
+}
+
+bool EncodedVideoSource::Push(const uint8_t* data, size_t size, int width,
+                              int height, bool key_frame,
+                              int64_t timestamp_us) {
+  if (!data || size == 0 || width <= 0 || height <= 0) {
+    return false;
+  }
+  webrtc::MutexLock lock(&mutex_);
+  webrtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer =
+      webrtc::make_ref_counted<EncodedVideoBuffer>(
+          webrtc::EncodedImageBuffer::Create(data, size), width, height,
+          key_frame, ++sequence_,
+          webrtc::scoped_refptr<EncodedVideoSource>(this));
+  OnFrame(webrtc::VideoFrame::Builder()
+              .set_video_frame_buffer(buffer)
+              .set_timestamp_us(timestamp_us)
+              .build());
+  return true;
+}
+
+void EncodedVideoSource::SetKeyFrameRequestCallback(
+    std::function<void()> callback) {
+  webrtc::MutexLock lock(&callback_mutex_);
+  key_frame_request_ = std::move(callback);
+}
+
+void EncodedVideoSource::RequestKeyFrame() {
+  webrtc::MutexLock lock(&callback_mutex_);
+  if (key_frame_request_) {
+    key_frame_request_();
+  }
+}
+
+EncodedVideoBuffer::EncodedVideoBuffer(
+    webrtc::scoped_refptr<webrtc::EncodedImageBuffer> data, int width,
+    int height, bool key_frame, uint64_t sequence,
+    webrtc::scoped_refptr<EncodedVideoSource> source)
+    : data_(std::move(data)),
+      width_(width),
+      height_(height),
+      key_frame_(key_frame),
+      sequence_(sequence),
+      source_(std::move(source)) {
+  webrtc::MutexLock lock(&BufferRegistryMutex());
+  BufferRegistry().insert(this);
+}
+
+EncodedVideoBuffer::~EncodedVideoBuffer() {
+  webrtc::MutexLock lock(&BufferRegistryMutex());
+  BufferRegistry().erase(this);
+}
+
+const EncodedVideoBuffer* EncodedVideoBuffer::From(
+    const webrtc::VideoFrameBuffer* buffer) {
+  if (!buffer || buffer->type() != Type::kNative) {
+    return nullptr;
+  }
+  webrtc::MutexLock lock(&BufferRegistryMutex());
+  return BufferRegistry().count(buffer)
+             ? static_cast<const EncodedVideoBuffer*>(buffer)
+             : nullptr;
+}
+
+webrtc::scoped_refptr<webrtc::I420BufferInterface>
+EncodedVideoBuffer::ToI420() {
+  webrtc::scoped_refptr<webrtc::I420Buffer> black =
+      webrtc::I420Buffer::Create(width_, height_);
+  webrtc::I420Buffer::SetBlack(black.get());
+  return black;
+}
+
+webrtc::scoped_refptr<webrtc::VideoFrameBuffer>
+EncodedVideoBuffer::CropAndScale(int offset_x, int offset_y, int crop_width,
+                                 int crop_height, int scaled_width,
+                                 int scaled_height) {
+  return webrtc::scoped_refptr<webrtc::VideoFrameBuffer>(this);
+}
+
+PassthroughVideoEncoderFactory::PassthroughVideoEncoderFactory(
+    std::unique_ptr<webrtc::VideoEncoderFactory> factory)
+    : factory_(std::move(factory)) {}
+
+std::vector<webrtc::SdpVideoFormat>
+PassthroughVideoEncoderFactory::GetSupportedFormats() const {
+  return factory_->GetSupportedFormats();
+}
+
+std::vector<webrtc::SdpVideoFormat>
+PassthroughVideoEncoderFactory::GetImplementations() const {
+  return factory_->GetImplementations();
+}
+
+webrtc::VideoEncoderFactory::CodecSupport
+PassthroughVideoEncoderFactory::QueryCodecSupport(
+    const webrtc::SdpVideoFormat& format,
+    std::optional<std::string> scalability_mode) const {
+  return factory_->QueryCodecSupport(format, std::move(scalability_mode));
+}
+
+std::unique_ptr<webrtc::VideoEncoder> PassthroughVideoEncoderFactory::Create(
+    const webrtc::Environment& env, const webrtc::SdpVideoFormat& format) {
+  std::unique_ptr<webrtc::VideoEncoder> encoder = factory_->Create(env, format);
+  if (!encoder) {
+    return nullptr;
+  }
+  return std::make_unique<PassthroughVideoEncoder>(std::move(encoder), format);
+}
+
+std::unique_ptr<webrtc::VideoEncoderFactory::EncoderSelectorInterface>
+PassthroughVideoEncoderFactory::GetEncoderSelector() const {
+  return factory_->GetEncoderSelector();
+}
+
+PassthroughVideoEncoder::PassthroughVideoEncoder(
+    std::unique_ptr<webrtc::VideoEncoder> encoder,
+    const webrtc::SdpVideoFormat& format)
+    : encoder_(std::move(encoder)),
+      format_(format),
+      codec_type_(webrtc::PayloadStringToCodecType(format.name)) {}
+
+void PassthroughVideoEncoder::SetFecControllerOverride(
+    webrtc::FecControllerOverride* fec_controller_override) {
+  encoder_->SetFecControllerOverride(fec_controller_override);
+}
+
+int PassthroughVideoEncoder::InitEncode(
+    const webrtc::VideoCodec* codec_settings, const Settings& settings) {
+  codec_settings_ = *codec_settings;
+  settings_ = settings;
+  // A reconfigured stream starts over at a key frame.
+  key_frame_pending_ = true;
+  if (!encoder_initialized_) {
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+  encoder_initialized_ = false;
+  return InitEncoder();
+}
+
+int32_t PassthroughVideoEncoder::InitEncoder() {
+  if (!codec_settings_) {
+    return WEBRTC_VIDEO_CODEC_UNINITIALIZED;
+  }
+  int32_t result = encoder_->InitEncode(&*codec_settings_, *settings_);
+  if (result != WEBRTC_VIDEO_CODEC_OK) {
+    return result;
+  }
+  encoder_initialized_ = true;
+  if (rates_) {
+    encoder_->SetRates(*rates_);
+  }
+  return WEBRTC_VIDEO_CODEC_OK;
+}
+
+int32_t PassthroughVideoEncoder::RegisterEncodeCompleteCallback(
+    webrtc::EncodedImageCallback* callback) {
+  callback_ = callback;
+  return encoder_->RegisterEncodeCompleteCallback(callback);
+}
+
+int32_t PassthroughVideoEncoder::Release() {
+  if (!encoder_initialized_) {
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+  encoder_initialized_ = false;
+  return encoder_->Release();
+}
+
+int32_t PassthroughVideoEncoder::Encode(
+    const webrtc::VideoFrame& frame,
+    const std::vector<webrtc::VideoFrameType>* frame_types) {
+  bool key_frame_requested = false;
+  if (frame_types) {
+    for (webrtc::VideoFrameType type : *frame_types) {
+      key_frame_requested |= type == webrtc::VideoFrameType::kVideoFrameKey;
+    }
+  }
+  const EncodedVideoBuffer* encoded =
+      EncodedVideoBuffer::From(frame.video_frame_buffer().get());
+  if (encoded) {
+    passthrough_ = true;
+    return SendEncoded(*encoded, frame, key_frame_requested);
+  }
+  passthrough_ = false;
+  return EncodeRaw(frame, frame_types);
+}
+
+int32_t PassthroughVideoEncoder::EncodeRaw(
+    const webrtc::VideoFrame& frame,
+    const std::vector<webrtc::VideoFrameType>* frame_types) {
+  if (!encoder_initialized_) {
+    int32_t result = InitEncoder();
+    if (result != WEBRTC_VIDEO_CODEC_OK) {
+      return result;
+    }
+  }
+  // GetEncoderInfo() claims native buffer support on the wrapped encoder's
+  // behalf, so convert here what it cannot take.
+  if (frame.video_frame_buffer()->type() ==
+          webrtc::VideoFrameBuffer::Type::kNative &&
+      !encoder_->GetEncoderInfo().supports_native_handle) {
+    webrtc::VideoFrame converted = frame;
+    converted.set_video_frame_buffer(frame.video_frame_buffer()->ToI420());
+    return encoder_->Encode(converted, frame_types);
+  }
+  return encoder_->Encode(frame, frame_types);
+}
+
+int32_t PassthroughVideoEncoder::SendEncoded(const EncodedVideoBuffer& buffer,
+                                             const webrtc::VideoFrame& frame,
+                                             bool key_frame_requested) {
+  if (!callback_) {
+    return WEBRTC_VIDEO_CODEC_UNINITIALIZED;
+  }
+  if (!absl::EqualsIgnoreCase(buffer.source()->codec(), format_.name)) {
+    if (!codec_mismatch_logged_) {
+      RTC_LOG(LS_WARNING) << "Dropping " << buffer.source()->codec()
+                          << " units on a sender negotiated for "
+                          << format_.name;
+      codec_mismatch_logged_ = true;
+    }
+    callback_->OnDroppedFrame(
+        webrtc::EncodedImageCallback::DropReason::kDroppedByEncoder);
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+
+  // Receivers cannot decode past a request or a unit dropped before the
+  // encoder without a key frame, so deltas would only be discarded there.
+  const bool gap = buffer.sequence() != last_sequence_ + 1;
+  last_sequence_ = buffer.sequence();
+  if (!buffer.key_frame() && (key_frame_requested || gap)) {
+    if (key_frame_requested || !key_frame_pending_) {
+      buffer.source()->RequestKeyFrame();
+    }
+    key_frame_pending_ = true;
+  }
+  if (key_frame_pending_ && !buffer.key_frame()) {
+    callback_->OnDroppedFrame(
+        webrtc::EncodedImageCallback::DropReason::kDroppedByEncoder);
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+  key_frame_pending_ = false;
+
+  webrtc::EncodedImage image;
+  image.SetEncodedData(buffer.data());
+  image._encodedWidth = buffer.width();
+  image._encodedHeight = buffer.height();
+  image.SetRtpTimestamp(frame.rtp_timestamp());
+  image.capture_time_ms_ = frame.render_time_ms();
+  image._frameType = buffer.key_frame() ? webrtc::VideoFrameType::kVideoFrameKey
+                                        : webrtc::VideoFrameType::kVideoFrameDelta;
+  image.rotation_ = frame.rotation();
+
+  webrtc::CodecSpecificInfo info;
+  info.codecType = codec_type_;
+  if (codec_type_ == webrtc::kVideoCodecH264) {
+    auto mode = format_.parameters.find("packetization-mode");
+    info.codecSpecific.H264.packetization_mode =
+        mode != format_.parameters.end() && mode->second == "1"
+            ? webrtc::H264PacketizationMode::NonInterleaved
+            : webrtc::H264PacketizationMode::SingleNalUnit;
+  } else if (codec_type_ == webrtc::kVideoCodecVP8) {
+    info.codecSpecific.VP8.nonReference = false;
+    info.codecSpecific.VP8.temporalIdx = webrtc::kNoTemporalIdx;
+    info.codecSpecific.VP8.layerSync = false;
+    info.codecSpecific.VP8.keyIdx = webrtc::kNoKeyIdx;
+  }
+  callback_->OnEncodedImage(image, &info);
+  return WEBRTC_VIDEO_CODEC_OK;
+}
+
+void PassthroughVideoEncoder::SetRates(const RateControlParameters& parameters) {
+  rates_ = parameters;
+  if (encoder_initialized_) {
+    encoder_->SetRates(parameters);
+  }
+}
+
+void PassthroughVideoEncoder::OnPacketLossRateUpdate(float packet_loss_rate) {
+  if (encoder_initialized_) {
+    encoder_->OnPacketLossRateUpdate(packet_loss_rate);
+  }
+}
+
+void PassthroughVideoEncoder::OnRttUpdate(int64_t rtt_ms) {
+  if (encoder_initialized_) {
+    encoder_->OnRttUpdate(rtt_ms);
+  }
+}
+
+void PassthroughVideoEncoder::OnLossNotification(
+    const LossNotification& loss_notification) {
+  if (encoder_initialized_) {
+    encoder_->OnLossNotification(loss_notification);
+  }
+}
+
+webrtc::VideoEncoder::EncoderInfo PassthroughVideoEncoder::GetEncoderInfo()
+    const {
+  if (!passthrough_) {
+    EncoderInfo info = encoder_->GetEncoderInfo();
+    info.supports_native_handle = true;
+    return info;
+  }
+  // Pre-encoded units cannot be scaled or rate controlled, so keep the
+  // stream's quality scaler and frame dropper out of the way.
+  EncoderInfo info;
+  info.implementation_name = "Passthrough";
+  info.supports_native_handle = true;
+  info.has_trusted_rate_controller = true;
+  info.scaling_settings = ScalingSettings::kOff;
+  return info;
+}
+
+}  // namespace lumenrtc_bridge
@@ -0,0 +1,181 @@
+#ifndef INTERNAL_ENCODED_VIDEO_SOURCE_H_
+#define INTERNAL_ENCODED_VIDEO_SOURCE_H_
+
+#include <stdint.h>
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/scoped_refptr.h"
+#include "api/video/encoded_image.h"
+#include "api/video/video_frame_buffer.h"
+#include "api/video_codecs/sdp_video_format.h"
+#include "api/video_codecs/video_codec.h"
+#include "api/video_codecs/video_encoder.h"
+#include "api/video_codecs/video_encoder_factory.h"
+#include "media/base/adapted_video_track_source.h"
+#include "rtc_base/synchronization/mutex.h"
+
+namespace lumenrtc_bridge {
+
+// Video track source fed with access units that are already encoded.
+//
+// Each unit is handed down the normal capture path as an EncodedVideoBuffer,
+// and the PassthroughVideoEncoder the factory wraps around every encoder
+// emits it unchanged as the encoder output. Packetization, pacing, bandwidth
+// estimation and retransmission run as for any other track, and key frame
+// requests from receivers reach the source through the encoder.
+//
+// Sink wants are not applied: encoded units cannot be scaled or dropped
+// selectively, so the sender's resolution and frame rate are the stream's.
+class EncodedVideoSource : public webrtc::AdaptedVideoTrackSource {
+ public:
+  // |codec| is the SDP codec name of the pushed units, e.g. "H264".
+  explicit EncodedVideoSource(std::string codec);
+  ~EncodedVideoSource() override;
+
+  // Returns true for the codecs a PassthroughVideoEncoder can packetize.
+  static bool IsSupportedCodec(const std::string& codec);
+
+  // Copies one access unit. H.264 units are Annex B byte streams. Returns
+  // false for empty data or a non-positive size.
+  bool Push(const uint8_t* data, size_t size, int width, int height,
+            bool key_frame, int64_t timestamp_us);
+
+  // |callback| runs on the encoder thread whenever a receiver needs a key
+  // frame. Returns once a call to the previous callback has finished.
+  void SetKeyFrameRequestCallback(std::function<void()> callback);
+  void RequestKeyFrame();
+
+  const std::string& codec() const { return codec_; }
+
+  // VideoTrackSourceInterface
+  bool is_screencast() const override { return false; }
+  std::optional<bool> needs_denoising() const override { return false; }
+  SourceState state() const override { return kLive; }
+  bool remote() const override { return false; }
+
+ private:
+  const std::string codec_;
+  webrtc::Mutex mutex_;
+  uint64_t sequence_ RTC_GUARDED_BY(mutex_) = 0;
+  // Held while the callback runs.
+  webrtc::Mutex callback_mutex_;
+  std::function<void()> key_frame_request_ RTC_GUARDED_BY(callback_mutex_);
+};
+
+// An encoded access unit travelling from an EncodedVideoSource to the
+// encoder. Scaling and cropping leave it untouched; ToI420() gives a black
+// frame of its size for sinks that need pixels.
+class EncodedVideoBuffer : public webrtc::VideoFrameBuffer {
+ public:
+  EncodedVideoBuffer(webrtc::scoped_refptr<webrtc::EncodedImageBuffer> data,
+                     int width, int height, bool key_frame, uint64_t sequence,
+                     webrtc::scoped_refptr<EncodedVideoSource> source);
+  ~EncodedVideoBuffer() override;
+
+  // Returns |buffer| if it is an EncodedVideoBuffer, and null otherwise.
+  static const EncodedVideoBuffer* From(const webrtc::VideoFrameBuffer* buffer);
+
+  Type type() const override { return Type::kNative; }
+  int width() const override { return width_; }
+  int height() const override { return height_; }
+  webrtc::scoped_refptr<webrtc::I420BufferInterface> ToI420() override;
+  webrtc::scoped_refptr<webrtc::VideoFrameBuffer> CropAndScale(
+      int offset_x, int offset_y, int crop_width, int crop_height,
+      int scaled_width, int scaled_height) override;
+
+  const webrtc::scoped_refptr<webrtc::EncodedImageBuffer>& data() const {
+    return data_;
+  }
+  bool key_frame() const { return key_frame_; }
+  // Consecutive per source, so a gap means the encoder missed a unit.
+  uint64_t sequence() const { return sequence_; }
+  EncodedVideoSource* source() const { return source_.get(); }
+
+ private:
+  const webrtc::scoped_refptr<webrtc::EncodedImageBuffer> data_;
+  const int width_;
+  const int height_;
+  const bool key_frame_;
+  const uint64_t sequence_;
+  const webrtc::scoped_refptr<EncodedVideoSource> source_;
+};
+
+// Wraps each encoder of |factory| in a PassthroughVideoEncoder, so any video
+// sender can carry an EncodedVideoSource.
+class PassthroughVideoEncoderFactory : public webrtc::VideoEncoderFactory {
+ public:
+  explicit PassthroughVideoEncoderFactory(
+      std::unique_ptr<webrtc::VideoEncoderFactory> factory);
+
+  std::vector<webrtc::SdpVideoFormat> GetSupportedFormats() const override;
+  std::vector<webrtc::SdpVideoFormat> GetImplementations() const override;
+  CodecSupport QueryCodecSupport(
+      const webrtc::SdpVideoFormat& format,
+      std::optional<std::string> scalability_mode) const override;
+  std::unique_ptr<webrtc::VideoEncoder> Create(
+      const webrtc::Environment& env,
+      const webrtc::SdpVideoFormat& format) override;
+  std::unique_ptr<EncoderSelectorInterface> GetEncoderSelector()
+      const override;
+
+ private:
+  const std::unique_ptr<webrtc::VideoEncoderFactory> factory_;
+};
+
+// Sends EncodedVideoBuffers as they are and encodes every other frame with
+// the wrapped encoder, which is initialized on its first raw frame. While
+// the receivers wait for a key frame, after a request or a unit the encoder
+// never saw, delta units are dropped and the source is asked for one.
+class PassthroughVideoEncoder : public webrtc::VideoEncoder {
+ public:
+  PassthroughVideoEncoder(std::unique_ptr<webrtc::VideoEncoder> encoder,
+                          const webrtc::SdpVideoFormat& format);
+
+  void SetFecControllerOverride(
+      webrtc::FecControllerOverride* fec_controller_override) override;
+  int InitEncode(const webrtc::VideoCodec* codec_settings,
+                 const Settings& settings) override;
+  int32_t RegisterEncodeCompleteCallback(
+      webrtc::EncodedImageCallback* callback) override;
+  int32_t Release() override;
+  int32_t Encode(const webrtc::VideoFrame& frame,
+                 const std::vector<webrtc::VideoFrameType>* frame_types)
+      override;
+  void SetRates(const RateControlParameters& parameters) override;
+  void OnPacketLossRateUpdate(float packet_loss_rate) override;
+  void OnRttUpdate(int64_t rtt_ms) override;
+  void OnLossNotification(const LossNotification& loss_notification) override;
+  EncoderInfo GetEncoderInfo() const override;
+
+ private:
+  int32_t InitEncoder();
+  int32_t EncodeRaw(const webrtc::VideoFrame& frame,
+                    const std::vector<webrtc::VideoFrameType>* frame_types);
+  int32_t SendEncoded(const EncodedVideoBuffer& buffer,
+                      const webrtc::VideoFrame& frame,
+                      bool key_frame_requested);
+
+  const std::unique_ptr<webrtc::VideoEncoder> encoder_;
+  const webrtc::SdpVideoFormat format_;
+  const webrtc::VideoCodecType codec_type_;
+  webrtc::EncodedImageCallback* callback_ = nullptr;
+  std::optional<webrtc::VideoCodec> codec_settings_;
+  std::optional<Settings> settings_;
+  std::optional<RateControlParameters> rates_;
+  bool encoder_initialized_ = false;
+  // Set while the last frame was an EncodedVideoBuffer.
+  bool passthrough_ = false;
+  bool key_frame_pending_ = true;
+  uint64_t last_sequence_ = 0;
+  bool codec_mismatch_logged_ = false;
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // INTERNAL_ENCODED_VIDEO_SOURCE_H_
@@ -0,0 +1,130 @@
+#include "src/internal/factory_threads.h"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+
+#include "api/make_ref_counted.h"
+#include "src/internal/thread_tuning.h"
+
+namespace lumenrtc_bridge {
+
+webrtc::scoped_refptr<FactoryThreads> FactoryThreads::Create(
+    const FactoryThreadConfig& config) {
+  webrtc::scoped_refptr<FactoryThreads> threads =
+      webrtc::make_ref_counted<FactoryThreads>();
+
+  threads->worker_thread_ = webrtc::Thread::Create();
+  threads->worker_thread_->SetName("lumenrtc_worker", nullptr);
+  if (!threads->worker_thread_->Start()) {
+    return nullptr;
+  }
+  // Nothing else has been posted yet, so this runs before any WebRTC work.
+  threads->worker_report_ = threads->worker_thread_->BlockingCall(
+      [&config] { return ApplyThreadTuning(config.worker); });
+
+  if (config.virtual_network.enabled) {
+    threads->virtual_network_ = VirtualNetwork::Create();
+    if (!threads->virtual_network_) {
+      return nullptr;
+    }
+  }
+
+  const int count = threads->virtual_network_
+                        ? 1
+                        : std::max(config.network_thread_count, 1);
+  const int processors = ProcessorCount();
+  for (int i = 0; i < count; ++i) {
+    std::unique_ptr<webrtc::Thread> network =
+        threads->virtual_network_
+            ? threads->virtual_network_->CreateNetworkThread()
+            : webrtc::Thread::CreateWithSocketServer();
+    network->SetName(
+        count == 1 ? "lumenrtc_network" : "lumenrtc_net" + std::to_string(i),
+        nullptr);
+    if (!network->Start()) {
+      return nullptr;
+    }
+    const int cpu = config.network_first_cpu >= 0
+                        ? (config.network_first_cpu + i) % processors
+                        : -1;
+    RTCThreadReport report = network->BlockingCall([&config, cpu] {
+      RTCThreadReport applied = ApplyThreadTuning(config.network);
+      if (cpu >= 0 && PinCurrentThreadToCpu(cpu)) {
+        // The spread pin narrows the role mask; report what stuck.
+        RTCThreadReport pinned = CurrentThreadReport();
+        pinned.failures = applied.failures;
+        return pinned;
+      }
+      return applied;
+    });
+    threads->network_threads_.push_back(std::move(network));
+    threads->network_reports_.push_back(report);
+  }
+  if (threads->virtual_network_ &&
+      !threads->virtual_network_->SetConditions(config.virtual_network)) {
+    return nullptr;
+  }
+  return threads;
+}
+
+FactoryThreads::~FactoryThreads() {
+  // Same teardown order as a dedicated factory: network before worker.
+  network_threads_.clear();
+  worker_thread_.reset();
+  // Its socket server backed the network thread, so it goes last.
+  virtual_network_ = nullptr;
+}
+
+FactoryThreadPool& FactoryThreadPool::Instance() {
+  static FactoryThreadPool* const pool = new FactoryThreadPool();
+  return *pool;
+}
+
+webrtc::scoped_refptr<FactoryThreads> FactoryThreadPool::Acquire(
+    int pool_size, const FactoryThreadConfig& config) {
+  FactoryThreadPool& pool = Instance();
+  webrtc::MutexLock lock(&pool.mutex_);
+  if (pool.max_groups_ == 0) {
+    size_t size = pool_size > 0 ? static_cast<size_t>(pool_size)
+                                : std::thread::hardware_concurrency() / 2;
+    pool.max_groups_ = std::max<size_t>(size, 1);
+  }
+
+  auto least_loaded = std::min_element(
+      pool.groups_.begin(), pool.groups_.end(),
+      [](const webrtc::scoped_refptr<FactoryThreads>& a,
+         const webrtc::scoped_refptr<FactoryThreads>& b) {
+        return a->factory_count() < b->factory_count();
+      });
+  webrtc::scoped_refptr<FactoryThreads> threads;
+  if (least_loaded != pool.groups_.end() &&
+      ((*least_loaded)->factory_count() == 0 ||
+       pool.groups_.size() >= pool.max_groups_)) {
+    threads = *least_loaded;
+  } else {
+    threads = FactoryThreads::Create(config);
+    if (threads) {
+      pool.groups_.push_back(threads);
+    } else if (least_loaded != pool.groups_.end()) {
+      threads = *least_loaded;
+    }
+  }
+  if (threads) {
+    threads->AddFactory();
+  }
+  return threads;
+}
+
+void FactoryThreadPool::ReleaseIdle() {
+  FactoryThreadPool& pool = Instance();
+  webrtc::MutexLock lock(&pool.mutex_);
+  pool.groups_.erase(
+      std::remove_if(pool.groups_.begin(), pool.groups_.end(),
+                     [](const webrtc::scoped_refptr<FactoryThreads>& threads) {
+                       return threads->factory_count() == 0;
+                     }),
+      pool.groups_.end());
+}
+
+}  // namespace lumenrtc_bridge
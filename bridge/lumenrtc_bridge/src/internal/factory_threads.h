@@ -0,0 +1,118 @@
+#ifndef INTERNAL_FACTORY_THREADS_H_
+#define INTERNAL_FACTORY_THREADS_H_
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "api/ref_count.h"
+#include "api/scoped_refptr.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread.h"
+#include "rtc_types.h"
+#include "src/internal/virtual_network.h"
+
+namespace lumenrtc_bridge {
+
+// How a FactoryThreads group lays out its threads.
+struct FactoryThreadConfig {
+  // Network threads in the group. Each one backs its own WebRTC factory
+  // shard, so ICE/DTLS/SRTP work for different peer connections can run on
+  // different cores.
+  int network_thread_count = 1;
+  // When >= 0, network thread i is pinned to CPU (first + i) modulo the
+  // processor count. Pinning is a hint; failures are ignored.
+  int network_first_cpu = -1;
+  // Per-role scheduling, applied by whoever starts the thread: the group for
+  // worker and network, the factory for signaling, each desktop capturer for
+  // capture.
+  RTCThreadTuning worker;
+  RTCThreadTuning signaling;
+  RTCThreadTuning network;
+  RTCThreadTuning capture;
+  // When enabled, the single network thread runs on a VirtualNetwork instead
+  // of the OS socket server and network_thread_count is ignored.
+  RTCVirtualNetworkOptions virtual_network;
+};
+
+// Worker and network threads that back one or more peer connection
+// factories. A factory created with RTCFactoryThreadOptions::Mode::kShared or
+// kPooled holds a reference to an existing group instead of starting its own
+// threads; the threads stop when the last factory lets go of the group.
+class FactoryThreads : public webrtc::RefCountInterface {
+ public:
+  // Starts "lumenrtc_worker" and the network threads described by |config|.
+  // Returns nullptr if any thread fails to start.
+  static webrtc::scoped_refptr<FactoryThreads> Create(
+      const FactoryThreadConfig& config);
+
+  ~FactoryThreads() override;
+
+  webrtc::Thread* worker_thread() const { return worker_thread_.get(); }
+  webrtc::Thread* network_thread(size_t index = 0) const {
+    return network_threads_[index].get();
+  }
+  size_t network_thread_count() const { return network_threads_.size(); }
+
+  // Simulated network behind network_thread(); null for real networking.
+  webrtc::scoped_refptr<VirtualNetwork> virtual_network() const {
+    return virtual_network_;
+  }
+
+  // Scheduling the threads ended up with when the group started them.
+  const RTCThreadReport& worker_report() const { return worker_report_; }
+  const RTCThreadReport& network_report(size_t index) const {
+    return network_reports_[index];
+  }
+
+  // Number of factories currently running on this group. Used by the pool to
+  // place new factories on the least loaded group.
+  void AddFactory() { factory_count_.fetch_add(1, std::memory_order_relaxed); }
+  void RemoveFactory() {
+    factory_count_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  int factory_count() const {
+    return factory_count_.load(std::memory_order_relaxed);
+  }
+
+ protected:
+  FactoryThreads() = default;
+
+ private:
+  std::unique_ptr<webrtc::Thread> worker_thread_;
+  std::vector<std::unique_ptr<webrtc::Thread>> network_threads_;
+  webrtc::scoped_refptr<VirtualNetwork> virtual_network_;
+  RTCThreadReport worker_report_;
+  std::vector<RTCThreadReport> network_reports_;
+  std::atomic<int> factory_count_{0};
+};
+
+// Process-wide set of FactoryThreads groups shared by pooled factories.
+// The pool grows lazily up to its size and then hands out the group with the
+// fewest factories, so a handful of tenants still get a group each while a
+// hundred tenants share roughly one worker and one network thread per core.
+class FactoryThreadPool {
+ public:
+  // |pool_size| is the maximum number of groups; 0 picks half the hardware
+  // concurrency so worker plus network threads add up to the core count. The
+  // size is fixed by the first call. The returned group already counts the
+  // caller as one of its factories. |config| applies to groups started by
+  // this call.
+  static webrtc::scoped_refptr<FactoryThreads> Acquire(
+      int pool_size, const FactoryThreadConfig& config);
+
+  // Drops groups no factory is using. Called on runtime termination.
+  static void ReleaseIdle();
+
+ private:
+  static FactoryThreadPool& Instance();
+
+  webrtc::Mutex mutex_;
+  size_t max_groups_ RTC_GUARDED_BY(mutex_) = 0;
+  std::vector<webrtc::scoped_refptr<FactoryThreads>> groups_
+      RTC_GUARDED_BY(mutex_);
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // INTERNAL_FACTORY_THREADS_H_
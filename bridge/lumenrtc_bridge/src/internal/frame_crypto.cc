@@ -0,0 +1,718 @@
+#include "src/internal/frame_crypto.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/strings/match.h"
+#include "openssl/evp.h"
+#include "openssl/mem.h"
+#include "openssl/rand.h"
+
+namespace lumenrtc_bridge {
+
+namespace {
+
+constexpr size_t kTagSize = 16;
+constexpr size_t kIvSize = 12;
+constexpr size_t kAesKeySize = 16;
+constexpr size_t kRatchetMaterialSize = 32;
+constexpr uint32_t kPbkdf2Iterations = 100000;
+
+// How a codec's frames are split into clear and encrypted bytes.
+enum class Codec { kOther, kVp8, kH264, kH265, kAv1, kOpus };
+
+Codec CodecOf(const webrtc::TransformableFrameInterface& frame) {
+  // Every MIME type below fits the short string buffer, so this does not
+  // allocate.
+  const std::string mime_type = frame.GetMimeType();
+  if (absl::EqualsIgnoreCase(mime_type, "video/VP8")) {
+    return Codec::kVp8;
+  }
+  if (absl::EqualsIgnoreCase(mime_type, "video/H264")) {
+    return Codec::kH264;
+  }
+  if (absl::EqualsIgnoreCase(mime_type, "video/H265")) {
+    return Codec::kH265;
+  }
+  if (absl::EqualsIgnoreCase(mime_type, "video/AV1")) {
+    return Codec::kAv1;
+  }
+  if (absl::EqualsIgnoreCase(mime_type, "audio/opus")) {
+    return Codec::kOpus;
+  }
+  return Codec::kOther;
+}
+
+bool IsNalCodec(Codec codec) {
+  return codec == Codec::kH264 || codec == Codec::kH265;
+}
+
+// Bytes of an H.264 or H.265 frame up to and including the NAL header of
+// its first slice and one byte after it, so the packetizer still finds
+// every NAL unit; 0 without a slice.
+size_t NalClearBytes(webrtc::ArrayView<const uint8_t> data, bool h265) {
+  const size_t nal_header = h265 ? 2 : 1;
+  for (size_t i = 0; i + 2 < data.size(); ++i) {
+    if (data[i] != 0 || data[i + 1] != 0 || data[i + 2] != 1) {
+      continue;
+    }
+    const size_t nal = i + 3;
+    if (nal + nal_header + 1 > data.size()) {
+      break;
+    }
+    const uint8_t type = h265 ? (data[nal] >> 1) & 0x3f : data[nal] & 0x1f;
+    const bool slice = h265 ? type < 32 : type == 1 || type == 5;
+    if (slice) {
+      return nal + nal_header + 1;
+    }
+    i = nal;
+  }
+  return 0;
+}
+
+// Bytes at the start of |frame| left in the clear for its packetizer; false
+// for codecs whose packetizer parses the whole frame.
+bool ClearBytes(Codec codec, const webrtc::TransformableFrameInterface& frame,
+                webrtc::ArrayView<const uint8_t> data, size_t* header) {
+  switch (codec) {
+    case Codec::kVp8: {
+      // The payload header: ten bytes in key frames, three otherwise.
+      const bool key_frame =
+          static_cast<const webrtc::TransformableVideoFrameInterface&>(frame)
+              .IsKeyFrame();
+      *header = std::min<size_t>(data.size(), key_frame ? 10 : 3);
+      return true;
+    }
+    case Codec::kH264:
+    case Codec::kH265:
+      *header = NalClearBytes(data, codec == Codec::kH265);
+      return *header > 0;
+    case Codec::kAv1:
+      return false;
+    case Codec::kOpus:
+      // The TOC byte.
+      *header = std::min<size_t>(data.size(), 1);
+      return true;
+    case Codec::kOther:
+      *header = 0;
+      return true;
+  }
+  return false;
+}
+
+// Where the authenticated part of a clear header starts. Start codes and
+// parameter sets may be rewritten on the way, so of an H.264 or H.265
+// header only the slice's NAL header and the byte after it count.
+size_t AuthenticatedFrom(Codec codec, size_t header) {
+  switch (codec) {
+    case Codec::kH264:
+      return header - 2;
+    case Codec::kH265:
+      return header - 3;
+    default:
+      return 0;
+  }
+}
+
+// Appends |data| to |out| with an emulation prevention byte wherever two
+// zeros are followed by a byte up to 3, as in a NAL unit.
+void AppendEscaped(const uint8_t* data, size_t size,
+                   std::vector<uint8_t>* out) {
+  int zeros = 0;
+  for (size_t i = 0; i < size; ++i) {
+    if (zeros >= 2 && data[i] <= 3) {
+      out->push_back(3);
+      zeros = 0;
+    }
+    out->push_back(data[i]);
+    zeros = data[i] == 0 ? zeros + 1 : 0;
+  }
+}
+
+// Removes in place what AppendEscaped() added; returns the new size.
+size_t Unescape(uint8_t* data, size_t size) {
+  size_t out = 0;
+  int zeros = 0;
+  for (size_t i = 0; i < size; ++i) {
+    if (zeros >= 2 && data[i] == 3) {
+      zeros = 0;
+      continue;
+    }
+    data[out++] = data[i];
+    zeros = data[i] == 0 ? zeros + 1 : 0;
+  }
+  return out;
+}
+
+void WriteBigEndian32(uint8_t* out, uint32_t value) {
+  out[0] = static_cast<uint8_t>(value >> 24);
+  out[1] = static_cast<uint8_t>(value >> 16);
+  out[2] = static_cast<uint8_t>(value >> 8);
+  out[3] = static_cast<uint8_t>(value);
+}
+
+bool EndsWith(webrtc::ArrayView<const uint8_t> data,
+              const std::vector<uint8_t>& suffix) {
+  return !suffix.empty() && data.size() >= suffix.size() &&
+         memcmp(data.data() + data.size() - suffix.size(), suffix.data(),
+                suffix.size()) == 0;
+}
+
+// Encrypts |buffer|[header, size) in place, authenticating
+// |buffer|[authenticated, header), and appends the tag and the trailer.
+// |buffer| has room for kFrameCryptoOverhead more bytes. Returns the new
+// size, or 0.
+size_t SealInPlace(const FrameKey& key, int index, const uint8_t* iv,
+                   size_t authenticated, size_t header, size_t size,
+                   uint8_t* buffer) {
+  size_t sealed = 0;
+  if (!EVP_AEAD_CTX_seal(key.aead(), buffer + header, &sealed,
+                         size - header + kTagSize, iv, kIvSize,
+                         buffer + header, size - header,
+                         buffer + authenticated, header - authenticated)) {
+    return 0;
+  }
+  uint8_t* trailer = buffer + header + sealed;
+  memcpy(trailer, iv, kIvSize);
+  trailer[kIvSize] = kIvSize;
+  trailer[kIvSize + 1] = static_cast<uint8_t>(index);
+  return header + sealed + kIvSize + 2;
+}
+
+// The key index of what SealInPlace() made; false if |size| bytes with
+// |header| clear ones cannot be that.
+bool ReadTrailer(const uint8_t* buffer, size_t header, size_t size,
+                 int* index) {
+  if (size < header + kFrameCryptoOverhead || buffer[size - 2] != kIvSize) {
+    return false;
+  }
+  *index = buffer[size - 1];
+  return true;
+}
+
+// Reverses SealInPlace(); the plain frame is the first |*plain_size| bytes.
+bool OpenInPlace(const FrameKey& key, size_t authenticated, size_t header,
+                 size_t size, uint8_t* buffer, size_t* plain_size) {
+  const size_t sealed = size - header - kIvSize - 2;
+  const uint8_t* iv = buffer + header + sealed;
+  size_t opened = 0;
+  if (!EVP_AEAD_CTX_open(key.aead(), buffer + header, &opened, sealed, iv,
+                         kIvSize, buffer + header, sealed,
+                         buffer + authenticated, header - authenticated)) {
+    return false;
+  }
+  *plain_size = header + opened;
+  return true;
+}
+
+}  // namespace
+
+webrtc::scoped_refptr<const FrameKey> FrameKey::Create(
+    std::vector<uint8_t> material, const std::vector<uint8_t>& salt) {
+  if (material.empty()) {
+    return nullptr;
+  }
+  uint8_t aes_key[kAesKeySize];
+  if (!PKCS5_PBKDF2_HMAC(reinterpret_cast<const char*>(material.data()),
+                         material.size(), salt.data(), salt.size(),
+                         kPbkdf2Iterations, EVP_sha256(), sizeof(aes_key),
+                         aes_key)) {
+    return nullptr;
+  }
+  webrtc::scoped_refptr<FrameKey> key =
+      webrtc::make_ref_counted<FrameKey>(std::move(material));
+  // BoringSSL picks AES-NI and carry-less multiplication where the CPU has
+  // them.
+  const bool initialized =
+      EVP_AEAD_CTX_init(&key->aead_, EVP_aead_aes_128_gcm(), aes_key,
+                        sizeof(aes_key), EVP_AEAD_DEFAULT_TAG_LENGTH,
+                        nullptr) == 1;
+  OPENSSL_cleanse(aes_key, sizeof(aes_key));
+  if (!initialized) {
+    return nullptr;
+  }
+  return key;
+}
+
+std::vector<uint8_t> FrameKey::Ratchet(const std::vector<uint8_t>& material,
+                                       const std::vector<uint8_t>& salt) {
+  std::vector<uint8_t> next(kRatchetMaterialSize);
+  if (!PKCS5_PBKDF2_HMAC(reinterpret_cast<const char*>(material.data()),
+                         material.size(), salt.data(), salt.size(),
+                         kPbkdf2Iterations, EVP_sha256(), next.size(),
+                         next.data())) {
+    return {};
+  }
+  return next;
+}
+
+FrameKey::FrameKey(std::vector<uint8_t> material)
+    : material_(std::move(material)) {
+  EVP_AEAD_CTX_zero(&aead_);
+}
+
+FrameKey::~FrameKey() { EVP_AEAD_CTX_cleanup(&aead_); }
+
+const FrameKey* FrameKeyRing::Find(const std::string& participant_id,
+                                   int index) const {
+  auto participant = participant_keys_.find(participant_id);
+  if (participant != participant_keys_.end()) {
+    auto key = participant->second.find(index);
+    if (key != participant->second.end()) {
+      return key->second.get();
+    }
+  }
+  if (!shared_key_) {
+    return nullptr;
+  }
+  auto key = shared_keys_.find(index);
+  return key == shared_keys_.end() ? nullptr : key->second.get();
+}
+
+FrameKeyStore::FrameKeyStore(const KeyProviderOptions& options)
+    : ratchet_salt_(options.ratchet_salt.std_vector()),
+      ratchet_window_size_(std::max(options.ratchet_window_size, 0)),
+      failure_tolerance_(std::max(options.failure_tolerance, -1)),
+      key_ring_size_(std::clamp(options.key_ring_size, 1, MAX_KEYRING_SIZE)),
+      discard_frame_when_cryptor_not_ready_(
+          options.discard_frame_when_cryptor_not_ready) {
+  RAND_bytes(payload_iv_prefix_, sizeof(payload_iv_prefix_));
+  webrtc::scoped_refptr<FrameKeyRing> ring =
+      webrtc::make_ref_counted<FrameKeyRing>();
+  ring->shared_key_ = options.shared_key;
+  ring->uncrypted_magic_bytes_ = options.uncrypted_magic_bytes.std_vector();
+  webrtc::MutexLock lock(&mutex_);
+  ring_ = ring;
+}
+
+FrameKeyStore::~FrameKeyStore() = default;
+
+bool FrameKeyStore::SetSharedKey(int index, std::vector<uint8_t> material) {
+  if (!IsValidIndex(index)) {
+    return false;
+  }
+  webrtc::scoped_refptr<const FrameKey> key =
+      FrameKey::Create(std::move(material), ratchet_salt_);
+  if (!key) {
+    return false;
+  }
+  webrtc::MutexLock lock(&mutex_);
+  webrtc::scoped_refptr<FrameKeyRing> ring = Edit();
+  ring->shared_keys_[index] = std::move(key);
+  Publish(std::move(ring));
+  return true;
+}
+
+bool FrameKeyStore::SetKey(const std::string& participant_id, int index,
+                           std::vector<uint8_t> material) {
+  if (!IsValidIndex(index)) {
+    return false;
+  }
+  webrtc::scoped_refptr<const FrameKey> key =
+      FrameKey::Create(std::move(material), ratchet_salt_);
+  if (!key) {
+    return false;
+  }
+  webrtc::MutexLock lock(&mutex_);
+  webrtc::scoped_refptr<FrameKeyRing> ring = Edit();
+  ring->participant_keys_[participant_id][index] = std::move(key);
+  Publish(std::move(ring));
+  return true;
+}
+
+std::vector<uint8_t> FrameKeyStore::RatchetSharedKey(int index) {
+  uint64_t generation = 0;
+  webrtc::scoped_refptr<const FrameKeyRing> ring = Snapshot(&generation);
+  auto current = ring->shared_keys_.find(index);
+  if (current == ring->shared_keys_.end()) {
+    return {};
+  }
+  webrtc::scoped_refptr<const FrameKey> next = Ratcheted(*current->second);
+  if (!next) {
+    return {};
+  }
+  std::vector<uint8_t> material = next->material();
+  webrtc::MutexLock lock(&mutex_);
+  webrtc::scoped_refptr<FrameKeyRing> edited = Edit();
+  edited->shared_keys_[index] = std::move(next);
+  Publish(std::move(edited));
+  return material;
+}
+
+std::vector<uint8_t> FrameKeyStore::RatchetKey(
+    const std::string& participant_id, int index) {
+  uint64_t generation = 0;
+  webrtc::scoped_refptr<const FrameKeyRing> ring = Snapshot(&generation);
+  const FrameKey* current = ring->Find(participant_id, index);
+  if (!current) {
+    return {};
+  }
+  webrtc::scoped_refptr<const FrameKey> next = Ratcheted(*current);
+  if (!next) {
+    return {};
+  }
+  std::vector<uint8_t> material = next->material();
+  Advance(participant_id, index, std::move(next));
+  return material;
+}
+
+std::vector<uint8_t> FrameKeyStore::ExportSharedKey(int index) const {
+  uint64_t generation = 0;
+  webrtc::scoped_refptr<const FrameKeyRing> ring = Snapshot(&generation);
+  auto key = ring->shared_keys_.find(index);
+  if (key == ring->shared_keys_.end()) {
+    return {};
+  }
+  return key->second->material();
+}
+
+std::vector<uint8_t> FrameKeyStore::ExportKey(
+    const std::string& participant_id, int index) const {
+  uint64_t generation = 0;
+  webrtc::scoped_refptr<const FrameKeyRing> ring = Snapshot(&generation);
+  const FrameKey* key = ring->Find(participant_id, index);
+  if (!key) {
+    return {};
+  }
+  return key->material();
+}
+
+void FrameKeyStore::SetSifTrailer(std::vector<uint8_t> trailer) {
+  webrtc::MutexLock lock(&mutex_);
+  webrtc::scoped_refptr<FrameKeyRing> ring = Edit();
+  ring->sif_trailer_ = std::move(trailer);
+  Publish(std::move(ring));
+}
+
+webrtc::scoped_refptr<const FrameKey> FrameKeyStore::Ratcheted(
+    const FrameKey& key) const {
+  std::vector<uint8_t> material = FrameKey::Ratchet(key.material(),
+                                                    ratchet_salt_);
+  return FrameKey::Create(std::move(material), ratchet_salt_);
+}
+
+void FrameKeyStore::Advance(const std::string& participant_id, int index,
+                            webrtc::scoped_refptr<const FrameKey> key) {
+  webrtc::MutexLock lock(&mutex_);
+  webrtc::scoped_refptr<FrameKeyRing> ring = Edit();
+  auto participant = ring->participant_keys_.find(participant_id);
+  if (participant != ring->participant_keys_.end() &&
+      participant->second.count(index) != 0) {
+    participant->second[index] = std::move(key);
+  } else if (ring->shared_key_) {
+    ring->shared_keys_[index] = std::move(key);
+  } else {
+    return;
+  }
+  Publish(std::move(ring));
+}
+
+webrtc::scoped_refptr<const FrameKeyRing> FrameKeyStore::Snapshot(
+    uint64_t* generation) const {
+  webrtc::MutexLock lock(&mutex_);
+  *generation = generation_.load(std::memory_order_relaxed);
+  return ring_;
+}
+
+int FrameKeyStore::EncryptPayload(const std::string& participant_id,
+                                  int index, uint8_t* data, size_t size,
+                                  size_t capacity) {
+  if (!data || !IsValidIndex(index) ||
+      size > static_cast<size_t>(INT32_MAX) - kFrameCryptoOverhead ||
+      capacity < size + kFrameCryptoOverhead) {
+    return -1;
+  }
+  uint64_t generation = 0;
+  webrtc::scoped_refptr<const FrameKeyRing> ring = Snapshot(&generation);
+  const FrameKey* key = ring->Find(participant_id, index);
+  if (!key) {
+    return -1;
+  }
+  uint8_t iv[kIvSize];
+  const uint64_t count =
+      payload_count_.fetch_add(1, std::memory_order_relaxed);
+  memcpy(iv, payload_iv_prefix_, sizeof(payload_iv_prefix_));
+  WriteBigEndian32(iv + 4, static_cast<uint32_t>(count >> 32));
+  WriteBigEndian32(iv + 8, static_cast<uint32_t>(count));
+  const size_t sealed = SealInPlace(*key, index, iv, 0, 0, size, data);
+  return sealed > 0 ? static_cast<int>(sealed) : -1;
+}
+
+int FrameKeyStore::DecryptPayload(const std::string& participant_id,
+                                  uint8_t* data, size_t size) {
+  int index = 0;
+  if (!data || size > static_cast<size_t>(INT32_MAX) ||
+      !ReadTrailer(data, 0, size, &index)) {
+    return -1;
+  }
+  uint64_t generation = 0;
+  webrtc::scoped_refptr<const FrameKeyRing> ring = Snapshot(&generation);
+  const FrameKey* key = ring->Find(participant_id, index);
+  size_t plain_size = 0;
+  if (!key || !OpenInPlace(*key, 0, 0, size, data, &plain_size)) {
+    return -1;
+  }
+  return static_cast<int>(plain_size);
+}
+
+webrtc::scoped_refptr<FrameKeyRing> FrameKeyStore::Edit() const {
+  webrtc::scoped_refptr<FrameKeyRing> ring =
+      webrtc::make_ref_counted<FrameKeyRing>();
+  ring->shared_key_ = ring_->shared_key_;
+  ring->shared_keys_ = ring_->shared_keys_;
+  ring->participant_keys_ = ring_->participant_keys_;
+  ring->uncrypted_magic_bytes_ = ring_->uncrypted_magic_bytes_;
+  ring->sif_trailer_ = ring_->sif_trailer_;
+  return ring;
+}
+
+void FrameKeyStore::Publish(webrtc::scoped_refptr<FrameKeyRing> ring) {
+  ring_ = std::move(ring);
+  generation_.fetch_add(1, std::memory_order_release);
+}
+
+FrameCrypto::FrameCrypto(std::string participant_id,
+                         webrtc::scoped_refptr<FrameKeyStore> store)
+    : participant_id_(std::move(participant_id)), store_(std::move(store)) {}
+
+FrameCrypto::~FrameCrypto() = default;
+
+void FrameCrypto::SetEnabled(bool enabled) {
+  enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+bool FrameCrypto::SetKeyIndex(int index) {
+  if (!store_->IsValidIndex(index)) {
+    return false;
+  }
+  key_index_.store(index, std::memory_order_relaxed);
+  return true;
+}
+
+void FrameCrypto::SetObserver(
+    scoped_refptr<RTCFrameCryptorObserver> observer) {
+  webrtc::MutexLock lock(&observer_mutex_);
+  observer_ = observer;
+}
+
+bool FrameCrypto::Encrypt(webrtc::TransformableFrameInterface* frame) {
+  if (!enabled() || frame->GetData().empty()) {
+    return true;
+  }
+  bool result = false;
+  std::optional<RTCFrameCryptionState> changed;
+  {
+    webrtc::MutexLock lock(&frame_mutex_);
+    result = EncryptLocked(frame);
+    changed = std::exchange(state_change_, std::nullopt);
+  }
+  if (changed) {
+    NotifyState(*changed);
+  }
+  return result;
+}
+
+bool FrameCrypto::Decrypt(webrtc::TransformableFrameInterface* frame) {
+  if (!enabled() || frame->GetData().empty()) {
+    return true;
+  }
+  bool result = false;
+  std::optional<RTCFrameCryptionState> changed;
+  {
+    webrtc::MutexLock lock(&frame_mutex_);
+    result = DecryptLocked(frame);
+    changed = std::exchange(state_change_, std::nullopt);
+  }
+  if (changed) {
+    NotifyState(*changed);
+  }
+  return result;
+}
+
+bool FrameCrypto::EncryptLocked(webrtc::TransformableFrameInterface* frame) {
+  webrtc::ArrayView<const uint8_t> data = frame->GetData();
+  const int index = key_index();
+  const FrameKey* key = KeyRing().Find(participant_id_, index);
+  if (!key) {
+    SetState(RTCFrameCryptionState::kMissingKey);
+    return false;
+  }
+  const Codec codec = CodecOf(*frame);
+  size_t header = 0;
+  if (!ClearBytes(codec, *frame, data, &header)) {
+    SetState(RTCFrameCryptionState::kEncryptionFailed);
+    return false;
+  }
+  // Capacity stays from frame to frame, so this allocates only when a frame
+  // is larger than all before it.
+  buffer_.resize(data.size() + kFrameCryptoOverhead);
+  memcpy(buffer_.data(), data.data(), data.size());
+  // Unique per key as long as SSRC, timestamp and count do not all repeat.
+  uint8_t iv[kIvSize];
+  WriteBigEndian32(iv, frame->GetSsrc());
+  WriteBigEndian32(iv + 4, frame->GetTimestamp());
+  WriteBigEndian32(iv + 8, frame_count_++);
+  const size_t size =
+      SealInPlace(*key, index, iv, AuthenticatedFrom(codec, header), header,
+                  data.size(), buffer_.data());
+  if (size == 0) {
+    SetState(RTCFrameCryptionState::kEncryptionFailed);
+    return false;
+  }
+  if (IsNalCodec(codec)) {
+    escaped_.assign(buffer_.begin(), buffer_.begin() + header);
+    AppendEscaped(buffer_.data() + header, size - header, &escaped_);
+    frame->SetData(escaped_);
+  } else {
+    frame->SetData(webrtc::ArrayView<const uint8_t>(buffer_.data(), size));
+  }
+  SetState(RTCFrameCryptionState::kOk);
+  return true;
+}
+
+bool FrameCrypto::DecryptLocked(webrtc::TransformableFrameInterface* frame) {
+  webrtc::ArrayView<const uint8_t> data = frame->GetData();
+  const FrameKeyRing& ring = KeyRing();
+  // Frames the sender left in the clear on purpose, and frames a server
+  // injected, pass with their marker removed, even while no key fits.
+  for (const std::vector<uint8_t>* marker :
+       {&ring.uncrypted_magic_bytes(), &ring.sif_trailer()}) {
+    if (EndsWith(data, *marker)) {
+      buffer_.assign(data.begin(), data.end() - marker->size());
+      frame->SetData(buffer_);
+      return true;
+    }
+  }
+  if (key_invalid_) {
+    if (generation_ == invalid_generation_) {
+      SetState(RTCFrameCryptionState::kMissingKey);
+      return false;
+    }
+    key_invalid_ = false;
+    failures_ = 0;
+  }
+  size_t header = 0;
+  size_t size = 0;
+  int index = 0;
+  if (!LoadEncrypted(*frame, &header, &size, &index)) {
+    SetState(RTCFrameCryptionState::kDecryptionFailed);
+    return false;
+  }
+  const FrameKey* key = ring.Find(participant_id_, index);
+  if (!key) {
+    SetState(RTCFrameCryptionState::kMissingKey);
+    return !store_->discard_frame_when_cryptor_not_ready();
+  }
+  const size_t authenticated = AuthenticatedFrom(CodecOf(*frame), header);
+  size_t plain_size = 0;
+  if (OpenInPlace(*key, authenticated, header, size, buffer_.data(),
+                  &plain_size)) {
+    SetState(RTCFrameCryptionState::kOk);
+  } else if (DecryptRatcheted(*frame, *key, &plain_size)) {
+    SetState(RTCFrameCryptionState::kKeyRatcheted);
+  } else {
+    // Past the tolerance the keys are taken as wrong, so later frames skip
+    // the ratchet until a key changes.
+    const int tolerance = store_->failure_tolerance();
+    if (tolerance >= 0 && ++failures_ > tolerance) {
+      key_invalid_ = true;
+      invalid_generation_ = generation_;
+    }
+    SetState(RTCFrameCryptionState::kDecryptionFailed);
+    return false;
+  }
+  failures_ = 0;
+  frame->SetData(webrtc::ArrayView<const uint8_t>(buffer_.data(), plain_size));
+  return true;
+}
+
+const FrameKeyRing& FrameCrypto::KeyRing() {
+  // The only lock-free check on the way to a key; the store's lock is taken
+  // once per key change.
+  if (!ring_ || store_->generation() != generation_) {
+    ring_ = store_->Snapshot(&generation_);
+  }
+  return *ring_;
+}
+
+bool FrameCrypto::LoadEncrypted(
+    const webrtc::TransformableFrameInterface& frame, size_t* header,
+    size_t* size, int* index) {
+  webrtc::ArrayView<const uint8_t> data = frame.GetData();
+  const Codec codec = CodecOf(frame);
+  if (!ClearBytes(codec, frame, data, header)) {
+    return false;
+  }
+  buffer_.assign(data.begin(), data.end());
+  *size = buffer_.size();
+  if (IsNalCodec(codec)) {
+    *size = *header + Unescape(buffer_.data() + *header, *size - *header);
+  }
+  return ReadTrailer(buffer_.data(), *header, *size, index);
+}
+
+bool FrameCrypto::DecryptRatcheted(
+    const webrtc::TransformableFrameInterface& frame, const FrameKey& key,
+    size_t* plain_size) {
+  // A ratchet step costs two PBKDF2 runs. Steps are kept for the next frame
+  // and derived one per frame, so a stream the window does not reach costs
+  // one step per frame until the failure tolerance stops it, not a window.
+  if (ratchet_base_.get() != &key) {
+    ratchet_base_ = webrtc::scoped_refptr<const FrameKey>(&key);
+    ratchet_keys_.clear();
+  }
+  const size_t window = static_cast<size_t>(store_->ratchet_window_size());
+  bool derived = false;
+  for (size_t step = 0; step < window; ++step) {
+    if (step == ratchet_keys_.size()) {
+      if (derived) {
+        return false;
+      }
+      webrtc::scoped_refptr<const FrameKey> next =
+          store_->Ratcheted(step == 0 ? key : *ratchet_keys_.back());
+      if (!next) {
+        return false;
+      }
+      ratchet_keys_.push_back(std::move(next));
+      derived = true;
+    }
+    size_t header = 0;
+    size_t size = 0;
+    int index = 0;
+    // A failed attempt leaves garbage in buffer_, so each one reloads it.
+    if (!LoadEncrypted(frame, &header, &size, &index)) {
+      return false;
+    }
+    if (OpenInPlace(*ratchet_keys_[step],
+                    AuthenticatedFrom(CodecOf(frame), header), header, size,
+                    buffer_.data(), plain_size)) {
+      webrtc::scoped_refptr<const FrameKey> found = ratchet_keys_[step];
+      // The keys after it are the next steps from it.
+      ratchet_base_ = found;
+      ratchet_keys_.erase(ratchet_keys_.begin(),
+                          ratchet_keys_.begin() + step + 1);
+      store_->Advance(participant_id_, index, std::move(found));
+      return true;
+    }
+  }
+  return false;
+}
+
+void FrameCrypto::SetState(RTCFrameCryptionState state) {
+  if (state == state_) {
+    return;
+  }
+  state_ = state;
+  state_change_ = state;
+}
+
+void FrameCrypto::NotifyState(RTCFrameCryptionState state) {
+  webrtc::MutexLock lock(&observer_mutex_);
+  if (observer_) {
+    observer_->OnFrameCryptionStateChanged(string(participant_id_), state);
+  }
+}
+
+}  // namespace lumenrtc_bridge
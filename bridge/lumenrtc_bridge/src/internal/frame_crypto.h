@@ -0,0 +1,244 @@
+#ifndef INTERNAL_FRAME_CRYPTO_H_
+#define INTERNAL_FRAME_CRYPTO_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "api/frame_transformer_interface.h"
+#include "api/ref_count.h"
+#include "api/scoped_refptr.h"
+#include "openssl/aead.h"
+#include "rtc_base/ref_counted_object.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread_annotations.h"
+#include "rtc_frame_cryptor.h"
+#include "rtc_types.h"
+
+namespace lumenrtc_bridge {
+
+// Bytes an encrypted frame or payload grows by: the GCM tag, the IV, the IV
+// length and the key index.
+constexpr size_t kFrameCryptoOverhead = 16 + 12 + 2;
+static_assert(kFrameCryptoOverhead == FRAME_CRYPTO_OVERHEAD);
+
+// One key as set by the application, with an AES-128-GCM context keyed with
+// what PBKDF2 derives from it. Immutable, so any thread may use it.
+class FrameKey : public webrtc::RefCountedNonVirtual<FrameKey> {
+ public:
+  // Null if |material| is empty. Runs PBKDF2, which is slow by design.
+  static webrtc::scoped_refptr<const FrameKey> Create(
+      std::vector<uint8_t> material, const std::vector<uint8_t>& salt);
+  // The material a ratchet step turns |material| into.
+  static std::vector<uint8_t> Ratchet(const std::vector<uint8_t>& material,
+                                      const std::vector<uint8_t>& salt);
+
+  explicit FrameKey(std::vector<uint8_t> material);
+  ~FrameKey();
+
+  const std::vector<uint8_t>& material() const { return material_; }
+  const EVP_AEAD_CTX* aead() const { return &aead_; }
+
+ private:
+  const std::vector<uint8_t> material_;
+  EVP_AEAD_CTX aead_;
+};
+
+// Everything a frame needs from a key provider. Never changed once
+// published, so frames read it without locking; setting a key publishes a
+// new ring that shares the unchanged keys.
+class FrameKeyRing : public webrtc::RefCountedNonVirtual<FrameKeyRing> {
+ public:
+  // Key |index| of |participant_id|, falling back to the shared key when
+  // keys are shared. Null if there is none.
+  const FrameKey* Find(const std::string& participant_id, int index) const;
+
+  const std::vector<uint8_t>& uncrypted_magic_bytes() const {
+    return uncrypted_magic_bytes_;
+  }
+  const std::vector<uint8_t>& sif_trailer() const { return sif_trailer_; }
+
+ private:
+  friend class FrameKeyStore;
+  using Keys = std::map<int, webrtc::scoped_refptr<const FrameKey>>;
+
+  bool shared_key_ = false;
+  Keys shared_keys_;
+  std::map<std::string, Keys> participant_keys_;
+  std::vector<uint8_t> uncrypted_magic_bytes_;
+  std::vector<uint8_t> sif_trailer_;
+};
+
+// The keys behind a KeyProvider.
+class FrameKeyStore : public webrtc::RefCountInterface {
+ public:
+  explicit FrameKeyStore(const KeyProviderOptions& options);
+  ~FrameKeyStore() override;
+
+  // Keys are derived before the lock is taken, so frames of other
+  // participants never wait for PBKDF2.
+  bool SetSharedKey(int index, std::vector<uint8_t> material);
+  bool SetKey(const std::string& participant_id, int index,
+              std::vector<uint8_t> material);
+  // Empty if there is no such key.
+  std::vector<uint8_t> RatchetSharedKey(int index);
+  std::vector<uint8_t> RatchetKey(const std::string& participant_id,
+                                  int index);
+  std::vector<uint8_t> ExportSharedKey(int index) const;
+  std::vector<uint8_t> ExportKey(const std::string& participant_id,
+                                 int index) const;
+  void SetSifTrailer(std::vector<uint8_t> trailer);
+  // The key a ratchet step turns |key| into; null on failure.
+  webrtc::scoped_refptr<const FrameKey> Ratcheted(const FrameKey& key) const;
+  // Puts |key| wherever FrameKeyRing::Find() found |index| of
+  // |participant_id|; for a receiver that caught up with a ratchet.
+  void Advance(const std::string& participant_id, int index,
+               webrtc::scoped_refptr<const FrameKey> key);
+
+  // Bumped by every change; compare before fetching a new Snapshot().
+  uint64_t generation() const {
+    return generation_.load(std::memory_order_acquire);
+  }
+  webrtc::scoped_refptr<const FrameKeyRing> Snapshot(
+      uint64_t* generation) const;
+
+  // Encrypts |size| bytes at |data| in place with key |index| and appends
+  // the trailer; |capacity| is at least |size| + kFrameCryptoOverhead.
+  // Returns the encrypted size, or -1.
+  int EncryptPayload(const std::string& participant_id, int index,
+                     uint8_t* data, size_t size, size_t capacity);
+  // Decrypts in place whatever EncryptPayload() produced. Returns the
+  // plain size, or -1.
+  int DecryptPayload(const std::string& participant_id, uint8_t* data,
+                     size_t size);
+
+  // Whether |index| is within the configured key ring size.
+  bool IsValidIndex(int index) const {
+    return index >= 0 && index < key_ring_size_;
+  }
+  int ratchet_window_size() const { return ratchet_window_size_; }
+  // Frames in a row a cryptor may fail to decrypt before it stops trying
+  // until a key changes; -1 for no limit.
+  int failure_tolerance() const { return failure_tolerance_; }
+  bool discard_frame_when_cryptor_not_ready() const {
+    return discard_frame_when_cryptor_not_ready_;
+  }
+
+ private:
+  // Copies the current ring for a change; publish it with Publish().
+  webrtc::scoped_refptr<FrameKeyRing> Edit() const
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  void Publish(webrtc::scoped_refptr<FrameKeyRing> ring)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  const std::vector<uint8_t> ratchet_salt_;
+  const int ratchet_window_size_;
+  const int failure_tolerance_;
+  const int key_ring_size_;
+  const bool discard_frame_when_cryptor_not_ready_;
+  // Makes payload IVs unique across stores sharing a key.
+  uint8_t payload_iv_prefix_[4];
+  std::atomic<uint64_t> payload_count_{0};
+
+  mutable webrtc::Mutex mutex_;
+  webrtc::scoped_refptr<const FrameKeyRing> ring_ RTC_GUARDED_BY(mutex_);
+  std::atomic<uint64_t> generation_{0};
+};
+
+// Encrypts the frames of one sender or decrypts those of one receiver, in
+// place in a buffer reused from frame to frame. The key ring is cached and
+// refetched only after a key changed. Frames are laid out as
+//
+//   clear header | ciphertext | GCM tag | IV | IV length | key index
+//
+// with the codec's header left in the clear for the packetizer, and
+// authenticated. H.264 and H.265 frames keep their NAL units up to the
+// first slice in the clear and get emulation prevention bytes after it, so
+// no start code appears in the ciphertext. AV1 frames cannot be encrypted,
+// since its packetizer parses every OBU.
+class FrameCrypto : public webrtc::RefCountInterface {
+ public:
+  FrameCrypto(std::string participant_id,
+              webrtc::scoped_refptr<FrameKeyStore> store);
+  ~FrameCrypto() override;
+
+  void SetEnabled(bool enabled);
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+  // False if the key ring has no |index|.
+  bool SetKeyIndex(int index);
+  int key_index() const { return key_index_.load(std::memory_order_relaxed); }
+  const std::string& participant_id() const { return participant_id_; }
+  // Returns once no call to the previous observer is running.
+  void SetObserver(scoped_refptr<RTCFrameCryptorObserver> observer);
+
+  // False if |frame| is to be dropped.
+  bool Encrypt(webrtc::TransformableFrameInterface* frame);
+  bool Decrypt(webrtc::TransformableFrameInterface* frame);
+
+ private:
+  bool EncryptLocked(webrtc::TransformableFrameInterface* frame)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(frame_mutex_);
+  bool DecryptLocked(webrtc::TransformableFrameInterface* frame)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(frame_mutex_);
+  const FrameKeyRing& KeyRing() RTC_EXCLUSIVE_LOCKS_REQUIRED(frame_mutex_);
+  // Copies the payload of |frame| into buffer_ with emulation prevention
+  // removed; false if it is not an encrypted frame.
+  bool LoadEncrypted(const webrtc::TransformableFrameInterface& frame,
+                     size_t* header, size_t* size, int* index)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(frame_mutex_);
+  // Tries the keys up to ratchet_window_size() steps after |key| and
+  // keeps the one that fits. Derives at most one new key per call.
+  bool DecryptRatcheted(const webrtc::TransformableFrameInterface& frame,
+                        const FrameKey& key, size_t* plain_size)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(frame_mutex_);
+  // Records a change for Encrypt() or Decrypt() to report once
+  // frame_mutex_ is released, so the observer may call into the cryptor.
+  void SetState(RTCFrameCryptionState state)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(frame_mutex_);
+  void NotifyState(RTCFrameCryptionState state)
+      RTC_LOCKS_EXCLUDED(frame_mutex_);
+
+  const std::string participant_id_;
+  const webrtc::scoped_refptr<FrameKeyStore> store_;
+  std::atomic<bool> enabled_{false};
+  std::atomic<int> key_index_{0};
+
+  // Serializes frames; never held while keys change.
+  webrtc::Mutex frame_mutex_;
+  uint64_t generation_ RTC_GUARDED_BY(frame_mutex_) = 0;
+  webrtc::scoped_refptr<const FrameKeyRing> ring_
+      RTC_GUARDED_BY(frame_mutex_);
+  std::vector<uint8_t> buffer_ RTC_GUARDED_BY(frame_mutex_);
+  std::vector<uint8_t> escaped_ RTC_GUARDED_BY(frame_mutex_);
+  uint32_t frame_count_ RTC_GUARDED_BY(frame_mutex_) = 0;
+  // Keys ratcheted from |ratchet_base_|, in order; kept until a frame
+  // fails with another key.
+  webrtc::scoped_refptr<const FrameKey> ratchet_base_
+      RTC_GUARDED_BY(frame_mutex_);
+  std::vector<webrtc::scoped_refptr<const FrameKey>> ratchet_keys_
+      RTC_GUARDED_BY(frame_mutex_);
+  // Frames in a row that no key decrypted.
+  int failures_ RTC_GUARDED_BY(frame_mutex_) = 0;
+  // Set past the failure tolerance; frames are dropped untried until the
+  // key ring moves on from |invalid_generation_|.
+  bool key_invalid_ RTC_GUARDED_BY(frame_mutex_) = false;
+  uint64_t invalid_generation_ RTC_GUARDED_BY(frame_mutex_) = 0;
+  RTCFrameCryptionState state_ RTC_GUARDED_BY(frame_mutex_) =
+      RTCFrameCryptionState::kNew;
+  std::optional<RTCFrameCryptionState> state_change_
+      RTC_GUARDED_BY(frame_mutex_);
+
+  // Held while the observer runs.
+  webrtc::Mutex observer_mutex_;
+  scoped_refptr<RTCFrameCryptorObserver> observer_
+      RTC_GUARDED_BY(observer_mutex_);
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // INTERNAL_FRAME_CRYPTO_H_
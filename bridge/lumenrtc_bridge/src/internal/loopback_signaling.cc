@@ -0,0 +1,214 @@
+#include "src/internal/loopback_signaling.h"
+
+#include <functional>
+#include <utility>
+
+#include "api/make_ref_counted.h"
+#include "api/rtc_error.h"
+#include "rtc_base/logging.h"
+
+namespace lumenrtc_bridge {
+
+namespace {
+
+class LoopbackStepObserver
+    : public webrtc::SetLocalDescriptionObserverInterface,
+      public webrtc::SetRemoteDescriptionObserverInterface {
+ public:
+  explicit LoopbackStepObserver(std::function<void(webrtc::RTCError)> done)
+      : done_(std::move(done)) {}
+
+  void OnSetLocalDescriptionComplete(webrtc::RTCError error) override {
+    done_(std::move(error));
+  }
+
+  void OnSetRemoteDescriptionComplete(webrtc::RTCError error) override {
+    done_(std::move(error));
+  }
+
+ private:
+  std::function<void(webrtc::RTCError)> done_;
+};
+
+LoopbackLink::Role Other(LoopbackLink::Role role) {
+  return role == LoopbackLink::kOfferer ? LoopbackLink::kAnswerer
+                                        : LoopbackLink::kOfferer;
+}
+
+}  // namespace
+
+LoopbackLink::LoopbackLink(Peer offerer, Peer answerer,
+                           OnSetSdpSuccess success, OnSetSdpFailure failure)
+    : success_(success), failure_(failure) {
+  peers_[kOfferer] = std::move(offerer);
+  peers_[kAnswerer] = std::move(answerer);
+}
+
+void LoopbackLink::Start() {
+  SetLocal(kOfferer);
+}
+
+webrtc::scoped_refptr<webrtc::PeerConnectionInterface> LoopbackLink::peer(
+    Role role) {
+  webrtc::MutexLock lock(&mutex_);
+  return peers_[role].pc;
+}
+
+void LoopbackLink::Post(Role role, absl::AnyInvocable<void() &&> task) {
+  webrtc::Thread* thread = nullptr;
+  {
+    webrtc::MutexLock lock(&mutex_);
+    thread = peers_[role].signaling_thread;
+  }
+  if (thread) {
+    thread->PostTask(std::move(task));
+  } else {
+    std::move(task)();
+  }
+}
+
+void LoopbackLink::SetLocal(Role role) {
+  webrtc::scoped_refptr<LoopbackLink> self(this);
+  Post(role, [self, role] {
+    webrtc::scoped_refptr<webrtc::PeerConnectionInterface> pc =
+        self->peer(role);
+    if (!pc) {
+      return;
+    }
+    webrtc::scoped_refptr<webrtc::SetLocalDescriptionObserverInterface>
+        observer = webrtc::make_ref_counted<LoopbackStepObserver>(
+            [self, role](webrtc::RTCError error) {
+              if (!error.ok()) {
+                self->Finish(std::move(error));
+                return;
+              }
+              self->SendDescription(role);
+            });
+    pc->SetLocalDescription(observer);
+  });
+}
+
+void LoopbackLink::SendDescription(Role from) {
+  webrtc::scoped_refptr<webrtc::PeerConnectionInterface> pc = peer(from);
+  if (!pc) {
+    return;
+  }
+  // Runs on |from|'s signaling thread, where the description is stable.
+  const webrtc::SessionDescriptionInterface* local = pc->local_description();
+  if (!local) {
+    Finish(webrtc::RTCError(webrtc::RTCErrorType::INTERNAL_ERROR,
+                            "Local description missing."));
+    return;
+  }
+  std::unique_ptr<webrtc::SessionDescriptionInterface> description =
+      local->Clone();
+
+  const Role to = Other(from);
+  webrtc::scoped_refptr<LoopbackLink> self(this);
+  Post(to, [self, to, description = std::move(description)]() mutable {
+    webrtc::scoped_refptr<webrtc::PeerConnectionInterface> remote =
+        self->peer(to);
+    if (!remote) {
+      return;
+    }
+    webrtc::scoped_refptr<webrtc::SetRemoteDescriptionObserverInterface>
+        observer = webrtc::make_ref_counted<LoopbackStepObserver>(
+            [self, to](webrtc::RTCError error) {
+              if (!error.ok()) {
+                self->Finish(std::move(error));
+                return;
+              }
+              self->OnRemoteDescriptionSet(to);
+              if (to == kAnswerer) {
+                self->SetLocal(kAnswerer);
+              } else {
+                self->Finish(webrtc::RTCError::OK());
+              }
+            });
+    remote->SetRemoteDescription(std::move(description), observer);
+  });
+}
+
+void LoopbackLink::OnRemoteDescriptionSet(Role role) {
+  std::vector<std::unique_ptr<webrtc::IceCandidateInterface>> pending;
+  {
+    webrtc::MutexLock lock(&mutex_);
+    remote_set_[role] = true;
+    pending.swap(pending_[role]);
+  }
+  for (auto& candidate : pending) {
+    Deliver(role, std::move(candidate));
+  }
+}
+
+void LoopbackLink::OnLocalCandidate(
+    Role from, const webrtc::IceCandidateInterface* candidate) {
+  const Role to = Other(from);
+  std::unique_ptr<webrtc::IceCandidateInterface> copy =
+      webrtc::CreateIceCandidate(candidate->sdp_mid(),
+                                 candidate->sdp_mline_index(),
+                                 candidate->candidate());
+  {
+    webrtc::MutexLock lock(&mutex_);
+    if (!peers_[to].pc) {
+      return;
+    }
+    if (!remote_set_[to]) {
+      pending_[to].push_back(std::move(copy));
+      return;
+    }
+  }
+  Deliver(to, std::move(copy));
+}
+
+void LoopbackLink::Deliver(
+    Role to, std::unique_ptr<webrtc::IceCandidateInterface> candidate) {
+  webrtc::scoped_refptr<LoopbackLink> self(this);
+  Post(to, [self, to, candidate = std::move(candidate)]() mutable {
+    webrtc::scoped_refptr<webrtc::PeerConnectionInterface> pc =
+        self->peer(to);
+    if (!pc) {
+      return;
+    }
+    pc->AddIceCandidate(std::move(candidate), [](webrtc::RTCError error) {
+      if (!error.ok()) {
+        RTC_LOG(LS_WARNING) << "Loopback candidate rejected: "
+                            << error.message();
+      }
+    });
+  });
+}
+
+void LoopbackLink::Detach() {
+  Peer peers[2];
+  {
+    webrtc::MutexLock lock(&mutex_);
+    peers[kOfferer] = std::move(peers_[kOfferer]);
+    peers[kAnswerer] = std::move(peers_[kAnswerer]);
+    peers_[kOfferer] = Peer();
+    peers_[kAnswerer] = Peer();
+    pending_[kOfferer].clear();
+    pending_[kAnswerer].clear();
+  }
+  Finish(webrtc::RTCError(webrtc::RTCErrorType::INVALID_STATE,
+                          "Peer connection closed."));
+}
+
+void LoopbackLink::Finish(webrtc::RTCError error) {
+  {
+    webrtc::MutexLock lock(&mutex_);
+    if (finished_) {
+      return;
+    }
+    finished_ = true;
+  }
+  if (error.ok()) {
+    if (success_) {
+      success_();
+    }
+  } else if (failure_) {
+    failure_(error.message());
+  }
+}
+
+}  // namespace lumenrtc_bridge
@@ -0,0 +1,69 @@
+#ifndef INTERNAL_LOOPBACK_SIGNALING_H_
+#define INTERNAL_LOOPBACK_SIGNALING_H_
+
+#include <memory>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "api/jsep.h"
+#include "api/peer_connection_interface.h"
+#include "api/ref_count.h"
+#include "api/scoped_refptr.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread.h"
+#include "rtc_peerconnection.h"
+
+namespace lumenrtc_bridge {
+
+// Signaling channel between two peer connections in the same process.
+// Start() runs offer/answer with implicit descriptions; local candidates
+// reported by either side through OnLocalCandidate() are applied to the
+// other side once its remote description is in place.
+//
+// Every call into a peer connection is posted to that connection's signaling
+// thread, so two factories can be linked without one signaling thread
+// blocking on the other.
+class LoopbackLink : public webrtc::RefCountInterface {
+ public:
+  enum Role { kOfferer = 0, kAnswerer = 1 };
+
+  struct Peer {
+    webrtc::scoped_refptr<webrtc::PeerConnectionInterface> pc;
+    webrtc::Thread* signaling_thread = nullptr;
+  };
+
+  LoopbackLink(Peer offerer, Peer answerer, OnSetSdpSuccess success,
+               OnSetSdpFailure failure);
+
+  void Start();
+
+  void OnLocalCandidate(Role from,
+                        const webrtc::IceCandidateInterface* candidate);
+
+  // Stops forwarding. A negotiation still in flight fails.
+  void Detach();
+
+ private:
+  webrtc::scoped_refptr<webrtc::PeerConnectionInterface> peer(Role role);
+  void Post(Role role, absl::AnyInvocable<void() &&> task);
+  void SetLocal(Role role);
+  void SendDescription(Role from);
+  void OnRemoteDescriptionSet(Role role);
+  void Deliver(Role to,
+               std::unique_ptr<webrtc::IceCandidateInterface> candidate);
+  void Finish(webrtc::RTCError error);
+
+  webrtc::Mutex mutex_;
+  Peer peers_[2] RTC_GUARDED_BY(mutex_);
+  // Candidates for peers_[i] that arrived before its remote description.
+  std::vector<std::unique_ptr<webrtc::IceCandidateInterface>> pending_[2]
+      RTC_GUARDED_BY(mutex_);
+  bool remote_set_[2] RTC_GUARDED_BY(mutex_) = {false, false};
+  bool finished_ RTC_GUARDED_BY(mutex_) = false;
+  OnSetSdpSuccess success_;
+  OnSetSdpFailure failure_;
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // INTERNAL_LOOPBACK_SIGNALING_H_
@@ -0,0 +1,111 @@
+#include "src/internal/peer_connection_pool.h"
+
+#include <utility>
+
+namespace lumenrtc_bridge {
+
+PeerConnectionPool::PeerConnectionPool(webrtc::Thread* signaling_thread,
+                                       CreateFn create, DiscardFn discard)
+    : signaling_thread_(signaling_thread),
+      create_(std::move(create)),
+      discard_(std::move(discard)) {}
+
+void PeerConnectionPool::Configure(
+    const RTCConfiguration& configuration,
+    scoped_refptr<RTCMediaConstraints> constraints, size_t size) {
+  std::deque<scoped_refptr<RTCPeerConnection>> stale;
+  {
+    webrtc::MutexLock lock(&mutex_);
+    configuration_ = configuration;
+    // Without a candidate pool a warm connection would only save the
+    // certificate; gathering is the larger part of the join.
+    if (configuration_.ice_candidate_pool_size < 1) {
+      configuration_.ice_candidate_pool_size = 1;
+    }
+    constraints_ = constraints;
+    target_size_ = size;
+    ++generation_;
+    in_flight_ = 0;
+    stale.swap(warm_);
+    stats_.discarded += stale.size();
+    ScheduleRefillLocked();
+  }
+  for (auto& pc : stale) {
+    discard_(pc);
+  }
+}
+
+scoped_refptr<RTCPeerConnection> PeerConnectionPool::Take() {
+  scoped_refptr<RTCPeerConnection> pc;
+  RTCConfiguration configuration;
+  scoped_refptr<RTCMediaConstraints> constraints;
+  {
+    webrtc::MutexLock lock(&mutex_);
+    if (target_size_ == 0) {
+      return nullptr;
+    }
+    if (!warm_.empty()) {
+      // Oldest first: it has had the longest to finish gathering.
+      pc = warm_.front();
+      warm_.pop_front();
+      ++stats_.hits;
+    } else {
+      ++stats_.misses;
+      configuration = configuration_;
+      constraints = constraints_;
+    }
+    ScheduleRefillLocked();
+  }
+  if (!pc) {
+    pc = create_(configuration, constraints);
+  }
+  return pc;
+}
+
+RTCPeerConnectionPoolStats PeerConnectionPool::stats() {
+  webrtc::MutexLock lock(&mutex_);
+  RTCPeerConnectionPoolStats stats = stats_;
+  stats.available = static_cast<uint32_t>(warm_.size());
+  stats.target_size = static_cast<uint32_t>(target_size_);
+  return stats;
+}
+
+void PeerConnectionPool::ScheduleRefillLocked() {
+  while (warm_.size() + in_flight_ < target_size_) {
+    ++in_flight_;
+    signaling_thread_->PostTask(
+        [pool = webrtc::scoped_refptr<PeerConnectionPool>(this),
+         generation = generation_] { pool->Refill(generation); });
+  }
+}
+
+void PeerConnectionPool::Refill(uint64_t generation) {
+  RTCConfiguration configuration;
+  scoped_refptr<RTCMediaConstraints> constraints;
+  {
+    webrtc::MutexLock lock(&mutex_);
+    if (generation != generation_) {
+      return;
+    }
+    configuration = configuration_;
+    constraints = constraints_;
+  }
+  scoped_refptr<RTCPeerConnection> pc = create_(configuration, constraints);
+  {
+    webrtc::MutexLock lock(&mutex_);
+    if (generation == generation_) {
+      --in_flight_;
+      // A failed create is not retried here; the next Take() tries again.
+      if (pc) {
+        warm_.push_back(pc);
+        ++stats_.created;
+      }
+      return;
+    }
+  }
+  if (pc) {
+    discard_(pc);
+  }
+}
+
+}  // namespace lumenrtc_bridge
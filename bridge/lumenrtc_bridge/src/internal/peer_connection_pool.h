@@ -0,0 +1,72 @@
+#ifndef INTERNAL_PEER_CONNECTION_POOL_H_
+#define INTERNAL_PEER_CONNECTION_POOL_H_
+
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include "api/ref_count.h"
+#include "api/scoped_refptr.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread.h"
+#include "rtc_mediaconstraints.h"
+#include "rtc_peerconnection.h"
+#include "rtc_types.h"
+
+namespace lumenrtc_bridge {
+
+// Peer connections created ahead of demand from one configuration. Creating
+// a connection starts DTLS certificate generation and, with a non-zero
+// ice_candidate_pool_size, candidate gathering; a connection that has sat in
+// the pool for a moment has both done by the time it is taken.
+//
+// Refills are posted to the factory's signaling thread one connection at a
+// time, so application callbacks queued there are not held up by a burst.
+class PeerConnectionPool : public webrtc::RefCountInterface {
+ public:
+  using CreateFn = std::function<scoped_refptr<RTCPeerConnection>(
+      const RTCConfiguration&, scoped_refptr<RTCMediaConstraints>)>;
+  // Closes a connection the pool no longer wants and drops the factory's
+  // reference to it.
+  using DiscardFn = std::function<void(scoped_refptr<RTCPeerConnection>)>;
+
+  static constexpr size_t kMaxSize = 64;
+
+  PeerConnectionPool(webrtc::Thread* signaling_thread, CreateFn create,
+                     DiscardFn discard);
+
+  // Replaces the configuration and target size and starts refilling. Warm
+  // connections from a previous configuration are discarded. A size of 0
+  // disables the pool.
+  void Configure(const RTCConfiguration& configuration,
+                 scoped_refptr<RTCMediaConstraints> constraints, size_t size);
+
+  // Pops a warm connection and schedules its replacement. On a miss creates
+  // one from the pool's configuration on the calling thread. Returns null if
+  // the pool is disabled.
+  scoped_refptr<RTCPeerConnection> Take();
+
+  RTCPeerConnectionPoolStats stats();
+
+ private:
+  void ScheduleRefillLocked() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  void Refill(uint64_t generation);
+
+  webrtc::Thread* const signaling_thread_;
+  const CreateFn create_;
+  const DiscardFn discard_;
+
+  webrtc::Mutex mutex_;
+  RTCConfiguration configuration_ RTC_GUARDED_BY(mutex_);
+  scoped_refptr<RTCMediaConstraints> constraints_ RTC_GUARDED_BY(mutex_);
+  size_t target_size_ RTC_GUARDED_BY(mutex_) = 0;
+  // Bumped by Configure() so refills for an old configuration are dropped.
+  uint64_t generation_ RTC_GUARDED_BY(mutex_) = 0;
+  size_t in_flight_ RTC_GUARDED_BY(mutex_) = 0;
+  std::deque<scoped_refptr<RTCPeerConnection>> warm_ RTC_GUARDED_BY(mutex_);
+  RTCPeerConnectionPoolStats stats_ RTC_GUARDED_BY(mutex_);
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // INTERNAL_PEER_CONNECTION_POOL_H_
@@ -0,0 +1,113 @@
+#ifndef INTERNAL_RTP_WRAPPER_CACHE_H_
+#define INTERNAL_RTP_WRAPPER_CACHE_H_
+
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "api/scoped_refptr.h"
+#include "base/refcountedobject.h"
+#include "rtc_base/ref_counted_object.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_rtp_receiver_impl.h"
+#include "rtc_rtp_sender_impl.h"
+#include "rtc_types.h"
+
+namespace lumenrtc_bridge {
+
+// Keeps one bridge wrapper per native RTP object (transceiver, sender or
+// receiver), so repeated lookups and enumerations return the same instance
+// instead of allocating a new RefCountedObject every time.
+//
+// Entries are keyed by the native pointer. A cached wrapper holds a reference
+// to its native object, so the key cannot be reused while the entry exists.
+// Snapshot() drops wrappers whose native object is no longer listed by the
+// peer connection, and keeps the list for SnapshotAt().
+template <typename Native, typename Wrapper, typename Impl>
+class RtpWrapperCache {
+ public:
+  // Makes the wrapper of a native object that has none yet.
+  using Factory = std::function<scoped_refptr<Wrapper>(
+      const webrtc::scoped_refptr<Native>&)>;
+
+  RtpWrapperCache()
+      : factory_([](const webrtc::scoped_refptr<Native>& native) {
+          return scoped_refptr<Wrapper>(new RefCountedObject<Impl>(native));
+        }) {}
+  explicit RtpWrapperCache(Factory factory) : factory_(std::move(factory)) {}
+
+  scoped_refptr<Wrapper> Get(const webrtc::scoped_refptr<Native>& native) {
+    if (!native) {
+      return scoped_refptr<Wrapper>();
+    }
+    webrtc::MutexLock lock(&mutex_);
+    return GetLocked(native);
+  }
+
+  // Wraps |natives| in order and forgets every wrapper not in the list.
+  std::vector<scoped_refptr<Wrapper>> Snapshot(
+      const std::vector<webrtc::scoped_refptr<Native>>& natives) {
+    std::vector<scoped_refptr<Wrapper>> out;
+    out.reserve(natives.size());
+    std::unordered_map<const Native*, scoped_refptr<Wrapper>> live;
+    live.reserve(natives.size());
+    webrtc::MutexLock lock(&mutex_);
+    for (const auto& native : natives) {
+      scoped_refptr<Wrapper> wrapper = GetLocked(native);
+      live.emplace(native.get(), wrapper);
+      out.push_back(wrapper);
+    }
+    wrappers_.swap(live);
+    last_snapshot_ = out;
+    return out;
+  }
+
+  // Entry |index| of what the last Snapshot() returned; null past its end.
+  scoped_refptr<Wrapper> SnapshotAt(size_t index) {
+    webrtc::MutexLock lock(&mutex_);
+    return index < last_snapshot_.size() ? last_snapshot_[index]
+                                         : scoped_refptr<Wrapper>();
+  }
+
+  void Clear() {
+    webrtc::MutexLock lock(&mutex_);
+    wrappers_.clear();
+    last_snapshot_.clear();
+  }
+
+ private:
+  scoped_refptr<Wrapper> GetLocked(
+      const webrtc::scoped_refptr<Native>& native)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    auto it = wrappers_.find(native.get());
+    if (it != wrappers_.end()) {
+      return it->second;
+    }
+    scoped_refptr<Wrapper> wrapper = factory_(native);
+    wrappers_.emplace(native.get(), wrapper);
+    return wrapper;
+  }
+
+  const Factory factory_;
+  webrtc::Mutex mutex_;
+  std::unordered_map<const Native*, scoped_refptr<Wrapper>> wrappers_
+      RTC_GUARDED_BY(mutex_);
+  std::vector<scoped_refptr<Wrapper>> last_snapshot_ RTC_GUARDED_BY(mutex_);
+};
+
+// The sender and receiver wrappers of one peer connection. Its transceiver
+// wrappers share them, so RTCRtpTransceiver::sender() returns the instance
+// RTCPeerConnection::senders() does.
+struct RtpEndpointWrappers
+    : public webrtc::RefCountedNonVirtual<RtpEndpointWrappers> {
+  RtpWrapperCache<webrtc::RtpSenderInterface, RTCRtpSender, RTCRtpSenderImpl>
+      senders;
+  RtpWrapperCache<webrtc::RtpReceiverInterface, RTCRtpReceiver,
+                  RTCRtpReceiverImpl>
+      receivers;
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // INTERNAL_RTP_WRAPPER_CACHE_H_
@@ -0,0 +1,173 @@
+#include "src/internal/thread_tuning.h"
+
+#include <thread>
+
+#if defined(WEBRTC_WIN)
+#include <windows.h>
+#elif defined(WEBRTC_POSIX)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#if defined(WEBRTC_LINUX)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#endif
+
+namespace lumenrtc_bridge {
+
+namespace {
+
+#if defined(WEBRTC_WIN)
+int NiceToWindowsPriority(int nice) {
+  if (nice <= -10) return THREAD_PRIORITY_HIGHEST;
+  if (nice < 0) return THREAD_PRIORITY_ABOVE_NORMAL;
+  if (nice >= 10) return THREAD_PRIORITY_LOWEST;
+  if (nice > 0) return THREAD_PRIORITY_BELOW_NORMAL;
+  return THREAD_PRIORITY_NORMAL;
+}
+#endif
+
+#if defined(WEBRTC_LINUX)
+// setpriority() with a thread id changes only that thread on Linux.
+id_t CurrentThreadId() { return static_cast<id_t>(syscall(SYS_gettid)); }
+#endif
+
+}  // namespace
+
+int ProcessorCount() {
+  unsigned int count = std::thread::hardware_concurrency();
+  return count > 0 ? static_cast<int>(count) : 1;
+}
+
+bool PinCurrentThreadToCpu(int cpu) {
+  if (cpu < 0) {
+    return false;
+  }
+#if defined(WEBRTC_WIN)
+  if (cpu >= static_cast<int>(sizeof(DWORD_PTR) * 8)) {
+    return false;
+  }
+  return SetThreadAffinityMask(GetCurrentThread(),
+                               static_cast<DWORD_PTR>(1) << cpu) != 0;
+#elif defined(WEBRTC_LINUX)
+  if (cpu >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+  // macOS only exposes affinity tags, which are not CPU pins.
+  return false;
+#endif
+}
+
+RTCThreadReport ApplyThreadTuning(const RTCThreadTuning& tuning) {
+  int failures = 0;
+#if defined(WEBRTC_WIN)
+  if (tuning.cpu_mask != 0 &&
+      SetThreadAffinityMask(GetCurrentThread(),
+                            static_cast<DWORD_PTR>(tuning.cpu_mask)) == 0) {
+    failures |= RTCThreadReport::kAffinityFailed;
+  }
+  if (tuning.realtime) {
+    if (!SetThreadPriority(GetCurrentThread(),
+                           THREAD_PRIORITY_TIME_CRITICAL)) {
+      failures |= RTCThreadReport::kRealtimeFailed;
+    }
+  } else if (tuning.set_nice &&
+             !SetThreadPriority(GetCurrentThread(),
+                                NiceToWindowsPriority(tuning.nice))) {
+    failures |= RTCThreadReport::kNiceFailed;
+  }
+#elif defined(WEBRTC_LINUX)
+  if (tuning.cpu_mask != 0) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; ++cpu) {
+      if (tuning.cpu_mask & (uint64_t{1} << cpu)) {
+        CPU_SET(cpu, &set);
+      }
+    }
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+      failures |= RTCThreadReport::kAffinityFailed;
+    }
+  }
+  if (tuning.set_nice &&
+      setpriority(PRIO_PROCESS, CurrentThreadId(), tuning.nice) != 0) {
+    failures |= RTCThreadReport::kNiceFailed;
+  }
+  if (tuning.realtime) {
+    sched_param param = {};
+    param.sched_priority = tuning.realtime_priority;
+    if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0) {
+      failures |= RTCThreadReport::kRealtimeFailed;
+    }
+  }
+#else
+  if (tuning.cpu_mask != 0) {
+    failures |= RTCThreadReport::kAffinityFailed;
+  }
+  if (tuning.set_nice) {
+    failures |= RTCThreadReport::kNiceFailed;
+  }
+#if defined(WEBRTC_POSIX)
+  if (tuning.realtime) {
+    sched_param param = {};
+    param.sched_priority = tuning.realtime_priority;
+    if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0) {
+      failures |= RTCThreadReport::kRealtimeFailed;
+    }
+  }
+#endif
+#endif
+  RTCThreadReport report = CurrentThreadReport();
+  report.failures = failures;
+  return report;
+}
+
+RTCThreadReport CurrentThreadReport() {
+  RTCThreadReport report;
+  report.applied = true;
+#if defined(WEBRTC_WIN)
+  // Windows cannot query a thread's affinity directly; setting it returns
+  // the previous mask, so set the process mask and restore.
+  DWORD_PTR process_mask = 0;
+  DWORD_PTR system_mask = 0;
+  if (GetProcessAffinityMask(GetCurrentProcess(), &process_mask,
+                             &system_mask)) {
+    DWORD_PTR previous =
+        SetThreadAffinityMask(GetCurrentThread(), process_mask);
+    if (previous != 0) {
+      SetThreadAffinityMask(GetCurrentThread(), previous);
+      report.cpu_mask = static_cast<uint64_t>(previous);
+    }
+  }
+  report.priority = GetThreadPriority(GetCurrentThread());
+  report.realtime = report.priority == THREAD_PRIORITY_TIME_CRITICAL;
+#elif defined(WEBRTC_POSIX)
+#if defined(WEBRTC_LINUX)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0) {
+    for (int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &set)) {
+        report.cpu_mask |= uint64_t{1} << cpu;
+      }
+    }
+  }
+  report.nice = getpriority(PRIO_PROCESS, CurrentThreadId());
+#endif
+  int policy = 0;
+  sched_param param = {};
+  if (pthread_getschedparam(pthread_self(), &policy, &param) == 0) {
+    report.realtime = policy == SCHED_FIFO;
+    report.priority = param.sched_priority;
+  }
+#endif
+  return report;
+}
+
+}  // namespace lumenrtc_bridge
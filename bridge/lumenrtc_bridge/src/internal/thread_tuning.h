@@ -0,0 +1,26 @@
+#ifndef INTERNAL_THREAD_TUNING_H_
+#define INTERNAL_THREAD_TUNING_H_
+
+#include "rtc_types.h"
+
+namespace lumenrtc_bridge {
+
+// Number of logical processors; at least 1.
+int ProcessorCount();
+
+// Pins the calling thread to logical processor |cpu|. Returns false when the
+// platform has no affinity API or the request is rejected; callers treat
+// affinity as a hint and keep running either way.
+bool PinCurrentThreadToCpu(int cpu);
+
+// Applies |tuning| to the calling thread and returns the resulting state.
+// Settings the OS rejects (typically SCHED_FIFO without CAP_SYS_NICE) are
+// flagged in RTCThreadReport::failures; the thread keeps running regardless.
+RTCThreadReport ApplyThreadTuning(const RTCThreadTuning& tuning);
+
+// Reads back the calling thread's affinity and priority.
+RTCThreadReport CurrentThreadReport();
+
+}  // namespace lumenrtc_bridge
+
+#endif  // INTERNAL_THREAD_TUNING_H_
@@ -0,0 +1,435 @@
+#include "src/internal/udp_mux.h"
+
+#include <utility>
+#include <vector>
+
+#include "api/environment/environment_factory.h"
+#include "api/make_ref_counted.h"
+#include "p2p/base/packet_socket_factory.h"
+#include "p2p/client/basic_port_allocator.h"
+#include "rtc_base/async_packet_socket.h"
+#include "rtc_base/time_utils.h"
+
+namespace lumenrtc_bridge {
+
+namespace {
+
+constexpr size_t kStunHeaderSize = 20;
+constexpr uint32_t kStunMagicCookie = 0x2112A442;
+constexpr uint16_t kStunAttrUsername = 0x0006;
+
+// Header check only: RTP, RTCP and DTLS all fail on the first byte, so media
+// never gets as far as the cookie.
+bool IsStun(webrtc::ArrayView<const uint8_t> data) {
+  if (data.size() < kStunHeaderSize || (data[0] & 0xC0) != 0) {
+    return false;
+  }
+  const uint32_t cookie = (uint32_t{data[4]} << 24) |
+                          (uint32_t{data[5]} << 16) |
+                          (uint32_t{data[6]} << 8) | data[7];
+  const size_t length = (size_t{data[2]} << 8) | data[3];
+  return cookie == kStunMagicCookie && kStunHeaderSize + length <= data.size();
+}
+
+// Returns the USERNAME attribute of a STUN message without parsing the rest.
+// ICE puts "<receiver ufrag>:<sender ufrag>" there.
+bool StunUsername(webrtc::ArrayView<const uint8_t> data, std::string* out) {
+  if (!IsStun(data)) {
+    return false;
+  }
+  const size_t length = (size_t{data[2]} << 8) | data[3];
+  const size_t end = kStunHeaderSize + length;
+  size_t pos = kStunHeaderSize;
+  while (pos + 4 <= end) {
+    const uint16_t type = static_cast<uint16_t>((data[pos] << 8) | data[pos + 1]);
+    const size_t attr_length = (size_t{data[pos + 2]} << 8) | data[pos + 3];
+    pos += 4;
+    if (pos + attr_length > end) {
+      return false;
+    }
+    if (type == kStunAttrUsername) {
+      out->assign(reinterpret_cast<const char*>(data.data() + pos),
+                  attr_length);
+      return true;
+    }
+    pos += (attr_length + 3) & ~size_t{3};
+  }
+  return false;
+}
+
+// Local ufrag of a STUN message received on the mux.
+bool IncomingUfrag(webrtc::ArrayView<const uint8_t> data, std::string* ufrag) {
+  std::string username;
+  if (!StunUsername(data, &username)) {
+    return false;
+  }
+  *ufrag = username.substr(0, username.find(':'));
+  return !ufrag->empty();
+}
+
+// Local ufrag of a STUN message an endpoint sends.
+bool OutgoingUfrag(webrtc::ArrayView<const uint8_t> data, std::string* ufrag) {
+  std::string username;
+  if (!StunUsername(data, &username)) {
+    return false;
+  }
+  const size_t colon = username.find(':');
+  if (colon == std::string::npos || colon + 1 == username.size()) {
+    return false;
+  }
+  *ufrag = username.substr(colon + 1);
+  return true;
+}
+
+}  // namespace
+
+// The per-connection face of the mux: a UDP socket as far as UDPPort can
+// tell, sending through the shared socket and receiving what the mux routes
+// to it.
+class MuxEndpoint : public webrtc::AsyncPacketSocket {
+ public:
+  MuxEndpoint(webrtc::scoped_refptr<UdpMux> mux, MuxPacketSocketFactory* owner,
+              const webrtc::SocketAddress& local_address)
+      : mux_(std::move(mux)), owner_(owner), local_address_(local_address) {}
+
+  ~MuxEndpoint() override { mux_->RemoveEndpoint(this); }
+
+  MuxPacketSocketFactory* owner() const { return owner_; }
+
+  void Deliver(const webrtc::ReceivedIpPacket& packet) {
+    NotifyPacketReceived(packet);
+  }
+
+  webrtc::SocketAddress GetLocalAddress() const override {
+    return local_address_;
+  }
+
+  webrtc::SocketAddress GetRemoteAddress() const override {
+    return webrtc::SocketAddress();
+  }
+
+  int Send(const void* data, size_t size,
+           const webrtc::AsyncSocketPacketOptions& options) override {
+    error_ = ENOTCONN;
+    return -1;
+  }
+
+  int SendTo(const void* data, size_t size,
+             const webrtc::SocketAddress& address,
+             const webrtc::AsyncSocketPacketOptions& options) override {
+    webrtc::SentPacket sent_packet(options.packet_id, webrtc::TimeMillis(),
+                                   options.info_signaled_after_sent);
+    const int result = mux_->SendTo(this, data, size, address, options);
+    if (result < 0) {
+      error_ = EWOULDBLOCK;
+      return result;
+    }
+    SignalSentPacket(this, sent_packet);
+    return result;
+  }
+
+  int Close() override { return 0; }
+
+  State GetState() const override { return STATE_BOUND; }
+
+  // Options would apply to every connection on the shared socket.
+  int GetOption(webrtc::Socket::Option option, int* value) override {
+    return -1;
+  }
+  int SetOption(webrtc::Socket::Option option, int value) override {
+    return 0;
+  }
+
+  int GetError() const override { return error_; }
+  void SetError(int error) override { error_ = error; }
+
+ private:
+  const webrtc::scoped_refptr<UdpMux> mux_;
+  MuxPacketSocketFactory* const owner_;
+  const webrtc::SocketAddress local_address_;
+  int error_ = 0;
+};
+
+// Socket factory of one peer connection's allocator. Only IPv4 UDP sockets
+// are handed out, all of them endpoints on the mux.
+class MuxPacketSocketFactory : public webrtc::PacketSocketFactory {
+ public:
+  explicit MuxPacketSocketFactory(webrtc::scoped_refptr<UdpMux> mux)
+      : mux_(std::move(mux)) {}
+
+  ~MuxPacketSocketFactory() override { mux_->RemoveOwner(this); }
+
+  UdpMux* mux() const { return mux_.get(); }
+
+  webrtc::AsyncPacketSocket* CreateUdpSocket(
+      const webrtc::SocketAddress& address, uint16_t min_port,
+      uint16_t max_port) override {
+    if (address.family() != AF_INET) {
+      return nullptr;
+    }
+    return mux_->CreateEndpoint(this, address.ipaddr()).release();
+  }
+
+  webrtc::AsyncListenSocket* CreateServerTcpSocket(
+      const webrtc::SocketAddress& local_address, uint16_t min_port,
+      uint16_t max_port, int opts) override {
+    return nullptr;
+  }
+
+  webrtc::AsyncPacketSocket* CreateClientTcpSocket(
+      const webrtc::SocketAddress& local_address,
+      const webrtc::SocketAddress& remote_address,
+      const webrtc::PacketSocketTcpOptions& tcp_options) override {
+    return nullptr;
+  }
+
+  std::unique_ptr<webrtc::AsyncDnsResolverInterface> CreateAsyncDnsResolver()
+      override {
+    return nullptr;
+  }
+
+ private:
+  const webrtc::scoped_refptr<UdpMux> mux_;
+};
+
+namespace {
+
+// Registers the session's ufrag with the mux, including after an ICE restart
+// or when a pooled session is taken and given new credentials.
+class MuxPortAllocatorSession : public webrtc::BasicPortAllocatorSession {
+ public:
+  MuxPortAllocatorSession(webrtc::BasicPortAllocator* allocator,
+                          MuxPacketSocketFactory* owner,
+                          absl::string_view content_name, int component,
+                          absl::string_view ice_ufrag,
+                          absl::string_view ice_pwd)
+      : BasicPortAllocatorSession(allocator, content_name, component,
+                                  ice_ufrag, ice_pwd),
+        owner_(owner),
+        ufrag_(ice_ufrag) {
+    owner_->mux()->SetUfrag(ufrag_, owner_);
+  }
+
+  ~MuxPortAllocatorSession() override {
+    owner_->mux()->ClearUfrag(ufrag_, owner_);
+  }
+
+ protected:
+  void UpdateIceParametersInternal() override {
+    BasicPortAllocatorSession::UpdateIceParametersInternal();
+    owner_->mux()->ClearUfrag(ufrag_, owner_);
+    ufrag_ = ice_ufrag();
+    owner_->mux()->SetUfrag(ufrag_, owner_);
+  }
+
+ private:
+  MuxPacketSocketFactory* const owner_;
+  std::string ufrag_;
+};
+
+class MuxPortAllocator : public webrtc::BasicPortAllocator {
+ public:
+  MuxPortAllocator(webrtc::NetworkManager* network_manager,
+                   std::unique_ptr<MuxPacketSocketFactory> socket_factory)
+      : BasicPortAllocator(webrtc::CreateEnvironment(), network_manager,
+                           socket_factory.get()),
+        socket_factory_(std::move(socket_factory)) {
+    set_flags(webrtc::PORTALLOCATOR_DISABLE_STUN |
+              webrtc::PORTALLOCATOR_DISABLE_RELAY |
+              webrtc::PORTALLOCATOR_DISABLE_TCP);
+  }
+
+  ~MuxPortAllocator() override {
+    // Pooled sessions own endpoints; drop them while the factory they were
+    // registered under still exists.
+    DiscardCandidatePool();
+  }
+
+  webrtc::PortAllocatorSession* CreateSessionInternal(
+      absl::string_view content_name, int component,
+      absl::string_view ice_ufrag, absl::string_view ice_pwd) override {
+    return new MuxPortAllocatorSession(this, socket_factory_.get(),
+                                       content_name, component, ice_ufrag,
+                                       ice_pwd);
+  }
+
+ private:
+  const std::unique_ptr<MuxPacketSocketFactory> socket_factory_;
+};
+
+}  // namespace
+
+webrtc::scoped_refptr<UdpMux> UdpMux::Create(webrtc::Thread* network_thread,
+                                             int port) {
+  if (!network_thread || port <= 0 || port > 65535) {
+    return nullptr;
+  }
+  return network_thread->BlockingCall(
+      [network_thread, port]() -> webrtc::scoped_refptr<UdpMux> {
+        auto mux = webrtc::make_ref_counted<UdpMux>(network_thread, port);
+        return mux->socket_ ? mux : nullptr;
+      });
+}
+
+UdpMux::UdpMux(webrtc::Thread* network_thread, int port)
+    : network_thread_(network_thread), port_(port) {
+  RTC_DCHECK_RUN_ON(network_thread_);
+  const webrtc::Environment env = webrtc::CreateEnvironment();
+  socket_ = webrtc::AsyncUDPSocket::Create(
+      env, webrtc::SocketAddress("0.0.0.0", port),
+      *network_thread_->socketserver());
+  if (!socket_) {
+    return;
+  }
+  socket_->RegisterReceivedPacketCallback(
+      [this](webrtc::AsyncPacketSocket*,
+             const webrtc::ReceivedIpPacket& packet) { OnPacket(packet); });
+  network_manager_ = std::make_unique<webrtc::BasicNetworkManager>(
+      env, network_thread_->socketserver());
+}
+
+UdpMux::~UdpMux() {
+  // The socket and network manager belong to the network thread. The last
+  // reference is usually dropped there, by an allocator or endpoint.
+  if (network_thread_->IsCurrent()) {
+    socket_.reset();
+    network_manager_.reset();
+  } else {
+    network_thread_->BlockingCall([this] {
+      socket_.reset();
+      network_manager_.reset();
+    });
+  }
+}
+
+std::unique_ptr<webrtc::PortAllocator> UdpMux::CreatePortAllocator() {
+  return std::make_unique<MuxPortAllocator>(
+      network_manager_.get(), std::make_unique<MuxPacketSocketFactory>(
+                                  webrtc::scoped_refptr<UdpMux>(this)));
+}
+
+void UdpMux::AddStats(RTCUdpMuxStats* stats) const {
+  stats->address_hits += address_hits_.load(std::memory_order_relaxed);
+  stats->ufrag_hits += ufrag_hits_.load(std::memory_order_relaxed);
+  stats->misses += misses_.load(std::memory_order_relaxed);
+  stats->endpoints += endpoints_.load(std::memory_order_relaxed);
+  ++stats->ports;
+}
+
+std::unique_ptr<MuxEndpoint> UdpMux::CreateEndpoint(
+    MuxPacketSocketFactory* owner, const webrtc::IPAddress& local_ip) {
+  RTC_DCHECK_RUN_ON(network_thread_);
+  auto endpoint = std::make_unique<MuxEndpoint>(
+      webrtc::scoped_refptr<UdpMux>(this), owner,
+      webrtc::SocketAddress(local_ip, port_));
+  latest_endpoint_[owner] = endpoint.get();
+  endpoints_.fetch_add(1, std::memory_order_relaxed);
+  return endpoint;
+}
+
+void UdpMux::RemoveEndpoint(MuxEndpoint* endpoint) {
+  RTC_DCHECK_RUN_ON(network_thread_);
+  auto latest = latest_endpoint_.find(endpoint->owner());
+  if (latest != latest_endpoint_.end() && latest->second == endpoint) {
+    latest_endpoint_.erase(latest);
+  }
+  for (auto it = remotes_.begin(); it != remotes_.end();) {
+    it = it->second == endpoint ? remotes_.erase(it) : std::next(it);
+  }
+  for (auto it = ufrag_endpoints_.begin(); it != ufrag_endpoints_.end();) {
+    it = it->second == endpoint ? ufrag_endpoints_.erase(it) : std::next(it);
+  }
+  endpoints_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+int UdpMux::SendTo(MuxEndpoint* endpoint, const void* data, size_t size,
+                   const webrtc::SocketAddress& remote,
+                   const webrtc::AsyncSocketPacketOptions& options) {
+  RTC_DCHECK_RUN_ON(network_thread_);
+  if (!socket_) {
+    return -1;
+  }
+  // Replies from |remote| go to whoever talked to it last, and a connectivity
+  // check names the sender's ufrag, which pins that ufrag to this endpoint.
+  // Media to a known remote only costs a lookup.
+  auto known = remotes_.lower_bound(remote);
+  if (known == remotes_.end() || known->first != remote) {
+    remotes_.emplace_hint(known, remote, endpoint);
+  } else if (known->second != endpoint) {
+    known->second = endpoint;
+  }
+  const webrtc::ArrayView<const uint8_t> payload(
+      static_cast<const uint8_t*>(data), size);
+  std::string ufrag;
+  if (IsStun(payload) && OutgoingUfrag(payload, &ufrag)) {
+    ufrag_endpoints_[ufrag] = endpoint;
+  }
+  return socket_->SendTo(data, size, remote, options);
+}
+
+void UdpMux::SetUfrag(const std::string& ufrag,
+                      MuxPacketSocketFactory* owner) {
+  RTC_DCHECK_RUN_ON(network_thread_);
+  ufrags_[ufrag] = owner;
+}
+
+void UdpMux::ClearUfrag(const std::string& ufrag,
+                        MuxPacketSocketFactory* owner) {
+  RTC_DCHECK_RUN_ON(network_thread_);
+  auto it = ufrags_.find(ufrag);
+  if (it != ufrags_.end() && it->second == owner) {
+    ufrags_.erase(it);
+  }
+}
+
+void UdpMux::RemoveOwner(MuxPacketSocketFactory* owner) {
+  RTC_DCHECK_RUN_ON(network_thread_);
+  latest_endpoint_.erase(owner);
+  for (auto it = ufrags_.begin(); it != ufrags_.end();) {
+    it = it->second == owner ? ufrags_.erase(it) : std::next(it);
+  }
+}
+
+MuxEndpoint* UdpMux::EndpointForUfrag(const std::string& ufrag) {
+  auto learned = ufrag_endpoints_.find(ufrag);
+  if (learned != ufrag_endpoints_.end()) {
+    return learned->second;
+  }
+  // Nothing sent under this ufrag yet: fall back to the owner's newest
+  // endpoint, which is right unless the connection gathers on several
+  // transports (no max-bundle) or keeps a candidate pool.
+  auto owner = ufrags_.find(ufrag);
+  if (owner == ufrags_.end()) {
+    return nullptr;
+  }
+  auto latest = latest_endpoint_.find(owner->second);
+  return latest != latest_endpoint_.end() ? latest->second : nullptr;
+}
+
+void UdpMux::OnPacket(const webrtc::ReceivedIpPacket& packet) {
+  RTC_DCHECK_RUN_ON(network_thread_);
+  const webrtc::SocketAddress& remote = packet.source_address();
+  auto known = remotes_.find(remote);
+  MuxEndpoint* endpoint = known != remotes_.end() ? known->second : nullptr;
+
+  // A check naming another ufrag moves the address, e.g. after an ICE
+  // restart or when a client reuses its port for a new connection.
+  std::string ufrag;
+  if (IsStun(packet.payload()) && IncomingUfrag(packet.payload(), &ufrag)) {
+    MuxEndpoint* by_ufrag = EndpointForUfrag(ufrag);
+    if (by_ufrag && by_ufrag != endpoint) {
+      remotes_[remote] = by_ufrag;
+      ufrag_hits_.fetch_add(1, std::memory_order_relaxed);
+      by_ufrag->Deliver(packet);
+      return;
+    }
+  }
+  if (!endpoint) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  address_hits_.fetch_add(1, std::memory_order_relaxed);
+  endpoint->Deliver(packet);
+}
+
+}  // namespace lumenrtc_bridge
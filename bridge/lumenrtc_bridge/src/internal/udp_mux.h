@@ -0,0 +1,101 @@
+#ifndef INTERNAL_UDP_MUX_H_
+#define INTERNAL_UDP_MUX_H_
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "api/ref_count.h"
+#include "api/scoped_refptr.h"
+#include "api/sequence_checker.h"
+#include "p2p/base/port_allocator.h"
+#include "rtc_base/async_udp_socket.h"
+#include "rtc_base/network.h"
+#include "rtc_base/network/received_packet.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/thread.h"
+#include "rtc_types.h"
+
+namespace lumenrtc_bridge {
+
+class MuxEndpoint;
+class MuxPacketSocketFactory;
+
+// One UDP port on a network thread shared by every peer connection whose
+// port allocator came from CreatePortAllocator(). Each connection gets its
+// own endpoint socket; incoming packets are routed to an endpoint by remote
+// address, or, for a STUN message, by the local ufrag in its USERNAME
+// attribute. Connections should use max-bundle: a ufrag maps to the endpoint
+// that sent checks under it, and before that to its owner's newest endpoint.
+//
+// The mux socket is bound to the wildcard address, so endpoints report the
+// interface address the allocator asked for with the mux port, and host
+// candidates on every IPv4 interface share that port. Only host candidates
+// are gathered: STUN and TURN responses cannot be told apart by address
+// once many connections share a socket.
+//
+// Everything except AddStats() runs on the network thread.
+class UdpMux : public webrtc::RefCountInterface {
+ public:
+  // Binds 0.0.0.0:|port| on |network_thread|. Returns null if the port is
+  // taken.
+  static webrtc::scoped_refptr<UdpMux> Create(webrtc::Thread* network_thread,
+                                              int port);
+
+  ~UdpMux() override;
+
+  // Allocator for one peer connection. It keeps the mux alive, so a port
+  // stays bound until the last connection using it is closed.
+  std::unique_ptr<webrtc::PortAllocator> CreatePortAllocator();
+
+  int port() const { return port_; }
+
+  // Adds this mux's counters to |stats|. Safe from any thread.
+  void AddStats(RTCUdpMuxStats* stats) const;
+
+  // Called by endpoints, sessions and socket factories.
+  std::unique_ptr<MuxEndpoint> CreateEndpoint(
+      MuxPacketSocketFactory* owner, const webrtc::IPAddress& local_ip);
+  void RemoveEndpoint(MuxEndpoint* endpoint);
+  int SendTo(MuxEndpoint* endpoint, const void* data, size_t size,
+             const webrtc::SocketAddress& remote,
+             const webrtc::AsyncSocketPacketOptions& options);
+  void SetUfrag(const std::string& ufrag, MuxPacketSocketFactory* owner);
+  void ClearUfrag(const std::string& ufrag, MuxPacketSocketFactory* owner);
+  void RemoveOwner(MuxPacketSocketFactory* owner);
+
+ protected:
+  // Use Create(); binding happens here, on the network thread.
+  UdpMux(webrtc::Thread* network_thread, int port);
+
+ private:
+  void OnPacket(const webrtc::ReceivedIpPacket& packet);
+  MuxEndpoint* EndpointForUfrag(const std::string& ufrag);
+
+  webrtc::Thread* const network_thread_;
+  const int port_;
+  std::unique_ptr<webrtc::AsyncUDPSocket> socket_;
+  std::unique_ptr<webrtc::BasicNetworkManager> network_manager_;
+
+  // Latest endpoint of each owner; a new ICE session replaces the previous
+  // one as the target for its ufrag.
+  std::map<MuxPacketSocketFactory*, MuxEndpoint*> latest_endpoint_
+      RTC_GUARDED_BY(network_thread_);
+  std::map<std::string, MuxPacketSocketFactory*> ufrags_
+      RTC_GUARDED_BY(network_thread_);
+  // Ufrags seen in checks an endpoint sent.
+  std::map<std::string, MuxEndpoint*> ufrag_endpoints_
+      RTC_GUARDED_BY(network_thread_);
+  std::map<webrtc::SocketAddress, MuxEndpoint*> remotes_
+      RTC_GUARDED_BY(network_thread_);
+
+  std::atomic<uint64_t> address_hits_{0};
+  std::atomic<uint64_t> ufrag_hits_{0};
+  std::atomic<uint64_t> misses_{0};
+  std::atomic<uint32_t> endpoints_{0};
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // INTERNAL_UDP_MUX_H_
@@ -16,6 +16,7 @@
 #include "api/video/i420_buffer.h"
 #include "api/video/video_frame_buffer.h"
 #include "api/video/video_rotation.h"
+#include "rtc_latency_tracer.h"
 
 namespace webrtc {
 namespace internal {
@@ -23,6 +24,9 @@ VideoCapturer::VideoCapturer() = default;
 VideoCapturer::~VideoCapturer() = default;
 
 void VideoCapturer::OnFrame(const VideoFrame& frame) {
+  lumenrtc_bridge::RTCTraceScope trace(
+      lumenrtc_bridge::RTCTraceStage::kCaptureAdapt, this,
+      frame.timestamp_us());
   int cropped_width = 0;
   int cropped_height = 0;
   int out_width = 0;
@@ -0,0 +1,240 @@
+#include "src/internal/video_conversion_cache.h"
+
+#include <utility>
+
+#include "api/video/i420_buffer.h"
+#include "api/video/nv12_buffer.h"
+#include "libyuv/convert.h"
+#include "libyuv/convert_from.h"
+
+namespace lumenrtc_bridge {
+
+namespace {
+
+// Per format and size, as many frames as renderers may hold at once.
+constexpr size_t kMaxPooledBuffers = 8;
+// A pool nobody asked for in this many frames is freed, so a renderer that
+// keeps resizing does not leave a pool behind for every size.
+constexpr uint64_t kPoolIdleFrames = 60;
+
+}  // namespace
+
+PackedVideoFrameBuffer::PackedVideoFrameBuffer(RTCVideoPixelFormat format,
+                                               int width, int height)
+    : format_(format),
+      width_(width),
+      height_(height),
+      data_(static_cast<uint8_t*>(webrtc::AlignedMalloc(
+          static_cast<size_t>(width) * height * 4, 64))) {}
+
+webrtc::scoped_refptr<webrtc::I420BufferInterface>
+PackedVideoFrameBuffer::ToI420() {
+  webrtc::scoped_refptr<webrtc::I420Buffer> i420 =
+      webrtc::I420Buffer::Create(width_, height_);
+  const auto to_i420 =
+      format_ == RTCVideoPixelFormat::kBGRA ? libyuv::BGRAToI420
+                                            : libyuv::ARGBToI420;
+  to_i420(data(), stride(), i420->MutableDataY(), i420->StrideY(),
+          i420->MutableDataU(), i420->StrideU(), i420->MutableDataV(),
+          i420->StrideV(), width_, height_);
+  return i420;
+}
+
+VideoConversionCache::Pool::Pool()
+    : planar(/*zero_initialize=*/false, kMaxPooledBuffers) {}
+
+VideoConversionCache::Pool::~Pool() = default;
+
+VideoConversionCache::VideoConversionCache() = default;
+
+VideoConversionCache::~VideoConversionCache() = default;
+
+webrtc::scoped_refptr<webrtc::VideoFrameBuffer> VideoConversionCache::Convert(
+    const webrtc::VideoFrame& frame, RTCVideoPixelFormat format, int width,
+    int height) {
+  if (format == RTCVideoPixelFormat::kNative) {
+    format = RTCVideoPixelFormat::kI420;
+  }
+  webrtc::MutexLock lock(&mutex_);
+  const webrtc::scoped_refptr<webrtc::VideoFrameBuffer>& buffer =
+      frame.video_frame_buffer();
+  if (buffer.get() != source_ ||
+      frame.timestamp_us() != source_timestamp_us_) {
+    source_ = buffer.get();
+    source_timestamp_us_ = frame.timestamp_us();
+    ++frame_count_;
+    conversions_.clear();
+    for (auto it = pools_.begin(); it != pools_.end();) {
+      if (frame_count_ - it->second->last_used_frame > kPoolIdleFrames) {
+        it = pools_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  return ConvertLocked(buffer, Key(format, width, height));
+}
+
+webrtc::scoped_refptr<webrtc::VideoFrameBuffer>
+VideoConversionCache::ConvertLocked(
+    const webrtc::scoped_refptr<webrtc::VideoFrameBuffer>& buffer,
+    const Key& key) {
+  auto cached = conversions_.find(key);
+  if (cached != conversions_.end()) {
+    return cached->second;
+  }
+  const auto [format, width, height] = key;
+  const bool same_size =
+      width == buffer->width() && height == buffer->height();
+  webrtc::scoped_refptr<webrtc::VideoFrameBuffer> result;
+  switch (format) {
+    case RTCVideoPixelFormat::kNative:
+    case RTCVideoPixelFormat::kI420: {
+      if (same_size &&
+          buffer->type() == webrtc::VideoFrameBuffer::Type::kI420) {
+        result = buffer;
+        break;
+      }
+      webrtc::scoped_refptr<webrtc::I420Buffer> i420 =
+          PoolFor(key).planar.CreateI420Buffer(width, height);
+      if (!i420) {
+        return nullptr;
+      }
+      if (same_size &&
+          buffer->type() == webrtc::VideoFrameBuffer::Type::kNV12) {
+        const webrtc::NV12BufferInterface* nv12 = buffer->GetNV12();
+        libyuv::NV12ToI420(nv12->DataY(), nv12->StrideY(), nv12->DataUV(),
+                           nv12->StrideUV(), i420->MutableDataY(),
+                           i420->StrideY(), i420->MutableDataU(),
+                           i420->StrideU(), i420->MutableDataV(),
+                           i420->StrideV(), width, height);
+      } else {
+        // ToI420() is null when a texture cannot be read back.
+        webrtc::scoped_refptr<webrtc::I420BufferInterface> source =
+            buffer->ToI420();
+        if (!source) {
+          return nullptr;
+        }
+        i420->ScaleFrom(*source);
+      }
+      result = i420;
+      break;
+    }
+    case RTCVideoPixelFormat::kNV12: {
+      if (same_size &&
+          buffer->type() == webrtc::VideoFrameBuffer::Type::kNV12) {
+        result = buffer;
+        break;
+      }
+      if (buffer->type() == webrtc::VideoFrameBuffer::Type::kNV12) {
+        webrtc::scoped_refptr<webrtc::NV12Buffer> nv12 =
+            PoolFor(key).planar.CreateNV12Buffer(width, height);
+        if (!nv12) {
+          return nullptr;
+        }
+        nv12->CropAndScaleFrom(*buffer->GetNV12(), 0, 0, buffer->width(),
+                               buffer->height());
+        result = nv12;
+        break;
+      }
+      // Scaled as I420 first, which a renderer may want as well.
+      webrtc::scoped_refptr<webrtc::VideoFrameBuffer> scaled = ConvertLocked(
+          buffer, Key(RTCVideoPixelFormat::kI420, width, height));
+      if (!scaled) {
+        return nullptr;
+      }
+      webrtc::scoped_refptr<webrtc::NV12Buffer> nv12 =
+          PoolFor(key).planar.CreateNV12Buffer(width, height);
+      if (!nv12) {
+        return nullptr;
+      }
+      const webrtc::I420BufferInterface* i420 = scaled->GetI420();
+      libyuv::I420ToNV12(i420->DataY(), i420->StrideY(), i420->DataU(),
+                         i420->StrideU(), i420->DataV(), i420->StrideV(),
+                         nv12->MutableDataY(), nv12->StrideY(),
+                         nv12->MutableDataUV(), nv12->StrideUV(), width,
+                         height);
+      result = nv12;
+      break;
+    }
+    case RTCVideoPixelFormat::kARGB:
+    case RTCVideoPixelFormat::kBGRA: {
+      webrtc::scoped_refptr<webrtc::VideoFrameBuffer> scaled = ConvertLocked(
+          buffer, Key(RTCVideoPixelFormat::kI420, width, height));
+      if (!scaled) {
+        return nullptr;
+      }
+      webrtc::scoped_refptr<PackedVideoFrameBuffer> packed =
+          CreatePackedBuffer(key);
+      if (!packed) {
+        return nullptr;
+      }
+      const webrtc::I420BufferInterface* i420 = scaled->GetI420();
+      const auto from_i420 = format == RTCVideoPixelFormat::kBGRA
+                                 ? libyuv::I420ToBGRA
+                                 : libyuv::I420ToARGB;
+      from_i420(i420->DataY(), i420->StrideY(), i420->DataU(),
+                i420->StrideU(), i420->DataV(), i420->StrideV(),
+                packed->MutableData(), packed->stride(), width, height);
+      result = packed;
+      break;
+    }
+  }
+  conversions_.emplace(key, result);
+  return result;
+}
+
+VideoConversionCache::Pool& VideoConversionCache::PoolFor(const Key& key) {
+  std::unique_ptr<Pool>& pool = pools_[key];
+  if (!pool) {
+    pool = std::make_unique<Pool>();
+  }
+  pool->last_used_frame = frame_count_;
+  return *pool;
+}
+
+webrtc::scoped_refptr<PackedVideoFrameBuffer>
+VideoConversionCache::CreatePackedBuffer(const Key& key) {
+  Pool& pool = PoolFor(key);
+  for (const auto& buffer : pool.packed) {
+    // Only the pool holds it, so every renderer is done with it.
+    if (buffer->HasOneRef()) {
+      return buffer;
+    }
+  }
+  if (pool.packed.size() >= kMaxPooledBuffers) {
+    return nullptr;
+  }
+  pool.packed.push_back(
+      webrtc::scoped_refptr<webrtc::RefCountedObject<PackedVideoFrameBuffer>>(
+          new webrtc::RefCountedObject<PackedVideoFrameBuffer>(
+              std::get<0>(key), std::get<1>(key), std::get<2>(key))));
+  return pool.packed.back();
+}
+
+webrtc::scoped_refptr<VideoConversionCache> FindVideoConversionCache(
+    const webrtc::VideoTrackInterface* track) {
+  static webrtc::Mutex* mutex = new webrtc::Mutex();
+  static auto* caches = new std::map<
+      const webrtc::VideoTrackInterface*,
+      webrtc::scoped_refptr<webrtc::RefCountedObject<VideoConversionCache>>>();
+  webrtc::MutexLock lock(mutex);
+  // Only the map holds the caches of tracks whose adapters are all gone.
+  for (auto it = caches->begin(); it != caches->end();) {
+    if (it->second->HasOneRef()) {
+      it = caches->erase(it);
+    } else {
+      ++it;
+    }
+  }
+  auto it = caches->find(track);
+  if (it != caches->end()) {
+    return it->second;
+  }
+  webrtc::scoped_refptr<webrtc::RefCountedObject<VideoConversionCache>> cache(
+      new webrtc::RefCountedObject<VideoConversionCache>());
+  caches->emplace(track, cache);
+  return cache;
+}
+
+}  // namespace lumenrtc_bridge
@@ -0,0 +1,102 @@
+#ifndef INTERNAL_VIDEO_CONVERSION_CACHE_H_
+#define INTERNAL_VIDEO_CONVERSION_CACHE_H_
+
+#include <stdint.h>
+
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "api/media_stream_interface.h"
+#include "api/ref_count.h"
+#include "api/scoped_refptr.h"
+#include "api/video/video_frame.h"
+#include "api/video/video_frame_buffer.h"
+#include "common_video/include/video_frame_buffer_pool.h"
+#include "rtc_base/memory/aligned_malloc.h"
+#include "rtc_base/ref_counted_object.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_types.h"
+
+namespace lumenrtc_bridge {
+
+// Packed 32-bit pixels, ARGB or BGRA in libyuv's naming, which is the
+// reverse of the byte order in memory.
+class PackedVideoFrameBuffer : public webrtc::VideoFrameBuffer {
+ public:
+  PackedVideoFrameBuffer(RTCVideoPixelFormat format, int width, int height);
+
+  Type type() const override { return Type::kNative; }
+  int width() const override { return width_; }
+  int height() const override { return height_; }
+  webrtc::scoped_refptr<webrtc::I420BufferInterface> ToI420() override;
+
+  RTCVideoPixelFormat format() const { return format_; }
+  const uint8_t* data() const { return data_.get(); }
+  uint8_t* MutableData() { return data_.get(); }
+  int stride() const { return width_ * 4; }
+
+ private:
+  const RTCVideoPixelFormat format_;
+  const int width_;
+  const int height_;
+  const std::unique_ptr<uint8_t, webrtc::AlignedFreeDeleter> data_;
+};
+
+// Converts the frames of one track for its renderers. Each frame is
+// converted once per format and size, however many renderers ask for it,
+// into buffers taken from a pool per format and size; a buffer returns to
+// its pool once every renderer has released the frame.
+class VideoConversionCache : public webrtc::RefCountInterface {
+ public:
+  VideoConversionCache();
+  ~VideoConversionCache() override;
+
+  // |frame| as |format| at |width|x|height|, scaled without regard to its
+  // aspect. Null if a pool ran dry because renderers hold on to its frames.
+  // A kARGB or kBGRA result is a PackedVideoFrameBuffer; kNative is taken
+  // as kI420.
+  webrtc::scoped_refptr<webrtc::VideoFrameBuffer> Convert(
+      const webrtc::VideoFrame& frame, RTCVideoPixelFormat format, int width,
+      int height);
+
+ private:
+  using Key = std::tuple<RTCVideoPixelFormat, int, int>;
+
+  struct Pool {
+    Pool();
+    ~Pool();
+
+    webrtc::VideoFrameBufferPool planar;
+    std::vector<webrtc::scoped_refptr<
+        webrtc::RefCountedObject<PackedVideoFrameBuffer>>>
+        packed;
+    uint64_t last_used_frame = 0;
+  };
+
+  webrtc::scoped_refptr<webrtc::VideoFrameBuffer> ConvertLocked(
+      const webrtc::scoped_refptr<webrtc::VideoFrameBuffer>& buffer,
+      const Key& key) RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  Pool& PoolFor(const Key& key) RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  webrtc::scoped_refptr<PackedVideoFrameBuffer> CreatePackedBuffer(
+      const Key& key) RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  webrtc::Mutex mutex_;
+  // The frame the conversions below were made from. Compared by address and
+  // timestamp, so the cache does not keep a decoder's buffer from its pool.
+  const webrtc::VideoFrameBuffer* source_ RTC_GUARDED_BY(mutex_) = nullptr;
+  int64_t source_timestamp_us_ RTC_GUARDED_BY(mutex_) = 0;
+  uint64_t frame_count_ RTC_GUARDED_BY(mutex_) = 0;
+  std::map<Key, webrtc::scoped_refptr<webrtc::VideoFrameBuffer>> conversions_
+      RTC_GUARDED_BY(mutex_);
+  std::map<Key, std::unique_ptr<Pool>> pools_ RTC_GUARDED_BY(mutex_);
+};
+
+// The cache shared by every VideoSinkAdapter of |track|.
+webrtc::scoped_refptr<VideoConversionCache> FindVideoConversionCache(
+    const webrtc::VideoTrackInterface* track);
+
+}  // namespace lumenrtc_bridge
+
+#endif  // INTERNAL_VIDEO_CONVERSION_CACHE_H_
@@ -0,0 +1,105 @@
+#include "src/internal/virtual_network.h"
+
+#if defined(RTC_VIRTUAL_NETWORK)
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "api/environment/environment_factory.h"
+#include "api/make_ref_counted.h"
+#include "p2p/base/basic_packet_socket_factory.h"
+#include "p2p/client/basic_port_allocator.h"
+#include "rtc_base/fake_network.h"
+#include "rtc_base/ip_address.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/virtual_socket_server.h"
+#endif
+
+namespace lumenrtc_bridge {
+
+#if defined(RTC_VIRTUAL_NETWORK)
+namespace {
+
+// Host addresses come from 10.0.0.0/8; 0 and the broadcast address are
+// skipped.
+constexpr uint32_t kHostBase = 0x0A000000;
+constexpr uint32_t kMaxHost = 0x00FFFFFE;
+
+class VirtualNetworkImpl : public VirtualNetwork {
+ public:
+  VirtualNetworkImpl()
+      : socket_server_(std::make_unique<webrtc::VirtualSocketServer>()),
+        packet_socket_factory_(socket_server_.get()) {}
+
+  std::unique_ptr<webrtc::Thread> CreateNetworkThread() override {
+    RTC_DCHECK(!network_thread_);
+    auto thread = std::make_unique<webrtc::Thread>(socket_server_.get());
+    network_thread_ = thread.get();
+    return thread;
+  }
+
+  bool SetConditions(const RTCVirtualNetworkOptions& options) override {
+    if (!network_thread_ || options.latency_ms < 0 || options.jitter_ms < 0 ||
+        !(options.loss_rate >= 0.0 && options.loss_rate <= 1.0) ||
+        options.bandwidth_bps < 0) {
+      return false;
+    }
+    network_thread_->BlockingCall([this, &options] {
+      socket_server_->set_delay_mean(
+          static_cast<uint32_t>(options.latency_ms));
+      socket_server_->set_delay_stddev(
+          static_cast<uint32_t>(options.jitter_ms));
+      socket_server_->UpdateDelayDistribution();
+      socket_server_->set_drop_probability(options.loss_rate);
+      // The socket server counts bytes per second.
+      socket_server_->set_bandwidth(static_cast<uint32_t>(
+          std::min<int64_t>(options.bandwidth_bps / 8,
+                            std::numeric_limits<uint32_t>::max())));
+    });
+    return true;
+  }
+
+  std::unique_ptr<webrtc::PortAllocator> CreatePortAllocator() override {
+    webrtc::FakeNetworkManager* manager = nullptr;
+    {
+      webrtc::MutexLock lock(&mutex_);
+      const uint32_t host = next_host_;
+      next_host_ = next_host_ % kMaxHost + 1;
+      network_managers_.push_back(
+          std::make_unique<webrtc::FakeNetworkManager>());
+      manager = network_managers_.back().get();
+      manager->AddInterface(
+          webrtc::SocketAddress(webrtc::IPAddress(kHostBase | host), 0));
+    }
+    auto allocator = std::make_unique<webrtc::BasicPortAllocator>(
+        webrtc::CreateEnvironment(), manager, &packet_socket_factory_);
+    allocator->set_flags(webrtc::PORTALLOCATOR_DISABLE_STUN |
+                         webrtc::PORTALLOCATOR_DISABLE_RELAY |
+                         webrtc::PORTALLOCATOR_DISABLE_TCP);
+    return allocator;
+  }
+
+ private:
+  const std::unique_ptr<webrtc::VirtualSocketServer> socket_server_;
+  webrtc::BasicPacketSocketFactory packet_socket_factory_;
+  webrtc::Thread* network_thread_ = nullptr;
+  webrtc::Mutex mutex_;
+  uint32_t next_host_ RTC_GUARDED_BY(mutex_) = 1;
+  std::vector<std::unique_ptr<webrtc::FakeNetworkManager>> network_managers_
+      RTC_GUARDED_BY(mutex_);
+};
+
+}  // namespace
+#endif
+
+webrtc::scoped_refptr<VirtualNetwork> VirtualNetwork::Create() {
+#if defined(RTC_VIRTUAL_NETWORK)
+  return webrtc::make_ref_counted<VirtualNetworkImpl>();
+#else
+  return nullptr;
+#endif
+}
+
+}  // namespace lumenrtc_bridge
@@ -0,0 +1,43 @@
+#ifndef INTERNAL_VIRTUAL_NETWORK_H_
+#define INTERNAL_VIRTUAL_NETWORK_H_
+
+#include <memory>
+
+#include "api/ref_count.h"
+#include "api/scoped_refptr.h"
+#include "p2p/base/port_allocator.h"
+#include "rtc_base/thread.h"
+#include "rtc_types.h"
+
+namespace lumenrtc_bridge {
+
+// In-process network built on WebRTC's VirtualSocketServer. The network
+// thread created by CreateNetworkThread() services every socket, and each
+// port allocator handed out gets a fake interface with its own address, so
+// connections find each other through host candidates only.
+class VirtualNetwork : public webrtc::RefCountInterface {
+ public:
+  // Returns null unless the bridge is built with
+  // lumenrtc_bridge_virtual_network, which links WebRTC test utilities.
+  static webrtc::scoped_refptr<VirtualNetwork> Create();
+
+  // Returns the network thread running on this network's socket server. The
+  // caller owns and starts it; it must be destroyed before the network.
+  // Only one thread may be created.
+  virtual std::unique_ptr<webrtc::Thread> CreateNetworkThread() = 0;
+
+  // Applies |options| on the network thread. Returns false if a value is out
+  // of range or the network thread does not exist yet.
+  virtual bool SetConditions(const RTCVirtualNetworkOptions& options) = 0;
+
+  // UDP-only allocator on a new fake interface (10.x.y.z). The network keeps
+  // the interface alive, so the allocator must not outlive it.
+  virtual std::unique_ptr<webrtc::PortAllocator> CreatePortAllocator() = 0;
+
+ protected:
+  ~VirtualNetwork() override = default;
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // INTERNAL_VIRTUAL_NETWORK_H_
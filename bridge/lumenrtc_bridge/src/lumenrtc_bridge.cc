@@ -7,6 +7,7 @@
 #include "rtc_base/ssl_adapter.h"
 #include "rtc_base/thread.h"
 #include "rtc_peerconnection_factory_impl.h"
+#include "src/internal/factory_threads.h"
 
 namespace lumenrtc_bridge {
 namespace {
@@ -40,6 +41,7 @@ void LumenRtcBridgeRuntime::Terminate() {
     return;
   }
 
+  FactoryThreadPool::ReleaseIdle();
   webrtc::ThreadManager::Instance()->SetCurrentThread(nullptr);
   webrtc::CleanupSSL();
 }
@@ -50,4 +52,53 @@ LumenRtcBridgeRuntime::CreateRTCPeerConnectionFactory() {
       new RefCountedObject<RTCPeerConnectionFactoryImpl>());
 }
 
+scoped_refptr<RTCPeerConnectionFactory>
+LumenRtcBridgeRuntime::CreateRTCPeerConnectionFactory(
+    const RTCFactoryThreadOptions& options) {
+  FactoryThreadConfig config;
+  config.network_thread_count = options.network_thread_count;
+  config.network_first_cpu = options.network_first_cpu;
+  config.worker = options.worker_thread;
+  config.signaling = options.signaling_thread;
+  config.network = options.network_thread;
+  config.capture = options.capture_thread;
+  config.virtual_network = options.virtual_network;
+
+  RTCFactoryThreadOptions::Mode mode = options.mode;
+  if (mode == RTCFactoryThreadOptions::Mode::kPooled &&
+      options.virtual_network.enabled) {
+    // Pooled groups are shared with unrelated tenants; a simulated network
+    // must not leak into them.
+    mode = RTCFactoryThreadOptions::Mode::kDedicated;
+  }
+
+  webrtc::scoped_refptr<FactoryThreads> threads;
+  switch (mode) {
+    case RTCFactoryThreadOptions::Mode::kDedicated:
+      return scoped_refptr<RTCPeerConnectionFactory>(
+          new RefCountedObject<RTCPeerConnectionFactoryImpl>(config));
+    case RTCFactoryThreadOptions::Mode::kShared: {
+      if (!options.share_with) {
+        return nullptr;
+      }
+      threads = static_cast<RTCPeerConnectionFactoryImpl*>(
+                    options.share_with.get())
+                    ->threads();
+      if (!threads) {
+        return nullptr;
+      }
+      threads->AddFactory();
+      break;
+    }
+    case RTCFactoryThreadOptions::Mode::kPooled:
+      threads = FactoryThreadPool::Acquire(options.pool_size, config);
+      if (!threads) {
+        return nullptr;
+      }
+      break;
+  }
+  return scoped_refptr<RTCPeerConnectionFactory>(
+      new RefCountedObject<RTCPeerConnectionFactoryImpl>(config, threads));
+}
+
 }  // namespace lumenrtc_bridge
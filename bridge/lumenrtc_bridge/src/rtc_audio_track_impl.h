@@ -11,6 +11,7 @@
 #include "rtc_audio_track.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/synchronization/mutex.h"
+#include "rtc_latency_tracer.h"
 
 namespace lumenrtc_bridge {
 
@@ -20,6 +21,7 @@ class AudioTrackSinkAdapter : public webrtc::AudioTrackSinkInterface {
 
   void OnData(const void* audio_data, int bits_per_sample, int sample_rate,
               size_t number_of_channels, size_t number_of_frames) override {
+    RTCTraceScope trace(RTCTraceStage::kAudioSinkAdapter, this);
     if (sink_) {
       sink_->OnData(audio_data, bits_per_sample, sample_rate,
                     number_of_channels, number_of_frames);
@@ -20,6 +20,8 @@
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/time_utils.h"
+#include "rtc_latency_tracer.h"
+#include "src/internal/thread_tuning.h"
 #include "third_party/libyuv/include/libyuv.h"
 #ifdef WEBRTC_WIN
 #include "modules/desktop_capture/win/window_capture_utils.h"
@@ -57,7 +59,7 @@ enum { kCaptureDelay = 33, kCaptureMessageId = 1000 };
 RTCDesktopCapturerImpl::RTCDesktopCapturerImpl(
     DesktopType type, webrtc::DesktopCapturer::SourceId source_id,
     webrtc::Thread* signaling_thread, scoped_refptr<MediaSource> source,
-    bool showCursor)
+    bool showCursor, const RTCThreadTuning& tuning)
     : thread_(webrtc::Thread::Create()),
       source_id_(source_id),
       signaling_thread_(signaling_thread),
@@ -65,6 +67,8 @@ RTCDesktopCapturerImpl::RTCDesktopCapturerImpl(
   RTC_DCHECK(thread_);
   type_ = type;
   thread_->Start();
+  thread_report_ =
+      thread_->BlockingCall([&tuning] { return ApplyThreadTuning(tuning); });
   options_ = webrtc::DesktopCaptureOptions::CreateDefault();
   options_.set_detect_updated_region(true);
 #ifdef WEBRTC_WIN
@@ -193,6 +197,31 @@ void RTCDesktopCapturerImpl::Stop() {
   capture_state_ = CS_STOPPED;
 }
 
+// The async variants run on the signaling thread rather than the capture
+// thread: Start() blocks on the capture thread, and the posted reference may
+// be the last one, whose destructor stops the capture thread.
+void RTCDesktopCapturerImpl::StartAsync(uint32_t fps, OnStarted callback) {
+  signaling_thread_->PostTask(
+      [self = scoped_refptr<RTCDesktopCapturerImpl>(this), fps,
+       callback]() mutable { callback(self->Start(fps)); });
+}
+
+void RTCDesktopCapturerImpl::StartAsync(uint32_t fps, uint32_t x, uint32_t y,
+                                        uint32_t w, uint32_t h,
+                                        OnStarted callback) {
+  signaling_thread_->PostTask(
+      [self = scoped_refptr<RTCDesktopCapturerImpl>(this), fps, x, y, w, h,
+       callback]() mutable { callback(self->Start(fps, x, y, w, h)); });
+}
+
+void RTCDesktopCapturerImpl::StopAsync(OnCaptureStopped callback) {
+  signaling_thread_->PostTask(
+      [self = scoped_refptr<RTCDesktopCapturerImpl>(this), callback]() mutable {
+        self->Stop();
+        callback();
+      });
+}
+
 bool RTCDesktopCapturerImpl::IsRunning() {
   return capture_state_ == CS_RUNNING;
 }
@@ -206,6 +235,10 @@ int filterException(int code, PEXCEPTION_POINTERS ex) {
 void RTCDesktopCapturerImpl::OnCaptureResult(
     webrtc::DesktopCapturer::Result result,
     std::unique_ptr<webrtc::DesktopFrame> frame) {
+  // Explicit timestamps rather than RTCTraceScope: MSVC rejects objects that
+  // need unwinding in a function using __try.
+  const int64_t trace_start_us =
+      RTCLatencyTracer::IsEnabled() ? RTCLatencyTracer::NowUs() : -1;
   if (result != result_) {
     if (result == webrtc::DesktopCapturer::Result::ERROR_PERMANENT) {
       if (observer_) {
@@ -262,6 +295,8 @@ void RTCDesktopCapturerImpl::OnCaptureResult(
       i420_buffer_ = webrtc::I420Buffer::Create(width, height);
     }
 
+    const int64_t convert_start_us =
+        trace_start_us >= 0 ? RTCLatencyTracer::NowUs() : -1;
     const int convert_result = libyuv::ConvertToI420(
         frame->data(), 0, i420_buffer_->MutableDataY(),
         i420_buffer_->StrideY(), i420_buffer_->MutableDataU(),
@@ -281,11 +316,20 @@ void RTCDesktopCapturerImpl::OnCaptureResult(
 
     // Build a frame with an explicit microsecond timestamp.
     // This avoids unit ambiguity for downstream encoders (notably OpenH264).
+    const int64_t timestamp_us = webrtc::TimeMicros();
+    if (convert_start_us >= 0) {
+      RTCLatencyTracer::Record(RTCTraceStage::kDesktopConvert, this,
+                               convert_start_us, timestamp_us);
+    }
     OnFrame(webrtc::VideoFrame::Builder()
                 .set_video_frame_buffer(i420_buffer_)
-                .set_timestamp_us(webrtc::TimeMicros())
+                .set_timestamp_us(timestamp_us)
                 .set_rotation(webrtc::kVideoRotation_0)
                 .build());
+    if (trace_start_us >= 0) {
+      RTCLatencyTracer::Record(RTCTraceStage::kDesktopCapture, this,
+                               trace_start_us, timestamp_us);
+    }
   }
 #ifdef WEBRTC_WIN
   __except (filterException(GetExceptionCode(), GetExceptionInformation())) {
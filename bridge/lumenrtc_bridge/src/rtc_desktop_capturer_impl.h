@@ -38,7 +38,8 @@ class RTCDesktopCapturerImpl : public RTCDesktopCapturer,
   RTCDesktopCapturerImpl(DesktopType type,
                          webrtc::DesktopCapturer::SourceId source_id,
                          webrtc::Thread* signaling_thread,
-                         scoped_refptr<MediaSource> source, bool showCursor = true);
+                         scoped_refptr<MediaSource> source, bool showCursor = true,
+                         const RTCThreadTuning& tuning = RTCThreadTuning());
   ~RTCDesktopCapturerImpl();
 
   void RegisterDesktopCapturerObserver(
@@ -54,10 +55,19 @@ class RTCDesktopCapturerImpl : public RTCDesktopCapturer,
 
   void Stop() override;
 
+  void StartAsync(uint32_t fps, OnStarted callback) override;
+
+  void StartAsync(uint32_t fps, uint32_t x, uint32_t y, uint32_t w, uint32_t h,
+                  OnStarted callback) override;
+
+  void StopAsync(OnCaptureStopped callback) override;
+
   bool IsRunning() override;
 
   scoped_refptr<MediaSource> source() override { return source_; }
 
+  RTCThreadReport GetThreadReport() override { return thread_report_; }
+
  protected:
   virtual void OnCaptureResult(
       webrtc::DesktopCapturer::Result result,
@@ -68,6 +78,7 @@ class RTCDesktopCapturerImpl : public RTCDesktopCapturer,
   webrtc::DesktopCaptureOptions options_;
   std::unique_ptr<webrtc::DesktopCapturer> capturer_;
   std::unique_ptr<webrtc::Thread> thread_;
+  RTCThreadReport thread_report_;
   webrtc::scoped_refptr<webrtc::I420Buffer> i420_buffer_;
   CaptureState capture_state_ = CS_STOPPED;
   DesktopType type_;
@@ -7,8 +7,9 @@
 
 namespace lumenrtc_bridge {
 
-RTCDesktopDeviceImpl::RTCDesktopDeviceImpl(webrtc::Thread* signaling_thread)
-    : signaling_thread_(signaling_thread) {}
+RTCDesktopDeviceImpl::RTCDesktopDeviceImpl(
+    webrtc::Thread* signaling_thread, const RTCThreadTuning& capture_tuning)
+    : signaling_thread_(signaling_thread), capture_tuning_(capture_tuning) {}
 
 RTCDesktopDeviceImpl::~RTCDesktopDeviceImpl() = default;
 
@@ -21,7 +22,7 @@ scoped_refptr<RTCDesktopCapturer> RTCDesktopDeviceImpl::CreateDesktopCapturer(
   auto* source_impl = static_cast<MediaSourceImpl*>(source.get());
   return new RefCountedObject<RTCDesktopCapturerImpl>(
       source_impl->type(), source_impl->source_id(), signaling_thread_, source,
-      showCursor);
+      showCursor, capture_tuning_);
 }
 
 scoped_refptr<RTCDesktopMediaList> RTCDesktopDeviceImpl::GetDesktopMediaList(
@@ -16,7 +16,8 @@ namespace lumenrtc_bridge {
 
 class RTCDesktopDeviceImpl : public RTCDesktopDevice {
  public:
-  RTCDesktopDeviceImpl(webrtc::Thread* signaling_thread);
+  RTCDesktopDeviceImpl(webrtc::Thread* signaling_thread,
+                       const RTCThreadTuning& capture_tuning = RTCThreadTuning());
   ~RTCDesktopDeviceImpl();
 
   scoped_refptr<RTCDesktopCapturer> CreateDesktopCapturer(
@@ -27,6 +28,7 @@ class RTCDesktopDeviceImpl : public RTCDesktopDevice {
 
  private:
   webrtc::Thread* signaling_thread_ = nullptr;
+  const RTCThreadTuning capture_tuning_;
   std::map<DesktopType, scoped_refptr<RTCDesktopMediaListImpl>>
       desktop_media_lists_;
 };
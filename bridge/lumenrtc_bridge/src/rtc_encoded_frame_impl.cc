@@ -0,0 +1,76 @@
+#include "rtc_encoded_frame_impl.h"
+
+#include <utility>
+
+namespace lumenrtc_bridge {
+
+RTCEncodedFrameImpl::RTCEncodedFrameImpl(
+    std::unique_ptr<webrtc::TransformableFrameInterface> frame,
+    RTCMediaType media_type,
+    webrtc::scoped_refptr<webrtc::TransformedFrameCallback> decoder)
+    : frame_(std::move(frame)),
+      media_type_(media_type),
+      decoder_(std::move(decoder)) {
+  if (media_type_ == RTCMediaType::VIDEO) {
+    auto* video =
+        static_cast<webrtc::TransformableVideoFrameInterface*>(frame_.get());
+    metadata_ = video->Metadata();
+    key_frame_ = video->IsKeyFrame();
+  }
+}
+
+RTCEncodedFrameImpl::~RTCEncodedFrameImpl() {
+  if (decoder_) {
+    decoder_->OnTransformedFrame(std::move(frame_));
+  }
+}
+
+const uint8_t* RTCEncodedFrameImpl::data() const {
+  return frame_->GetData().data();
+}
+
+size_t RTCEncodedFrameImpl::size() const { return frame_->GetData().size(); }
+
+uint32_t RTCEncodedFrameImpl::rtp_timestamp() const {
+  return frame_->GetTimestamp();
+}
+
+uint32_t RTCEncodedFrameImpl::ssrc() const { return frame_->GetSsrc(); }
+
+uint8_t RTCEncodedFrameImpl::payload_type() const {
+  return frame_->GetPayloadType();
+}
+
+const string RTCEncodedFrameImpl::mime_type() const {
+  return frame_->GetMimeType();
+}
+
+int RTCEncodedFrameImpl::width() const {
+  return metadata_ ? metadata_->GetWidth() : 0;
+}
+
+int RTCEncodedFrameImpl::height() const {
+  return metadata_ ? metadata_->GetHeight() : 0;
+}
+
+int64_t RTCEncodedFrameImpl::frame_id() const {
+  return metadata_ ? metadata_->GetFrameId().value_or(-1) : -1;
+}
+
+int RTCEncodedFrameImpl::spatial_index() const {
+  return metadata_ ? metadata_->GetSpatialIndex() : 0;
+}
+
+int RTCEncodedFrameImpl::temporal_index() const {
+  return metadata_ ? metadata_->GetTemporalIndex() : 0;
+}
+
+const vector<int64_t> RTCEncodedFrameImpl::dependencies() const {
+  if (!metadata_) {
+    return vector<int64_t>();
+  }
+  webrtc::ArrayView<const int64_t> ids = metadata_->GetFrameDependencies();
+  return std::vector<int64_t>(ids.begin(), ids.end());
+}
+
+}  // namespace lumenrtc_bridge
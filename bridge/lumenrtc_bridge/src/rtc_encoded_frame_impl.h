@@ -0,0 +1,55 @@
+#ifndef LUMENRTC_BRIDGE_RTC_ENCODED_FRAME_IMPL_HXX
+#define LUMENRTC_BRIDGE_RTC_ENCODED_FRAME_IMPL_HXX
+
+#include <memory>
+#include <optional>
+
+#include "api/frame_transformer_interface.h"
+#include "api/scoped_refptr.h"
+#include "api/video/video_frame_metadata.h"
+#include "rtc_encoded_frame.h"
+
+namespace lumenrtc_bridge {
+
+class RTCEncodedFrameImpl : public RTCEncodedFrame {
+ public:
+  // |decoder| gets |frame| back when the last reference is dropped.
+  RTCEncodedFrameImpl(
+      std::unique_ptr<webrtc::TransformableFrameInterface> frame,
+      RTCMediaType media_type,
+      webrtc::scoped_refptr<webrtc::TransformedFrameCallback> decoder);
+  virtual ~RTCEncodedFrameImpl();
+
+  RTCMediaType media_type() const override { return media_type_; }
+  const uint8_t* data() const override;
+  size_t size() const override;
+  uint32_t rtp_timestamp() const override;
+  uint32_t ssrc() const override;
+  uint8_t payload_type() const override;
+  const string mime_type() const override;
+  bool is_key_frame() const override { return key_frame_; }
+  int width() const override;
+  int height() const override;
+  int64_t frame_id() const override;
+  int spatial_index() const override;
+  int temporal_index() const override;
+  const vector<int64_t> dependencies() const override;
+
+  // Never modified while references exist, so senders may read it from
+  // their own threads.
+  const webrtc::TransformableFrameInterface* frame() const {
+    return frame_.get();
+  }
+
+ private:
+  std::unique_ptr<webrtc::TransformableFrameInterface> frame_;
+  const RTCMediaType media_type_;
+  const webrtc::scoped_refptr<webrtc::TransformedFrameCallback> decoder_;
+  // Read once for video frames; Metadata() builds a copy on every call.
+  std::optional<webrtc::VideoFrameMetadata> metadata_;
+  bool key_frame_ = false;
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // LUMENRTC_BRIDGE_RTC_ENCODED_FRAME_IMPL_HXX
@@ -0,0 +1,443 @@
+#include "rtc_encoded_frame_recorder_impl.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#include "absl/strings/ascii.h"
+#include "api/units/time_delta.h"
+#include "rtc_base/logging.h"
+
+#if defined(WEBRTC_WIN)
+#include <io.h>
+
+#include "rtc_base/string_utils.h"
+#else
+#include <unistd.h>
+#endif
+
+namespace lumenrtc_bridge {
+namespace {
+
+// Opus runs at 48 kHz whatever the negotiated rate, and so do its RTP
+// timestamps and Ogg granule positions.
+constexpr int64_t kOpusSamplesPer20Ms = 960;
+// Longer gaps are filled only up to this, so a stalled stream cannot
+// balloon the file.
+constexpr int64_t kMaxOpusGapSamples = 48000 * 10;
+// A TOC byte alone: one empty 20 ms CELT frame, decoded as a lost packet.
+constexpr uint8_t kOpusLostPacket = 0xF8;
+constexpr int64_t kOggPageSamples = 48000;
+constexpr uint32_t kOggSerial = 0x4C52544D;
+constexpr size_t kOggHeaderSize = 27;
+constexpr size_t kIvfHeaderSize = 32;
+constexpr size_t kIvfFrameCountOffset = 24;
+constexpr uint32_t kIvfTimebase = 90000;
+
+FILE* OpenForWriting(const std::string& path) {
+#if defined(WEBRTC_WIN)
+  return _wfopen(webrtc::ToUtf16(path).c_str(), L"wb");
+#else
+  return fopen(path.c_str(), "wb");
+#endif
+}
+
+int SyncFile(FILE* file) {
+#if defined(WEBRTC_WIN)
+  return _commit(_fileno(file));
+#else
+  return fsync(fileno(file));
+#endif
+}
+
+void PutLe(uint8_t* out, uint64_t value, size_t bytes) {
+  for (size_t i = 0; i < bytes; ++i) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+// CRC-32 of the Ogg framing: polynomial 0x04C11DB7, unreflected, zero seed.
+uint32_t OggCrc(const uint8_t* data, size_t size, uint32_t crc) {
+  static const std::array<uint32_t, 256> table = [] {
+    std::array<uint32_t, 256> entries{};
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t r = i << 24;
+      for (int bit = 0; bit < 8; ++bit) {
+        r = (r & 0x80000000u) ? (r << 1) ^ 0x04C11DB7u : r << 1;
+      }
+      entries[i] = r;
+    }
+    return entries;
+  }();
+  for (size_t i = 0; i < size; ++i) {
+    crc = (crc << 8) ^ table[((crc >> 24) ^ data[i]) & 0xFF];
+  }
+  return crc;
+}
+
+// Duration of an Opus packet from its TOC byte (RFC 6716, section 3.1), or
+// 0 if it is malformed.
+int64_t OpusPacketSamples(const uint8_t* data, size_t size) {
+  if (size < 1) {
+    return 0;
+  }
+  const int config = data[0] >> 3;
+  int64_t frame_samples;
+  if (config < 12) {
+    static constexpr int64_t kSilk[] = {480, 960, 1920, 2880};
+    frame_samples = kSilk[config & 3];
+  } else if (config < 16) {
+    frame_samples = (config & 1) ? 960 : 480;
+  } else {
+    frame_samples = 120 << (config & 3);
+  }
+  int64_t frames;
+  switch (data[0] & 3) {
+    case 0:
+      frames = 1;
+      break;
+    case 1:
+    case 2:
+      frames = 2;
+      break;
+    default:
+      if (size < 2) {
+        return 0;
+      }
+      frames = data[1] & 0x3F;
+      break;
+  }
+  return frame_samples * frames;
+}
+
+const char* IvfFourcc(const std::string& mime_type) {
+  if (mime_type == "video/vp8") {
+    return "VP80";
+  }
+  if (mime_type == "video/vp9") {
+    return "VP90";
+  }
+  return "AV01";
+}
+
+}  // namespace
+
+scoped_refptr<RTCEncodedFrameRecorder> RTCEncodedFrameRecorder::Create(
+    const string path, const RTCEncodedFrameRecorderOptions& options) {
+  FILE* file = OpenForWriting(to_std_string(path));
+  if (!file) {
+    RTC_LOG(LS_WARNING) << "Cannot open recording " << to_std_string(path);
+    return nullptr;
+  }
+  scoped_refptr<RTCEncodedFrameRecorderImpl> recorder =
+      scoped_refptr<RTCEncodedFrameRecorderImpl>(
+          new RefCountedObject<RTCEncodedFrameRecorderImpl>(file, options));
+  return recorder;
+}
+
+RTCEncodedFrameRecorderImpl::RTCEncodedFrameRecorderImpl(
+    FILE* file, const RTCEncodedFrameRecorderOptions& options)
+    : options_(options), thread_(webrtc::Thread::Create()), file_(file) {
+  if (options_.write_buffer_bytes > 0) {
+    setvbuf(file_, nullptr, _IOFBF, options_.write_buffer_bytes);
+  }
+  thread_->SetName("lumenrtc_recorder", nullptr);
+  thread_->Start();
+}
+
+RTCEncodedFrameRecorderImpl::~RTCEncodedFrameRecorderImpl() { Stop(); }
+
+void RTCEncodedFrameRecorderImpl::OnEncodedFrame(
+    scoped_refptr<RTCEncodedFrame> frame) {
+  const std::string mime_type =
+      absl::AsciiStrToLower(frame->mime_type().std_string());
+  const size_t size = frame->size();
+  webrtc::MutexLock lock(&mutex_);
+  if (stopped_) {
+    return;
+  }
+  if (container_ == Container::kNone) {
+    if (mime_type == "video/vp8" || mime_type == "video/vp9" ||
+        mime_type == "video/av1") {
+      container_ = Container::kIvf;
+    } else if (mime_type == "video/h264" || mime_type == "video/h265") {
+      container_ = Container::kAnnexB;
+    } else if (mime_type == "audio/opus") {
+      container_ = Container::kOgg;
+    } else {
+      ++frames_dropped_;
+      return;
+    }
+    mime_type_ = mime_type;
+  } else if (mime_type != mime_type_) {
+    ++frames_dropped_;
+    return;
+  }
+  const bool video = container_ != Container::kOgg;
+  if (video && waiting_for_key_frame_ && !frame->is_key_frame()) {
+    ++frames_dropped_;
+    return;
+  }
+  if (size == 0) {
+    ++frames_dropped_;
+    return;
+  }
+  if (queued_bytes_ + size > options_.max_queued_bytes) {
+    // The writer cannot keep up; a video decoder would choke on the deltas
+    // that follow a dropped frame.
+    ++frames_dropped_;
+    waiting_for_key_frame_ = true;
+    return;
+  }
+  waiting_for_key_frame_ = false;
+
+  const uint32_t rtp_timestamp = frame->rtp_timestamp();
+  if (started_) {
+    timestamp_ += static_cast<int32_t>(rtp_timestamp - last_rtp_timestamp_);
+  }
+  started_ = true;
+  last_rtp_timestamp_ = rtp_timestamp;
+
+  queued_bytes_ += size;
+  Unit unit{webrtc::Buffer(frame->data(), size), timestamp_, frame->width(),
+            frame->height()};
+  // Posted under the lock, so units reach the thread in order and none
+  // after Stop() has drained it.
+  thread_->PostTask([this, unit = std::move(unit)] {
+    Write(unit);
+    webrtc::MutexLock lock(&mutex_);
+    queued_bytes_ -= unit.data.size();
+  });
+}
+
+bool RTCEncodedFrameRecorderImpl::Stop() {
+  {
+    webrtc::MutexLock lock(&mutex_);
+    if (stopped_) {
+      return !write_failed_;
+    }
+    stopped_ = true;
+  }
+  thread_->BlockingCall([this] { Finish(); });
+  thread_->Stop();
+  return !write_failed_;
+}
+
+RTCEncodedFrameRecorderStats RTCEncodedFrameRecorderImpl::GetStats() {
+  RTCEncodedFrameRecorderStats stats;
+  stats.frames_written = frames_written_;
+  stats.bytes_written = bytes_written_;
+  stats.frames_dropped = frames_dropped_;
+  stats.write_failed = write_failed_;
+  webrtc::MutexLock lock(&mutex_);
+  stats.queued_bytes = queued_bytes_;
+  return stats;
+}
+
+void RTCEncodedFrameRecorderImpl::Write(const Unit& unit) {
+  if (write_failed_) {
+    ++frames_dropped_;
+    return;
+  }
+  if (!header_written_) {
+    std::string mime_type;
+    {
+      webrtc::MutexLock lock(&mutex_);
+      format_ = container_;
+      mime_type = mime_type_;
+    }
+    if (format_ == Container::kIvf) {
+      WriteIvfHeader(IvfFourcc(mime_type), unit.width, unit.height);
+    } else if (format_ == Container::kOgg) {
+      WriteOggHeaders();
+    }
+    header_written_ = true;
+  }
+  switch (format_) {
+    case Container::kIvf:
+      WriteIvfFrame(unit);
+      break;
+    case Container::kAnnexB:
+      WriteBytes(unit.data.data(), unit.data.size());
+      break;
+    case Container::kOgg: {
+      const int64_t samples =
+          OpusPacketSamples(unit.data.data(), unit.data.size());
+      if (samples == 0) {
+        ++frames_dropped_;
+        return;
+      }
+      // Lost or DTX-suppressed packets would shorten the recording and
+      // drift it from the video; decoders conceal these markers instead.
+      const int64_t gap =
+          std::min(unit.timestamp - ogg_granule_, kMaxOpusGapSamples);
+      for (int64_t i = 0; i < gap / kOpusSamplesPer20Ms; ++i) {
+        AddOggPacket(&kOpusLostPacket, 1, kOpusSamplesPer20Ms);
+      }
+      AddOggPacket(unit.data.data(), unit.data.size(), samples);
+      break;
+    }
+    case Container::kNone:
+      return;
+  }
+  if (write_failed_) {
+    return;
+  }
+  ++frames_written_;
+  ScheduleSync();
+}
+
+void RTCEncodedFrameRecorderImpl::WriteIvfHeader(const char* fourcc,
+                                                 int width, int height) {
+  uint8_t header[kIvfHeaderSize] = {};
+  memcpy(header, "DKIF", 4);
+  PutLe(header + 4, 0, 2);
+  PutLe(header + 6, kIvfHeaderSize, 2);
+  memcpy(header + 8, fourcc, 4);
+  PutLe(header + 12, static_cast<uint16_t>(width), 2);
+  PutLe(header + 14, static_cast<uint16_t>(height), 2);
+  PutLe(header + 16, kIvfTimebase, 4);
+  PutLe(header + 20, 1, 4);
+  // The frame count at kIvfFrameCountOffset is filled in by Finish().
+  WriteBytes(header, sizeof(header));
+}
+
+void RTCEncodedFrameRecorderImpl::WriteIvfFrame(const Unit& unit) {
+  uint8_t header[12];
+  PutLe(header, unit.data.size(), 4);
+  PutLe(header + 4, static_cast<uint64_t>(unit.timestamp), 8);
+  if (WriteBytes(header, sizeof(header)) &&
+      WriteBytes(unit.data.data(), unit.data.size())) {
+    ++ivf_frame_count_;
+  }
+}
+
+void RTCEncodedFrameRecorderImpl::WriteOggHeaders() {
+  // RFC 7845: identification and comment headers, each on its own page.
+  // RTP does not carry the encoder's pre-skip, so none is declared.
+  uint8_t head[19] = {};
+  memcpy(head, "OpusHead", 8);
+  head[8] = 1;
+  head[9] = 2;
+  PutLe(head + 12, 48000, 4);
+  AddOggPacket(head, sizeof(head), 0);
+  WriteOggPage(false);
+
+  static constexpr char kVendor[] = "LumenRTC";
+  uint8_t tags[8 + 4 + sizeof(kVendor) - 1 + 4] = {};
+  memcpy(tags, "OpusTags", 8);
+  PutLe(tags + 8, sizeof(kVendor) - 1, 4);
+  memcpy(tags + 12, kVendor, sizeof(kVendor) - 1);
+  AddOggPacket(tags, sizeof(tags), 0);
+  WriteOggPage(false);
+}
+
+void RTCEncodedFrameRecorderImpl::AddOggPacket(const uint8_t* data,
+                                               size_t size, int64_t samples) {
+  // Packets are not continued across pages; an Opus packet needs at most
+  // 241 lacing values.
+  const size_t lacing = size / 255 + 1;
+  if (ogg_segments_.size() + lacing > 255) {
+    WriteOggPage(false);
+  }
+  ogg_segments_.insert(ogg_segments_.end(), lacing - 1, 255);
+  ogg_segments_.push_back(static_cast<uint8_t>(size % 255));
+  ogg_body_.insert(ogg_body_.end(), data, data + size);
+  ogg_granule_ += samples;
+  if (ogg_granule_ - ogg_page_start_granule_ >= kOggPageSamples) {
+    WriteOggPage(false);
+  }
+}
+
+void RTCEncodedFrameRecorderImpl::WriteOggPage(bool last) {
+  uint8_t header[kOggHeaderSize + 255];
+  memcpy(header, "OggS", 4);
+  header[4] = 0;
+  header[5] = (ogg_page_sequence_ == 0 ? 0x02 : 0) | (last ? 0x04 : 0);
+  PutLe(header + 6, static_cast<uint64_t>(ogg_granule_), 8);
+  PutLe(header + 14, kOggSerial, 4);
+  PutLe(header + 18, ogg_page_sequence_++, 4);
+  PutLe(header + 22, 0, 4);
+  header[26] = static_cast<uint8_t>(ogg_segments_.size());
+  memcpy(header + kOggHeaderSize, ogg_segments_.data(), ogg_segments_.size());
+  const size_t header_size = kOggHeaderSize + ogg_segments_.size();
+  uint32_t crc = OggCrc(header, header_size, 0);
+  crc = OggCrc(ogg_body_.data(), ogg_body_.size(), crc);
+  PutLe(header + 22, crc, 4);
+  WriteBytes(header, header_size);
+  WriteBytes(ogg_body_.data(), ogg_body_.size());
+  ogg_segments_.clear();
+  ogg_body_.clear();
+  ogg_page_start_granule_ = ogg_granule_;
+}
+
+void RTCEncodedFrameRecorderImpl::Finish() {
+  if (header_written_ && !write_failed_) {
+    if (format_ == Container::kOgg) {
+      WriteOggPage(true);
+    } else if (format_ == Container::kIvf) {
+      uint8_t count[4];
+      PutLe(count, ivf_frame_count_, 4);
+      if (fseek(file_, kIvfFrameCountOffset, SEEK_SET) != 0 ||
+          fwrite(count, 1, sizeof(count), file_) != sizeof(count) ||
+          fseek(file_, 0, SEEK_END) != 0) {
+        write_failed_ = true;
+      }
+    }
+  }
+  bool ok = fflush(file_) == 0;
+  if (ok && options_.sync_policy != RTCRecordingSyncPolicy::kNone) {
+    ok = SyncFile(file_) == 0;
+  }
+  if (fclose(file_) != 0) {
+    ok = false;
+  }
+  file_ = nullptr;
+  if (!ok) {
+    RTC_LOG(LS_ERROR) << "Completing the recording failed";
+    write_failed_ = true;
+  }
+}
+
+bool RTCEncodedFrameRecorderImpl::WriteBytes(const void* data, size_t size) {
+  if (write_failed_) {
+    return false;
+  }
+  if (size > 0 && fwrite(data, 1, size, file_) != size) {
+    RTC_LOG(LS_ERROR) << "Recording write failed";
+    write_failed_ = true;
+    return false;
+  }
+  bytes_written_ += size;
+  return true;
+}
+
+void RTCEncodedFrameRecorderImpl::Sync() {
+  sync_scheduled_ = false;
+  if (!file_ || write_failed_) {
+    return;
+  }
+  // A page in progress would otherwise miss the sync.
+  if (format_ == Container::kOgg && !ogg_segments_.empty()) {
+    WriteOggPage(false);
+  }
+  if (fflush(file_) != 0 || SyncFile(file_) != 0) {
+    RTC_LOG(LS_ERROR) << "Recording sync failed";
+    write_failed_ = true;
+  }
+}
+
+void RTCEncodedFrameRecorderImpl::ScheduleSync() {
+  if (options_.sync_policy != RTCRecordingSyncPolicy::kInterval ||
+      sync_scheduled_) {
+    return;
+  }
+  sync_scheduled_ = true;
+  thread_->PostDelayedTask([this] { Sync(); },
+                           webrtc::TimeDelta::Millis(
+                               std::max(options_.sync_interval_ms, 1)));
+}
+
+}  // namespace lumenrtc_bridge
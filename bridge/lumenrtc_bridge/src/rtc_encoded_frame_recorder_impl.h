@@ -0,0 +1,93 @@
+#ifndef LUMENRTC_BRIDGE_RTC_ENCODED_FRAME_RECORDER_IMPL_HXX
+#define LUMENRTC_BRIDGE_RTC_ENCODED_FRAME_RECORDER_IMPL_HXX
+
+#include <stdio.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rtc_base/buffer.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread.h"
+#include "rtc_base/thread_annotations.h"
+#include "rtc_encoded_frame_recorder.h"
+
+namespace lumenrtc_bridge {
+
+class RTCEncodedFrameRecorderImpl : public RTCEncodedFrameRecorder {
+ public:
+  // Takes ownership of |file|, which has not been written to.
+  RTCEncodedFrameRecorderImpl(FILE* file,
+                              const RTCEncodedFrameRecorderOptions& options);
+  virtual ~RTCEncodedFrameRecorderImpl();
+
+  void OnEncodedFrame(scoped_refptr<RTCEncodedFrame> frame) override;
+
+  bool Stop() override;
+
+  RTCEncodedFrameRecorderStats GetStats() override;
+
+ private:
+  enum class Container { kNone, kIvf, kAnnexB, kOgg };
+
+  // A frame copied off the receiver, on its way to the writer thread.
+  struct Unit {
+    webrtc::Buffer data;
+    // RTP timestamp, unwrapped and relative to the first recorded frame.
+    int64_t timestamp;
+    int width;
+    int height;
+  };
+
+  // The rest run on |thread_|.
+  void Write(const Unit& unit);
+  void WriteIvfHeader(const char* fourcc, int width, int height);
+  void WriteIvfFrame(const Unit& unit);
+  void WriteOggHeaders();
+  void AddOggPacket(const uint8_t* data, size_t size, int64_t samples);
+  void WriteOggPage(bool last);
+  void Finish();
+  // Writes to the file, or notes the failure; false once anything failed.
+  bool WriteBytes(const void* data, size_t size);
+  void Sync();
+  void ScheduleSync();
+
+  const RTCEncodedFrameRecorderOptions options_;
+  const std::unique_ptr<webrtc::Thread> thread_;
+
+  webrtc::Mutex mutex_;
+  bool stopped_ RTC_GUARDED_BY(mutex_) = false;
+  // Chosen from the first frame's MIME type.
+  std::string mime_type_ RTC_GUARDED_BY(mutex_);
+  Container container_ RTC_GUARDED_BY(mutex_) = Container::kNone;
+  bool waiting_for_key_frame_ RTC_GUARDED_BY(mutex_) = true;
+  bool started_ RTC_GUARDED_BY(mutex_) = false;
+  uint32_t last_rtp_timestamp_ RTC_GUARDED_BY(mutex_) = 0;
+  int64_t timestamp_ RTC_GUARDED_BY(mutex_) = 0;
+  size_t queued_bytes_ RTC_GUARDED_BY(mutex_) = 0;
+
+  std::atomic<uint64_t> frames_written_{0};
+  std::atomic<uint64_t> bytes_written_{0};
+  std::atomic<uint64_t> frames_dropped_{0};
+  std::atomic<bool> write_failed_{false};
+
+  // Owned by |thread_| once constructed.
+  FILE* file_;
+  Container format_ = Container::kNone;
+  bool header_written_ = false;
+  bool sync_scheduled_ = false;
+  uint32_t ivf_frame_count_ = 0;
+  // Ogg page being filled: lacing values and packet bytes.
+  std::vector<uint8_t> ogg_segments_;
+  std::vector<uint8_t> ogg_body_;
+  uint32_t ogg_page_sequence_ = 0;
+  // Samples up to the end of the last packet added, at 48 kHz.
+  int64_t ogg_granule_ = 0;
+  int64_t ogg_page_start_granule_ = 0;
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // LUMENRTC_BRIDGE_RTC_ENCODED_FRAME_RECORDER_IMPL_HXX
@@ -1,138 +1,158 @@
 #include "rtc_frame_cryptor_impl.h"
 
-#include <mutex>
 #include <utility>
 
+#include "api/make_ref_counted.h"
 #include "base/refcountedobject.h"
+#include "rtc_rtp_receiver_impl.h"
+#include "rtc_rtp_sender_impl.h"
 
 namespace lumenrtc_bridge {
 
+namespace {
+
+webrtc::scoped_refptr<FrameKeyStore> StoreOf(
+    const scoped_refptr<KeyProvider>& key_provider) {
+  return static_cast<DefaultKeyProviderImpl*>(key_provider.get())->store();
+}
+
+}  // namespace
+
 scoped_refptr<RTCFrameCryptor> FrameCryptorFactory::frameCryptorFromRtpSender(
     scoped_refptr<RTCPeerConnectionFactory> factory,
     const string participant_id, scoped_refptr<RTCRtpSender> sender,
     Algorithm algorithm, scoped_refptr<KeyProvider> key_provider) {
-  return new RefCountedObject<RTCFrameCryptorImpl>(
-      factory, participant_id, algorithm, key_provider, sender);
+  (void)factory;
+  if (algorithm != Algorithm::kAesGcm || !sender || !key_provider) {
+    return nullptr;
+  }
+  return new RefCountedObject<RTCFrameCryptorImpl>(participant_id,
+                                                   key_provider, sender);
 }
 
 scoped_refptr<RTCFrameCryptor> FrameCryptorFactory::frameCryptorFromRtpReceiver(
     scoped_refptr<RTCPeerConnectionFactory> factory,
     const string participant_id, scoped_refptr<RTCRtpReceiver> receiver,
     Algorithm algorithm, scoped_refptr<KeyProvider> key_provider) {
-  return new RefCountedObject<RTCFrameCryptorImpl>(
-      factory, participant_id, algorithm, key_provider, receiver);
+  (void)factory;
+  if (algorithm != Algorithm::kAesGcm || !receiver || !key_provider) {
+    return nullptr;
+  }
+  return new RefCountedObject<RTCFrameCryptorImpl>(participant_id,
+                                                   key_provider, receiver);
 }
 
 DefaultKeyProviderImpl::DefaultKeyProviderImpl(KeyProviderOptions* options)
-    : shared_key_(options != nullptr && options->shared_key) {}
+    : store_(webrtc::make_ref_counted<FrameKeyStore>(
+          options ? *options : KeyProviderOptions())) {}
 
 bool DefaultKeyProviderImpl::SetSharedKey(int index, vector<uint8_t> key) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  shared_keys_[index] = std::move(key);
-  return true;
+  return store_->SetSharedKey(index, key.std_vector());
 }
 
 vector<uint8_t> DefaultKeyProviderImpl::RatchetSharedKey(int key_index) {
-  return ExportSharedKey(key_index);
+  return store_->RatchetSharedKey(key_index);
 }
 
 vector<uint8_t> DefaultKeyProviderImpl::ExportSharedKey(int key_index) {
-  auto it = shared_keys_.find(key_index);
-  if (it == shared_keys_.end()) {
-    return {};
-  }
-
-  return it->second;
+  return store_->ExportSharedKey(key_index);
 }
 
 bool DefaultKeyProviderImpl::SetKey(const string participant_id, int index,
                                     vector<uint8_t> key) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  participant_keys_[participant_id.std_string()][index] = std::move(key);
-  return true;
+  return store_->SetKey(participant_id.std_string(), index,
+                        key.std_vector());
 }
 
 vector<uint8_t> DefaultKeyProviderImpl::RatchetKey(const string participant_id,
                                                    int key_index) {
-  return ExportKey(participant_id, key_index);
+  return store_->RatchetKey(participant_id.std_string(), key_index);
 }
 
 vector<uint8_t> DefaultKeyProviderImpl::ExportKey(const string participant_id,
                                                   int key_index) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  auto participant_it = participant_keys_.find(participant_id.std_string());
-  if (participant_it == participant_keys_.end()) {
-    return shared_key_ ? ExportSharedKey(key_index) : vector<uint8_t>();
-  }
+  return store_->ExportKey(participant_id.std_string(), key_index);
+}
 
-  auto& keys = participant_it->second;
-  auto key_it = keys.find(key_index);
-  if (key_it == keys.end()) {
-    return shared_key_ ? ExportSharedKey(key_index) : vector<uint8_t>();
-  }
+void DefaultKeyProviderImpl::SetSifTrailer(vector<uint8_t> trailer) {
+  store_->SetSifTrailer(trailer.std_vector());
+}
 
-  return key_it->second;
+int DefaultKeyProviderImpl::EncryptPayload(const string participant_id,
+                                           int key_index, uint8_t* data,
+                                           size_t size, size_t capacity) {
+  return store_->EncryptPayload(participant_id.std_string(), key_index, data,
+                                size, capacity);
 }
 
-void DefaultKeyProviderImpl::SetSifTrailer(vector<uint8_t> trailer) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  sif_trailer_ = std::move(trailer);
+int DefaultKeyProviderImpl::DecryptPayload(const string participant_id,
+                                           uint8_t* data, size_t size) {
+  return store_->DecryptPayload(participant_id.std_string(), data, size);
 }
 
 RTCFrameCryptorImpl::RTCFrameCryptorImpl(
-    scoped_refptr<RTCPeerConnectionFactory> factory,
-    const string participant_id, Algorithm algorithm,
-    scoped_refptr<KeyProvider> key_provider, scoped_refptr<RTCRtpSender> sender)
-    : participant_id_(participant_id), enabled_(false), key_index_(0) {
-  (void)factory;
-  (void)algorithm;
-  (void)key_provider;
-  (void)sender;
+    const string participant_id, scoped_refptr<KeyProvider> key_provider,
+    scoped_refptr<RTCRtpSender> sender)
+    : participant_id_(participant_id),
+      crypto_(webrtc::make_ref_counted<FrameCrypto>(
+          participant_id.std_string(), StoreOf(key_provider))) {
+  webrtc::scoped_refptr<webrtc::RtpSenderInterface> native =
+      static_cast<RTCRtpSenderImpl*>(sender.get())->rtc_rtp_sender();
+  bool install = false;
+  injector_ = FindEncodedFrameInjector(native.get(), true, &install);
+  injector_->SetFrameCrypto(crypto_);
+  if (install) {
+    native->SetEncoderToPacketizerFrameTransformer(injector_);
+  }
 }
 
 RTCFrameCryptorImpl::RTCFrameCryptorImpl(
-    scoped_refptr<RTCPeerConnectionFactory> factory,
-    const string participant_id, Algorithm algorithm,
-    scoped_refptr<KeyProvider> key_provider,
+    const string participant_id, scoped_refptr<KeyProvider> key_provider,
     scoped_refptr<RTCRtpReceiver> receiver)
-    : participant_id_(participant_id), enabled_(false), key_index_(0) {
-  (void)factory;
-  (void)algorithm;
-  (void)key_provider;
-  (void)receiver;
+    : participant_id_(participant_id),
+      crypto_(webrtc::make_ref_counted<FrameCrypto>(
+          participant_id.std_string(), StoreOf(key_provider))) {
+  webrtc::scoped_refptr<webrtc::RtpReceiverInterface> native =
+      static_cast<RTCRtpReceiverImpl*>(receiver.get())->rtp_receiver();
+  bool install = false;
+  tap_ = FindEncodedFrameTap(native.get(), true, &install);
+  tap_->SetFrameCrypto(crypto_);
+  if (install) {
+    native->SetDepacketizerToDecoderFrameTransformer(tap_);
+  }
+}
+
+RTCFrameCryptorImpl::~RTCFrameCryptorImpl() {
+  // A later cryptor of the same sender or receiver may have taken over.
+  if (injector_) {
+    injector_->ClearFrameCrypto(crypto_.get());
+  }
+  if (tap_) {
+    tap_->ClearFrameCrypto(crypto_.get());
+  }
+  crypto_->SetObserver(nullptr);
 }
 
 bool RTCFrameCryptorImpl::SetEnabled(bool enabled) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  enabled_ = enabled;
+  crypto_->SetEnabled(enabled);
   return true;
 }
 
-bool RTCFrameCryptorImpl::enabled() const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  return enabled_;
-}
+bool RTCFrameCryptorImpl::enabled() const { return crypto_->enabled(); }
 
 bool RTCFrameCryptorImpl::SetKeyIndex(int index) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  key_index_ = index;
-  return true;
+  return crypto_->SetKeyIndex(index);
 }
 
-int RTCFrameCryptorImpl::key_index() const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  return key_index_;
-}
+int RTCFrameCryptorImpl::key_index() const { return crypto_->key_index(); }
 
 void RTCFrameCryptorImpl::RegisterRTCFrameCryptorObserver(
     scoped_refptr<RTCFrameCryptorObserver> observer) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  observer_ = observer;
+  crypto_->SetObserver(observer);
 }
 
 void RTCFrameCryptorImpl::DeRegisterRTCFrameCryptorObserver() {
-  std::lock_guard<std::mutex> lock(mutex_);
-  observer_ = nullptr;
+  crypto_->SetObserver(nullptr);
 }
 
 scoped_refptr<KeyProvider> KeyProvider::Create(KeyProviderOptions* options) {
@@ -1,10 +1,9 @@
 #ifndef LIB_RTC_FRAME_CYRPTOR_IMPL_H_
 #define LIB_RTC_FRAME_CYRPTOR_IMPL_H_
 
-#include <mutex>
-#include <string>
-
 #include "rtc_frame_cryptor.h"
+#include "src/internal/encoded_frame_forwarding.h"
+#include "src/internal/frame_crypto.h"
 
 namespace lumenrtc_bridge {
 
@@ -20,28 +19,31 @@ class DefaultKeyProviderImpl : public KeyProvider {
   vector<uint8_t> RatchetKey(const string participant_id, int key_index) override;
   vector<uint8_t> ExportKey(const string participant_id, int key_index) override;
   void SetSifTrailer(vector<uint8_t> trailer) override;
+  int EncryptPayload(const string participant_id, int key_index,
+                     uint8_t* data, size_t size, size_t capacity) override;
+  int DecryptPayload(const string participant_id, uint8_t* data,
+                     size_t size) override;
+
+  webrtc::scoped_refptr<FrameKeyStore> store() const { return store_; }
 
  private:
-  mutable std::mutex mutex_;
-  bool shared_key_;
-  map<int, vector<uint8_t>> shared_keys_;
-  map<std::string, map<int, vector<uint8_t>>> participant_keys_;
-  vector<uint8_t> sif_trailer_;
+  const webrtc::scoped_refptr<FrameKeyStore> store_;
 };
 
+// Encrypts through the sender's EncodedFrameInjector or decrypts through
+// the receiver's EncodedFrameTap, since WebRTC takes one transformer per
+// sender or receiver.
 class RTCFrameCryptorImpl : public RTCFrameCryptor {
  public:
-  RTCFrameCryptorImpl(scoped_refptr<RTCPeerConnectionFactory> factory,
-                      const string participant_id, Algorithm algorithm,
+  RTCFrameCryptorImpl(const string participant_id,
                       scoped_refptr<KeyProvider> key_provider,
                       scoped_refptr<RTCRtpSender> sender);
 
-  RTCFrameCryptorImpl(scoped_refptr<RTCPeerConnectionFactory> factory,
-                      const string participant_id, Algorithm algorithm,
+  RTCFrameCryptorImpl(const string participant_id,
                       scoped_refptr<KeyProvider> key_provider,
                       scoped_refptr<RTCRtpReceiver> receiver);
 
-  ~RTCFrameCryptorImpl() override = default;
+  ~RTCFrameCryptorImpl() override;
 
   void RegisterRTCFrameCryptorObserver(
       scoped_refptr<RTCFrameCryptorObserver> observer) override;
@@ -55,11 +57,10 @@ class RTCFrameCryptorImpl : public RTCFrameCryptor {
   const string participant_id() const override { return participant_id_; }
 
  private:
-  string participant_id_;
-  mutable std::mutex mutex_;
-  bool enabled_;
-  int key_index_;
-  scoped_refptr<RTCFrameCryptorObserver> observer_;
+  const string participant_id_;
+  const webrtc::scoped_refptr<FrameCrypto> crypto_;
+  webrtc::scoped_refptr<EncodedFrameInjector> injector_;
+  webrtc::scoped_refptr<EncodedFrameTap> tap_;
 };
 
 }  // namespace lumenrtc_bridge
@@ -0,0 +1,183 @@
+#include "rtc_latency_tracer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "rtc_base/platform_thread_types.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/time_utils.h"
+
+namespace lumenrtc_bridge {
+
+namespace {
+
+constexpr size_t kMaxCapacity = 1 << 20;
+
+// Events of one recording thread. That thread is the only producer and
+// Drain() the only consumer, so neither side takes a lock. A full ring
+// drops the new event, since the producer cannot move the consumer's head.
+class ThreadRing {
+ public:
+  explicit ThreadRing(size_t capacity) : events_(capacity) {}
+
+  bool Push(const RTCTraceEvent& event) {
+    const uint64_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) == events_.size()) {
+      return false;
+    }
+    events_[tail % events_.size()] = event;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // The oldest event, or null if the ring is empty.
+  const RTCTraceEvent* Front() const {
+    const uint64_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
+    return &events_[head % events_.size()];
+  }
+
+  void PopFront() {
+    head_.store(head_.load(std::memory_order_relaxed) + 1,
+                std::memory_order_release);
+  }
+
+ private:
+  std::vector<RTCTraceEvent> events_;
+  std::atomic<uint64_t> head_{0};
+  std::atomic<uint64_t> tail_{0};
+};
+
+// The rings of the current session. Locked when a thread records its first
+// event of a session and while draining, never per event.
+class TraceRegistry {
+ public:
+  // Drops every ring; threads still holding one start a new ring with the
+  // next event.
+  void Reset(size_t capacity) {
+    webrtc::MutexLock lock(&mutex_);
+    rings_.clear();
+    capacity_ = capacity;
+    session_.fetch_add(1, std::memory_order_release);
+  }
+
+  uint64_t session() const {
+    return session_.load(std::memory_order_acquire);
+  }
+
+  std::shared_ptr<ThreadRing> Register(uint64_t* session) {
+    webrtc::MutexLock lock(&mutex_);
+    *session = session_.load(std::memory_order_relaxed);
+    auto ring = std::make_shared<ThreadRing>(capacity_);
+    rings_.push_back(ring);
+    return ring;
+  }
+
+  // Merges the rings oldest first.
+  size_t Drain(RTCTraceEvent* out, size_t capacity) {
+    webrtc::MutexLock lock(&mutex_);
+    size_t count = 0;
+    while (count < capacity) {
+      ThreadRing* oldest = nullptr;
+      const RTCTraceEvent* oldest_event = nullptr;
+      for (const std::shared_ptr<ThreadRing>& ring : rings_) {
+        const RTCTraceEvent* event = ring->Front();
+        if (event &&
+            (!oldest_event || event->start_us < oldest_event->start_us)) {
+          oldest = ring.get();
+          oldest_event = event;
+        }
+      }
+      if (!oldest) {
+        break;
+      }
+      out[count++] = *oldest_event;
+      oldest->PopFront();
+    }
+    return count;
+  }
+
+ private:
+  webrtc::Mutex mutex_;
+  std::vector<std::shared_ptr<ThreadRing>> rings_ RTC_GUARDED_BY(mutex_);
+  size_t capacity_ RTC_GUARDED_BY(mutex_) = 0;
+  std::atomic<uint64_t> session_{0};
+};
+
+std::atomic<bool> g_enabled{false};
+std::atomic<uint64_t> g_dropped{0};
+
+TraceRegistry& Registry() {
+  static TraceRegistry* registry = new TraceRegistry();
+  return *registry;
+}
+
+// The calling thread's ring for the current session.
+ThreadRing& CurrentRing() {
+  thread_local std::shared_ptr<ThreadRing> ring;
+  thread_local uint64_t session = 0;
+  if (!ring || session != Registry().session()) {
+    ring = Registry().Register(&session);
+  }
+  return *ring;
+}
+
+}  // namespace
+
+bool RTCLatencyTracer::Start(size_t capacity) {
+  if (capacity == 0 || capacity > kMaxCapacity) {
+    return false;
+  }
+  g_enabled.store(false, std::memory_order_relaxed);
+  Registry().Reset(capacity);
+  g_dropped.store(0, std::memory_order_relaxed);
+  g_enabled.store(true, std::memory_order_release);
+  return true;
+}
+
+void RTCLatencyTracer::Stop() {
+  // Buffered events stay available to Drain().
+  g_enabled.store(false, std::memory_order_relaxed);
+}
+
+bool RTCLatencyTracer::IsEnabled() {
+  return g_enabled.load(std::memory_order_relaxed);
+}
+
+size_t RTCLatencyTracer::Drain(RTCTraceEvent* events, size_t capacity) {
+  if (!events || capacity == 0) {
+    return 0;
+  }
+  return Registry().Drain(events, capacity);
+}
+
+uint64_t RTCLatencyTracer::DroppedCount() {
+  return g_dropped.load(std::memory_order_relaxed);
+}
+
+void RTCLatencyTracer::Record(RTCTraceStage stage, const void* source,
+                              int64_t start_us, int64_t frame_timestamp_us) {
+  if (!IsEnabled()) {
+    return;
+  }
+  RTCTraceEvent event;
+  event.start_us = start_us;
+  event.duration_us = webrtc::TimeMicros() - start_us;
+  event.frame_timestamp_us = frame_timestamp_us;
+  event.source_id = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(source));
+  event.thread_id = static_cast<uint32_t>(webrtc::CurrentThreadId());
+  event.stage = stage;
+  if (!CurrentRing().Push(event)) {
+    g_dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+int64_t RTCLatencyTracer::NowUs() {
+  return webrtc::TimeMicros();
+}
+
+}  // namespace lumenrtc_bridge
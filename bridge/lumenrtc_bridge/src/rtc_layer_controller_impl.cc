@@ -0,0 +1,356 @@
+#include "rtc_layer_controller_impl.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "api/make_ref_counted.h"
+#include "api/stats/rtc_stats_collector_callback.h"
+#include "api/stats/rtcstats_objects.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/time_utils.h"
+
+namespace lumenrtc_bridge {
+namespace {
+
+// The encoder only reports CPU limitation through stats; poll them slower
+// than the decisions run.
+constexpr int64_t kCpuPollIntervalMs = 1000;
+constexpr int64_t kLossWindowMs = 2000;
+constexpr int64_t kRttWindowMs = 10000;
+// Assumed for a full resolution layer without max_bitrate_bps.
+constexpr double kFullLayerBitrateBps = 2500000;
+constexpr int kMaxUpBackoff = 8;
+
+// Spatial layer count of an "L3T3"-style or "S2T1"-style mode, or 0.
+int SpatialLayers(const std::optional<std::string>& mode) {
+  if (!mode || mode->size() < 2 || ((*mode)[0] != 'L' && (*mode)[0] != 'S') ||
+      (*mode)[1] < '1' || (*mode)[1] > '9') {
+    return 0;
+  }
+  return (*mode)[1] - '0';
+}
+
+// Delivered on the signaling thread; |safety| is cleared there by Stop().
+class CpuStatsCallback : public webrtc::RTCStatsCollectorCallback {
+ public:
+  CpuStatsCallback(webrtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> safety,
+                   RTCLayerControllerImpl* controller)
+      : safety_(std::move(safety)), controller_(controller) {}
+
+  void OnStatsDelivered(
+      const webrtc::scoped_refptr<const webrtc::RTCStatsReport>& report)
+      override {
+    if (!safety_->alive()) {
+      return;
+    }
+    bool limited = false;
+    for (const webrtc::RTCOutboundRtpStreamStats* stats :
+         report->GetStatsOfType<webrtc::RTCOutboundRtpStreamStats>()) {
+      if (stats->quality_limitation_reason.has_value() &&
+          *stats->quality_limitation_reason == "cpu") {
+        limited = true;
+      }
+    }
+    controller_->SetCpuLimited(limited);
+  }
+
+ private:
+  const webrtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> safety_;
+  RTCLayerControllerImpl* const controller_;
+};
+
+}  // namespace
+
+scoped_refptr<RTCLayerController> RTCLayerControllerImpl::Create(
+    webrtc::Thread* signaling_thread,
+    webrtc::scoped_refptr<webrtc::PeerConnectionInterface> peer_connection,
+    webrtc::scoped_refptr<webrtc::RtpSenderInterface> sender,
+    webrtc::scoped_refptr<BandwidthMonitor> monitor,
+    const RTCLayerControllerOptions& options) {
+  scoped_refptr<RTCLayerControllerImpl> controller =
+      scoped_refptr<RTCLayerControllerImpl>(
+          new RefCountedObject<RTCLayerControllerImpl>(
+              signaling_thread, peer_connection, sender, monitor, options));
+  const bool started = signaling_thread->BlockingCall([&controller] {
+    RTCLayerControllerImpl* self = controller.get();
+    std::vector<webrtc::scoped_refptr<webrtc::RtpSenderInterface>> senders =
+        self->peer_connection_->GetSenders();
+    if (std::find(senders.begin(), senders.end(), self->sender_) ==
+            senders.end() ||
+        !self->Configure(self->sender_->GetParameters())) {
+      return false;
+    }
+    self->task_ = webrtc::RepeatingTaskHandle::Start(
+        self->signaling_thread_, [self] { return self->Tick(); });
+    return true;
+  });
+  if (!started) {
+    return nullptr;
+  }
+  return controller;
+}
+
+RTCLayerControllerImpl::RTCLayerControllerImpl(
+    webrtc::Thread* signaling_thread,
+    webrtc::scoped_refptr<webrtc::PeerConnectionInterface> peer_connection,
+    webrtc::scoped_refptr<webrtc::RtpSenderInterface> sender,
+    webrtc::scoped_refptr<BandwidthMonitor> monitor,
+    const RTCLayerControllerOptions& options)
+    : signaling_thread_(signaling_thread),
+      peer_connection_(std::move(peer_connection)),
+      sender_(std::move(sender)),
+      monitor_(std::move(monitor)),
+      options_(options),
+      safety_(webrtc::PendingTaskSafetyFlag::CreateDetached()) {}
+
+RTCLayerControllerImpl::~RTCLayerControllerImpl() { Stop(); }
+
+int RTCLayerControllerImpl::level() {
+  return level_.load(std::memory_order_relaxed);
+}
+
+int RTCLayerControllerImpl::max_level() { return max_level_; }
+
+// The observer is only read on the signaling thread, so setting it there
+// keeps it from changing under a running decision.
+void RTCLayerControllerImpl::RegisterObserver(
+    RTCLayerControllerObserver* observer) {
+  signaling_thread_->BlockingCall([this, observer] { observer_ = observer; });
+}
+
+void RTCLayerControllerImpl::UnregisterObserver() {
+  signaling_thread_->BlockingCall([this] { observer_ = nullptr; });
+}
+
+void RTCLayerControllerImpl::Stop() {
+  signaling_thread_->BlockingCall([this] {
+    stopped_ = true;
+    observer_ = nullptr;
+    safety_->SetNotAlive();
+    task_.Stop();
+  });
+}
+
+void RTCLayerControllerImpl::SetCpuLimited(bool limited) {
+  RTC_DCHECK_RUN_ON(signaling_thread_);
+  cpu_limited_ = limited;
+}
+
+bool RTCLayerControllerImpl::Configure(
+    const webrtc::RtpParameters& parameters) {
+  const std::vector<webrtc::RtpEncodingParameters>& encodings =
+      parameters.encodings;
+  if (encodings.size() == 1) {
+    max_level_ = SpatialLayers(encodings[0].scalability_mode);
+    layer_bitrates_bps_ = {static_cast<double>(
+        encodings[0].max_bitrate_bps.value_or(kFullLayerBitrateBps))};
+  } else {
+    // Unscaled simulcast layers default to halving the resolution per layer
+    // below the last.
+    std::vector<double> scales;
+    for (size_t i = 0; i < encodings.size(); ++i) {
+      scales.push_back(encodings[i].scale_resolution_down_by.value_or(
+          std::pow(2.0, static_cast<double>(encodings.size() - 1 - i))));
+    }
+    order_.resize(encodings.size());
+    std::iota(order_.begin(), order_.end(), 0);
+    std::stable_sort(
+        order_.begin(), order_.end(),
+        [&scales](size_t a, size_t b) { return scales[a] > scales[b]; });
+    for (size_t index : order_) {
+      layer_bitrates_bps_.push_back(
+          encodings[index].max_bitrate_bps
+              ? static_cast<double>(*encodings[index].max_bitrate_bps)
+              : kFullLayerBitrateBps / (scales[index] * scales[index]));
+    }
+    max_level_ = static_cast<int>(encodings.size());
+  }
+  level_.store(CurrentLevel(parameters), std::memory_order_relaxed);
+  return max_level_ > 1;
+}
+
+int RTCLayerControllerImpl::CurrentLevel(
+    const webrtc::RtpParameters& parameters) const {
+  if (order_.empty()) {
+    if (parameters.encodings.size() != 1) {
+      return 0;
+    }
+    return std::min(SpatialLayers(parameters.encodings[0].scalability_mode),
+                    max_level_);
+  }
+  if (parameters.encodings.size() != order_.size()) {
+    return 0;
+  }
+  int level = 0;
+  while (level < max_level_ && parameters.encodings[order_[level]].active) {
+    ++level;
+  }
+  return level;
+}
+
+double RTCLayerControllerImpl::Cost(int level) const {
+  if (order_.empty()) {
+    // Spatial layers double the resolution each, so weigh them by pixels.
+    double used = 0;
+    double total = 0;
+    for (int i = 0; i < max_level_; ++i) {
+      const double pixels = std::pow(4.0, i);
+      total += pixels;
+      if (i < level) {
+        used += pixels;
+      }
+    }
+    return layer_bitrates_bps_[0] * used / total;
+  }
+  return std::accumulate(layer_bitrates_bps_.begin(),
+                         layer_bitrates_bps_.begin() + level, 0.0);
+}
+
+webrtc::TimeDelta RTCLayerControllerImpl::Tick() {
+  RTC_DCHECK_RUN_ON(signaling_thread_);
+  const webrtc::TimeDelta interval =
+      webrtc::TimeDelta::Millis(std::max(options_.interval_ms, 10));
+  if (stopped_) {
+    return interval;
+  }
+  const int64_t now = webrtc::TimeMillis();
+  if (!options_.ignore_cpu && now - last_cpu_poll_ms_ >= kCpuPollIntervalMs) {
+    last_cpu_poll_ms_ = now;
+    PollCpu();
+  }
+
+  const RTCBandwidthEstimate estimate = monitor_->Estimate();
+  if (estimate.target_bitrate_bps <= 0) {
+    return interval;
+  }
+  history_.push_back({now, estimate.rtt_ms, estimate.loss_rate});
+  while (history_.front().time_ms < now - kRttWindowMs) {
+    history_.pop_front();
+  }
+  double loss_sum = 0;
+  int loss_samples = 0;
+  double min_rtt_ms = 0;
+  for (const Sample& sample : history_) {
+    if (sample.time_ms >= now - kLossWindowMs) {
+      loss_sum += sample.loss_rate;
+      ++loss_samples;
+    }
+    if (sample.rtt_ms > 0 && (min_rtt_ms == 0 || sample.rtt_ms < min_rtt_ms)) {
+      min_rtt_ms = sample.rtt_ms;
+    }
+  }
+  const double loss_rate = loss_samples > 0 ? loss_sum / loss_samples : 0;
+
+  webrtc::RtpParameters parameters = sender_->GetParameters();
+  const int level = CurrentLevel(parameters);
+  level_.store(level, std::memory_order_relaxed);
+  if (level == 0) {
+    // The application turned the sender off or changed its encodings.
+    pressure_since_ms_ = -1;
+    headroom_since_ms_ = -1;
+    return interval;
+  }
+
+  const double available = estimate.target_bitrate_bps;
+  std::optional<RTCLayerDecisionReason> reason;
+  int target = level - 1;
+  if (level > 1) {
+    if (cpu_limited_ && !options_.ignore_cpu) {
+      reason = RTCLayerDecisionReason::kCpu;
+    } else if (loss_rate > options_.max_loss_rate) {
+      reason = RTCLayerDecisionReason::kLoss;
+    } else if (min_rtt_ms > 0 &&
+               estimate.rtt_ms > min_rtt_ms + options_.max_rtt_increase_ms) {
+      reason = RTCLayerDecisionReason::kRtt;
+    } else if (available < Cost(level) * options_.down_headroom) {
+      reason = RTCLayerDecisionReason::kBandwidth;
+      // A collapsed estimate drops every layer that no longer fits at once.
+      while (target > 1 && available < Cost(target) * options_.down_headroom) {
+        --target;
+      }
+    }
+  }
+
+  if (reason) {
+    headroom_since_ms_ = -1;
+    if (pressure_since_ms_ < 0) {
+      pressure_since_ms_ = now;
+    }
+    if (now - pressure_since_ms_ >= options_.down_hold_ms &&
+        Apply(std::move(parameters), target, *reason, estimate, loss_rate)) {
+      pressure_since_ms_ = -1;
+      // Dropping what was just added means the last step up was premature.
+      up_backoff_ =
+          last_up_ms_ >= 0 &&
+                  now - last_up_ms_ <
+                      2 * static_cast<int64_t>(options_.up_hold_ms) * up_backoff_
+              ? std::min(up_backoff_ * 2, kMaxUpBackoff)
+              : 1;
+    }
+    return interval;
+  }
+  pressure_since_ms_ = -1;
+
+  if (level < max_level_ &&
+      available >= Cost(level + 1) * options_.up_headroom) {
+    if (headroom_since_ms_ < 0) {
+      headroom_since_ms_ = now;
+    }
+    if (now - headroom_since_ms_ >=
+            static_cast<int64_t>(options_.up_hold_ms) * up_backoff_ &&
+        Apply(std::move(parameters), level + 1,
+              RTCLayerDecisionReason::kBandwidth, estimate, loss_rate)) {
+      headroom_since_ms_ = -1;
+      last_up_ms_ = now;
+    }
+  } else {
+    headroom_since_ms_ = -1;
+  }
+  return interval;
+}
+
+void RTCLayerControllerImpl::PollCpu() {
+  peer_connection_->GetStats(
+      sender_, webrtc::make_ref_counted<CpuStatsCallback>(safety_, this));
+}
+
+bool RTCLayerControllerImpl::Apply(webrtc::RtpParameters parameters, int level,
+                                   RTCLayerDecisionReason reason,
+                                   const RTCBandwidthEstimate& estimate,
+                                   double loss_rate) {
+  const int previous_level = CurrentLevel(parameters);
+  if (order_.empty()) {
+    (*parameters.encodings[0].scalability_mode)[1] =
+        static_cast<char>('0' + level);
+  } else {
+    for (size_t rank = 0; rank < order_.size(); ++rank) {
+      parameters.encodings[order_[rank]].active =
+          rank < static_cast<size_t>(level);
+    }
+  }
+  webrtc::RTCError error = sender_->SetParameters(parameters);
+  if (!error.ok()) {
+    RTC_LOG(LS_WARNING) << "Layer controller could not switch to level "
+                        << level << ": " << error.message();
+    return false;
+  }
+  level_.store(level, std::memory_order_relaxed);
+
+  if (observer_) {
+    RTCLayerDecision decision;
+    decision.reason = reason;
+    decision.previous_level = previous_level;
+    decision.level = level;
+    decision.target_bitrate_bps = estimate.target_bitrate_bps;
+    decision.loss_rate = loss_rate;
+    decision.rtt_ms = estimate.rtt_ms;
+    observer_->OnLayerDecision(decision);
+  }
+  return true;
+}
+
+}  // namespace lumenrtc_bridge
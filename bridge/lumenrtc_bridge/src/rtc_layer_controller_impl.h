@@ -0,0 +1,106 @@
+#ifndef LUMENRTC_BRIDGE_RTC_LAYER_CONTROLLER_IMPL_HXX
+#define LUMENRTC_BRIDGE_RTC_LAYER_CONTROLLER_IMPL_HXX
+
+#include <atomic>
+#include <deque>
+#include <vector>
+
+#include "api/peer_connection_interface.h"
+#include "api/rtp_parameters.h"
+#include "api/rtp_sender_interface.h"
+#include "api/scoped_refptr.h"
+#include "api/task_queue/pending_task_safety_flag.h"
+#include "rtc_base/task_utils/repeating_task.h"
+#include "rtc_base/thread.h"
+#include "rtc_layer_controller.h"
+#include "src/internal/bandwidth_monitor.h"
+
+namespace lumenrtc_bridge {
+
+class RTCLayerControllerImpl : public RTCLayerController {
+ public:
+  // Null if |sender| is not a sender of |peer_connection| or has no layers
+  // to switch.
+  static scoped_refptr<RTCLayerController> Create(
+      webrtc::Thread* signaling_thread,
+      webrtc::scoped_refptr<webrtc::PeerConnectionInterface> peer_connection,
+      webrtc::scoped_refptr<webrtc::RtpSenderInterface> sender,
+      webrtc::scoped_refptr<BandwidthMonitor> monitor,
+      const RTCLayerControllerOptions& options);
+
+  RTCLayerControllerImpl(
+      webrtc::Thread* signaling_thread,
+      webrtc::scoped_refptr<webrtc::PeerConnectionInterface> peer_connection,
+      webrtc::scoped_refptr<webrtc::RtpSenderInterface> sender,
+      webrtc::scoped_refptr<BandwidthMonitor> monitor,
+      const RTCLayerControllerOptions& options);
+  virtual ~RTCLayerControllerImpl();
+
+  int level() override;
+
+  int max_level() override;
+
+  void RegisterObserver(RTCLayerControllerObserver* observer) override;
+
+  void UnregisterObserver() override;
+
+  void Stop() override;
+
+  // Result of the last CPU poll. Runs on the signaling thread.
+  void SetCpuLimited(bool limited);
+
+ private:
+  struct Sample {
+    int64_t time_ms;
+    double rtt_ms;
+    double loss_rate;
+  };
+
+  // Reads the layer layout from |parameters|; false if there is nothing to
+  // switch. Runs on the signaling thread.
+  bool Configure(const webrtc::RtpParameters& parameters);
+  int CurrentLevel(const webrtc::RtpParameters& parameters) const;
+  // Bitrate needed to send the first |level| layers.
+  double Cost(int level) const;
+  webrtc::TimeDelta Tick();
+  void PollCpu();
+  bool Apply(webrtc::RtpParameters parameters, int level,
+             RTCLayerDecisionReason reason,
+             const RTCBandwidthEstimate& estimate, double loss_rate);
+
+  webrtc::Thread* const signaling_thread_;
+  const webrtc::scoped_refptr<webrtc::PeerConnectionInterface>
+      peer_connection_;
+  const webrtc::scoped_refptr<webrtc::RtpSenderInterface> sender_;
+  const webrtc::scoped_refptr<BandwidthMonitor> monitor_;
+  const RTCLayerControllerOptions options_;
+  // Guards stats callbacks, which hold no reference to the controller.
+  const webrtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> safety_;
+  // Set by Configure(). Simulcast encodings from the most scaled down up,
+  // or empty for an SVC encoding.
+  std::vector<size_t> order_;
+  // Bitrate of each simulcast layer in |order_|, or of the whole SVC
+  // encoding.
+  std::vector<double> layer_bitrates_bps_;
+  int max_level_ = 0;
+  std::atomic<int> level_{0};
+
+  // Only touched on the signaling thread.
+  webrtc::RepeatingTaskHandle task_;
+  RTCLayerControllerObserver* observer_ = nullptr;
+  bool stopped_ = false;
+  std::deque<Sample> history_;
+  bool cpu_limited_ = false;
+  int64_t last_cpu_poll_ms_ = 0;
+  // When the current reason to drop, or room to add, a layer was first seen;
+  // -1 if there is none.
+  int64_t pressure_since_ms_ = -1;
+  int64_t headroom_since_ms_ = -1;
+  // Multiplies up_hold_ms after a layer was dropped soon after being added.
+  int up_backoff_ = 1;
+  int64_t last_up_ms_ = -1;
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // LUMENRTC_BRIDGE_RTC_LAYER_CONTROLLER_IMPL_HXX
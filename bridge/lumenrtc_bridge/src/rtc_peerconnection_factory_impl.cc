@@ -3,6 +3,7 @@
 #include "api/audio_codecs/builtin_audio_decoder_factory.h"
 #include "api/audio_codecs/builtin_audio_encoder_factory.h"
 #include "api/create_peerconnection_factory.h"
+#include "api/make_ref_counted.h"
 #include "api/media_stream_interface.h"
 #include "api/video_codecs/builtin_video_decoder_factory.h"
 #include "api/video_codecs/builtin_video_encoder_factory.h"
@@ -14,6 +15,9 @@
 #include "rtc_rtp_capabilities_impl.h"
 #include "rtc_video_device_impl.h"
 #include "rtc_video_source_impl.h"
+#include "src/internal/decode_on_demand.h"
+#include "src/internal/encoded_video_source.h"
+#include "src/internal/thread_tuning.h"
 #include <type_traits>
 #include <utility>
 #if defined(USE_INTEL_MEDIA_SDK)
@@ -69,8 +73,20 @@ std::unique_ptr<webrtc::VideoDecoderFactory> CreateIntelVideoDecoderFactory() {
 
 RTCPeerConnectionFactoryImpl::RTCPeerConnectionFactoryImpl() = default;
 
+RTCPeerConnectionFactoryImpl::RTCPeerConnectionFactoryImpl(
+    const FactoryThreadConfig& config)
+    : thread_config_(config) {}
+
+RTCPeerConnectionFactoryImpl::RTCPeerConnectionFactoryImpl(
+    const FactoryThreadConfig& config,
+    webrtc::scoped_refptr<FactoryThreads> shared_threads)
+    : thread_config_(config), shared_threads_(std::move(shared_threads)) {}
+
 RTCPeerConnectionFactoryImpl::~RTCPeerConnectionFactoryImpl() {
   Terminate();
+  if (shared_threads_) {
+    shared_threads_->RemoveFactory();
+  }
 }
 
 bool RTCPeerConnectionFactoryImpl::Initialize() {
@@ -78,26 +94,22 @@ bool RTCPeerConnectionFactoryImpl::Initialize() {
     return true;
   }
 
-  worker_thread_ = webrtc::Thread::Create();
-  worker_thread_->SetName("lumenrtc_worker", nullptr);
-  if (!worker_thread_->Start()) {
-    worker_thread_.reset();
+  threads_ = shared_threads_ ? shared_threads_ : FactoryThreads::Create(thread_config_);
+  if (!threads_) {
     return false;
   }
+  worker_thread_ = threads_->worker_thread();
+  network_thread_ = threads_->network_thread();
 
+  terminating_ = false;
   signaling_thread_ = webrtc::Thread::Create();
   signaling_thread_->SetName("lumenrtc_signaling", nullptr);
   if (!signaling_thread_->Start()) {
     Terminate();
     return false;
   }
-
-  network_thread_ = webrtc::Thread::CreateWithSocketServer();
-  network_thread_->SetName("lumenrtc_network", nullptr);
-  if (!network_thread_->Start()) {
-    Terminate();
-    return false;
-  }
+  signaling_report_ = signaling_thread_->BlockingCall(
+      [this] { return ApplyThreadTuning(thread_config_.signaling); });
 
   task_queue_factory_ = webrtc::CreateDefaultTaskQueueFactory();
   worker_thread_->BlockingCall([this] {
@@ -107,52 +119,119 @@ bool RTCPeerConnectionFactoryImpl::Initialize() {
     }
   });
 
-  rtc_peerconnection_factory_ = CreatePeerConnectionFactory(
-      network_thread_.get(), worker_thread_.get(), signaling_thread_.get(),
-      audio_device_module_, webrtc::CreateBuiltinAudioEncoderFactory(),
-      webrtc::CreateBuiltinAudioDecoderFactory(),
-#if defined(USE_INTEL_MEDIA_SDK)
-      CreateIntelVideoEncoderFactory(), CreateIntelVideoDecoderFactory(),
-#else
-      webrtc::CreateBuiltinVideoEncoderFactory(),
-      webrtc::CreateBuiltinVideoDecoderFactory(),
-#endif
-      nullptr, audio_processing_impl_->GetAudioProcessing(), nullptr, nullptr);
-
+  rtc_peerconnection_factory_ =
+      CreateShard(network_thread_, audio_device_module_);
   if (!rtc_peerconnection_factory_) {
     Terminate();
     return false;
   }
+  shards_.push_back(rtc_peerconnection_factory_);
+
+  for (size_t i = 1; i < threads_->network_thread_count(); ++i) {
+    // A second voice engine registering on the real device would steal its
+    // audio callback, so extra shards get a dummy device.
+    webrtc::scoped_refptr<webrtc::AudioDeviceModule> dummy_adm =
+        worker_thread_->BlockingCall([this] {
+          return webrtc::AudioDeviceModule::Create(
+              webrtc::AudioDeviceModule::kDummyAudio,
+              task_queue_factory_.get());
+        });
+    webrtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface> shard =
+        CreateShard(threads_->network_thread(i), dummy_adm);
+    if (!shard) {
+      Terminate();
+      return false;
+    }
+    shards_.push_back(shard);
+  }
 
+  pool_ = webrtc::make_ref_counted<PeerConnectionPool>(
+      signaling_thread_.get(),
+      [this](const RTCConfiguration& configuration,
+             scoped_refptr<RTCMediaConstraints> constraints) {
+        return Create(configuration, constraints);
+      },
+      [this](scoped_refptr<RTCPeerConnection> peerconnection) {
+        peerconnection->Close();
+        Delete(peerconnection);
+      });
   return true;
 }
 
+webrtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface>
+RTCPeerConnectionFactoryImpl::CreateShard(
+    webrtc::Thread* network_thread,
+    webrtc::scoped_refptr<webrtc::AudioDeviceModule> audio_device_module) {
+  // Every video encoder is wrapped so that any track may carry an encoded
+  // source, and every decoder so that any receiver may decode on demand.
+  return CreatePeerConnectionFactory(
+      network_thread, worker_thread_, signaling_thread_.get(),
+      audio_device_module, webrtc::CreateBuiltinAudioEncoderFactory(),
+      webrtc::CreateBuiltinAudioDecoderFactory(),
+#if defined(USE_INTEL_MEDIA_SDK)
+      std::make_unique<PassthroughVideoEncoderFactory>(
+          CreateIntelVideoEncoderFactory()),
+      std::make_unique<SkippingVideoDecoderFactory>(
+          CreateIntelVideoDecoderFactory()),
+#else
+      std::make_unique<PassthroughVideoEncoderFactory>(
+          webrtc::CreateBuiltinVideoEncoderFactory()),
+      std::make_unique<SkippingVideoDecoderFactory>(
+          webrtc::CreateBuiltinVideoDecoderFactory()),
+#endif
+      nullptr, audio_processing_impl_->GetAudioProcessing(), nullptr, nullptr);
+}
+
 bool RTCPeerConnectionFactoryImpl::Terminate() {
+  if (pool_) {
+    pool_->Configure(RTCConfiguration(), nullptr, 0);
+    // Wait out a refill already running on the signaling thread.
+    signaling_thread_->BlockingCall([] {});
+    pool_ = nullptr;
+  }
+  if (signaling_thread_) {
+    signaling_thread_->BlockingCall([this] { terminating_ = true; });
+  }
+  {
+    // Muxes unbind on their network thread, which must still be running.
+    webrtc::MutexLock lock(&udp_mux_mutex_);
+    udp_muxes_.clear();
+  }
+  std::list<scoped_refptr<RTCPeerConnection>> peerconnections;
+  {
+    webrtc::MutexLock lock(&peerconnections_mutex_);
+    peerconnections.swap(peerconnections_);
+  }
   if (worker_thread_) {
-    worker_thread_->BlockingCall([this] {
-      peerconnections_.clear();
+    worker_thread_->BlockingCall([this, &peerconnections] {
+      peerconnections.clear();
       desktop_device_impl_ = nullptr;
       audio_device_impl_ = nullptr;
       video_device_impl_ = nullptr;
       audio_processing_impl_ = nullptr;
+      shards_.clear();
       rtc_peerconnection_factory_ = nullptr;
       DestroyAudioDeviceModule_w();
       task_queue_factory_.reset();
     });
   } else {
-    peerconnections_.clear();
+    peerconnections.clear();
     desktop_device_impl_ = nullptr;
     audio_device_impl_ = nullptr;
     video_device_impl_ = nullptr;
     audio_processing_impl_ = nullptr;
+    shards_.clear();
     rtc_peerconnection_factory_ = nullptr;
     audio_device_module_ = nullptr;
     task_queue_factory_.reset();
   }
 
-  network_thread_.reset();
+  // Shared groups outlive this factory; a dedicated one stops here.
+  network_thread_ = nullptr;
   signaling_thread_.reset();
-  worker_thread_.reset();
+  signaling_report_ = RTCThreadReport();
+  worker_thread_ = nullptr;
+  threads_ = nullptr;
   return true;
 }
 
@@ -170,16 +249,59 @@ void RTCPeerConnectionFactoryImpl::DestroyAudioDeviceModule_w() {
 scoped_refptr<RTCPeerConnection> RTCPeerConnectionFactoryImpl::Create(
     const RTCConfiguration& configuration,
     scoped_refptr<RTCMediaConstraints> constraints) {
+  size_t shard = 0;
+  if (shards_.size() > 1) {
+    shard = next_shard_.fetch_add(1, std::memory_order_relaxed) %
+            shards_.size();
+  }
+  return CreateOnShard(shard, configuration, constraints);
+}
+
+scoped_refptr<RTCPeerConnection> RTCPeerConnectionFactoryImpl::Create(
+    const RTCConfiguration& configuration,
+    scoped_refptr<RTCMediaConstraints> constraints,
+    const string network_key) {
+  if (shards_.size() <= 1) {
+    return CreateOnShard(0, configuration, constraints);
+  }
+  // FNV-1a keeps the placement stable across runs and platforms, unlike
+  // std::hash.
+  uint64_t hash = 14695981039346656037ull;
+  for (char c : to_std_string(network_key)) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 1099511628211ull;
+  }
+  return CreateOnShard(static_cast<size_t>(hash % shards_.size()),
+                       configuration, constraints);
+}
+
+scoped_refptr<RTCPeerConnection> RTCPeerConnectionFactoryImpl::CreateOnShard(
+    size_t shard, const RTCConfiguration& configuration,
+    scoped_refptr<RTCMediaConstraints> constraints) {
+  webrtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface> factory =
+      shard < shards_.size() ? shards_[shard] : rtc_peerconnection_factory_;
+  std::unique_ptr<webrtc::PortAllocator> port_allocator;
+  if (threads_ && threads_->virtual_network()) {
+    port_allocator = threads_->virtual_network()->CreatePortAllocator();
+  } else {
+    webrtc::MutexLock lock(&udp_mux_mutex_);
+    if (shard < udp_muxes_.size()) {
+      port_allocator = udp_muxes_[shard]->CreatePortAllocator();
+    }
+  }
   scoped_refptr<RTCPeerConnection> peerconnection =
       scoped_refptr<RTCPeerConnectionImpl>(
           new RefCountedObject<RTCPeerConnectionImpl>(
-              configuration, constraints, rtc_peerconnection_factory_));
+              configuration, constraints, factory, signaling_thread_.get(),
+              std::move(port_allocator), certificate_cache_.Next()));
+  webrtc::MutexLock lock(&peerconnections_mutex_);
   peerconnections_.push_back(peerconnection);
   return peerconnection;
 }
 
 void RTCPeerConnectionFactoryImpl::Delete(
     scoped_refptr<RTCPeerConnection> peerconnection) {
+  webrtc::MutexLock lock(&peerconnections_mutex_);
   peerconnections_.erase(
       std::remove_if(
           peerconnections_.begin(), peerconnections_.end(),
@@ -197,7 +319,7 @@ scoped_refptr<RTCAudioDevice> RTCPeerConnectionFactoryImpl::GetAudioDevice() {
   if (!audio_device_impl_)
     audio_device_impl_ =
         scoped_refptr<AudioDeviceImpl>(new RefCountedObject<AudioDeviceImpl>(
-            audio_device_module_, worker_thread_.get()));
+            audio_device_module_, worker_thread_));
 
   return audio_device_impl_;
 }
@@ -216,7 +338,7 @@ RTCPeerConnectionFactoryImpl::GetAudioProcessing() {
 scoped_refptr<RTCVideoDevice> RTCPeerConnectionFactoryImpl::GetVideoDevice() {
   if (!video_device_impl_)
     video_device_impl_ = scoped_refptr<RTCVideoDeviceImpl>(
-        new RefCountedObject<RTCVideoDeviceImpl>(worker_thread_.get()));
+        new RefCountedObject<RTCVideoDeviceImpl>(worker_thread_));
 
   return video_device_impl_;
 }
@@ -254,7 +376,8 @@ scoped_refptr<RTCDesktopDevice>
 RTCPeerConnectionFactoryImpl::GetDesktopDevice() {
   if (!desktop_device_impl_) {
     desktop_device_impl_ = scoped_refptr<RTCDesktopDeviceImpl>(
-        new RefCountedObject<RTCDesktopDeviceImpl>(signaling_thread_.get()));
+        new RefCountedObject<RTCDesktopDeviceImpl>(signaling_thread_.get(),
+                                                   thread_config_.capture));
   }
   return desktop_device_impl_;
 }
@@ -292,6 +415,32 @@ scoped_refptr<RTCVideoSource> RTCPeerConnectionFactoryImpl::CreateVideoSource_s(
   return source;
 }
 
+scoped_refptr<RTCVideoSource>
+RTCPeerConnectionFactoryImpl::CreateCustomVideoSource(
+    const string video_source_label, bool is_screencast) {
+  // The custom source owns no threads or devices, so it can be built on the
+  // caller's thread; frames are pushed through RTCVideoSource::Push*Frame.
+  webrtc::scoped_refptr<webrtc::internal::CustomVideoSource> custom_source =
+      webrtc::make_ref_counted<webrtc::internal::CustomVideoSource>(
+          is_screencast);
+  scoped_refptr<RTCVideoSourceImpl> source = scoped_refptr<RTCVideoSourceImpl>(
+      new RefCountedObject<RTCVideoSourceImpl>(custom_source));
+  return source;
+}
+
+scoped_refptr<RTCVideoSource>
+RTCPeerConnectionFactoryImpl::CreateEncodedVideoSource(
+    const string video_source_label, const string codec) {
+  std::string codec_name = to_std_string(codec);
+  if (!EncodedVideoSource::IsSupportedCodec(codec_name)) {
+    return nullptr;
+  }
+  webrtc::scoped_refptr<EncodedVideoSource> encoded_source =
+      webrtc::make_ref_counted<EncodedVideoSource>(std::move(codec_name));
+  return scoped_refptr<RTCVideoSource>(
+      new RefCountedObject<RTCVideoSourceImpl>(encoded_source));
+}
+
 #ifdef RTC_DESKTOP_DEVICE
 scoped_refptr<RTCVideoSource> RTCPeerConnectionFactoryImpl::CreateDesktopSource(
     scoped_refptr<RTCDesktopCapturer> capturer, const string video_source_label,
@@ -373,6 +522,78 @@ scoped_refptr<RTCAudioTrack> RTCPeerConnectionFactoryImpl::CreateAudioTrack(
   return track;
 }
 
+template <typename Create, typename Callback>
+bool RTCPeerConnectionFactoryImpl::PostCreate(Create create,
+                                              Callback callback) {
+  if (!signaling_thread_ || !rtc_peerconnection_factory_) {
+    return false;
+  }
+  // |this| is unretained: a task holding the last reference would terminate
+  // the factory on its own signaling thread. Terminate() sets terminating_
+  // on that thread before tearing down and stops it before destruction.
+  signaling_thread_->PostTask([this, create = std::move(create),
+                               callback = std::move(callback)]() mutable {
+    if (terminating_) {
+      callback(nullptr);
+      return;
+    }
+    callback(create());
+  });
+  return true;
+}
+
+bool RTCPeerConnectionFactoryImpl::CreateAudioSourceAsync(
+    const string audio_source_label, RTCAudioSource::SourceType source_type,
+    RTCAudioOptions options, OnAudioSourceCreated callback) {
+  return PostCreate(
+      [this, audio_source_label, source_type, options] {
+        return CreateAudioSource(audio_source_label, source_type, options);
+      },
+      std::move(callback));
+}
+
+bool RTCPeerConnectionFactoryImpl::CreateVideoSourceAsync(
+    scoped_refptr<RTCVideoCapturer> capturer, const string video_source_label,
+    scoped_refptr<RTCMediaConstraints> constraints,
+    OnVideoSourceCreated callback) {
+  return PostCreate(
+      [this, capturer, video_source_label, constraints] {
+        return CreateVideoSource_s(
+            capturer, to_std_string(video_source_label).c_str(), constraints);
+      },
+      std::move(callback));
+}
+
+#ifdef RTC_DESKTOP_DEVICE
+bool RTCPeerConnectionFactoryImpl::CreateDesktopSourceAsync(
+    scoped_refptr<RTCDesktopCapturer> capturer, const string video_source_label,
+    scoped_refptr<RTCMediaConstraints> constraints,
+    OnVideoSourceCreated callback) {
+  return PostCreate(
+      [this, capturer, video_source_label, constraints] {
+        return CreateDesktopSource_d(
+            capturer, to_std_string(video_source_label).c_str(), constraints);
+      },
+      std::move(callback));
+}
+#endif
+
+bool RTCPeerConnectionFactoryImpl::CreateAudioTrackAsync(
+    scoped_refptr<RTCAudioSource> source, const string track_id,
+    OnAudioTrackCreated callback) {
+  return PostCreate(
+      [this, source, track_id] { return CreateAudioTrack(source, track_id); },
+      std::move(callback));
+}
+
+bool RTCPeerConnectionFactoryImpl::CreateVideoTrackAsync(
+    scoped_refptr<RTCVideoSource> source, const string track_id,
+    OnVideoTrackCreated callback) {
+  return PostCreate(
+      [this, source, track_id] { return CreateVideoTrack(source, track_id); },
+      std::move(callback));
+}
+
 scoped_refptr<RTCRtpCapabilities>
 RTCPeerConnectionFactoryImpl::GetRtpSenderCapabilities(
     RTCMediaType media_type) {
@@ -428,4 +649,124 @@ RTCPeerConnectionFactoryImpl::GetRtpReceiverCapabilities(
       new RefCountedObject<RTCRtpCapabilitiesImpl>(rtp_capabilities));
 }
 
+bool RTCPeerConnectionFactoryImpl::SetVirtualNetworkConditions(
+    const RTCVirtualNetworkOptions& options) {
+  if (!threads_ || !threads_->virtual_network()) {
+    return false;
+  }
+  return threads_->virtual_network()->SetConditions(options);
+}
+
+bool RTCPeerConnectionFactoryImpl::ConfigurePeerConnectionPool(
+    const RTCConfiguration& configuration,
+    scoped_refptr<RTCMediaConstraints> constraints, int size) {
+  if (!pool_ || size < 0 ||
+      static_cast<size_t>(size) > PeerConnectionPool::kMaxSize) {
+    return false;
+  }
+  if (!constraints) {
+    constraints = RTCMediaConstraints::Create();
+  }
+  pool_->Configure(configuration, constraints, static_cast<size_t>(size));
+  return true;
+}
+
+scoped_refptr<RTCPeerConnection> RTCPeerConnectionFactoryImpl::CreatePooled() {
+  return pool_ ? pool_->Take() : nullptr;
+}
+
+RTCPeerConnectionPoolStats
+RTCPeerConnectionFactoryImpl::GetPeerConnectionPoolStats() {
+  return pool_ ? pool_->stats() : RTCPeerConnectionPoolStats();
+}
+
+bool RTCPeerConnectionFactoryImpl::ConfigureCertificateCache(
+    const RTCCertificateCacheOptions& options) {
+  return certificate_cache_.Configure(options);
+}
+
+bool RTCPeerConnectionFactoryImpl::ImportCertificate(const string pem) {
+  return certificate_cache_.Import(to_std_string(pem));
+}
+
+string RTCPeerConnectionFactoryImpl::ExportCertificate() {
+  return string(certificate_cache_.Export());
+}
+
+bool RTCPeerConnectionFactoryImpl::ConfigureUdpMux(
+    const RTCUdpMuxOptions& options) {
+  if (!threads_ || threads_->virtual_network()) {
+    return false;
+  }
+  std::vector<webrtc::scoped_refptr<UdpMux>> muxes;
+  if (options.enabled) {
+    const size_t count = threads_->network_thread_count();
+    if (options.port <= 0 ||
+        static_cast<size_t>(options.port) + count - 1 > 65535) {
+      return false;
+    }
+    std::vector<webrtc::scoped_refptr<UdpMux>> current;
+    {
+      webrtc::MutexLock lock(&udp_mux_mutex_);
+      current = udp_muxes_;
+    }
+    // Binding blocks on each network thread, so it happens unlocked; peer
+    // connections created meanwhile still get the previous muxes.
+    for (size_t i = 0; i < count; ++i) {
+      const int port = options.port + static_cast<int>(i);
+      // Keep the mux already bound to this port rather than fail to rebind.
+      if (i < current.size() && current[i]->port() == port) {
+        muxes.push_back(current[i]);
+        continue;
+      }
+      webrtc::scoped_refptr<UdpMux> mux =
+          UdpMux::Create(threads_->network_thread(i), port);
+      if (!mux) {
+        return false;
+      }
+      muxes.push_back(mux);
+    }
+  }
+  {
+    webrtc::MutexLock lock(&udp_mux_mutex_);
+    udp_muxes_.swap(muxes);
+  }
+  // The replaced muxes are released here, outside the lock; each unbinds on
+  // its network thread once its last connection is gone.
+  return true;
+}
+
+RTCUdpMuxStats RTCPeerConnectionFactoryImpl::GetUdpMuxStats() {
+  RTCUdpMuxStats stats;
+  webrtc::MutexLock lock(&udp_mux_mutex_);
+  for (const auto& mux : udp_muxes_) {
+    mux->AddStats(&stats);
+  }
+  return stats;
+}
+
+bool RTCPeerConnectionFactoryImpl::GetThreadReport(RTCThreadRole role,
+                                                   size_t index,
+                                                   RTCThreadReport* report) {
+  if (!report || !threads_) {
+    return false;
+  }
+  switch (role) {
+    case RTCThreadRole::kWorker:
+      *report = threads_->worker_report();
+      return true;
+    case RTCThreadRole::kSignaling:
+      *report = signaling_report_;
+      return true;
+    case RTCThreadRole::kNetwork:
+      if (index >= threads_->network_thread_count()) {
+        return false;
+      }
+      *report = threads_->network_report(index);
+      return true;
+    default:
+      return false;
+  }
+}
+
 }  // namespace lumenrtc_bridge
@@ -1,17 +1,24 @@
 #ifndef LUMENRTC_BRIDGE_MEDIA_SESSION_FACTORY_IMPL_HXX
 #define LUMENRTC_BRIDGE_MEDIA_SESSION_FACTORY_IMPL_HXX
 
+#include <atomic>
 #include <memory>
+#include <vector>
 
 #include "api/media_stream_interface.h"
 #include "api/peer_connection_interface.h"
 #include "api/task_queue/task_queue_factory.h"
 #include "rtc_audio_device_impl.h"
 #include "rtc_audio_processing_impl.h"
+#include "rtc_base/synchronization/mutex.h"
 #include "rtc_base/thread.h"
 #include "rtc_peerconnection.h"
 #include "rtc_peerconnection_factory.h"
 #include "rtc_video_device_impl.h"
+#include "src/internal/certificate_cache.h"
+#include "src/internal/factory_threads.h"
+#include "src/internal/peer_connection_pool.h"
+#include "src/internal/udp_mux.h"
 
 #ifdef RTC_DESKTOP_DEVICE
 #include "rtc_desktop_capturer_impl.h"
@@ -25,6 +32,16 @@ class RTCPeerConnectionFactoryImpl : public RTCPeerConnectionFactory {
  public:
   RTCPeerConnectionFactoryImpl();
 
+  // Starts its own thread group laid out as |config| on Initialize().
+  explicit RTCPeerConnectionFactoryImpl(const FactoryThreadConfig& config);
+
+  // Runs on |shared_threads| instead of starting a worker and network thread
+  // of its own. The group must already count this factory. Only the
+  // signaling and capture tunings of |config| apply.
+  RTCPeerConnectionFactoryImpl(
+      const FactoryThreadConfig& config,
+      webrtc::scoped_refptr<FactoryThreads> shared_threads);
+
   virtual ~RTCPeerConnectionFactoryImpl();
 
   bool Initialize() override;
@@ -35,6 +52,11 @@ class RTCPeerConnectionFactoryImpl : public RTCPeerConnectionFactory {
       const RTCConfiguration& configuration,
       scoped_refptr<RTCMediaConstraints> constraints) override;
 
+  scoped_refptr<RTCPeerConnection> Create(
+      const RTCConfiguration& configuration,
+      scoped_refptr<RTCMediaConstraints> constraints,
+      const string network_key) override;
+
   void Delete(scoped_refptr<RTCPeerConnection> peerconnection) override;
 
   scoped_refptr<RTCAudioDevice> GetAudioDevice() override;
@@ -50,6 +72,12 @@ class RTCPeerConnectionFactoryImpl : public RTCPeerConnectionFactory {
   virtual scoped_refptr<RTCVideoSource> CreateVideoSource(
       scoped_refptr<RTCVideoCapturer> capturer, const string video_source_label,
       scoped_refptr<RTCMediaConstraints> constraints) override;
+
+  virtual scoped_refptr<RTCVideoSource> CreateCustomVideoSource(
+      const string video_source_label, bool is_screencast) override;
+
+  virtual scoped_refptr<RTCVideoSource> CreateEncodedVideoSource(
+      const string video_source_label, const string codec) override;
 #ifdef RTC_DESKTOP_DEVICE
   virtual scoped_refptr<RTCDesktopDevice> GetDesktopDevice() override;
   virtual scoped_refptr<RTCVideoSource> CreateDesktopSource(
@@ -66,6 +94,29 @@ class RTCPeerConnectionFactoryImpl : public RTCPeerConnectionFactory {
   virtual scoped_refptr<RTCMediaStream> CreateStream(
       const string stream_id) override;
 
+  bool CreateAudioSourceAsync(const string audio_source_label,
+                              RTCAudioSource::SourceType source_type,
+                              RTCAudioOptions options,
+                              OnAudioSourceCreated callback) override;
+
+  bool CreateVideoSourceAsync(scoped_refptr<RTCVideoCapturer> capturer,
+                              const string video_source_label,
+                              scoped_refptr<RTCMediaConstraints> constraints,
+                              OnVideoSourceCreated callback) override;
+#ifdef RTC_DESKTOP_DEVICE
+  bool CreateDesktopSourceAsync(scoped_refptr<RTCDesktopCapturer> capturer,
+                                const string video_source_label,
+                                scoped_refptr<RTCMediaConstraints> constraints,
+                                OnVideoSourceCreated callback) override;
+#endif
+  bool CreateAudioTrackAsync(scoped_refptr<RTCAudioSource> source,
+                             const string track_id,
+                             OnAudioTrackCreated callback) override;
+
+  bool CreateVideoTrackAsync(scoped_refptr<RTCVideoSource> source,
+                             const string track_id,
+                             OnVideoTrackCreated callback) override;
+
   webrtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface>
   peer_connection_factory() {
     return rtc_peerconnection_factory_;
@@ -79,11 +130,47 @@ class RTCPeerConnectionFactoryImpl : public RTCPeerConnectionFactory {
 
   webrtc::Thread* signaling_thread() { return signaling_thread_.get(); }
 
+  bool GetThreadReport(RTCThreadRole role, size_t index,
+                       RTCThreadReport* report) override;
+
+  bool SetVirtualNetworkConditions(
+      const RTCVirtualNetworkOptions& options) override;
+
+  bool ConfigurePeerConnectionPool(
+      const RTCConfiguration& configuration,
+      scoped_refptr<RTCMediaConstraints> constraints, int size) override;
+
+  scoped_refptr<RTCPeerConnection> CreatePooled() override;
+
+  RTCPeerConnectionPoolStats GetPeerConnectionPoolStats() override;
+
+  bool ConfigureCertificateCache(
+      const RTCCertificateCacheOptions& options) override;
+
+  bool ImportCertificate(const string pem) override;
+
+  string ExportCertificate() override;
+
+  bool ConfigureUdpMux(const RTCUdpMuxOptions& options) override;
+
+  RTCUdpMuxStats GetUdpMuxStats() override;
+
+  // Worker and network threads in use; null until Initialize() succeeds.
+  webrtc::scoped_refptr<FactoryThreads> threads() { return threads_; }
+
  protected:
   void CreateAudioDeviceModule_w();
 
   void DestroyAudioDeviceModule_w();
 
+  webrtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface> CreateShard(
+      webrtc::Thread* network_thread,
+      webrtc::scoped_refptr<webrtc::AudioDeviceModule> audio_device_module);
+
+  scoped_refptr<RTCPeerConnection> CreateOnShard(
+      size_t shard, const RTCConfiguration& configuration,
+      scoped_refptr<RTCMediaConstraints> constraints);
+
   scoped_refptr<RTCVideoSource> CreateVideoSource_s(
       scoped_refptr<RTCVideoCapturer> capturer, const char* video_source_label,
       scoped_refptr<RTCMediaConstraints> constraints);
@@ -93,12 +180,30 @@ class RTCPeerConnectionFactoryImpl : public RTCPeerConnectionFactory {
       const char* video_source_label,
       scoped_refptr<RTCMediaConstraints> constraints);
 #endif
+  // Queues an async creation on the signaling thread. |create| returns the
+  // object and |callback| receives it, or null once Terminate() has begun.
+  template <typename Create, typename Callback>
+  bool PostCreate(Create create, Callback callback);
+
  private:
-  std::unique_ptr<webrtc::Thread> worker_thread_;
+  const FactoryThreadConfig thread_config_;
+  const webrtc::scoped_refptr<FactoryThreads> shared_threads_;
+  webrtc::scoped_refptr<FactoryThreads> threads_;
+  webrtc::Thread* worker_thread_ = nullptr;
   std::unique_ptr<webrtc::Thread> signaling_thread_;
-  std::unique_ptr<webrtc::Thread> network_thread_;
+  RTCThreadReport signaling_report_;
+  // Set on the signaling thread when Terminate() starts so queued async
+  // creations stop touching the WebRTC factory.
+  bool terminating_ = false;
+  webrtc::Thread* network_thread_ = nullptr;
   webrtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface>
       rtc_peerconnection_factory_;
+  // One WebRTC factory per network thread; [0] is rtc_peerconnection_factory_
+  // and owns the audio device. Sources and tracks are created on [0] and are
+  // usable on every shard since all shards share worker and signaling.
+  std::vector<webrtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface>>
+      shards_;
+  std::atomic<size_t> next_shard_{0};
   webrtc::scoped_refptr<webrtc::AudioDeviceModule> audio_device_module_;
   scoped_refptr<AudioDeviceImpl> audio_device_impl_;
   scoped_refptr<RTCAudioProcessingImpl> audio_processing_impl_;
@@ -106,7 +211,17 @@ class RTCPeerConnectionFactoryImpl : public RTCPeerConnectionFactory {
 #ifdef RTC_DESKTOP_DEVICE
   scoped_refptr<RTCDesktopDeviceImpl> desktop_device_impl_;
 #endif
-  std::list<scoped_refptr<RTCPeerConnection>> peerconnections_;
+  // Connections are added from the signaling thread by pool refills as well
+  // as from application threads.
+  webrtc::Mutex peerconnections_mutex_;
+  std::list<scoped_refptr<RTCPeerConnection>> peerconnections_
+      RTC_GUARDED_BY(peerconnections_mutex_);
+  webrtc::scoped_refptr<PeerConnectionPool> pool_;
+  CertificateCache certificate_cache_;
+  // One per network thread while the UDP mux is enabled, indexed by shard.
+  webrtc::Mutex udp_mux_mutex_;
+  std::vector<webrtc::scoped_refptr<UdpMux>> udp_muxes_
+      RTC_GUARDED_BY(udp_mux_mutex_);
   std::unique_ptr<webrtc::TaskQueueFactory> task_queue_factory_;
 };
 
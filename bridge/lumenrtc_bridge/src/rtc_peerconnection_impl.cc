@@ -9,15 +9,21 @@
 
 #include "api/data_channel_interface.h"
 #include "api/jsep.h"
+#include "api/transport/goog_cc_factory.h"
+#include "api/units/time_delta.h"
+#include "api/video/builtin_video_bitrate_allocator_factory.h"
 #include "pc/media_session.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/time_utils.h"
 #include "rtc_data_channel_impl.h"
 #include "rtc_ice_candidate_impl.h"
+#include "rtc_layer_controller_impl.h"
 #include "rtc_media_stream_impl.h"
 #include "rtc_mediaconstraints_impl.h"
 #include "rtc_rtp_receiver_impl.h"
 #include "rtc_rtp_sender_impl.h"
 #include "rtc_rtp_transceiver_impl.h"
+#include "rtc_session_template_impl.h"
 
 using webrtc::Thread;
 
@@ -299,15 +305,96 @@ class CreateSessionDescriptionObserverProxy
   OnSdpCreateFailure failure_callback_;
 };
 
+// Sets a templated offer as the local description, then reports the text the
+// template rendered for it.
+class TemplatedOfferSetObserver
+    : public webrtc::SetLocalDescriptionObserverInterface {
+ public:
+  TemplatedOfferSetObserver(std::string sdp, OnSdpCreateSuccess success_callback,
+                            OnSdpCreateFailure failure_callback)
+      : sdp_(std::move(sdp)),
+        success_callback_(success_callback),
+        failure_callback_(failure_callback) {}
+
+  void OnSetLocalDescriptionComplete(webrtc::RTCError error) override {
+    if (error.ok()) {
+      success_callback_(sdp_.c_str(), "offer");
+    } else {
+      failure_callback_(error.message());
+    }
+  }
+
+ private:
+  std::string sdp_;
+  OnSdpCreateSuccess success_callback_;
+  OnSdpCreateFailure failure_callback_;
+};
+
+// Keeps the created offer instead of round-tripping it through its text:
+// the description goes straight to SetLocalDescription and is serialized
+// once, through the template.
+class TemplatedOfferCreateObserver
+    : public webrtc::CreateSessionDescriptionObserver {
+ public:
+  TemplatedOfferCreateObserver(
+      webrtc::scoped_refptr<webrtc::PeerConnectionInterface> peer_connection,
+      scoped_refptr<RTCSessionTemplate> session_template,
+      OnSdpCreateSuccess success_callback, OnSdpCreateFailure failure_callback)
+      : peer_connection_(peer_connection),
+        session_template_(session_template),
+        success_callback_(success_callback),
+        failure_callback_(failure_callback) {}
+
+  void OnSuccess(webrtc::SessionDescriptionInterface* desc) override {
+    std::unique_ptr<webrtc::SessionDescriptionInterface> offer(desc);
+    std::string sdp;
+    if (session_template_) {
+      sdp = static_cast<RTCSessionTemplateImpl*>(session_template_.get())
+                ->Render(*offer);
+    } else {
+      offer->ToString(&sdp);
+    }
+    peer_connection_->SetLocalDescription(
+        std::move(offer),
+        webrtc::make_ref_counted<TemplatedOfferSetObserver>(
+            std::move(sdp), success_callback_, failure_callback_));
+  }
+
+  void OnFailure(webrtc::RTCError error) override {
+    failure_callback_(error.message());
+  }
+
+ private:
+  webrtc::scoped_refptr<webrtc::PeerConnectionInterface> peer_connection_;
+  scoped_refptr<RTCSessionTemplate> session_template_;
+  OnSdpCreateSuccess success_callback_;
+  OnSdpCreateFailure failure_callback_;
+};
+
 RTCPeerConnectionImpl::RTCPeerConnectionImpl(
     const RTCConfiguration& configuration,
     scoped_refptr<RTCMediaConstraints> constraints,
     webrtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface>
-        peer_connection_factory)
+        peer_connection_factory,
+    webrtc::Thread* signaling_thread,
+    std::unique_ptr<webrtc::PortAllocator> port_allocator,
+    webrtc::scoped_refptr<webrtc::RTCCertificate> certificate)
     : rtc_peerconnection_factory_(peer_connection_factory),
+      signaling_thread_(signaling_thread),
+      port_allocator_(std::move(port_allocator)),
+      certificate_(std::move(certificate)),
       configuration_(configuration),
       constraints_(constraints),
-      callback_crt_sec_(new webrtc::Mutex()) {
+      callback_crt_sec_(new webrtc::Mutex()),
+      endpoint_wrappers_(webrtc::make_ref_counted<RtpEndpointWrappers>()),
+      transceiver_wrappers_(
+          [endpoint_wrappers = endpoint_wrappers_](
+              const webrtc::scoped_refptr<webrtc::RtpTransceiverInterface>&
+                  transceiver) {
+            return scoped_refptr<RTCRtpTransceiver>(
+                new RefCountedObject<RTCRtpTransceiverImpl>(
+                    transceiver, endpoint_wrappers));
+          }) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor";
   Initialize();
 }
@@ -328,7 +415,7 @@ void RTCPeerConnectionImpl::OnAddTrack(
       out_streams.push_back(new RefCountedObject<MediaStreamImpl>(item));
     }
     scoped_refptr<RTCRtpReceiver> rtc_receiver =
-        new RefCountedObject<RTCRtpReceiverImpl>(receiver);
+        endpoint_wrappers_->receivers.Get(receiver);
     observer_->OnAddTrack(out_streams, rtc_receiver);
   }
 }
@@ -336,16 +423,14 @@ void RTCPeerConnectionImpl::OnAddTrack(
 void RTCPeerConnectionImpl::OnTrack(
     webrtc::scoped_refptr<webrtc::RtpTransceiverInterface> transceiver) {
   if (nullptr != observer_) {
-    observer_->OnTrack(
-        new RefCountedObject<RTCRtpTransceiverImpl>(transceiver));
+    observer_->OnTrack(transceiver_wrappers_.Get(transceiver));
   }
 }
 
 void RTCPeerConnectionImpl::OnRemoveTrack(
     webrtc::scoped_refptr<webrtc::RtpReceiverInterface> receiver) {
   if (nullptr != observer_) {
-    observer_->OnRemoveTrack(
-        new RefCountedObject<RTCRtpReceiverImpl>(receiver));
+    observer_->OnRemoveTrack(endpoint_wrappers_->receivers.Get(receiver));
   }
 }
 
@@ -409,6 +494,11 @@ void RTCPeerConnectionImpl::OnConnectionChange(
 
 void RTCPeerConnectionImpl::OnIceGatheringChange(
     webrtc::PeerConnectionInterface::IceGatheringState new_state) {
+  // Batched candidates must not trail the "complete" event.
+  if (new_state ==
+      webrtc::PeerConnectionInterface::IceGatheringState::kIceGatheringComplete) {
+    FlushIceCandidates();
+  }
   if (observer_)
     observer_->OnIceGatheringState(ToBridgeIceGatheringState(new_state));
 }
@@ -442,6 +532,116 @@ bool RTCPeerConnectionImpl::AddCandidate(const string mid, int mid_mline_index,
   return rtc_peerconnection_->AddIceCandidate(candidate.get());
 }
 
+int RTCPeerConnectionImpl::AddCandidates(
+    const vector<scoped_refptr<RTCIceCandidate>> candidates, int* applied) {
+  if (applied) {
+    std::fill(applied, applied + candidates.size(), 0);
+  }
+  webrtc::scoped_refptr<webrtc::PeerConnectionInterface> pc =
+      rtc_peerconnection_;
+  if (!pc) {
+    return 0;
+  }
+  std::vector<std::pair<size_t, const webrtc::IceCandidateInterface*>> parsed;
+  parsed.reserve(candidates.size());
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    if (candidates[i].get()) {
+      parsed.emplace_back(
+          i,
+          static_cast<RTCIceCandidateImpl*>(candidates[i].get())->candidate());
+    }
+  }
+  if (parsed.empty()) {
+    return 0;
+  }
+  // Going through the proxy would block on the signaling thread once per
+  // candidate; hop once and apply the whole burst there.
+  return signaling_thread_->BlockingCall([&pc, &parsed, applied] {
+    int count = 0;
+    for (const auto& [index, candidate] : parsed) {
+      if (pc->AddIceCandidate(candidate)) {
+        ++count;
+        if (applied) {
+          applied[index] = 1;
+        }
+      }
+    }
+    return count;
+  });
+}
+
+void RTCPeerConnectionImpl::SetIceCandidateBatchWindow(int window_ms) {
+  bool flush = false;
+  {
+    webrtc::MutexLock cs(callback_crt_sec_.get());
+    candidate_batch_window_ms_ = std::max(0, window_ms);
+    flush = candidate_batch_window_ms_ == 0 && !pending_candidates_.empty();
+  }
+  if (flush) {
+    signaling_thread_->PostTask(
+        [self = scoped_refptr<RTCPeerConnectionImpl>(this)] {
+          self->FlushIceCandidates();
+        });
+  }
+}
+
+void RTCPeerConnectionImpl::FlushIceCandidates() {
+  std::vector<scoped_refptr<RTCIceCandidate>> batch;
+  {
+    webrtc::MutexLock cs(callback_crt_sec_.get());
+    batch.swap(pending_candidates_);
+  }
+  if (!batch.empty() && observer_) {
+    observer_->OnIceCandidates(vector<scoped_refptr<RTCIceCandidate>>(batch));
+  }
+}
+
+void RTCPeerConnectionImpl::SetBandwidthEstimateInterval(int interval_ms) {
+  bool report = false;
+  {
+    webrtc::MutexLock cs(callback_crt_sec_.get());
+    bandwidth_interval_ms_ = std::max(0, interval_ms);
+    // The first report carries the current estimate instead of waiting for
+    // the next change.
+    report = bandwidth_interval_ms_ > 0 && !bandwidth_report_pending_;
+    bandwidth_report_pending_ = report;
+  }
+  if (report) {
+    signaling_thread_->PostTask(
+        [self = scoped_refptr<RTCPeerConnectionImpl>(this)] {
+          self->ReportBandwidthEstimate();
+        });
+  }
+}
+
+void RTCPeerConnectionImpl::ReportBandwidthEstimate() {
+  {
+    webrtc::MutexLock cs(callback_crt_sec_.get());
+    bandwidth_report_pending_ = false;
+    if (bandwidth_interval_ms_ == 0 || !bandwidth_monitor_) {
+      return;
+    }
+    last_bandwidth_report_ms_ = webrtc::TimeMillis();
+  }
+  RTCBandwidthEstimate estimate = bandwidth_monitor_->Estimate();
+  if (observer_) {
+    observer_->OnBandwidthEstimate(estimate);
+  }
+}
+
+scoped_refptr<RTCLayerController> RTCPeerConnectionImpl::CreateLayerController(
+    scoped_refptr<RTCRtpSender> sender,
+    const RTCLayerControllerOptions& options) {
+  if (!rtc_peerconnection_ || !sender.get() ||
+      sender->media_type() != RTCMediaType::VIDEO) {
+    return nullptr;
+  }
+  RTCRtpSenderImpl* impl = static_cast<RTCRtpSenderImpl*>(sender.get());
+  return RTCLayerControllerImpl::Create(signaling_thread_, rtc_peerconnection_,
+                                        impl->rtc_rtp_sender(),
+                                        bandwidth_monitor_, options);
+}
+
 void RTCPeerConnectionImpl::OnIceCandidate(
     const webrtc::IceCandidateInterface* candidate) {
   if (!rtc_peerconnection_) return;
@@ -460,13 +660,44 @@ void RTCPeerConnectionImpl::OnIceCandidate(
   }
 #endif
 
+  webrtc::scoped_refptr<LoopbackLink> link;
+  LoopbackLink::Role role = LoopbackLink::kOfferer;
+  {
+    webrtc::MutexLock cs(callback_crt_sec_.get());
+    link = loopback_link_;
+    role = loopback_role_;
+  }
+  if (link) {
+    link->OnLocalCandidate(role, candidate);
+  }
+
   std::string cand_sdp;
   if (observer_ && candidate->ToString(&cand_sdp)) {
     SdpParseError error;
     scoped_refptr<RTCIceCandidate> cand =
         RTCIceCandidate::Create(cand_sdp.c_str(), candidate->sdp_mid().c_str(),
                                 candidate->sdp_mline_index(), &error);
-    observer_->OnIceCandidate(cand);
+    int window_ms = 0;
+    bool first = false;
+    {
+      webrtc::MutexLock cs(callback_crt_sec_.get());
+      window_ms = candidate_batch_window_ms_;
+      if (window_ms > 0) {
+        first = pending_candidates_.empty();
+        pending_candidates_.push_back(cand);
+      }
+    }
+    if (window_ms == 0) {
+      observer_->OnIceCandidate(cand);
+    } else if (first) {
+      // The reference keeps a released connection alive until the window
+      // closes; the flush then finds no observer.
+      signaling_thread_->PostDelayedTask(
+          [self = scoped_refptr<RTCPeerConnectionImpl>(this)] {
+            self->FlushIceCandidates();
+          },
+          webrtc::TimeDelta::Millis(window_ms));
+    }
   }
 
   RTC_LOG(LS_INFO) << __FUNCTION__ << ", mid " << candidate->sdp_mid()
@@ -516,6 +747,9 @@ bool RTCPeerConnectionImpl::Initialize() {
     config.screencast_min_bitrate = configuration_.screencast_min_bitrate;
   }
   config.set_dscp(configuration_.enable_dscp);
+  if (certificate_) {
+    config.certificates.push_back(certificate_);
+  }
 
   offer_answer_options_.offer_to_receive_audio =
       configuration_.offer_to_receive_audio;
@@ -536,7 +770,35 @@ bool RTCPeerConnectionImpl::Initialize() {
       configuration_.srtp_type == MediaSecurityType::kSRTP_None;
   rtc_peerconnection_factory_->SetOptions(options);
 
+  // Only schedules the report; the observer is called from
+  // ReportBandwidthEstimate() on the signaling thread.
+  bandwidth_monitor_ = webrtc::make_ref_counted<BandwidthMonitor>([this] {
+    int delay_ms = 0;
+    {
+      webrtc::MutexLock cs(callback_crt_sec_.get());
+      if (bandwidth_interval_ms_ == 0 || bandwidth_report_pending_) {
+        return;
+      }
+      bandwidth_report_pending_ = true;
+      delay_ms = static_cast<int>(std::max<int64_t>(
+          0, last_bandwidth_report_ms_ + bandwidth_interval_ms_ -
+                 webrtc::TimeMillis()));
+    }
+    signaling_thread_->PostDelayedTask(
+        [self = scoped_refptr<RTCPeerConnectionImpl>(this)] {
+          self->ReportBandwidthEstimate();
+        },
+        webrtc::TimeDelta::Millis(delay_ms));
+  });
+
   webrtc::PeerConnectionDependencies dependencies(this);
+  dependencies.allocator = std::move(port_allocator_);
+  dependencies.network_controller_factory =
+      bandwidth_monitor_->WrapNetworkControllerFactory(
+          std::make_unique<webrtc::GoogCcNetworkControllerFactory>());
+  dependencies.video_bitrate_allocator_factory =
+      bandwidth_monitor_->WrapVideoBitrateAllocatorFactory(
+          webrtc::CreateBuiltinVideoBitrateAllocatorFactory());
   auto result = rtc_peerconnection_factory_->CreatePeerConnectionOrError(
       config, std::move(dependencies));
   if (!result.ok()) {
@@ -659,8 +921,9 @@ void RTCPeerConnectionImpl::SetRemoteDescription(const string sdp,
 
 void RTCPeerConnectionImpl::GetLocalDescription(OnGetSdpSuccess success,
                                                 OnGetSdpFailure failure) {
-  auto local_description = rtc_peerconnection_->local_description();
-  if (!local_description) {
+  string sdp;
+  string type;
+  if (!CopyLocalDescription(sdp, type)) {
     if (failure) {
       failure("not local description");
     }
@@ -668,16 +931,15 @@ void RTCPeerConnectionImpl::GetLocalDescription(OnGetSdpSuccess success,
   }
 
   if (success) {
-    std::string dsp;
-    local_description->ToString(&dsp);
-    success(dsp.c_str(), webrtc::SdpTypeToString(local_description->GetType()));
+    success(sdp.c_string(), type.c_string());
   }
 }
 
 void RTCPeerConnectionImpl::GetRemoteDescription(OnGetSdpSuccess success,
                                                  OnGetSdpFailure failure) {
-  auto remote_description = rtc_peerconnection_->remote_description();
-  if (!remote_description) {
+  string sdp;
+  string type;
+  if (!CopyRemoteDescription(sdp, type)) {
     if (failure) {
       failure("not remote description");
     }
@@ -685,11 +947,67 @@ void RTCPeerConnectionImpl::GetRemoteDescription(OnGetSdpSuccess success,
   }
 
   if (success) {
-    std::string dsp;
-    remote_description->ToString(&dsp);
-    success(dsp.c_str(),
-            webrtc::SdpTypeToString(remote_description->GetType()));
+    success(sdp.c_string(), type.c_string());
+  }
+}
+
+bool RTCPeerConnectionImpl::Serialize(
+    const webrtc::SessionDescriptionInterface* description,
+    DescriptionText* text) {
+  if (!description) {
+    *text = DescriptionText();
+    return false;
+  }
+  size_t candidates = 0;
+  for (size_t i = 0; i < description->number_of_mediasections(); ++i) {
+    if (const webrtc::IceCandidateCollection* collection =
+            description->candidates(i)) {
+      candidates += collection->count();
+    }
+  }
+  // Gathered candidates are added to the local description in place, so
+  // the object alone does not identify its text.
+  if (text->description != description ||
+      text->session_id != description->session_id() ||
+      text->session_version != description->session_version() ||
+      text->candidates != candidates) {
+    text->description = description;
+    text->session_id = description->session_id();
+    text->session_version = description->session_version();
+    text->candidates = candidates;
+    text->sdp.clear();
+    description->ToString(&text->sdp);
+    text->type = webrtc::SdpTypeToString(description->GetType());
+  }
+  return true;
+}
+
+bool RTCPeerConnectionImpl::CopyLocalDescription(string& sdp, string& type) {
+  if (!rtc_peerconnection_.get()) {
+    return false;
+  }
+  return signaling_thread_->BlockingCall([this, &sdp, &type] {
+    if (!Serialize(rtc_peerconnection_->local_description(), &local_text_)) {
+      return false;
+    }
+    sdp = local_text_.sdp;
+    type = local_text_.type;
+    return true;
+  });
+}
+
+bool RTCPeerConnectionImpl::CopyRemoteDescription(string& sdp, string& type) {
+  if (!rtc_peerconnection_.get()) {
+    return false;
   }
+  return signaling_thread_->BlockingCall([this, &sdp, &type] {
+    if (!Serialize(rtc_peerconnection_->remote_description(), &remote_text_)) {
+      return false;
+    }
+    sdp = remote_text_.sdp;
+    type = remote_text_.type;
+    return true;
+  });
 }
 
 void RTCPeerConnectionImpl::CreateOffer(
@@ -738,6 +1056,68 @@ void RTCPeerConnectionImpl::CreateAnswer(
       offer_answer_options);
 }
 
+void RTCPeerConnectionImpl::CreateTemplatedOffer(
+    scoped_refptr<RTCSessionTemplate> session_template,
+    OnSdpCreateSuccess success, OnSdpCreateFailure failure,
+    scoped_refptr<RTCMediaConstraints> constraints) {
+  if (!rtc_peerconnection_.get() || !rtc_peerconnection_factory_.get()) {
+    webrtc::MutexLock cs(callback_crt_sec_.get());
+    failure("Failed to initialize PeerConnection");
+    return;
+  }
+
+  RTCMediaConstraintsImpl* media_constraints =
+      static_cast<RTCMediaConstraintsImpl*>(constraints.get());
+  webrtc::PeerConnectionInterface::RTCOfferAnswerOptions offer_answer_options;
+  webrtc::MediaConstraints rtc_constraints(media_constraints->GetMandatory(),
+                                           media_constraints->GetOptional());
+  if (CopyConstraintsIntoOfferAnswerOptions(&rtc_constraints,
+                                            &offer_answer_options) == false) {
+    offer_answer_options = offer_answer_options_;
+  }
+
+  rtc_peerconnection_->CreateOffer(
+      new webrtc::RefCountedObject<TemplatedOfferCreateObserver>(
+          rtc_peerconnection_, session_template, success, failure),
+      offer_answer_options);
+}
+
+void RTCPeerConnectionImpl::ConnectLoopback(
+    scoped_refptr<RTCPeerConnection> answerer, OnSetSdpSuccess success,
+    OnSetSdpFailure failure) {
+  auto* remote = static_cast<RTCPeerConnectionImpl*>(answerer.get());
+  if (!remote || remote == this || !rtc_peerconnection_ ||
+      !remote->rtc_peerconnection_) {
+    if (failure) {
+      failure("Invalid loopback peer connection.");
+    }
+    return;
+  }
+  webrtc::scoped_refptr<LoopbackLink> link =
+      webrtc::make_ref_counted<LoopbackLink>(
+          LoopbackLink::Peer{rtc_peerconnection_, signaling_thread_},
+          LoopbackLink::Peer{remote->rtc_peerconnection_,
+                             remote->signaling_thread_},
+          success, failure);
+  AttachLoopback(link, LoopbackLink::kOfferer);
+  remote->AttachLoopback(link, LoopbackLink::kAnswerer);
+  link->Start();
+}
+
+void RTCPeerConnectionImpl::AttachLoopback(
+    webrtc::scoped_refptr<LoopbackLink> link, LoopbackLink::Role role) {
+  webrtc::scoped_refptr<LoopbackLink> previous;
+  {
+    webrtc::MutexLock cs(callback_crt_sec_.get());
+    previous = std::move(loopback_link_);
+    loopback_link_ = std::move(link);
+    loopback_role_ = role;
+  }
+  if (previous) {
+    previous->Detach();
+  }
+}
+
 void RTCPeerConnectionImpl::RestartIce() {
   RTC_LOG(LS_INFO) << __FUNCTION__;
   if (rtc_peerconnection_.get()) {
@@ -747,10 +1127,22 @@ void RTCPeerConnectionImpl::RestartIce() {
 
 void RTCPeerConnectionImpl::Close() {
   RTC_LOG(LS_INFO) << __FUNCTION__;
+  AttachLoopback(nullptr, LoopbackLink::kOfferer);
+  {
+    webrtc::MutexLock cs(callback_crt_sec_.get());
+    pending_candidates_.clear();
+    bandwidth_interval_ms_ = 0;
+  }
+  if (bandwidth_monitor_) {
+    bandwidth_monitor_->Detach();
+  }
   if (rtc_peerconnection_.get()) {
     rtc_peerconnection_->Close();
     rtc_peerconnection_ = nullptr;
     data_channel_ = nullptr;
+    transceiver_wrappers_.Clear();
+    endpoint_wrappers_->senders.Clear();
+    endpoint_wrappers_->receivers.Clear();
     local_streams_.clear();
     for (auto stream : remote_streams_) {
       if (observer_) {
@@ -878,7 +1270,7 @@ scoped_refptr<RTCRtpTransceiver> RTCPeerConnectionImpl::AddTransceiver(
     return scoped_refptr<RTCRtpTransceiver>();
   }
 
-  return new RefCountedObject<RTCRtpTransceiverImpl>(errorOr.value());
+  return transceiver_wrappers_.Get(errorOr.value());
 }
 
 scoped_refptr<RTCRtpTransceiver> RTCPeerConnectionImpl::AddTransceiver(
@@ -897,7 +1289,7 @@ scoped_refptr<RTCRtpTransceiver> RTCPeerConnectionImpl::AddTransceiver(
     return scoped_refptr<RTCRtpTransceiver>();
   }
 
-  return new RefCountedObject<RTCRtpTransceiverImpl>(errorOr.value());
+  return transceiver_wrappers_.Get(errorOr.value());
 }
 
 scoped_refptr<RTCRtpTransceiver> RTCPeerConnectionImpl::AddTransceiver(
@@ -916,7 +1308,7 @@ scoped_refptr<RTCRtpTransceiver> RTCPeerConnectionImpl::AddTransceiver(
     return scoped_refptr<RTCRtpTransceiver>();
   }
 
-  return new RefCountedObject<RTCRtpTransceiverImpl>(errorOr.value());
+  return transceiver_wrappers_.Get(errorOr.value());
 }
 
 scoped_refptr<RTCRtpTransceiver> RTCPeerConnectionImpl::AddTransceiver(
@@ -937,7 +1329,7 @@ scoped_refptr<RTCRtpTransceiver> RTCPeerConnectionImpl::AddTransceiver(
     return scoped_refptr<RTCRtpTransceiver>();
   }
 
-  return new RefCountedObject<RTCRtpTransceiverImpl>(errorOr.value());
+  return transceiver_wrappers_.Get(errorOr.value());
 }
 
 scoped_refptr<RTCRtpSender> RTCPeerConnectionImpl::AddTrack(
@@ -962,7 +1354,7 @@ scoped_refptr<RTCRtpSender> RTCPeerConnectionImpl::AddTrack(
     return scoped_refptr<RTCRtpSender>();
   }
 
-  return new RefCountedObject<RTCRtpSenderImpl>(errorOr.value());
+  return endpoint_wrappers_->senders.Get(errorOr.value());
 }
 
 bool RTCPeerConnectionImpl::RemoveTrack(scoped_refptr<RTCRtpSender> render) {
@@ -976,33 +1368,32 @@ bool RTCPeerConnectionImpl::RemoveTrack(scoped_refptr<RTCRtpSender> render) {
 }
 
 vector<scoped_refptr<RTCRtpSender>> RTCPeerConnectionImpl::senders() {
-  const auto native_senders = rtc_peerconnection_->GetSenders();
-  std::vector<scoped_refptr<RTCRtpSender>> vec;
-  vec.reserve(native_senders.size());
-  for (const auto& item : native_senders) {
-    vec.push_back(new RefCountedObject<RTCRtpSenderImpl>(item));
-  }
-  return vec;
+  return endpoint_wrappers_->senders.Snapshot(
+      rtc_peerconnection_->GetSenders());
 }
 
 vector<scoped_refptr<RTCRtpTransceiver>> RTCPeerConnectionImpl::transceivers() {
-  const auto native_transceivers = rtc_peerconnection_->GetTransceivers();
-  std::vector<scoped_refptr<RTCRtpTransceiver>> vec;
-  vec.reserve(native_transceivers.size());
-  for (const auto& item : native_transceivers) {
-    vec.push_back(new RefCountedObject<RTCRtpTransceiverImpl>(item));
-  }
-  return vec;
+  return transceiver_wrappers_.Snapshot(
+      rtc_peerconnection_->GetTransceivers());
 }
 
 vector<scoped_refptr<RTCRtpReceiver>> RTCPeerConnectionImpl::receivers() {
-  const auto native_receivers = rtc_peerconnection_->GetReceivers();
-  std::vector<scoped_refptr<RTCRtpReceiver>> vec;
-  vec.reserve(native_receivers.size());
-  for (const auto& item : native_receivers) {
-    vec.push_back(new RefCountedObject<RTCRtpReceiverImpl>(item));
-  }
-  return vec;
+  return endpoint_wrappers_->receivers.Snapshot(
+      rtc_peerconnection_->GetReceivers());
+}
+
+scoped_refptr<RTCRtpSender> RTCPeerConnectionImpl::sender_at(uint32_t index) {
+  return endpoint_wrappers_->senders.SnapshotAt(index);
+}
+
+scoped_refptr<RTCRtpTransceiver> RTCPeerConnectionImpl::transceiver_at(
+    uint32_t index) {
+  return transceiver_wrappers_.SnapshotAt(index);
+}
+
+scoped_refptr<RTCRtpReceiver> RTCPeerConnectionImpl::receiver_at(
+    uint32_t index) {
+  return endpoint_wrappers_->receivers.SnapshotAt(index);
 }
 
 RTCSignalingState RTCPeerConnectionImpl::signaling_state() {
@@ -11,7 +11,9 @@
 #include "api/peer_connection_interface.h"
 #include "api/scoped_refptr.h"
 #include "modules/video_capture/video_capture.h"
+#include "p2p/base/port_allocator.h"
 #include "rtc_audio_track_impl.h"
+#include "rtc_base/rtc_certificate.h"
 #include "rtc_base/synchronization/mutex.h"
 #include "rtc_peerconnection.h"
 #include "rtc_peerconnection_factory.h"
@@ -19,6 +21,9 @@
 #include "rtc_video_source.h"
 #include "rtc_video_source_impl.h"
 #include "rtc_video_track_impl.h"
+#include "src/internal/bandwidth_monitor.h"
+#include "src/internal/loopback_signaling.h"
+#include "src/internal/rtp_wrapper_cache.h"
 #include "src/internal/video_capturer.h"
 
 namespace webrtc {
@@ -31,6 +36,10 @@ class VideoRenderer;
 
 namespace lumenrtc_bridge {
 
+class RTCRtpReceiverImpl;
+class RTCRtpSenderImpl;
+class RTCRtpTransceiverImpl;
+
 class RTCPeerConnectionImpl : public RTCPeerConnection,
                               public webrtc::PeerConnectionObserver {
  public:
@@ -44,6 +53,11 @@ class RTCPeerConnectionImpl : public RTCPeerConnection,
       OnSdpCreateSuccess success, OnSdpCreateFailure failure,
       scoped_refptr<RTCMediaConstraints> constraints) override;
 
+  virtual void CreateTemplatedOffer(
+      scoped_refptr<RTCSessionTemplate> session_template,
+      OnSdpCreateSuccess success, OnSdpCreateFailure failure,
+      scoped_refptr<RTCMediaConstraints> constraints) override;
+
   virtual void SetLocalDescription(const string sdp, const string type,
                                    OnSetSdpSuccess success,
                                    OnSetSdpFailure failure) override;
@@ -58,9 +72,28 @@ class RTCPeerConnectionImpl : public RTCPeerConnection,
   virtual void GetRemoteDescription(OnGetSdpSuccess success,
                                     OnGetSdpFailure failure) override;
 
+  virtual bool CopyLocalDescription(string& sdp, string& type) override;
+
+  virtual bool CopyRemoteDescription(string& sdp, string& type) override;
+
   virtual bool AddCandidate(const string mid, int midx,
                             const string candiate) override;
 
+  int AddCandidates(const vector<scoped_refptr<RTCIceCandidate>> candidates,
+                    int* applied) override;
+
+  void SetIceCandidateBatchWindow(int window_ms) override;
+
+  void SetBandwidthEstimateInterval(int interval_ms) override;
+
+  scoped_refptr<RTCLayerController> CreateLayerController(
+      scoped_refptr<RTCRtpSender> sender,
+      const RTCLayerControllerOptions& options) override;
+
+  virtual void ConnectLoopback(scoped_refptr<RTCPeerConnection> answerer,
+                               OnSetSdpSuccess success,
+                               OnSetSdpFailure failure) override;
+
   virtual void RestartIce() override;
 
   virtual void Close() override;
@@ -95,6 +128,12 @@ class RTCPeerConnectionImpl : public RTCPeerConnection,
 
   virtual vector<scoped_refptr<RTCRtpReceiver>> receivers() override;
 
+  scoped_refptr<RTCRtpSender> sender_at(uint32_t index) override;
+
+  scoped_refptr<RTCRtpTransceiver> transceiver_at(uint32_t index) override;
+
+  scoped_refptr<RTCRtpReceiver> receiver_at(uint32_t index) override;
+
  public:
   virtual int AddStream(scoped_refptr<RTCMediaStream> stream) override;
 
@@ -136,11 +175,16 @@ class RTCPeerConnectionImpl : public RTCPeerConnection,
                         OnStatsCollectorFailure failure) override;
 
  public:
+  // |signaling_thread| is the factory's signaling thread. A non-null
+  // |port_allocator| replaces the default one, e.g. for a virtual network.
   RTCPeerConnectionImpl(
       const RTCConfiguration& configuration,
       scoped_refptr<RTCMediaConstraints> constraints,
       webrtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface>
-          peer_connection_factory);
+          peer_connection_factory,
+      webrtc::Thread* signaling_thread = nullptr,
+      std::unique_ptr<webrtc::PortAllocator> port_allocator = nullptr,
+      webrtc::scoped_refptr<webrtc::RTCCertificate> certificate = nullptr);
 
  protected:
   ~RTCPeerConnectionImpl();
@@ -182,10 +226,42 @@ class RTCPeerConnectionImpl : public RTCPeerConnection,
   virtual void OnSignalingChange(
       webrtc::PeerConnectionInterface::SignalingState new_state) override;
 
+  void AttachLoopback(webrtc::scoped_refptr<LoopbackLink> link,
+                      LoopbackLink::Role role);
+
+  // Reports candidates held back by SetIceCandidateBatchWindow(). Runs on
+  // the signaling thread.
+  void FlushIceCandidates();
+
+  // Delivers the latest bandwidth estimate to the observer. Runs on the
+  // signaling thread.
+  void ReportBandwidthEstimate();
+
+ private:
+  // Serialized form of a description, reused while the description object,
+  // its session version and its candidate count stay the same.
+  struct DescriptionText {
+    const webrtc::SessionDescriptionInterface* description = nullptr;
+    std::string session_id;
+    std::string session_version;
+    size_t candidates = 0;
+    std::string sdp;
+    std::string type;
+  };
+
+  // Runs on the signaling thread.
+  static bool Serialize(const webrtc::SessionDescriptionInterface* description,
+                        DescriptionText* text);
+
  protected:
   webrtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface>
       rtc_peerconnection_factory_;
   webrtc::scoped_refptr<webrtc::PeerConnectionInterface> rtc_peerconnection_;
+  webrtc::Thread* const signaling_thread_;
+  std::unique_ptr<webrtc::PortAllocator> port_allocator_;
+  // Shared DTLS certificate from the factory's cache; null lets WebRTC
+  // generate one.
+  webrtc::scoped_refptr<webrtc::RTCCertificate> certificate_;
   RTCConfiguration configuration_;
   scoped_refptr<RTCMediaConstraints> constraints_;
   webrtc::PeerConnectionInterface::RTCOfferAnswerOptions offer_answer_options_;
@@ -195,6 +271,25 @@ class RTCPeerConnectionImpl : public RTCPeerConnection,
   std::vector<scoped_refptr<RTCMediaStream>> local_streams_;
   std::vector<scoped_refptr<RTCMediaStream>> remote_streams_;
   scoped_refptr<RTCDataChannel> data_channel_;
+  // Set by ConnectLoopback(); guarded by callback_crt_sec_.
+  webrtc::scoped_refptr<LoopbackLink> loopback_link_;
+  LoopbackLink::Role loopback_role_ = LoopbackLink::kOfferer;
+  // Local candidate coalescing; guarded by callback_crt_sec_.
+  int candidate_batch_window_ms_ = 0;
+  std::vector<scoped_refptr<RTCIceCandidate>> pending_candidates_;
+  // Created with the connection; its wrappers are owned by WebRTC.
+  webrtc::scoped_refptr<BandwidthMonitor> bandwidth_monitor_;
+  // Bandwidth estimate reporting; guarded by callback_crt_sec_.
+  int bandwidth_interval_ms_ = 0;
+  bool bandwidth_report_pending_ = false;
+  int64_t last_bandwidth_report_ms_ = 0;
+  const webrtc::scoped_refptr<RtpEndpointWrappers> endpoint_wrappers_;
+  RtpWrapperCache<webrtc::RtpTransceiverInterface, RTCRtpTransceiver,
+                  RTCRtpTransceiverImpl>
+      transceiver_wrappers_;
+  // Only touched on the signaling thread.
+  DescriptionText local_text_;
+  DescriptionText remote_text_;
 };
 
 }  // namespace lumenrtc_bridge
@@ -103,4 +103,81 @@ void RTCRtpReceiverImpl::SetJitterBufferMinimumDelay(double delay_seconds) {
   rtp_receiver_->SetJitterBufferMinimumDelay(delay_seconds);
 }
 
+void RTCRtpReceiverImpl::SetEncodedFrameObserver(
+    RTCEncodedFrameObserver* observer) {
+  bool install = false;
+  webrtc::scoped_refptr<EncodedFrameTap> tap = FindEncodedFrameTap(
+      rtp_receiver_.get(), observer != nullptr, &install);
+  if (!tap) {
+    return;
+  }
+  tap->SetObserver(observer);
+  if (install) {
+    rtp_receiver_->SetDepacketizerToDecoderFrameTransformer(tap);
+  }
+}
+
+void RTCRtpReceiver::DetachEncodedFrameObserver(
+    RTCEncodedFrameObserver* observer) {
+  if (!observer) {
+    return;
+  }
+  // Taps are cleared outside the registry lock: clearing waits for a
+  // running call, which may itself look up a transformer.
+  for (const webrtc::scoped_refptr<EncodedFrameTap>& tap :
+       AllEncodedFrameTaps()) {
+    tap->ClearObserver(observer);
+  }
+}
+
+bool RTCRtpReceiverImpl::RequestKeyFrame() {
+  if (rtp_receiver_->media_type() != webrtc::MediaType::VIDEO) {
+    return false;
+  }
+  webrtc::scoped_refptr<webrtc::MediaStreamTrackInterface> track =
+      rtp_receiver_->track();
+  if (!track) {
+    return false;
+  }
+  webrtc::scoped_refptr<webrtc::VideoTrackSourceInterface> source =
+      static_cast<webrtc::VideoTrackInterface*>(track.get())->GetSource();
+  if (!source) {
+    return false;
+  }
+  // A remote track's source asks its receive stream for a key frame.
+  source->GenerateKeyFrame();
+  return true;
+}
+
+bool RTCRtpReceiverImpl::SetDecodeOnDemand(bool enabled) {
+  if (rtp_receiver_->media_type() != webrtc::MediaType::VIDEO) {
+    return false;
+  }
+  bool install = false;
+  webrtc::scoped_refptr<EncodedFrameTap> tap =
+      FindEncodedFrameTap(rtp_receiver_.get(), enabled, &install);
+  if (!tap) {
+    return true;
+  }
+  webrtc::scoped_refptr<webrtc::MediaStreamTrackInterface> track =
+      rtp_receiver_->track();
+  tap->SetDecodeOnDemand(
+      enabled, webrtc::scoped_refptr<webrtc::VideoTrackInterface>(
+                   static_cast<webrtc::VideoTrackInterface*>(track.get())));
+  if (install) {
+    rtp_receiver_->SetDepacketizerToDecoderFrameTransformer(tap);
+  }
+  return true;
+}
+
+RTCDecodeOnDemandStats RTCRtpReceiverImpl::GetDecodeOnDemandStats() {
+  bool install = false;
+  webrtc::scoped_refptr<EncodedFrameTap> tap =
+      FindEncodedFrameTap(rtp_receiver_.get(), false, &install);
+  if (!tap) {
+    return RTCDecodeOnDemandStats();
+  }
+  return tap->GetDecodeOnDemandStats();
+}
+
 }  // namespace lumenrtc_bridge
@@ -4,6 +4,7 @@
 #include "api/media_types.h"
 #include "api/rtp_receiver_interface.h"
 #include "rtc_rtp_receiver.h"
+#include "src/internal/encoded_frame_forwarding.h"
 
 namespace lumenrtc_bridge {
 class RTCRtpReceiverImpl : public RTCRtpReceiver,
@@ -23,6 +24,11 @@ class RTCRtpReceiverImpl : public RTCRtpReceiver,
       scoped_refptr<RTCRtpParameters> parameters) override;
   virtual void SetObserver(RTCRtpReceiverObserver* observer) override;
   virtual void SetJitterBufferMinimumDelay(double delay_seconds) override;
+  virtual void SetEncodedFrameObserver(
+      RTCEncodedFrameObserver* observer) override;
+  virtual bool RequestKeyFrame() override;
+  virtual bool SetDecodeOnDemand(bool enabled) override;
+  virtual RTCDecodeOnDemandStats GetDecodeOnDemandStats() override;
   webrtc::scoped_refptr<webrtc::RtpReceiverInterface> rtp_receiver();
 
  private:
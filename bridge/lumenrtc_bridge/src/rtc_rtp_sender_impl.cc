@@ -1,11 +1,16 @@
 #include "rtc_rtp_sender_impl.h"
 
 #include <cstring>
+#include <map>
+#include <string>
+#include <utility>
 
+#include "absl/strings/ascii.h"
 #include "base/refcountedobject.h"
 #include "rtc_audio_track_impl.h"
 #include "rtc_dtls_transport_impl.h"
 #include "rtc_dtmf_sender_impl.h"
+#include "rtc_encoded_frame_impl.h"
 #include "rtc_rtp_parameters_impl.h"
 #include "rtc_video_track_impl.h"
 
@@ -134,4 +139,70 @@ scoped_refptr<RTCDtmfSender> RTCRtpSenderImpl::dtmf_sender() const {
   return new RefCountedObject<RTCDtmfSenderImpl>(dtmf_sender);
 }
 
+bool RTCRtpSenderImpl::SetEncodedFrameInput(bool enabled) {
+  // The first payload type of a codec is the preferred one.
+  std::map<std::string, uint8_t> payload_types;
+  if (enabled) {
+    for (const auto& codec : rtp_sender_->GetParameters().codecs) {
+      payload_types.emplace(absl::AsciiStrToLower(codec.mime_type()),
+                            static_cast<uint8_t>(codec.payload_type));
+    }
+    if (payload_types.empty()) {
+      return false;
+    }
+  }
+  bool install = false;
+  webrtc::scoped_refptr<EncodedFrameInjector> injector =
+      FindEncodedFrameInjector(rtp_sender_.get(), enabled, &install);
+  if (!injector) {
+    return true;
+  }
+  {
+    std::lock_guard<std::mutex> lock(frame_injector_mutex_);
+    frame_injector_ = injector;
+  }
+  if (!enabled) {
+    injector->Disable();
+    return true;
+  }
+  injector->Enable(std::move(payload_types));
+  if (install) {
+    rtp_sender_->SetEncoderToPacketizerFrameTransformer(injector);
+  }
+  return true;
+}
+
+webrtc::scoped_refptr<EncodedFrameInjector>
+RTCRtpSenderImpl::frame_injector() {
+  std::lock_guard<std::mutex> lock(frame_injector_mutex_);
+  if (!frame_injector_) {
+    bool created = false;
+    frame_injector_ =
+        FindEncodedFrameInjector(rtp_sender_.get(), false, &created);
+  }
+  return frame_injector_;
+}
+
+bool RTCRtpSenderImpl::SendEncodedFrame(scoped_refptr<RTCEncodedFrame> frame) {
+  if (!frame) {
+    return false;
+  }
+  webrtc::scoped_refptr<EncodedFrameInjector> injector = frame_injector();
+  return injector &&
+         injector->Send(static_cast<RTCEncodedFrameImpl*>(frame.get()));
+}
+
+bool RTCRtpSenderImpl::SendEncodedAudio(const string mime_type,
+                                        const uint8_t* data, size_t size,
+                                        uint32_t rtp_timestamp) {
+  if (!data || size == 0) {
+    return false;
+  }
+  webrtc::scoped_refptr<EncodedFrameInjector> injector = frame_injector();
+  return injector && injector->SendAudio(to_std_string(mime_type),
+                                         webrtc::ArrayView<const uint8_t>(
+                                             data, size),
+                                         rtp_timestamp);
+}
+
 }  // namespace lumenrtc_bridge
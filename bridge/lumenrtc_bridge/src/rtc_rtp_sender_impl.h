@@ -1,9 +1,12 @@
 #ifndef LUMENRTC_BRIDGE_RTC_RTP_SENDER_IMPL_HXX
 #define LUMENRTC_BRIDGE_RTC_RTP_SENDER_IMPL_HXX
 
+#include <mutex>
+
 #include "api/rtp_sender_interface.h"
 #include "api/scoped_refptr.h"
 #include "rtc_rtp_sender.h"
+#include "src/internal/encoded_frame_forwarding.h"
 
 namespace lumenrtc_bridge {
 
@@ -25,13 +28,22 @@ class RTCRtpSenderImpl : public RTCRtpSender {
   virtual bool set_parameters(
       const scoped_refptr<RTCRtpParameters> parameters) override;
   virtual scoped_refptr<RTCDtmfSender> dtmf_sender() const override;
+  virtual bool SetEncodedFrameInput(bool enabled) override;
+  virtual bool SendEncodedFrame(scoped_refptr<RTCEncodedFrame> frame) override;
+  virtual bool SendEncodedAudio(const string mime_type, const uint8_t* data,
+                                size_t size, uint32_t rtp_timestamp) override;
 
   webrtc::scoped_refptr<webrtc::RtpSenderInterface> rtc_rtp_sender() {
     return rtp_sender_;
   }
 
  private:
+  webrtc::scoped_refptr<EncodedFrameInjector> frame_injector();
+
   webrtc::scoped_refptr<webrtc::RtpSenderInterface> rtp_sender_;
+  // Cached from FindEncodedFrameInjector(); shared with other wrappers.
+  std::mutex frame_injector_mutex_;
+  webrtc::scoped_refptr<EncodedFrameInjector> frame_injector_;
 };
 }  // namespace lumenrtc_bridge
 
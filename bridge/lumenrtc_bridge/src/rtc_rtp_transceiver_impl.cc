@@ -6,6 +6,7 @@
 #include <src/rtc_rtp_sender_impl.h>
 
 #include <sstream>
+#include <utility>
 
 namespace lumenrtc_bridge {
 
@@ -69,8 +70,10 @@ void RTCRtpTransceiverInitImpl::set_send_encodings(
 }
 
 RTCRtpTransceiverImpl::RTCRtpTransceiverImpl(
-    webrtc::scoped_refptr<webrtc::RtpTransceiverInterface> rtp_transceiver)
-    : rtp_transceiver_(rtp_transceiver) {}
+    webrtc::scoped_refptr<webrtc::RtpTransceiverInterface> rtp_transceiver,
+    webrtc::scoped_refptr<RtpEndpointWrappers> endpoint_wrappers)
+    : rtp_transceiver_(rtp_transceiver),
+      endpoint_wrappers_(std::move(endpoint_wrappers)) {}
 
 webrtc::scoped_refptr<webrtc::RtpTransceiverInterface>
 lumenrtc_bridge::RTCRtpTransceiverImpl::rtp_transceiver() {
@@ -81,6 +84,9 @@ scoped_refptr<RTCRtpSender> RTCRtpTransceiverImpl::sender() const {
   if (nullptr == rtp_transceiver_->sender().get()) {
     return scoped_refptr<RTCRtpSender>();
   }
+  if (endpoint_wrappers_) {
+    return endpoint_wrappers_->senders.Get(rtp_transceiver_->sender());
+  }
   return new RefCountedObject<RTCRtpSenderImpl>(rtp_transceiver_->sender());
 }
 
@@ -88,6 +94,9 @@ scoped_refptr<RTCRtpReceiver> RTCRtpTransceiverImpl::receiver() const {
   if (nullptr == rtp_transceiver_->receiver().get()) {
     return scoped_refptr<RTCRtpReceiver>();
   }
+  if (endpoint_wrappers_) {
+    return endpoint_wrappers_->receivers.Get(rtp_transceiver_->receiver());
+  }
   return new RefCountedObject<RTCRtpReceiverImpl>(rtp_transceiver_->receiver());
 }
 
@@ -4,6 +4,7 @@
 #include "api/rtp_transceiver_interface.h"
 #include "api/scoped_refptr.h"
 #include "rtc_rtp_transceiver.h"
+#include "src/internal/rtp_wrapper_cache.h"
 
 namespace lumenrtc_bridge {
 class RTCRtpTransceiverInitImpl : public RTCRtpTransceiverInit {
@@ -31,7 +32,8 @@ class RTCRtpTransceiverInitImpl : public RTCRtpTransceiverInit {
 class RTCRtpTransceiverImpl : public RTCRtpTransceiver {
  public:
   RTCRtpTransceiverImpl(
-      webrtc::scoped_refptr<webrtc::RtpTransceiverInterface> rtp_transceiver);
+      webrtc::scoped_refptr<webrtc::RtpTransceiverInterface> rtp_transceiver,
+      webrtc::scoped_refptr<RtpEndpointWrappers> endpoint_wrappers = nullptr);
 
   virtual RTCMediaType media_type() const override;
   virtual const string mid() const override;
@@ -53,6 +55,8 @@ class RTCRtpTransceiverImpl : public RTCRtpTransceiver {
 
  private:
   webrtc::scoped_refptr<webrtc::RtpTransceiverInterface> rtp_transceiver_;
+  // Those of the peer connection; null for a transceiver wrapped elsewhere.
+  const webrtc::scoped_refptr<RtpEndpointWrappers> endpoint_wrappers_;
 };
 
 }  // namespace lumenrtc_bridge
@@ -0,0 +1,458 @@
+#include "rtc_session_template_impl.h"
+
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "rtc_base/checks.h"
+#include "rtc_base/ssl_fingerprint.h"
+
+namespace lumenrtc_bridge {
+namespace {
+
+// Lines holding values that differ between offers of the same shape.
+constexpr std::string_view kFieldLines[] = {
+    "o=",     "a=ice-ufrag:", "a=ice-pwd:",      "a=fingerprint:",
+    "a=ssrc:", "a=ssrc-group:", "a=msid-semantic:", "a=msid:",
+};
+
+constexpr std::string_view kMsidSemanticLine = "a=msid-semantic:";
+
+size_t FieldLinePrefix(std::string_view line) {
+  for (std::string_view prefix : kFieldLines) {
+    if (line.substr(0, prefix.size()) == prefix) {
+      return prefix.size();
+    }
+  }
+  return 0;
+}
+
+// Per-connection values in a fixed order, so offers of one shape line up.
+std::vector<std::string> CollectFields(
+    const webrtc::SessionDescriptionInterface& offer) {
+  std::vector<std::string> fields;
+  fields.push_back(offer.session_id());
+  fields.push_back(offer.session_version());
+  const webrtc::SessionDescription* desc = offer.description();
+  for (const webrtc::TransportInfo& info : desc->transport_infos()) {
+    const webrtc::TransportDescription& transport = info.description;
+    fields.push_back(transport.ice_ufrag);
+    fields.push_back(transport.ice_pwd);
+    fields.push_back(transport.identity_fingerprint
+                         ? transport.identity_fingerprint->GetRfc4572Fingerprint()
+                         : std::string());
+  }
+  for (const webrtc::ContentInfo& content : desc->contents()) {
+    const webrtc::MediaContentDescription* media = content.media_description();
+    if (!media) {
+      continue;
+    }
+    for (const webrtc::StreamParams& stream : media->streams()) {
+      for (uint32_t ssrc : stream.ssrcs) {
+        fields.push_back(std::to_string(ssrc));
+      }
+      fields.push_back(stream.cname);
+      fields.push_back(stream.id);
+      for (const std::string& stream_id : stream.stream_ids()) {
+        fields.push_back(stream_id);
+      }
+    }
+  }
+  return fields;
+}
+
+// For each field, the first field with the same value, or kEmptyField.
+// The serializer collapses equal stream ids and drops lines for empty
+// values, so a template only fits offers whose values repeat the same way.
+constexpr size_t kEmptyField = static_cast<size_t>(-1);
+
+std::vector<size_t> Aliases(const std::vector<std::string>& fields) {
+  std::unordered_map<std::string_view, size_t> first;
+  std::vector<size_t> aliases;
+  aliases.reserve(fields.size());
+  for (size_t i = 0; i < fields.size(); ++i) {
+    aliases.push_back(fields[i].empty()
+                          ? kEmptyField
+                          : first.emplace(fields[i], i).first->second);
+  }
+  return aliases;
+}
+
+// Stand-ins for the per-connection values, unique within the serialized
+// text. Equal values share one. SSRCs need numbers; nothing else on the
+// field lines is a ten-digit number or looks like "slot<n>x".
+constexpr uint32_t kMarkerSsrcBase = 4000000000u;
+
+std::string StringMarker(size_t field) {
+  return "slot" + std::to_string(field) + "x";
+}
+
+// Replaces each non-empty field of |desc| with the marker of its alias,
+// visiting fields in CollectFields() order, and returns the markers by field
+// index. The first two fields, session id and version, belong to the JSEP
+// wrapper and are marked by the caller.
+std::vector<std::string> MarkFields(webrtc::SessionDescription* desc,
+                                    const std::vector<size_t>& aliases) {
+  std::vector<std::string> markers(aliases.size());
+  size_t field = 2;
+  auto mark_string = [&](std::string* value) {
+    if (aliases[field] != kEmptyField) {
+      markers[field] = StringMarker(aliases[field]);
+      *value = markers[field];
+    }
+    ++field;
+  };
+  for (webrtc::TransportInfo& info : desc->transport_infos()) {
+    webrtc::TransportDescription& transport = info.description;
+    mark_string(&transport.ice_ufrag);
+    mark_string(&transport.ice_pwd);
+    if (transport.identity_fingerprint) {
+      // Same algorithm and length, so the line keeps its shape.
+      std::vector<uint8_t> digest(
+          transport.identity_fingerprint->digest.size(), 0xA5);
+      if (digest.size() >= 2) {
+        digest[digest.size() - 2] = static_cast<uint8_t>(aliases[field] >> 8);
+        digest[digest.size() - 1] = static_cast<uint8_t>(aliases[field]);
+      }
+      transport.identity_fingerprint = std::make_unique<webrtc::SSLFingerprint>(
+          transport.identity_fingerprint->algorithm, digest);
+      markers[field] = transport.identity_fingerprint->GetRfc4572Fingerprint();
+    }
+    ++field;
+  }
+  for (webrtc::ContentInfo& content : desc->contents()) {
+    webrtc::MediaContentDescription* media = content.media_description();
+    if (!media) {
+      continue;
+    }
+    for (webrtc::StreamParams& stream : media->mutable_streams()) {
+      std::unordered_map<uint32_t, uint32_t> ssrc_markers;
+      for (uint32_t& ssrc : stream.ssrcs) {
+        const uint32_t marker =
+            kMarkerSsrcBase + static_cast<uint32_t>(aliases[field]);
+        ssrc_markers[ssrc] = marker;
+        markers[field] = std::to_string(marker);
+        ssrc = marker;
+        ++field;
+      }
+      for (webrtc::SsrcGroup& group : stream.ssrc_groups) {
+        for (uint32_t& ssrc : group.ssrcs) {
+          auto it = ssrc_markers.find(ssrc);
+          if (it != ssrc_markers.end()) {
+            ssrc = it->second;
+          }
+        }
+      }
+      mark_string(&stream.cname);
+      mark_string(&stream.id);
+      std::vector<std::string> stream_ids = stream.stream_ids();
+      for (std::string& stream_id : stream_ids) {
+        mark_string(&stream_id);
+      }
+      stream.set_stream_ids(stream_ids);
+    }
+  }
+  RTC_DCHECK_EQ(field, aliases.size());
+  return markers;
+}
+
+bool HasCandidates(const webrtc::SessionDescriptionInterface& offer) {
+  for (size_t i = 0; i < offer.number_of_mediasections(); ++i) {
+    const webrtc::IceCandidateCollection* candidates = offer.candidates(i);
+    if (candidates && candidates->count() > 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool SameRids(const std::vector<webrtc::RidDescription>& a,
+              const std::vector<webrtc::RidDescription>& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i].rid != b[i].rid || a[i].direction != b[i].direction ||
+        a[i].payload_types != b[i].payload_types ||
+        a[i].restrictions != b[i].restrictions) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SameLayers(const webrtc::SimulcastLayerList& a,
+                const webrtc::SimulcastLayerList& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  auto alternatives_b = b.begin();
+  for (const std::vector<webrtc::SimulcastLayer>& alternatives_a : a) {
+    if (!(alternatives_a == *alternatives_b)) {
+      return false;
+    }
+    ++alternatives_b;
+  }
+  return true;
+}
+
+bool SameSimulcast(const webrtc::SimulcastDescription& a,
+                   const webrtc::SimulcastDescription& b) {
+  return SameLayers(a.send_layers(), b.send_layers()) &&
+         SameLayers(a.receive_layers(), b.receive_layers());
+}
+
+bool SameStreams(const webrtc::StreamParamsVec& a,
+                 const webrtc::StreamParamsVec& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i].ssrcs.size() != b[i].ssrcs.size() ||
+        a[i].stream_ids().size() != b[i].stream_ids().size() ||
+        a[i].ssrc_groups.size() != b[i].ssrc_groups.size() ||
+        !SameRids(a[i].rids(), b[i].rids())) {
+      return false;
+    }
+    for (size_t g = 0; g < a[i].ssrc_groups.size(); ++g) {
+      if (a[i].ssrc_groups[g].semantics != b[i].ssrc_groups[g].semantics ||
+          a[i].ssrc_groups[g].ssrcs.size() !=
+              b[i].ssrc_groups[g].ssrcs.size()) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SameMedia(const webrtc::MediaContentDescription& a,
+               const webrtc::MediaContentDescription& b) {
+  if (a.type() != b.type() || a.direction() != b.direction() ||
+      a.protocol() != b.protocol() || a.rtcp_mux() != b.rtcp_mux() ||
+      a.rtcp_reduced_size() != b.rtcp_reduced_size() ||
+      a.remote_estimate() != b.remote_estimate() ||
+      a.conference_mode() != b.conference_mode() ||
+      a.bandwidth() != b.bandwidth() ||
+      a.bandwidth_type() != b.bandwidth_type() ||
+      a.connection_address() != b.connection_address() ||
+      a.extmap_allow_mixed_enum() != b.extmap_allow_mixed_enum() ||
+      a.HasSimulcast() != b.HasSimulcast() ||
+      !SameSimulcast(a.simulcast_description(), b.simulcast_description()) ||
+      !SameRids(a.receive_rids(), b.receive_rids()) ||
+      !(a.codecs() == b.codecs()) ||
+      !(a.rtp_header_extensions() == b.rtp_header_extensions()) ||
+      !SameStreams(a.streams(), b.streams())) {
+    return false;
+  }
+  const webrtc::SctpDataContentDescription* sctp_a = a.as_sctp();
+  const webrtc::SctpDataContentDescription* sctp_b = b.as_sctp();
+  if ((sctp_a == nullptr) != (sctp_b == nullptr)) {
+    return false;
+  }
+  return !sctp_a || (sctp_a->port() == sctp_b->port() &&
+                     sctp_a->max_message_size() == sctp_b->max_message_size());
+}
+
+// Everything serialized from |a| and |b| except the per-connection fields.
+bool SameShape(const webrtc::SessionDescription& a,
+               const webrtc::SessionDescription& b) {
+  if (a.contents().size() != b.contents().size() ||
+      a.transport_infos().size() != b.transport_infos().size() ||
+      a.groups().size() != b.groups().size() ||
+      a.msid_signaling() != b.msid_signaling() ||
+      a.extmap_allow_mixed() != b.extmap_allow_mixed()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.groups().size(); ++i) {
+    if (a.groups()[i].semantics() != b.groups()[i].semantics() ||
+        a.groups()[i].content_names() != b.groups()[i].content_names()) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < a.contents().size(); ++i) {
+    const webrtc::ContentInfo& content_a = a.contents()[i];
+    const webrtc::ContentInfo& content_b = b.contents()[i];
+    if (content_a.mid() != content_b.mid() ||
+        content_a.type != content_b.type ||
+        content_a.rejected != content_b.rejected ||
+        content_a.bundle_only != content_b.bundle_only) {
+      return false;
+    }
+    const webrtc::MediaContentDescription* media_a =
+        content_a.media_description();
+    const webrtc::MediaContentDescription* media_b =
+        content_b.media_description();
+    if ((media_a == nullptr) != (media_b == nullptr) ||
+        (media_a && !SameMedia(*media_a, *media_b))) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < a.transport_infos().size(); ++i) {
+    const webrtc::TransportInfo& info_a = a.transport_infos()[i];
+    const webrtc::TransportInfo& info_b = b.transport_infos()[i];
+    const webrtc::TransportDescription& transport_a = info_a.description;
+    const webrtc::TransportDescription& transport_b = info_b.description;
+    if (info_a.content_name != info_b.content_name ||
+        transport_a.transport_options != transport_b.transport_options ||
+        transport_a.ice_mode != transport_b.ice_mode ||
+        transport_a.connection_role != transport_b.connection_role ||
+        (transport_a.identity_fingerprint == nullptr) !=
+            (transport_b.identity_fingerprint == nullptr) ||
+        (transport_a.identity_fingerprint &&
+         transport_a.identity_fingerprint->algorithm !=
+             transport_b.identity_fingerprint->algorithm)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+scoped_refptr<RTCSessionTemplate> RTCSessionTemplate::Create() {
+  scoped_refptr<RTCSessionTemplateImpl> session_template =
+      scoped_refptr<RTCSessionTemplateImpl>(
+          new RefCountedObject<RTCSessionTemplateImpl>());
+  return session_template;
+}
+
+std::string RTCSessionTemplateImpl::Render(
+    const webrtc::SessionDescriptionInterface& offer) {
+  std::vector<std::string> fields = CollectFields(offer);
+  // Candidates change the m= and c= lines and add lines of their own.
+  const bool has_candidates = HasCandidates(offer);
+  if (!has_candidates) {
+    webrtc::MutexLock lock(&mutex_);
+    bool hit = shape_ && aliases_ == Aliases(fields) &&
+               SameShape(*shape_, *offer.description());
+    for (size_t i = 1; hit && i < slots_.size(); ++i) {
+      hit = !slots_[i].ascending ||
+            fields[slots_[i - 1].field] < fields[slots_[i].field];
+    }
+    if (hit) {
+      std::string sdp;
+      sdp.reserve(text_.size() + 64);
+      size_t copied = 0;
+      for (const Slot& slot : slots_) {
+        sdp.append(text_, copied, slot.offset - copied);
+        sdp.append(fields[slot.field]);
+        copied = slot.offset + slot.length;
+      }
+      sdp.append(text_, copied, std::string::npos);
+      hits_.fetch_add(1, std::memory_order_relaxed);
+#if RTC_DCHECK_IS_ON
+      std::string serialized;
+      offer.ToString(&serialized);
+      RTC_DCHECK_EQ(serialized, sdp);
+#endif
+      return sdp;
+    }
+  }
+
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  std::string sdp;
+  offer.ToString(&sdp);
+  if (!has_candidates) {
+    webrtc::MutexLock lock(&mutex_);
+    Rebuild(offer, fields);
+  }
+  return sdp;
+}
+
+void RTCSessionTemplateImpl::Rebuild(
+    const webrtc::SessionDescriptionInterface& offer,
+    const std::vector<std::string>& fields) {
+  // Serialize a copy with every per-connection value replaced by a marker
+  // and record where the markers land. Misses pay for a second
+  // serialization; in exchange a slot can never be taken from a value that
+  // happens to equal some other token.
+  std::unique_ptr<webrtc::SessionDescription> marked_desc =
+      offer.description()->Clone();
+  std::vector<size_t> aliases = Aliases(fields);
+  std::vector<std::string> markers = MarkFields(marked_desc.get(), aliases);
+  for (size_t i = 0; i < 2; ++i) {
+    markers[i] =
+        aliases[i] == kEmptyField ? std::string() : StringMarker(aliases[i]);
+  }
+  std::unique_ptr<webrtc::SessionDescriptionInterface> marked =
+      webrtc::CreateSessionDescription(offer.GetType(), markers[0],
+                                       markers[1], std::move(marked_desc));
+  std::string sdp;
+  if (!marked || !marked->ToString(&sdp)) {
+    shape_ = nullptr;
+    aliases_.clear();
+    text_.clear();
+    slots_.clear();
+    return;
+  }
+
+  std::unordered_map<std::string_view, size_t> marker_index;
+  for (size_t i = 0; i < markers.size(); ++i) {
+    if (!markers[i].empty()) {
+      marker_index.emplace(markers[i], i);
+    }
+  }
+
+  // Markers are whole space-separated tokens of their lines, or follow the
+  // first ':' of one ("cname:<cname>", "msid:<stream>").
+  std::vector<Slot> slots;
+  size_t line_start = 0;
+  while (line_start < sdp.size()) {
+    size_t line_end = sdp.find("\r\n", line_start);
+    if (line_end == std::string::npos) {
+      line_end = sdp.size();
+    }
+    std::string_view line(sdp.data() + line_start, line_end - line_start);
+    // The serializer lists msid-semantic stream ids as a sorted set.
+    const bool sorted = line.substr(0, kMsidSemanticLine.size()) ==
+                        kMsidSemanticLine;
+    bool first_on_line = true;
+    size_t pos = FieldLinePrefix(line);
+    while (pos > 0 && pos < line.size()) {
+      size_t end = line.find(' ', pos);
+      if (end == std::string_view::npos) {
+        end = line.size();
+      }
+      std::string_view token = line.substr(pos, end - pos);
+      size_t skip = 0;
+      auto it = marker_index.find(token);
+      if (it == marker_index.end()) {
+        skip = token.find(':');
+        skip = skip == std::string_view::npos ? token.size() : skip + 1;
+        it = marker_index.find(token.substr(skip));
+      }
+      if (it != marker_index.end() && skip < token.size()) {
+        slots.push_back({line_start + pos + skip, token.size() - skip,
+                         it->second, sorted && !first_on_line});
+        first_on_line = false;
+      }
+      pos = end + 1;
+    }
+    line_start = line_end + 2;
+  }
+
+  shape_ = offer.description()->Clone();
+  aliases_ = std::move(aliases);
+  text_ = std::move(sdp);
+  slots_ = std::move(slots);
+}
+
+RTCSessionTemplateStats RTCSessionTemplateImpl::GetStats() {
+  RTCSessionTemplateStats stats;
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  webrtc::MutexLock lock(&mutex_);
+  stats.template_size = static_cast<uint32_t>(text_.size());
+  return stats;
+}
+
+void RTCSessionTemplateImpl::Reset() {
+  webrtc::MutexLock lock(&mutex_);
+  shape_ = nullptr;
+  aliases_.clear();
+  text_.clear();
+  slots_.clear();
+}
+
+}  // namespace lumenrtc_bridge
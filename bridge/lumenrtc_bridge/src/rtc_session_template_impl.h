@@ -0,0 +1,57 @@
+#ifndef LUMENRTC_BRIDGE_RTC_SESSION_TEMPLATE_IMPL_HXX
+#define LUMENRTC_BRIDGE_RTC_SESSION_TEMPLATE_IMPL_HXX
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "api/jsep.h"
+#include "pc/session_description.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread_annotations.h"
+#include "rtc_session_template.h"
+
+namespace lumenrtc_bridge {
+
+class RTCSessionTemplateImpl : public RTCSessionTemplate {
+ public:
+  RTCSessionTemplateImpl() {}
+  virtual ~RTCSessionTemplateImpl() {}
+
+  // Serializes |offer|, from the cached text when it has the cached shape.
+  std::string Render(const webrtc::SessionDescriptionInterface& offer);
+
+  RTCSessionTemplateStats GetStats() override;
+
+  void Reset() override;
+
+ private:
+  // Position of a per-connection value in |text_|; |field| indexes the list
+  // built by CollectFields(). |ascending| marks a value the serializer sorts
+  // after the previous slot's, as on the msid-semantic line.
+  struct Slot {
+    size_t offset;
+    size_t length;
+    size_t field;
+    bool ascending;
+  };
+
+  void Rebuild(const webrtc::SessionDescriptionInterface& offer,
+               const std::vector<std::string>& fields)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  webrtc::Mutex mutex_;
+  // Copy of the description |text_| was serialized from, compared by shape.
+  std::unique_ptr<webrtc::SessionDescription> shape_ RTC_GUARDED_BY(mutex_);
+  // For each field, the first field with the same value; see Aliases().
+  std::vector<size_t> aliases_ RTC_GUARDED_BY(mutex_);
+  std::string text_ RTC_GUARDED_BY(mutex_);
+  std::vector<Slot> slots_ RTC_GUARDED_BY(mutex_);
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
+};
+
+}  // namespace lumenrtc_bridge
+
+#endif  // LUMENRTC_BRIDGE_RTC_SESSION_TEMPLATE_IMPL_HXX
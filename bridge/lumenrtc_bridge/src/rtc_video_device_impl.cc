@@ -1,9 +1,36 @@
 #include "rtc_video_device_impl.h"
 
+#include <string>
+
 #include "modules/video_capture/video_capture_factory.h"
 
 namespace lumenrtc_bridge {
 
+void RTCVideoCapturerImpl::StartCaptureAsync(OnCaptureStarted callback) {
+  if (!thread_) {
+    callback(StartCapture());
+    return;
+  }
+  // VcmCapturer blocks on the worker thread; calling it there runs inline.
+  thread_->PostTask(
+      [self = scoped_refptr<RTCVideoCapturerImpl>(this), callback]() mutable {
+        callback(self->StartCapture());
+      });
+}
+
+void RTCVideoCapturerImpl::StopCaptureAsync(OnCaptureStopped callback) {
+  if (!thread_) {
+    StopCapture();
+    callback();
+    return;
+  }
+  thread_->PostTask(
+      [self = scoped_refptr<RTCVideoCapturerImpl>(this), callback]() mutable {
+        self->StopCapture();
+        callback();
+      });
+}
+
 RTCVideoDeviceImpl::RTCVideoDeviceImpl(webrtc::Thread* worker_thread)
     : device_info_(webrtc::VideoCaptureFactory::CreateDeviceInfo()),
       worker_thread_(worker_thread) {}
@@ -45,7 +72,23 @@ scoped_refptr<RTCVideoCapturer> RTCVideoDeviceImpl::Create(const char* name,
     return nullptr;
   }
 
-  return new RefCountedObject<RTCVideoCapturerImpl>(vcm);
+  return new RefCountedObject<RTCVideoCapturerImpl>(vcm, worker_thread_);
+}
+
+bool RTCVideoDeviceImpl::CreateAsync(const char* name, uint32_t index,
+                                     size_t width, size_t height,
+                                     size_t target_fps,
+                                     OnVideoCapturerCreated callback) {
+  if (!worker_thread_) {
+    return false;
+  }
+  worker_thread_->PostTask(
+      [self = scoped_refptr<RTCVideoDeviceImpl>(this),
+       name = std::string(name ? name : ""), index, width, height, target_fps,
+       callback]() mutable {
+        callback(self->Create(name.c_str(), index, width, height, target_fps));
+      });
+  return true;
 }
 
 }  // namespace lumenrtc_bridge
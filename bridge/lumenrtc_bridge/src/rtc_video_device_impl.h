@@ -13,9 +13,11 @@ namespace lumenrtc_bridge {
 
 class RTCVideoCapturerImpl : public RTCVideoCapturer {
  public:
+  // Async start and stop run on |thread|, or synchronously without one.
   RTCVideoCapturerImpl(
-      std::shared_ptr<webrtc::internal::VideoCapturer> video_capturer)
-      : video_capturer_(video_capturer) {}
+      std::shared_ptr<webrtc::internal::VideoCapturer> video_capturer,
+      webrtc::Thread* thread = nullptr)
+      : video_capturer_(video_capturer), thread_(thread) {}
   std::shared_ptr<webrtc::internal::VideoCapturer> video_capturer() {
     return video_capturer_;
   }
@@ -32,8 +34,13 @@ class RTCVideoCapturerImpl : public RTCVideoCapturer {
     if (video_capturer_ != nullptr) video_capturer_->StopCapture();
   }
 
+  void StartCaptureAsync(OnCaptureStarted callback) override;
+
+  void StopCaptureAsync(OnCaptureStopped callback) override;
+
  private:
   std::shared_ptr<webrtc::internal::VideoCapturer> video_capturer_;
+  webrtc::Thread* thread_ = nullptr;
 };
 
 class RTCVideoDeviceImpl : public RTCVideoDevice {
@@ -53,6 +60,10 @@ class RTCVideoDeviceImpl : public RTCVideoDevice {
                                          size_t width, size_t height,
                                          size_t target_fps) override;
 
+  bool CreateAsync(const char* name, uint32_t index, size_t width,
+                   size_t height, size_t target_fps,
+                   OnVideoCapturerCreated callback) override;
+
  private:
   std::unique_ptr<webrtc::VideoCaptureModule::DeviceInfo> device_info_;
   webrtc::Thread* worker_thread_ = nullptr;
@@ -8,20 +8,42 @@
 
 namespace lumenrtc_bridge {
 
+namespace {
+
+// The plane accessors read I420 and NV12 buffers directly. Anything else,
+// such as a texture or an encoded unit, is converted once here so that its
+// planes stay readable.
+webrtc::scoped_refptr<webrtc::VideoFrameBuffer> ReadableBuffer(
+    webrtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer) {
+  if (buffer->GetI420() || buffer->GetNV12()) {
+    return buffer;
+  }
+  webrtc::scoped_refptr<webrtc::VideoFrameBuffer> i420 = buffer->ToI420();
+  return i420 ? i420 : buffer;
+}
+
+}  // namespace
+
 VideoFrameBufferImpl::VideoFrameBufferImpl(
     webrtc::scoped_refptr<webrtc::VideoFrameBuffer> frame_buffer)
-    : buffer_(frame_buffer) {}
+    : buffer_(ReadableBuffer(frame_buffer)) {}
 
 VideoFrameBufferImpl::VideoFrameBufferImpl(
     webrtc::scoped_refptr<webrtc::I420Buffer> frame_buffer)
     : buffer_(frame_buffer) {}
 
+VideoFrameBufferImpl::VideoFrameBufferImpl(
+    webrtc::scoped_refptr<PackedVideoFrameBuffer> frame_buffer)
+    : buffer_(frame_buffer), packed_(frame_buffer.get()) {}
+
 VideoFrameBufferImpl::~VideoFrameBufferImpl() {}
 
 scoped_refptr<RTCVideoFrame> VideoFrameBufferImpl::Copy() {
   scoped_refptr<VideoFrameBufferImpl> frame =
       scoped_refptr<VideoFrameBufferImpl>(
-          new RefCountedObject<VideoFrameBufferImpl>(buffer_));
+          packed_ ? new RefCountedObject<VideoFrameBufferImpl>(
+                        webrtc::scoped_refptr<PackedVideoFrameBuffer>(packed_))
+                  : new RefCountedObject<VideoFrameBufferImpl>(buffer_));
   return frame;
 }
 
@@ -29,35 +51,88 @@ int VideoFrameBufferImpl::width() const { return buffer_->width(); }
 
 int VideoFrameBufferImpl::height() const { return buffer_->height(); }
 
+RTCVideoPixelFormat VideoFrameBufferImpl::format() const {
+  if (packed_) {
+    return packed_->format();
+  }
+  switch (buffer_->type()) {
+    case webrtc::VideoFrameBuffer::Type::kI420:
+    case webrtc::VideoFrameBuffer::Type::kI420A:
+      return RTCVideoPixelFormat::kI420;
+    case webrtc::VideoFrameBuffer::Type::kNV12:
+      return RTCVideoPixelFormat::kNV12;
+    default:
+      return RTCVideoPixelFormat::kNative;
+  }
+}
+
 const uint8_t* VideoFrameBufferImpl::DataY() const {
-  return buffer_->GetI420()->DataY();
+  if (packed_) {
+    return packed_->data();
+  }
+  if (const webrtc::NV12BufferInterface* nv12 = buffer_->GetNV12()) {
+    return nv12->DataY();
+  }
+  const webrtc::I420BufferInterface* i420 = buffer_->GetI420();
+  return i420 ? i420->DataY() : nullptr;
 }
 
 const uint8_t* VideoFrameBufferImpl::DataU() const {
-  return buffer_->GetI420()->DataU();
+  if (packed_) {
+    return nullptr;
+  }
+  if (const webrtc::NV12BufferInterface* nv12 = buffer_->GetNV12()) {
+    return nv12->DataUV();
+  }
+  const webrtc::I420BufferInterface* i420 = buffer_->GetI420();
+  return i420 ? i420->DataU() : nullptr;
 }
 
 const uint8_t* VideoFrameBufferImpl::DataV() const {
-  return buffer_->GetI420()->DataV();
+  const webrtc::I420BufferInterface* i420 =
+      packed_ ? nullptr : buffer_->GetI420();
+  return i420 ? i420->DataV() : nullptr;
 }
 
 int VideoFrameBufferImpl::StrideY() const {
-  return buffer_->GetI420()->StrideY();
+  if (packed_) {
+    return packed_->stride();
+  }
+  if (const webrtc::NV12BufferInterface* nv12 = buffer_->GetNV12()) {
+    return nv12->StrideY();
+  }
+  const webrtc::I420BufferInterface* i420 = buffer_->GetI420();
+  return i420 ? i420->StrideY() : 0;
 }
 
 int VideoFrameBufferImpl::StrideU() const {
-  return buffer_->GetI420()->StrideU();
+  if (packed_) {
+    return 0;
+  }
+  if (const webrtc::NV12BufferInterface* nv12 = buffer_->GetNV12()) {
+    return nv12->StrideUV();
+  }
+  const webrtc::I420BufferInterface* i420 = buffer_->GetI420();
+  return i420 ? i420->StrideU() : 0;
 }
 
 int VideoFrameBufferImpl::StrideV() const {
-  return buffer_->GetI420()->StrideV();
+  const webrtc::I420BufferInterface* i420 =
+      packed_ ? nullptr : buffer_->GetI420();
+  return i420 ? i420->StrideV() : 0;
 }
 
 int VideoFrameBufferImpl::ConvertToARGB(Type type, uint8_t* dst_buffer,
                                         int dst_stride, int dest_width,
                                         int dest_height) {
+  // Returns |buffer_| itself when it already is I420.
+  webrtc::scoped_refptr<webrtc::I420BufferInterface> source =
+      buffer_->ToI420();
+  if (!source) {
+    return 0;
+  }
   webrtc::scoped_refptr<webrtc::I420Buffer> i420 =
-      webrtc::I420Buffer::Rotate(*buffer_.get(), rotation_);
+      webrtc::I420Buffer::Rotate(*source, rotation_);
 
   webrtc::scoped_refptr<webrtc::I420Buffer> dest =
       webrtc::I420Buffer::Create(dest_width, dest_height);
@@ -6,6 +6,7 @@
 #include "api/video/video_rotation.h"
 #include "common_video/include/video_frame_buffer.h"
 #include "rtc_video_frame.h"
+#include "src/internal/video_conversion_cache.h"
 
 namespace lumenrtc_bridge {
 
@@ -14,6 +15,8 @@ class VideoFrameBufferImpl : public RTCVideoFrame {
   VideoFrameBufferImpl(
       webrtc::scoped_refptr<webrtc::VideoFrameBuffer> frame_buffer);
   VideoFrameBufferImpl(webrtc::scoped_refptr<webrtc::I420Buffer> frame_buffer);
+  VideoFrameBufferImpl(
+      webrtc::scoped_refptr<PackedVideoFrameBuffer> frame_buffer);
 
   virtual ~VideoFrameBufferImpl();
 
@@ -24,6 +27,8 @@ class VideoFrameBufferImpl : public RTCVideoFrame {
 
   int height() const override;
 
+  RTCVideoPixelFormat format() const override;
+
   const uint8_t* DataY() const override;
 
   const uint8_t* DataU() const override;
@@ -42,7 +47,7 @@ class VideoFrameBufferImpl : public RTCVideoFrame {
   webrtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer() { return buffer_; }
 
   // System monotonic clock, same timebase as webrtc::TimeMicros().
-  int64_t timestamp_us() const { return timestamp_us_; }
+  int64_t timestamp_us() const override { return timestamp_us_; }
   void set_timestamp_us(int64_t timestamp_us) { timestamp_us_ = timestamp_us; }
 
   virtual RTCVideoFrame::VideoRotation rotation() override;
@@ -53,6 +58,8 @@ class VideoFrameBufferImpl : public RTCVideoFrame {
 
  private:
   webrtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer_;
+  // |buffer_| again if it holds packed pixels.
+  PackedVideoFrameBuffer* packed_ = nullptr;
   int64_t timestamp_us_ = 0;
   webrtc::VideoRotation rotation_ = webrtc::kVideoRotation_0;
 };
@@ -1,69 +1,218 @@
 #include "rtc_video_sink_adapter.h"
 
 #include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+#include <utility>
 
 #include "rtc_base/logging.h"
+#include "rtc_base/time_utils.h"
+#include "rtc_latency_tracer.h"
 #include "rtc_video_frame_impl.h"
 #include "rtc_video_track.h"
+#include "src/internal/decode_on_demand.h"
 
 namespace lumenrtc_bridge {
 
+namespace {
+
+// Renderers asking for coprime alignments would otherwise make the source
+// crop to absurd multiples.
+constexpr int kMaxResolutionAlignment = 64;
+
+// The size |wants| asks for, or else the largest within its limits with the
+// frame's aspect, up to rounding to the alignment.
+std::pair<int, int> DeliveredSize(int width, int height,
+                                  const RTCVideoSinkWants& wants) {
+  if (wants.width > 0 && wants.height > 0) {
+    return {wants.width, wants.height};
+  }
+  double scale = 1.0;
+  if (wants.max_pixel_count > 0 &&
+      static_cast<int64_t>(width) * height > wants.max_pixel_count) {
+    scale = std::sqrt(static_cast<double>(wants.max_pixel_count) /
+                      (static_cast<double>(width) * height));
+  }
+  const int alignment = std::max(wants.resolution_alignment, 1);
+  const int out_width = static_cast<int>(width * scale) / alignment * alignment;
+  const int out_height =
+      static_cast<int>(height * scale) / alignment * alignment;
+  return {std::clamp(out_width, std::min(alignment, width), width),
+          std::clamp(out_height, std::min(alignment, height), height)};
+}
+
+}  // namespace
+
 VideoSinkAdapter::VideoSinkAdapter(
     webrtc::scoped_refptr<webrtc::VideoTrackInterface> track)
-    : rtc_track_(track), crt_sec_(new webrtc::Mutex()) {
+    : rtc_track_(track),
+      crt_sec_(new webrtc::Mutex()),
+      conversion_cache_(FindVideoConversionCache(track.get())) {
   rtc_track_->AddOrUpdateSink(this, webrtc::VideoSinkWants());
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor " << (void*)this;
 }
 
 VideoSinkAdapter::~VideoSinkAdapter() {
   rtc_track_->RemoveSink(this);
+  for (size_t i = 0; i < renderers_.size(); ++i) {
+    RemoveVideoRenderer(rtc_track_.get());
+  }
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
 
 // VideoSinkInterface implementation
 void VideoSinkAdapter::OnFrame(const webrtc::VideoFrame& video_frame) {
-  std::vector<RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>*> renderers;
+  RTCTraceScope trace(RTCTraceStage::kVideoSinkAdapter, this,
+                      video_frame.timestamp_us());
+  const int64_t timestamp_us = video_frame.timestamp_us();
+  std::vector<Renderer> renderers;
   {
     webrtc::MutexLock cs(crt_sec_.get());
     if (renderers_.empty()) {
       return;
     }
     renderers.reserve(renderers_.size());
-    renderers.insert(renderers.end(), renderers_.begin(), renderers_.end());
+    for (Renderer& entry : renderers_) {
+      if (entry.wants.max_framerate > 0) {
+        const int64_t interval_us =
+            webrtc::kNumMicrosecsPerSec / entry.wants.max_framerate;
+        // A quarter interval of slack absorbs capture jitter.
+        if (timestamp_us < entry.next_frame_us - interval_us / 4) {
+          continue;
+        }
+        // Stepping the schedule keeps the average rate; after a gap it
+        // restarts from this frame.
+        entry.next_frame_us = timestamp_us - entry.next_frame_us > interval_us
+                                  ? timestamp_us + interval_us
+                                  : entry.next_frame_us + interval_us;
+      }
+      renderers.push_back(entry);
+    }
   }
 
-  scoped_refptr<VideoFrameBufferImpl> frame_buffer =
-      scoped_refptr<VideoFrameBufferImpl>(
-          new RefCountedObject<VideoFrameBufferImpl>(
-              video_frame.video_frame_buffer()));
-
-  frame_buffer->set_rotation(video_frame.rotation());
-  frame_buffer->set_timestamp_us(video_frame.timestamp_us());
-
-  for (auto renderer : renderers) {
-    renderer->OnFrame(frame_buffer);
+  webrtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer =
+      video_frame.video_frame_buffer();
+  // Frames made so far, by layout and size; renderers wanting the same share
+  // one.
+  std::vector<std::pair<std::tuple<RTCVideoPixelFormat, int, int>,
+                        scoped_refptr<RTCVideoFrame>>>
+      frames;
+  for (const Renderer& entry : renderers) {
+    const RTCVideoPixelFormat format = entry.wants.format;
+    const std::pair<int, int> size =
+        DeliveredSize(buffer->width(), buffer->height(), entry.wants);
+    const auto key = std::make_tuple(format, size.first, size.second);
+    auto it = std::find_if(
+        frames.begin(), frames.end(),
+        [&key](const auto& frame) { return frame.first == key; });
+    if (it == frames.end()) {
+      scoped_refptr<VideoFrameBufferImpl> frame_buffer;
+      if (format == RTCVideoPixelFormat::kNative &&
+          size.first == buffer->width() && size.second == buffer->height()) {
+        frame_buffer = new RefCountedObject<VideoFrameBufferImpl>(buffer);
+      } else {
+        webrtc::scoped_refptr<webrtc::VideoFrameBuffer> converted =
+            conversion_cache_->Convert(video_frame, format, size.first,
+                                       size.second);
+        if (!converted) {
+          // The renderers still hold every pooled buffer of this size, or
+          // the source cannot be read back.
+          continue;
+        }
+        if (format == RTCVideoPixelFormat::kARGB ||
+            format == RTCVideoPixelFormat::kBGRA) {
+          frame_buffer = new RefCountedObject<VideoFrameBufferImpl>(
+              webrtc::scoped_refptr<PackedVideoFrameBuffer>(
+                  static_cast<PackedVideoFrameBuffer*>(converted.get())));
+        } else {
+          frame_buffer = new RefCountedObject<VideoFrameBufferImpl>(converted);
+        }
+      }
+      frame_buffer->set_rotation(video_frame.rotation());
+      frame_buffer->set_timestamp_us(timestamp_us);
+      it = frames.emplace(frames.end(), key, frame_buffer);
+    }
+    entry.renderer->OnFrame(it->second);
   }
 }
 
 void VideoSinkAdapter::AddRenderer(
     RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer) {
+  AddRenderer(renderer, RTCVideoSinkWants());
+}
+
+void VideoSinkAdapter::AddRenderer(
+    RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer,
+    const RTCVideoSinkWants& wants) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": AddRenderer " << (void*)renderer;
-  webrtc::MutexLock cs(crt_sec_.get());
-  renderers_.push_back(renderer);
+  webrtc::MutexLock wants_lock(&wants_mutex_);
+  {
+    webrtc::MutexLock cs(crt_sec_.get());
+    auto it = std::find_if(
+        renderers_.begin(), renderers_.end(),
+        [renderer](const Renderer& entry) {
+          return entry.renderer == renderer;
+        });
+    if (it != renderers_.end()) {
+      it->wants = wants;
+      it->next_frame_us = 0;
+    } else {
+      renderers_.push_back(Renderer{renderer, wants});
+      AddVideoRenderer(rtc_track_.get());
+    }
+  }
+  UpdateWants();
 }
 
 void VideoSinkAdapter::RemoveRenderer(
     RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": RemoveRenderer " << (void*)renderer;
-  webrtc::MutexLock cs(crt_sec_.get());
-  renderers_.erase(
-      std::remove_if(
-          renderers_.begin(), renderers_.end(),
-          [renderer](
-              const RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer_) {
-            return renderer_ == renderer;
-          }),
-      renderers_.end());
+  webrtc::MutexLock wants_lock(&wants_mutex_);
+  {
+    webrtc::MutexLock cs(crt_sec_.get());
+    auto removed = std::remove_if(
+        renderers_.begin(), renderers_.end(),
+        [renderer](const Renderer& entry) {
+          return entry.renderer == renderer;
+        });
+    if (removed == renderers_.end()) {
+      return;
+    }
+    for (auto it = removed; it != renderers_.end(); ++it) {
+      RemoveVideoRenderer(rtc_track_.get());
+    }
+    renderers_.erase(removed, renderers_.end());
+  }
+  UpdateWants();
+}
+
+void VideoSinkAdapter::UpdateWants() {
+  webrtc::VideoSinkWants wants;
+  {
+    webrtc::MutexLock cs(crt_sec_.get());
+    bool pixels_limited = !renderers_.empty();
+    bool framerate_limited = !renderers_.empty();
+    int max_pixel_count = 0;
+    int max_framerate = 0;
+    for (const Renderer& entry : renderers_) {
+      pixels_limited = pixels_limited && entry.wants.max_pixel_count > 0;
+      framerate_limited = framerate_limited && entry.wants.max_framerate > 0;
+      max_pixel_count = std::max(max_pixel_count, entry.wants.max_pixel_count);
+      max_framerate = std::max(max_framerate, entry.wants.max_framerate);
+      wants.resolution_alignment =
+          std::min(std::lcm(wants.resolution_alignment,
+                            std::max(entry.wants.resolution_alignment, 1)),
+                   kMaxResolutionAlignment);
+    }
+    if (pixels_limited) {
+      wants.max_pixel_count = max_pixel_count;
+    }
+    if (framerate_limited) {
+      wants.max_framerate_fps = max_framerate;
+    }
+  }
+  rtc_track_->AddOrUpdateSink(this, wants);
 }
 
 void VideoSinkAdapter::AddRenderer(
@@ -6,6 +6,7 @@
 #include "rtc_base/synchronization/mutex.h"
 #include "rtc_peerconnection.h"
 #include "rtc_video_frame.h"
+#include "src/internal/video_conversion_cache.h"
 
 namespace lumenrtc_bridge {
 
@@ -18,6 +19,11 @@ class VideoSinkAdapter : public webrtc::VideoSinkInterface<webrtc::VideoFrame>,
   virtual void AddRenderer(
       RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer);
 
+  // Adds |renderer|, or updates its wants if already added.
+  virtual void AddRenderer(
+      RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer,
+      const RTCVideoSinkWants& wants);
+
   virtual void RemoveRenderer(
       RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer);
 
@@ -30,9 +36,26 @@ class VideoSinkAdapter : public webrtc::VideoSinkInterface<webrtc::VideoFrame>,
  protected:
   // VideoSinkInterface implementation
   void OnFrame(const webrtc::VideoFrame& frame) override;
+
+  struct Renderer {
+    RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer;
+    RTCVideoSinkWants wants;
+    // Frames before this are dropped to keep to wants.max_framerate.
+    int64_t next_frame_us = 0;
+  };
+
+  // Tells the track what the renderers together need: a limit applies only
+  // if every renderer has one.
+  void UpdateWants();
+
   webrtc::scoped_refptr<webrtc::VideoTrackInterface> rtc_track_;
   std::unique_ptr<webrtc::Mutex> crt_sec_;
-  std::vector<RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>*> renderers_;
+  std::vector<Renderer> renderers_;
+  // Held across UpdateWants(), which must not run under |crt_sec_|: the
+  // track may block on the thread delivering frames.
+  webrtc::Mutex wants_mutex_;
+  // Shared with the track's other adapters.
+  const webrtc::scoped_refptr<VideoConversionCache> conversion_cache_;
 };
 
 }  // namespace lumenrtc_bridge
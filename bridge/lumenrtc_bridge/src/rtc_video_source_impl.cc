@@ -6,14 +6,109 @@
 
 namespace lumenrtc_bridge {
 
+namespace {
+
+webrtc::internal::CustomVideoSource::ReleaseFunctor MakeReleaseFunctor(
+    RTCVideoSource::FrameReleaseCallback release, void* user_data) {
+  if (!release) {
+    return nullptr;
+  }
+  return [release, user_data]() { release(user_data); };
+}
+
+}  // namespace
+
 RTCVideoSourceImpl::RTCVideoSourceImpl(
     webrtc::scoped_refptr<webrtc::VideoTrackSourceInterface> rtc_source_track)
     : rtc_source_track_(rtc_source_track) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
 }
 
+RTCVideoSourceImpl::RTCVideoSourceImpl(
+    webrtc::scoped_refptr<webrtc::internal::CustomVideoSource> custom_source)
+    : rtc_source_track_(custom_source), custom_source_(custom_source) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor (custom)";
+}
+
+RTCVideoSourceImpl::RTCVideoSourceImpl(
+    webrtc::scoped_refptr<EncodedVideoSource> encoded_source)
+    : rtc_source_track_(encoded_source), encoded_source_(encoded_source) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor (encoded)";
+}
+
 RTCVideoSourceImpl::~RTCVideoSourceImpl() {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
 
+RTCVideoSource::SourceType RTCVideoSourceImpl::GetSourceType() const {
+  if (encoded_source_) {
+    return kEncoded;
+  }
+  return custom_source_ ? kCustom : kCapturer;
+}
+
+bool RTCVideoSourceImpl::PushI420Frame(
+    const uint8_t* data_y, int stride_y, const uint8_t* data_u, int stride_u,
+    const uint8_t* data_v, int stride_v, int width, int height,
+    int64_t timestamp_us, FrameReleaseCallback release, void* user_data) {
+  if (!custom_source_) {
+    return false;
+  }
+  return custom_source_->PushI420(data_y, stride_y, data_u, stride_u, data_v,
+                                  stride_v, width, height, timestamp_us,
+                                  MakeReleaseFunctor(release, user_data));
+}
+
+bool RTCVideoSourceImpl::PushNV12Frame(
+    const uint8_t* data_y, int stride_y, const uint8_t* data_uv,
+    int stride_uv, int width, int height, int64_t timestamp_us,
+    FrameReleaseCallback release, void* user_data) {
+  if (!custom_source_) {
+    return false;
+  }
+  return custom_source_->PushNV12(data_y, stride_y, data_uv, stride_uv, width,
+                                  height, timestamp_us,
+                                  MakeReleaseFunctor(release, user_data));
+}
+
+bool RTCVideoSourceImpl::PushARGBFrame(const uint8_t* data, int stride,
+                                       int width, int height, int type,
+                                       int64_t timestamp_us,
+                                       FrameReleaseCallback release,
+                                       void* user_data) {
+  if (!custom_source_) {
+    return false;
+  }
+  return custom_source_->PushARGB(data, stride, width, height, type,
+                                  timestamp_us,
+                                  MakeReleaseFunctor(release, user_data));
+}
+
+uint64_t RTCVideoSourceImpl::dropped_frames() const {
+  return custom_source_ ? custom_source_->dropped_frames() : 0;
+}
+
+bool RTCVideoSourceImpl::PushEncodedFrame(const uint8_t* data, size_t size,
+                                          int width, int height,
+                                          bool key_frame,
+                                          int64_t timestamp_us) {
+  if (!encoded_source_) {
+    return false;
+  }
+  return encoded_source_->Push(data, size, width, height, key_frame,
+                               timestamp_us);
+}
+
+bool RTCVideoSourceImpl::SetKeyFrameRequestCallback(
+    KeyFrameRequestCallback callback, void* user_data) {
+  if (!encoded_source_) {
+    return false;
+  }
+  encoded_source_->SetKeyFrameRequestCallback(
+      callback ? std::function<void()>(
+                     [callback, user_data]() { callback(user_data); })
+               : nullptr);
+  return true;
+}
+
 }  // namespace lumenrtc_bridge
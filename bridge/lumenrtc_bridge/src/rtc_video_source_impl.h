@@ -8,6 +8,8 @@
 #include "rtc_video_frame.h"
 #include "rtc_video_source.h"
 #include "rtc_video_track.h"
+#include "src/internal/custom_video_source.h"
+#include "src/internal/encoded_video_source.h"
 
 namespace lumenrtc_bridge {
 
@@ -15,6 +17,10 @@ class RTCVideoSourceImpl : public RTCVideoSource {
  public:
   RTCVideoSourceImpl(
       webrtc::scoped_refptr<webrtc::VideoTrackSourceInterface> video_source_track);
+  RTCVideoSourceImpl(
+      webrtc::scoped_refptr<webrtc::internal::CustomVideoSource> custom_source);
+  RTCVideoSourceImpl(
+      webrtc::scoped_refptr<EncodedVideoSource> encoded_source);
   virtual ~RTCVideoSourceImpl();
 
   virtual webrtc::scoped_refptr<webrtc::VideoTrackSourceInterface>
@@ -22,8 +28,36 @@ class RTCVideoSourceImpl : public RTCVideoSource {
     return rtc_source_track_;
   }
 
+  SourceType GetSourceType() const override;
+
+  bool PushI420Frame(const uint8_t* data_y, int stride_y,
+                     const uint8_t* data_u, int stride_u,
+                     const uint8_t* data_v, int stride_v, int width,
+                     int height, int64_t timestamp_us,
+                     FrameReleaseCallback release, void* user_data) override;
+
+  bool PushNV12Frame(const uint8_t* data_y, int stride_y,
+                     const uint8_t* data_uv, int stride_uv, int width,
+                     int height, int64_t timestamp_us,
+                     FrameReleaseCallback release, void* user_data) override;
+
+  bool PushARGBFrame(const uint8_t* data, int stride, int width, int height,
+                     int type, int64_t timestamp_us,
+                     FrameReleaseCallback release, void* user_data) override;
+
+  uint64_t dropped_frames() const override;
+
+  bool PushEncodedFrame(const uint8_t* data, size_t size, int width,
+                        int height, bool key_frame,
+                        int64_t timestamp_us) override;
+
+  bool SetKeyFrameRequestCallback(KeyFrameRequestCallback callback,
+                                  void* user_data) override;
+
  private:
   webrtc::scoped_refptr<webrtc::VideoTrackSourceInterface> rtc_source_track_;
+  webrtc::scoped_refptr<webrtc::internal::CustomVideoSource> custom_source_;
+  webrtc::scoped_refptr<EncodedVideoSource> encoded_source_;
 };
 }  // namespace lumenrtc_bridge
 
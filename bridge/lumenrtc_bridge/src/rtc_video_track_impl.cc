@@ -23,6 +23,12 @@ void VideoTrackImpl::AddRenderer(
   return video_sink_->AddRenderer(renderer);
 }
 
+void VideoTrackImpl::AddRenderer(
+    RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer,
+    const RTCVideoSinkWants& wants) {
+  return video_sink_->AddRenderer(renderer, wants);
+}
+
 void VideoTrackImpl::RemoveRenderer(
     RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer) {
   return video_sink_->RemoveRenderer(renderer);
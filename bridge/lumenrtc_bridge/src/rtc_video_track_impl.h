@@ -21,6 +21,10 @@ class VideoTrackImpl : public RTCVideoTrack {
   virtual void AddRenderer(
       RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer) override;
 
+  virtual void AddRenderer(
+      RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer,
+      const RTCVideoSinkWants& wants) override;
+
   virtual void RemoveRenderer(
       RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer) override;
 
@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+"""Checks a native benchmark JSON report against a budget file.
+
+    bench_gate.py --report media.json --budget native/bench/media_loopback_budget.json
+
+The budget uses the same layout as abi/benchmark_budget.json:
+targets -> <benchmark name> -> <metric> -> bounds. A bound named "max" or
+"min" applies to a scalar metric; "<stat>_max" or "<stat>_min" applies to
+one field of an object metric, e.g. latency_ms.p99. Exits 1 on any violation.
+"""
+
+import argparse
+import json
+import sys
+
+
+def check(report, budget):
+    name = report.get("benchmark")
+    limits = budget.get("targets", {}).get(name)
+    if limits is None:
+        return [f"no budget for benchmark '{name}'"]
+    failures = []
+    for metric, bounds in sorted(limits.items()):
+        for bound, limit in sorted(bounds.items()):
+            stat, _, kind = bound.rpartition("_")
+            value = report.get(metric)
+            label = metric
+            if stat:
+                value = value.get(stat) if isinstance(value, dict) else None
+                label = f"{metric}.{stat}"
+            if not isinstance(value, (int, float)):
+                failures.append(f"{label}: missing from report")
+            elif kind == "max" and value > limit:
+                failures.append(f"{label}: {value} > {limit}")
+            elif kind == "min" and value < limit:
+                failures.append(f"{label}: {value} < {limit}")
+            elif kind not in ("max", "min"):
+                failures.append(f"{label}: unknown bound '{bound}'")
+    return failures
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--report", required=True)
+    parser.add_argument("--budget", required=True)
+    args = parser.parse_args()
+    with open(args.report, encoding="utf-8") as f:
+        report = json.load(f)
+    with open(args.budget, encoding="utf-8") as f:
+        budget = json.load(f)
+    failures = check(report, budget)
+    for failure in failures:
+        print(f"budget exceeded: {failure}", file=sys.stderr)
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
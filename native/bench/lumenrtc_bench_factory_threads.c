@@ -0,0 +1,184 @@
+/* Measures the thread, context-switch and RSS cost of running many
+ * peer connection factories side by side.
+ *
+ *   lumenrtc_bench_factory_threads [--factories N] [--mode dedicated|shared|pooled]
+ *                                  [--pool-size K] [--idle-ms MS]
+ *
+ * Creates and initializes N factories in the requested thread mode, lets them
+ * idle for MS milliseconds and prints one JSON object with the deltas. Context
+ * switches come from getrusage(RUSAGE_SELF), which sums every thread of the
+ * process; thread count and RSS come from /proc/self/status. */
+
+#include "lumenrtc.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+
+typedef struct bench_sample_t {
+  long threads;
+  long rss_kb;
+  long voluntary_switches;
+  long involuntary_switches;
+} bench_sample_t;
+
+static long read_status_field(const char* name) {
+  FILE* f = fopen("/proc/self/status", "r");
+  char line[256];
+  size_t len = strlen(name);
+  long value = -1;
+  if (!f) {
+    return -1;
+  }
+  while (fgets(line, sizeof(line), f)) {
+    if (strncmp(line, name, len) == 0 && line[len] == ':') {
+      value = strtol(line + len + 1, NULL, 10);
+      break;
+    }
+  }
+  fclose(f);
+  return value;
+}
+
+static void take_sample(bench_sample_t* out) {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  out->threads = read_status_field("Threads");
+  out->rss_kb = read_status_field("VmRSS");
+  if (out->rss_kb < 0) {
+    out->rss_kb = usage.ru_maxrss;
+  }
+  out->voluntary_switches = usage.ru_nvcsw;
+  out->involuntary_switches = usage.ru_nivcsw;
+}
+
+static void sleep_ms(long ms) {
+  struct timespec ts;
+  ts.tv_sec = ms / 1000;
+  ts.tv_nsec = (ms % 1000) * 1000000L;
+  nanosleep(&ts, NULL);
+}
+
+static const char* mode_name(lrtc_factory_thread_mode mode) {
+  switch (mode) {
+    case LRTC_FACTORY_THREADS_SHARED:
+      return "shared";
+    case LRTC_FACTORY_THREADS_POOLED:
+      return "pooled";
+    default:
+      return "dedicated";
+  }
+}
+
+int main(int argc, char** argv) {
+  int factory_count = 100;
+  long idle_ms = 5000;
+  lrtc_factory_options_t options;
+  lrtc_factory_t** factories;
+  bench_sample_t before;
+  bench_sample_t after_start;
+  bench_sample_t after_idle;
+  int created = 0;
+  int i;
+
+  memset(&options, 0, sizeof(options));
+  options.thread_mode = LRTC_FACTORY_THREADS_DEDICATED;
+
+  for (i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--factories") == 0 && i + 1 < argc) {
+      factory_count = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--mode") == 0 && i + 1 < argc) {
+      const char* mode = argv[++i];
+      if (strcmp(mode, "shared") == 0) {
+        options.thread_mode = LRTC_FACTORY_THREADS_SHARED;
+      } else if (strcmp(mode, "pooled") == 0) {
+        options.thread_mode = LRTC_FACTORY_THREADS_POOLED;
+      } else {
+        options.thread_mode = LRTC_FACTORY_THREADS_DEDICATED;
+      }
+    } else if (strcmp(argv[i], "--pool-size") == 0 && i + 1 < argc) {
+      options.thread_pool_size = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--idle-ms") == 0 && i + 1 < argc) {
+      idle_ms = atol(argv[++i]);
+    } else {
+      fprintf(stderr,
+              "usage: %s [--factories N] [--mode dedicated|shared|pooled] "
+              "[--pool-size K] [--idle-ms MS]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+  if (factory_count < 1) {
+    factory_count = 1;
+  }
+
+  if (lrtc_initialize() != LRTC_OK) {
+    fprintf(stderr, "lrtc_initialize failed\n");
+    return 1;
+  }
+
+  factories = (lrtc_factory_t**)calloc((size_t)factory_count, sizeof(*factories));
+  if (!factories) {
+    return 1;
+  }
+
+  take_sample(&before);
+  for (i = 0; i < factory_count; ++i) {
+    lrtc_factory_t* factory;
+    if (i == 0 || options.thread_mode != LRTC_FACTORY_THREADS_SHARED) {
+      lrtc_factory_options_t first = options;
+      if (options.thread_mode == LRTC_FACTORY_THREADS_SHARED) {
+        /* The first factory owns the threads the others share. */
+        first.thread_mode = LRTC_FACTORY_THREADS_DEDICATED;
+      }
+      factory = lrtc_factory_create_with_options(&first, NULL);
+    } else {
+      factory = lrtc_factory_create_with_options(&options, factories[0]);
+    }
+    if (!factory || lrtc_factory_initialize(factory) != LRTC_OK) {
+      fprintf(stderr, "factory %d failed to start\n", i);
+      if (factory) {
+        lrtc_factory_release(factory);
+      }
+      break;
+    }
+    factories[created++] = factory;
+  }
+  take_sample(&after_start);
+  sleep_ms(idle_ms);
+  take_sample(&after_idle);
+
+  printf("{\n");
+  printf("  \"benchmark\": \"factory_threads\",\n");
+  printf("  \"mode\": \"%s\",\n", mode_name(options.thread_mode));
+  printf("  \"factories\": %d,\n", created);
+  printf("  \"pool_size\": %d,\n", options.thread_pool_size);
+  printf("  \"idle_ms\": %ld,\n", idle_ms);
+  printf("  \"threads_added\": %ld,\n", after_start.threads - before.threads);
+  printf("  \"rss_kb_added\": %ld,\n", after_start.rss_kb - before.rss_kb);
+  printf("  \"rss_kb_per_factory\": %.1f,\n",
+         created ? (double)(after_idle.rss_kb - before.rss_kb) / created : 0.0);
+  printf("  \"idle_voluntary_switches\": %ld,\n",
+         after_idle.voluntary_switches - after_start.voluntary_switches);
+  printf("  \"idle_involuntary_switches\": %ld,\n",
+         after_idle.involuntary_switches - after_start.involuntary_switches);
+  printf("  \"idle_switches_per_second\": %.1f\n",
+         idle_ms > 0
+             ? (double)((after_idle.voluntary_switches -
+                         after_start.voluntary_switches) +
+                        (after_idle.involuntary_switches -
+                         after_start.involuntary_switches)) *
+                   1000.0 / idle_ms
+             : 0.0);
+  printf("}\n");
+
+  for (i = created - 1; i >= 0; --i) {
+    lrtc_factory_terminate(factories[i]);
+    lrtc_factory_release(factories[i]);
+  }
+  free(factories);
+  lrtc_terminate();
+  return created == factory_count ? 0 : 1;
+}
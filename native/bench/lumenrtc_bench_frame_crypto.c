@@ -0,0 +1,201 @@
+/* Measures AES-GCM encrypt and decrypt throughput of one core through the
+ * key provider's payload functions, which share their layout and code with
+ * frame encryption.
+ *
+ *   lumenrtc_bench_frame_crypto [--megabytes MB] [--sizes S1,S2,...]
+ *
+ * For every payload size, encrypts and decrypts MB megabytes in place, in
+ * batches of 64 buffers, and prints one JSON object with MB/s and payloads/s
+ * per size. Time is the thread's CPU time, so the numbers are per core
+ * whatever else runs on the machine. */
+
+#include "lumenrtc.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_MAX_SIZES 16
+#define BENCH_BATCH 64
+
+typedef struct bench_result_t {
+  uint32_t size;
+  double encrypt_mb_per_s;
+  double decrypt_mb_per_s;
+  double encrypt_per_s;
+  double decrypt_per_s;
+} bench_result_t;
+
+static double thread_cpu_seconds(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static int parse_sizes(const char* list, uint32_t* sizes) {
+  int count = 0;
+  while (*list && count < BENCH_MAX_SIZES) {
+    char* end;
+    long size = strtol(list, &end, 10);
+    if (end == list || size <= 0) {
+      return -1;
+    }
+    sizes[count++] = (uint32_t)size;
+    list = *end == ',' ? end + 1 : end;
+  }
+  return count;
+}
+
+/* Returns 0 on success; every payload must survive the round trip. */
+static int run_size(lrtc_key_provider_t* provider, uint32_t size,
+                    long megabytes, bench_result_t* out) {
+  const uint32_t capacity = size + LRTC_FRAME_CRYPTO_OVERHEAD;
+  uint8_t* buffers = (uint8_t*)malloc((size_t)capacity * BENCH_BATCH);
+  uint8_t* plain = (uint8_t*)malloc(size);
+  long batches =
+      (long)((megabytes * 1024.0 * 1024.0) / ((double)size * BENCH_BATCH));
+  double encrypt_s = 0.0;
+  double decrypt_s = 0.0;
+  long payloads;
+  long b;
+  int failed = 0;
+  int i;
+
+  if (!buffers || !plain) {
+    free(buffers);
+    free(plain);
+    return 1;
+  }
+  if (batches < 1) {
+    batches = 1;
+  }
+  payloads = batches * BENCH_BATCH;
+  for (i = 0; i < (int)size; ++i) {
+    plain[i] = (uint8_t)(i * 31 + 7);
+  }
+  for (i = 0; i < BENCH_BATCH; ++i) {
+    memcpy(buffers + (size_t)capacity * i, plain, size);
+  }
+
+  /* A batch is encrypted, then decrypted, so the clock is read twice per
+   * batch rather than per payload. */
+  for (b = 0; b < batches && !failed; ++b) {
+    double start = thread_cpu_seconds();
+    double middle;
+    for (i = 0; i < BENCH_BATCH; ++i) {
+      failed |= lrtc_key_provider_encrypt(
+                    provider, "bench", 0, buffers + (size_t)capacity * i,
+                    size, capacity) != (int32_t)capacity;
+    }
+    middle = thread_cpu_seconds();
+    for (i = 0; i < BENCH_BATCH; ++i) {
+      failed |= lrtc_key_provider_decrypt(provider, "bench",
+                                          buffers + (size_t)capacity * i,
+                                          capacity) != (int32_t)size;
+    }
+    encrypt_s += middle - start;
+    decrypt_s += thread_cpu_seconds() - middle;
+  }
+  for (i = 0; i < BENCH_BATCH && !failed; ++i) {
+    failed = memcmp(buffers + (size_t)capacity * i, plain, size) != 0;
+  }
+
+  out->size = size;
+  out->encrypt_mb_per_s =
+      encrypt_s > 0 ? (double)size * payloads / (1024.0 * 1024.0) / encrypt_s
+                    : 0.0;
+  out->decrypt_mb_per_s =
+      decrypt_s > 0 ? (double)size * payloads / (1024.0 * 1024.0) / decrypt_s
+                    : 0.0;
+  out->encrypt_per_s = encrypt_s > 0 ? payloads / encrypt_s : 0.0;
+  out->decrypt_per_s = decrypt_s > 0 ? payloads / decrypt_s : 0.0;
+  free(buffers);
+  free(plain);
+  return failed;
+}
+
+static void print_metric(const char* name, const bench_result_t* results,
+                         int count, size_t offset, int last) {
+  int i;
+  printf("  \"%s\": {", name);
+  for (i = 0; i < count; ++i) {
+    const double value =
+        *(const double*)((const char*)&results[i] + offset);
+    printf("%s\"%u\": %.1f", i ? ", " : "", results[i].size, value);
+  }
+  printf("}%s\n", last ? "" : ",");
+}
+
+int main(int argc, char** argv) {
+  /* An Opus packet, a video delta frame, a key frame and a large key frame. */
+  uint32_t sizes[BENCH_MAX_SIZES] = {160, 1200, 16000, 100000};
+  int size_count = 4;
+  long megabytes = 256;
+  bench_result_t results[BENCH_MAX_SIZES];
+  lrtc_key_provider_options_t options;
+  lrtc_key_provider_t* provider;
+  uint8_t key[32];
+  int failed = 0;
+  int i;
+
+  for (i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--megabytes") == 0 && i + 1 < argc) {
+      megabytes = atol(argv[++i]);
+    } else if (strcmp(argv[i], "--sizes") == 0 && i + 1 < argc) {
+      size_count = parse_sizes(argv[++i], sizes);
+    } else {
+      size_count = -1;
+    }
+    if (size_count <= 0) {
+      fprintf(stderr, "usage: %s [--megabytes MB] [--sizes S1,S2,...]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+  if (megabytes < 1) {
+    megabytes = 1;
+  }
+
+  memset(&options, 0, sizeof(options));
+  options.shared_key = true;
+  options.failure_tolerance = -1;
+  provider = lrtc_key_provider_create(&options);
+  for (i = 0; i < (int)sizeof(key); ++i) {
+    key[i] = (uint8_t)(i * 7 + 1);
+  }
+  if (!provider ||
+      lrtc_key_provider_set_shared_key(provider, 0, key, sizeof(key)) !=
+          LRTC_OK) {
+    fprintf(stderr, "key provider setup failed\n");
+    if (provider) {
+      lrtc_key_provider_release(provider);
+    }
+    return 1;
+  }
+
+  for (i = 0; i < size_count; ++i) {
+    if (run_size(provider, sizes[i], megabytes, &results[i]) != 0) {
+      fprintf(stderr, "round trip of %u bytes failed\n", sizes[i]);
+      failed = 1;
+    }
+  }
+
+  printf("{\n");
+  printf("  \"benchmark\": \"frame_crypto\",\n");
+  printf("  \"megabytes_per_size\": %ld,\n", megabytes);
+  print_metric("encrypt_mb_per_s", results, size_count,
+               offsetof(bench_result_t, encrypt_mb_per_s), 0);
+  print_metric("decrypt_mb_per_s", results, size_count,
+               offsetof(bench_result_t, decrypt_mb_per_s), 0);
+  print_metric("encrypt_per_s", results, size_count,
+               offsetof(bench_result_t, encrypt_per_s), 0);
+  print_metric("decrypt_per_s", results, size_count,
+               offsetof(bench_result_t, decrypt_per_s), 1);
+  printf("}\n");
+
+  lrtc_key_provider_release(provider);
+  return failed;
+}
@@ -0,0 +1,598 @@
+/* End-to-end video benchmark over in-process loopback peer connection pairs.
+ *
+ *   lumenrtc_bench_media_loopback [--pairs N] [--width W] [--height H]
+ *                                 [--fps F] [--duration-ms MS]
+ *                                 [--virtual-network] [--latency-ms MS]
+ *                                 [--jitter-ms MS] [--loss RATE]
+ *                                 [--bandwidth-bps BPS]
+ *
+ * Each pair is a sender with a custom video source and a receiver negotiated
+ * through lrtc_peer_connection_connect_loopback. Senders push synthetic I420
+ * frames at the requested rate; the top band of every frame carries a
+ * sequence number as 32 black/white blocks (24 bits plus an 8 bit check), so
+ * the receiver can match decoded frames to their push time even after the
+ * encoder rescales them.
+ *
+ * Prints one JSON object with connection setup time, end-to-end latency
+ * percentiles, achieved frame rates, process CPU time per frame and RSS.
+ * --virtual-network needs a bridge built with lumenrtc_bridge_virtual_network;
+ * without it the pairs connect over the host's loopback interfaces. */
+
+#include "lumenrtc.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#define SEND_RING 1024
+#define CODE_BITS 32
+#define CONNECT_TIMEOUT_MS 20000
+
+typedef struct bench_pair_t {
+  lrtc_peer_connection_t* sender;
+  lrtc_peer_connection_t* receiver;
+  lrtc_video_source_t* source;
+  lrtc_video_track_t* remote_track;
+  lrtc_video_sink_t* sink;
+  pthread_mutex_t mutex;
+  /* Guarded by mutex. */
+  int64_t connect_start_us;
+  int64_t negotiated_us;
+  int64_t connected_us;
+  int sender_connected;
+  int receiver_connected;
+  int failed;
+  uint32_t send_seq[SEND_RING];
+  int64_t send_us[SEND_RING];
+  uint32_t frames_received;
+  uint32_t frames_undecoded;
+  int64_t first_rx_us;
+  int64_t last_rx_us;
+  double* latencies_ms;
+  size_t latency_count;
+  size_t latency_capacity;
+  /* Only touched by the pushing thread. */
+  int active;
+  uint32_t frames_sent;
+  uint8_t* frame;
+} bench_pair_t;
+
+static int64_t now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void sleep_until_us(int64_t deadline_us) {
+  int64_t delta = deadline_us - now_us();
+  struct timespec ts;
+  if (delta <= 0) {
+    return;
+  }
+  ts.tv_sec = (time_t)(delta / 1000000);
+  ts.tv_nsec = (long)(delta % 1000000) * 1000L;
+  nanosleep(&ts, NULL);
+}
+
+static long read_status_field(const char* name) {
+  FILE* f = fopen("/proc/self/status", "r");
+  char line[256];
+  size_t len = strlen(name);
+  long value = -1;
+  if (!f) {
+    return -1;
+  }
+  while (fgets(line, sizeof(line), f)) {
+    if (strncmp(line, name, len) == 0 && line[len] == ':') {
+      value = strtol(line + len + 1, NULL, 10);
+      break;
+    }
+  }
+  fclose(f);
+  return value;
+}
+
+static double cpu_ms(void) {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return (double)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000.0 +
+         (double)(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000.0;
+}
+
+static uint32_t encode_sequence(uint32_t seq) {
+  uint32_t payload = seq & 0xFFFFFFu;
+  uint32_t check = (payload ^ (payload >> 8) ^ (payload >> 16) ^ 0x5Au) & 0xFFu;
+  return (payload << 8) | check;
+}
+
+static int decode_sequence(uint32_t code, uint32_t* seq) {
+  uint32_t payload = code >> 8;
+  if (((payload ^ (payload >> 8) ^ (payload >> 16) ^ 0x5Au) & 0xFFu) !=
+      (code & 0xFFu)) {
+    return 0;
+  }
+  *seq = payload;
+  return 1;
+}
+
+/* The code band is the top 1/8 of the frame, split into 32 columns. */
+static void draw_frame(uint8_t* y_plane, int width, int height,
+                       uint32_t seq) {
+  uint32_t code = encode_sequence(seq);
+  int band = height / 8;
+  int box = height / 6;
+  int travel = width - box;
+  int box_x = travel > 0 ? (int)((seq * 8u) % (uint32_t)travel) : 0;
+  int row;
+  int bit;
+
+  for (row = 0; row < band; ++row) {
+    uint8_t* line = y_plane + (size_t)row * width;
+    for (bit = 0; bit < CODE_BITS; ++bit) {
+      int x0 = bit * width / CODE_BITS;
+      int x1 = (bit + 1) * width / CODE_BITS;
+      uint8_t value = (code >> (CODE_BITS - 1 - bit)) & 1u ? 235 : 16;
+      memset(line + x0, value, (size_t)(x1 - x0));
+    }
+  }
+  /* A moving box keeps the encoder producing real inter frames. */
+  for (row = band; row < height; ++row) {
+    uint8_t* line = y_plane + (size_t)row * width;
+    memset(line, 96, (size_t)width);
+    if (row >= height / 2 - box / 2 && row < height / 2 + box / 2) {
+      memset(line + box_x, 200, (size_t)box);
+    }
+  }
+}
+
+static int read_sequence(lrtc_video_frame_t* frame, uint32_t* seq) {
+  const uint8_t* y_plane = lrtc_video_frame_data_y(frame);
+  int stride = lrtc_video_frame_stride_y(frame);
+  int width = lrtc_video_frame_width(frame);
+  int height = lrtc_video_frame_height(frame);
+  const uint8_t* line;
+  uint32_t code = 0;
+  int bit;
+  if (!y_plane || width < CODE_BITS || height < 16) {
+    return 0;
+  }
+  line = y_plane + (size_t)(height / 16) * stride;
+  for (bit = 0; bit < CODE_BITS; ++bit) {
+    int x = (2 * bit + 1) * width / (2 * CODE_BITS);
+    code = (code << 1) | (line[x] > 128 ? 1u : 0u);
+  }
+  return decode_sequence(code, seq);
+}
+
+static void LUMENRTC_CALL on_remote_frame(void* user_data,
+                                          lrtc_video_frame_t* frame) {
+  bench_pair_t* pair = (bench_pair_t*)user_data;
+  int64_t t = now_us();
+  uint32_t seq = 0;
+  int decoded = read_sequence(frame, &seq);
+  lrtc_video_frame_release(frame);
+
+  pthread_mutex_lock(&pair->mutex);
+  pair->frames_received++;
+  if (!pair->first_rx_us) {
+    pair->first_rx_us = t;
+  }
+  pair->last_rx_us = t;
+  if (!decoded || pair->send_seq[seq % SEND_RING] != seq ||
+      !pair->send_us[seq % SEND_RING]) {
+    pair->frames_undecoded++;
+  } else {
+    if (pair->latency_count == pair->latency_capacity) {
+      size_t capacity = pair->latency_capacity ? pair->latency_capacity * 2 : 1024;
+      double* grown = (double*)realloc(pair->latencies_ms, capacity * sizeof(double));
+      if (grown) {
+        pair->latencies_ms = grown;
+        pair->latency_capacity = capacity;
+      }
+    }
+    if (pair->latency_count < pair->latency_capacity) {
+      pair->latencies_ms[pair->latency_count++] =
+          (double)(t - pair->send_us[seq % SEND_RING]) / 1000.0;
+    }
+  }
+  pthread_mutex_unlock(&pair->mutex);
+}
+
+static void mark_connected(bench_pair_t* pair, int* flag, int state) {
+  pthread_mutex_lock(&pair->mutex);
+  if (state == LRTC_PC_STATE_CONNECTED) {
+    *flag = 1;
+    if (pair->sender_connected && pair->receiver_connected &&
+        !pair->connected_us) {
+      pair->connected_us = now_us();
+    }
+  } else if (state == LRTC_PC_STATE_FAILED) {
+    pair->failed = 1;
+  }
+  pthread_mutex_unlock(&pair->mutex);
+}
+
+static void LUMENRTC_CALL on_sender_state(void* user_data, int state) {
+  bench_pair_t* pair = (bench_pair_t*)user_data;
+  mark_connected(pair, &pair->sender_connected, state);
+}
+
+static void LUMENRTC_CALL on_receiver_state(void* user_data, int state) {
+  bench_pair_t* pair = (bench_pair_t*)user_data;
+  mark_connected(pair, &pair->receiver_connected, state);
+}
+
+static void on_receiver_video_track(void* user_data,
+                                    lrtc_video_track_t* track) {
+  bench_pair_t* pair = (bench_pair_t*)user_data;
+  lrtc_video_track_add_sink(track, pair->sink);
+  pthread_mutex_lock(&pair->mutex);
+  if (pair->remote_track) {
+    lrtc_video_track_release(pair->remote_track);
+  }
+  pair->remote_track = track;
+  pthread_mutex_unlock(&pair->mutex);
+}
+
+static void LUMENRTC_CALL on_negotiated(void* user_data) {
+  bench_pair_t* pair = (bench_pair_t*)user_data;
+  pthread_mutex_lock(&pair->mutex);
+  pair->negotiated_us = now_us();
+  pthread_mutex_unlock(&pair->mutex);
+}
+
+static void LUMENRTC_CALL on_negotiation_failed(void* user_data,
+                                                const char* error) {
+  bench_pair_t* pair = (bench_pair_t*)user_data;
+  fprintf(stderr, "loopback negotiation failed: %s\n", error ? error : "");
+  pthread_mutex_lock(&pair->mutex);
+  pair->failed = 1;
+  pthread_mutex_unlock(&pair->mutex);
+}
+
+static int compare_double(const void* a, const void* b) {
+  double x = *(const double*)a;
+  double y = *(const double*)b;
+  return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+static double percentile(const double* sorted, size_t count, double p) {
+  size_t index;
+  if (count == 0) {
+    return 0.0;
+  }
+  index = (size_t)(p * (double)(count - 1) + 0.5);
+  return sorted[index < count ? index : count - 1];
+}
+
+static void usage(const char* argv0) {
+  fprintf(stderr,
+          "usage: %s [--pairs N] [--width W] [--height H] [--fps F] "
+          "[--duration-ms MS] [--virtual-network] [--latency-ms MS] "
+          "[--jitter-ms MS] [--loss RATE] [--bandwidth-bps BPS]\n",
+          argv0);
+}
+
+int main(int argc, char** argv) {
+  int pair_count = 1;
+  int width = 640;
+  int height = 360;
+  int fps = 30;
+  long duration_ms = 10000;
+  lrtc_factory_options_t options;
+  lrtc_factory_t* factory;
+  bench_pair_t* pairs;
+  const char* stream_id = "bench";
+  long rss_start_kb;
+  long rss_connected_kb;
+  long rss_end_kb;
+  double cpu_start_ms;
+  double cpu_end_ms;
+  double* latencies = NULL;
+  double* setup_ms = NULL;
+  size_t latency_total = 0;
+  size_t setup_count = 0;
+  uint64_t frames_sent = 0;
+  uint64_t frames_received = 0;
+  uint64_t frames_undecoded = 0;
+  double rx_fps_sum = 0.0;
+  double latency_sum = 0.0;
+  int64_t frame_interval_us;
+  int64_t start_us;
+  int64_t end_us;
+  int64_t deadline;
+  int64_t next_frame_us;
+  int all_connected = 0;
+  int failed_pairs = 0;
+  int i;
+  size_t j;
+
+  memset(&options, 0, sizeof(options));
+  options.thread_mode = LRTC_FACTORY_THREADS_DEDICATED;
+
+  for (i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--pairs") == 0 && i + 1 < argc) {
+      pair_count = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--width") == 0 && i + 1 < argc) {
+      width = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--height") == 0 && i + 1 < argc) {
+      height = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+      fps = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--duration-ms") == 0 && i + 1 < argc) {
+      duration_ms = atol(argv[++i]);
+    } else if (strcmp(argv[i], "--virtual-network") == 0) {
+      options.virtual_network.enabled = true;
+    } else if (strcmp(argv[i], "--latency-ms") == 0 && i + 1 < argc) {
+      options.virtual_network.latency_ms = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--jitter-ms") == 0 && i + 1 < argc) {
+      options.virtual_network.jitter_ms = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--loss") == 0 && i + 1 < argc) {
+      options.virtual_network.loss_rate = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--bandwidth-bps") == 0 && i + 1 < argc) {
+      options.virtual_network.bandwidth_bps = atoll(argv[++i]);
+    } else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+  if (pair_count < 1 || fps < 1 || duration_ms < 1 || width < 64 ||
+      height < 64 || (width & 1) || (height & 1)) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  if (lrtc_initialize() != LRTC_OK) {
+    fprintf(stderr, "lrtc_initialize failed\n");
+    return 1;
+  }
+  rss_start_kb = read_status_field("VmRSS");
+
+  factory = lrtc_factory_create_with_options(&options, NULL);
+  if (!factory || lrtc_factory_initialize(factory) != LRTC_OK) {
+    fprintf(stderr, "factory failed to start%s\n",
+            options.virtual_network.enabled
+                ? " (is the bridge built with lumenrtc_bridge_virtual_network?)"
+                : "");
+    if (factory) {
+      lrtc_factory_release(factory);
+    }
+    lrtc_terminate();
+    return 1;
+  }
+
+  pairs = (bench_pair_t*)calloc((size_t)pair_count, sizeof(*pairs));
+  if (!pairs) {
+    return 1;
+  }
+
+  for (i = 0; i < pair_count; ++i) {
+    bench_pair_t* pair = &pairs[i];
+    lrtc_peer_connection_callbacks_t sender_callbacks;
+    lrtc_peer_connection_callbacks_t receiver_callbacks;
+    lrtc_video_sink_callbacks_t sink_callbacks;
+    lrtc_video_track_t* track = NULL;
+    char track_id[32];
+    int added = 0;
+
+    pthread_mutex_init(&pair->mutex, NULL);
+    pair->frame = (uint8_t*)malloc((size_t)width * height * 3 / 2);
+    if (!pair->frame) {
+      fprintf(stderr, "out of memory\n");
+      return 1;
+    }
+    /* Chroma stays neutral; only luma changes per frame. */
+    memset(pair->frame + (size_t)width * height, 128,
+           (size_t)width * height / 2);
+
+    memset(&sink_callbacks, 0, sizeof(sink_callbacks));
+    sink_callbacks.on_frame = on_remote_frame;
+    pair->sink = lrtc_video_sink_create(&sink_callbacks, pair);
+
+    memset(&sender_callbacks, 0, sizeof(sender_callbacks));
+    sender_callbacks.on_peer_connection_state = on_sender_state;
+    memset(&receiver_callbacks, 0, sizeof(receiver_callbacks));
+    receiver_callbacks.on_peer_connection_state = on_receiver_state;
+    receiver_callbacks.on_video_track = on_receiver_video_track;
+
+    pair->sender = lrtc_peer_connection_create(factory, NULL, NULL,
+                                               &sender_callbacks, pair);
+    pair->receiver = lrtc_peer_connection_create(factory, NULL, NULL,
+                                                 &receiver_callbacks, pair);
+
+    /* One source per pair keeps the sequence numbers independent. */
+    snprintf(track_id, sizeof(track_id), "bench_video_%d", i);
+    pair->source =
+        lrtc_factory_create_custom_video_source(factory, track_id, false);
+    if (pair->source) {
+      track = lrtc_factory_create_video_track(factory, pair->source, track_id);
+    }
+    if (track && pair->sender) {
+      added = lrtc_peer_connection_add_video_track(pair->sender, track,
+                                                   &stream_id, 1);
+    }
+    if (track) {
+      lrtc_video_track_release(track);
+    }
+    if (!pair->sink || !pair->receiver || !added) {
+      fprintf(stderr, "pair %d failed to start\n", i);
+      return 1;
+    }
+  }
+
+  /* Negotiate every pair at once so setup time reflects contention. */
+  for (i = 0; i < pair_count; ++i) {
+    pairs[i].connect_start_us = now_us();
+    lrtc_peer_connection_connect_loopback(pairs[i].sender, pairs[i].receiver,
+                                          on_negotiated, on_negotiation_failed,
+                                          &pairs[i]);
+  }
+  deadline = now_us() + (int64_t)CONNECT_TIMEOUT_MS * 1000;
+  while (!all_connected && now_us() < deadline) {
+    all_connected = 1;
+    failed_pairs = 0;
+    for (i = 0; i < pair_count; ++i) {
+      pthread_mutex_lock(&pairs[i].mutex);
+      if (pairs[i].failed) {
+        failed_pairs++;
+      } else if (!pairs[i].connected_us) {
+        all_connected = 0;
+      }
+      pthread_mutex_unlock(&pairs[i].mutex);
+    }
+    if (failed_pairs == pair_count) {
+      break;
+    }
+    sleep_until_us(now_us() + 5000);
+  }
+  for (i = 0; i < pair_count; ++i) {
+    pthread_mutex_lock(&pairs[i].mutex);
+    pairs[i].active = pairs[i].connected_us && !pairs[i].failed;
+    pthread_mutex_unlock(&pairs[i].mutex);
+  }
+  rss_connected_kb = read_status_field("VmRSS");
+
+  /* Push frames to every connected pair on a fixed schedule. */
+  frame_interval_us = 1000000 / fps;
+  cpu_start_ms = cpu_ms();
+  start_us = now_us();
+  next_frame_us = start_us;
+  while (next_frame_us < start_us + (int64_t)duration_ms * 1000) {
+    sleep_until_us(next_frame_us);
+    for (i = 0; i < pair_count; ++i) {
+      bench_pair_t* pair = &pairs[i];
+      uint32_t seq = pair->frames_sent & 0xFFFFFFu;
+      int64_t pushed_us;
+      if (!pair->active) {
+        continue;
+      }
+      draw_frame(pair->frame, width, height, seq);
+      pushed_us = now_us();
+      pthread_mutex_lock(&pair->mutex);
+      pair->send_seq[seq % SEND_RING] = seq;
+      pair->send_us[seq % SEND_RING] = pushed_us;
+      pthread_mutex_unlock(&pair->mutex);
+      if (lrtc_video_source_push_i420(
+              pair->source, pair->frame, width,
+              pair->frame + (size_t)width * height, width / 2,
+              pair->frame + (size_t)width * height * 5 / 4, width / 2, width,
+              height, pushed_us, NULL, NULL)) {
+        pair->frames_sent++;
+      }
+    }
+    next_frame_us += frame_interval_us;
+  }
+  end_us = now_us();
+  /* Let frames still in flight arrive before reading the counters. */
+  sleep_until_us(now_us() + 500000);
+  cpu_end_ms = cpu_ms();
+  rss_end_kb = read_status_field("VmRSS");
+
+  for (i = 0; i < pair_count; ++i) {
+    bench_pair_t* pair = &pairs[i];
+    pthread_mutex_lock(&pair->mutex);
+    if (pair->remote_track) {
+      lrtc_video_track_remove_sink(pair->remote_track, pair->sink);
+    }
+    pthread_mutex_unlock(&pair->mutex);
+    lrtc_peer_connection_close(pair->sender);
+    lrtc_peer_connection_close(pair->receiver);
+  }
+
+  setup_ms = (double*)malloc(sizeof(double) * (size_t)pair_count);
+  for (i = 0; i < pair_count; ++i) {
+    bench_pair_t* pair = &pairs[i];
+    double* grown;
+    frames_sent += pair->frames_sent;
+    frames_received += pair->frames_received;
+    frames_undecoded += pair->frames_undecoded;
+    if (pair->connected_us && setup_ms) {
+      setup_ms[setup_count++] =
+          (double)(pair->connected_us - pair->connect_start_us) / 1000.0;
+    }
+    if (pair->frames_received > 1 && pair->last_rx_us > pair->first_rx_us) {
+      rx_fps_sum += (double)(pair->frames_received - 1) * 1000000.0 /
+                    (double)(pair->last_rx_us - pair->first_rx_us);
+    }
+    grown = (double*)realloc(
+        latencies, sizeof(double) * (latency_total + pair->latency_count + 1));
+    if (grown) {
+      latencies = grown;
+      for (j = 0; j < pair->latency_count; ++j) {
+        latency_sum += pair->latencies_ms[j];
+        latencies[latency_total++] = pair->latencies_ms[j];
+      }
+    }
+  }
+  if (latencies) {
+    qsort(latencies, latency_total, sizeof(double), compare_double);
+  }
+  if (setup_ms) {
+    qsort(setup_ms, setup_count, sizeof(double), compare_double);
+  }
+
+  printf("{\n");
+  printf("  \"benchmark\": \"media_loopback\",\n");
+  printf("  \"pairs\": %d,\n", pair_count);
+  printf("  \"connected_pairs\": %zu,\n", setup_count);
+  printf("  \"width\": %d,\n", width);
+  printf("  \"height\": %d,\n", height);
+  printf("  \"target_fps\": %d,\n", fps);
+  printf("  \"duration_ms\": %.1f,\n", (double)(end_us - start_us) / 1000.0);
+  printf("  \"virtual_network\": %s,\n",
+         options.virtual_network.enabled ? "true" : "false");
+  printf("  \"setup_ms\": {\"p50\": %.3f, \"p95\": %.3f, \"max\": %.3f},\n",
+         percentile(setup_ms, setup_count, 0.50),
+         percentile(setup_ms, setup_count, 0.95),
+         setup_count ? setup_ms[setup_count - 1] : 0.0);
+  printf("  \"latency_ms\": {\"mean\": %.3f, \"p50\": %.3f, \"p90\": %.3f, "
+         "\"p99\": %.3f, \"max\": %.3f, \"samples\": %zu},\n",
+         latency_total ? latency_sum / (double)latency_total : 0.0,
+         percentile(latencies, latency_total, 0.50),
+         percentile(latencies, latency_total, 0.90),
+         percentile(latencies, latency_total, 0.99),
+         latency_total ? latencies[latency_total - 1] : 0.0, latency_total);
+  printf("  \"frames_sent\": %llu,\n", (unsigned long long)frames_sent);
+  printf("  \"frames_received\": %llu,\n",
+         (unsigned long long)frames_received);
+  printf("  \"frames_undecoded\": %llu,\n",
+         (unsigned long long)frames_undecoded);
+  printf("  \"sent_fps_per_pair\": %.2f,\n",
+         end_us > start_us
+             ? (double)frames_sent * 1000000.0 /
+                   (double)(end_us - start_us) / (double)pair_count
+             : 0.0);
+  printf("  \"received_fps_per_pair\": %.2f,\n",
+         setup_count ? rx_fps_sum / (double)setup_count : 0.0);
+  printf("  \"cpu_ms_per_frame\": %.4f,\n",
+         frames_sent ? (cpu_end_ms - cpu_start_ms) / (double)frames_sent : 0.0);
+  printf("  \"rss_start_kb\": %ld,\n", rss_start_kb);
+  printf("  \"rss_connected_kb\": %ld,\n", rss_connected_kb);
+  printf("  \"rss_end_kb\": %ld,\n", rss_end_kb);
+  printf("  \"rss_peak_kb\": %ld\n", read_status_field("VmHWM"));
+  printf("}\n");
+
+  for (i = 0; i < pair_count; ++i) {
+    bench_pair_t* pair = &pairs[i];
+    if (pair->remote_track) {
+      lrtc_video_track_release(pair->remote_track);
+    }
+    lrtc_peer_connection_release(pair->sender);
+    lrtc_peer_connection_release(pair->receiver);
+    lrtc_video_sink_release(pair->sink);
+    lrtc_video_source_release(pair->source);
+    pthread_mutex_destroy(&pair->mutex);
+    free(pair->latencies_ms);
+    free(pair->frame);
+  }
+  free(pairs);
+  free(latencies);
+  free(setup_ms);
+  lrtc_factory_terminate(factory);
+  lrtc_factory_release(factory);
+  lrtc_terminate();
+  return setup_count == (size_t)pair_count ? 0 : 1;
+}
@@ -26,8 +26,10 @@ extern "C" {
 #endif
 
 #define LRTC_MAX_ICE_SERVERS 8
+/* Bytes lrtc_key_provider_encrypt() adds to a payload. */
+#define LRTC_FRAME_CRYPTO_OVERHEAD 30
 #define LUMENRTC_ABI_VERSION_MAJOR 1
-#define LUMENRTC_ABI_VERSION_MINOR 0
+#define LUMENRTC_ABI_VERSION_MINOR 1
 #define LUMENRTC_ABI_VERSION_PATCH 0
 
 typedef struct lrtc_factory_t lrtc_factory_t;
@@ -53,21 +55,40 @@ typedef struct lrtc_rtp_sender_t lrtc_rtp_sender_t;
 typedef struct lrtc_rtp_receiver_t lrtc_rtp_receiver_t;
 typedef struct lrtc_rtp_transceiver_t lrtc_rtp_transceiver_t;
 typedef struct lrtc_dtmf_sender_t lrtc_dtmf_sender_t;
+typedef struct lrtc_session_template_t lrtc_session_template_t;
+typedef struct lrtc_layer_controller_t lrtc_layer_controller_t;
+typedef struct lrtc_encoded_frame_t lrtc_encoded_frame_t;
+typedef struct lrtc_encoded_frame_sink_t lrtc_encoded_frame_sink_t;
+typedef struct lrtc_encoded_frame_recorder_t lrtc_encoded_frame_recorder_t;
+typedef struct lrtc_key_provider_t lrtc_key_provider_t;
+typedef struct lrtc_frame_cryptor_t lrtc_frame_cryptor_t;
 
 typedef void (LUMENRTC_CALL *lrtc_sdp_success_cb)(void* user_data, const char* sdp, const char* type);
 typedef void (LUMENRTC_CALL *lrtc_sdp_error_cb)(void* user_data, const char* error);
 typedef void (LUMENRTC_CALL *lrtc_void_cb)(void* user_data);
 typedef void (LUMENRTC_CALL *lrtc_peer_connection_state_cb)(void* user_data, int state);
 typedef void (LUMENRTC_CALL *lrtc_ice_candidate_cb)(void* user_data, const char* sdp_mid, int sdp_mline_index, const char* candidate);
+typedef void (LUMENRTC_CALL *lrtc_ice_candidates_cb)(void* user_data, const char** sdp_mids, const int* sdp_mline_indexes, const char** candidates, uint32_t count);
+typedef void (LUMENRTC_CALL *lrtc_bandwidth_estimate_cb)(void* user_data, int target_bitrate_bps, int stable_target_bitrate_bps, int encoder_target_bitrate_bps, int encoder_count, double rtt_ms, double loss_rate);
+typedef void (LUMENRTC_CALL *lrtc_layer_decision_cb)(void* user_data, int reason, int previous_level, int level, int target_bitrate_bps, double loss_rate, double rtt_ms);
 typedef void (LUMENRTC_CALL *lrtc_data_channel_state_cb)(void* user_data, int state);
 typedef void (LUMENRTC_CALL *lrtc_data_channel_message_cb)(void* user_data, const uint8_t* data, int length, int binary);
 typedef void (LUMENRTC_CALL *lrtc_audio_frame_cb)(void* user_data, const void* audio_data, int bits_per_sample, int sample_rate, size_t number_of_channels, size_t number_of_frames);
 typedef void (LUMENRTC_CALL *lrtc_video_frame_cb)(void* user_data, lrtc_video_frame_t* frame);
+typedef void (LUMENRTC_CALL *lrtc_encoded_frame_cb)(void* user_data, lrtc_encoded_frame_t* frame);
 typedef void (LUMENRTC_CALL *lrtc_track_cb)(void* user_data, lrtc_rtp_transceiver_t* transceiver, lrtc_rtp_receiver_t* receiver);
 typedef void (LUMENRTC_CALL *lrtc_stats_success_cb)(void* user_data, const char* json);
 typedef void (LUMENRTC_CALL *lrtc_stats_failure_cb)(void* user_data, const char* error);
 typedef void (LUMENRTC_CALL *lrtc_log_message_cb)(void* user_data, const char* message);
 typedef void (LUMENRTC_CALL *lrtc_dtmf_tone_cb)(void* user_data, const char* tone, const char* tone_buffer);
+typedef void (LUMENRTC_CALL *lrtc_audio_source_created_cb)(void* user_data, lrtc_audio_source_t* source);
+typedef void (LUMENRTC_CALL *lrtc_audio_track_created_cb)(void* user_data, lrtc_audio_track_t* track);
+typedef void (LUMENRTC_CALL *lrtc_video_source_created_cb)(void* user_data, lrtc_video_source_t* source);
+typedef void (LUMENRTC_CALL *lrtc_video_track_created_cb)(void* user_data, lrtc_video_track_t* track);
+typedef void (LUMENRTC_CALL *lrtc_video_capturer_created_cb)(void* user_data, lrtc_video_capturer_t* capturer);
+typedef void (LUMENRTC_CALL *lrtc_video_capture_started_cb)(void* user_data, int started);
+typedef void (LUMENRTC_CALL *lrtc_desktop_capture_state_cb)(void* user_data, int state);
+typedef void (LUMENRTC_CALL *lrtc_frame_cryption_state_cb)(void* user_data, const char* participant_id, int state);
 
 typedef enum lrtc_audio_source_type {
   LRTC_AUDIO_SOURCE_MICROPHONE = 0,
@@ -118,6 +139,27 @@ typedef enum lrtc_dtls_transport_state {
   LRTC_DTLS_FAILED = 4,
 } lrtc_dtls_transport_state;
 
+typedef enum lrtc_factory_thread_mode {
+  LRTC_FACTORY_THREADS_DEDICATED = 0,
+  LRTC_FACTORY_THREADS_SHARED = 1,
+  LRTC_FACTORY_THREADS_POOLED = 2,
+} lrtc_factory_thread_mode;
+
+typedef enum lrtc_frame_cryption_state {
+  LRTC_FRAME_CRYPTION_NEW = 0,
+  LRTC_FRAME_CRYPTION_OK = 1,
+  LRTC_FRAME_CRYPTION_ENCRYPTION_FAILED = 2,
+  LRTC_FRAME_CRYPTION_DECRYPTION_FAILED = 3,
+  LRTC_FRAME_CRYPTION_MISSING_KEY = 4,
+  LRTC_FRAME_CRYPTION_KEY_RATCHETED = 5,
+  LRTC_FRAME_CRYPTION_INTERNAL_ERROR = 6,
+} lrtc_frame_cryption_state;
+
+typedef enum lrtc_frame_crypto_algorithm {
+  LRTC_FRAME_CRYPTO_AES_GCM = 0,
+  LRTC_FRAME_CRYPTO_AES_CBC = 1,
+} lrtc_frame_crypto_algorithm;
+
 typedef enum lrtc_ice_connection_state {
   LRTC_ICE_CONNECTION_NEW = 0,
   LRTC_ICE_CONNECTION_CHECKING = 1,
@@ -142,6 +184,13 @@ typedef enum lrtc_ice_transports_type {
   LRTC_ICE_TRANSPORTS_ALL = 3,
 } lrtc_ice_transports_type;
 
+typedef enum lrtc_layer_decision_reason {
+  LRTC_LAYER_DECISION_BANDWIDTH = 0,
+  LRTC_LAYER_DECISION_LOSS = 1,
+  LRTC_LAYER_DECISION_RTT = 2,
+  LRTC_LAYER_DECISION_CPU = 3,
+} lrtc_layer_decision_reason;
+
 typedef enum lrtc_log_severity {
   LRTC_LOG_VERBOSE = 0,
   LRTC_LOG_INFO = 1,
@@ -171,6 +220,12 @@ typedef enum lrtc_peer_connection_state {
   LRTC_PC_STATE_CLOSED = 5,
 } lrtc_peer_connection_state;
 
+typedef enum lrtc_recording_sync_policy {
+  LRTC_RECORDING_SYNC_NONE = 0,
+  LRTC_RECORDING_SYNC_ON_STOP = 1,
+  LRTC_RECORDING_SYNC_INTERVAL = 2,
+} lrtc_recording_sync_policy;
+
 typedef enum lrtc_result_t {
   LRTC_OK = 0,
   LRTC_ERROR = 1,
@@ -210,11 +265,42 @@ typedef enum lrtc_tcp_candidate_policy {
   LRTC_TCP_CANDIDATE_DISABLED = 1,
 } lrtc_tcp_candidate_policy;
 
+typedef enum lrtc_thread_role {
+  LRTC_THREAD_WORKER = 0,
+  LRTC_THREAD_SIGNALING = 1,
+  LRTC_THREAD_NETWORK = 2,
+  LRTC_THREAD_CAPTURE = 3,
+} lrtc_thread_role;
+
+typedef enum lrtc_thread_tuning_failure {
+  LRTC_THREAD_AFFINITY_FAILED = 1,
+  LRTC_THREAD_NICE_FAILED = 2,
+  LRTC_THREAD_REALTIME_FAILED = 4,
+} lrtc_thread_tuning_failure;
+
+typedef enum lrtc_trace_stage {
+  LRTC_TRACE_DESKTOP_CAPTURE = 0,
+  LRTC_TRACE_DESKTOP_CONVERT = 1,
+  LRTC_TRACE_CAPTURE_ADAPT = 2,
+  LRTC_TRACE_VIDEO_SINK_ADAPTER = 3,
+  LRTC_TRACE_VIDEO_SINK_CALLBACK = 4,
+  LRTC_TRACE_AUDIO_SINK_ADAPTER = 5,
+  LRTC_TRACE_AUDIO_SINK_CALLBACK = 6,
+} lrtc_trace_stage;
+
 typedef enum lrtc_track_state {
   LRTC_TRACK_LIVE = 0,
   LRTC_TRACK_ENDED = 1,
 } lrtc_track_state;
 
+typedef enum lrtc_video_pixel_format {
+  LRTC_VIDEO_PIXEL_FORMAT_NATIVE = 0,
+  LRTC_VIDEO_PIXEL_FORMAT_I420 = 1,
+  LRTC_VIDEO_PIXEL_FORMAT_NV12 = 2,
+  LRTC_VIDEO_PIXEL_FORMAT_ARGB = 3,
+  LRTC_VIDEO_PIXEL_FORMAT_BGRA = 4,
+} lrtc_video_pixel_format;
+
 typedef struct lrtc_audio_options_t {
   bool echo_cancellation;
   bool auto_gain_control;
@@ -226,11 +312,25 @@ typedef struct lrtc_audio_sink_callbacks_t {
   lrtc_audio_frame_cb on_data;
 } lrtc_audio_sink_callbacks_t;
 
+typedef struct lrtc_certificate_cache_options_t {
+  bool enabled;
+  int size;
+  int64_t rotation_interval_ms;
+} lrtc_certificate_cache_options_t;
+
 typedef struct lrtc_data_channel_callbacks_t {
   lrtc_data_channel_state_cb on_state_change;
   lrtc_data_channel_message_cb on_message;
 } lrtc_data_channel_callbacks_t;
 
+typedef struct lrtc_decode_on_demand_stats_t {
+  uint64_t frames_decoded;
+  uint64_t frames_skipped;
+  uint64_t key_frame_requests;
+  bool enabled;
+  bool skipping;
+} lrtc_decode_on_demand_stats_t;
+
 typedef struct lrtc_dtls_transport_info_t {
   int state;
   int ssl_cipher_suite;
@@ -241,12 +341,93 @@ typedef struct lrtc_dtmf_sender_callbacks_t {
   lrtc_dtmf_tone_cb on_tone_change;
 } lrtc_dtmf_sender_callbacks_t;
 
+typedef struct lrtc_encoded_frame_info_t {
+  int media_type;
+  uint32_t rtp_timestamp;
+  uint32_t ssrc;
+  int payload_type;
+  bool is_key_frame;
+  int width;
+  int height;
+  int64_t frame_id;
+  int spatial_index;
+  int temporal_index;
+  uint32_t dependency_count;
+} lrtc_encoded_frame_info_t;
+
+typedef struct lrtc_encoded_frame_recorder_options_t {
+  uint32_t max_queued_bytes;
+  uint32_t write_buffer_bytes;
+  lrtc_recording_sync_policy sync_policy;
+  uint32_t sync_interval_ms;
+} lrtc_encoded_frame_recorder_options_t;
+
+typedef struct lrtc_encoded_frame_recorder_stats_t {
+  uint64_t frames_written;
+  uint64_t bytes_written;
+  uint64_t frames_dropped;
+  uint64_t queued_bytes;
+  bool write_failed;
+} lrtc_encoded_frame_recorder_stats_t;
+
+typedef struct lrtc_thread_config_t {
+  uint64_t cpu_mask;
+  bool set_nice;
+  int nice;
+  bool realtime;
+  int realtime_priority;
+} lrtc_thread_config_t;
+
+typedef struct lrtc_virtual_network_options_t {
+  bool enabled;
+  int latency_ms;
+  int jitter_ms;
+  double loss_rate;
+  int64_t bandwidth_bps;
+} lrtc_virtual_network_options_t;
+
+typedef struct lrtc_factory_options_t {
+  lrtc_factory_thread_mode thread_mode;
+  int thread_pool_size;
+  int network_thread_count;
+  bool pin_network_threads;
+  int network_first_cpu;
+  lrtc_thread_config_t worker_thread;
+  lrtc_thread_config_t signaling_thread;
+  lrtc_thread_config_t network_thread;
+  lrtc_thread_config_t capture_thread;
+  lrtc_virtual_network_options_t virtual_network;
+} lrtc_factory_options_t;
+
 typedef struct lrtc_ice_server_t {
   const char* uri;
   const char* username;
   const char* password;
 } lrtc_ice_server_t;
 
+typedef struct lrtc_key_provider_options_t {
+  bool shared_key;
+  const uint8_t* ratchet_salt;
+  uint32_t ratchet_salt_len;
+  const uint8_t* uncrypted_magic_bytes;
+  uint32_t uncrypted_magic_bytes_len;
+  int ratchet_window_size;
+  int failure_tolerance;
+  int key_ring_size;
+  bool discard_frame_when_cryptor_not_ready;
+} lrtc_key_provider_options_t;
+
+typedef struct lrtc_layer_controller_options_t {
+  uint32_t interval_ms;
+  double up_headroom;
+  double down_headroom;
+  uint32_t up_hold_ms;
+  uint32_t down_hold_ms;
+  double max_loss_rate;
+  uint32_t max_rtt_increase_ms;
+  bool ignore_cpu;
+} lrtc_layer_controller_options_t;
+
 typedef struct lrtc_peer_connection_callbacks_t {
   lrtc_peer_connection_state_cb on_signaling_state;
   lrtc_peer_connection_state_cb on_peer_connection_state;
@@ -261,6 +442,15 @@ typedef struct lrtc_peer_connection_callbacks_t {
   void ( *on_renegotiation_needed)(void* user_data);
 } lrtc_peer_connection_callbacks_t;
 
+typedef struct lrtc_peer_connection_pool_stats_t {
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t created;
+  uint64_t discarded;
+  uint32_t available;
+  uint32_t target_size;
+} lrtc_peer_connection_pool_stats_t;
+
 typedef struct lrtc_rtc_config_t {
   lrtc_ice_server_t ice_servers[8];
   uint32_t ice_server_count;
@@ -321,10 +511,56 @@ typedef struct lrtc_rtp_transceiver_init_t {
   uint32_t send_encoding_count;
 } lrtc_rtp_transceiver_init_t;
 
+typedef struct lrtc_session_template_stats_t {
+  uint64_t hits;
+  uint64_t misses;
+  uint32_t template_size;
+} lrtc_session_template_stats_t;
+
+typedef struct lrtc_thread_report_t {
+  bool applied;
+  uint64_t cpu_mask;
+  int nice;
+  bool realtime;
+  int priority;
+  int failures;
+} lrtc_thread_report_t;
+
+typedef struct lrtc_trace_event_t {
+  int64_t start_us;
+  int64_t duration_us;
+  int64_t frame_timestamp_us;
+  uint64_t source_id;
+  uint32_t thread_id;
+  lrtc_trace_stage stage;
+} lrtc_trace_event_t;
+
+typedef struct lrtc_udp_mux_options_t {
+  bool enabled;
+  int port;
+} lrtc_udp_mux_options_t;
+
+typedef struct lrtc_udp_mux_stats_t {
+  uint64_t address_hits;
+  uint64_t ufrag_hits;
+  uint64_t misses;
+  uint32_t endpoints;
+  uint32_t ports;
+} lrtc_udp_mux_stats_t;
+
 typedef struct lrtc_video_sink_callbacks_t {
   lrtc_video_frame_cb on_frame;
 } lrtc_video_sink_callbacks_t;
 
+typedef struct lrtc_video_sink_wants_t {
+  uint32_t max_pixel_count;
+  uint32_t max_framerate;
+  uint32_t resolution_alignment;
+  lrtc_video_pixel_format format;
+  uint32_t width;
+  uint32_t height;
+} lrtc_video_sink_wants_t;
+
 LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_abi_version_major(void);
 LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_abi_version_minor(void);
 LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_abi_version_patch(void);
@@ -356,11 +592,15 @@ LUMENRTC_API void LUMENRTC_CALL lrtc_data_channel_close(lrtc_data_channel_t* cha
 LUMENRTC_API void LUMENRTC_CALL lrtc_data_channel_release(lrtc_data_channel_t* channel);
 LUMENRTC_API void LUMENRTC_CALL lrtc_data_channel_send(lrtc_data_channel_t* channel, const uint8_t* data, uint32_t size, int binary);
 LUMENRTC_API void LUMENRTC_CALL lrtc_data_channel_set_callbacks(lrtc_data_channel_t* channel, const lrtc_data_channel_callbacks_t* callbacks, void* user_data);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_desktop_capturer_get_thread_report(lrtc_desktop_capturer_t* capturer, lrtc_thread_report_t* out_report);
 LUMENRTC_API bool LUMENRTC_CALL lrtc_desktop_capturer_is_running(lrtc_desktop_capturer_t* capturer);
 LUMENRTC_API void LUMENRTC_CALL lrtc_desktop_capturer_release(lrtc_desktop_capturer_t* capturer);
 LUMENRTC_API lrtc_desktop_capture_state LUMENRTC_CALL lrtc_desktop_capturer_start(lrtc_desktop_capturer_t* capturer, uint32_t fps);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_desktop_capturer_start_async(lrtc_desktop_capturer_t* capturer, uint32_t fps, lrtc_desktop_capture_state_cb callback, void* user_data);
 LUMENRTC_API lrtc_desktop_capture_state LUMENRTC_CALL lrtc_desktop_capturer_start_region(lrtc_desktop_capturer_t* capturer, uint32_t fps, uint32_t x, uint32_t y, uint32_t w, uint32_t h);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_desktop_capturer_start_region_async(lrtc_desktop_capturer_t* capturer, uint32_t fps, uint32_t x, uint32_t y, uint32_t w, uint32_t h, lrtc_desktop_capture_state_cb callback, void* user_data);
 LUMENRTC_API void LUMENRTC_CALL lrtc_desktop_capturer_stop(lrtc_desktop_capturer_t* capturer);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_desktop_capturer_stop_async(lrtc_desktop_capturer_t* capturer, lrtc_void_cb callback, void* user_data);
 LUMENRTC_API lrtc_desktop_capturer_t* LUMENRTC_CALL lrtc_desktop_device_create_capturer(lrtc_desktop_device_t* device, lrtc_media_source_t* source, bool show_cursor);
 LUMENRTC_API lrtc_desktop_media_list_t* LUMENRTC_CALL lrtc_desktop_device_get_media_list(lrtc_desktop_device_t* device, lrtc_desktop_type type);
 LUMENRTC_API void LUMENRTC_CALL lrtc_desktop_device_release(lrtc_desktop_device_t* device);
@@ -376,23 +616,75 @@ LUMENRTC_API int LUMENRTC_CALL lrtc_dtmf_sender_inter_tone_gap(lrtc_dtmf_sender_
 LUMENRTC_API void LUMENRTC_CALL lrtc_dtmf_sender_release(lrtc_dtmf_sender_t* sender);
 LUMENRTC_API void LUMENRTC_CALL lrtc_dtmf_sender_set_callbacks(lrtc_dtmf_sender_t* sender, const lrtc_dtmf_sender_callbacks_t* callbacks, void* user_data);
 LUMENRTC_API int32_t LUMENRTC_CALL lrtc_dtmf_sender_tones(lrtc_dtmf_sender_t* sender, char* buffer, uint32_t buffer_len);
+LUMENRTC_API const uint8_t* LUMENRTC_CALL lrtc_encoded_frame_data(lrtc_encoded_frame_t* frame);
+LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_encoded_frame_get_dependencies(lrtc_encoded_frame_t* frame, int64_t* out_frame_ids, uint32_t capacity);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_encoded_frame_get_info(lrtc_encoded_frame_t* frame, lrtc_encoded_frame_info_t* out_info);
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_encoded_frame_get_mime_type(lrtc_encoded_frame_t* frame, char* buffer, uint32_t buffer_len);
+LUMENRTC_API lrtc_encoded_frame_recorder_t* LUMENRTC_CALL lrtc_encoded_frame_recorder_create(const char* path, const lrtc_encoded_frame_recorder_options_t* options);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_encoded_frame_recorder_get_stats(lrtc_encoded_frame_recorder_t* recorder, lrtc_encoded_frame_recorder_stats_t* out_stats);
+LUMENRTC_API void LUMENRTC_CALL lrtc_encoded_frame_recorder_release(lrtc_encoded_frame_recorder_t* recorder);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_encoded_frame_recorder_stop(lrtc_encoded_frame_recorder_t* recorder);
+LUMENRTC_API void LUMENRTC_CALL lrtc_encoded_frame_release(lrtc_encoded_frame_t* frame);
+LUMENRTC_API lrtc_encoded_frame_t* LUMENRTC_CALL lrtc_encoded_frame_retain(lrtc_encoded_frame_t* frame);
+LUMENRTC_API lrtc_encoded_frame_sink_t* LUMENRTC_CALL lrtc_encoded_frame_sink_create(lrtc_encoded_frame_cb callback, void* user_data);
+LUMENRTC_API void LUMENRTC_CALL lrtc_encoded_frame_sink_release(lrtc_encoded_frame_sink_t* sink);
+LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_encoded_frame_size(lrtc_encoded_frame_t* frame);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_configure_certificate_cache(lrtc_factory_t* factory, const lrtc_certificate_cache_options_t* options);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_configure_peer_connection_pool(lrtc_factory_t* factory, const lrtc_rtc_config_t* config, lrtc_media_constraints_t* constraints, int size);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_configure_udp_mux(lrtc_factory_t* factory, const lrtc_udp_mux_options_t* options);
 LUMENRTC_API lrtc_factory_t* LUMENRTC_CALL lrtc_factory_create(void);
 LUMENRTC_API lrtc_audio_source_t* LUMENRTC_CALL lrtc_factory_create_audio_source(lrtc_factory_t* factory, const char* label, lrtc_audio_source_type source_type, const lrtc_audio_options_t* options);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_create_audio_source_async(lrtc_factory_t* factory, const char* label, lrtc_audio_source_type source_type, const lrtc_audio_options_t* options, lrtc_audio_source_created_cb callback, void* user_data);
 LUMENRTC_API lrtc_audio_track_t* LUMENRTC_CALL lrtc_factory_create_audio_track(lrtc_factory_t* factory, lrtc_audio_source_t* source, const char* track_id);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_create_audio_track_async(lrtc_factory_t* factory, lrtc_audio_source_t* source, const char* track_id, lrtc_audio_track_created_cb callback, void* user_data);
+LUMENRTC_API lrtc_video_source_t* LUMENRTC_CALL lrtc_factory_create_custom_video_source(lrtc_factory_t* factory, const char* label, bool is_screencast);
 LUMENRTC_API lrtc_video_source_t* LUMENRTC_CALL lrtc_factory_create_desktop_source(lrtc_factory_t* factory, lrtc_desktop_capturer_t* capturer, const char* label, lrtc_media_constraints_t* constraints);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_create_desktop_source_async(lrtc_factory_t* factory, lrtc_desktop_capturer_t* capturer, const char* label, lrtc_media_constraints_t* constraints, lrtc_video_source_created_cb callback, void* user_data);
+LUMENRTC_API lrtc_video_source_t* LUMENRTC_CALL lrtc_factory_create_encoded_video_source(lrtc_factory_t* factory, const char* label, const char* codec);
 LUMENRTC_API lrtc_media_stream_t* LUMENRTC_CALL lrtc_factory_create_stream(lrtc_factory_t* factory, const char* stream_id);
 LUMENRTC_API lrtc_video_source_t* LUMENRTC_CALL lrtc_factory_create_video_source(lrtc_factory_t* factory, lrtc_video_capturer_t* capturer, const char* label, lrtc_media_constraints_t* constraints);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_create_video_source_async(lrtc_factory_t* factory, lrtc_video_capturer_t* capturer, const char* label, lrtc_media_constraints_t* constraints, lrtc_video_source_created_cb callback, void* user_data);
 LUMENRTC_API lrtc_video_track_t* LUMENRTC_CALL lrtc_factory_create_video_track(lrtc_factory_t* factory, lrtc_video_source_t* source, const char* track_id);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_create_video_track_async(lrtc_factory_t* factory, lrtc_video_source_t* source, const char* track_id, lrtc_video_track_created_cb callback, void* user_data);
+LUMENRTC_API lrtc_factory_t* LUMENRTC_CALL lrtc_factory_create_with_options(const lrtc_factory_options_t* options, lrtc_factory_t* share_with);
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_factory_export_certificate_pem(lrtc_factory_t* factory, char* buffer, uint32_t buffer_len);
 LUMENRTC_API lrtc_audio_device_t* LUMENRTC_CALL lrtc_factory_get_audio_device(lrtc_factory_t* factory);
 LUMENRTC_API lrtc_desktop_device_t* LUMENRTC_CALL lrtc_factory_get_desktop_device(lrtc_factory_t* factory);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_get_peer_connection_pool_stats(lrtc_factory_t* factory, lrtc_peer_connection_pool_stats_t* out_stats);
 LUMENRTC_API void LUMENRTC_CALL lrtc_factory_get_rtp_receiver_capabilities(lrtc_factory_t* factory, lrtc_media_type media_type, lrtc_stats_success_cb success, lrtc_stats_failure_cb failure, void* user_data);
 LUMENRTC_API void LUMENRTC_CALL lrtc_factory_get_rtp_sender_capabilities(lrtc_factory_t* factory, lrtc_media_type media_type, lrtc_stats_success_cb success, lrtc_stats_failure_cb failure, void* user_data);
 LUMENRTC_API void LUMENRTC_CALL lrtc_factory_get_rtp_sender_codec_mime_types(lrtc_factory_t* factory, lrtc_media_type media_type, lrtc_stats_success_cb success, lrtc_stats_failure_cb failure, void* user_data);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_get_thread_report(lrtc_factory_t* factory, lrtc_thread_role role, uint32_t index, lrtc_thread_report_t* out_report);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_get_udp_mux_stats(lrtc_factory_t* factory, lrtc_udp_mux_stats_t* out_stats);
 LUMENRTC_API lrtc_video_device_t* LUMENRTC_CALL lrtc_factory_get_video_device(lrtc_factory_t* factory);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_import_certificate_pem(lrtc_factory_t* factory, const char* pem);
 LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_initialize(lrtc_factory_t* factory);
 LUMENRTC_API void LUMENRTC_CALL lrtc_factory_release(lrtc_factory_t* factory);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_set_virtual_network_conditions(lrtc_factory_t* factory, const lrtc_virtual_network_options_t* options);
 LUMENRTC_API void LUMENRTC_CALL lrtc_factory_terminate(lrtc_factory_t* factory);
+LUMENRTC_API lrtc_frame_cryptor_t* LUMENRTC_CALL lrtc_frame_cryptor_create_for_receiver(lrtc_rtp_receiver_t* receiver, const char* participant_id, int algorithm, lrtc_key_provider_t* key_provider);
+LUMENRTC_API lrtc_frame_cryptor_t* LUMENRTC_CALL lrtc_frame_cryptor_create_for_sender(lrtc_rtp_sender_t* sender, const char* participant_id, int algorithm, lrtc_key_provider_t* key_provider);
+LUMENRTC_API bool LUMENRTC_CALL lrtc_frame_cryptor_get_enabled(lrtc_frame_cryptor_t* cryptor);
+LUMENRTC_API int LUMENRTC_CALL lrtc_frame_cryptor_get_key_index(lrtc_frame_cryptor_t* cryptor);
+LUMENRTC_API void LUMENRTC_CALL lrtc_frame_cryptor_release(lrtc_frame_cryptor_t* cryptor);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_frame_cryptor_set_enabled(lrtc_frame_cryptor_t* cryptor, bool enabled);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_frame_cryptor_set_key_index(lrtc_frame_cryptor_t* cryptor, int index);
+LUMENRTC_API void LUMENRTC_CALL lrtc_frame_cryptor_set_observer(lrtc_frame_cryptor_t* cryptor, lrtc_frame_cryption_state_cb callback, void* user_data);
 LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_initialize(void);
+LUMENRTC_API lrtc_key_provider_t* LUMENRTC_CALL lrtc_key_provider_create(const lrtc_key_provider_options_t* options);
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_key_provider_decrypt(lrtc_key_provider_t* provider, const char* participant_id, uint8_t* data, uint32_t size);
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_key_provider_encrypt(lrtc_key_provider_t* provider, const char* participant_id, int key_index, uint8_t* data, uint32_t size, uint32_t capacity);
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_key_provider_export_key(lrtc_key_provider_t* provider, const char* participant_id, int key_index, uint8_t* buffer, uint32_t buffer_len);
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_key_provider_export_shared_key(lrtc_key_provider_t* provider, int key_index, uint8_t* buffer, uint32_t buffer_len);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_key_provider_ratchet_key(lrtc_key_provider_t* provider, const char* participant_id, int key_index);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_key_provider_ratchet_shared_key(lrtc_key_provider_t* provider, int key_index);
+LUMENRTC_API void LUMENRTC_CALL lrtc_key_provider_release(lrtc_key_provider_t* provider);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_key_provider_set_key(lrtc_key_provider_t* provider, const char* participant_id, int key_index, const uint8_t* key, uint32_t key_len);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_key_provider_set_shared_key(lrtc_key_provider_t* provider, int key_index, const uint8_t* key, uint32_t key_len);
+LUMENRTC_API void LUMENRTC_CALL lrtc_key_provider_set_sif_trailer(lrtc_key_provider_t* provider, const uint8_t* trailer, uint32_t trailer_len);
+LUMENRTC_API int LUMENRTC_CALL lrtc_layer_controller_get_level(lrtc_layer_controller_t* controller);
+LUMENRTC_API int LUMENRTC_CALL lrtc_layer_controller_get_max_level(lrtc_layer_controller_t* controller);
+LUMENRTC_API void LUMENRTC_CALL lrtc_layer_controller_release(lrtc_layer_controller_t* controller);
 LUMENRTC_API void LUMENRTC_CALL lrtc_logging_remove_callback(void);
 LUMENRTC_API void LUMENRTC_CALL lrtc_logging_set_callback(int severity, lrtc_log_message_cb callback, void* user_data);
 LUMENRTC_API void LUMENRTC_CALL lrtc_logging_set_min_level(int severity);
@@ -417,6 +709,7 @@ LUMENRTC_API lrtc_rtp_transceiver_t* LUMENRTC_CALL lrtc_peer_connection_add_audi
 LUMENRTC_API lrtc_rtp_transceiver_t* LUMENRTC_CALL lrtc_peer_connection_add_audio_track_transceiver_with_init(lrtc_peer_connection_t* pc, lrtc_audio_track_t* track, const lrtc_rtp_transceiver_init_t* init);
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_add_ice_candidate(lrtc_peer_connection_t* pc, const char* sdp_mid, int sdp_mline_index, const char* candidate);
 LUMENRTC_API int LUMENRTC_CALL lrtc_peer_connection_add_ice_candidate_ex(lrtc_peer_connection_t* pc, const char* sdp_mid, int sdp_mline_index, const char* candidate);
+LUMENRTC_API int LUMENRTC_CALL lrtc_peer_connection_add_ice_candidates(lrtc_peer_connection_t* pc, const char** sdp_mids, const int* sdp_mline_indexes, const char** candidates, uint32_t count, int* out_applied);
 LUMENRTC_API bool LUMENRTC_CALL lrtc_peer_connection_add_stream(lrtc_peer_connection_t* pc, lrtc_media_stream_t* stream);
 LUMENRTC_API lrtc_rtp_transceiver_t* LUMENRTC_CALL lrtc_peer_connection_add_transceiver(lrtc_peer_connection_t* pc, lrtc_media_type media_type);
 LUMENRTC_API lrtc_rtp_transceiver_t* LUMENRTC_CALL lrtc_peer_connection_add_transceiver_with_init(lrtc_peer_connection_t* pc, lrtc_media_type media_type, const lrtc_rtp_transceiver_init_t* init);
@@ -425,26 +718,40 @@ LUMENRTC_API lrtc_rtp_sender_t* LUMENRTC_CALL lrtc_peer_connection_add_video_tra
 LUMENRTC_API lrtc_rtp_transceiver_t* LUMENRTC_CALL lrtc_peer_connection_add_video_track_transceiver(lrtc_peer_connection_t* pc, lrtc_video_track_t* track);
 LUMENRTC_API lrtc_rtp_transceiver_t* LUMENRTC_CALL lrtc_peer_connection_add_video_track_transceiver_with_init(lrtc_peer_connection_t* pc, lrtc_video_track_t* track, const lrtc_rtp_transceiver_init_t* init);
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_close(lrtc_peer_connection_t* pc);
+LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_connect_loopback(lrtc_peer_connection_t* offerer, lrtc_peer_connection_t* answerer, lrtc_void_cb success, lrtc_sdp_error_cb failure, void* user_data);
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_peer_connection_copy_local_description(lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len);
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_peer_connection_copy_local_description_type(lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len);
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_peer_connection_copy_remote_description(lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len);
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_peer_connection_copy_remote_description_type(lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len);
 LUMENRTC_API lrtc_peer_connection_t* LUMENRTC_CALL lrtc_peer_connection_create(lrtc_factory_t* factory, const lrtc_rtc_config_t* config, lrtc_media_constraints_t* constraints, const lrtc_peer_connection_callbacks_t* callbacks, void* user_data);
+LUMENRTC_API lrtc_peer_connection_t* LUMENRTC_CALL lrtc_peer_connection_create_keyed(lrtc_factory_t* factory, const char* network_key, const lrtc_rtc_config_t* config, lrtc_media_constraints_t* constraints, const lrtc_peer_connection_callbacks_t* callbacks, void* user_data);
+LUMENRTC_API lrtc_layer_controller_t* LUMENRTC_CALL lrtc_peer_connection_create_layer_controller(lrtc_peer_connection_t* pc, lrtc_rtp_sender_t* sender, const lrtc_layer_controller_options_t* options, lrtc_layer_decision_cb callback, void* user_data);
+LUMENRTC_API lrtc_peer_connection_t* LUMENRTC_CALL lrtc_peer_connection_create_pooled(lrtc_factory_t* factory, const lrtc_peer_connection_callbacks_t* callbacks, void* user_data);
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_create_answer(lrtc_peer_connection_t* pc, lrtc_sdp_success_cb success, lrtc_sdp_error_cb failure, void* user_data, lrtc_media_constraints_t* constraints);
 LUMENRTC_API lrtc_data_channel_t* LUMENRTC_CALL lrtc_peer_connection_create_data_channel(lrtc_peer_connection_t* pc, const char* label, int ordered, int reliable, int max_retransmit_time, int max_retransmits, const char* protocol, int negotiated, int id);
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_create_offer(lrtc_peer_connection_t* pc, lrtc_sdp_success_cb success, lrtc_sdp_error_cb failure, void* user_data, lrtc_media_constraints_t* constraints);
+LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_create_templated_offer(lrtc_peer_connection_t* pc, lrtc_session_template_t* session_template, lrtc_sdp_success_cb success, lrtc_sdp_error_cb failure, void* user_data, lrtc_media_constraints_t* constraints);
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_get_local_description(lrtc_peer_connection_t* pc, lrtc_sdp_success_cb success, lrtc_sdp_error_cb failure, void* user_data);
 LUMENRTC_API lrtc_rtp_receiver_t* LUMENRTC_CALL lrtc_peer_connection_get_receiver(lrtc_peer_connection_t* pc, uint32_t index);
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_get_receiver_stats(lrtc_peer_connection_t* pc, lrtc_rtp_receiver_t* receiver, lrtc_stats_success_cb success, lrtc_stats_failure_cb failure, void* user_data);
+LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_peer_connection_get_receivers(lrtc_peer_connection_t* pc, lrtc_rtp_receiver_t** out_receivers, uint32_t capacity);
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_get_remote_description(lrtc_peer_connection_t* pc, lrtc_sdp_success_cb success, lrtc_sdp_error_cb failure, void* user_data);
 LUMENRTC_API lrtc_rtp_sender_t* LUMENRTC_CALL lrtc_peer_connection_get_sender(lrtc_peer_connection_t* pc, uint32_t index);
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_get_sender_stats(lrtc_peer_connection_t* pc, lrtc_rtp_sender_t* sender, lrtc_stats_success_cb success, lrtc_stats_failure_cb failure, void* user_data);
+LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_peer_connection_get_senders(lrtc_peer_connection_t* pc, lrtc_rtp_sender_t** out_senders, uint32_t capacity);
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_get_stats(lrtc_peer_connection_t* pc, lrtc_stats_success_cb success, lrtc_stats_failure_cb failure, void* user_data);
 LUMENRTC_API lrtc_rtp_transceiver_t* LUMENRTC_CALL lrtc_peer_connection_get_transceiver(lrtc_peer_connection_t* pc, uint32_t index);
+LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_peer_connection_get_transceivers(lrtc_peer_connection_t* pc, lrtc_rtp_transceiver_t** out_transceivers, uint32_t capacity);
 LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_peer_connection_receiver_count(lrtc_peer_connection_t* pc);
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_release(lrtc_peer_connection_t* pc);
 LUMENRTC_API bool LUMENRTC_CALL lrtc_peer_connection_remove_stream(lrtc_peer_connection_t* pc, lrtc_media_stream_t* stream);
 LUMENRTC_API int LUMENRTC_CALL lrtc_peer_connection_remove_track(lrtc_peer_connection_t* pc, lrtc_rtp_sender_t* sender);
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_restart_ice(lrtc_peer_connection_t* pc);
 LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_peer_connection_sender_count(lrtc_peer_connection_t* pc);
+LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_set_bandwidth_observer(lrtc_peer_connection_t* pc, uint32_t interval_ms, lrtc_bandwidth_estimate_cb callback, void* user_data);
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_set_callbacks(lrtc_peer_connection_t* pc, const lrtc_peer_connection_callbacks_t* callbacks, void* user_data);
 LUMENRTC_API int LUMENRTC_CALL lrtc_peer_connection_set_codec_preferences(lrtc_peer_connection_t* pc, lrtc_media_type media_type, const char** mime_types, uint32_t mime_type_count);
+LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_set_ice_candidate_batching(lrtc_peer_connection_t* pc, uint32_t window_ms, lrtc_ice_candidates_cb callback, void* user_data);
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_set_local_description(lrtc_peer_connection_t* pc, const char* sdp, const char* type, lrtc_void_cb success, lrtc_sdp_error_cb failure, void* user_data);
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_set_remote_description(lrtc_peer_connection_t* pc, const char* sdp, const char* type, lrtc_void_cb success, lrtc_sdp_error_cb failure, void* user_data);
 LUMENRTC_API int LUMENRTC_CALL lrtc_peer_connection_set_transceiver_codec_preferences(lrtc_peer_connection_t* pc, lrtc_rtp_transceiver_t* transceiver, const char** mime_types, uint32_t mime_type_count);
@@ -454,6 +761,7 @@ LUMENRTC_API lrtc_audio_track_t* LUMENRTC_CALL lrtc_rtp_receiver_get_audio_track
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_receiver_get_degradation_preference(lrtc_rtp_receiver_t* receiver);
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_receiver_get_dtls_info(lrtc_rtp_receiver_t* receiver, lrtc_dtls_transport_info_t* info);
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_receiver_get_encoding_info(lrtc_rtp_receiver_t* receiver, uint32_t index, lrtc_rtp_encoding_info_t* info);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_receiver_get_decode_stats(lrtc_rtp_receiver_t* receiver, lrtc_decode_on_demand_stats_t* out_stats);
 LUMENRTC_API int32_t LUMENRTC_CALL lrtc_rtp_receiver_get_encoding_rid(lrtc_rtp_receiver_t* receiver, uint32_t index, char* buffer, uint32_t buffer_len);
 LUMENRTC_API int32_t LUMENRTC_CALL lrtc_rtp_receiver_get_encoding_scalability_mode(lrtc_rtp_receiver_t* receiver, uint32_t index, char* buffer, uint32_t buffer_len);
 LUMENRTC_API int32_t LUMENRTC_CALL lrtc_rtp_receiver_get_id(lrtc_rtp_receiver_t* receiver, char* buffer, uint32_t buffer_len);
@@ -463,6 +771,10 @@ LUMENRTC_API lrtc_media_stream_t* LUMENRTC_CALL lrtc_rtp_receiver_get_stream(lrt
 LUMENRTC_API int32_t LUMENRTC_CALL lrtc_rtp_receiver_get_stream_id(lrtc_rtp_receiver_t* receiver, uint32_t index, char* buffer, uint32_t buffer_len);
 LUMENRTC_API lrtc_video_track_t* LUMENRTC_CALL lrtc_rtp_receiver_get_video_track(lrtc_rtp_receiver_t* receiver);
 LUMENRTC_API void LUMENRTC_CALL lrtc_rtp_receiver_release(lrtc_rtp_receiver_t* receiver);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_receiver_request_key_frame(lrtc_rtp_receiver_t* receiver);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_receiver_set_decode_on_demand(lrtc_rtp_receiver_t* receiver, bool enabled);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_receiver_set_encoded_frame_recorder(lrtc_rtp_receiver_t* receiver, lrtc_encoded_frame_recorder_t* recorder);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_receiver_set_encoded_frame_sink(lrtc_rtp_receiver_t* receiver, lrtc_encoded_frame_sink_t* sink);
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_receiver_set_jitter_buffer_min_delay(lrtc_rtp_receiver_t* receiver, double delay_seconds);
 LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_rtp_receiver_stream_count(lrtc_rtp_receiver_t* receiver);
 LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_rtp_receiver_stream_id_count(lrtc_rtp_receiver_t* receiver);
@@ -483,8 +795,12 @@ LUMENRTC_API lrtc_video_track_t* LUMENRTC_CALL lrtc_rtp_sender_get_video_track(l
 LUMENRTC_API void LUMENRTC_CALL lrtc_rtp_sender_release(lrtc_rtp_sender_t* sender);
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_sender_replace_audio_track(lrtc_rtp_sender_t* sender, lrtc_audio_track_t* track);
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_sender_replace_video_track(lrtc_rtp_sender_t* sender, lrtc_video_track_t* track);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_sender_send_encoded_audio(lrtc_rtp_sender_t* sender, const char* mime_type, const uint8_t* data, uint32_t size, uint32_t rtp_timestamp);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_sender_send_encoded_frame(lrtc_rtp_sender_t* sender, lrtc_encoded_frame_t* frame);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_sender_set_encoded_frame_input(lrtc_rtp_sender_t* sender, bool enabled);
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_sender_set_encoding_parameters(lrtc_rtp_sender_t* sender, const lrtc_rtp_encoding_settings_t* settings);
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_sender_set_encoding_parameters_at(lrtc_rtp_sender_t* sender, uint32_t index, const lrtc_rtp_encoding_settings_t* settings);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_sender_set_encodings(lrtc_rtp_sender_t* sender, const lrtc_rtp_encoding_settings_t* settings, uint32_t count, int degradation_preference);
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_sender_set_stream_ids(lrtc_rtp_sender_t* sender, const char** stream_ids, uint32_t stream_id_count);
 LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_rtp_sender_stream_id_count(lrtc_rtp_sender_t* sender);
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_transceiver_get_current_direction(lrtc_rtp_transceiver_t* transceiver);
@@ -500,12 +816,24 @@ LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_transceiver_get_stopping(lrtc_rtp_transc
 LUMENRTC_API void LUMENRTC_CALL lrtc_rtp_transceiver_release(lrtc_rtp_transceiver_t* transceiver);
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_transceiver_set_direction(lrtc_rtp_transceiver_t* transceiver, int direction, char* error, uint32_t error_len);
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_transceiver_stop(lrtc_rtp_transceiver_t* transceiver, char* error, uint32_t error_len);
+LUMENRTC_API lrtc_session_template_t* LUMENRTC_CALL lrtc_session_template_create(void);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_session_template_get_stats(lrtc_session_template_t* session_template, lrtc_session_template_stats_t* out_stats);
+LUMENRTC_API void LUMENRTC_CALL lrtc_session_template_release(lrtc_session_template_t* session_template);
+LUMENRTC_API void LUMENRTC_CALL lrtc_session_template_reset(lrtc_session_template_t* session_template);
 LUMENRTC_API void LUMENRTC_CALL lrtc_terminate(void);
+LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_trace_drain(lrtc_trace_event_t* events, uint32_t capacity);
+LUMENRTC_API uint64_t LUMENRTC_CALL lrtc_trace_dropped_count(void);
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_trace_format_chrome_json(const lrtc_trace_event_t* events, uint32_t count, char* buffer, uint32_t buffer_len);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_trace_start(uint32_t capacity);
+LUMENRTC_API void LUMENRTC_CALL lrtc_trace_stop(void);
 LUMENRTC_API bool LUMENRTC_CALL lrtc_video_capturer_capture_started(lrtc_video_capturer_t* capturer);
 LUMENRTC_API void LUMENRTC_CALL lrtc_video_capturer_release(lrtc_video_capturer_t* capturer);
 LUMENRTC_API bool LUMENRTC_CALL lrtc_video_capturer_start(lrtc_video_capturer_t* capturer);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_video_capturer_start_async(lrtc_video_capturer_t* capturer, lrtc_video_capture_started_cb callback, void* user_data);
 LUMENRTC_API void LUMENRTC_CALL lrtc_video_capturer_stop(lrtc_video_capturer_t* capturer);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_video_capturer_stop_async(lrtc_video_capturer_t* capturer, lrtc_void_cb callback, void* user_data);
 LUMENRTC_API lrtc_video_capturer_t* LUMENRTC_CALL lrtc_video_device_create_capturer(lrtc_video_device_t* device, const char* name, uint32_t index, size_t width, size_t height, size_t target_fps);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_video_device_create_capturer_async(lrtc_video_device_t* device, const char* name, uint32_t index, size_t width, size_t height, size_t target_fps, lrtc_video_capturer_created_cb callback, void* user_data);
 LUMENRTC_API int32_t LUMENRTC_CALL lrtc_video_device_get_device_name(lrtc_video_device_t* device, uint32_t index, char* name, uint32_t name_length, char* unique_id, uint32_t unique_id_length);
 LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_video_device_number_of_devices(lrtc_video_device_t* device);
 LUMENRTC_API void LUMENRTC_CALL lrtc_video_device_release(lrtc_video_device_t* device);
@@ -513,6 +841,7 @@ LUMENRTC_API int LUMENRTC_CALL lrtc_video_frame_copy_i420(lrtc_video_frame_t* fr
 LUMENRTC_API const uint8_t* LUMENRTC_CALL lrtc_video_frame_data_u(lrtc_video_frame_t* frame);
 LUMENRTC_API const uint8_t* LUMENRTC_CALL lrtc_video_frame_data_v(lrtc_video_frame_t* frame);
 LUMENRTC_API const uint8_t* LUMENRTC_CALL lrtc_video_frame_data_y(lrtc_video_frame_t* frame);
+LUMENRTC_API int LUMENRTC_CALL lrtc_video_frame_format(lrtc_video_frame_t* frame);
 LUMENRTC_API int LUMENRTC_CALL lrtc_video_frame_height(lrtc_video_frame_t* frame);
 LUMENRTC_API void LUMENRTC_CALL lrtc_video_frame_release(lrtc_video_frame_t* frame);
 LUMENRTC_API lrtc_video_frame_t* LUMENRTC_CALL lrtc_video_frame_retain(lrtc_video_frame_t* frame);
@@ -522,8 +851,15 @@ LUMENRTC_API int LUMENRTC_CALL lrtc_video_frame_stride_y(lrtc_video_frame_t* fra
 LUMENRTC_API int LUMENRTC_CALL lrtc_video_frame_to_argb(lrtc_video_frame_t* frame, uint8_t* dst_argb, int dst_stride_argb, int dest_width, int dest_height, int format);
 LUMENRTC_API int LUMENRTC_CALL lrtc_video_frame_width(lrtc_video_frame_t* frame);
 LUMENRTC_API lrtc_video_sink_t* LUMENRTC_CALL lrtc_video_sink_create(const lrtc_video_sink_callbacks_t* callbacks, void* user_data);
+LUMENRTC_API lrtc_video_sink_t* LUMENRTC_CALL lrtc_video_sink_create_with_wants(const lrtc_video_sink_callbacks_t* callbacks, const lrtc_video_sink_wants_t* wants, void* user_data);
 LUMENRTC_API void LUMENRTC_CALL lrtc_video_sink_release(lrtc_video_sink_t* sink);
+LUMENRTC_API uint64_t LUMENRTC_CALL lrtc_video_source_dropped_count(lrtc_video_source_t* source);
+LUMENRTC_API int LUMENRTC_CALL lrtc_video_source_push_argb(lrtc_video_source_t* source, const uint8_t* data, int stride, int width, int height, int format, int64_t timestamp_us, lrtc_void_cb release, void* user_data);
+LUMENRTC_API int LUMENRTC_CALL lrtc_video_source_push_encoded(lrtc_video_source_t* source, const uint8_t* data, uint32_t size, int width, int height, bool key_frame, int64_t timestamp_us);
+LUMENRTC_API int LUMENRTC_CALL lrtc_video_source_push_i420(lrtc_video_source_t* source, const uint8_t* data_y, int stride_y, const uint8_t* data_u, int stride_u, const uint8_t* data_v, int stride_v, int width, int height, int64_t timestamp_us, lrtc_void_cb release, void* user_data);
+LUMENRTC_API int LUMENRTC_CALL lrtc_video_source_push_nv12(lrtc_video_source_t* source, const uint8_t* data_y, int stride_y, const uint8_t* data_uv, int stride_uv, int width, int height, int64_t timestamp_us, lrtc_void_cb release, void* user_data);
 LUMENRTC_API void LUMENRTC_CALL lrtc_video_source_release(lrtc_video_source_t* source);
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_video_source_set_key_frame_request_callback(lrtc_video_source_t* source, lrtc_void_cb callback, void* user_data);
 LUMENRTC_API void LUMENRTC_CALL lrtc_video_track_add_sink(lrtc_video_track_t* track, lrtc_video_sink_t* sink);
 LUMENRTC_API int LUMENRTC_CALL lrtc_video_track_get_enabled(lrtc_video_track_t* track);
 LUMENRTC_API int32_t LUMENRTC_CALL lrtc_video_track_get_id(lrtc_video_track_t* track, char* buffer, uint32_t buffer_len);
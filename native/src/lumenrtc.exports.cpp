@@ -131,6 +131,10 @@ LUMENRTC_API void LUMENRTC_CALL lrtc_data_channel_set_callbacks(lrtc_data_channe
     impl_lrtc_data_channel_set_callbacks(channel, callbacks, user_data);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_desktop_capturer_get_thread_report(lrtc_desktop_capturer_t* capturer, lrtc_thread_report_t* out_report) {
+    return impl_lrtc_desktop_capturer_get_thread_report(capturer, out_report);
+}
+
 LUMENRTC_API bool LUMENRTC_CALL lrtc_desktop_capturer_is_running(lrtc_desktop_capturer_t* capturer) {
     return impl_lrtc_desktop_capturer_is_running(capturer);
 }
@@ -143,14 +147,26 @@ LUMENRTC_API lrtc_desktop_capture_state LUMENRTC_CALL lrtc_desktop_capturer_star
     return impl_lrtc_desktop_capturer_start(capturer, fps);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_desktop_capturer_start_async(lrtc_desktop_capturer_t* capturer, uint32_t fps, lrtc_desktop_capture_state_cb callback, void* user_data) {
+    return impl_lrtc_desktop_capturer_start_async(capturer, fps, callback, user_data);
+}
+
 LUMENRTC_API lrtc_desktop_capture_state LUMENRTC_CALL lrtc_desktop_capturer_start_region(lrtc_desktop_capturer_t* capturer, uint32_t fps, uint32_t x, uint32_t y, uint32_t w, uint32_t h) {
     return impl_lrtc_desktop_capturer_start_region(capturer, fps, x, y, w, h);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_desktop_capturer_start_region_async(lrtc_desktop_capturer_t* capturer, uint32_t fps, uint32_t x, uint32_t y, uint32_t w, uint32_t h, lrtc_desktop_capture_state_cb callback, void* user_data) {
+    return impl_lrtc_desktop_capturer_start_region_async(capturer, fps, x, y, w, h, callback, user_data);
+}
+
 LUMENRTC_API void LUMENRTC_CALL lrtc_desktop_capturer_stop(lrtc_desktop_capturer_t* capturer) {
     impl_lrtc_desktop_capturer_stop(capturer);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_desktop_capturer_stop_async(lrtc_desktop_capturer_t* capturer, lrtc_void_cb callback, void* user_data) {
+    return impl_lrtc_desktop_capturer_stop_async(capturer, callback, user_data);
+}
+
 LUMENRTC_API lrtc_desktop_capturer_t* LUMENRTC_CALL lrtc_desktop_device_create_capturer(lrtc_desktop_device_t* device, lrtc_media_source_t* source, bool show_cursor) {
     return impl_lrtc_desktop_device_create_capturer(device, source, show_cursor);
 }
@@ -211,6 +227,70 @@ LUMENRTC_API int32_t LUMENRTC_CALL lrtc_dtmf_sender_tones(lrtc_dtmf_sender_t* se
     return impl_lrtc_dtmf_sender_tones(sender, buffer, buffer_len);
 }
 
+LUMENRTC_API const uint8_t* LUMENRTC_CALL lrtc_encoded_frame_data(lrtc_encoded_frame_t* frame) {
+    return impl_lrtc_encoded_frame_data(frame);
+}
+
+LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_encoded_frame_get_dependencies(lrtc_encoded_frame_t* frame, int64_t* out_frame_ids, uint32_t capacity) {
+    return impl_lrtc_encoded_frame_get_dependencies(frame, out_frame_ids, capacity);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_encoded_frame_get_info(lrtc_encoded_frame_t* frame, lrtc_encoded_frame_info_t* out_info) {
+    return impl_lrtc_encoded_frame_get_info(frame, out_info);
+}
+
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_encoded_frame_get_mime_type(lrtc_encoded_frame_t* frame, char* buffer, uint32_t buffer_len) {
+    return impl_lrtc_encoded_frame_get_mime_type(frame, buffer, buffer_len);
+}
+
+LUMENRTC_API lrtc_encoded_frame_recorder_t* LUMENRTC_CALL lrtc_encoded_frame_recorder_create(const char* path, const lrtc_encoded_frame_recorder_options_t* options) {
+    return impl_lrtc_encoded_frame_recorder_create(path, options);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_encoded_frame_recorder_get_stats(lrtc_encoded_frame_recorder_t* recorder, lrtc_encoded_frame_recorder_stats_t* out_stats) {
+    return impl_lrtc_encoded_frame_recorder_get_stats(recorder, out_stats);
+}
+
+LUMENRTC_API void LUMENRTC_CALL lrtc_encoded_frame_recorder_release(lrtc_encoded_frame_recorder_t* recorder) {
+    impl_lrtc_encoded_frame_recorder_release(recorder);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_encoded_frame_recorder_stop(lrtc_encoded_frame_recorder_t* recorder) {
+    return impl_lrtc_encoded_frame_recorder_stop(recorder);
+}
+
+LUMENRTC_API void LUMENRTC_CALL lrtc_encoded_frame_release(lrtc_encoded_frame_t* frame) {
+    impl_lrtc_encoded_frame_release(frame);
+}
+
+LUMENRTC_API lrtc_encoded_frame_t* LUMENRTC_CALL lrtc_encoded_frame_retain(lrtc_encoded_frame_t* frame) {
+    return impl_lrtc_encoded_frame_retain(frame);
+}
+
+LUMENRTC_API lrtc_encoded_frame_sink_t* LUMENRTC_CALL lrtc_encoded_frame_sink_create(lrtc_encoded_frame_cb callback, void* user_data) {
+    return impl_lrtc_encoded_frame_sink_create(callback, user_data);
+}
+
+LUMENRTC_API void LUMENRTC_CALL lrtc_encoded_frame_sink_release(lrtc_encoded_frame_sink_t* sink) {
+    impl_lrtc_encoded_frame_sink_release(sink);
+}
+
+LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_encoded_frame_size(lrtc_encoded_frame_t* frame) {
+    return impl_lrtc_encoded_frame_size(frame);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_configure_certificate_cache(lrtc_factory_t* factory, const lrtc_certificate_cache_options_t* options) {
+    return impl_lrtc_factory_configure_certificate_cache(factory, options);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_configure_peer_connection_pool(lrtc_factory_t* factory, const lrtc_rtc_config_t* config, lrtc_media_constraints_t* constraints, int size) {
+    return impl_lrtc_factory_configure_peer_connection_pool(factory, config, constraints, size);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_configure_udp_mux(lrtc_factory_t* factory, const lrtc_udp_mux_options_t* options) {
+    return impl_lrtc_factory_configure_udp_mux(factory, options);
+}
+
 LUMENRTC_API lrtc_factory_t* LUMENRTC_CALL lrtc_factory_create(void) {
     return impl_lrtc_factory_create();
 }
@@ -219,14 +299,34 @@ LUMENRTC_API lrtc_audio_source_t* LUMENRTC_CALL lrtc_factory_create_audio_source
     return impl_lrtc_factory_create_audio_source(factory, label, source_type, options);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_create_audio_source_async(lrtc_factory_t* factory, const char* label, lrtc_audio_source_type source_type, const lrtc_audio_options_t* options, lrtc_audio_source_created_cb callback, void* user_data) {
+    return impl_lrtc_factory_create_audio_source_async(factory, label, source_type, options, callback, user_data);
+}
+
 LUMENRTC_API lrtc_audio_track_t* LUMENRTC_CALL lrtc_factory_create_audio_track(lrtc_factory_t* factory, lrtc_audio_source_t* source, const char* track_id) {
     return impl_lrtc_factory_create_audio_track(factory, source, track_id);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_create_audio_track_async(lrtc_factory_t* factory, lrtc_audio_source_t* source, const char* track_id, lrtc_audio_track_created_cb callback, void* user_data) {
+    return impl_lrtc_factory_create_audio_track_async(factory, source, track_id, callback, user_data);
+}
+
+LUMENRTC_API lrtc_video_source_t* LUMENRTC_CALL lrtc_factory_create_custom_video_source(lrtc_factory_t* factory, const char* label, bool is_screencast) {
+    return impl_lrtc_factory_create_custom_video_source(factory, label, is_screencast);
+}
+
 LUMENRTC_API lrtc_video_source_t* LUMENRTC_CALL lrtc_factory_create_desktop_source(lrtc_factory_t* factory, lrtc_desktop_capturer_t* capturer, const char* label, lrtc_media_constraints_t* constraints) {
     return impl_lrtc_factory_create_desktop_source(factory, capturer, label, constraints);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_create_desktop_source_async(lrtc_factory_t* factory, lrtc_desktop_capturer_t* capturer, const char* label, lrtc_media_constraints_t* constraints, lrtc_video_source_created_cb callback, void* user_data) {
+    return impl_lrtc_factory_create_desktop_source_async(factory, capturer, label, constraints, callback, user_data);
+}
+
+LUMENRTC_API lrtc_video_source_t* LUMENRTC_CALL lrtc_factory_create_encoded_video_source(lrtc_factory_t* factory, const char* label, const char* codec) {
+    return impl_lrtc_factory_create_encoded_video_source(factory, label, codec);
+}
+
 LUMENRTC_API lrtc_media_stream_t* LUMENRTC_CALL lrtc_factory_create_stream(lrtc_factory_t* factory, const char* stream_id) {
     return impl_lrtc_factory_create_stream(factory, stream_id);
 }
@@ -235,10 +335,26 @@ LUMENRTC_API lrtc_video_source_t* LUMENRTC_CALL lrtc_factory_create_video_source
     return impl_lrtc_factory_create_video_source(factory, capturer, label, constraints);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_create_video_source_async(lrtc_factory_t* factory, lrtc_video_capturer_t* capturer, const char* label, lrtc_media_constraints_t* constraints, lrtc_video_source_created_cb callback, void* user_data) {
+    return impl_lrtc_factory_create_video_source_async(factory, capturer, label, constraints, callback, user_data);
+}
+
 LUMENRTC_API lrtc_video_track_t* LUMENRTC_CALL lrtc_factory_create_video_track(lrtc_factory_t* factory, lrtc_video_source_t* source, const char* track_id) {
     return impl_lrtc_factory_create_video_track(factory, source, track_id);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_create_video_track_async(lrtc_factory_t* factory, lrtc_video_source_t* source, const char* track_id, lrtc_video_track_created_cb callback, void* user_data) {
+    return impl_lrtc_factory_create_video_track_async(factory, source, track_id, callback, user_data);
+}
+
+LUMENRTC_API lrtc_factory_t* LUMENRTC_CALL lrtc_factory_create_with_options(const lrtc_factory_options_t* options, lrtc_factory_t* share_with) {
+    return impl_lrtc_factory_create_with_options(options, share_with);
+}
+
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_factory_export_certificate_pem(lrtc_factory_t* factory, char* buffer, uint32_t buffer_len) {
+    return impl_lrtc_factory_export_certificate_pem(factory, buffer, buffer_len);
+}
+
 LUMENRTC_API lrtc_audio_device_t* LUMENRTC_CALL lrtc_factory_get_audio_device(lrtc_factory_t* factory) {
     return impl_lrtc_factory_get_audio_device(factory);
 }
@@ -247,6 +363,10 @@ LUMENRTC_API lrtc_desktop_device_t* LUMENRTC_CALL lrtc_factory_get_desktop_devic
     return impl_lrtc_factory_get_desktop_device(factory);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_get_peer_connection_pool_stats(lrtc_factory_t* factory, lrtc_peer_connection_pool_stats_t* out_stats) {
+    return impl_lrtc_factory_get_peer_connection_pool_stats(factory, out_stats);
+}
+
 LUMENRTC_API void LUMENRTC_CALL lrtc_factory_get_rtp_receiver_capabilities(lrtc_factory_t* factory, lrtc_media_type media_type, lrtc_stats_success_cb success, lrtc_stats_failure_cb failure, void* user_data) {
     impl_lrtc_factory_get_rtp_receiver_capabilities(factory, media_type, success, failure, user_data);
 }
@@ -259,10 +379,22 @@ LUMENRTC_API void LUMENRTC_CALL lrtc_factory_get_rtp_sender_codec_mime_types(lrt
     impl_lrtc_factory_get_rtp_sender_codec_mime_types(factory, media_type, success, failure, user_data);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_get_thread_report(lrtc_factory_t* factory, lrtc_thread_role role, uint32_t index, lrtc_thread_report_t* out_report) {
+    return impl_lrtc_factory_get_thread_report(factory, role, index, out_report);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_get_udp_mux_stats(lrtc_factory_t* factory, lrtc_udp_mux_stats_t* out_stats) {
+    return impl_lrtc_factory_get_udp_mux_stats(factory, out_stats);
+}
+
 LUMENRTC_API lrtc_video_device_t* LUMENRTC_CALL lrtc_factory_get_video_device(lrtc_factory_t* factory) {
     return impl_lrtc_factory_get_video_device(factory);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_import_certificate_pem(lrtc_factory_t* factory, const char* pem) {
+    return impl_lrtc_factory_import_certificate_pem(factory, pem);
+}
+
 LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_initialize(lrtc_factory_t* factory) {
     return impl_lrtc_factory_initialize(factory);
 }
@@ -271,14 +403,106 @@ LUMENRTC_API void LUMENRTC_CALL lrtc_factory_release(lrtc_factory_t* factory) {
     impl_lrtc_factory_release(factory);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_factory_set_virtual_network_conditions(lrtc_factory_t* factory, const lrtc_virtual_network_options_t* options) {
+    return impl_lrtc_factory_set_virtual_network_conditions(factory, options);
+}
+
 LUMENRTC_API void LUMENRTC_CALL lrtc_factory_terminate(lrtc_factory_t* factory) {
     impl_lrtc_factory_terminate(factory);
 }
 
+LUMENRTC_API lrtc_frame_cryptor_t* LUMENRTC_CALL lrtc_frame_cryptor_create_for_receiver(lrtc_rtp_receiver_t* receiver, const char* participant_id, int algorithm, lrtc_key_provider_t* key_provider) {
+    return impl_lrtc_frame_cryptor_create_for_receiver(receiver, participant_id, algorithm, key_provider);
+}
+
+LUMENRTC_API lrtc_frame_cryptor_t* LUMENRTC_CALL lrtc_frame_cryptor_create_for_sender(lrtc_rtp_sender_t* sender, const char* participant_id, int algorithm, lrtc_key_provider_t* key_provider) {
+    return impl_lrtc_frame_cryptor_create_for_sender(sender, participant_id, algorithm, key_provider);
+}
+
+LUMENRTC_API bool LUMENRTC_CALL lrtc_frame_cryptor_get_enabled(lrtc_frame_cryptor_t* cryptor) {
+    return impl_lrtc_frame_cryptor_get_enabled(cryptor);
+}
+
+LUMENRTC_API int LUMENRTC_CALL lrtc_frame_cryptor_get_key_index(lrtc_frame_cryptor_t* cryptor) {
+    return impl_lrtc_frame_cryptor_get_key_index(cryptor);
+}
+
+LUMENRTC_API void LUMENRTC_CALL lrtc_frame_cryptor_release(lrtc_frame_cryptor_t* cryptor) {
+    impl_lrtc_frame_cryptor_release(cryptor);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_frame_cryptor_set_enabled(lrtc_frame_cryptor_t* cryptor, bool enabled) {
+    return impl_lrtc_frame_cryptor_set_enabled(cryptor, enabled);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_frame_cryptor_set_key_index(lrtc_frame_cryptor_t* cryptor, int index) {
+    return impl_lrtc_frame_cryptor_set_key_index(cryptor, index);
+}
+
+LUMENRTC_API void LUMENRTC_CALL lrtc_frame_cryptor_set_observer(lrtc_frame_cryptor_t* cryptor, lrtc_frame_cryption_state_cb callback, void* user_data) {
+    impl_lrtc_frame_cryptor_set_observer(cryptor, callback, user_data);
+}
+
 LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_initialize(void) {
     return impl_lrtc_initialize();
 }
 
+LUMENRTC_API lrtc_key_provider_t* LUMENRTC_CALL lrtc_key_provider_create(const lrtc_key_provider_options_t* options) {
+    return impl_lrtc_key_provider_create(options);
+}
+
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_key_provider_decrypt(lrtc_key_provider_t* provider, const char* participant_id, uint8_t* data, uint32_t size) {
+    return impl_lrtc_key_provider_decrypt(provider, participant_id, data, size);
+}
+
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_key_provider_encrypt(lrtc_key_provider_t* provider, const char* participant_id, int key_index, uint8_t* data, uint32_t size, uint32_t capacity) {
+    return impl_lrtc_key_provider_encrypt(provider, participant_id, key_index, data, size, capacity);
+}
+
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_key_provider_export_key(lrtc_key_provider_t* provider, const char* participant_id, int key_index, uint8_t* buffer, uint32_t buffer_len) {
+    return impl_lrtc_key_provider_export_key(provider, participant_id, key_index, buffer, buffer_len);
+}
+
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_key_provider_export_shared_key(lrtc_key_provider_t* provider, int key_index, uint8_t* buffer, uint32_t buffer_len) {
+    return impl_lrtc_key_provider_export_shared_key(provider, key_index, buffer, buffer_len);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_key_provider_ratchet_key(lrtc_key_provider_t* provider, const char* participant_id, int key_index) {
+    return impl_lrtc_key_provider_ratchet_key(provider, participant_id, key_index);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_key_provider_ratchet_shared_key(lrtc_key_provider_t* provider, int key_index) {
+    return impl_lrtc_key_provider_ratchet_shared_key(provider, key_index);
+}
+
+LUMENRTC_API void LUMENRTC_CALL lrtc_key_provider_release(lrtc_key_provider_t* provider) {
+    impl_lrtc_key_provider_release(provider);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_key_provider_set_key(lrtc_key_provider_t* provider, const char* participant_id, int key_index, const uint8_t* key, uint32_t key_len) {
+    return impl_lrtc_key_provider_set_key(provider, participant_id, key_index, key, key_len);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_key_provider_set_shared_key(lrtc_key_provider_t* provider, int key_index, const uint8_t* key, uint32_t key_len) {
+    return impl_lrtc_key_provider_set_shared_key(provider, key_index, key, key_len);
+}
+
+LUMENRTC_API void LUMENRTC_CALL lrtc_key_provider_set_sif_trailer(lrtc_key_provider_t* provider, const uint8_t* trailer, uint32_t trailer_len) {
+    impl_lrtc_key_provider_set_sif_trailer(provider, trailer, trailer_len);
+}
+
+LUMENRTC_API int LUMENRTC_CALL lrtc_layer_controller_get_level(lrtc_layer_controller_t* controller) {
+    return impl_lrtc_layer_controller_get_level(controller);
+}
+
+LUMENRTC_API int LUMENRTC_CALL lrtc_layer_controller_get_max_level(lrtc_layer_controller_t* controller) {
+    return impl_lrtc_layer_controller_get_max_level(controller);
+}
+
+LUMENRTC_API void LUMENRTC_CALL lrtc_layer_controller_release(lrtc_layer_controller_t* controller) {
+    impl_lrtc_layer_controller_release(controller);
+}
+
 LUMENRTC_API void LUMENRTC_CALL lrtc_logging_remove_callback(void) {
     impl_lrtc_logging_remove_callback();
 }
@@ -375,6 +599,10 @@ LUMENRTC_API int LUMENRTC_CALL lrtc_peer_connection_add_ice_candidate_ex(lrtc_pe
     return impl_lrtc_peer_connection_add_ice_candidate_ex(pc, sdp_mid, sdp_mline_index, candidate);
 }
 
+LUMENRTC_API int LUMENRTC_CALL lrtc_peer_connection_add_ice_candidates(lrtc_peer_connection_t* pc, const char** sdp_mids, const int* sdp_mline_indexes, const char** candidates, uint32_t count, int* out_applied) {
+    return impl_lrtc_peer_connection_add_ice_candidates(pc, sdp_mids, sdp_mline_indexes, candidates, count, out_applied);
+}
+
 LUMENRTC_API bool LUMENRTC_CALL lrtc_peer_connection_add_stream(lrtc_peer_connection_t* pc, lrtc_media_stream_t* stream) {
     return impl_lrtc_peer_connection_add_stream(pc, stream);
 }
@@ -407,6 +635,26 @@ LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_close(lrtc_peer_connection_
     impl_lrtc_peer_connection_close(pc);
 }
 
+LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_connect_loopback(lrtc_peer_connection_t* offerer, lrtc_peer_connection_t* answerer, lrtc_void_cb success, lrtc_sdp_error_cb failure, void* user_data) {
+    impl_lrtc_peer_connection_connect_loopback(offerer, answerer, success, failure, user_data);
+}
+
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_peer_connection_copy_local_description(lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len) {
+    return impl_lrtc_peer_connection_copy_local_description(pc, buffer, buffer_len);
+}
+
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_peer_connection_copy_local_description_type(lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len) {
+    return impl_lrtc_peer_connection_copy_local_description_type(pc, buffer, buffer_len);
+}
+
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_peer_connection_copy_remote_description(lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len) {
+    return impl_lrtc_peer_connection_copy_remote_description(pc, buffer, buffer_len);
+}
+
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_peer_connection_copy_remote_description_type(lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len) {
+    return impl_lrtc_peer_connection_copy_remote_description_type(pc, buffer, buffer_len);
+}
+
 LUMENRTC_API lrtc_peer_connection_t* LUMENRTC_CALL lrtc_peer_connection_create(lrtc_factory_t* factory, const lrtc_rtc_config_t* config, lrtc_media_constraints_t* constraints, const lrtc_peer_connection_callbacks_t* callbacks, void* user_data) {
     return impl_lrtc_peer_connection_create(factory, config, constraints, callbacks, user_data);
 }
@@ -419,10 +667,26 @@ LUMENRTC_API lrtc_data_channel_t* LUMENRTC_CALL lrtc_peer_connection_create_data
     return impl_lrtc_peer_connection_create_data_channel(pc, label, ordered, reliable, max_retransmit_time, max_retransmits, protocol, negotiated, id);
 }
 
+LUMENRTC_API lrtc_peer_connection_t* LUMENRTC_CALL lrtc_peer_connection_create_keyed(lrtc_factory_t* factory, const char* network_key, const lrtc_rtc_config_t* config, lrtc_media_constraints_t* constraints, const lrtc_peer_connection_callbacks_t* callbacks, void* user_data) {
+    return impl_lrtc_peer_connection_create_keyed(factory, network_key, config, constraints, callbacks, user_data);
+}
+
+LUMENRTC_API lrtc_layer_controller_t* LUMENRTC_CALL lrtc_peer_connection_create_layer_controller(lrtc_peer_connection_t* pc, lrtc_rtp_sender_t* sender, const lrtc_layer_controller_options_t* options, lrtc_layer_decision_cb callback, void* user_data) {
+    return impl_lrtc_peer_connection_create_layer_controller(pc, sender, options, callback, user_data);
+}
+
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_create_offer(lrtc_peer_connection_t* pc, lrtc_sdp_success_cb success, lrtc_sdp_error_cb failure, void* user_data, lrtc_media_constraints_t* constraints) {
     impl_lrtc_peer_connection_create_offer(pc, success, failure, user_data, constraints);
 }
 
+LUMENRTC_API lrtc_peer_connection_t* LUMENRTC_CALL lrtc_peer_connection_create_pooled(lrtc_factory_t* factory, const lrtc_peer_connection_callbacks_t* callbacks, void* user_data) {
+    return impl_lrtc_peer_connection_create_pooled(factory, callbacks, user_data);
+}
+
+LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_create_templated_offer(lrtc_peer_connection_t* pc, lrtc_session_template_t* session_template, lrtc_sdp_success_cb success, lrtc_sdp_error_cb failure, void* user_data, lrtc_media_constraints_t* constraints) {
+    impl_lrtc_peer_connection_create_templated_offer(pc, session_template, success, failure, user_data, constraints);
+}
+
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_get_local_description(lrtc_peer_connection_t* pc, lrtc_sdp_success_cb success, lrtc_sdp_error_cb failure, void* user_data) {
     impl_lrtc_peer_connection_get_local_description(pc, success, failure, user_data);
 }
@@ -435,6 +699,10 @@ LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_get_receiver_stats(lrtc_pee
     impl_lrtc_peer_connection_get_receiver_stats(pc, receiver, success, failure, user_data);
 }
 
+LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_peer_connection_get_receivers(lrtc_peer_connection_t* pc, lrtc_rtp_receiver_t** out_receivers, uint32_t capacity) {
+    return impl_lrtc_peer_connection_get_receivers(pc, out_receivers, capacity);
+}
+
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_get_remote_description(lrtc_peer_connection_t* pc, lrtc_sdp_success_cb success, lrtc_sdp_error_cb failure, void* user_data) {
     impl_lrtc_peer_connection_get_remote_description(pc, success, failure, user_data);
 }
@@ -447,6 +715,10 @@ LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_get_sender_stats(lrtc_peer_
     impl_lrtc_peer_connection_get_sender_stats(pc, sender, success, failure, user_data);
 }
 
+LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_peer_connection_get_senders(lrtc_peer_connection_t* pc, lrtc_rtp_sender_t** out_senders, uint32_t capacity) {
+    return impl_lrtc_peer_connection_get_senders(pc, out_senders, capacity);
+}
+
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_get_stats(lrtc_peer_connection_t* pc, lrtc_stats_success_cb success, lrtc_stats_failure_cb failure, void* user_data) {
     impl_lrtc_peer_connection_get_stats(pc, success, failure, user_data);
 }
@@ -455,6 +727,10 @@ LUMENRTC_API lrtc_rtp_transceiver_t* LUMENRTC_CALL lrtc_peer_connection_get_tran
     return impl_lrtc_peer_connection_get_transceiver(pc, index);
 }
 
+LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_peer_connection_get_transceivers(lrtc_peer_connection_t* pc, lrtc_rtp_transceiver_t** out_transceivers, uint32_t capacity) {
+    return impl_lrtc_peer_connection_get_transceivers(pc, out_transceivers, capacity);
+}
+
 LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_peer_connection_receiver_count(lrtc_peer_connection_t* pc) {
     return impl_lrtc_peer_connection_receiver_count(pc);
 }
@@ -479,6 +755,10 @@ LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_peer_connection_sender_count(lrtc_peer_
     return impl_lrtc_peer_connection_sender_count(pc);
 }
 
+LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_set_bandwidth_observer(lrtc_peer_connection_t* pc, uint32_t interval_ms, lrtc_bandwidth_estimate_cb callback, void* user_data) {
+    impl_lrtc_peer_connection_set_bandwidth_observer(pc, interval_ms, callback, user_data);
+}
+
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_set_callbacks(lrtc_peer_connection_t* pc, const lrtc_peer_connection_callbacks_t* callbacks, void* user_data) {
     impl_lrtc_peer_connection_set_callbacks(pc, callbacks, user_data);
 }
@@ -487,6 +767,10 @@ LUMENRTC_API int LUMENRTC_CALL lrtc_peer_connection_set_codec_preferences(lrtc_p
     return impl_lrtc_peer_connection_set_codec_preferences(pc, media_type, mime_types, mime_type_count);
 }
 
+LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_set_ice_candidate_batching(lrtc_peer_connection_t* pc, uint32_t window_ms, lrtc_ice_candidates_cb callback, void* user_data) {
+    impl_lrtc_peer_connection_set_ice_candidate_batching(pc, window_ms, callback, user_data);
+}
+
 LUMENRTC_API void LUMENRTC_CALL lrtc_peer_connection_set_local_description(lrtc_peer_connection_t* pc, const char* sdp, const char* type, lrtc_void_cb success, lrtc_sdp_error_cb failure, void* user_data) {
     impl_lrtc_peer_connection_set_local_description(pc, sdp, type, success, failure, user_data);
 }
@@ -511,6 +795,10 @@ LUMENRTC_API lrtc_audio_track_t* LUMENRTC_CALL lrtc_rtp_receiver_get_audio_track
     return impl_lrtc_rtp_receiver_get_audio_track(receiver);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_receiver_get_decode_stats(lrtc_rtp_receiver_t* receiver, lrtc_decode_on_demand_stats_t* out_stats) {
+    return impl_lrtc_rtp_receiver_get_decode_stats(receiver, out_stats);
+}
+
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_receiver_get_degradation_preference(lrtc_rtp_receiver_t* receiver) {
     return impl_lrtc_rtp_receiver_get_degradation_preference(receiver);
 }
@@ -559,6 +847,22 @@ LUMENRTC_API void LUMENRTC_CALL lrtc_rtp_receiver_release(lrtc_rtp_receiver_t* r
     impl_lrtc_rtp_receiver_release(receiver);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_receiver_request_key_frame(lrtc_rtp_receiver_t* receiver) {
+    return impl_lrtc_rtp_receiver_request_key_frame(receiver);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_receiver_set_decode_on_demand(lrtc_rtp_receiver_t* receiver, bool enabled) {
+    return impl_lrtc_rtp_receiver_set_decode_on_demand(receiver, enabled);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_receiver_set_encoded_frame_recorder(lrtc_rtp_receiver_t* receiver, lrtc_encoded_frame_recorder_t* recorder) {
+    return impl_lrtc_rtp_receiver_set_encoded_frame_recorder(receiver, recorder);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_receiver_set_encoded_frame_sink(lrtc_rtp_receiver_t* receiver, lrtc_encoded_frame_sink_t* sink) {
+    return impl_lrtc_rtp_receiver_set_encoded_frame_sink(receiver, sink);
+}
+
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_receiver_set_jitter_buffer_min_delay(lrtc_rtp_receiver_t* receiver, double delay_seconds) {
     return impl_lrtc_rtp_receiver_set_jitter_buffer_min_delay(receiver, delay_seconds);
 }
@@ -639,6 +943,18 @@ LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_sender_replace_video_track(lrtc_rtp_send
     return impl_lrtc_rtp_sender_replace_video_track(sender, track);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_sender_send_encoded_audio(lrtc_rtp_sender_t* sender, const char* mime_type, const uint8_t* data, uint32_t size, uint32_t rtp_timestamp) {
+    return impl_lrtc_rtp_sender_send_encoded_audio(sender, mime_type, data, size, rtp_timestamp);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_sender_send_encoded_frame(lrtc_rtp_sender_t* sender, lrtc_encoded_frame_t* frame) {
+    return impl_lrtc_rtp_sender_send_encoded_frame(sender, frame);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_sender_set_encoded_frame_input(lrtc_rtp_sender_t* sender, bool enabled) {
+    return impl_lrtc_rtp_sender_set_encoded_frame_input(sender, enabled);
+}
+
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_sender_set_encoding_parameters(lrtc_rtp_sender_t* sender, const lrtc_rtp_encoding_settings_t* settings) {
     return impl_lrtc_rtp_sender_set_encoding_parameters(sender, settings);
 }
@@ -647,6 +963,10 @@ LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_sender_set_encoding_parameters_at(lrtc_r
     return impl_lrtc_rtp_sender_set_encoding_parameters_at(sender, index, settings);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_rtp_sender_set_encodings(lrtc_rtp_sender_t* sender, const lrtc_rtp_encoding_settings_t* settings, uint32_t count, int degradation_preference) {
+    return impl_lrtc_rtp_sender_set_encodings(sender, settings, count, degradation_preference);
+}
+
 LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_sender_set_stream_ids(lrtc_rtp_sender_t* sender, const char** stream_ids, uint32_t stream_id_count) {
     return impl_lrtc_rtp_sender_set_stream_ids(sender, stream_ids, stream_id_count);
 }
@@ -707,10 +1027,46 @@ LUMENRTC_API int LUMENRTC_CALL lrtc_rtp_transceiver_stop(lrtc_rtp_transceiver_t*
     return impl_lrtc_rtp_transceiver_stop(transceiver, error, error_len);
 }
 
+LUMENRTC_API lrtc_session_template_t* LUMENRTC_CALL lrtc_session_template_create(void) {
+    return impl_lrtc_session_template_create();
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_session_template_get_stats(lrtc_session_template_t* session_template, lrtc_session_template_stats_t* out_stats) {
+    return impl_lrtc_session_template_get_stats(session_template, out_stats);
+}
+
+LUMENRTC_API void LUMENRTC_CALL lrtc_session_template_release(lrtc_session_template_t* session_template) {
+    impl_lrtc_session_template_release(session_template);
+}
+
+LUMENRTC_API void LUMENRTC_CALL lrtc_session_template_reset(lrtc_session_template_t* session_template) {
+    impl_lrtc_session_template_reset(session_template);
+}
+
 LUMENRTC_API void LUMENRTC_CALL lrtc_terminate(void) {
     impl_lrtc_terminate();
 }
 
+LUMENRTC_API uint32_t LUMENRTC_CALL lrtc_trace_drain(lrtc_trace_event_t* events, uint32_t capacity) {
+    return impl_lrtc_trace_drain(events, capacity);
+}
+
+LUMENRTC_API uint64_t LUMENRTC_CALL lrtc_trace_dropped_count(void) {
+    return impl_lrtc_trace_dropped_count();
+}
+
+LUMENRTC_API int32_t LUMENRTC_CALL lrtc_trace_format_chrome_json(const lrtc_trace_event_t* events, uint32_t count, char* buffer, uint32_t buffer_len) {
+    return impl_lrtc_trace_format_chrome_json(events, count, buffer, buffer_len);
+}
+
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_trace_start(uint32_t capacity) {
+    return impl_lrtc_trace_start(capacity);
+}
+
+LUMENRTC_API void LUMENRTC_CALL lrtc_trace_stop(void) {
+    impl_lrtc_trace_stop();
+}
+
 LUMENRTC_API bool LUMENRTC_CALL lrtc_video_capturer_capture_started(lrtc_video_capturer_t* capturer) {
     return impl_lrtc_video_capturer_capture_started(capturer);
 }
@@ -723,14 +1079,26 @@ LUMENRTC_API bool LUMENRTC_CALL lrtc_video_capturer_start(lrtc_video_capturer_t*
     return impl_lrtc_video_capturer_start(capturer);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_video_capturer_start_async(lrtc_video_capturer_t* capturer, lrtc_video_capture_started_cb callback, void* user_data) {
+    return impl_lrtc_video_capturer_start_async(capturer, callback, user_data);
+}
+
 LUMENRTC_API void LUMENRTC_CALL lrtc_video_capturer_stop(lrtc_video_capturer_t* capturer) {
     impl_lrtc_video_capturer_stop(capturer);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_video_capturer_stop_async(lrtc_video_capturer_t* capturer, lrtc_void_cb callback, void* user_data) {
+    return impl_lrtc_video_capturer_stop_async(capturer, callback, user_data);
+}
+
 LUMENRTC_API lrtc_video_capturer_t* LUMENRTC_CALL lrtc_video_device_create_capturer(lrtc_video_device_t* device, const char* name, uint32_t index, size_t width, size_t height, size_t target_fps) {
     return impl_lrtc_video_device_create_capturer(device, name, index, width, height, target_fps);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_video_device_create_capturer_async(lrtc_video_device_t* device, const char* name, uint32_t index, size_t width, size_t height, size_t target_fps, lrtc_video_capturer_created_cb callback, void* user_data) {
+    return impl_lrtc_video_device_create_capturer_async(device, name, index, width, height, target_fps, callback, user_data);
+}
+
 LUMENRTC_API int32_t LUMENRTC_CALL lrtc_video_device_get_device_name(lrtc_video_device_t* device, uint32_t index, char* name, uint32_t name_length, char* unique_id, uint32_t unique_id_length) {
     return impl_lrtc_video_device_get_device_name(device, index, name, name_length, unique_id, unique_id_length);
 }
@@ -759,6 +1127,10 @@ LUMENRTC_API const uint8_t* LUMENRTC_CALL lrtc_video_frame_data_y(lrtc_video_fra
     return impl_lrtc_video_frame_data_y(frame);
 }
 
+LUMENRTC_API int LUMENRTC_CALL lrtc_video_frame_format(lrtc_video_frame_t* frame) {
+    return impl_lrtc_video_frame_format(frame);
+}
+
 LUMENRTC_API int LUMENRTC_CALL lrtc_video_frame_height(lrtc_video_frame_t* frame) {
     return impl_lrtc_video_frame_height(frame);
 }
@@ -795,14 +1167,42 @@ LUMENRTC_API lrtc_video_sink_t* LUMENRTC_CALL lrtc_video_sink_create(const lrtc_
     return impl_lrtc_video_sink_create(callbacks, user_data);
 }
 
+LUMENRTC_API lrtc_video_sink_t* LUMENRTC_CALL lrtc_video_sink_create_with_wants(const lrtc_video_sink_callbacks_t* callbacks, const lrtc_video_sink_wants_t* wants, void* user_data) {
+    return impl_lrtc_video_sink_create_with_wants(callbacks, wants, user_data);
+}
+
 LUMENRTC_API void LUMENRTC_CALL lrtc_video_sink_release(lrtc_video_sink_t* sink) {
     impl_lrtc_video_sink_release(sink);
 }
 
+LUMENRTC_API uint64_t LUMENRTC_CALL lrtc_video_source_dropped_count(lrtc_video_source_t* source) {
+    return impl_lrtc_video_source_dropped_count(source);
+}
+
+LUMENRTC_API int LUMENRTC_CALL lrtc_video_source_push_argb(lrtc_video_source_t* source, const uint8_t* data, int stride, int width, int height, int format, int64_t timestamp_us, lrtc_void_cb release, void* user_data) {
+    return impl_lrtc_video_source_push_argb(source, data, stride, width, height, format, timestamp_us, release, user_data);
+}
+
+LUMENRTC_API int LUMENRTC_CALL lrtc_video_source_push_encoded(lrtc_video_source_t* source, const uint8_t* data, uint32_t size, int width, int height, bool key_frame, int64_t timestamp_us) {
+    return impl_lrtc_video_source_push_encoded(source, data, size, width, height, key_frame, timestamp_us);
+}
+
+LUMENRTC_API int LUMENRTC_CALL lrtc_video_source_push_i420(lrtc_video_source_t* source, const uint8_t* data_y, int stride_y, const uint8_t* data_u, int stride_u, const uint8_t* data_v, int stride_v, int width, int height, int64_t timestamp_us, lrtc_void_cb release, void* user_data) {
+    return impl_lrtc_video_source_push_i420(source, data_y, stride_y, data_u, stride_u, data_v, stride_v, width, height, timestamp_us, release, user_data);
+}
+
+LUMENRTC_API int LUMENRTC_CALL lrtc_video_source_push_nv12(lrtc_video_source_t* source, const uint8_t* data_y, int stride_y, const uint8_t* data_uv, int stride_uv, int width, int height, int64_t timestamp_us, lrtc_void_cb release, void* user_data) {
+    return impl_lrtc_video_source_push_nv12(source, data_y, stride_y, data_uv, stride_uv, width, height, timestamp_us, release, user_data);
+}
+
 LUMENRTC_API void LUMENRTC_CALL lrtc_video_source_release(lrtc_video_source_t* source) {
     impl_lrtc_video_source_release(source);
 }
 
+LUMENRTC_API lrtc_result_t LUMENRTC_CALL lrtc_video_source_set_key_frame_request_callback(lrtc_video_source_t* source, lrtc_void_cb callback, void* user_data) {
+    return impl_lrtc_video_source_set_key_frame_request_callback(source, callback, user_data);
+}
+
 LUMENRTC_API void LUMENRTC_CALL lrtc_video_track_add_sink(lrtc_video_track_t* track, lrtc_video_sink_t* sink) {
     impl_lrtc_video_track_add_sink(track, sink);
 }
@@ -1,5 +1,6 @@
 #include "lumenrtc_impl.h"
 
+#include "base/refcountedobject.h"
 #include "lumenrtc_bridge.h"
 #include "rtc_audio_device.h"
 #include "rtc_audio_source.h"
@@ -10,7 +11,12 @@
 #include "rtc_desktop_capturer.h"
 #include "rtc_desktop_device.h"
 #include "rtc_desktop_media_list.h"
+#include "rtc_encoded_frame.h"
+#include "rtc_encoded_frame_recorder.h"
+#include "rtc_frame_cryptor.h"
 #include "rtc_ice_candidate.h"
+#include "rtc_latency_tracer.h"
+#include "rtc_layer_controller.h"
 #include "rtc_logging.h"
 #include "rtc_media_stream.h"
 #include "rtc_media_track.h"
@@ -22,6 +28,7 @@
 #include "rtc_rtp_receiver.h"
 #include "rtc_rtp_transceiver.h"
 #include "rtc_session_description.h"
+#include "rtc_session_template.h"
 #include "rtc_video_device.h"
 #include "rtc_video_frame.h"
 #include "rtc_video_source.h"
@@ -44,6 +51,7 @@ using lumenrtc_bridge::RTCAudioTrack;
 using lumenrtc_bridge::RTCAudioDevice;
 using lumenrtc_bridge::RTCAudioOptions;
 using lumenrtc_bridge::RTCAudioSource;
+using lumenrtc_bridge::RTCBandwidthEstimate;
 using lumenrtc_bridge::RTCConfiguration;
 using lumenrtc_bridge::RTCDataChannel;
 using lumenrtc_bridge::RTCDataChannelInit;
@@ -53,7 +61,24 @@ using lumenrtc_bridge::RTCDtmfSenderObserver;
 using lumenrtc_bridge::RTCDesktopCapturer;
 using lumenrtc_bridge::RTCDesktopDevice;
 using lumenrtc_bridge::RTCDesktopMediaList;
+using lumenrtc_bridge::RTCDecodeOnDemandStats;
+using lumenrtc_bridge::RTCEncodedFrame;
+using lumenrtc_bridge::RTCEncodedFrameObserver;
+using lumenrtc_bridge::RTCEncodedFrameRecorder;
+using lumenrtc_bridge::RTCEncodedFrameRecorderOptions;
+using lumenrtc_bridge::RTCEncodedFrameRecorderStats;
+using lumenrtc_bridge::RTCFrameCryptionState;
+using lumenrtc_bridge::RTCFrameCryptor;
+using lumenrtc_bridge::RTCFrameCryptorObserver;
+using lumenrtc_bridge::FrameCryptorFactory;
+using lumenrtc_bridge::KeyProvider;
+using lumenrtc_bridge::KeyProviderOptions;
 using lumenrtc_bridge::RTCIceCandidate;
+using lumenrtc_bridge::RTCLatencyTracer;
+using lumenrtc_bridge::RTCLayerController;
+using lumenrtc_bridge::RTCLayerControllerObserver;
+using lumenrtc_bridge::RTCLayerControllerOptions;
+using lumenrtc_bridge::RTCLayerDecision;
 using lumenrtc_bridge::LumenRtcBridgeRuntimeLogging;
 using lumenrtc_bridge::RTCLoggingSeverity;
 using lumenrtc_bridge::RTCMediaConstraints;
@@ -68,10 +93,16 @@ using lumenrtc_bridge::RTCRtpCodecCapability;
 using lumenrtc_bridge::RTCRtpHeaderExtensionCapability;
 using lumenrtc_bridge::RTCRtpReceiver;
 using lumenrtc_bridge::RTCRtpTransceiver;
+using lumenrtc_bridge::RTCSessionTemplate;
 using lumenrtc_bridge::RTCDtlsTransport;
 using lumenrtc_bridge::RTCDtlsTransportInformation;
+using lumenrtc_bridge::RTCTraceEvent;
+using lumenrtc_bridge::RTCTraceScope;
+using lumenrtc_bridge::RTCTraceStage;
 using lumenrtc_bridge::RTCVideoFrame;
+using lumenrtc_bridge::RTCVideoPixelFormat;
 using lumenrtc_bridge::RTCVideoRenderer;
+using lumenrtc_bridge::RTCVideoSinkWants;
 using lumenrtc_bridge::RTCVideoSource;
 using lumenrtc_bridge::RTCVideoTrack;
 using lumenrtc_bridge::RTCVideoDevice;
@@ -370,6 +401,121 @@ static int32_t CopyPortableString(const string& value, char* buffer,
   return static_cast<int32_t>(len);
 }
 
+static vector<uint8_t> PortableBytes(const uint8_t* data, uint32_t size) {
+  if (!data || size == 0) {
+    return vector<uint8_t>();
+  }
+  return vector<uint8_t>(std::vector<uint8_t>(data, data + size));
+}
+
+// Like CopyPortableString, without the terminator.
+static int32_t CopyPortableBytes(const vector<uint8_t>& value,
+                                 uint8_t* buffer, uint32_t buffer_len) {
+  const size_t len = value.size();
+  if (!buffer) {
+    return static_cast<int32_t>(len);
+  }
+  if (buffer_len < len) {
+    return -1;
+  }
+  if (len > 0) {
+    std::memcpy(buffer, value.data(), len);
+  }
+  return static_cast<int32_t>(len);
+}
+
+static const char* TraceStageName(RTCTraceStage stage) {
+  switch (stage) {
+    case RTCTraceStage::kDesktopCapture:
+      return "desktop_capture";
+    case RTCTraceStage::kDesktopConvert:
+      return "desktop_convert";
+    case RTCTraceStage::kCaptureAdapt:
+      return "capture_adapt";
+    case RTCTraceStage::kVideoSinkAdapter:
+      return "video_sink_adapter";
+    case RTCTraceStage::kVideoSinkCallback:
+      return "video_sink_callback";
+    case RTCTraceStage::kAudioSinkAdapter:
+      return "audio_sink_adapter";
+    case RTCTraceStage::kAudioSinkCallback:
+      return "audio_sink_callback";
+  }
+  return "unknown";
+}
+
+static bool IsAudioTraceStage(RTCTraceStage stage) {
+  return stage == RTCTraceStage::kAudioSinkAdapter ||
+         stage == RTCTraceStage::kAudioSinkCallback;
+}
+
+static void FillTraceEvent(const RTCTraceEvent& src, lrtc_trace_event_t* dst) {
+  dst->start_us = src.start_us;
+  dst->duration_us = src.duration_us;
+  dst->frame_timestamp_us = src.frame_timestamp_us;
+  dst->source_id = src.source_id;
+  dst->thread_id = src.thread_id;
+  dst->stage = static_cast<lrtc_trace_stage>(src.stage);
+}
+
+// Chrome trace-event format ("X" complete events), loadable in Perfetto and
+// chrome://tracing.
+static std::string FormatChromeTrace(const lrtc_trace_event_t* events,
+                                     uint32_t count) {
+  std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  char line[320];
+  for (uint32_t i = 0; i < count; ++i) {
+    const lrtc_trace_event_t& e = events[i];
+    const RTCTraceStage stage = static_cast<RTCTraceStage>(e.stage);
+    std::snprintf(
+        line, sizeof(line),
+        "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%lld,"
+        "\"dur\":%lld,\"pid\":1,\"tid\":%u,\"args\":{\"frame_ts\":%lld,"
+        "\"source\":\"0x%llx\"}}",
+        i == 0 ? "" : ",", TraceStageName(stage),
+        IsAudioTraceStage(stage) ? "audio" : "video",
+        static_cast<long long>(e.start_us),
+        static_cast<long long>(e.duration_us), e.thread_id,
+        static_cast<long long>(e.frame_timestamp_us),
+        static_cast<unsigned long long>(e.source_id));
+    json += line;
+  }
+  json += "]}";
+  return json;
+}
+
+// Snapshot convention shared by the bulk getters: always returns the total
+// count, and writes one new handle per element only when |capacity| can hold
+// all of them, so callers never see a truncated list.
+template <typename Handle, typename Ref>
+static uint32_t FillHandleSnapshot(const vector<scoped_refptr<Ref>>& items,
+                                   Handle** out_handles, uint32_t capacity) {
+  const uint32_t count = static_cast<uint32_t>(items.size());
+  if (!out_handles || capacity < count) {
+    return count;
+  }
+  for (uint32_t i = 0; i < count; ++i) {
+    auto handle = new Handle();
+    handle->ref = items[i];
+    out_handles[i] = handle;
+  }
+  return count;
+}
+
+// Entry |index| of the list the last count or enumeration call took, so a
+// count-then-index loop asks the signaling thread once. A fresh list is
+// taken only past the end of the cached one.
+template <typename CachedAt, typename Fresh>
+static auto SnapshotEntry(uint32_t index, CachedAt cached_at, Fresh fresh)
+    -> decltype(cached_at(index)) {
+  auto entry = cached_at(index);
+  if (entry.get()) {
+    return entry;
+  }
+  auto items = fresh();
+  return index < items.size() ? items[index] : decltype(entry)();
+}
+
 struct LogCallbackState {
   std::mutex mutex;
   lrtc_log_message_cb callback = nullptr;
@@ -502,6 +648,40 @@ BuildCodecPreferences(
   return vector<scoped_refptr<RTCRtpCodecCapability>>(selected);
 }
 
+static lumenrtc_bridge::RTCThreadTuning ToThreadTuning(
+    const lrtc_thread_config_t& src) {
+  lumenrtc_bridge::RTCThreadTuning tuning;
+  tuning.cpu_mask = src.cpu_mask;
+  tuning.set_nice = src.set_nice;
+  tuning.nice = src.nice;
+  tuning.realtime = src.realtime;
+  if (src.realtime_priority > 0) {
+    tuning.realtime_priority = src.realtime_priority;
+  }
+  return tuning;
+}
+
+static lumenrtc_bridge::RTCVirtualNetworkOptions ToVirtualNetworkOptions(
+    const lrtc_virtual_network_options_t& src) {
+  lumenrtc_bridge::RTCVirtualNetworkOptions options;
+  options.enabled = src.enabled;
+  options.latency_ms = src.latency_ms;
+  options.jitter_ms = src.jitter_ms;
+  options.loss_rate = src.loss_rate;
+  options.bandwidth_bps = src.bandwidth_bps;
+  return options;
+}
+
+static void FillThreadReport(const lumenrtc_bridge::RTCThreadReport& src,
+                             lrtc_thread_report_t* dst) {
+  dst->applied = src.applied;
+  dst->cpu_mask = src.cpu_mask;
+  dst->nice = src.nice;
+  dst->realtime = src.realtime;
+  dst->priority = src.priority;
+  dst->failures = src.failures;
+}
+
 static void CopyConfig(const lrtc_rtc_config_t* src, RTCConfiguration* dst) {
   if (!dst) {
     return;
@@ -549,6 +729,20 @@ class PeerConnectionObserverImpl : public RTCPeerConnectionObserver {
  public:
   PeerConnectionObserverImpl() = default;
 
+  void SetIceCandidatesCallback(lrtc_ice_candidates_cb callback,
+                                void* user_data) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    candidates_cb_ = callback;
+    candidates_user_data_ = user_data;
+  }
+
+  void SetBandwidthCallback(lrtc_bandwidth_estimate_cb callback,
+                            void* user_data) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bandwidth_cb_ = callback;
+    bandwidth_user_data_ = user_data;
+  }
+
   void SetCallbacks(const lrtc_peer_connection_callbacks_t* callbacks,
                     void* user_data) {
     std::lock_guard<std::mutex> lock(mutex_);
@@ -604,6 +798,61 @@ class PeerConnectionObserverImpl : public RTCPeerConnectionObserver {
                                   cand.c_string());
   }
 
+  void OnBandwidthEstimate(const RTCBandwidthEstimate& estimate) override {
+    lrtc_bandwidth_estimate_cb callback = nullptr;
+    void* user_data = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      callback = bandwidth_cb_;
+      user_data = bandwidth_user_data_;
+    }
+    if (callback) {
+      callback(user_data, estimate.target_bitrate_bps,
+               estimate.stable_target_bitrate_bps,
+               estimate.encoder_target_bitrate_bps, estimate.encoder_count,
+               estimate.rtt_ms, estimate.loss_rate);
+    }
+  }
+
+  void OnIceCandidates(
+      vector<scoped_refptr<RTCIceCandidate>> candidates) override {
+    lrtc_ice_candidates_cb callback = nullptr;
+    void* user_data = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      callback = candidates_cb_;
+      user_data = candidates_user_data_;
+    }
+    if (!callback) {
+      RTCPeerConnectionObserver::OnIceCandidates(candidates);
+      return;
+    }
+    const size_t count = candidates.size();
+    // Reserved up front so the c_string() pointers stay put.
+    std::vector<string> mids;
+    std::vector<string> sdps;
+    mids.reserve(count);
+    sdps.reserve(count);
+    std::vector<const char*> mid_ptrs;
+    std::vector<const char*> sdp_ptrs;
+    std::vector<int> indexes;
+    for (size_t i = 0; i < count; ++i) {
+      if (!candidates[i].get()) {
+        continue;
+      }
+      mids.push_back(candidates[i]->sdp_mid());
+      sdps.push_back(candidates[i]->candidate());
+      mid_ptrs.push_back(mids.back().c_string());
+      sdp_ptrs.push_back(sdps.back().c_string());
+      indexes.push_back(candidates[i]->sdp_mline_index());
+    }
+    if (indexes.empty()) {
+      return;
+    }
+    callback(user_data, mid_ptrs.data(), indexes.data(), sdp_ptrs.data(),
+             static_cast<uint32_t>(indexes.size()));
+  }
+
   void OnAddStream(scoped_refptr<lumenrtc_bridge::RTCMediaStream> stream) override {
     (void)stream;
   }
@@ -698,6 +947,10 @@ class PeerConnectionObserverImpl : public RTCPeerConnectionObserver {
   std::mutex mutex_;
   lrtc_peer_connection_callbacks_t callbacks_{};
   void* user_data_ = nullptr;
+  lrtc_ice_candidates_cb candidates_cb_ = nullptr;
+  void* candidates_user_data_ = nullptr;
+  lrtc_bandwidth_estimate_cb bandwidth_cb_ = nullptr;
+  void* bandwidth_user_data_ = nullptr;
 };
 
 class DataChannelObserverImpl : public RTCDataChannelObserver {
@@ -793,6 +1046,61 @@ class DtmfSenderObserverImpl : public RTCDtmfSenderObserver {
   void* user_data_ = nullptr;
 };
 
+// The callback is fixed at creation, so no locking is needed.
+class LayerControllerObserverImpl : public RTCLayerControllerObserver {
+ public:
+  LayerControllerObserverImpl(lrtc_layer_decision_cb callback, void* user_data)
+      : callback_(callback), user_data_(user_data) {}
+
+  void OnLayerDecision(const RTCLayerDecision& decision) override {
+    callback_(user_data_, static_cast<int>(decision.reason),
+              decision.previous_level, decision.level,
+              decision.target_bitrate_bps, decision.loss_rate,
+              decision.rtt_ms);
+  }
+
+ private:
+  const lrtc_layer_decision_cb callback_;
+  void* const user_data_;
+};
+
+// The callback is fixed at creation, so no locking is needed. The frame
+// handle passed to it belongs to the host.
+class EncodedFrameSinkImpl : public RTCEncodedFrameObserver {
+ public:
+  EncodedFrameSinkImpl(lrtc_encoded_frame_cb callback, void* user_data)
+      : callback_(callback), user_data_(user_data) {}
+
+  void OnEncodedFrame(scoped_refptr<RTCEncodedFrame> frame) override {
+    auto handle = new lrtc_encoded_frame_t();
+    handle->ref = frame;
+    callback_(user_data_, handle);
+  }
+
+ private:
+  const lrtc_encoded_frame_cb callback_;
+  void* const user_data_;
+};
+
+// Like EncodedFrameSinkImpl; a new observer is made whenever the host sets
+// another callback.
+class FrameCryptorObserverImpl : public RTCFrameCryptorObserver {
+ public:
+  FrameCryptorObserverImpl(lrtc_frame_cryption_state_cb callback,
+                           void* user_data)
+      : callback_(callback), user_data_(user_data) {}
+
+  void OnFrameCryptionStateChanged(const string participant_id,
+                                   RTCFrameCryptionState state) override {
+    callback_(user_data_, participant_id.c_string(),
+              static_cast<int>(state));
+  }
+
+ private:
+  const lrtc_frame_cryption_state_cb callback_;
+  void* const user_data_;
+};
+
 class AudioSinkImpl : public lumenrtc_bridge::AudioTrackSink {
  public:
   AudioSinkImpl() = default;
@@ -820,6 +1128,7 @@ class AudioSinkImpl : public lumenrtc_bridge::AudioTrackSink {
     if (!callbacks.on_data) {
       return;
     }
+    RTCTraceScope trace(RTCTraceStage::kAudioSinkCallback, this);
     callbacks.on_data(user_data, audio_data, bits_per_sample, sample_rate,
                       number_of_channels, number_of_frames);
   }
@@ -845,6 +1154,10 @@ class VideoSinkImpl : public RTCVideoRenderer<scoped_refptr<RTCVideoFrame>> {
     user_data_ = user_data;
   }
 
+  // Fixed at creation; read when the sink is added to a track.
+  void SetWants(const RTCVideoSinkWants& wants) { wants_ = wants; }
+  const RTCVideoSinkWants& wants() const { return wants_; }
+
   void OnFrame(scoped_refptr<RTCVideoFrame> frame) override {
     lrtc_video_sink_callbacks_t callbacks;
     void* user_data = nullptr;
@@ -856,6 +1169,8 @@ class VideoSinkImpl : public RTCVideoRenderer<scoped_refptr<RTCVideoFrame>> {
     if (!callbacks.on_frame || !frame.get()) {
       return;
     }
+    RTCTraceScope trace(RTCTraceStage::kVideoSinkCallback, this,
+                        frame->timestamp_us());
     auto handle = AllocateVideoFrameHandle();
     handle->ref = frame;
     callbacks.on_frame(user_data, handle);
@@ -865,6 +1180,7 @@ class VideoSinkImpl : public RTCVideoRenderer<scoped_refptr<RTCVideoFrame>> {
   std::mutex mutex_;
   lrtc_video_sink_callbacks_t callbacks_{};
   void* user_data_ = nullptr;
+  RTCVideoSinkWants wants_;
 };
 
 extern "C" {
@@ -924,6 +1240,49 @@ void LUMENRTC_CALL lrtc_impl_logging_remove_callback(void) {
   LumenRtcBridgeRuntimeLogging::removeLogSink();
 }
 
+lrtc_result_t LUMENRTC_CALL lrtc_impl_trace_start(uint32_t capacity) {
+  return RTCLatencyTracer::Start(capacity) ? LRTC_OK : LRTC_INVALID_ARG;
+}
+
+void LUMENRTC_CALL lrtc_impl_trace_stop(void) {
+  RTCLatencyTracer::Stop();
+}
+
+uint32_t LUMENRTC_CALL lrtc_impl_trace_drain(lrtc_trace_event_t* events,
+                                             uint32_t capacity) {
+  if (!events || capacity == 0) {
+    return 0;
+  }
+  RTCTraceEvent chunk[64];
+  uint32_t written = 0;
+  while (written < capacity) {
+    const size_t want =
+        std::min<size_t>(capacity - written, sizeof(chunk) / sizeof(chunk[0]));
+    const size_t got = RTCLatencyTracer::Drain(chunk, want);
+    for (size_t i = 0; i < got; ++i) {
+      FillTraceEvent(chunk[i], &events[written++]);
+    }
+    if (got < want) {
+      break;
+    }
+  }
+  return written;
+}
+
+uint64_t LUMENRTC_CALL lrtc_impl_trace_dropped_count(void) {
+  return RTCLatencyTracer::DroppedCount();
+}
+
+int32_t LUMENRTC_CALL lrtc_impl_trace_format_chrome_json(
+    const lrtc_trace_event_t* events, uint32_t count, char* buffer,
+    uint32_t buffer_len) {
+  if (!events && count > 0) {
+    return -1;
+  }
+  return CopyPortableString(string(FormatChromeTrace(events, count)), buffer,
+                            buffer_len);
+}
+
 lrtc_factory_t* LUMENRTC_CALL lrtc_impl_factory_create(void) {
   auto handle = new lrtc_factory_t();
   handle->ref = lumenrtc_bridge::LumenRtcBridgeRuntime::CreateRTCPeerConnectionFactory();
@@ -934,6 +1293,57 @@ lrtc_factory_t* LUMENRTC_CALL lrtc_impl_factory_create(void) {
   return handle;
 }
 
+lrtc_factory_t* LUMENRTC_CALL lrtc_impl_factory_create_with_options(
+    const lrtc_factory_options_t* options, lrtc_factory_t* share_with) {
+  if (!options) {
+    return nullptr;
+  }
+  lumenrtc_bridge::RTCFactoryThreadOptions thread_options;
+  switch (options->thread_mode) {
+    case LRTC_FACTORY_THREADS_DEDICATED:
+      thread_options.mode =
+          lumenrtc_bridge::RTCFactoryThreadOptions::Mode::kDedicated;
+      break;
+    case LRTC_FACTORY_THREADS_SHARED:
+      if (!share_with || !share_with->ref.get()) {
+        return nullptr;
+      }
+      thread_options.mode =
+          lumenrtc_bridge::RTCFactoryThreadOptions::Mode::kShared;
+      thread_options.share_with = share_with->ref;
+      break;
+    case LRTC_FACTORY_THREADS_POOLED:
+      thread_options.mode =
+          lumenrtc_bridge::RTCFactoryThreadOptions::Mode::kPooled;
+      thread_options.pool_size = options->thread_pool_size;
+      break;
+    default:
+      return nullptr;
+  }
+  if (options->network_thread_count > 0) {
+    thread_options.network_thread_count = options->network_thread_count;
+  }
+  if (options->pin_network_threads) {
+    thread_options.network_first_cpu =
+        options->network_first_cpu > 0 ? options->network_first_cpu : 0;
+  }
+  thread_options.worker_thread = ToThreadTuning(options->worker_thread);
+  thread_options.signaling_thread = ToThreadTuning(options->signaling_thread);
+  thread_options.network_thread = ToThreadTuning(options->network_thread);
+  thread_options.capture_thread = ToThreadTuning(options->capture_thread);
+  thread_options.virtual_network =
+      ToVirtualNetworkOptions(options->virtual_network);
+  auto handle = new lrtc_factory_t();
+  handle->ref =
+      lumenrtc_bridge::LumenRtcBridgeRuntime::CreateRTCPeerConnectionFactory(
+          thread_options);
+  if (!handle->ref.get()) {
+    delete handle;
+    return nullptr;
+  }
+  return handle;
+}
+
 lrtc_result_t LUMENRTC_CALL lrtc_impl_factory_initialize(lrtc_factory_t* factory) {
   if (LrtcFailIfNull(factory) != LRTC_OK) {
     return LRTC_INVALID_ARG;
@@ -948,6 +1358,110 @@ void LUMENRTC_CALL lrtc_impl_factory_terminate(lrtc_factory_t* factory) {
   factory->ref->Terminate();
 }
 
+lrtc_result_t LUMENRTC_CALL lrtc_impl_factory_configure_certificate_cache(
+    lrtc_factory_t* factory, const lrtc_certificate_cache_options_t* options) {
+  if (!factory || !factory->ref.get() || !options) {
+    return LRTC_INVALID_ARG;
+  }
+  lumenrtc_bridge::RTCCertificateCacheOptions cache;
+  cache.enabled = options->enabled;
+  cache.size = options->size;
+  cache.rotation_interval_ms = options->rotation_interval_ms;
+  return factory->ref->ConfigureCertificateCache(cache) ? LRTC_OK
+                                                        : LRTC_INVALID_ARG;
+}
+
+int32_t LUMENRTC_CALL lrtc_impl_factory_export_certificate_pem(
+    lrtc_factory_t* factory, char* buffer, uint32_t buffer_len) {
+  if (!factory || !factory->ref.get()) {
+    return -1;
+  }
+  string pem = factory->ref->ExportCertificate();
+  if (pem.size() == 0) {
+    return -1;
+  }
+  return CopyPortableString(pem, buffer, buffer_len);
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_factory_import_certificate_pem(
+    lrtc_factory_t* factory, const char* pem) {
+  if (!factory || !factory->ref.get() || !pem) {
+    return LRTC_INVALID_ARG;
+  }
+  return factory->ref->ImportCertificate(string(pem)) ? LRTC_OK : LRTC_ERROR;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_factory_configure_peer_connection_pool(
+    lrtc_factory_t* factory, const lrtc_rtc_config_t* config,
+    lrtc_media_constraints_t* constraints, int size) {
+  if (!factory || !factory->ref.get() || size < 0) {
+    return LRTC_INVALID_ARG;
+  }
+  RTCConfiguration cfg;
+  if (config) {
+    CopyConfig(config, &cfg);
+  }
+  scoped_refptr<RTCMediaConstraints> mc;
+  if (constraints) {
+    mc = constraints->ref;
+  }
+  return factory->ref->ConfigurePeerConnectionPool(cfg, mc, size)
+             ? LRTC_OK
+             : LRTC_ERROR;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_factory_get_peer_connection_pool_stats(
+    lrtc_factory_t* factory, lrtc_peer_connection_pool_stats_t* out_stats) {
+  if (!factory || !factory->ref.get() || !out_stats) {
+    return LRTC_INVALID_ARG;
+  }
+  const lumenrtc_bridge::RTCPeerConnectionPoolStats stats =
+      factory->ref->GetPeerConnectionPoolStats();
+  out_stats->hits = stats.hits;
+  out_stats->misses = stats.misses;
+  out_stats->created = stats.created;
+  out_stats->discarded = stats.discarded;
+  out_stats->available = stats.available;
+  out_stats->target_size = stats.target_size;
+  return LRTC_OK;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_factory_configure_udp_mux(
+    lrtc_factory_t* factory, const lrtc_udp_mux_options_t* options) {
+  if (!factory || !factory->ref.get() || !options) {
+    return LRTC_INVALID_ARG;
+  }
+  lumenrtc_bridge::RTCUdpMuxOptions mux;
+  mux.enabled = options->enabled;
+  mux.port = options->port;
+  return factory->ref->ConfigureUdpMux(mux) ? LRTC_OK : LRTC_ERROR;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_factory_get_udp_mux_stats(
+    lrtc_factory_t* factory, lrtc_udp_mux_stats_t* out_stats) {
+  if (!factory || !factory->ref.get() || !out_stats) {
+    return LRTC_INVALID_ARG;
+  }
+  const lumenrtc_bridge::RTCUdpMuxStats stats = factory->ref->GetUdpMuxStats();
+  out_stats->address_hits = stats.address_hits;
+  out_stats->ufrag_hits = stats.ufrag_hits;
+  out_stats->misses = stats.misses;
+  out_stats->endpoints = stats.endpoints;
+  out_stats->ports = stats.ports;
+  return LRTC_OK;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_factory_set_virtual_network_conditions(
+    lrtc_factory_t* factory, const lrtc_virtual_network_options_t* options) {
+  if (!factory || !factory->ref.get() || !options) {
+    return LRTC_INVALID_ARG;
+  }
+  return factory->ref->SetVirtualNetworkConditions(
+             ToVirtualNetworkOptions(*options))
+             ? LRTC_OK
+             : LRTC_ERROR;
+}
+
 void LUMENRTC_CALL lrtc_impl_factory_release(lrtc_factory_t* factory) {
   delete factory;
 }
@@ -966,6 +1480,35 @@ lrtc_audio_device_t* LUMENRTC_CALL lrtc_impl_factory_get_audio_device(
   return handle;
 }
 
+lrtc_result_t LUMENRTC_CALL lrtc_impl_factory_get_thread_report(
+    lrtc_factory_t* factory, lrtc_thread_role role, uint32_t index,
+    lrtc_thread_report_t* out_report) {
+  if (!factory || !factory->ref.get() || !out_report) {
+    return LRTC_INVALID_ARG;
+  }
+  lumenrtc_bridge::RTCThreadRole bridge_role;
+  switch (role) {
+    case LRTC_THREAD_WORKER:
+      bridge_role = lumenrtc_bridge::RTCThreadRole::kWorker;
+      break;
+    case LRTC_THREAD_SIGNALING:
+      bridge_role = lumenrtc_bridge::RTCThreadRole::kSignaling;
+      break;
+    case LRTC_THREAD_NETWORK:
+      bridge_role = lumenrtc_bridge::RTCThreadRole::kNetwork;
+      break;
+    default:
+      // Capture threads are reported per capturer.
+      return LRTC_INVALID_ARG;
+  }
+  lumenrtc_bridge::RTCThreadReport report;
+  if (!factory->ref->GetThreadReport(bridge_role, index, &report)) {
+    return LRTC_ERROR;
+  }
+  FillThreadReport(report, out_report);
+  return LRTC_OK;
+}
+
 lrtc_video_device_t* LUMENRTC_CALL lrtc_impl_factory_get_video_device(
     lrtc_factory_t* factory) {
   if (!factory || !factory->ref.get()) {
@@ -1025,6 +1568,34 @@ lrtc_audio_source_t* LUMENRTC_CALL lrtc_impl_factory_create_audio_source(
   return handle;
 }
 
+lrtc_result_t LUMENRTC_CALL lrtc_impl_factory_create_audio_source_async(
+    lrtc_factory_t* factory, const char* label,
+    lrtc_audio_source_type source_type, const lrtc_audio_options_t* options,
+    lrtc_audio_source_created_cb callback, void* user_data) {
+  if (!factory || !factory->ref.get() || !label || !callback) {
+    return LRTC_INVALID_ARG;
+  }
+  RTCAudioOptions rtc_options;
+  if (options) {
+    rtc_options.echo_cancellation = options->echo_cancellation;
+    rtc_options.auto_gain_control = options->auto_gain_control;
+    rtc_options.noise_suppression = options->noise_suppression;
+    rtc_options.highpass_filter = options->highpass_filter;
+  }
+  const bool queued = factory->ref->CreateAudioSourceAsync(
+      string(label), static_cast<RTCAudioSource::SourceType>(source_type),
+      rtc_options,
+      [callback, user_data](scoped_refptr<RTCAudioSource> source) {
+        lrtc_audio_source_t* handle = nullptr;
+        if (source.get()) {
+          handle = new lrtc_audio_source_t();
+          handle->ref = source;
+        }
+        callback(user_data, handle);
+      });
+  return queued ? LRTC_OK : LRTC_ERROR;
+}
+
 lrtc_video_source_t* LUMENRTC_CALL lrtc_impl_factory_create_video_source(
     lrtc_factory_t* factory, lrtc_video_capturer_t* capturer,
     const char* label, lrtc_media_constraints_t* constraints) {
@@ -1046,6 +1617,61 @@ lrtc_video_source_t* LUMENRTC_CALL lrtc_impl_factory_create_video_source(
   return handle;
 }
 
+lrtc_result_t LUMENRTC_CALL lrtc_impl_factory_create_video_source_async(
+    lrtc_factory_t* factory, lrtc_video_capturer_t* capturer,
+    const char* label, lrtc_media_constraints_t* constraints,
+    lrtc_video_source_created_cb callback, void* user_data) {
+  if (!factory || !factory->ref.get() || !capturer || !capturer->ref.get() ||
+      !label || !callback) {
+    return LRTC_INVALID_ARG;
+  }
+  scoped_refptr<RTCMediaConstraints> mc;
+  if (constraints) {
+    mc = constraints->ref;
+  }
+  const bool queued = factory->ref->CreateVideoSourceAsync(
+      capturer->ref, string(label), mc,
+      [callback, user_data](scoped_refptr<RTCVideoSource> source) {
+        lrtc_video_source_t* handle = nullptr;
+        if (source.get()) {
+          handle = new lrtc_video_source_t();
+          handle->ref = source;
+        }
+        callback(user_data, handle);
+      });
+  return queued ? LRTC_OK : LRTC_ERROR;
+}
+
+lrtc_video_source_t* LUMENRTC_CALL lrtc_impl_factory_create_custom_video_source(
+    lrtc_factory_t* factory, const char* label, bool is_screencast) {
+  if (!factory || !factory->ref.get() || !label) {
+    return nullptr;
+  }
+  scoped_refptr<RTCVideoSource> source =
+      factory->ref->CreateCustomVideoSource(string(label), is_screencast);
+  if (!source.get()) {
+    return nullptr;
+  }
+  auto handle = new lrtc_video_source_t();
+  handle->ref = source;
+  return handle;
+}
+
+lrtc_video_source_t* LUMENRTC_CALL lrtc_impl_factory_create_encoded_video_source(
+    lrtc_factory_t* factory, const char* label, const char* codec) {
+  if (!factory || !factory->ref.get() || !label || !codec) {
+    return nullptr;
+  }
+  scoped_refptr<RTCVideoSource> source =
+      factory->ref->CreateEncodedVideoSource(string(label), string(codec));
+  if (!source.get()) {
+    return nullptr;
+  }
+  auto handle = new lrtc_video_source_t();
+  handle->ref = source;
+  return handle;
+}
+
 lrtc_video_source_t* LUMENRTC_CALL lrtc_impl_factory_create_desktop_source(
     lrtc_factory_t* factory, lrtc_desktop_capturer_t* capturer,
     const char* label, lrtc_media_constraints_t* constraints) {
@@ -1075,6 +1701,41 @@ lrtc_video_source_t* LUMENRTC_CALL lrtc_impl_factory_create_desktop_source(
 #endif
 }
 
+lrtc_result_t LUMENRTC_CALL lrtc_impl_factory_create_desktop_source_async(
+    lrtc_factory_t* factory, lrtc_desktop_capturer_t* capturer,
+    const char* label, lrtc_media_constraints_t* constraints,
+    lrtc_video_source_created_cb callback, void* user_data) {
+#ifdef RTC_DESKTOP_DEVICE
+  if (!factory || !factory->ref.get() || !capturer || !capturer->ref.get() ||
+      !label || !callback) {
+    return LRTC_INVALID_ARG;
+  }
+  scoped_refptr<RTCMediaConstraints> mc;
+  if (constraints) {
+    mc = constraints->ref;
+  }
+  const bool queued = factory->ref->CreateDesktopSourceAsync(
+      capturer->ref, string(label), mc,
+      [callback, user_data](scoped_refptr<RTCVideoSource> source) {
+        lrtc_video_source_t* handle = nullptr;
+        if (source.get()) {
+          handle = new lrtc_video_source_t();
+          handle->ref = source;
+        }
+        callback(user_data, handle);
+      });
+  return queued ? LRTC_OK : LRTC_ERROR;
+#else
+  (void)factory;
+  (void)capturer;
+  (void)label;
+  (void)constraints;
+  (void)callback;
+  (void)user_data;
+  return LRTC_NOT_IMPLEMENTED;
+#endif
+}
+
 lrtc_audio_track_t* LUMENRTC_CALL lrtc_impl_factory_create_audio_track(
     lrtc_factory_t* factory, lrtc_audio_source_t* source,
     const char* track_id) {
@@ -1092,6 +1753,26 @@ lrtc_audio_track_t* LUMENRTC_CALL lrtc_impl_factory_create_audio_track(
   return handle;
 }
 
+lrtc_result_t LUMENRTC_CALL lrtc_impl_factory_create_audio_track_async(
+    lrtc_factory_t* factory, lrtc_audio_source_t* source, const char* track_id,
+    lrtc_audio_track_created_cb callback, void* user_data) {
+  if (!factory || !factory->ref.get() || !source || !source->ref.get() ||
+      !track_id || !callback) {
+    return LRTC_INVALID_ARG;
+  }
+  const bool queued = factory->ref->CreateAudioTrackAsync(
+      source->ref, string(track_id),
+      [callback, user_data](scoped_refptr<RTCAudioTrack> track) {
+        lrtc_audio_track_t* handle = nullptr;
+        if (track.get()) {
+          handle = new lrtc_audio_track_t();
+          handle->ref = track;
+        }
+        callback(user_data, handle);
+      });
+  return queued ? LRTC_OK : LRTC_ERROR;
+}
+
 lrtc_video_track_t* LUMENRTC_CALL lrtc_impl_factory_create_video_track(
     lrtc_factory_t* factory, lrtc_video_source_t* source,
     const char* track_id) {
@@ -1109,6 +1790,26 @@ lrtc_video_track_t* LUMENRTC_CALL lrtc_impl_factory_create_video_track(
   return handle;
 }
 
+lrtc_result_t LUMENRTC_CALL lrtc_impl_factory_create_video_track_async(
+    lrtc_factory_t* factory, lrtc_video_source_t* source, const char* track_id,
+    lrtc_video_track_created_cb callback, void* user_data) {
+  if (!factory || !factory->ref.get() || !source || !source->ref.get() ||
+      !track_id || !callback) {
+    return LRTC_INVALID_ARG;
+  }
+  const bool queued = factory->ref->CreateVideoTrackAsync(
+      source->ref, string(track_id),
+      [callback, user_data](scoped_refptr<RTCVideoTrack> track) {
+        lrtc_video_track_t* handle = nullptr;
+        if (track.get()) {
+          handle = new lrtc_video_track_t();
+          handle->ref = track;
+        }
+        callback(user_data, handle);
+      });
+  return queued ? LRTC_OK : LRTC_ERROR;
+}
+
 lrtc_media_stream_t* LUMENRTC_CALL lrtc_impl_factory_create_stream(
     lrtc_factory_t* factory, const char* stream_id) {
   if (!factory || !factory->ref.get() || !stream_id) {
@@ -1157,25 +1858,91 @@ void LUMENRTC_CALL lrtc_impl_media_constraints_release(
   delete constraints;
 }
 
-int16_t LUMENRTC_CALL lrtc_impl_audio_device_playout_devices(
-    lrtc_audio_device_t* device) {
-  if (!device || !device->ref.get()) {
-    return -1;
+lrtc_session_template_t* LUMENRTC_CALL lrtc_impl_session_template_create(void) {
+  auto handle = new lrtc_session_template_t();
+  handle->ref = RTCSessionTemplate::Create();
+  if (!handle->ref.get()) {
+    delete handle;
+    return nullptr;
   }
-  return device->ref->PlayoutDevices();
+  return handle;
 }
 
-int16_t LUMENRTC_CALL lrtc_impl_audio_device_recording_devices(
-    lrtc_audio_device_t* device) {
-  if (!device || !device->ref.get()) {
-    return -1;
+lrtc_result_t LUMENRTC_CALL lrtc_impl_session_template_get_stats(
+    lrtc_session_template_t* session_template,
+    lrtc_session_template_stats_t* out_stats) {
+  if (!session_template || !session_template->ref.get() || !out_stats) {
+    return LRTC_INVALID_ARG;
   }
-  return device->ref->RecordingDevices();
+  const lumenrtc_bridge::RTCSessionTemplateStats stats =
+      session_template->ref->GetStats();
+  out_stats->hits = stats.hits;
+  out_stats->misses = stats.misses;
+  out_stats->template_size = stats.template_size;
+  return LRTC_OK;
 }
 
-int32_t LUMENRTC_CALL lrtc_impl_audio_device_playout_device_name(
-    lrtc_audio_device_t* device, uint16_t index, char* name,
-    uint32_t name_len, char* guid, uint32_t guid_len) {
+void LUMENRTC_CALL lrtc_impl_session_template_reset(
+    lrtc_session_template_t* session_template) {
+  if (!session_template || !session_template->ref.get()) {
+    return;
+  }
+  session_template->ref->Reset();
+}
+
+void LUMENRTC_CALL lrtc_impl_session_template_release(
+    lrtc_session_template_t* session_template) {
+  delete session_template;
+}
+
+int LUMENRTC_CALL lrtc_impl_layer_controller_get_level(
+    lrtc_layer_controller_t* controller) {
+  if (!controller || !controller->ref.get()) {
+    return 0;
+  }
+  return controller->ref->level();
+}
+
+int LUMENRTC_CALL lrtc_impl_layer_controller_get_max_level(
+    lrtc_layer_controller_t* controller) {
+  if (!controller || !controller->ref.get()) {
+    return 0;
+  }
+  return controller->ref->max_level();
+}
+
+void LUMENRTC_CALL lrtc_impl_layer_controller_release(
+    lrtc_layer_controller_t* controller) {
+  if (!controller) {
+    return;
+  }
+  // Stop() returns once no decision is running, so the observer can go.
+  if (controller->ref.get()) {
+    controller->ref->Stop();
+  }
+  delete controller->observer;
+  delete controller;
+}
+
+int16_t LUMENRTC_CALL lrtc_impl_audio_device_playout_devices(
+    lrtc_audio_device_t* device) {
+  if (!device || !device->ref.get()) {
+    return -1;
+  }
+  return device->ref->PlayoutDevices();
+}
+
+int16_t LUMENRTC_CALL lrtc_impl_audio_device_recording_devices(
+    lrtc_audio_device_t* device) {
+  if (!device || !device->ref.get()) {
+    return -1;
+  }
+  return device->ref->RecordingDevices();
+}
+
+int32_t LUMENRTC_CALL lrtc_impl_audio_device_playout_device_name(
+    lrtc_audio_device_t* device, uint16_t index, char* name,
+    uint32_t name_len, char* guid, uint32_t guid_len) {
   if (!device || !device->ref.get() || !name || !guid) {
     return -1;
   }
@@ -1425,6 +2192,27 @@ lrtc_desktop_capture_state LUMENRTC_CALL lrtc_impl_desktop_capturer_start(
 #endif
 }
 
+lrtc_result_t LUMENRTC_CALL lrtc_impl_desktop_capturer_start_async(
+    lrtc_desktop_capturer_t* capturer, uint32_t fps,
+    lrtc_desktop_capture_state_cb callback, void* user_data) {
+#ifdef RTC_DESKTOP_DEVICE
+  if (!capturer || !capturer->ref.get() || !callback) {
+    return LRTC_INVALID_ARG;
+  }
+  capturer->ref->StartAsync(
+      fps, [callback, user_data](RTCDesktopCapturer::CaptureState state) {
+        callback(user_data, static_cast<int>(state));
+      });
+  return LRTC_OK;
+#else
+  (void)capturer;
+  (void)fps;
+  (void)callback;
+  (void)user_data;
+  return LRTC_NOT_IMPLEMENTED;
+#endif
+}
+
 lrtc_desktop_capture_state LUMENRTC_CALL lrtc_impl_desktop_capturer_start_region(
     lrtc_desktop_capturer_t* capturer, uint32_t fps, uint32_t x, uint32_t y,
     uint32_t w, uint32_t h) {
@@ -1445,6 +2233,33 @@ lrtc_desktop_capture_state LUMENRTC_CALL lrtc_impl_desktop_capturer_start_region
 #endif
 }
 
+lrtc_result_t LUMENRTC_CALL lrtc_impl_desktop_capturer_start_region_async(
+    lrtc_desktop_capturer_t* capturer, uint32_t fps, uint32_t x, uint32_t y,
+    uint32_t w, uint32_t h, lrtc_desktop_capture_state_cb callback,
+    void* user_data) {
+#ifdef RTC_DESKTOP_DEVICE
+  if (!capturer || !capturer->ref.get() || !callback) {
+    return LRTC_INVALID_ARG;
+  }
+  capturer->ref->StartAsync(
+      fps, x, y, w, h,
+      [callback, user_data](RTCDesktopCapturer::CaptureState state) {
+        callback(user_data, static_cast<int>(state));
+      });
+  return LRTC_OK;
+#else
+  (void)capturer;
+  (void)fps;
+  (void)x;
+  (void)y;
+  (void)w;
+  (void)h;
+  (void)callback;
+  (void)user_data;
+  return LRTC_NOT_IMPLEMENTED;
+#endif
+}
+
 void LUMENRTC_CALL lrtc_impl_desktop_capturer_stop(
     lrtc_desktop_capturer_t* capturer) {
 #ifdef RTC_DESKTOP_DEVICE
@@ -1457,6 +2272,38 @@ void LUMENRTC_CALL lrtc_impl_desktop_capturer_stop(
 #endif
 }
 
+lrtc_result_t LUMENRTC_CALL lrtc_impl_desktop_capturer_stop_async(
+    lrtc_desktop_capturer_t* capturer, lrtc_void_cb callback,
+    void* user_data) {
+#ifdef RTC_DESKTOP_DEVICE
+  if (!capturer || !capturer->ref.get() || !callback) {
+    return LRTC_INVALID_ARG;
+  }
+  capturer->ref->StopAsync([callback, user_data]() { callback(user_data); });
+  return LRTC_OK;
+#else
+  (void)capturer;
+  (void)callback;
+  (void)user_data;
+  return LRTC_NOT_IMPLEMENTED;
+#endif
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_desktop_capturer_get_thread_report(
+    lrtc_desktop_capturer_t* capturer, lrtc_thread_report_t* out_report) {
+#ifdef RTC_DESKTOP_DEVICE
+  if (!capturer || !capturer->ref.get() || !out_report) {
+    return LRTC_INVALID_ARG;
+  }
+  FillThreadReport(capturer->ref->GetThreadReport(), out_report);
+  return LRTC_OK;
+#else
+  (void)capturer;
+  (void)out_report;
+  return LRTC_NOT_IMPLEMENTED;
+#endif
+}
+
 bool LUMENRTC_CALL lrtc_impl_desktop_capturer_is_running(
     lrtc_desktop_capturer_t* capturer) {
 #ifdef RTC_DESKTOP_DEVICE
@@ -1509,6 +2356,26 @@ lrtc_video_capturer_t* LUMENRTC_CALL lrtc_impl_video_device_create_capturer(
   return handle;
 }
 
+lrtc_result_t LUMENRTC_CALL lrtc_impl_video_device_create_capturer_async(
+    lrtc_video_device_t* device, const char* name, uint32_t index, size_t width,
+    size_t height, size_t target_fps, lrtc_video_capturer_created_cb callback,
+    void* user_data) {
+  if (!device || !device->ref.get() || !name || !callback) {
+    return LRTC_INVALID_ARG;
+  }
+  const bool queued = device->ref->CreateAsync(
+      name, index, width, height, target_fps,
+      [callback, user_data](scoped_refptr<RTCVideoCapturer> capturer) {
+        lrtc_video_capturer_t* handle = nullptr;
+        if (capturer.get()) {
+          handle = new lrtc_video_capturer_t();
+          handle->ref = capturer;
+        }
+        callback(user_data, handle);
+      });
+  return queued ? LRTC_OK : LRTC_ERROR;
+}
+
 void LUMENRTC_CALL lrtc_impl_video_device_release(lrtc_video_device_t* device) {
   delete device;
 }
@@ -1521,6 +2388,18 @@ bool LUMENRTC_CALL lrtc_impl_video_capturer_start(
   return capturer->ref->StartCapture();
 }
 
+lrtc_result_t LUMENRTC_CALL lrtc_impl_video_capturer_start_async(
+    lrtc_video_capturer_t* capturer, lrtc_video_capture_started_cb callback,
+    void* user_data) {
+  if (!capturer || !capturer->ref.get() || !callback) {
+    return LRTC_INVALID_ARG;
+  }
+  capturer->ref->StartCaptureAsync([callback, user_data](bool started) {
+    callback(user_data, started ? 1 : 0);
+  });
+  return LRTC_OK;
+}
+
 bool LUMENRTC_CALL lrtc_impl_video_capturer_capture_started(
     lrtc_video_capturer_t* capturer) {
   if (!capturer || !capturer->ref.get()) {
@@ -1537,6 +2416,16 @@ void LUMENRTC_CALL lrtc_impl_video_capturer_stop(
   capturer->ref->StopCapture();
 }
 
+lrtc_result_t LUMENRTC_CALL lrtc_impl_video_capturer_stop_async(
+    lrtc_video_capturer_t* capturer, lrtc_void_cb callback, void* user_data) {
+  if (!capturer || !capturer->ref.get() || !callback) {
+    return LRTC_INVALID_ARG;
+  }
+  capturer->ref->StopCaptureAsync(
+      [callback, user_data]() { callback(user_data); });
+  return LRTC_OK;
+}
+
 void LUMENRTC_CALL lrtc_impl_video_capturer_release(
     lrtc_video_capturer_t* capturer) {
   delete capturer;
@@ -1560,6 +2449,82 @@ void LUMENRTC_CALL lrtc_impl_video_source_release(lrtc_video_source_t* source) {
   delete source;
 }
 
+// Push-mode ingestion for sources created with
+// lrtc_factory_create_custom_video_source. When |release| is set the caller's
+// buffer may be referenced zero-copy until |release| runs; it runs exactly once
+// whenever the call returns 1, and never when it returns 0.
+int LUMENRTC_CALL lrtc_impl_video_source_push_i420(
+    lrtc_video_source_t* source, const uint8_t* data_y, int stride_y,
+    const uint8_t* data_u, int stride_u, const uint8_t* data_v, int stride_v,
+    int width, int height, int64_t timestamp_us, lrtc_void_cb release,
+    void* user_data) {
+  if (!source || !source->ref.get()) {
+    return 0;
+  }
+  return source->ref->PushI420Frame(data_y, stride_y, data_u, stride_u, data_v,
+                                    stride_v, width, height, timestamp_us,
+                                    release, user_data)
+             ? 1
+             : 0;
+}
+
+int LUMENRTC_CALL lrtc_impl_video_source_push_nv12(
+    lrtc_video_source_t* source, const uint8_t* data_y, int stride_y,
+    const uint8_t* data_uv, int stride_uv, int width, int height,
+    int64_t timestamp_us, lrtc_void_cb release, void* user_data) {
+  if (!source || !source->ref.get()) {
+    return 0;
+  }
+  return source->ref->PushNV12Frame(data_y, stride_y, data_uv, stride_uv,
+                                    width, height, timestamp_us, release,
+                                    user_data)
+             ? 1
+             : 0;
+}
+
+int LUMENRTC_CALL lrtc_impl_video_source_push_argb(
+    lrtc_video_source_t* source, const uint8_t* data, int stride, int width,
+    int height, int format, int64_t timestamp_us, lrtc_void_cb release,
+    void* user_data) {
+  if (!source || !source->ref.get()) {
+    return 0;
+  }
+  return source->ref->PushARGBFrame(data, stride, width, height, format,
+                                    timestamp_us, release, user_data)
+             ? 1
+             : 0;
+}
+
+uint64_t LUMENRTC_CALL lrtc_impl_video_source_dropped_count(
+    lrtc_video_source_t* source) {
+  if (!source || !source->ref.get()) {
+    return 0;
+  }
+  return source->ref->dropped_frames();
+}
+
+int LUMENRTC_CALL lrtc_impl_video_source_push_encoded(
+    lrtc_video_source_t* source, const uint8_t* data, uint32_t size,
+    int width, int height, bool key_frame, int64_t timestamp_us) {
+  if (!source || !source->ref.get()) {
+    return 0;
+  }
+  return source->ref->PushEncodedFrame(data, size, width, height, key_frame,
+                                       timestamp_us)
+             ? 1
+             : 0;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_video_source_set_key_frame_request_callback(
+    lrtc_video_source_t* source, lrtc_void_cb callback, void* user_data) {
+  if (!source || !source->ref.get()) {
+    return LRTC_INVALID_ARG;
+  }
+  return source->ref->SetKeyFrameRequestCallback(callback, user_data)
+             ? LRTC_OK
+             : LRTC_INVALID_ARG;
+}
+
 void LUMENRTC_CALL lrtc_impl_audio_track_set_volume(lrtc_audio_track_t* track,
                                                double volume) {
   if (!track || !track->ref.get()) {
@@ -1691,9 +2656,25 @@ void LUMENRTC_CALL lrtc_impl_media_stream_release(lrtc_media_stream_t* stream) {
   delete stream;
 }
 
-lrtc_peer_connection_t* LUMENRTC_CALL lrtc_impl_peer_connection_create(
-    lrtc_factory_t* factory, const lrtc_rtc_config_t* config,
-    lrtc_media_constraints_t* constraints,
+static lrtc_peer_connection_t* WrapPeerConnection(
+    lrtc_factory_t* factory, scoped_refptr<RTCPeerConnection> pc,
+    const lrtc_peer_connection_callbacks_t* callbacks, void* user_data) {
+  if (!pc.get()) {
+    return nullptr;
+  }
+  auto handle = new lrtc_peer_connection_t();
+  handle->ref = pc;
+  handle->factory = factory->ref;
+  auto* observer = new PeerConnectionObserverImpl();
+  observer->SetCallbacks(callbacks, user_data);
+  pc->RegisterRTCPeerConnectionObserver(observer);
+  handle->observer = observer;
+  return handle;
+}
+
+static lrtc_peer_connection_t* CreatePeerConnectionHandle(
+    lrtc_factory_t* factory, const char* network_key,
+    const lrtc_rtc_config_t* config, lrtc_media_constraints_t* constraints,
     const lrtc_peer_connection_callbacks_t* callbacks, void* user_data) {
   if (!factory || !factory->ref.get()) {
     return nullptr;
@@ -1710,18 +2691,39 @@ lrtc_peer_connection_t* LUMENRTC_CALL lrtc_impl_peer_connection_create(
     // Some lumenrtc_bridge wrappers assume non-null constraints.
     mc = RTCMediaConstraints::Create();
   }
-  scoped_refptr<RTCPeerConnection> pc = factory->ref->Create(cfg, mc);
-  if (!pc.get()) {
+  scoped_refptr<RTCPeerConnection> pc =
+      network_key ? factory->ref->Create(cfg, mc, string(network_key))
+                  : factory->ref->Create(cfg, mc);
+  return WrapPeerConnection(factory, pc, callbacks, user_data);
+}
+
+lrtc_peer_connection_t* LUMENRTC_CALL lrtc_impl_peer_connection_create(
+    lrtc_factory_t* factory, const lrtc_rtc_config_t* config,
+    lrtc_media_constraints_t* constraints,
+    const lrtc_peer_connection_callbacks_t* callbacks, void* user_data) {
+  return CreatePeerConnectionHandle(factory, nullptr, config, constraints,
+                                    callbacks, user_data);
+}
+
+lrtc_peer_connection_t* LUMENRTC_CALL lrtc_impl_peer_connection_create_keyed(
+    lrtc_factory_t* factory, const char* network_key,
+    const lrtc_rtc_config_t* config, lrtc_media_constraints_t* constraints,
+    const lrtc_peer_connection_callbacks_t* callbacks, void* user_data) {
+  if (!network_key) {
     return nullptr;
   }
-  auto handle = new lrtc_peer_connection_t();
-  handle->ref = pc;
-  handle->factory = factory->ref;
-  auto* observer = new PeerConnectionObserverImpl();
-  observer->SetCallbacks(callbacks, user_data);
-  pc->RegisterRTCPeerConnectionObserver(observer);
-  handle->observer = observer;
-  return handle;
+  return CreatePeerConnectionHandle(factory, network_key, config, constraints,
+                                    callbacks, user_data);
+}
+
+lrtc_peer_connection_t* LUMENRTC_CALL lrtc_impl_peer_connection_create_pooled(
+    lrtc_factory_t* factory, const lrtc_peer_connection_callbacks_t* callbacks,
+    void* user_data) {
+  if (!factory || !factory->ref.get()) {
+    return nullptr;
+  }
+  return WrapPeerConnection(factory, factory->ref->CreatePooled(), callbacks,
+                            user_data);
 }
 
 void LUMENRTC_CALL lrtc_impl_peer_connection_set_callbacks(
@@ -1740,6 +2742,29 @@ void LUMENRTC_CALL lrtc_impl_peer_connection_close(lrtc_peer_connection_t* pc) {
   pc->ref->Close();
 }
 
+void LUMENRTC_CALL lrtc_impl_peer_connection_connect_loopback(
+    lrtc_peer_connection_t* offerer, lrtc_peer_connection_t* answerer,
+    lrtc_void_cb success, lrtc_sdp_error_cb failure, void* user_data) {
+  if (!offerer || !offerer->ref.get() || !answerer || !answerer->ref.get()) {
+    if (failure) {
+      failure(user_data, "invalid arguments");
+    }
+    return;
+  }
+  offerer->ref->ConnectLoopback(
+      answerer->ref,
+      [success, user_data]() {
+        if (success) {
+          success(user_data);
+        }
+      },
+      [failure, user_data](const char* error) {
+        if (failure) {
+          failure(user_data, error);
+        }
+      });
+}
+
 void LUMENRTC_CALL lrtc_impl_peer_connection_release(lrtc_peer_connection_t* pc) {
   if (!pc) {
     return;
@@ -1784,6 +2809,42 @@ void LUMENRTC_CALL lrtc_impl_peer_connection_create_offer(
       mc);
 }
 
+void LUMENRTC_CALL lrtc_impl_peer_connection_create_templated_offer(
+    lrtc_peer_connection_t* pc, lrtc_session_template_t* session_template,
+    lrtc_sdp_success_cb success, lrtc_sdp_error_cb failure, void* user_data,
+    lrtc_media_constraints_t* constraints) {
+  if (!pc || !pc->ref.get()) {
+    if (failure) {
+      failure(user_data, "invalid arguments");
+    }
+    return;
+  }
+  scoped_refptr<RTCSessionTemplate> tmpl;
+  if (session_template) {
+    tmpl = session_template->ref;
+  }
+  scoped_refptr<RTCMediaConstraints> mc;
+  if (constraints) {
+    mc = constraints->ref;
+  }
+  if (!mc.get()) {
+    mc = RTCMediaConstraints::Create();
+  }
+  pc->ref->CreateTemplatedOffer(
+      tmpl,
+      [success, user_data](const string sdp, const string type) {
+        if (success) {
+          success(user_data, sdp.c_string(), type.c_string());
+        }
+      },
+      [failure, user_data](const char* error) {
+        if (failure) {
+          failure(user_data, error);
+        }
+      },
+      mc);
+}
+
 void LUMENRTC_CALL lrtc_impl_peer_connection_create_answer(
     lrtc_peer_connection_t* pc, lrtc_sdp_success_cb success,
     lrtc_sdp_error_cb failure, void* user_data,
@@ -1914,6 +2975,58 @@ void LUMENRTC_CALL lrtc_impl_peer_connection_get_remote_description(
       });
 }
 
+int32_t LUMENRTC_CALL lrtc_impl_peer_connection_copy_local_description(
+    lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len) {
+  if (!pc || !pc->ref.get()) {
+    return -1;
+  }
+  string sdp;
+  string type;
+  if (!pc->ref->CopyLocalDescription(sdp, type)) {
+    return -1;
+  }
+  return CopyPortableString(sdp, buffer, buffer_len);
+}
+
+int32_t LUMENRTC_CALL lrtc_impl_peer_connection_copy_local_description_type(
+    lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len) {
+  if (!pc || !pc->ref.get()) {
+    return -1;
+  }
+  string sdp;
+  string type;
+  if (!pc->ref->CopyLocalDescription(sdp, type)) {
+    return -1;
+  }
+  return CopyPortableString(type, buffer, buffer_len);
+}
+
+int32_t LUMENRTC_CALL lrtc_impl_peer_connection_copy_remote_description(
+    lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len) {
+  if (!pc || !pc->ref.get()) {
+    return -1;
+  }
+  string sdp;
+  string type;
+  if (!pc->ref->CopyRemoteDescription(sdp, type)) {
+    return -1;
+  }
+  return CopyPortableString(sdp, buffer, buffer_len);
+}
+
+int32_t LUMENRTC_CALL lrtc_impl_peer_connection_copy_remote_description_type(
+    lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len) {
+  if (!pc || !pc->ref.get()) {
+    return -1;
+  }
+  string sdp;
+  string type;
+  if (!pc->ref->CopyRemoteDescription(sdp, type)) {
+    return -1;
+  }
+  return CopyPortableString(type, buffer, buffer_len);
+}
+
 void LUMENRTC_CALL lrtc_impl_peer_connection_get_stats(
     lrtc_peer_connection_t* pc, lrtc_stats_success_cb success,
     lrtc_stats_failure_cb failure, void* user_data) {
@@ -2095,17 +3208,155 @@ int LUMENRTC_CALL lrtc_impl_peer_connection_add_ice_candidate_ex(
   return 1;
 }
 
-void LUMENRTC_CALL lrtc_impl_peer_connection_add_ice_candidate(
-    lrtc_peer_connection_t* pc, const char* sdp_mid, int sdp_mline_index,
-    const char* candidate) {
-  lrtc_impl_peer_connection_add_ice_candidate_ex(pc, sdp_mid, sdp_mline_index,
-                                            candidate);
-}
-
-bool LUMENRTC_CALL lrtc_impl_peer_connection_add_stream(
-    lrtc_peer_connection_t* pc, lrtc_media_stream_t* stream) {
-  if (!pc || !pc->ref.get() || !stream || !stream->ref.get()) {
-    return false;
+int LUMENRTC_CALL lrtc_impl_peer_connection_add_ice_candidates(
+    lrtc_peer_connection_t* pc, const char** sdp_mids,
+    const int* sdp_mline_indexes, const char** candidates, uint32_t count,
+    int* out_applied) {
+  if (out_applied) {
+    std::fill(out_applied, out_applied + count, 0);
+  }
+  const bool trace_ice_native = IsTraceIceNativeEnabled();
+  if (!pc || !pc->ref.get() || !sdp_mids || !sdp_mline_indexes ||
+      !candidates) {
+    if (trace_ice_native) {
+      std::fprintf(stderr,
+                   "[lumenrtc:ice] add candidates rejected: invalid args "
+                   "pc=%d count=%u\n",
+                   (pc && pc->ref.get()) ? 1 : 0, count);
+    }
+    return 0;
+  }
+  // Null entries keep their slot so results line up with the input.
+  std::vector<scoped_refptr<RTCIceCandidate>> parsed(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    if (!sdp_mids[i] || !candidates[i]) {
+      if (trace_ice_native) {
+        std::fprintf(stderr,
+                     "[lumenrtc:ice] add candidate rejected: invalid args "
+                     "index=%u mid=%d candidate=%d\n",
+                     i, sdp_mids[i] ? 1 : 0, candidates[i] ? 1 : 0);
+      }
+      continue;
+    }
+    lumenrtc_bridge::SdpParseError parse_error;
+    parsed[i] =
+        RTCIceCandidate::Create(string(candidates[i]), string(sdp_mids[i]),
+                                sdp_mline_indexes[i], &parse_error);
+    if (!parsed[i].get() && trace_ice_native) {
+      std::fprintf(
+          stderr,
+          "[lumenrtc:ice] add candidate parse failed: mid=%s mline=%d err=%s\n",
+          sdp_mids[i], sdp_mline_indexes[i],
+          parse_error.description.c_string());
+    }
+  }
+  std::vector<int> applied(count, 0);
+  const int result = pc->ref->AddCandidates(
+      vector<scoped_refptr<RTCIceCandidate>>(parsed), applied.data());
+  for (uint32_t i = 0; i < count; ++i) {
+    if (out_applied) {
+      out_applied[i] = applied[i];
+    }
+    if (!applied[i] && parsed[i].get() && trace_ice_native) {
+      std::fprintf(
+          stderr,
+          "[lumenrtc:ice] add candidate rejected by pc: mid=%s mline=%d\n",
+          sdp_mids[i], sdp_mline_indexes[i]);
+    }
+  }
+  return result;
+}
+
+void LUMENRTC_CALL lrtc_impl_peer_connection_set_bandwidth_observer(
+    lrtc_peer_connection_t* pc, uint32_t interval_ms,
+    lrtc_bandwidth_estimate_cb callback, void* user_data) {
+  if (!pc || !pc->ref.get() || !pc->observer) {
+    return;
+  }
+  const bool enabled = interval_ms > 0 && callback;
+  pc->observer->SetBandwidthCallback(enabled ? callback : nullptr,
+                                     enabled ? user_data : nullptr);
+  pc->ref->SetBandwidthEstimateInterval(
+      enabled ? static_cast<int>(std::min<uint32_t>(interval_ms, 60000)) : 0);
+}
+
+lrtc_layer_controller_t* LUMENRTC_CALL
+lrtc_impl_peer_connection_create_layer_controller(
+    lrtc_peer_connection_t* pc, lrtc_rtp_sender_t* sender,
+    const lrtc_layer_controller_options_t* options,
+    lrtc_layer_decision_cb callback, void* user_data) {
+  if (!pc || !pc->ref.get() || !sender || !sender->ref.get()) {
+    return nullptr;
+  }
+  // Zero fields keep their defaults.
+  RTCLayerControllerOptions native_options;
+  if (options) {
+    if (options->interval_ms > 0) {
+      native_options.interval_ms =
+          static_cast<int>(std::min<uint32_t>(options->interval_ms, 60000));
+    }
+    if (options->up_headroom > 0) {
+      native_options.up_headroom = options->up_headroom;
+    }
+    if (options->down_headroom > 0) {
+      native_options.down_headroom = options->down_headroom;
+    }
+    if (options->up_hold_ms > 0) {
+      native_options.up_hold_ms =
+          static_cast<int>(std::min<uint32_t>(options->up_hold_ms, 600000));
+    }
+    if (options->down_hold_ms > 0) {
+      native_options.down_hold_ms =
+          static_cast<int>(std::min<uint32_t>(options->down_hold_ms, 600000));
+    }
+    if (options->max_loss_rate > 0) {
+      native_options.max_loss_rate = options->max_loss_rate;
+    }
+    if (options->max_rtt_increase_ms > 0) {
+      native_options.max_rtt_increase_ms = static_cast<int>(
+          std::min<uint32_t>(options->max_rtt_increase_ms, 60000));
+    }
+    native_options.ignore_cpu = options->ignore_cpu;
+  }
+  scoped_refptr<RTCLayerController> controller =
+      pc->ref->CreateLayerController(sender->ref, native_options);
+  if (!controller.get()) {
+    return nullptr;
+  }
+  auto handle = new lrtc_layer_controller_t();
+  handle->ref = controller;
+  if (callback) {
+    handle->observer = new LayerControllerObserverImpl(callback, user_data);
+    controller->RegisterObserver(handle->observer);
+  }
+  return handle;
+}
+
+void LUMENRTC_CALL lrtc_impl_peer_connection_set_ice_candidate_batching(
+    lrtc_peer_connection_t* pc, uint32_t window_ms,
+    lrtc_ice_candidates_cb callback, void* user_data) {
+  if (!pc || !pc->ref.get() || !pc->observer) {
+    return;
+  }
+  const bool enabled = window_ms > 0 && callback;
+  pc->observer->SetIceCandidatesCallback(enabled ? callback : nullptr,
+                                         enabled ? user_data : nullptr);
+  // Windows longer than a minute only delay signaling; cap them there.
+  pc->ref->SetIceCandidateBatchWindow(
+      enabled ? static_cast<int>(std::min<uint32_t>(window_ms, 60000)) : 0);
+}
+
+void LUMENRTC_CALL lrtc_impl_peer_connection_add_ice_candidate(
+    lrtc_peer_connection_t* pc, const char* sdp_mid, int sdp_mline_index,
+    const char* candidate) {
+  lrtc_impl_peer_connection_add_ice_candidate_ex(pc, sdp_mid, sdp_mline_index,
+                                            candidate);
+}
+
+bool LUMENRTC_CALL lrtc_impl_peer_connection_add_stream(
+    lrtc_peer_connection_t* pc, lrtc_media_stream_t* stream) {
+  if (!pc || !pc->ref.get() || !stream || !stream->ref.get()) {
+    return false;
   }
   return pc->ref->AddStream(stream->ref) == 0;
 }
@@ -2307,11 +3558,9 @@ lrtc_rtp_sender_t* LUMENRTC_CALL lrtc_impl_peer_connection_get_sender(
   if (!pc || !pc->ref.get()) {
     return nullptr;
   }
-  vector<scoped_refptr<lumenrtc_bridge::RTCRtpSender>> senders = pc->ref->senders();
-  if (index >= senders.size()) {
-    return nullptr;
-  }
-  scoped_refptr<lumenrtc_bridge::RTCRtpSender> sender = senders[index];
+  scoped_refptr<lumenrtc_bridge::RTCRtpSender> sender =
+      SnapshotEntry(index, [pc](uint32_t i) { return pc->ref->sender_at(i); },
+                    [pc] { return pc->ref->senders(); });
   if (!sender.get()) {
     return nullptr;
   }
@@ -2320,6 +3569,15 @@ lrtc_rtp_sender_t* LUMENRTC_CALL lrtc_impl_peer_connection_get_sender(
   return handle;
 }
 
+uint32_t LUMENRTC_CALL lrtc_impl_peer_connection_get_senders(
+    lrtc_peer_connection_t* pc, lrtc_rtp_sender_t** out_senders,
+    uint32_t capacity) {
+  if (!pc || !pc->ref.get()) {
+    return 0;
+  }
+  return FillHandleSnapshot(pc->ref->senders(), out_senders, capacity);
+}
+
 uint32_t LUMENRTC_CALL lrtc_impl_peer_connection_receiver_count(
     lrtc_peer_connection_t* pc) {
   if (!pc || !pc->ref.get()) {
@@ -2333,12 +3591,9 @@ lrtc_rtp_receiver_t* LUMENRTC_CALL lrtc_impl_peer_connection_get_receiver(
   if (!pc || !pc->ref.get()) {
     return nullptr;
   }
-  vector<scoped_refptr<lumenrtc_bridge::RTCRtpReceiver>> receivers =
-      pc->ref->receivers();
-  if (index >= receivers.size()) {
-    return nullptr;
-  }
-  scoped_refptr<lumenrtc_bridge::RTCRtpReceiver> receiver = receivers[index];
+  scoped_refptr<lumenrtc_bridge::RTCRtpReceiver> receiver = SnapshotEntry(
+      index, [pc](uint32_t i) { return pc->ref->receiver_at(i); },
+      [pc] { return pc->ref->receivers(); });
   if (!receiver.get()) {
     return nullptr;
   }
@@ -2347,6 +3602,15 @@ lrtc_rtp_receiver_t* LUMENRTC_CALL lrtc_impl_peer_connection_get_receiver(
   return handle;
 }
 
+uint32_t LUMENRTC_CALL lrtc_impl_peer_connection_get_receivers(
+    lrtc_peer_connection_t* pc, lrtc_rtp_receiver_t** out_receivers,
+    uint32_t capacity) {
+  if (!pc || !pc->ref.get()) {
+    return 0;
+  }
+  return FillHandleSnapshot(pc->ref->receivers(), out_receivers, capacity);
+}
+
 uint32_t LUMENRTC_CALL lrtc_impl_peer_connection_transceiver_count(
     lrtc_peer_connection_t* pc) {
   if (!pc || !pc->ref.get()) {
@@ -2360,13 +3624,10 @@ lrtc_rtp_transceiver_t* LUMENRTC_CALL lrtc_impl_peer_connection_get_transceiver(
   if (!pc || !pc->ref.get()) {
     return nullptr;
   }
-  vector<scoped_refptr<lumenrtc_bridge::RTCRtpTransceiver>> transceivers =
-      pc->ref->transceivers();
-  if (index >= transceivers.size()) {
-    return nullptr;
-  }
   scoped_refptr<lumenrtc_bridge::RTCRtpTransceiver> transceiver =
-      transceivers[index];
+      SnapshotEntry(index,
+                    [pc](uint32_t i) { return pc->ref->transceiver_at(i); },
+                    [pc] { return pc->ref->transceivers(); });
   if (!transceiver.get()) {
     return nullptr;
   }
@@ -2375,6 +3636,16 @@ lrtc_rtp_transceiver_t* LUMENRTC_CALL lrtc_impl_peer_connection_get_transceiver(
   return handle;
 }
 
+uint32_t LUMENRTC_CALL lrtc_impl_peer_connection_get_transceivers(
+    lrtc_peer_connection_t* pc, lrtc_rtp_transceiver_t** out_transceivers,
+    uint32_t capacity) {
+  if (!pc || !pc->ref.get()) {
+    return 0;
+  }
+  return FillHandleSnapshot(pc->ref->transceivers(), out_transceivers,
+                            capacity);
+}
+
 lrtc_data_channel_t* LUMENRTC_CALL lrtc_impl_peer_connection_create_data_channel(
     lrtc_peer_connection_t* pc, const char* label, int ordered, int reliable,
     int max_retransmit_time, int max_retransmits, const char* protocol,
@@ -2453,6 +3724,35 @@ lrtc_video_sink_t* LUMENRTC_CALL lrtc_impl_video_sink_create(
   return handle;
 }
 
+lrtc_video_sink_t* LUMENRTC_CALL lrtc_impl_video_sink_create_with_wants(
+    const lrtc_video_sink_callbacks_t* callbacks,
+    const lrtc_video_sink_wants_t* wants, void* user_data) {
+  lrtc_video_sink_t* handle = lrtc_impl_video_sink_create(callbacks, user_data);
+  if (wants) {
+    RTCVideoSinkWants native_wants;
+    native_wants.max_pixel_count = static_cast<int>(
+        std::min<uint32_t>(wants->max_pixel_count, INT32_MAX));
+    native_wants.max_framerate =
+        static_cast<int>(std::min<uint32_t>(wants->max_framerate, 1000));
+    if (wants->resolution_alignment > 0) {
+      native_wants.resolution_alignment =
+          static_cast<int>(std::min<uint32_t>(wants->resolution_alignment, 64));
+    }
+    if (wants->format >= LRTC_VIDEO_PIXEL_FORMAT_NATIVE &&
+        wants->format <= LRTC_VIDEO_PIXEL_FORMAT_BGRA) {
+      native_wants.format = static_cast<RTCVideoPixelFormat>(wants->format);
+    }
+    if (wants->width > 0 && wants->height > 0) {
+      native_wants.width =
+          static_cast<int>(std::min<uint32_t>(wants->width, 16384));
+      native_wants.height =
+          static_cast<int>(std::min<uint32_t>(wants->height, 16384));
+    }
+    handle->renderer->SetWants(native_wants);
+  }
+  return handle;
+}
+
 void LUMENRTC_CALL lrtc_impl_video_sink_release(lrtc_video_sink_t* sink) {
   if (!sink) {
     return;
@@ -2467,7 +3767,7 @@ void LUMENRTC_CALL lrtc_impl_video_track_add_sink(lrtc_video_track_t* track,
   if (!track || !track->ref.get() || !sink || !sink->renderer) {
     return;
   }
-  track->ref->AddRenderer(sink->renderer);
+  track->ref->AddRenderer(sink->renderer, sink->renderer->wants());
 }
 
 void LUMENRTC_CALL lrtc_impl_video_track_remove_sink(lrtc_video_track_t* track,
@@ -2520,6 +3820,13 @@ int LUMENRTC_CALL lrtc_impl_video_frame_width(lrtc_video_frame_t* frame) {
   return frame->ref->width();
 }
 
+int LUMENRTC_CALL lrtc_impl_video_frame_format(lrtc_video_frame_t* frame) {
+  if (!frame || !frame->ref.get()) {
+    return -1;
+  }
+  return static_cast<int>(frame->ref->format());
+}
+
 int LUMENRTC_CALL lrtc_impl_video_frame_height(lrtc_video_frame_t* frame) {
   if (!frame || !frame->ref.get()) {
     return 0;
@@ -2572,23 +3879,54 @@ const uint8_t* LUMENRTC_CALL lrtc_impl_video_frame_data_v(lrtc_video_frame_t* fr
 int LUMENRTC_CALL lrtc_impl_video_frame_copy_i420(
     lrtc_video_frame_t* frame, uint8_t* dst_y, int dst_stride_y,
     uint8_t* dst_u, int dst_stride_u, uint8_t* dst_v, int dst_stride_v) {
-  if (!frame || !frame->ref.get()) {
+  if (!frame || !frame->ref.get() || !dst_y || !dst_u || !dst_v) {
     return 0;
   }
   const uint8_t* src_y = frame->ref->DataY();
   const uint8_t* src_u = frame->ref->DataU();
   const uint8_t* src_v = frame->ref->DataV();
-  if (!src_y || !src_u || !src_v || !dst_y || !dst_u || !dst_v) {
+  const int width = frame->ref->width();
+  const int height = frame->ref->height();
+  switch (frame->ref->format()) {
+    case RTCVideoPixelFormat::kNV12:
+      if (!src_y || !src_u) {
+        return 0;
+      }
+      return libyuv::NV12ToI420(src_y, frame->ref->StrideY(),
+                                src_u, frame->ref->StrideU(),
+                                dst_y, dst_stride_y,
+                                dst_u, dst_stride_u,
+                                dst_v, dst_stride_v,
+                                width, height) == 0 ? 1 : 0;
+    case RTCVideoPixelFormat::kARGB:
+    case RTCVideoPixelFormat::kBGRA: {
+      if (!src_y) {
+        return 0;
+      }
+      const auto to_i420 =
+          frame->ref->format() == RTCVideoPixelFormat::kBGRA
+              ? libyuv::BGRAToI420
+              : libyuv::ARGBToI420;
+      return to_i420(src_y, frame->ref->StrideY(),
+                     dst_y, dst_stride_y,
+                     dst_u, dst_stride_u,
+                     dst_v, dst_stride_v,
+                     width, height) == 0 ? 1 : 0;
+    }
+    default:
+      break;
+  }
+  if (!src_y || !src_u || !src_v) {
     return 0;
   }
-  
+
   return libyuv::I420Copy(src_y, frame->ref->StrideY(),
                           src_u, frame->ref->StrideU(),
                           src_v, frame->ref->StrideV(),
                           dst_y, dst_stride_y,
                           dst_u, dst_stride_u,
                           dst_v, dst_stride_v,
-                          frame->ref->width(), frame->ref->height()) == 0 ? 1 : 0;
+                          width, height) == 0 ? 1 : 0;
 }
 
 int LUMENRTC_CALL lrtc_impl_video_frame_to_argb(
@@ -2616,180 +3954,618 @@ void LUMENRTC_CALL lrtc_impl_video_frame_release(lrtc_video_frame_t* frame) {
   FreeVideoFrameHandle(frame);
 }
 
-int LUMENRTC_CALL lrtc_impl_rtp_sender_set_encoding_parameters(
-    lrtc_rtp_sender_t* sender, const lrtc_rtp_encoding_settings_t* settings) {
-  if (!sender || !sender->ref.get() || !settings) {
-    return 0;
+lrtc_encoded_frame_sink_t* LUMENRTC_CALL lrtc_impl_encoded_frame_sink_create(
+    lrtc_encoded_frame_cb callback, void* user_data) {
+  if (!callback) {
+    return nullptr;
   }
-  scoped_refptr<lumenrtc_bridge::RTCRtpParameters> parameters =
-      sender->ref->parameters();
-  if (!parameters.get()) {
-    return 0;
+  auto handle = new lrtc_encoded_frame_sink_t();
+  handle->observer = new EncodedFrameSinkImpl(callback, user_data);
+  return handle;
+}
+
+void LUMENRTC_CALL lrtc_impl_encoded_frame_sink_release(
+    lrtc_encoded_frame_sink_t* sink) {
+  if (!sink) {
+    return;
   }
+  // A receiver may still hold the observer; the host need not detach first.
+  RTCRtpReceiver::DetachEncodedFrameObserver(sink->observer);
+  delete sink->observer;
+  sink->observer = nullptr;
+  delete sink;
+}
 
-  vector<scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters>> encodings =
-      parameters->encodings();
+const uint8_t* LUMENRTC_CALL lrtc_impl_encoded_frame_data(
+    lrtc_encoded_frame_t* frame) {
+  if (!frame || !frame->ref.get()) {
+    return nullptr;
+  }
+  return frame->ref->data();
+}
 
-  std::vector<scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters>> list;
-  list.reserve(encodings.size());
-  for (size_t i = 0; i < encodings.size(); ++i) {
-    list.push_back(encodings[i]);
+uint32_t LUMENRTC_CALL lrtc_impl_encoded_frame_size(
+    lrtc_encoded_frame_t* frame) {
+  if (!frame || !frame->ref.get()) {
+    return 0;
   }
+  return static_cast<uint32_t>(frame->ref->size());
+}
 
-  if (list.empty()) {
-    scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters> created =
-        lumenrtc_bridge::RTCRtpEncodingParameters::Create();
-    if (created.get()) {
-      list.push_back(created);
+lrtc_result_t LUMENRTC_CALL lrtc_impl_encoded_frame_get_info(
+    lrtc_encoded_frame_t* frame, lrtc_encoded_frame_info_t* out_info) {
+  if (!frame || !frame->ref.get() || !out_info) {
+    return LRTC_INVALID_ARG;
+  }
+  const scoped_refptr<RTCEncodedFrame>& ref = frame->ref;
+  out_info->media_type = static_cast<int>(ref->media_type());
+  out_info->rtp_timestamp = ref->rtp_timestamp();
+  out_info->ssrc = ref->ssrc();
+  out_info->payload_type = ref->payload_type();
+  out_info->is_key_frame = ref->is_key_frame();
+  out_info->width = ref->width();
+  out_info->height = ref->height();
+  out_info->frame_id = ref->frame_id();
+  out_info->spatial_index = ref->spatial_index();
+  out_info->temporal_index = ref->temporal_index();
+  out_info->dependency_count =
+      static_cast<uint32_t>(ref->dependencies().size());
+  return LRTC_OK;
+}
+
+uint32_t LUMENRTC_CALL lrtc_impl_encoded_frame_get_dependencies(
+    lrtc_encoded_frame_t* frame, int64_t* out_frame_ids, uint32_t capacity) {
+  if (!frame || !frame->ref.get()) {
+    return 0;
+  }
+  vector<int64_t> ids = frame->ref->dependencies();
+  uint32_t count = static_cast<uint32_t>(ids.size());
+  if (out_frame_ids && capacity >= count) {
+    for (uint32_t i = 0; i < count; ++i) {
+      out_frame_ids[i] = ids[i];
     }
   }
+  return count;
+}
 
-  if (list.empty()) {
-    return 0;
+int32_t LUMENRTC_CALL lrtc_impl_encoded_frame_get_mime_type(
+    lrtc_encoded_frame_t* frame, char* buffer, uint32_t buffer_len) {
+  if (!frame || !frame->ref.get()) {
+    return -1;
   }
+  return CopyPortableString(frame->ref->mime_type(), buffer, buffer_len);
+}
 
-  for (size_t i = 0; i < list.size(); ++i) {
-    scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters> encoding = list[i];
-    if (!encoding.get()) {
-      continue;
-    }
+lrtc_encoded_frame_t* LUMENRTC_CALL lrtc_impl_encoded_frame_retain(
+    lrtc_encoded_frame_t* frame) {
+  if (!frame || !frame->ref.get()) {
+    return nullptr;
+  }
+  auto handle = new lrtc_encoded_frame_t();
+  handle->ref = frame->ref;
+  return handle;
+}
 
-    if (settings->max_bitrate_bps >= 0) {
-      encoding->set_max_bitrate_bps(settings->max_bitrate_bps);
-    }
-    if (settings->min_bitrate_bps >= 0) {
-      encoding->set_min_bitrate_bps(settings->min_bitrate_bps);
-    }
-    if (settings->max_framerate > 0.0) {
-      encoding->set_max_framerate(settings->max_framerate);
-    }
-    if (settings->scale_resolution_down_by > 0.0) {
-      encoding->set_scale_resolution_down_by(
-          settings->scale_resolution_down_by);
-    }
-    if (settings->active >= 0) {
-      encoding->set_active(settings->active != 0);
-    }
-    if (settings->bitrate_priority >= 0.0) {
-      encoding->set_bitrate_priority(settings->bitrate_priority);
+void LUMENRTC_CALL lrtc_impl_encoded_frame_release(
+    lrtc_encoded_frame_t* frame) {
+  delete frame;
+}
+
+lrtc_encoded_frame_recorder_t* LUMENRTC_CALL
+lrtc_impl_encoded_frame_recorder_create(
+    const char* path, const lrtc_encoded_frame_recorder_options_t* options) {
+  if (!path || !*path) {
+    return nullptr;
+  }
+  // Zero sizes and intervals keep their defaults.
+  RTCEncodedFrameRecorderOptions native_options;
+  if (options) {
+    if (options->max_queued_bytes > 0) {
+      native_options.max_queued_bytes = options->max_queued_bytes;
     }
-    if (settings->network_priority >= 0 &&
-        settings->network_priority <= 3) {
-      encoding->set_network_priority(
-          static_cast<lumenrtc_bridge::RTCPriority>(settings->network_priority));
+    if (options->write_buffer_bytes > 0) {
+      native_options.write_buffer_bytes = options->write_buffer_bytes;
     }
-    if (settings->num_temporal_layers >= 0) {
-      encoding->set_num_temporal_layers(settings->num_temporal_layers);
+    if (options->sync_policy < LRTC_RECORDING_SYNC_NONE ||
+        options->sync_policy > LRTC_RECORDING_SYNC_INTERVAL) {
+      return nullptr;
     }
-    if (settings->scalability_mode && settings->scalability_mode[0] != '\0') {
-      encoding->set_scalability_mode(string(settings->scalability_mode));
+    native_options.sync_policy =
+        static_cast<lumenrtc_bridge::RTCRecordingSyncPolicy>(
+            options->sync_policy);
+    if (options->sync_interval_ms > 0) {
+      native_options.sync_interval_ms = static_cast<int>(
+          std::min<uint32_t>(options->sync_interval_ms, 3600000));
     }
-    if (settings->rid && settings->rid[0] != '\0') {
-      encoding->set_rid(string(settings->rid));
+  }
+  scoped_refptr<RTCEncodedFrameRecorder> recorder =
+      RTCEncodedFrameRecorder::Create(string(path), native_options);
+  if (!recorder.get()) {
+    return nullptr;
+  }
+  auto handle = new lrtc_encoded_frame_recorder_t();
+  handle->ref = recorder;
+  return handle;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_encoded_frame_recorder_get_stats(
+    lrtc_encoded_frame_recorder_t* recorder,
+    lrtc_encoded_frame_recorder_stats_t* out_stats) {
+  if (!recorder || !recorder->ref.get() || !out_stats) {
+    return LRTC_INVALID_ARG;
+  }
+  RTCEncodedFrameRecorderStats stats = recorder->ref->GetStats();
+  out_stats->frames_written = stats.frames_written;
+  out_stats->bytes_written = stats.bytes_written;
+  out_stats->frames_dropped = stats.frames_dropped;
+  out_stats->queued_bytes = stats.queued_bytes;
+  out_stats->write_failed = stats.write_failed;
+  return LRTC_OK;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_encoded_frame_recorder_stop(
+    lrtc_encoded_frame_recorder_t* recorder) {
+  if (!recorder || !recorder->ref.get()) {
+    return LRTC_INVALID_ARG;
+  }
+  return recorder->ref->Stop() ? LRTC_OK : LRTC_ERROR;
+}
+
+void LUMENRTC_CALL lrtc_impl_encoded_frame_recorder_release(
+    lrtc_encoded_frame_recorder_t* recorder) {
+  if (!recorder) {
+    return;
+  }
+  // The file is completed even if the host never stopped the recording. A
+  // receiver may still hold the recorder as a raw observer.
+  if (recorder->ref.get()) {
+    RTCRtpReceiver::DetachEncodedFrameObserver(recorder->ref.get());
+    recorder->ref->Stop();
+  }
+  delete recorder;
+}
+
+lrtc_key_provider_t* LUMENRTC_CALL lrtc_impl_key_provider_create(
+    const lrtc_key_provider_options_t* options) {
+  KeyProviderOptions native_options;
+  if (options) {
+    // A zero ring size keeps the default.
+    if (options->key_ring_size < 0 ||
+        options->key_ring_size > MAX_KEYRING_SIZE ||
+        options->ratchet_window_size < 0) {
+      return nullptr;
     }
-    if (settings->adaptive_ptime >= 0) {
-      encoding->set_adaptive_ptime(settings->adaptive_ptime != 0);
+    native_options.shared_key = options->shared_key;
+    native_options.ratchet_salt =
+        PortableBytes(options->ratchet_salt, options->ratchet_salt_len);
+    native_options.uncrypted_magic_bytes = PortableBytes(
+        options->uncrypted_magic_bytes, options->uncrypted_magic_bytes_len);
+    native_options.ratchet_window_size = options->ratchet_window_size;
+    native_options.failure_tolerance = options->failure_tolerance;
+    if (options->key_ring_size > 0) {
+      native_options.key_ring_size = options->key_ring_size;
     }
+    native_options.discard_frame_when_cryptor_not_ready =
+        options->discard_frame_when_cryptor_not_ready;
   }
+  scoped_refptr<KeyProvider> provider = KeyProvider::Create(&native_options);
+  if (!provider.get()) {
+    return nullptr;
+  }
+  auto handle = new lrtc_key_provider_t();
+  handle->ref = provider;
+  return handle;
+}
 
-  parameters->set_encodings(
-      vector<scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters>>(list));
+lrtc_result_t LUMENRTC_CALL lrtc_impl_key_provider_set_shared_key(
+    lrtc_key_provider_t* provider, int key_index, const uint8_t* key,
+    uint32_t key_len) {
+  if (!provider || !provider->ref.get() || !key || key_len == 0) {
+    return LRTC_INVALID_ARG;
+  }
+  return provider->ref->SetSharedKey(key_index, PortableBytes(key, key_len))
+             ? LRTC_OK
+             : LRTC_ERROR;
+}
 
-  if (settings->degradation_preference >= 0) {
-    parameters->SetDegradationPreference(
-        static_cast<lumenrtc_bridge::RTCDegradationPreference>(
-            settings->degradation_preference));
+lrtc_result_t LUMENRTC_CALL lrtc_impl_key_provider_set_key(
+    lrtc_key_provider_t* provider, const char* participant_id, int key_index,
+    const uint8_t* key, uint32_t key_len) {
+  if (!provider || !provider->ref.get() || !participant_id || !key ||
+      key_len == 0) {
+    return LRTC_INVALID_ARG;
   }
+  return provider->ref->SetKey(string(participant_id), key_index,
+                               PortableBytes(key, key_len))
+             ? LRTC_OK
+             : LRTC_ERROR;
+}
 
-  return sender->ref->set_parameters(parameters) ? 1 : 0;
+lrtc_result_t LUMENRTC_CALL lrtc_impl_key_provider_ratchet_shared_key(
+    lrtc_key_provider_t* provider, int key_index) {
+  if (!provider || !provider->ref.get()) {
+    return LRTC_INVALID_ARG;
+  }
+  vector<uint8_t> key = provider->ref->RatchetSharedKey(key_index);
+  return key.size() > 0 ? LRTC_OK : LRTC_ERROR;
 }
 
-int LUMENRTC_CALL lrtc_impl_rtp_sender_set_encoding_parameters_at(
-    lrtc_rtp_sender_t* sender, uint32_t index,
+lrtc_result_t LUMENRTC_CALL lrtc_impl_key_provider_ratchet_key(
+    lrtc_key_provider_t* provider, const char* participant_id,
+    int key_index) {
+  if (!provider || !provider->ref.get() || !participant_id) {
+    return LRTC_INVALID_ARG;
+  }
+  vector<uint8_t> key =
+      provider->ref->RatchetKey(string(participant_id), key_index);
+  return key.size() > 0 ? LRTC_OK : LRTC_ERROR;
+}
+
+// Zero if there is no such key.
+int32_t LUMENRTC_CALL lrtc_impl_key_provider_export_shared_key(
+    lrtc_key_provider_t* provider, int key_index, uint8_t* buffer,
+    uint32_t buffer_len) {
+  if (!provider || !provider->ref.get()) {
+    return -1;
+  }
+  return CopyPortableBytes(provider->ref->ExportSharedKey(key_index), buffer,
+                           buffer_len);
+}
+
+int32_t LUMENRTC_CALL lrtc_impl_key_provider_export_key(
+    lrtc_key_provider_t* provider, const char* participant_id, int key_index,
+    uint8_t* buffer, uint32_t buffer_len) {
+  if (!provider || !provider->ref.get() || !participant_id) {
+    return -1;
+  }
+  return CopyPortableBytes(
+      provider->ref->ExportKey(string(participant_id), key_index), buffer,
+      buffer_len);
+}
+
+void LUMENRTC_CALL lrtc_impl_key_provider_set_sif_trailer(
+    lrtc_key_provider_t* provider, const uint8_t* trailer,
+    uint32_t trailer_len) {
+  if (!provider || !provider->ref.get()) {
+    return;
+  }
+  provider->ref->SetSifTrailer(PortableBytes(trailer, trailer_len));
+}
+
+int32_t LUMENRTC_CALL lrtc_impl_key_provider_encrypt(
+    lrtc_key_provider_t* provider, const char* participant_id, int key_index,
+    uint8_t* data, uint32_t size, uint32_t capacity) {
+  if (!provider || !provider->ref.get() || !participant_id || !data ||
+      capacity < static_cast<uint64_t>(size) + LRTC_FRAME_CRYPTO_OVERHEAD) {
+    return -1;
+  }
+  return provider->ref->EncryptPayload(string(participant_id), key_index,
+                                       data, size, capacity);
+}
+
+int32_t LUMENRTC_CALL lrtc_impl_key_provider_decrypt(
+    lrtc_key_provider_t* provider, const char* participant_id, uint8_t* data,
+    uint32_t size) {
+  if (!provider || !provider->ref.get() || !participant_id || !data) {
+    return -1;
+  }
+  return provider->ref->DecryptPayload(string(participant_id), data, size);
+}
+
+void LUMENRTC_CALL lrtc_impl_key_provider_release(
+    lrtc_key_provider_t* provider) {
+  delete provider;
+}
+
+static bool ValidFrameCryptoAlgorithm(int algorithm) {
+  return algorithm >= LRTC_FRAME_CRYPTO_AES_GCM &&
+         algorithm <= LRTC_FRAME_CRYPTO_AES_CBC;
+}
+
+lrtc_frame_cryptor_t* LUMENRTC_CALL lrtc_impl_frame_cryptor_create_for_sender(
+    lrtc_rtp_sender_t* sender, const char* participant_id, int algorithm,
+    lrtc_key_provider_t* key_provider) {
+  if (!sender || !sender->ref.get() || !participant_id || !key_provider ||
+      !key_provider->ref.get() || !ValidFrameCryptoAlgorithm(algorithm)) {
+    return nullptr;
+  }
+  scoped_refptr<RTCFrameCryptor> cryptor =
+      FrameCryptorFactory::frameCryptorFromRtpSender(
+          nullptr, string(participant_id), sender->ref,
+          static_cast<lumenrtc_bridge::Algorithm>(algorithm),
+          key_provider->ref);
+  if (!cryptor.get()) {
+    return nullptr;
+  }
+  auto handle = new lrtc_frame_cryptor_t();
+  handle->ref = cryptor;
+  return handle;
+}
+
+lrtc_frame_cryptor_t* LUMENRTC_CALL
+lrtc_impl_frame_cryptor_create_for_receiver(
+    lrtc_rtp_receiver_t* receiver, const char* participant_id, int algorithm,
+    lrtc_key_provider_t* key_provider) {
+  if (!receiver || !receiver->ref.get() || !participant_id || !key_provider ||
+      !key_provider->ref.get() || !ValidFrameCryptoAlgorithm(algorithm)) {
+    return nullptr;
+  }
+  scoped_refptr<RTCFrameCryptor> cryptor =
+      FrameCryptorFactory::frameCryptorFromRtpReceiver(
+          nullptr, string(participant_id), receiver->ref,
+          static_cast<lumenrtc_bridge::Algorithm>(algorithm),
+          key_provider->ref);
+  if (!cryptor.get()) {
+    return nullptr;
+  }
+  auto handle = new lrtc_frame_cryptor_t();
+  handle->ref = cryptor;
+  return handle;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_frame_cryptor_set_enabled(
+    lrtc_frame_cryptor_t* cryptor, bool enabled) {
+  if (!cryptor || !cryptor->ref.get()) {
+    return LRTC_INVALID_ARG;
+  }
+  return cryptor->ref->SetEnabled(enabled) ? LRTC_OK : LRTC_ERROR;
+}
+
+bool LUMENRTC_CALL lrtc_impl_frame_cryptor_get_enabled(
+    lrtc_frame_cryptor_t* cryptor) {
+  return cryptor && cryptor->ref.get() && cryptor->ref->enabled();
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_frame_cryptor_set_key_index(
+    lrtc_frame_cryptor_t* cryptor, int index) {
+  if (!cryptor || !cryptor->ref.get()) {
+    return LRTC_INVALID_ARG;
+  }
+  return cryptor->ref->SetKeyIndex(index) ? LRTC_OK : LRTC_INVALID_ARG;
+}
+
+int LUMENRTC_CALL lrtc_impl_frame_cryptor_get_key_index(
+    lrtc_frame_cryptor_t* cryptor) {
+  if (!cryptor || !cryptor->ref.get()) {
+    return -1;
+  }
+  return cryptor->ref->key_index();
+}
+
+void LUMENRTC_CALL lrtc_impl_frame_cryptor_set_observer(
+    lrtc_frame_cryptor_t* cryptor, lrtc_frame_cryption_state_cb callback,
+    void* user_data) {
+  if (!cryptor || !cryptor->ref.get()) {
+    return;
+  }
+  if (!callback) {
+    cryptor->ref->DeRegisterRTCFrameCryptorObserver();
+    return;
+  }
+  cryptor->ref->RegisterRTCFrameCryptorObserver(
+      new lumenrtc_bridge::RefCountedObject<FrameCryptorObserverImpl>(
+          callback, user_data));
+}
+
+void LUMENRTC_CALL lrtc_impl_frame_cryptor_release(
+    lrtc_frame_cryptor_t* cryptor) {
+  if (!cryptor) {
+    return;
+  }
+  // No callback runs once this returns, even while a frame is in flight.
+  if (cryptor->ref.get()) {
+    cryptor->ref->DeRegisterRTCFrameCryptorObserver();
+  }
+  delete cryptor;
+}
+
+// Applies the fields of |settings| that are set (non-negative, or non-empty
+// for strings) to |encoding|.
+static void ApplyEncodingSettings(
+    const scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters>& encoding,
     const lrtc_rtp_encoding_settings_t* settings) {
-  if (!sender || !sender->ref.get() || !settings) {
-    return 0;
+  if (!encoding.get()) {
+    return;
   }
-  scoped_refptr<lumenrtc_bridge::RTCRtpParameters> parameters =
-      sender->ref->parameters();
-  if (!parameters.get()) {
-    return 0;
+  if (settings->max_bitrate_bps >= 0) {
+    encoding->set_max_bitrate_bps(settings->max_bitrate_bps);
+  }
+  if (settings->min_bitrate_bps >= 0) {
+    encoding->set_min_bitrate_bps(settings->min_bitrate_bps);
+  }
+  if (settings->max_framerate > 0.0) {
+    encoding->set_max_framerate(settings->max_framerate);
   }
+  if (settings->scale_resolution_down_by > 0.0) {
+    encoding->set_scale_resolution_down_by(settings->scale_resolution_down_by);
+  }
+  if (settings->active >= 0) {
+    encoding->set_active(settings->active != 0);
+  }
+  if (settings->bitrate_priority >= 0.0) {
+    encoding->set_bitrate_priority(settings->bitrate_priority);
+  }
+  if (settings->network_priority >= 0 && settings->network_priority <= 3) {
+    encoding->set_network_priority(
+        static_cast<lumenrtc_bridge::RTCPriority>(settings->network_priority));
+  }
+  if (settings->num_temporal_layers >= 0) {
+    encoding->set_num_temporal_layers(settings->num_temporal_layers);
+  }
+  if (settings->scalability_mode && settings->scalability_mode[0] != '\0') {
+    encoding->set_scalability_mode(string(settings->scalability_mode));
+  }
+  if (settings->rid && settings->rid[0] != '\0') {
+    encoding->set_rid(string(settings->rid));
+  }
+  if (settings->adaptive_ptime >= 0) {
+    encoding->set_adaptive_ptime(settings->adaptive_ptime != 0);
+  }
+}
 
+// Encodings of |parameters| to edit. A sender without negotiated encodings
+// gets a single default one.
+static std::vector<scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters>>
+EditableEncodings(
+    const scoped_refptr<lumenrtc_bridge::RTCRtpParameters>& parameters) {
   vector<scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters>> encodings =
       parameters->encodings();
-
   std::vector<scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters>> list;
   list.reserve(encodings.size());
   for (size_t i = 0; i < encodings.size(); ++i) {
     list.push_back(encodings[i]);
   }
-
   if (list.empty()) {
-    if (index != 0) {
-      return 0;
-    }
     scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters> created =
         lumenrtc_bridge::RTCRtpEncodingParameters::Create();
     if (created.get()) {
       list.push_back(created);
     }
   }
+  return list;
+}
+
+// Writes |list| and |degradation_preference| (negative keeps the current
+// one) back with a single set_parameters transaction. Each transaction hops
+// to the worker thread and may reconfigure the encoder, so it is skipped
+// when nothing differs from |parameters|.
+static bool CommitEncodings(
+    lrtc_rtp_sender_t* sender,
+    const scoped_refptr<lumenrtc_bridge::RTCRtpParameters>& parameters,
+    const std::vector<scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters>>&
+        list,
+    int degradation_preference) {
+  bool changed =
+      degradation_preference >= 0 &&
+      parameters->GetDegradationPreference() !=
+          static_cast<lumenrtc_bridge::RTCDegradationPreference>(
+              degradation_preference);
+  vector<scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters>> current =
+      parameters->encodings();
+  if (current.size() != list.size()) {
+    changed = true;
+  }
+  for (size_t i = 0; !changed && i < list.size(); ++i) {
+    changed = !list[i].get() || *list[i] != current[i];
+  }
+  if (!changed) {
+    return true;
+  }
+
+  parameters->set_encodings(
+      vector<scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters>>(list));
+  if (degradation_preference >= 0) {
+    parameters->SetDegradationPreference(
+        static_cast<lumenrtc_bridge::RTCDegradationPreference>(
+            degradation_preference));
+  }
+  return sender->ref->set_parameters(parameters);
+}
 
+int LUMENRTC_CALL lrtc_impl_rtp_sender_set_encoding_parameters(
+    lrtc_rtp_sender_t* sender, const lrtc_rtp_encoding_settings_t* settings) {
+  if (!sender || !sender->ref.get() || !settings) {
+    return 0;
+  }
+  scoped_refptr<lumenrtc_bridge::RTCRtpParameters> parameters =
+      sender->ref->parameters();
+  if (!parameters.get()) {
+    return 0;
+  }
+
+  std::vector<scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters>> list =
+      EditableEncodings(parameters);
+  if (list.empty()) {
+    return 0;
+  }
+  for (size_t i = 0; i < list.size(); ++i) {
+    ApplyEncodingSettings(list[i], settings);
+  }
+
+  return CommitEncodings(sender, parameters, list,
+                         settings->degradation_preference)
+             ? 1
+             : 0;
+}
+
+int LUMENRTC_CALL lrtc_impl_rtp_sender_set_encoding_parameters_at(
+    lrtc_rtp_sender_t* sender, uint32_t index,
+    const lrtc_rtp_encoding_settings_t* settings) {
+  if (!sender || !sender->ref.get() || !settings) {
+    return 0;
+  }
+  scoped_refptr<lumenrtc_bridge::RTCRtpParameters> parameters =
+      sender->ref->parameters();
+  if (!parameters.get()) {
+    return 0;
+  }
+
+  std::vector<scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters>> list =
+      EditableEncodings(parameters);
   if (index >= list.size()) {
     return 0;
   }
+  ApplyEncodingSettings(list[index], settings);
 
-  scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters> encoding = list[index];
-  if (encoding.get()) {
-    if (settings->max_bitrate_bps >= 0) {
-      encoding->set_max_bitrate_bps(settings->max_bitrate_bps);
-    }
-    if (settings->min_bitrate_bps >= 0) {
-      encoding->set_min_bitrate_bps(settings->min_bitrate_bps);
-    }
-    if (settings->max_framerate > 0.0) {
-      encoding->set_max_framerate(settings->max_framerate);
-    }
-    if (settings->scale_resolution_down_by > 0.0) {
-      encoding->set_scale_resolution_down_by(
-          settings->scale_resolution_down_by);
-    }
-    if (settings->active >= 0) {
-      encoding->set_active(settings->active != 0);
-    }
-    if (settings->bitrate_priority >= 0.0) {
-      encoding->set_bitrate_priority(settings->bitrate_priority);
-    }
-    if (settings->network_priority >= 0 &&
-        settings->network_priority <= 3) {
-      encoding->set_network_priority(
-          static_cast<lumenrtc_bridge::RTCPriority>(settings->network_priority));
-    }
-    if (settings->num_temporal_layers >= 0) {
-      encoding->set_num_temporal_layers(settings->num_temporal_layers);
-    }
-    if (settings->scalability_mode && settings->scalability_mode[0] != '\0') {
-      encoding->set_scalability_mode(string(settings->scalability_mode));
-    }
-    if (settings->rid && settings->rid[0] != '\0') {
-      encoding->set_rid(string(settings->rid));
-    }
-    if (settings->adaptive_ptime >= 0) {
-      encoding->set_adaptive_ptime(settings->adaptive_ptime != 0);
-    }
+  return CommitEncodings(sender, parameters, list,
+                         settings->degradation_preference)
+             ? 1
+             : 0;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_rtp_sender_set_encodings(
+    lrtc_rtp_sender_t* sender, const lrtc_rtp_encoding_settings_t* settings,
+    uint32_t count, int degradation_preference) {
+  if (!sender || !sender->ref.get() || (!settings && count > 0)) {
+    return LRTC_INVALID_ARG;
+  }
+  scoped_refptr<lumenrtc_bridge::RTCRtpParameters> parameters =
+      sender->ref->parameters();
+  if (!parameters.get()) {
+    return LRTC_ERROR;
   }
 
-  parameters->set_encodings(
-      vector<scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters>>(list));
+  // Layers are added and removed by negotiation, not by set_parameters.
+  std::vector<scoped_refptr<lumenrtc_bridge::RTCRtpEncodingParameters>> list =
+      EditableEncodings(parameters);
+  if (count > list.size()) {
+    return LRTC_INVALID_ARG;
+  }
+  for (uint32_t i = 0; i < count; ++i) {
+    ApplyEncodingSettings(list[i], &settings[i]);
+  }
 
-  if (settings->degradation_preference >= 0) {
-    parameters->SetDegradationPreference(
-        static_cast<lumenrtc_bridge::RTCDegradationPreference>(
-            settings->degradation_preference));
+  return CommitEncodings(sender, parameters, list, degradation_preference)
+             ? LRTC_OK
+             : LRTC_ERROR;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_rtp_sender_set_encoded_frame_input(
+    lrtc_rtp_sender_t* sender, bool enabled) {
+  if (!sender || !sender->ref.get()) {
+    return LRTC_INVALID_ARG;
   }
+  return sender->ref->SetEncodedFrameInput(enabled) ? LRTC_OK : LRTC_ERROR;
+}
 
-  return sender->ref->set_parameters(parameters) ? 1 : 0;
+lrtc_result_t LUMENRTC_CALL lrtc_impl_rtp_sender_send_encoded_frame(
+    lrtc_rtp_sender_t* sender, lrtc_encoded_frame_t* frame) {
+  if (!sender || !sender->ref.get() || !frame || !frame->ref.get()) {
+    return LRTC_INVALID_ARG;
+  }
+  return sender->ref->SendEncodedFrame(frame->ref) ? LRTC_OK : LRTC_ERROR;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_rtp_sender_send_encoded_audio(
+    lrtc_rtp_sender_t* sender, const char* mime_type, const uint8_t* data,
+    uint32_t size, uint32_t rtp_timestamp) {
+  if (!sender || !sender->ref.get() || !mime_type || !data || size == 0) {
+    return LRTC_INVALID_ARG;
+  }
+  return sender->ref->SendEncodedAudio(string(mime_type), data, size,
+                                       rtp_timestamp)
+             ? LRTC_OK
+             : LRTC_ERROR;
 }
 
 uint32_t LUMENRTC_CALL lrtc_impl_rtp_sender_encoding_count(
@@ -3387,6 +5163,55 @@ int LUMENRTC_CALL lrtc_impl_rtp_receiver_set_jitter_buffer_min_delay(
   return 1;
 }
 
+lrtc_result_t LUMENRTC_CALL lrtc_impl_rtp_receiver_set_encoded_frame_sink(
+    lrtc_rtp_receiver_t* receiver, lrtc_encoded_frame_sink_t* sink) {
+  if (!receiver || !receiver->ref.get()) {
+    return LRTC_INVALID_ARG;
+  }
+  receiver->ref->SetEncodedFrameObserver(sink ? sink->observer : nullptr);
+  return LRTC_OK;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_rtp_receiver_set_encoded_frame_recorder(
+    lrtc_rtp_receiver_t* receiver, lrtc_encoded_frame_recorder_t* recorder) {
+  if (!receiver || !receiver->ref.get()) {
+    return LRTC_INVALID_ARG;
+  }
+  receiver->ref->SetEncodedFrameObserver(
+      recorder && recorder->ref.get() ? recorder->ref.get() : nullptr);
+  return LRTC_OK;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_rtp_receiver_request_key_frame(
+    lrtc_rtp_receiver_t* receiver) {
+  if (!receiver || !receiver->ref.get()) {
+    return LRTC_INVALID_ARG;
+  }
+  return receiver->ref->RequestKeyFrame() ? LRTC_OK : LRTC_ERROR;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_rtp_receiver_set_decode_on_demand(
+    lrtc_rtp_receiver_t* receiver, bool enabled) {
+  if (!receiver || !receiver->ref.get()) {
+    return LRTC_INVALID_ARG;
+  }
+  return receiver->ref->SetDecodeOnDemand(enabled) ? LRTC_OK : LRTC_ERROR;
+}
+
+lrtc_result_t LUMENRTC_CALL lrtc_impl_rtp_receiver_get_decode_stats(
+    lrtc_rtp_receiver_t* receiver, lrtc_decode_on_demand_stats_t* out_stats) {
+  if (!receiver || !receiver->ref.get() || !out_stats) {
+    return LRTC_INVALID_ARG;
+  }
+  const RTCDecodeOnDemandStats stats = receiver->ref->GetDecodeOnDemandStats();
+  out_stats->frames_decoded = stats.frames_decoded;
+  out_stats->frames_skipped = stats.frames_skipped;
+  out_stats->key_frame_requests = stats.key_frame_requests;
+  out_stats->enabled = stats.enabled;
+  out_stats->skipping = stats.skipping;
+  return LRTC_OK;
+}
+
 void LUMENRTC_CALL lrtc_impl_rtp_receiver_release(lrtc_rtp_receiver_t* receiver) {
   delete receiver;
 }
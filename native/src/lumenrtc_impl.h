@@ -37,11 +37,15 @@ void LUMENRTC_CALL impl_lrtc_data_channel_close(lrtc_data_channel_t* channel);
 void LUMENRTC_CALL impl_lrtc_data_channel_release(lrtc_data_channel_t* channel);
 void LUMENRTC_CALL impl_lrtc_data_channel_send(lrtc_data_channel_t* channel, const uint8_t* data, uint32_t size, int binary);
 void LUMENRTC_CALL impl_lrtc_data_channel_set_callbacks(lrtc_data_channel_t* channel, const lrtc_data_channel_callbacks_t* callbacks, void* user_data);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_desktop_capturer_get_thread_report(lrtc_desktop_capturer_t* capturer, lrtc_thread_report_t* out_report);
 bool LUMENRTC_CALL impl_lrtc_desktop_capturer_is_running(lrtc_desktop_capturer_t* capturer);
 void LUMENRTC_CALL impl_lrtc_desktop_capturer_release(lrtc_desktop_capturer_t* capturer);
 lrtc_desktop_capture_state LUMENRTC_CALL impl_lrtc_desktop_capturer_start(lrtc_desktop_capturer_t* capturer, uint32_t fps);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_desktop_capturer_start_async(lrtc_desktop_capturer_t* capturer, uint32_t fps, lrtc_desktop_capture_state_cb callback, void* user_data);
 lrtc_desktop_capture_state LUMENRTC_CALL impl_lrtc_desktop_capturer_start_region(lrtc_desktop_capturer_t* capturer, uint32_t fps, uint32_t x, uint32_t y, uint32_t w, uint32_t h);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_desktop_capturer_start_region_async(lrtc_desktop_capturer_t* capturer, uint32_t fps, uint32_t x, uint32_t y, uint32_t w, uint32_t h, lrtc_desktop_capture_state_cb callback, void* user_data);
 void LUMENRTC_CALL impl_lrtc_desktop_capturer_stop(lrtc_desktop_capturer_t* capturer);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_desktop_capturer_stop_async(lrtc_desktop_capturer_t* capturer, lrtc_void_cb callback, void* user_data);
 lrtc_desktop_capturer_t* LUMENRTC_CALL impl_lrtc_desktop_device_create_capturer(lrtc_desktop_device_t* device, lrtc_media_source_t* source, bool show_cursor);
 lrtc_desktop_media_list_t* LUMENRTC_CALL impl_lrtc_desktop_device_get_media_list(lrtc_desktop_device_t* device, lrtc_desktop_type type);
 void LUMENRTC_CALL impl_lrtc_desktop_device_release(lrtc_desktop_device_t* device);
@@ -57,23 +61,75 @@ int LUMENRTC_CALL impl_lrtc_dtmf_sender_inter_tone_gap(lrtc_dtmf_sender_t* sende
 void LUMENRTC_CALL impl_lrtc_dtmf_sender_release(lrtc_dtmf_sender_t* sender);
 void LUMENRTC_CALL impl_lrtc_dtmf_sender_set_callbacks(lrtc_dtmf_sender_t* sender, const lrtc_dtmf_sender_callbacks_t* callbacks, void* user_data);
 int32_t LUMENRTC_CALL impl_lrtc_dtmf_sender_tones(lrtc_dtmf_sender_t* sender, char* buffer, uint32_t buffer_len);
+const uint8_t* LUMENRTC_CALL impl_lrtc_encoded_frame_data(lrtc_encoded_frame_t* frame);
+uint32_t LUMENRTC_CALL impl_lrtc_encoded_frame_get_dependencies(lrtc_encoded_frame_t* frame, int64_t* out_frame_ids, uint32_t capacity);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_encoded_frame_get_info(lrtc_encoded_frame_t* frame, lrtc_encoded_frame_info_t* out_info);
+int32_t LUMENRTC_CALL impl_lrtc_encoded_frame_get_mime_type(lrtc_encoded_frame_t* frame, char* buffer, uint32_t buffer_len);
+lrtc_encoded_frame_recorder_t* LUMENRTC_CALL impl_lrtc_encoded_frame_recorder_create(const char* path, const lrtc_encoded_frame_recorder_options_t* options);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_encoded_frame_recorder_get_stats(lrtc_encoded_frame_recorder_t* recorder, lrtc_encoded_frame_recorder_stats_t* out_stats);
+void LUMENRTC_CALL impl_lrtc_encoded_frame_recorder_release(lrtc_encoded_frame_recorder_t* recorder);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_encoded_frame_recorder_stop(lrtc_encoded_frame_recorder_t* recorder);
+void LUMENRTC_CALL impl_lrtc_encoded_frame_release(lrtc_encoded_frame_t* frame);
+lrtc_encoded_frame_t* LUMENRTC_CALL impl_lrtc_encoded_frame_retain(lrtc_encoded_frame_t* frame);
+lrtc_encoded_frame_sink_t* LUMENRTC_CALL impl_lrtc_encoded_frame_sink_create(lrtc_encoded_frame_cb callback, void* user_data);
+void LUMENRTC_CALL impl_lrtc_encoded_frame_sink_release(lrtc_encoded_frame_sink_t* sink);
+uint32_t LUMENRTC_CALL impl_lrtc_encoded_frame_size(lrtc_encoded_frame_t* frame);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_factory_configure_certificate_cache(lrtc_factory_t* factory, const lrtc_certificate_cache_options_t* options);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_factory_configure_peer_connection_pool(lrtc_factory_t* factory, const lrtc_rtc_config_t* config, lrtc_media_constraints_t* constraints, int size);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_factory_configure_udp_mux(lrtc_factory_t* factory, const lrtc_udp_mux_options_t* options);
 lrtc_factory_t* LUMENRTC_CALL impl_lrtc_factory_create(void);
 lrtc_audio_source_t* LUMENRTC_CALL impl_lrtc_factory_create_audio_source(lrtc_factory_t* factory, const char* label, lrtc_audio_source_type source_type, const lrtc_audio_options_t* options);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_factory_create_audio_source_async(lrtc_factory_t* factory, const char* label, lrtc_audio_source_type source_type, const lrtc_audio_options_t* options, lrtc_audio_source_created_cb callback, void* user_data);
 lrtc_audio_track_t* LUMENRTC_CALL impl_lrtc_factory_create_audio_track(lrtc_factory_t* factory, lrtc_audio_source_t* source, const char* track_id);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_factory_create_audio_track_async(lrtc_factory_t* factory, lrtc_audio_source_t* source, const char* track_id, lrtc_audio_track_created_cb callback, void* user_data);
+lrtc_video_source_t* LUMENRTC_CALL impl_lrtc_factory_create_custom_video_source(lrtc_factory_t* factory, const char* label, bool is_screencast);
 lrtc_video_source_t* LUMENRTC_CALL impl_lrtc_factory_create_desktop_source(lrtc_factory_t* factory, lrtc_desktop_capturer_t* capturer, const char* label, lrtc_media_constraints_t* constraints);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_factory_create_desktop_source_async(lrtc_factory_t* factory, lrtc_desktop_capturer_t* capturer, const char* label, lrtc_media_constraints_t* constraints, lrtc_video_source_created_cb callback, void* user_data);
+lrtc_video_source_t* LUMENRTC_CALL impl_lrtc_factory_create_encoded_video_source(lrtc_factory_t* factory, const char* label, const char* codec);
 lrtc_media_stream_t* LUMENRTC_CALL impl_lrtc_factory_create_stream(lrtc_factory_t* factory, const char* stream_id);
 lrtc_video_source_t* LUMENRTC_CALL impl_lrtc_factory_create_video_source(lrtc_factory_t* factory, lrtc_video_capturer_t* capturer, const char* label, lrtc_media_constraints_t* constraints);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_factory_create_video_source_async(lrtc_factory_t* factory, lrtc_video_capturer_t* capturer, const char* label, lrtc_media_constraints_t* constraints, lrtc_video_source_created_cb callback, void* user_data);
 lrtc_video_track_t* LUMENRTC_CALL impl_lrtc_factory_create_video_track(lrtc_factory_t* factory, lrtc_video_source_t* source, const char* track_id);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_factory_create_video_track_async(lrtc_factory_t* factory, lrtc_video_source_t* source, const char* track_id, lrtc_video_track_created_cb callback, void* user_data);
+lrtc_factory_t* LUMENRTC_CALL impl_lrtc_factory_create_with_options(const lrtc_factory_options_t* options, lrtc_factory_t* share_with);
+int32_t LUMENRTC_CALL impl_lrtc_factory_export_certificate_pem(lrtc_factory_t* factory, char* buffer, uint32_t buffer_len);
 lrtc_audio_device_t* LUMENRTC_CALL impl_lrtc_factory_get_audio_device(lrtc_factory_t* factory);
 lrtc_desktop_device_t* LUMENRTC_CALL impl_lrtc_factory_get_desktop_device(lrtc_factory_t* factory);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_factory_get_peer_connection_pool_stats(lrtc_factory_t* factory, lrtc_peer_connection_pool_stats_t* out_stats);
 void LUMENRTC_CALL impl_lrtc_factory_get_rtp_receiver_capabilities(lrtc_factory_t* factory, lrtc_media_type media_type, lrtc_stats_success_cb success, lrtc_stats_failure_cb failure, void* user_data);
 void LUMENRTC_CALL impl_lrtc_factory_get_rtp_sender_capabilities(lrtc_factory_t* factory, lrtc_media_type media_type, lrtc_stats_success_cb success, lrtc_stats_failure_cb failure, void* user_data);
 void LUMENRTC_CALL impl_lrtc_factory_get_rtp_sender_codec_mime_types(lrtc_factory_t* factory, lrtc_media_type media_type, lrtc_stats_success_cb success, lrtc_stats_failure_cb failure, void* user_data);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_factory_get_thread_report(lrtc_factory_t* factory, lrtc_thread_role role, uint32_t index, lrtc_thread_report_t* out_report);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_factory_get_udp_mux_stats(lrtc_factory_t* factory, lrtc_udp_mux_stats_t* out_stats);
 lrtc_video_device_t* LUMENRTC_CALL impl_lrtc_factory_get_video_device(lrtc_factory_t* factory);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_factory_import_certificate_pem(lrtc_factory_t* factory, const char* pem);
 lrtc_result_t LUMENRTC_CALL impl_lrtc_factory_initialize(lrtc_factory_t* factory);
 void LUMENRTC_CALL impl_lrtc_factory_release(lrtc_factory_t* factory);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_factory_set_virtual_network_conditions(lrtc_factory_t* factory, const lrtc_virtual_network_options_t* options);
 void LUMENRTC_CALL impl_lrtc_factory_terminate(lrtc_factory_t* factory);
+lrtc_frame_cryptor_t* LUMENRTC_CALL impl_lrtc_frame_cryptor_create_for_receiver(lrtc_rtp_receiver_t* receiver, const char* participant_id, int algorithm, lrtc_key_provider_t* key_provider);
+lrtc_frame_cryptor_t* LUMENRTC_CALL impl_lrtc_frame_cryptor_create_for_sender(lrtc_rtp_sender_t* sender, const char* participant_id, int algorithm, lrtc_key_provider_t* key_provider);
+bool LUMENRTC_CALL impl_lrtc_frame_cryptor_get_enabled(lrtc_frame_cryptor_t* cryptor);
+int LUMENRTC_CALL impl_lrtc_frame_cryptor_get_key_index(lrtc_frame_cryptor_t* cryptor);
+void LUMENRTC_CALL impl_lrtc_frame_cryptor_release(lrtc_frame_cryptor_t* cryptor);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_frame_cryptor_set_enabled(lrtc_frame_cryptor_t* cryptor, bool enabled);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_frame_cryptor_set_key_index(lrtc_frame_cryptor_t* cryptor, int index);
+void LUMENRTC_CALL impl_lrtc_frame_cryptor_set_observer(lrtc_frame_cryptor_t* cryptor, lrtc_frame_cryption_state_cb callback, void* user_data);
 lrtc_result_t LUMENRTC_CALL impl_lrtc_initialize(void);
+lrtc_key_provider_t* LUMENRTC_CALL impl_lrtc_key_provider_create(const lrtc_key_provider_options_t* options);
+int32_t LUMENRTC_CALL impl_lrtc_key_provider_decrypt(lrtc_key_provider_t* provider, const char* participant_id, uint8_t* data, uint32_t size);
+int32_t LUMENRTC_CALL impl_lrtc_key_provider_encrypt(lrtc_key_provider_t* provider, const char* participant_id, int key_index, uint8_t* data, uint32_t size, uint32_t capacity);
+int32_t LUMENRTC_CALL impl_lrtc_key_provider_export_key(lrtc_key_provider_t* provider, const char* participant_id, int key_index, uint8_t* buffer, uint32_t buffer_len);
+int32_t LUMENRTC_CALL impl_lrtc_key_provider_export_shared_key(lrtc_key_provider_t* provider, int key_index, uint8_t* buffer, uint32_t buffer_len);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_key_provider_ratchet_key(lrtc_key_provider_t* provider, const char* participant_id, int key_index);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_key_provider_ratchet_shared_key(lrtc_key_provider_t* provider, int key_index);
+void LUMENRTC_CALL impl_lrtc_key_provider_release(lrtc_key_provider_t* provider);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_key_provider_set_key(lrtc_key_provider_t* provider, const char* participant_id, int key_index, const uint8_t* key, uint32_t key_len);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_key_provider_set_shared_key(lrtc_key_provider_t* provider, int key_index, const uint8_t* key, uint32_t key_len);
+void LUMENRTC_CALL impl_lrtc_key_provider_set_sif_trailer(lrtc_key_provider_t* provider, const uint8_t* trailer, uint32_t trailer_len);
+int LUMENRTC_CALL impl_lrtc_layer_controller_get_level(lrtc_layer_controller_t* controller);
+int LUMENRTC_CALL impl_lrtc_layer_controller_get_max_level(lrtc_layer_controller_t* controller);
+void LUMENRTC_CALL impl_lrtc_layer_controller_release(lrtc_layer_controller_t* controller);
 void LUMENRTC_CALL impl_lrtc_logging_remove_callback(void);
 void LUMENRTC_CALL impl_lrtc_logging_set_callback(int severity, lrtc_log_message_cb callback, void* user_data);
 void LUMENRTC_CALL impl_lrtc_logging_set_min_level(int severity);
@@ -98,6 +154,7 @@ lrtc_rtp_transceiver_t* LUMENRTC_CALL impl_lrtc_peer_connection_add_audio_track_
 lrtc_rtp_transceiver_t* LUMENRTC_CALL impl_lrtc_peer_connection_add_audio_track_transceiver_with_init(lrtc_peer_connection_t* pc, lrtc_audio_track_t* track, const lrtc_rtp_transceiver_init_t* init);
 void LUMENRTC_CALL impl_lrtc_peer_connection_add_ice_candidate(lrtc_peer_connection_t* pc, const char* sdp_mid, int sdp_mline_index, const char* candidate);
 int LUMENRTC_CALL impl_lrtc_peer_connection_add_ice_candidate_ex(lrtc_peer_connection_t* pc, const char* sdp_mid, int sdp_mline_index, const char* candidate);
+int LUMENRTC_CALL impl_lrtc_peer_connection_add_ice_candidates(lrtc_peer_connection_t* pc, const char** sdp_mids, const int* sdp_mline_indexes, const char** candidates, uint32_t count, int* out_applied);
 bool LUMENRTC_CALL impl_lrtc_peer_connection_add_stream(lrtc_peer_connection_t* pc, lrtc_media_stream_t* stream);
 lrtc_rtp_transceiver_t* LUMENRTC_CALL impl_lrtc_peer_connection_add_transceiver(lrtc_peer_connection_t* pc, lrtc_media_type media_type);
 lrtc_rtp_transceiver_t* LUMENRTC_CALL impl_lrtc_peer_connection_add_transceiver_with_init(lrtc_peer_connection_t* pc, lrtc_media_type media_type, const lrtc_rtp_transceiver_init_t* init);
@@ -106,32 +163,47 @@ lrtc_rtp_sender_t* LUMENRTC_CALL impl_lrtc_peer_connection_add_video_track_sende
 lrtc_rtp_transceiver_t* LUMENRTC_CALL impl_lrtc_peer_connection_add_video_track_transceiver(lrtc_peer_connection_t* pc, lrtc_video_track_t* track);
 lrtc_rtp_transceiver_t* LUMENRTC_CALL impl_lrtc_peer_connection_add_video_track_transceiver_with_init(lrtc_peer_connection_t* pc, lrtc_video_track_t* track, const lrtc_rtp_transceiver_init_t* init);
 void LUMENRTC_CALL impl_lrtc_peer_connection_close(lrtc_peer_connection_t* pc);
+void LUMENRTC_CALL impl_lrtc_peer_connection_connect_loopback(lrtc_peer_connection_t* offerer, lrtc_peer_connection_t* answerer, lrtc_void_cb success, lrtc_sdp_error_cb failure, void* user_data);
+int32_t LUMENRTC_CALL impl_lrtc_peer_connection_copy_local_description(lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len);
+int32_t LUMENRTC_CALL impl_lrtc_peer_connection_copy_local_description_type(lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len);
+int32_t LUMENRTC_CALL impl_lrtc_peer_connection_copy_remote_description(lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len);
+int32_t LUMENRTC_CALL impl_lrtc_peer_connection_copy_remote_description_type(lrtc_peer_connection_t* pc, char* buffer, uint32_t buffer_len);
 lrtc_peer_connection_t* LUMENRTC_CALL impl_lrtc_peer_connection_create(lrtc_factory_t* factory, const lrtc_rtc_config_t* config, lrtc_media_constraints_t* constraints, const lrtc_peer_connection_callbacks_t* callbacks, void* user_data);
 void LUMENRTC_CALL impl_lrtc_peer_connection_create_answer(lrtc_peer_connection_t* pc, lrtc_sdp_success_cb success, lrtc_sdp_error_cb failure, void* user_data, lrtc_media_constraints_t* constraints);
 lrtc_data_channel_t* LUMENRTC_CALL impl_lrtc_peer_connection_create_data_channel(lrtc_peer_connection_t* pc, const char* label, int ordered, int reliable, int max_retransmit_time, int max_retransmits, const char* protocol, int negotiated, int id);
+lrtc_peer_connection_t* LUMENRTC_CALL impl_lrtc_peer_connection_create_keyed(lrtc_factory_t* factory, const char* network_key, const lrtc_rtc_config_t* config, lrtc_media_constraints_t* constraints, const lrtc_peer_connection_callbacks_t* callbacks, void* user_data);
+lrtc_layer_controller_t* LUMENRTC_CALL impl_lrtc_peer_connection_create_layer_controller(lrtc_peer_connection_t* pc, lrtc_rtp_sender_t* sender, const lrtc_layer_controller_options_t* options, lrtc_layer_decision_cb callback, void* user_data);
 void LUMENRTC_CALL impl_lrtc_peer_connection_create_offer(lrtc_peer_connection_t* pc, lrtc_sdp_success_cb success, lrtc_sdp_error_cb failure, void* user_data, lrtc_media_constraints_t* constraints);
+lrtc_peer_connection_t* LUMENRTC_CALL impl_lrtc_peer_connection_create_pooled(lrtc_factory_t* factory, const lrtc_peer_connection_callbacks_t* callbacks, void* user_data);
+void LUMENRTC_CALL impl_lrtc_peer_connection_create_templated_offer(lrtc_peer_connection_t* pc, lrtc_session_template_t* session_template, lrtc_sdp_success_cb success, lrtc_sdp_error_cb failure, void* user_data, lrtc_media_constraints_t* constraints);
 void LUMENRTC_CALL impl_lrtc_peer_connection_get_local_description(lrtc_peer_connection_t* pc, lrtc_sdp_success_cb success, lrtc_sdp_error_cb failure, void* user_data);
 lrtc_rtp_receiver_t* LUMENRTC_CALL impl_lrtc_peer_connection_get_receiver(lrtc_peer_connection_t* pc, uint32_t index);
 void LUMENRTC_CALL impl_lrtc_peer_connection_get_receiver_stats(lrtc_peer_connection_t* pc, lrtc_rtp_receiver_t* receiver, lrtc_stats_success_cb success, lrtc_stats_failure_cb failure, void* user_data);
+uint32_t LUMENRTC_CALL impl_lrtc_peer_connection_get_receivers(lrtc_peer_connection_t* pc, lrtc_rtp_receiver_t** out_receivers, uint32_t capacity);
 void LUMENRTC_CALL impl_lrtc_peer_connection_get_remote_description(lrtc_peer_connection_t* pc, lrtc_sdp_success_cb success, lrtc_sdp_error_cb failure, void* user_data);
 lrtc_rtp_sender_t* LUMENRTC_CALL impl_lrtc_peer_connection_get_sender(lrtc_peer_connection_t* pc, uint32_t index);
 void LUMENRTC_CALL impl_lrtc_peer_connection_get_sender_stats(lrtc_peer_connection_t* pc, lrtc_rtp_sender_t* sender, lrtc_stats_success_cb success, lrtc_stats_failure_cb failure, void* user_data);
+uint32_t LUMENRTC_CALL impl_lrtc_peer_connection_get_senders(lrtc_peer_connection_t* pc, lrtc_rtp_sender_t** out_senders, uint32_t capacity);
 void LUMENRTC_CALL impl_lrtc_peer_connection_get_stats(lrtc_peer_connection_t* pc, lrtc_stats_success_cb success, lrtc_stats_failure_cb failure, void* user_data);
 lrtc_rtp_transceiver_t* LUMENRTC_CALL impl_lrtc_peer_connection_get_transceiver(lrtc_peer_connection_t* pc, uint32_t index);
+uint32_t LUMENRTC_CALL impl_lrtc_peer_connection_get_transceivers(lrtc_peer_connection_t* pc, lrtc_rtp_transceiver_t** out_transceivers, uint32_t capacity);
 uint32_t LUMENRTC_CALL impl_lrtc_peer_connection_receiver_count(lrtc_peer_connection_t* pc);
 void LUMENRTC_CALL impl_lrtc_peer_connection_release(lrtc_peer_connection_t* pc);
 bool LUMENRTC_CALL impl_lrtc_peer_connection_remove_stream(lrtc_peer_connection_t* pc, lrtc_media_stream_t* stream);
 int LUMENRTC_CALL impl_lrtc_peer_connection_remove_track(lrtc_peer_connection_t* pc, lrtc_rtp_sender_t* sender);
 void LUMENRTC_CALL impl_lrtc_peer_connection_restart_ice(lrtc_peer_connection_t* pc);
 uint32_t LUMENRTC_CALL impl_lrtc_peer_connection_sender_count(lrtc_peer_connection_t* pc);
+void LUMENRTC_CALL impl_lrtc_peer_connection_set_bandwidth_observer(lrtc_peer_connection_t* pc, uint32_t interval_ms, lrtc_bandwidth_estimate_cb callback, void* user_data);
 void LUMENRTC_CALL impl_lrtc_peer_connection_set_callbacks(lrtc_peer_connection_t* pc, const lrtc_peer_connection_callbacks_t* callbacks, void* user_data);
 int LUMENRTC_CALL impl_lrtc_peer_connection_set_codec_preferences(lrtc_peer_connection_t* pc, lrtc_media_type media_type, const char** mime_types, uint32_t mime_type_count);
+void LUMENRTC_CALL impl_lrtc_peer_connection_set_ice_candidate_batching(lrtc_peer_connection_t* pc, uint32_t window_ms, lrtc_ice_candidates_cb callback, void* user_data);
 void LUMENRTC_CALL impl_lrtc_peer_connection_set_local_description(lrtc_peer_connection_t* pc, const char* sdp, const char* type, lrtc_void_cb success, lrtc_sdp_error_cb failure, void* user_data);
 void LUMENRTC_CALL impl_lrtc_peer_connection_set_remote_description(lrtc_peer_connection_t* pc, const char* sdp, const char* type, lrtc_void_cb success, lrtc_sdp_error_cb failure, void* user_data);
 int LUMENRTC_CALL impl_lrtc_peer_connection_set_transceiver_codec_preferences(lrtc_peer_connection_t* pc, lrtc_rtp_transceiver_t* transceiver, const char** mime_types, uint32_t mime_type_count);
 uint32_t LUMENRTC_CALL impl_lrtc_peer_connection_transceiver_count(lrtc_peer_connection_t* pc);
 uint32_t LUMENRTC_CALL impl_lrtc_rtp_receiver_encoding_count(lrtc_rtp_receiver_t* receiver);
 lrtc_audio_track_t* LUMENRTC_CALL impl_lrtc_rtp_receiver_get_audio_track(lrtc_rtp_receiver_t* receiver);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_rtp_receiver_get_decode_stats(lrtc_rtp_receiver_t* receiver, lrtc_decode_on_demand_stats_t* out_stats);
 int LUMENRTC_CALL impl_lrtc_rtp_receiver_get_degradation_preference(lrtc_rtp_receiver_t* receiver);
 int LUMENRTC_CALL impl_lrtc_rtp_receiver_get_dtls_info(lrtc_rtp_receiver_t* receiver, lrtc_dtls_transport_info_t* info);
 int LUMENRTC_CALL impl_lrtc_rtp_receiver_get_encoding_info(lrtc_rtp_receiver_t* receiver, uint32_t index, lrtc_rtp_encoding_info_t* info);
@@ -144,6 +216,10 @@ lrtc_media_stream_t* LUMENRTC_CALL impl_lrtc_rtp_receiver_get_stream(lrtc_rtp_re
 int32_t LUMENRTC_CALL impl_lrtc_rtp_receiver_get_stream_id(lrtc_rtp_receiver_t* receiver, uint32_t index, char* buffer, uint32_t buffer_len);
 lrtc_video_track_t* LUMENRTC_CALL impl_lrtc_rtp_receiver_get_video_track(lrtc_rtp_receiver_t* receiver);
 void LUMENRTC_CALL impl_lrtc_rtp_receiver_release(lrtc_rtp_receiver_t* receiver);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_rtp_receiver_request_key_frame(lrtc_rtp_receiver_t* receiver);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_rtp_receiver_set_decode_on_demand(lrtc_rtp_receiver_t* receiver, bool enabled);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_rtp_receiver_set_encoded_frame_recorder(lrtc_rtp_receiver_t* receiver, lrtc_encoded_frame_recorder_t* recorder);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_rtp_receiver_set_encoded_frame_sink(lrtc_rtp_receiver_t* receiver, lrtc_encoded_frame_sink_t* sink);
 int LUMENRTC_CALL impl_lrtc_rtp_receiver_set_jitter_buffer_min_delay(lrtc_rtp_receiver_t* receiver, double delay_seconds);
 uint32_t LUMENRTC_CALL impl_lrtc_rtp_receiver_stream_count(lrtc_rtp_receiver_t* receiver);
 uint32_t LUMENRTC_CALL impl_lrtc_rtp_receiver_stream_id_count(lrtc_rtp_receiver_t* receiver);
@@ -164,8 +240,12 @@ lrtc_video_track_t* LUMENRTC_CALL impl_lrtc_rtp_sender_get_video_track(lrtc_rtp_
 void LUMENRTC_CALL impl_lrtc_rtp_sender_release(lrtc_rtp_sender_t* sender);
 int LUMENRTC_CALL impl_lrtc_rtp_sender_replace_audio_track(lrtc_rtp_sender_t* sender, lrtc_audio_track_t* track);
 int LUMENRTC_CALL impl_lrtc_rtp_sender_replace_video_track(lrtc_rtp_sender_t* sender, lrtc_video_track_t* track);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_rtp_sender_send_encoded_audio(lrtc_rtp_sender_t* sender, const char* mime_type, const uint8_t* data, uint32_t size, uint32_t rtp_timestamp);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_rtp_sender_send_encoded_frame(lrtc_rtp_sender_t* sender, lrtc_encoded_frame_t* frame);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_rtp_sender_set_encoded_frame_input(lrtc_rtp_sender_t* sender, bool enabled);
 int LUMENRTC_CALL impl_lrtc_rtp_sender_set_encoding_parameters(lrtc_rtp_sender_t* sender, const lrtc_rtp_encoding_settings_t* settings);
 int LUMENRTC_CALL impl_lrtc_rtp_sender_set_encoding_parameters_at(lrtc_rtp_sender_t* sender, uint32_t index, const lrtc_rtp_encoding_settings_t* settings);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_rtp_sender_set_encodings(lrtc_rtp_sender_t* sender, const lrtc_rtp_encoding_settings_t* settings, uint32_t count, int degradation_preference);
 int LUMENRTC_CALL impl_lrtc_rtp_sender_set_stream_ids(lrtc_rtp_sender_t* sender, const char** stream_ids, uint32_t stream_id_count);
 uint32_t LUMENRTC_CALL impl_lrtc_rtp_sender_stream_id_count(lrtc_rtp_sender_t* sender);
 int LUMENRTC_CALL impl_lrtc_rtp_transceiver_get_current_direction(lrtc_rtp_transceiver_t* transceiver);
@@ -181,12 +261,24 @@ int LUMENRTC_CALL impl_lrtc_rtp_transceiver_get_stopping(lrtc_rtp_transceiver_t*
 void LUMENRTC_CALL impl_lrtc_rtp_transceiver_release(lrtc_rtp_transceiver_t* transceiver);
 int LUMENRTC_CALL impl_lrtc_rtp_transceiver_set_direction(lrtc_rtp_transceiver_t* transceiver, int direction, char* error, uint32_t error_len);
 int LUMENRTC_CALL impl_lrtc_rtp_transceiver_stop(lrtc_rtp_transceiver_t* transceiver, char* error, uint32_t error_len);
+lrtc_session_template_t* LUMENRTC_CALL impl_lrtc_session_template_create(void);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_session_template_get_stats(lrtc_session_template_t* session_template, lrtc_session_template_stats_t* out_stats);
+void LUMENRTC_CALL impl_lrtc_session_template_release(lrtc_session_template_t* session_template);
+void LUMENRTC_CALL impl_lrtc_session_template_reset(lrtc_session_template_t* session_template);
 void LUMENRTC_CALL impl_lrtc_terminate(void);
+uint32_t LUMENRTC_CALL impl_lrtc_trace_drain(lrtc_trace_event_t* events, uint32_t capacity);
+uint64_t LUMENRTC_CALL impl_lrtc_trace_dropped_count(void);
+int32_t LUMENRTC_CALL impl_lrtc_trace_format_chrome_json(const lrtc_trace_event_t* events, uint32_t count, char* buffer, uint32_t buffer_len);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_trace_start(uint32_t capacity);
+void LUMENRTC_CALL impl_lrtc_trace_stop(void);
 bool LUMENRTC_CALL impl_lrtc_video_capturer_capture_started(lrtc_video_capturer_t* capturer);
 void LUMENRTC_CALL impl_lrtc_video_capturer_release(lrtc_video_capturer_t* capturer);
 bool LUMENRTC_CALL impl_lrtc_video_capturer_start(lrtc_video_capturer_t* capturer);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_video_capturer_start_async(lrtc_video_capturer_t* capturer, lrtc_video_capture_started_cb callback, void* user_data);
 void LUMENRTC_CALL impl_lrtc_video_capturer_stop(lrtc_video_capturer_t* capturer);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_video_capturer_stop_async(lrtc_video_capturer_t* capturer, lrtc_void_cb callback, void* user_data);
 lrtc_video_capturer_t* LUMENRTC_CALL impl_lrtc_video_device_create_capturer(lrtc_video_device_t* device, const char* name, uint32_t index, size_t width, size_t height, size_t target_fps);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_video_device_create_capturer_async(lrtc_video_device_t* device, const char* name, uint32_t index, size_t width, size_t height, size_t target_fps, lrtc_video_capturer_created_cb callback, void* user_data);
 int32_t LUMENRTC_CALL impl_lrtc_video_device_get_device_name(lrtc_video_device_t* device, uint32_t index, char* name, uint32_t name_length, char* unique_id, uint32_t unique_id_length);
 uint32_t LUMENRTC_CALL impl_lrtc_video_device_number_of_devices(lrtc_video_device_t* device);
 void LUMENRTC_CALL impl_lrtc_video_device_release(lrtc_video_device_t* device);
@@ -194,6 +286,7 @@ int LUMENRTC_CALL impl_lrtc_video_frame_copy_i420(lrtc_video_frame_t* frame, uin
 const uint8_t* LUMENRTC_CALL impl_lrtc_video_frame_data_u(lrtc_video_frame_t* frame);
 const uint8_t* LUMENRTC_CALL impl_lrtc_video_frame_data_v(lrtc_video_frame_t* frame);
 const uint8_t* LUMENRTC_CALL impl_lrtc_video_frame_data_y(lrtc_video_frame_t* frame);
+int LUMENRTC_CALL impl_lrtc_video_frame_format(lrtc_video_frame_t* frame);
 int LUMENRTC_CALL impl_lrtc_video_frame_height(lrtc_video_frame_t* frame);
 void LUMENRTC_CALL impl_lrtc_video_frame_release(lrtc_video_frame_t* frame);
 lrtc_video_frame_t* LUMENRTC_CALL impl_lrtc_video_frame_retain(lrtc_video_frame_t* frame);
@@ -203,8 +296,15 @@ int LUMENRTC_CALL impl_lrtc_video_frame_stride_y(lrtc_video_frame_t* frame);
 int LUMENRTC_CALL impl_lrtc_video_frame_to_argb(lrtc_video_frame_t* frame, uint8_t* dst_argb, int dst_stride_argb, int dest_width, int dest_height, int format);
 int LUMENRTC_CALL impl_lrtc_video_frame_width(lrtc_video_frame_t* frame);
 lrtc_video_sink_t* LUMENRTC_CALL impl_lrtc_video_sink_create(const lrtc_video_sink_callbacks_t* callbacks, void* user_data);
+lrtc_video_sink_t* LUMENRTC_CALL impl_lrtc_video_sink_create_with_wants(const lrtc_video_sink_callbacks_t* callbacks, const lrtc_video_sink_wants_t* wants, void* user_data);
 void LUMENRTC_CALL impl_lrtc_video_sink_release(lrtc_video_sink_t* sink);
+uint64_t LUMENRTC_CALL impl_lrtc_video_source_dropped_count(lrtc_video_source_t* source);
+int LUMENRTC_CALL impl_lrtc_video_source_push_argb(lrtc_video_source_t* source, const uint8_t* data, int stride, int width, int height, int format, int64_t timestamp_us, lrtc_void_cb release, void* user_data);
+int LUMENRTC_CALL impl_lrtc_video_source_push_encoded(lrtc_video_source_t* source, const uint8_t* data, uint32_t size, int width, int height, bool key_frame, int64_t timestamp_us);
+int LUMENRTC_CALL impl_lrtc_video_source_push_i420(lrtc_video_source_t* source, const uint8_t* data_y, int stride_y, const uint8_t* data_u, int stride_u, const uint8_t* data_v, int stride_v, int width, int height, int64_t timestamp_us, lrtc_void_cb release, void* user_data);
+int LUMENRTC_CALL impl_lrtc_video_source_push_nv12(lrtc_video_source_t* source, const uint8_t* data_y, int stride_y, const uint8_t* data_uv, int stride_uv, int width, int height, int64_t timestamp_us, lrtc_void_cb release, void* user_data);
 void LUMENRTC_CALL impl_lrtc_video_source_release(lrtc_video_source_t* source);
+lrtc_result_t LUMENRTC_CALL impl_lrtc_video_source_set_key_frame_request_callback(lrtc_video_source_t* source, lrtc_void_cb callback, void* user_data);
 void LUMENRTC_CALL impl_lrtc_video_track_add_sink(lrtc_video_track_t* track, lrtc_video_sink_t* sink);
 int LUMENRTC_CALL impl_lrtc_video_track_get_enabled(lrtc_video_track_t* track);
 int32_t LUMENRTC_CALL impl_lrtc_video_track_get_id(lrtc_video_track_t* track, char* buffer, uint32_t buffer_len);
@@ -97,3 +97,32 @@ struct lrtc_rtp_receiver_t {
 struct lrtc_rtp_transceiver_t {
   scoped_refptr<lumenrtc_bridge::RTCRtpTransceiver> ref;
 };
+
+struct lrtc_session_template_t {
+  scoped_refptr<RTCSessionTemplate> ref;
+};
+
+struct lrtc_layer_controller_t {
+  scoped_refptr<RTCLayerController> ref;
+  class LayerControllerObserverImpl* observer = nullptr;
+};
+
+struct lrtc_encoded_frame_t {
+  scoped_refptr<RTCEncodedFrame> ref;
+};
+
+struct lrtc_encoded_frame_sink_t {
+  class EncodedFrameSinkImpl* observer = nullptr;
+};
+
+struct lrtc_encoded_frame_recorder_t {
+  scoped_refptr<RTCEncodedFrameRecorder> ref;
+};
+
+struct lrtc_key_provider_t {
+  scoped_refptr<KeyProvider> ref;
+};
+
+struct lrtc_frame_cryptor_t {
+  scoped_refptr<RTCFrameCryptor> ref;
+};
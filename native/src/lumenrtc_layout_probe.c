@@ -26,6 +26,15 @@ static void abi_layout_check_lrtc_audio_sink_callbacks_t(void) {
     /* lrtc_audio_sink_callbacks_t: 1 field(s) expected */
 }
 
+static void abi_layout_check_lrtc_certificate_cache_options_t(void) {
+    lrtc_certificate_cache_options_t _s;
+    (void)_s;
+    (void)_s.enabled;  /* field must exist */
+    (void)_s.size;  /* field must exist */
+    (void)_s.rotation_interval_ms;  /* field must exist */
+    /* lrtc_certificate_cache_options_t: 3 field(s) expected */
+}
+
 static void abi_layout_check_lrtc_data_channel_callbacks_t(void) {
     lrtc_data_channel_callbacks_t _s;
     (void)_s;
@@ -34,6 +43,17 @@ static void abi_layout_check_lrtc_data_channel_callbacks_t(void) {
     /* lrtc_data_channel_callbacks_t: 2 field(s) expected */
 }
 
+static void abi_layout_check_lrtc_decode_on_demand_stats_t(void) {
+    lrtc_decode_on_demand_stats_t _s;
+    (void)_s;
+    (void)_s.frames_decoded;  /* field must exist */
+    (void)_s.frames_skipped;  /* field must exist */
+    (void)_s.key_frame_requests;  /* field must exist */
+    (void)_s.enabled;  /* field must exist */
+    (void)_s.skipping;  /* field must exist */
+    /* lrtc_decode_on_demand_stats_t: 5 field(s) expected */
+}
+
 static void abi_layout_check_lrtc_dtls_transport_info_t(void) {
     lrtc_dtls_transport_info_t _s;
     (void)_s;
@@ -50,6 +70,82 @@ static void abi_layout_check_lrtc_dtmf_sender_callbacks_t(void) {
     /* lrtc_dtmf_sender_callbacks_t: 1 field(s) expected */
 }
 
+static void abi_layout_check_lrtc_encoded_frame_info_t(void) {
+    lrtc_encoded_frame_info_t _s;
+    (void)_s;
+    (void)_s.media_type;  /* field must exist */
+    (void)_s.rtp_timestamp;  /* field must exist */
+    (void)_s.ssrc;  /* field must exist */
+    (void)_s.payload_type;  /* field must exist */
+    (void)_s.is_key_frame;  /* field must exist */
+    (void)_s.width;  /* field must exist */
+    (void)_s.height;  /* field must exist */
+    (void)_s.frame_id;  /* field must exist */
+    (void)_s.spatial_index;  /* field must exist */
+    (void)_s.temporal_index;  /* field must exist */
+    (void)_s.dependency_count;  /* field must exist */
+    /* lrtc_encoded_frame_info_t: 11 field(s) expected */
+}
+
+static void abi_layout_check_lrtc_encoded_frame_recorder_options_t(void) {
+    lrtc_encoded_frame_recorder_options_t _s;
+    (void)_s;
+    (void)_s.max_queued_bytes;  /* field must exist */
+    (void)_s.write_buffer_bytes;  /* field must exist */
+    (void)_s.sync_policy;  /* field must exist */
+    (void)_s.sync_interval_ms;  /* field must exist */
+    /* lrtc_encoded_frame_recorder_options_t: 4 field(s) expected */
+}
+
+static void abi_layout_check_lrtc_encoded_frame_recorder_stats_t(void) {
+    lrtc_encoded_frame_recorder_stats_t _s;
+    (void)_s;
+    (void)_s.frames_written;  /* field must exist */
+    (void)_s.bytes_written;  /* field must exist */
+    (void)_s.frames_dropped;  /* field must exist */
+    (void)_s.queued_bytes;  /* field must exist */
+    (void)_s.write_failed;  /* field must exist */
+    /* lrtc_encoded_frame_recorder_stats_t: 5 field(s) expected */
+}
+
+static void abi_layout_check_lrtc_thread_config_t(void) {
+    lrtc_thread_config_t _s;
+    (void)_s;
+    (void)_s.cpu_mask;  /* field must exist */
+    (void)_s.set_nice;  /* field must exist */
+    (void)_s.nice;  /* field must exist */
+    (void)_s.realtime;  /* field must exist */
+    (void)_s.realtime_priority;  /* field must exist */
+    /* lrtc_thread_config_t: 5 field(s) expected */
+}
+
+static void abi_layout_check_lrtc_virtual_network_options_t(void) {
+    lrtc_virtual_network_options_t _s;
+    (void)_s;
+    (void)_s.enabled;  /* field must exist */
+    (void)_s.latency_ms;  /* field must exist */
+    (void)_s.jitter_ms;  /* field must exist */
+    (void)_s.loss_rate;  /* field must exist */
+    (void)_s.bandwidth_bps;  /* field must exist */
+    /* lrtc_virtual_network_options_t: 5 field(s) expected */
+}
+
+static void abi_layout_check_lrtc_factory_options_t(void) {
+    lrtc_factory_options_t _s;
+    (void)_s;
+    (void)_s.thread_mode;  /* field must exist */
+    (void)_s.thread_pool_size;  /* field must exist */
+    (void)_s.network_thread_count;  /* field must exist */
+    (void)_s.pin_network_threads;  /* field must exist */
+    (void)_s.network_first_cpu;  /* field must exist */
+    (void)_s.worker_thread;  /* field must exist */
+    (void)_s.signaling_thread;  /* field must exist */
+    (void)_s.network_thread;  /* field must exist */
+    (void)_s.capture_thread;  /* field must exist */
+    (void)_s.virtual_network;  /* field must exist */
+    /* lrtc_factory_options_t: 10 field(s) expected */
+}
+
 static void abi_layout_check_lrtc_ice_server_t(void) {
     lrtc_ice_server_t _s;
     (void)_s;
@@ -59,6 +155,35 @@ static void abi_layout_check_lrtc_ice_server_t(void) {
     /* lrtc_ice_server_t: 3 field(s) expected */
 }
 
+static void abi_layout_check_lrtc_key_provider_options_t(void) {
+    lrtc_key_provider_options_t _s;
+    (void)_s;
+    (void)_s.shared_key;  /* field must exist */
+    (void)_s.ratchet_salt;  /* field must exist */
+    (void)_s.ratchet_salt_len;  /* field must exist */
+    (void)_s.uncrypted_magic_bytes;  /* field must exist */
+    (void)_s.uncrypted_magic_bytes_len;  /* field must exist */
+    (void)_s.ratchet_window_size;  /* field must exist */
+    (void)_s.failure_tolerance;  /* field must exist */
+    (void)_s.key_ring_size;  /* field must exist */
+    (void)_s.discard_frame_when_cryptor_not_ready;  /* field must exist */
+    /* lrtc_key_provider_options_t: 9 field(s) expected */
+}
+
+static void abi_layout_check_lrtc_layer_controller_options_t(void) {
+    lrtc_layer_controller_options_t _s;
+    (void)_s;
+    (void)_s.interval_ms;  /* field must exist */
+    (void)_s.up_headroom;  /* field must exist */
+    (void)_s.down_headroom;  /* field must exist */
+    (void)_s.up_hold_ms;  /* field must exist */
+    (void)_s.down_hold_ms;  /* field must exist */
+    (void)_s.max_loss_rate;  /* field must exist */
+    (void)_s.max_rtt_increase_ms;  /* field must exist */
+    (void)_s.ignore_cpu;  /* field must exist */
+    /* lrtc_layer_controller_options_t: 8 field(s) expected */
+}
+
 static void abi_layout_check_lrtc_peer_connection_callbacks_t(void) {
     lrtc_peer_connection_callbacks_t _s;
     (void)_s;
@@ -76,6 +201,18 @@ static void abi_layout_check_lrtc_peer_connection_callbacks_t(void) {
     /* lrtc_peer_connection_callbacks_t: 11 field(s) expected */
 }
 
+static void abi_layout_check_lrtc_peer_connection_pool_stats_t(void) {
+    lrtc_peer_connection_pool_stats_t _s;
+    (void)_s;
+    (void)_s.hits;  /* field must exist */
+    (void)_s.misses;  /* field must exist */
+    (void)_s.created;  /* field must exist */
+    (void)_s.discarded;  /* field must exist */
+    (void)_s.available;  /* field must exist */
+    (void)_s.target_size;  /* field must exist */
+    /* lrtc_peer_connection_pool_stats_t: 6 field(s) expected */
+}
+
 static void abi_layout_check_lrtc_rtc_config_t(void) {
     lrtc_rtc_config_t _s;
     (void)_s;
@@ -148,6 +285,58 @@ static void abi_layout_check_lrtc_rtp_transceiver_init_t(void) {
     /* lrtc_rtp_transceiver_init_t: 5 field(s) expected */
 }
 
+static void abi_layout_check_lrtc_session_template_stats_t(void) {
+    lrtc_session_template_stats_t _s;
+    (void)_s;
+    (void)_s.hits;  /* field must exist */
+    (void)_s.misses;  /* field must exist */
+    (void)_s.template_size;  /* field must exist */
+    /* lrtc_session_template_stats_t: 3 field(s) expected */
+}
+
+static void abi_layout_check_lrtc_thread_report_t(void) {
+    lrtc_thread_report_t _s;
+    (void)_s;
+    (void)_s.applied;  /* field must exist */
+    (void)_s.cpu_mask;  /* field must exist */
+    (void)_s.nice;  /* field must exist */
+    (void)_s.realtime;  /* field must exist */
+    (void)_s.priority;  /* field must exist */
+    (void)_s.failures;  /* field must exist */
+    /* lrtc_thread_report_t: 6 field(s) expected */
+}
+
+static void abi_layout_check_lrtc_trace_event_t(void) {
+    lrtc_trace_event_t _s;
+    (void)_s;
+    (void)_s.start_us;  /* field must exist */
+    (void)_s.duration_us;  /* field must exist */
+    (void)_s.frame_timestamp_us;  /* field must exist */
+    (void)_s.source_id;  /* field must exist */
+    (void)_s.thread_id;  /* field must exist */
+    (void)_s.stage;  /* field must exist */
+    /* lrtc_trace_event_t: 6 field(s) expected */
+}
+
+static void abi_layout_check_lrtc_udp_mux_options_t(void) {
+    lrtc_udp_mux_options_t _s;
+    (void)_s;
+    (void)_s.enabled;  /* field must exist */
+    (void)_s.port;  /* field must exist */
+    /* lrtc_udp_mux_options_t: 2 field(s) expected */
+}
+
+static void abi_layout_check_lrtc_udp_mux_stats_t(void) {
+    lrtc_udp_mux_stats_t _s;
+    (void)_s;
+    (void)_s.address_hits;  /* field must exist */
+    (void)_s.ufrag_hits;  /* field must exist */
+    (void)_s.misses;  /* field must exist */
+    (void)_s.endpoints;  /* field must exist */
+    (void)_s.ports;  /* field must exist */
+    /* lrtc_udp_mux_stats_t: 5 field(s) expected */
+}
+
 static void abi_layout_check_lrtc_video_sink_callbacks_t(void) {
     lrtc_video_sink_callbacks_t _s;
     (void)_s;
@@ -155,18 +344,47 @@ static void abi_layout_check_lrtc_video_sink_callbacks_t(void) {
     /* lrtc_video_sink_callbacks_t: 1 field(s) expected */
 }
 
+static void abi_layout_check_lrtc_video_sink_wants_t(void) {
+    lrtc_video_sink_wants_t _s;
+    (void)_s;
+    (void)_s.max_pixel_count;  /* field must exist */
+    (void)_s.max_framerate;  /* field must exist */
+    (void)_s.resolution_alignment;  /* field must exist */
+    (void)_s.format;  /* field must exist */
+    (void)_s.width;  /* field must exist */
+    (void)_s.height;  /* field must exist */
+    /* lrtc_video_sink_wants_t: 6 field(s) expected */
+}
+
 /* --- top-level entry point (call from a test or just compile) --- */
 static void abi_layout_probe_all(void) {
     abi_layout_check_lrtc_audio_options_t();
     abi_layout_check_lrtc_audio_sink_callbacks_t();
+    abi_layout_check_lrtc_certificate_cache_options_t();
     abi_layout_check_lrtc_data_channel_callbacks_t();
+    abi_layout_check_lrtc_decode_on_demand_stats_t();
     abi_layout_check_lrtc_dtls_transport_info_t();
     abi_layout_check_lrtc_dtmf_sender_callbacks_t();
+    abi_layout_check_lrtc_encoded_frame_info_t();
+    abi_layout_check_lrtc_encoded_frame_recorder_options_t();
+    abi_layout_check_lrtc_encoded_frame_recorder_stats_t();
+    abi_layout_check_lrtc_thread_config_t();
+    abi_layout_check_lrtc_virtual_network_options_t();
+    abi_layout_check_lrtc_factory_options_t();
     abi_layout_check_lrtc_ice_server_t();
+    abi_layout_check_lrtc_key_provider_options_t();
+    abi_layout_check_lrtc_layer_controller_options_t();
     abi_layout_check_lrtc_peer_connection_callbacks_t();
+    abi_layout_check_lrtc_peer_connection_pool_stats_t();
     abi_layout_check_lrtc_rtc_config_t();
     abi_layout_check_lrtc_rtp_encoding_info_t();
     abi_layout_check_lrtc_rtp_encoding_settings_t();
     abi_layout_check_lrtc_rtp_transceiver_init_t();
+    abi_layout_check_lrtc_session_template_stats_t();
+    abi_layout_check_lrtc_thread_report_t();
+    abi_layout_check_lrtc_trace_event_t();
+    abi_layout_check_lrtc_udp_mux_options_t();
+    abi_layout_check_lrtc_udp_mux_stats_t();
     abi_layout_check_lrtc_video_sink_callbacks_t();
+    abi_layout_check_lrtc_video_sink_wants_t();
 }
@@ -0,0 +1,24 @@
+namespace LumenRTC;
+
+/// <summary>
+/// DTLS certificates shared by the peer connections of one factory instead of one generated per connection.
+/// </summary>
+public sealed class CertificateCacheOptions
+{
+    /// <summary>
+    /// Certificates handed out round-robin, 1 to 16.
+    /// </summary>
+    public int Size { get; set; } = 1;
+
+    /// <summary>
+    /// Age after which a certificate is replaced on its next use; <see cref="TimeSpan.Zero"/> keeps it until it expires.
+    /// </summary>
+    public TimeSpan RotationInterval { get; set; } = TimeSpan.Zero;
+
+    internal LrtcCertificateCacheOptions ToNative() => new LrtcCertificateCacheOptions
+    {
+        enabled = true,
+        size = Size,
+        rotation_interval_ms = (long)RotationInterval.TotalMilliseconds,
+    };
+}
@@ -0,0 +1,11 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Selects where a factory's worker and network threads come from.
+/// </summary>
+public enum FactoryThreadMode
+{
+    Dedicated = 0,
+    Shared = 1,
+    Pooled = 2,
+}
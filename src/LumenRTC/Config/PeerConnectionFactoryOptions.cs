@@ -0,0 +1,45 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Thread placement for a peer connection factory. The signaling thread is always per factory.
+/// </summary>
+public sealed class PeerConnectionFactoryOptions
+{
+    public FactoryThreadMode ThreadMode { get; set; } = FactoryThreadMode.Dedicated;
+
+    /// <summary>
+    /// Initialized factory whose worker and network threads are reused when <see cref="ThreadMode"/> is Shared.
+    /// </summary>
+    public PeerConnectionFactory? ShareWith { get; set; }
+
+    /// <summary>
+    /// Maximum worker/network thread pairs in the process-wide pool; 0 sizes it from the core count.
+    /// </summary>
+    public int ThreadPoolSize { get; set; }
+
+    /// <summary>
+    /// Network threads started with a new thread group. Peer connections are spread across them;
+    /// device audio is only serviced for connections placed on the first one.
+    /// </summary>
+    public int NetworkThreadCount { get; set; } = 1;
+
+    /// <summary>
+    /// When set, network thread i is pinned to CPU (NetworkThreadFirstCpu + i) modulo the processor count.
+    /// </summary>
+    public int? NetworkThreadFirstCpu { get; set; }
+
+    /// <summary>
+    /// Worker and network tunings apply only to threads this factory starts; shared or already
+    /// running pooled threads keep the scheduling they were started with.
+    /// </summary>
+    public ThreadTuning? WorkerThread { get; set; }
+    public ThreadTuning? SignalingThread { get; set; }
+    public ThreadTuning? NetworkThread { get; set; }
+    public ThreadTuning? CaptureThread { get; set; }
+
+    /// <summary>
+    /// Runs the factory on a simulated network with a single network thread. A pooled factory gets a
+    /// dedicated thread group instead.
+    /// </summary>
+    public VirtualNetworkOptions? VirtualNetwork { get; set; }
+}
@@ -0,0 +1,21 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Affinity and priority a bridge thread runs with, read back from the operating system.
+/// </summary>
+public readonly record struct ThreadReport(
+    bool Applied,
+    ulong CpuMask,
+    int Nice,
+    bool Realtime,
+    int Priority,
+    ThreadTuningFailures Failures)
+{
+    internal static ThreadReport FromNative(in LrtcThreadReport report) => new(
+        report.applied,
+        report.cpu_mask,
+        report.nice,
+        report.realtime,
+        report.priority,
+        (ThreadTuningFailures)report.failures);
+}
@@ -0,0 +1,12 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Identifies a bridge thread for tuning and reporting.
+/// </summary>
+public enum ThreadRole
+{
+    Worker = 0,
+    Signaling = 1,
+    Network = 2,
+    Capture = 3,
+}
@@ -0,0 +1,33 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Scheduling applied to a bridge thread when it starts.
+/// </summary>
+public sealed class ThreadTuning
+{
+    /// <summary>
+    /// Bit i allows CPU i; 0 leaves affinity untouched.
+    /// </summary>
+    public ulong CpuMask { get; set; }
+
+    /// <summary>
+    /// Nice value (-20..19 on POSIX, mapped to a thread priority on Windows); null leaves it untouched.
+    /// </summary>
+    public int? Nice { get; set; }
+
+    /// <summary>
+    /// Runs the thread under SCHED_FIFO (time-critical priority on Windows). Usually needs CAP_SYS_NICE.
+    /// </summary>
+    public bool Realtime { get; set; }
+
+    public int RealtimePriority { get; set; } = 1;
+
+    internal LrtcThreadConfig ToNative() => new LrtcThreadConfig
+    {
+        cpu_mask = CpuMask,
+        set_nice = Nice.HasValue,
+        nice = Nice ?? 0,
+        realtime = Realtime,
+        realtime_priority = RealtimePriority,
+    };
+}
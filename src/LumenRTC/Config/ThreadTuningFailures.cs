@@ -0,0 +1,13 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Requested thread settings the operating system rejected.
+/// </summary>
+[Flags]
+public enum ThreadTuningFailures
+{
+    None = 0,
+    Affinity = 1,
+    Nice = 2,
+    Realtime = 4,
+}
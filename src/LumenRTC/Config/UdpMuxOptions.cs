@@ -0,0 +1,18 @@
+namespace LumenRTC;
+
+/// <summary>
+/// One UDP port per network thread shared by all peer connections of a factory, for servers with a reachable address.
+/// </summary>
+public sealed class UdpMuxOptions
+{
+    /// <summary>
+    /// Port of the first network thread; network thread i listens on <c>Port + i</c>.
+    /// </summary>
+    public int Port { get; set; }
+
+    internal LrtcUdpMuxOptions ToNative() => new LrtcUdpMuxOptions
+    {
+        enabled = true,
+        port = Port,
+    };
+}
@@ -0,0 +1,24 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Demultiplexing counters summed over a factory's UDP mux ports.
+/// </summary>
+/// <param name="AddressHits">Packets routed by their remote address.</param>
+/// <param name="UfragHits">STUN packets routed by the ICE ufrag in their USERNAME attribute.</param>
+/// <param name="Misses">Packets dropped because no connection matched.</param>
+/// <param name="Endpoints">Connection sockets currently sharing the ports.</param>
+/// <param name="Ports">Bound mux ports.</param>
+public readonly record struct UdpMuxStats(
+    ulong AddressHits,
+    ulong UfragHits,
+    ulong Misses,
+    int Endpoints,
+    int Ports)
+{
+    internal static UdpMuxStats FromNative(in LrtcUdpMuxStats stats) => new(
+        stats.address_hits,
+        stats.ufrag_hits,
+        stats.misses,
+        (int)stats.endpoints,
+        (int)stats.ports);
+}
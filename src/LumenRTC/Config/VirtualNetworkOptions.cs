@@ -0,0 +1,37 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Simulated network for a factory's network thread. Connections on it only reach other connections on the
+/// same factory (or factories sharing its threads). Requires a bridge built with lumenrtc_bridge_virtual_network.
+/// </summary>
+public sealed class VirtualNetworkOptions
+{
+    /// <summary>
+    /// One way delay added to each packet.
+    /// </summary>
+    public int LatencyMs { get; set; }
+
+    /// <summary>
+    /// Standard deviation of the delay.
+    /// </summary>
+    public int JitterMs { get; set; }
+
+    /// <summary>
+    /// Probability in [0, 1] that a packet is dropped.
+    /// </summary>
+    public double LossRate { get; set; }
+
+    /// <summary>
+    /// Send rate cap per socket in bits per second; 0 is unlimited.
+    /// </summary>
+    public long BandwidthBps { get; set; }
+
+    internal LrtcVirtualNetworkOptions ToNative() => new LrtcVirtualNetworkOptions
+    {
+        enabled = true,
+        latency_ms = LatencyMs,
+        jitter_ms = JitterMs,
+        loss_rate = LossRate,
+        bandwidth_bps = BandwidthBps,
+    };
+}
@@ -0,0 +1,84 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Records per-stage latency of the capture and sink pipeline into native ring buffers, one per
+/// recording thread. Tracing is process-wide and costs a single flag check per stage while stopped.
+/// </summary>
+public static class LatencyTracer
+{
+    public const int DefaultCapacity = 64 * 1024;
+
+    /// <summary>
+    /// Clears buffered events and starts recording up to <paramref name="capacity"/> events per recording thread.
+    /// </summary>
+    public static void Start(int capacity = DefaultCapacity)
+    {
+        if (capacity <= 0) throw new ArgumentOutOfRangeException(nameof(capacity));
+        var result = NativeMethods.lrtc_trace_start((uint)capacity);
+        if (result != LrtcResult.Ok)
+        {
+            throw new InvalidOperationException($"Failed to start latency tracing: {result}");
+        }
+    }
+
+    /// <summary>
+    /// Stops recording. Buffered events remain available to <see cref="Drain"/>.
+    /// </summary>
+    public static void Stop()
+    {
+        NativeMethods.lrtc_trace_stop();
+    }
+
+    /// <summary>
+    /// Events dropped because a recording thread's buffer was full since the last <see cref="Start"/>.
+    /// </summary>
+    public static ulong DroppedCount => NativeMethods.lrtc_trace_dropped_count();
+
+    /// <summary>
+    /// Removes up to <paramref name="maxEvents"/> of the oldest buffered events.
+    /// </summary>
+    public static TraceEvent[] Drain(int maxEvents = DefaultCapacity)
+    {
+        if (maxEvents <= 0) throw new ArgumentOutOfRangeException(nameof(maxEvents));
+        var buffer = new LrtcTraceEvent[maxEvents];
+        uint count;
+        unsafe
+        {
+            fixed (LrtcTraceEvent* ptr = buffer)
+            {
+                count = NativeMethods.lrtc_trace_drain((IntPtr)ptr, (uint)maxEvents);
+            }
+        }
+
+        var events = new TraceEvent[count];
+        for (var i = 0; i < events.Length; i++)
+        {
+            events[i] = TraceEvent.FromNative(buffer[i]);
+        }
+        return events;
+    }
+
+    /// <summary>
+    /// Formats events as Chrome trace-event JSON, which Perfetto and chrome://tracing open directly.
+    /// </summary>
+    public static string ToChromeTraceJson(IReadOnlyList<TraceEvent> events)
+    {
+        if (events == null) throw new ArgumentNullException(nameof(events));
+        var native = new LrtcTraceEvent[events.Count];
+        for (var i = 0; i < native.Length; i++)
+        {
+            native[i] = events[i].ToNative();
+        }
+
+        var count = (uint)native.Length;
+        unsafe
+        {
+            fixed (LrtcTraceEvent* ptr = native)
+            {
+                return NativeString.GetString(
+                    (IntPtr)ptr,
+                    (eventsPtr, buffer, length) => NativeMethods.lrtc_trace_format_chrome_json(eventsPtr, count, buffer, length));
+            }
+        }
+    }
+}
@@ -0,0 +1,32 @@
+namespace LumenRTC;
+
+/// <summary>
+/// One timed pipeline stage. Timestamps are monotonic microseconds; events of the same
+/// video frame share <see cref="FrameTimestampUs"/>.
+/// </summary>
+public readonly record struct TraceEvent(
+    TraceStage Stage,
+    long StartUs,
+    long DurationUs,
+    long FrameTimestampUs,
+    ulong SourceId,
+    uint ThreadId)
+{
+    internal static TraceEvent FromNative(in LrtcTraceEvent native) => new(
+        (TraceStage)native.stage,
+        native.start_us,
+        native.duration_us,
+        native.frame_timestamp_us,
+        native.source_id,
+        native.thread_id);
+
+    internal LrtcTraceEvent ToNative() => new LrtcTraceEvent
+    {
+        start_us = StartUs,
+        duration_us = DurationUs,
+        frame_timestamp_us = FrameTimestampUs,
+        source_id = SourceId,
+        thread_id = ThreadId,
+        stage = (int)Stage,
+    };
+}
@@ -0,0 +1,15 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Pipeline stage that recorded a <see cref="TraceEvent"/>.
+/// </summary>
+public enum TraceStage
+{
+    DesktopCapture = 0,
+    DesktopConvert = 1,
+    CaptureAdapt = 2,
+    VideoSinkAdapter = 3,
+    VideoSinkCallback = 4,
+    AudioSinkAdapter = 5,
+    AudioSinkCallback = 6,
+}
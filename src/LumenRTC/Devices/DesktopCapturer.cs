@@ -5,8 +5,45 @@ namespace LumenRTC;
 /// </summary>
 public sealed partial class DesktopCapturer : SafeHandle
 {
+    private static readonly LrtcDesktopCaptureStateCb CaptureStateCb = (userData, state) =>
+        NativeCompletion.Take<DesktopCaptureState>(userData).TrySetResult((DesktopCaptureState)state);
+
+    private static readonly LrtcVoidCb CaptureStoppedCb = userData =>
+        NativeCompletion.Take<bool>(userData).TrySetResult(true);
+
     internal DesktopCapturer(IntPtr handle) : base(IntPtr.Zero, true)
     {
         SetHandle(handle);
     }
+
+    public ThreadReport? GetThreadReport()
+    {
+        var result = NativeMethods.lrtc_desktop_capturer_get_thread_report(handle, out var report);
+        return result == LrtcResult.Ok ? ThreadReport.FromNative(report) : null;
+    }
+
+    /// <summary>
+    /// Starts capturing from the factory's signaling thread instead of blocking the caller.
+    /// </summary>
+    public Task<DesktopCaptureState> StartAsync(uint fps)
+    {
+        var completion = NativeCompletion.Create<DesktopCaptureState>(out var userData);
+        var result = NativeMethods.lrtc_desktop_capturer_start_async(handle, fps, CaptureStateCb, userData);
+        return NativeCompletion.Queued(completion, userData, result, "StartAsync");
+    }
+
+    public Task<DesktopCaptureState> StartAsync(uint fps, uint x, uint y, uint width, uint height)
+    {
+        var completion = NativeCompletion.Create<DesktopCaptureState>(out var userData);
+        var result = NativeMethods.lrtc_desktop_capturer_start_region_async(
+            handle, fps, x, y, width, height, CaptureStateCb, userData);
+        return NativeCompletion.Queued(completion, userData, result, "StartAsync");
+    }
+
+    public Task StopAsync()
+    {
+        var completion = NativeCompletion.Create<bool>(out var userData);
+        var result = NativeMethods.lrtc_desktop_capturer_stop_async(handle, CaptureStoppedCb, userData);
+        return NativeCompletion.Queued(completion, userData, result, "StopAsync");
+    }
 }
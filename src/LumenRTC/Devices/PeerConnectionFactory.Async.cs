@@ -0,0 +1,81 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Non-blocking source and track creation. The work is queued on the factory's signaling thread, so
+/// callers on the thread pool never wait on it.
+/// </summary>
+public sealed partial class PeerConnectionFactory
+{
+    private static readonly LrtcAudioSourceCreatedCb AudioSourceCreated = (userData, source) =>
+        NativeCompletion.SetHandle(userData, source, static ptr => new AudioSource(ptr), "Failed to create audio source.");
+
+    private static readonly LrtcVideoSourceCreatedCb VideoSourceCreated = (userData, source) =>
+        NativeCompletion.SetHandle(userData, source, static ptr => new VideoSource(ptr), "Failed to create video source.");
+
+    private static readonly LrtcAudioTrackCreatedCb AudioTrackCreated = (userData, track) =>
+        NativeCompletion.SetHandle(userData, track, static ptr => new AudioTrack(ptr), "Failed to create audio track.");
+
+    private static readonly LrtcVideoTrackCreatedCb VideoTrackCreated = (userData, track) =>
+        NativeCompletion.SetHandle(userData, track, static ptr => new VideoTrack(ptr), "Failed to create video track.");
+
+    public Task<AudioSource> CreateAudioSourceAsync(
+        string label,
+        AudioSourceType sourceType = AudioSourceType.Microphone,
+        AudioOptions? options = null)
+    {
+        using var labelUtf8 = new Utf8String(label);
+        var nativeOptions = new LrtcAudioOptions
+        {
+            echo_cancellation = options?.EchoCancellation ?? true,
+            auto_gain_control = options?.AutoGainControl ?? true,
+            noise_suppression = options?.NoiseSuppression ?? true,
+            highpass_filter = options?.HighpassFilter ?? false,
+        };
+        var completion = NativeCompletion.Create<AudioSource>(out var userData);
+        var result = NativeMethods.lrtc_factory_create_audio_source_async(
+            handle, labelUtf8.Pointer, (LrtcAudioSourceType)sourceType, ref nativeOptions, AudioSourceCreated, userData);
+        return NativeCompletion.Queued(completion, userData, result, "CreateAudioSourceAsync");
+    }
+
+    public Task<VideoSource> CreateVideoSourceAsync(VideoCapturer capturer, string label, MediaConstraints? constraints = null)
+    {
+        if (capturer == null) throw new ArgumentNullException(nameof(capturer));
+        using var labelUtf8 = new Utf8String(label);
+        var completion = NativeCompletion.Create<VideoSource>(out var userData);
+        var result = NativeMethods.lrtc_factory_create_video_source_async(
+            handle, capturer.DangerousGetHandle(), labelUtf8.Pointer, constraints?.DangerousGetHandle() ?? IntPtr.Zero,
+            VideoSourceCreated, userData);
+        return NativeCompletion.Queued(completion, userData, result, "CreateVideoSourceAsync");
+    }
+
+    public Task<VideoSource> CreateDesktopSourceAsync(DesktopCapturer capturer, string label, MediaConstraints? constraints = null)
+    {
+        if (capturer == null) throw new ArgumentNullException(nameof(capturer));
+        using var labelUtf8 = new Utf8String(label);
+        var completion = NativeCompletion.Create<VideoSource>(out var userData);
+        var result = NativeMethods.lrtc_factory_create_desktop_source_async(
+            handle, capturer.DangerousGetHandle(), labelUtf8.Pointer, constraints?.DangerousGetHandle() ?? IntPtr.Zero,
+            VideoSourceCreated, userData);
+        return NativeCompletion.Queued(completion, userData, result, "CreateDesktopSourceAsync");
+    }
+
+    public Task<AudioTrack> CreateAudioTrackAsync(AudioSource source, string trackId)
+    {
+        if (source == null) throw new ArgumentNullException(nameof(source));
+        using var trackUtf8 = new Utf8String(trackId);
+        var completion = NativeCompletion.Create<AudioTrack>(out var userData);
+        var result = NativeMethods.lrtc_factory_create_audio_track_async(
+            handle, source.DangerousGetHandle(), trackUtf8.Pointer, AudioTrackCreated, userData);
+        return NativeCompletion.Queued(completion, userData, result, "CreateAudioTrackAsync");
+    }
+
+    public Task<VideoTrack> CreateVideoTrackAsync(VideoSource source, string trackId)
+    {
+        if (source == null) throw new ArgumentNullException(nameof(source));
+        using var trackUtf8 = new Utf8String(trackId);
+        var completion = NativeCompletion.Create<VideoTrack>(out var userData);
+        var result = NativeMethods.lrtc_factory_create_video_track_async(
+            handle, source.DangerousGetHandle(), trackUtf8.Pointer, VideoTrackCreated, userData);
+        return NativeCompletion.Queued(completion, userData, result, "CreateVideoTrackAsync");
+    }
+}
@@ -24,6 +24,37 @@ public sealed partial class PeerConnectionFactory : SafeHandle
         return factory;
     }
 
+    public static PeerConnectionFactory Create(PeerConnectionFactoryOptions options)
+    {
+        if (options == null) throw new ArgumentNullException(nameof(options));
+        if (options.ThreadMode == FactoryThreadMode.Shared && options.ShareWith == null)
+        {
+            throw new ArgumentException("ShareWith is required for shared thread mode.", nameof(options));
+        }
+        var nativeOptions = new LrtcFactoryOptions
+        {
+            thread_mode = (int)options.ThreadMode,
+            thread_pool_size = options.ThreadPoolSize,
+            network_thread_count = options.NetworkThreadCount,
+            pin_network_threads = options.NetworkThreadFirstCpu.HasValue,
+            network_first_cpu = options.NetworkThreadFirstCpu ?? 0,
+            worker_thread = options.WorkerThread?.ToNative() ?? default,
+            signaling_thread = options.SignalingThread?.ToNative() ?? default,
+            network_thread = options.NetworkThread?.ToNative() ?? default,
+            capture_thread = options.CaptureThread?.ToNative() ?? default,
+            virtual_network = options.VirtualNetwork?.ToNative() ?? default,
+        };
+        var handle = NativeMethods.lrtc_factory_create_with_options(
+            ref nativeOptions, options.ShareWith?.DangerousGetHandle() ?? IntPtr.Zero);
+        if (handle == IntPtr.Zero)
+        {
+            throw new InvalidOperationException("Failed to create peer connection factory.");
+        }
+        var factory = new PeerConnectionFactory();
+        factory.SetHandle(handle);
+        return factory;
+    }
+
     public void Initialize()
     {
         var result = NativeMethods.lrtc_factory_initialize(handle);
@@ -38,7 +69,142 @@ public sealed partial class PeerConnectionFactory : SafeHandle
         NativeMethods.lrtc_factory_terminate(handle);
     }
 
+    public ThreadReport? GetThreadReport(ThreadRole role, int index = 0)
+    {
+        if (index < 0) throw new ArgumentOutOfRangeException(nameof(index));
+        var result = NativeMethods.lrtc_factory_get_thread_report(handle, (LrtcThreadRole)role, (uint)index, out var report);
+        return result == LrtcResult.Ok ? ThreadReport.FromNative(report) : null;
+    }
+
+    /// <summary>
+    /// Changes latency, jitter, loss and bandwidth of the virtual network this factory was created with.
+    /// Returns false if the factory has no virtual network or a value is out of range.
+    /// </summary>
+    public bool SetVirtualNetworkConditions(VirtualNetworkOptions conditions)
+    {
+        if (conditions == null) throw new ArgumentNullException(nameof(conditions));
+        var native = conditions.ToNative();
+        return NativeMethods.lrtc_factory_set_virtual_network_conditions(handle, ref native) == LrtcResult.Ok;
+    }
+
+    /// <summary>
+    /// Shares DTLS certificates between connections created from now on; pass null to go back to one per connection.
+    /// </summary>
+    public void ConfigureCertificateCache(CertificateCacheOptions? options)
+    {
+        var native = options?.ToNative() ?? default;
+        var result = NativeMethods.lrtc_factory_configure_certificate_cache(handle, ref native);
+        if (result != LrtcResult.Ok)
+        {
+            throw new ArgumentOutOfRangeException(nameof(options), $"Invalid certificate cache options: {result}");
+        }
+    }
+
+    /// <summary>
+    /// Adds a certificate from a PEM bundle holding its private key and certificate. Imported certificates
+    /// replace generated ones and enable the cache.
+    /// </summary>
+    public void ImportCertificatePem(string pem)
+    {
+        if (pem == null) throw new ArgumentNullException(nameof(pem));
+        using var pemUtf8 = new Utf8String(pem);
+        var result = NativeMethods.lrtc_factory_import_certificate_pem(handle, pemUtf8.Pointer);
+        if (result != LrtcResult.Ok)
+        {
+            throw new ArgumentException("Not a PEM bundle with a private key and a certificate.", nameof(pem));
+        }
+    }
+
+    /// <summary>
+    /// PEM bundle (private key, then certificate) of the certificate new connections get first,
+    /// or an empty string while the certificate cache is disabled.
+    /// </summary>
+    public string ExportCertificatePem()
+    {
+        return NativeString.GetString(handle, NativeMethods.lrtc_factory_export_certificate_pem);
+    }
+
+    /// <summary>
+    /// Gathers IPv4 host candidates for connections created from now on on one shared UDP port per network
+    /// thread; pass null to go back to a port per connection. Returns false if a port is out of range or taken,
+    /// or the factory runs on a virtual network.
+    /// </summary>
+    public bool ConfigureUdpMux(UdpMuxOptions? options)
+    {
+        var native = options?.ToNative() ?? default;
+        return NativeMethods.lrtc_factory_configure_udp_mux(handle, ref native) == LrtcResult.Ok;
+    }
+
+    public UdpMuxStats GetUdpMuxStats()
+    {
+        var result = NativeMethods.lrtc_factory_get_udp_mux_stats(handle, out var stats);
+        if (result != LrtcResult.Ok)
+        {
+            throw new InvalidOperationException($"Reading UDP mux stats failed: {result}");
+        }
+        return UdpMuxStats.FromNative(stats);
+    }
+
     public PeerConnection CreatePeerConnection(PeerConnectionCallbacks callbacks, RtcConfiguration? config = null, MediaConstraints? constraints = null)
+    {
+        return CreatePeerConnectionCore(callbacks, null, config, constraints);
+    }
+
+    /// <summary>
+    /// Creates a peer connection whose network thread is chosen by hashing <paramref name="networkKey"/>,
+    /// so connections with the same key share a network thread.
+    /// </summary>
+    public PeerConnection CreatePeerConnection(PeerConnectionCallbacks callbacks, string networkKey, RtcConfiguration? config = null, MediaConstraints? constraints = null)
+    {
+        if (networkKey == null) throw new ArgumentNullException(nameof(networkKey));
+        return CreatePeerConnectionCore(callbacks, networkKey, config, constraints);
+    }
+
+    /// <summary>
+    /// Keeps <paramref name="size"/> peer connections built from <paramref name="config"/> warm, with their
+    /// certificate generated and candidates gathered, for <see cref="CreatePooledPeerConnection"/>.
+    /// Reconfiguring closes the warm connections of the previous configuration; a size of 0 disables the pool.
+    /// </summary>
+    public void ConfigurePeerConnectionPool(int size, RtcConfiguration? config = null, MediaConstraints? constraints = null)
+    {
+        if (size < 0) throw new ArgumentOutOfRangeException(nameof(size));
+        using var configMarshaler = config != null ? new RtcConfigurationMarshaler(config) : null;
+        var result = NativeMethods.lrtc_factory_configure_peer_connection_pool(
+            handle, configMarshaler?.Pointer ?? IntPtr.Zero, constraints?.DangerousGetHandle() ?? IntPtr.Zero, size);
+        if (result != LrtcResult.Ok)
+        {
+            throw new InvalidOperationException($"Configuring the peer connection pool failed: {result}");
+        }
+    }
+
+    /// <summary>
+    /// Takes a warm peer connection from the pool, or creates one from the pool's configuration if none is ready.
+    /// </summary>
+    public PeerConnection CreatePooledPeerConnection(PeerConnectionCallbacks callbacks)
+    {
+        if (callbacks == null) throw new ArgumentNullException(nameof(callbacks));
+        var emptyCallbacks = default(LrtcPeerConnectionCallbacks);
+        var pcHandle = NativeMethods.lrtc_peer_connection_create_pooled(handle, ref emptyCallbacks, IntPtr.Zero);
+        if (pcHandle == IntPtr.Zero)
+        {
+            throw new InvalidOperationException("Peer connection pool is not configured.");
+        }
+        var native = callbacks.BuildNative();
+        NativeMethods.lrtc_peer_connection_set_callbacks(pcHandle, ref native, IntPtr.Zero);
+        return new PeerConnection(pcHandle, callbacks);
+    }
+
+    public PeerConnectionPoolStats GetPeerConnectionPoolStats()
+    {
+        var result = NativeMethods.lrtc_factory_get_peer_connection_pool_stats(handle, out var stats);
+        if (result != LrtcResult.Ok)
+        {
+            throw new InvalidOperationException($"Reading peer connection pool stats failed: {result}");
+        }
+        return PeerConnectionPoolStats.FromNative(stats);
+    }
+
+    private PeerConnection CreatePeerConnectionCore(PeerConnectionCallbacks callbacks, string? networkKey, RtcConfiguration? config, MediaConstraints? constraints)
     {
         if (callbacks == null)
         {
@@ -50,8 +216,18 @@ public sealed partial class PeerConnectionFactory : SafeHandle
         using var configMarshaler = config != null ? new RtcConfigurationMarshaler(config) : null;
         var configPtr = configMarshaler?.Pointer ?? IntPtr.Zero;
         var constraintsPtr = constraints?.DangerousGetHandle() ?? IntPtr.Zero;
-        var pcHandle = NativeMethods.lrtc_peer_connection_create(
-            handle, configPtr, constraintsPtr, ref emptyCallbacks, IntPtr.Zero);
+        IntPtr pcHandle;
+        if (networkKey == null)
+        {
+            pcHandle = NativeMethods.lrtc_peer_connection_create(
+                handle, configPtr, constraintsPtr, ref emptyCallbacks, IntPtr.Zero);
+        }
+        else
+        {
+            using var keyUtf8 = new Utf8String(networkKey);
+            pcHandle = NativeMethods.lrtc_peer_connection_create_keyed(
+                handle, keyUtf8.Pointer, configPtr, constraintsPtr, ref emptyCallbacks, IntPtr.Zero);
+        }
         if (pcHandle == IntPtr.Zero)
         {
             throw new InvalidOperationException("Failed to create peer connection.");
@@ -122,6 +298,35 @@ public sealed partial class PeerConnectionFactory : SafeHandle
         return new VideoSource(source);
     }
 
+    public VideoSource CreateCustomVideoSource(string label, bool isScreencast = false)
+    {
+        using var labelUtf8 = new Utf8String(label);
+        var source = NativeMethods.lrtc_factory_create_custom_video_source(handle, labelUtf8.Pointer, isScreencast);
+        if (source == IntPtr.Zero)
+        {
+            throw new InvalidOperationException("Failed to create custom video source.");
+        }
+        return new VideoSource(source);
+    }
+
+    /// <summary>
+    /// Creates a source fed with already encoded access units through <see cref="VideoSource.PushEncoded"/>.
+    /// Senders of its track send the units as they are, without encoding. <paramref name="codec"/> is
+    /// <c>H264</c> or <c>VP8</c>, and the sender has to negotiate the same codec.
+    /// </summary>
+    public VideoSource CreateEncodedVideoSource(string label, string codec)
+    {
+        if (codec == null) throw new ArgumentNullException(nameof(codec));
+        using var labelUtf8 = new Utf8String(label);
+        using var codecUtf8 = new Utf8String(codec);
+        var source = NativeMethods.lrtc_factory_create_encoded_video_source(handle, labelUtf8.Pointer, codecUtf8.Pointer);
+        if (source == IntPtr.Zero)
+        {
+            throw new InvalidOperationException($"Failed to create encoded video source for codec '{codec}'.");
+        }
+        return new VideoSource(source);
+    }
+
     public VideoSource CreateDesktopSource(DesktopCapturer capturer, string label, MediaConstraints? constraints = null)
     {
         if (capturer == null) throw new ArgumentNullException(nameof(capturer));
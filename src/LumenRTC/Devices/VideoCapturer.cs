@@ -5,8 +5,31 @@ namespace LumenRTC;
 /// </summary>
 public sealed partial class VideoCapturer : SafeHandle
 {
+    private static readonly LrtcVideoCaptureStartedCb CaptureStartedCb = (userData, started) =>
+        NativeCompletion.Take<bool>(userData).TrySetResult(started != 0);
+
+    private static readonly LrtcVoidCb CaptureStoppedCb = userData =>
+        NativeCompletion.Take<bool>(userData).TrySetResult(true);
+
     internal VideoCapturer(IntPtr handle) : base(IntPtr.Zero, true)
     {
         SetHandle(handle);
     }
+
+    /// <summary>
+    /// Starts capturing on the factory's worker thread; the task reports whether the device started.
+    /// </summary>
+    public Task<bool> StartAsync()
+    {
+        var completion = NativeCompletion.Create<bool>(out var userData);
+        var result = NativeMethods.lrtc_video_capturer_start_async(handle, CaptureStartedCb, userData);
+        return NativeCompletion.Queued(completion, userData, result, "StartAsync");
+    }
+
+    public Task StopAsync()
+    {
+        var completion = NativeCompletion.Create<bool>(out var userData);
+        var result = NativeMethods.lrtc_video_capturer_stop_async(handle, CaptureStoppedCb, userData);
+        return NativeCompletion.Queued(completion, userData, result, "StopAsync");
+    }
 }
@@ -8,6 +8,9 @@ public sealed partial class VideoDevice : SafeHandle
     private const int MaxNameSize = 256;
     private const int MaxUniqueIdSize = 256;
 
+    private static readonly LrtcVideoCapturerCreatedCb CapturerCreated = (userData, capturer) =>
+        NativeCompletion.SetHandle(userData, capturer, static ptr => new VideoCapturer(ptr), "Failed to create video capturer.");
+
     internal VideoDevice(IntPtr handle) : base(IntPtr.Zero, true)
     {
         SetHandle(handle);
@@ -45,4 +48,16 @@ public sealed partial class VideoDevice : SafeHandle
         }
         return new VideoCapturer(capturer);
     }
+
+    /// <summary>
+    /// Opens the device on the factory's worker thread instead of blocking the caller while it starts up.
+    /// </summary>
+    public Task<VideoCapturer> CreateCapturerAsync(string name, uint index, uint width, uint height, uint fps)
+    {
+        using var nameUtf8 = new Utf8String(name);
+        var completion = NativeCompletion.Create<VideoCapturer>(out var userData);
+        var result = NativeMethods.lrtc_video_device_create_capturer_async(
+            handle, nameUtf8.Pointer, index, width, height, fps, CapturerCreated, userData);
+        return NativeCompletion.Queued(completion, userData, result, "CreateCapturerAsync");
+    }
 }
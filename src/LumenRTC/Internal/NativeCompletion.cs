@@ -0,0 +1,51 @@
+namespace LumenRTC.Internal;
+
+/// <summary>
+/// Passes a <see cref="TaskCompletionSource{TResult}"/> through the user_data of a native completion
+/// callback, so the callback delegates can be static and nothing per call has to be kept alive.
+/// Callbacks run on a bridge thread; continuations are forced off it.
+/// </summary>
+internal static class NativeCompletion
+{
+    public static TaskCompletionSource<T> Create<T>(out IntPtr userData)
+    {
+        var completion = new TaskCompletionSource<T>(TaskCreationOptions.RunContinuationsAsynchronously);
+        userData = GCHandle.ToIntPtr(GCHandle.Alloc(completion));
+        return completion;
+    }
+
+    /// <summary>
+    /// Returns the task of a request; if the native side refused to queue it, its callback will never run,
+    /// so the handle is released and the task faulted here.
+    /// </summary>
+    public static Task<T> Queued<T>(TaskCompletionSource<T> completion, IntPtr userData, LrtcResult result, string operation)
+    {
+        if (result != LrtcResult.Ok)
+        {
+            GCHandle.FromIntPtr(userData).Free();
+            completion.TrySetException(new InvalidOperationException($"{operation} failed: {result}"));
+        }
+        return completion.Task;
+    }
+
+    /// <summary>Returns the completion behind <paramref name="userData"/> and releases its handle.</summary>
+    public static TaskCompletionSource<T> Take<T>(IntPtr userData)
+    {
+        var handle = GCHandle.FromIntPtr(userData);
+        var completion = (TaskCompletionSource<T>)handle.Target!;
+        handle.Free();
+        return completion;
+    }
+
+    /// <summary>Completes with a wrapper around a created native object, or faults if creation failed.</summary>
+    public static void SetHandle<T>(IntPtr userData, IntPtr native, Func<IntPtr, T> wrap, string error)
+    {
+        var completion = Take<T>(userData);
+        if (native == IntPtr.Zero)
+        {
+            completion.TrySetException(new InvalidOperationException(error));
+            return;
+        }
+        completion.TrySetResult(wrap(native));
+    }
+}
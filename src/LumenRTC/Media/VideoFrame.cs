@@ -67,6 +67,7 @@ public sealed class VideoFrame : IDisposable
 
     public int Width  => NativeMethods.lrtc_video_frame_width(ValidHandle());
     public int Height => NativeMethods.lrtc_video_frame_height(ValidHandle());
+    public VideoPixelFormat Format => (VideoPixelFormat)NativeMethods.lrtc_video_frame_format(ValidHandle());
     public int StrideY => NativeMethods.lrtc_video_frame_stride_y(ValidHandle());
     public int StrideU => NativeMethods.lrtc_video_frame_stride_u(ValidHandle());
     public int StrideV => NativeMethods.lrtc_video_frame_stride_v(ValidHandle());
@@ -103,7 +104,20 @@ public sealed class VideoFrame : IDisposable
         CopyToI420(yPlane, yRowWidth, uPlane, uvRowWidth, vPlane, uvRowWidth);
     }
 
+    /// <summary>
+    /// Copies the frame into the I420 planes. A frame that cannot be converted leaves them unchanged;
+    /// use <see cref="TryCopyToI420"/> to find out.
+    /// </summary>
     public void CopyToI420(Span<byte> y, int strideY, Span<byte> u, int strideU, Span<byte> v, int strideV)
+    {
+        TryCopyToI420(y, strideY, u, strideU, v, strideV);
+    }
+
+    /// <summary>
+    /// Copies the frame into the I420 planes like <see cref="CopyToI420"/>. Returns false, leaving the planes
+    /// unchanged, if the frame cannot be converted, for example when a texture cannot be read back.
+    /// </summary>
+    public bool TryCopyToI420(Span<byte> y, int strideY, Span<byte> u, int strideU, Span<byte> v, int strideV)
     {
         var h = ValidHandle();
         unsafe
@@ -112,7 +126,8 @@ public sealed class VideoFrame : IDisposable
             fixed (byte* uPtr = u)
             fixed (byte* vPtr = v)
             {
-                NativeMethods.lrtc_video_frame_copy_i420(h, (IntPtr)yPtr, strideY, (IntPtr)uPtr, strideU, (IntPtr)vPtr, strideV);
+                return NativeMethods.lrtc_video_frame_copy_i420(
+                    h, (IntPtr)yPtr, strideY, (IntPtr)uPtr, strideU, (IntPtr)vPtr, strideV) != 0;
             }
         }
     }
@@ -0,0 +1,17 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Memory layout of a delivered video frame. Packed formats use libyuv naming, so <see cref="Argb"/> is B, G, R, A
+/// in memory.
+/// </summary>
+public enum VideoPixelFormat
+{
+    /// <summary>Whatever the source produced; a frame in a layout not listed here is delivered as I420.</summary>
+    Native = 0,
+    I420 = 1,
+    /// <summary>Y plane in <see cref="VideoFrame.DataY"/>, interleaved UV plane in <see cref="VideoFrame.DataU"/>.</summary>
+    Nv12 = 2,
+    /// <summary>One plane in <see cref="VideoFrame.DataY"/>, four bytes per pixel.</summary>
+    Argb = 3,
+    Bgra = 4,
+}
@@ -19,4 +19,24 @@ public sealed partial class VideoSink : SafeHandle
         }
         SetHandle(handle);
     }
+
+    /// <summary>
+    /// Creates a sink that receives frames no larger or more frequent than <paramref name="wants"/> asks for. On a
+    /// local track that is also sent, the limits reach the encoder as well, since the source serves the most
+    /// restrictive of its sinks.
+    /// </summary>
+    public VideoSink(VideoSinkCallbacks callbacks, VideoSinkWants wants)
+        : base(IntPtr.Zero, true)
+    {
+        _callbacks = callbacks ?? throw new ArgumentNullException(nameof(callbacks));
+        if (wants == null) throw new ArgumentNullException(nameof(wants));
+        var native = callbacks.BuildNative();
+        var nativeWants = wants.ToNative();
+        var handle = NativeMethods.lrtc_video_sink_create_with_wants(ref native, ref nativeWants, IntPtr.Zero);
+        if (handle == IntPtr.Zero)
+        {
+            throw new InvalidOperationException("Failed to create video sink.");
+        }
+        SetHandle(handle);
+    }
 }
@@ -0,0 +1,37 @@
+namespace LumenRTC;
+
+/// <summary>
+/// What a <see cref="VideoSink"/> renders. Frames are scaled down and thinned out for it natively, and the limits
+/// reach the track's source. Zero means no limit.
+/// </summary>
+public sealed class VideoSinkWants
+{
+    /// <summary>Frames with more pixels than this are scaled down, keeping their aspect ratio.</summary>
+    public int MaxPixelCount { get; set; }
+
+    public int MaxFramerate { get; set; }
+
+    /// <summary>Delivered widths and heights are multiples of this; at most 64.</summary>
+    public int ResolutionAlignment { get; set; } = 1;
+
+    /// <summary>Layout frames are converted to natively, once per track however many sinks ask for it.</summary>
+    public VideoPixelFormat Format { get; set; }
+
+    /// <summary>
+    /// Exact size frames are scaled to, ignoring their aspect ratio. Used only when both are set, and then in place
+    /// of <see cref="MaxPixelCount"/> and <see cref="ResolutionAlignment"/>.
+    /// </summary>
+    public int Width { get; set; }
+
+    public int Height { get; set; }
+
+    internal LrtcVideoSinkWants ToNative() => new LrtcVideoSinkWants
+    {
+        max_pixel_count = (uint)Math.Max(MaxPixelCount, 0),
+        max_framerate = (uint)Math.Max(MaxFramerate, 0),
+        resolution_alignment = (uint)Math.Max(ResolutionAlignment, 1),
+        format = (int)Format,
+        width = (uint)Math.Max(Width, 0),
+        height = (uint)Math.Max(Height, 0),
+    };
+}
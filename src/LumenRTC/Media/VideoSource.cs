@@ -1,3 +1,5 @@
+using System.Buffers;
+
 namespace LumenRTC;
 
 /// <summary>
@@ -5,8 +7,239 @@ namespace LumenRTC;
 /// </summary>
 public sealed partial class VideoSource : SafeHandle
 {
+    // Unpins the planes of a zero-copy push and runs the caller's release callback.
+    private static readonly LrtcVoidCb FrameReleasedCb = userData =>
+    {
+        var handle = GCHandle.FromIntPtr(userData);
+        var frame = (PinnedFrame)handle.Target!;
+        handle.Free();
+        frame.Unpin();
+        frame.Release();
+    };
+
+    // Called by an encoded source until replaced or the handle is released.
+    private LrtcVoidCb? _keyFrameRequestCb;
+
     internal VideoSource(IntPtr handle) : base(IntPtr.Zero, true)
     {
         SetHandle(handle);
     }
+
+    /// <summary>
+    /// Pushes an I420 frame into a source created with
+    /// <see cref="PeerConnectionFactory.CreateCustomVideoSource"/>. The planes are copied
+    /// (or scaled/dropped to match sink demands) before the call returns. Returns false if the frame was
+    /// dropped because all pooled buffers are in use; see <see cref="DroppedFrames"/>.
+    /// </summary>
+    /// <exception cref="ArgumentException">A stride is narrower than its plane or a plane is too small.</exception>
+    public bool PushI420(ReadOnlySpan<byte> y, int strideY, ReadOnlySpan<byte> u, int strideU,
+        ReadOnlySpan<byte> v, int strideV, int width, int height, long timestampUs)
+    {
+        CheckFrameSize(width, height);
+        var chromaWidth  = (width + 1) / 2;
+        var chromaHeight = (height + 1) / 2;
+        CheckPlane(y.Length, nameof(y), strideY, nameof(strideY), width, height);
+        CheckPlane(u.Length, nameof(u), strideU, nameof(strideU), chromaWidth, chromaHeight);
+        CheckPlane(v.Length, nameof(v), strideV, nameof(strideV), chromaWidth, chromaHeight);
+        unsafe
+        {
+            fixed (byte* yPtr = y)
+            fixed (byte* uPtr = u)
+            fixed (byte* vPtr = v)
+            {
+                return NativeMethods.lrtc_video_source_push_i420(
+                    handle, (IntPtr)yPtr, strideY, (IntPtr)uPtr, strideU, (IntPtr)vPtr, strideV,
+                    width, height, timestampUs, null, IntPtr.Zero) != 0;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Pushes an I420 frame without copying it when it needs no scaling. The memory stays pinned, and must
+    /// not change, until <paramref name="release"/> runs: before this call returns if the frame is copied,
+    /// scaled or dropped for the sinks, later on a WebRTC thread otherwise. It does not run when this
+    /// returns false, for example when all pooled buffers are in use; see <see cref="DroppedFrames"/>.
+    /// </summary>
+    /// <exception cref="ArgumentException">A stride is narrower than its plane or a plane is too small.</exception>
+    public bool PushI420(ReadOnlyMemory<byte> y, int strideY, ReadOnlyMemory<byte> u, int strideU,
+        ReadOnlyMemory<byte> v, int strideV, int width, int height, long timestampUs, Action release)
+    {
+        if (release == null) throw new ArgumentNullException(nameof(release));
+        CheckFrameSize(width, height);
+        var chromaWidth  = (width + 1) / 2;
+        var chromaHeight = (height + 1) / 2;
+        CheckPlane(y.Length, nameof(y), strideY, nameof(strideY), width, height);
+        CheckPlane(u.Length, nameof(u), strideU, nameof(strideU), chromaWidth, chromaHeight);
+        CheckPlane(v.Length, nameof(v), strideV, nameof(strideV), chromaWidth, chromaHeight);
+        var frame = new PinnedFrame(release, y.Pin(), u.Pin(), v.Pin());
+        var userData = GCHandle.ToIntPtr(GCHandle.Alloc(frame));
+        var pushed = NativeMethods.lrtc_video_source_push_i420(
+            handle, frame.Pointer(0), strideY, frame.Pointer(1), strideU, frame.Pointer(2), strideV,
+            width, height, timestampUs, FrameReleasedCb, userData) != 0;
+        if (!pushed)
+            frame.Abandon(userData);
+        return pushed;
+    }
+
+    /// <summary>
+    /// Pushes an NV12 frame into a custom video source. See
+    /// <see cref="PushI420(ReadOnlySpan{byte}, int, ReadOnlySpan{byte}, int, ReadOnlySpan{byte}, int, int, int, long)"/>.
+    /// </summary>
+    /// <exception cref="ArgumentException">A stride is narrower than its plane or a plane is too small.</exception>
+    public bool PushNv12(ReadOnlySpan<byte> y, int strideY, ReadOnlySpan<byte> uv, int strideUV,
+        int width, int height, long timestampUs)
+    {
+        CheckFrameSize(width, height);
+        // Interleaved U and V samples: one byte each per two luma columns.
+        var uvRowWidth = checked(((width + 1) / 2) * 2);
+        CheckPlane(y.Length, nameof(y), strideY, nameof(strideY), width, height);
+        CheckPlane(uv.Length, nameof(uv), strideUV, nameof(strideUV), uvRowWidth, (height + 1) / 2);
+        unsafe
+        {
+            fixed (byte* yPtr = y)
+            fixed (byte* uvPtr = uv)
+            {
+                return NativeMethods.lrtc_video_source_push_nv12(
+                    handle, (IntPtr)yPtr, strideY, (IntPtr)uvPtr, strideUV,
+                    width, height, timestampUs, null, IntPtr.Zero) != 0;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Pushes an NV12 frame without copying it when it needs no scaling. See
+    /// <see cref="PushI420(ReadOnlyMemory{byte}, int, ReadOnlyMemory{byte}, int, ReadOnlyMemory{byte}, int, int, int, long, Action)"/>.
+    /// </summary>
+    /// <exception cref="ArgumentException">A stride is narrower than its plane or a plane is too small.</exception>
+    public bool PushNv12(ReadOnlyMemory<byte> y, int strideY, ReadOnlyMemory<byte> uv, int strideUV,
+        int width, int height, long timestampUs, Action release)
+    {
+        if (release == null) throw new ArgumentNullException(nameof(release));
+        CheckFrameSize(width, height);
+        var uvRowWidth = checked(((width + 1) / 2) * 2);
+        CheckPlane(y.Length, nameof(y), strideY, nameof(strideY), width, height);
+        CheckPlane(uv.Length, nameof(uv), strideUV, nameof(strideUV), uvRowWidth, (height + 1) / 2);
+        var frame = new PinnedFrame(release, y.Pin(), uv.Pin());
+        var userData = GCHandle.ToIntPtr(GCHandle.Alloc(frame));
+        var pushed = NativeMethods.lrtc_video_source_push_nv12(
+            handle, frame.Pointer(0), strideY, frame.Pointer(1), strideUV,
+            width, height, timestampUs, FrameReleasedCb, userData) != 0;
+        if (!pushed)
+            frame.Abandon(userData);
+        return pushed;
+    }
+
+    /// <summary>
+    /// Frames a custom source dropped because all of its pooled buffers were still held by the encoder or
+    /// renderers; the push that dropped one returned false. Frames dropped to match sink demands are not counted.
+    /// </summary>
+    public ulong DroppedFrames => NativeMethods.lrtc_video_source_dropped_count(handle);
+
+    /// <summary>
+    /// Pushes a packed 32-bit frame into a custom video source. See
+    /// <see cref="PushI420(ReadOnlySpan{byte}, int, ReadOnlySpan{byte}, int, ReadOnlySpan{byte}, int, int, int, long)"/>.
+    /// </summary>
+    /// <exception cref="ArgumentException">The stride is narrower than a row or the buffer is too small.</exception>
+    public bool PushArgb(ReadOnlySpan<byte> pixels, int stride, int width, int height,
+        VideoFrameFormat format, long timestampUs)
+    {
+        CheckFrameSize(width, height);
+        CheckPlane(pixels.Length, nameof(pixels), stride, nameof(stride), checked(width * 4), height);
+        unsafe
+        {
+            fixed (byte* ptr = pixels)
+            {
+                return NativeMethods.lrtc_video_source_push_argb(
+                    handle, (IntPtr)ptr, stride, width, height, (int)format,
+                    timestampUs, null, IntPtr.Zero) != 0;
+            }
+        }
+    }
+
+    // Planes of a zero-copy push, pinned until the native source releases them.
+    private sealed class PinnedFrame
+    {
+        private readonly Action _release;
+        private readonly MemoryHandle[] _pins;
+
+        public PinnedFrame(Action release, params MemoryHandle[] pins)
+        {
+            _release = release;
+            _pins = pins;
+        }
+
+        public unsafe IntPtr Pointer(int plane) => (IntPtr)_pins[plane].Pointer;
+
+        public void Unpin()
+        {
+            foreach (var pin in _pins)
+                pin.Dispose();
+        }
+
+        public void Release() => _release();
+
+        // The push failed, so the native side never runs the callback; the caller keeps its memory.
+        public void Abandon(IntPtr userData)
+        {
+            GCHandle.FromIntPtr(userData).Free();
+            Unpin();
+        }
+    }
+
+    private static void CheckFrameSize(int width, int height)
+    {
+        if (width <= 0)
+            throw new ArgumentOutOfRangeException(nameof(width), width, "Width must be positive.");
+        if (height <= 0)
+            throw new ArgumentOutOfRangeException(nameof(height), height, "Height must be positive.");
+    }
+
+    // rowWidth is in bytes; the native side reads stride * rows bytes from the plane.
+    private static void CheckPlane(int length, string planeName, int stride, string strideName, int rowWidth, int rows)
+    {
+        if (stride < rowWidth)
+            throw new ArgumentException(
+                $"Stride '{strideName}' is too small. Expected at least {rowWidth} bytes, got {stride}.",
+                strideName);
+        var required = (long)stride * rows;
+        if (length < required)
+            throw new ArgumentException(
+                $"Source plane '{planeName}' is too small. Expected at least {required} bytes, got {length}.",
+                planeName);
+    }
+
+    /// <summary>
+    /// Pushes one encoded access unit into a source created with
+    /// <see cref="PeerConnectionFactory.CreateEncodedVideoSource"/>. The data is copied before the call
+    /// returns; H.264 units are Annex B byte streams. Senders skip delta units until the next key frame
+    /// when a receiver has lost the stream, so push key frames when <see cref="SetKeyFrameRequestHandler"/>
+    /// asks for them.
+    /// </summary>
+    public bool PushEncoded(ReadOnlySpan<byte> data, int width, int height, bool keyFrame, long timestampUs)
+    {
+        unsafe
+        {
+            fixed (byte* ptr = data)
+            {
+                return NativeMethods.lrtc_video_source_push_encoded(
+                    handle, (IntPtr)ptr, (uint)data.Length, width, height, keyFrame, timestampUs) != 0;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Sets the handler an encoded source calls on a WebRTC thread when a receiver needs a key frame,
+    /// for example after a PLI or FIR; null clears it.
+    /// </summary>
+    /// <exception cref="InvalidOperationException">The source is not an encoded source.</exception>
+    public void SetKeyFrameRequestHandler(Action? handler)
+    {
+        LrtcVoidCb? callback = handler == null ? null : _ => handler();
+        var result = NativeMethods.lrtc_video_source_set_key_frame_request_callback(handle, callback, IntPtr.Zero);
+        if (result != LrtcResult.Ok)
+        {
+            throw new InvalidOperationException("Only encoded video sources request key frames.");
+        }
+        _keyFrameRequestCb = callback;
+    }
 }
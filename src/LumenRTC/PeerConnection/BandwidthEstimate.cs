@@ -0,0 +1,19 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Send-side bandwidth estimate of a <see cref="PeerConnection"/>, pushed by
+/// <see cref="PeerConnection.SetBandwidthObserver"/>.
+/// </summary>
+/// <param name="TargetBitrateBps">Rate the congestion controller lets the connection send at.</param>
+/// <param name="StableTargetBitrateBps">Smoothed target rate, slow to follow short dips.</param>
+/// <param name="EncoderTargetBitrateBps">Bitrate handed to the video encoders, summed over <paramref name="EncoderCount"/>.</param>
+/// <param name="EncoderCount">Video encoders currently allocated a bitrate.</param>
+/// <param name="RoundTripTime">Round trip time seen by the congestion controller.</param>
+/// <param name="LossRate">Fraction of packets reported lost, 0 to 1.</param>
+public readonly record struct BandwidthEstimate(
+    int TargetBitrateBps,
+    int StableTargetBitrateBps,
+    int EncoderTargetBitrateBps,
+    int EncoderCount,
+    TimeSpan RoundTripTime,
+    double LossRate);
@@ -8,6 +8,8 @@ public sealed partial class PeerConnection : SafeHandle
     private readonly PeerConnectionCallbacks _callbacks;
     private readonly object _keepAliveSync = new();
     private readonly HashSet<Delegate> _keepAlive = [];
+    private LrtcIceCandidatesCb? _iceCandidatesCb;
+    private LrtcBandwidthEstimateCb? _bandwidthEstimateCb;
 
     internal PeerConnection(IntPtr handle, PeerConnectionCallbacks callbacks)
         : base(IntPtr.Zero, true)
@@ -74,6 +76,37 @@ public sealed partial class PeerConnection : SafeHandle
         CreateOffer((sdp, type) => onSuccess(new SessionDescription(sdp, type)), onFailure);
     }
 
+    /// <summary>
+    /// Creates an offer and sets it as the local description in one step, so the offer is never parsed
+    /// back from text. Offers shaped like the last one <paramref name="sessionTemplate"/> serialized are
+    /// rendered from its cached text; pass null to always serialize in full.
+    /// </summary>
+    public void CreateTemplatedOffer(SessionTemplate? sessionTemplate, Action<SessionDescription> onSuccess, Action<string> onFailure)
+    {
+        if (onSuccess == null) throw new ArgumentNullException(nameof(onSuccess));
+        if (onFailure == null) throw new ArgumentNullException(nameof(onFailure));
+
+        LrtcSdpSuccessCb? successCb = null;
+        LrtcSdpErrorCb? errorCb = null;
+
+        successCb = (_, sdpPtr, typePtr) =>
+        {
+            ReleaseCallbacks(successCb, errorCb);
+            onSuccess(new SessionDescription(Utf8String.Read(sdpPtr), Utf8String.Read(typePtr)));
+        };
+        errorCb = (_, errPtr) =>
+        {
+            ReleaseCallbacks(successCb, errorCb);
+            onFailure(Utf8String.Read(errPtr));
+        };
+
+        KeepCallbackAlive(successCb);
+        KeepCallbackAlive(errorCb);
+
+        NativeMethods.lrtc_peer_connection_create_templated_offer(
+            handle, sessionTemplate?.DangerousGetHandle() ?? IntPtr.Zero, successCb, errorCb, IntPtr.Zero, IntPtr.Zero);
+    }
+
     public void CreateAnswer(Action<string, string> onSuccess, Action<string> onFailure)
     {
         if (onSuccess == null) throw new ArgumentNullException(nameof(onSuccess));
@@ -172,6 +205,35 @@ public sealed partial class PeerConnection : SafeHandle
         SetRemoteDescription(description.Sdp, description.Type, onSuccess, onFailure);
     }
 
+    /// <summary>
+    /// Negotiates with <paramref name="answerer"/> in-process: descriptions and ICE candidates are handed over
+    /// directly, without an application signaling channel. Candidates keep flowing until either side closes.
+    /// </summary>
+    public void ConnectLoopback(PeerConnection answerer, Action onSuccess, Action<string> onFailure)
+    {
+        if (answerer == null) throw new ArgumentNullException(nameof(answerer));
+
+        LrtcVoidCb? successCb = null;
+        LrtcSdpErrorCb? errorCb = null;
+
+        successCb = _ =>
+        {
+            ReleaseCallbacks(successCb, errorCb);
+            onSuccess?.Invoke();
+        };
+        errorCb = (_, errPtr) =>
+        {
+            ReleaseCallbacks(successCb, errorCb);
+            onFailure?.Invoke(Utf8String.Read(errPtr));
+        };
+
+        KeepCallbackAlive(successCb);
+        KeepCallbackAlive(errorCb);
+
+        NativeMethods.lrtc_peer_connection_connect_loopback(
+            handle, answerer.DangerousGetHandle(), successCb, errorCb, IntPtr.Zero);
+    }
+
     public void GetLocalDescription(Action<string, string> onSuccess, Action<string> onFailure)
     {
         if (onSuccess == null) throw new ArgumentNullException(nameof(onSuccess));
@@ -234,6 +296,32 @@ public sealed partial class PeerConnection : SafeHandle
         GetRemoteDescription((sdp, type) => onSuccess(new SessionDescription(sdp, type)), onFailure);
     }
 
+    /// <summary>
+    /// The current local description, read directly instead of through a callback; null when none is set.
+    /// </summary>
+    public SessionDescription? LocalDescription => ReadDescription(
+        NativeMethods.lrtc_peer_connection_copy_local_description,
+        NativeMethods.lrtc_peer_connection_copy_local_description_type);
+
+    /// <summary>
+    /// The current remote description, read directly instead of through a callback; null when none is set.
+    /// </summary>
+    public SessionDescription? RemoteDescription => ReadDescription(
+        NativeMethods.lrtc_peer_connection_copy_remote_description,
+        NativeMethods.lrtc_peer_connection_copy_remote_description_type);
+
+    private SessionDescription? ReadDescription(
+        Func<IntPtr, IntPtr, uint, int> copySdp,
+        Func<IntPtr, IntPtr, uint, int> copyType)
+    {
+        var sdp = NativeString.GetString(handle, copySdp);
+        if (sdp.Length == 0)
+        {
+            return null;
+        }
+        return new SessionDescription(sdp, NativeString.GetString(handle, copyType));
+    }
+
     public void AddIceCandidate(string sdpMid, int sdpMlineIndex, string candidate)
     {
         using var midUtf8 = new Utf8String(sdpMid);
@@ -271,6 +359,160 @@ public sealed partial class PeerConnection : SafeHandle
         AddIceCandidate(candidate.SdpMid, candidate.SdpMlineIndex, candidate.Candidate);
     }
 
+    /// <summary>
+    /// Applies a burst of remote candidates with one native call and one signaling-thread hop.
+    /// Returns how many were applied.
+    /// </summary>
+    public int AddIceCandidates(IReadOnlyList<IceCandidate> candidates)
+    {
+        return AddIceCandidates(candidates, null);
+    }
+
+    /// <summary>
+    /// Applies a burst of remote candidates like <see cref="AddIceCandidates(IReadOnlyList{IceCandidate})"/>
+    /// and reports each one: <paramref name="applied"/>[i] is set to whether candidate i was applied,
+    /// so malformed or rejected candidates can be told apart. Returns how many were applied.
+    /// </summary>
+    public int AddIceCandidates(IReadOnlyList<IceCandidate> candidates, bool[]? applied)
+    {
+        if (candidates == null) throw new ArgumentNullException(nameof(candidates));
+        if (applied != null && applied.Length < candidates.Count)
+        {
+            throw new ArgumentException("Result array is smaller than the candidate list.", nameof(applied));
+        }
+        if (candidates.Count == 0)
+        {
+            return 0;
+        }
+
+        var mids = new string[candidates.Count];
+        var sdps = new string[candidates.Count];
+        var indexes = new int[candidates.Count];
+        for (var i = 0; i < candidates.Count; i++)
+        {
+            mids[i] = candidates[i].SdpMid;
+            sdps[i] = candidates[i].Candidate;
+            indexes[i] = candidates[i].SdpMlineIndex;
+        }
+
+        var results = applied != null ? new int[candidates.Count] : null;
+        int count;
+        using var midsUtf8 = new Utf8StringArray(mids);
+        using var sdpsUtf8 = new Utf8StringArray(sdps);
+        unsafe
+        {
+            fixed (int* indexesPtr = indexes)
+            fixed (int* resultsPtr = results)
+            {
+                count = NativeMethods.lrtc_peer_connection_add_ice_candidates(
+                    handle, midsUtf8.Pointer, (IntPtr)indexesPtr, sdpsUtf8.Pointer, (uint)candidates.Count,
+                    (IntPtr)resultsPtr);
+            }
+        }
+
+        if (applied != null)
+        {
+            for (var i = 0; i < candidates.Count; i++)
+            {
+                applied[i] = results![i] != 0;
+            }
+        }
+        return count;
+    }
+
+    /// <summary>
+    /// Delivers local candidates gathered within <paramref name="window"/> of each other as one batch
+    /// instead of through the per-candidate callback; the batch is flushed early when gathering completes.
+    /// A zero window or null handler goes back to one callback per candidate.
+    /// </summary>
+    public void SetIceCandidateBatching(TimeSpan window, Action<IReadOnlyList<IceCandidate>>? onCandidates)
+    {
+        if (window < TimeSpan.Zero) throw new ArgumentOutOfRangeException(nameof(window));
+
+        LrtcIceCandidatesCb? callback = null;
+        if (onCandidates != null && window > TimeSpan.Zero)
+        {
+            callback = (_, midsPtr, indexesPtr, candidatesPtr, count) =>
+            {
+                var batch = new IceCandidate[count];
+                for (var i = 0; i < batch.Length; i++)
+                {
+                    batch[i] = new IceCandidate(
+                        Utf8String.Read(Marshal.ReadIntPtr(midsPtr, i * IntPtr.Size)),
+                        Marshal.ReadInt32(indexesPtr, i * sizeof(int)),
+                        Utf8String.Read(Marshal.ReadIntPtr(candidatesPtr, i * IntPtr.Size)));
+                }
+                onCandidates(batch);
+            };
+        }
+
+        var windowMs = callback == null ? 0u : (uint)Math.Min(Math.Ceiling(window.TotalMilliseconds), uint.MaxValue);
+        var previous = _iceCandidatesCb;
+        _iceCandidatesCb = callback;
+        NativeMethods.lrtc_peer_connection_set_ice_candidate_batching(handle, windowMs, callback, IntPtr.Zero);
+        GC.KeepAlive(previous);
+    }
+
+    /// <summary>
+    /// Pushes the send-side bandwidth estimate, the video encoder targets and the RTT whenever they change,
+    /// at most once per <paramref name="interval"/>, without polling <see cref="GetStats"/>. The first report
+    /// follows right away. A zero interval or null handler stops reporting.
+    /// </summary>
+    public void SetBandwidthObserver(TimeSpan interval, Action<BandwidthEstimate>? onEstimate)
+    {
+        if (interval < TimeSpan.Zero) throw new ArgumentOutOfRangeException(nameof(interval));
+
+        LrtcBandwidthEstimateCb? callback = null;
+        if (onEstimate != null && interval > TimeSpan.Zero)
+        {
+            callback = (_, target, stableTarget, encoderTarget, encoderCount, rttMs, lossRate) =>
+                onEstimate(new BandwidthEstimate(
+                    target, stableTarget, encoderTarget, encoderCount, TimeSpan.FromMilliseconds(rttMs), lossRate));
+        }
+
+        var intervalMs = callback == null ? 0u : (uint)Math.Min(Math.Ceiling(interval.TotalMilliseconds), uint.MaxValue);
+        var previous = _bandwidthEstimateCb;
+        _bandwidthEstimateCb = callback;
+        NativeMethods.lrtc_peer_connection_set_bandwidth_observer(handle, intervalMs, callback, IntPtr.Zero);
+        GC.KeepAlive(previous);
+    }
+
+    /// <summary>
+    /// Attaches a native controller that activates and deactivates the simulcast layers of a video sender,
+    /// or changes the spatial layers of its SVC scalability mode, from the bandwidth estimate, the loss and
+    /// RTT history and the encoder's CPU state. Each decision is applied as one parameters transaction and
+    /// reported to <paramref name="onDecision"/> on the signaling thread.
+    /// </summary>
+    /// <exception cref="InvalidOperationException">
+    /// The sender is not a video sender of this connection, or has a single encoding without a multi-layer
+    /// scalability mode.
+    /// </exception>
+    public LayerController CreateLayerController(
+        RtpSender sender,
+        LayerControllerOptions? options = null,
+        Action<LayerDecision>? onDecision = null)
+    {
+        if (sender == null) throw new ArgumentNullException(nameof(sender));
+
+        LrtcLayerDecisionCb? callback = null;
+        if (onDecision != null)
+        {
+            callback = (_, reason, previousLevel, level, targetBitrateBps, lossRate, rttMs) =>
+                onDecision(new LayerDecision(
+                    (LayerDecisionReason)reason, previousLevel, level, targetBitrateBps, lossRate,
+                    TimeSpan.FromMilliseconds(rttMs)));
+        }
+
+        var native = (options ?? new LayerControllerOptions()).ToNative();
+        var controller = NativeMethods.lrtc_peer_connection_create_layer_controller(
+            handle, sender.DangerousGetHandle(), ref native, callback, IntPtr.Zero);
+        if (controller == IntPtr.Zero)
+        {
+            throw new InvalidOperationException("The sender has no layers to control.");
+        }
+        return new LayerController(controller, callback);
+    }
+
     public void GetStats(Action<string> onSuccess, Action<string> onFailure)
     {
         if (onSuccess == null) throw new ArgumentNullException(nameof(onSuccess));
@@ -494,62 +736,47 @@ public sealed partial class PeerConnection : SafeHandle
 
     public IReadOnlyList<RtpSender> GetSenders()
     {
-        var count = NativeMethods.lrtc_peer_connection_sender_count(handle);
-        if (count == 0)
-        {
-            return Array.Empty<RtpSender>();
-        }
-
-        var list = new List<RtpSender>((int)count);
-        for (uint i = 0; i < count; i++)
-        {
-            var sender = NativeMethods.lrtc_peer_connection_get_sender(handle, i);
-            if (sender != IntPtr.Zero)
-            {
-                list.Add(new RtpSender(sender));
-            }
-        }
-        return list;
+        return GetSnapshot(NativeMethods.lrtc_peer_connection_get_senders, static ptr => new RtpSender(ptr));
     }
 
     public IReadOnlyList<RtpReceiver> GetReceivers()
     {
-        var count = NativeMethods.lrtc_peer_connection_receiver_count(handle);
-        if (count == 0)
-        {
-            return Array.Empty<RtpReceiver>();
-        }
-
-        var list = new List<RtpReceiver>((int)count);
-        for (uint i = 0; i < count; i++)
-        {
-            var receiver = NativeMethods.lrtc_peer_connection_get_receiver(handle, i);
-            if (receiver != IntPtr.Zero)
-            {
-                list.Add(new RtpReceiver(receiver));
-            }
-        }
-        return list;
+        return GetSnapshot(NativeMethods.lrtc_peer_connection_get_receivers, static ptr => new RtpReceiver(ptr));
     }
 
     public IReadOnlyList<RtpTransceiver> GetTransceivers()
     {
-        var count = NativeMethods.lrtc_peer_connection_transceiver_count(handle);
-        if (count == 0)
-        {
-            return Array.Empty<RtpTransceiver>();
-        }
+        return GetSnapshot(NativeMethods.lrtc_peer_connection_get_transceivers, static ptr => new RtpTransceiver(ptr));
+    }
 
-        var list = new List<RtpTransceiver>((int)count);
-        for (uint i = 0; i < count; i++)
+    // Fetches all handles in one native call. The native side writes nothing when the
+    // array is too small, so a list that grew in between is retried with the new count.
+    private IReadOnlyList<T> GetSnapshot<T>(Func<IntPtr, IntPtr, uint, uint> getter, Func<IntPtr, T> wrap)
+    {
+        var capacity = getter(handle, IntPtr.Zero, 0);
+        while (capacity > 0)
         {
-            var transceiver = NativeMethods.lrtc_peer_connection_get_transceiver(handle, i);
-            if (transceiver != IntPtr.Zero)
+            var handles = new IntPtr[capacity];
+            uint count;
+            unsafe
+            {
+                fixed (IntPtr* ptr = handles)
+                {
+                    count = getter(handle, (IntPtr)ptr, capacity);
+                }
+            }
+            if (count <= capacity)
             {
-                list.Add(new RtpTransceiver(transceiver));
+                var list = new List<T>((int)count);
+                for (var i = 0; i < count; i++)
+                {
+                    list.Add(wrap(handles[i]));
+                }
+                return list;
             }
+            capacity = count;
         }
-        return list;
+        return Array.Empty<T>();
     }
 
     public bool SetCodecPreferences(MediaType mediaType, IReadOnlyList<string> mimeTypes)
@@ -0,0 +1,27 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Counters of a factory's warm peer connection pool.
+/// </summary>
+/// <param name="Hits">Pooled creations served by a warm connection.</param>
+/// <param name="Misses">Pooled creations that found the pool empty and created a connection on demand.</param>
+/// <param name="Created">Connections warmed in the background.</param>
+/// <param name="Discarded">Warm connections closed because the pool was reconfigured.</param>
+/// <param name="Available">Warm connections ready to hand out.</param>
+/// <param name="TargetSize">Configured pool size.</param>
+public readonly record struct PeerConnectionPoolStats(
+    ulong Hits,
+    ulong Misses,
+    ulong Created,
+    ulong Discarded,
+    int Available,
+    int TargetSize)
+{
+    internal static PeerConnectionPoolStats FromNative(in LrtcPeerConnectionPoolStats stats) => new(
+        stats.hits,
+        stats.misses,
+        stats.created,
+        stats.discarded,
+        (int)stats.available,
+        (int)stats.target_size);
+}
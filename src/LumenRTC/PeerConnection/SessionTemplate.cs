@@ -0,0 +1,39 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Caches the SDP text of an offer so later offers with the same m-sections, codecs and extensions are
+/// rendered by substituting their ICE credentials, fingerprints, SSRCs and ids instead of serialized in
+/// full. One template can be shared by many peer connections.
+/// </summary>
+public sealed partial class SessionTemplate : SafeHandle
+{
+    private SessionTemplate() : base(IntPtr.Zero, true) { }
+
+    public static SessionTemplate Create()
+    {
+        var handle = NativeMethods.lrtc_session_template_create();
+        if (handle == IntPtr.Zero)
+        {
+            throw new InvalidOperationException("Failed to create session template.");
+        }
+        var sessionTemplate = new SessionTemplate();
+        sessionTemplate.SetHandle(handle);
+        return sessionTemplate;
+    }
+
+    /// <summary>Drops the cached text; the next offer is serialized in full and cached again.</summary>
+    public void Reset()
+    {
+        NativeMethods.lrtc_session_template_reset(handle);
+    }
+
+    public SessionTemplateStats GetStats()
+    {
+        var result = NativeMethods.lrtc_session_template_get_stats(handle, out var stats);
+        if (result != LrtcResult.Ok)
+        {
+            throw new InvalidOperationException($"Reading session template stats failed: {result}");
+        }
+        return SessionTemplateStats.FromNative(stats);
+    }
+}
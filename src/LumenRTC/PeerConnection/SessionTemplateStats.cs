@@ -0,0 +1,18 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Counters of a <see cref="SessionTemplate"/>.
+/// </summary>
+/// <param name="Hits">Offers rendered from the cached text.</param>
+/// <param name="Misses">Offers serialized in full.</param>
+/// <param name="TemplateSize">Length of the cached text in bytes; 0 when nothing is cached.</param>
+public readonly record struct SessionTemplateStats(
+    ulong Hits,
+    ulong Misses,
+    int TemplateSize)
+{
+    internal static SessionTemplateStats FromNative(in LrtcSessionTemplateStats stats) => new(
+        stats.hits,
+        stats.misses,
+        (int)stats.template_size);
+}
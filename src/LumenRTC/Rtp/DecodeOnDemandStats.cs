@@ -0,0 +1,24 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Decoding of a receiver that may skip it; see <see cref="RtpReceiver.SetDecodeOnDemand"/>.
+/// </summary>
+/// <param name="FramesDecoded">Video frames handed to the decoder.</param>
+/// <param name="FramesSkipped">Video frames received while no renderer was attached, not decoded.</param>
+/// <param name="KeyFrameRequests">Key frames asked for to resume decoding.</param>
+/// <param name="Enabled">Decode on demand is on.</param>
+/// <param name="Skipping">Frames are being skipped, or decoding waits for a key frame.</param>
+public readonly record struct DecodeOnDemandStats(
+    ulong FramesDecoded,
+    ulong FramesSkipped,
+    ulong KeyFrameRequests,
+    bool Enabled,
+    bool Skipping)
+{
+    internal static DecodeOnDemandStats FromNative(in LrtcDecodeOnDemandStats stats) => new(
+        stats.frames_decoded,
+        stats.frames_skipped,
+        stats.key_frame_requests,
+        stats.enabled,
+        stats.skipping);
+}
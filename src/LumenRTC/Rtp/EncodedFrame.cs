@@ -0,0 +1,112 @@
+namespace LumenRTC;
+
+/// <summary>
+/// A received frame between depacketization and decoding, delivered by an <see cref="EncodedFrameSink"/>.
+/// <para>
+/// The payload is the receiver's own buffer. It is handed to the receiver's decoder once this frame and every
+/// retained copy are disposed, so dispose it as soon as it has been forwarded.
+/// </para>
+/// </summary>
+public sealed class EncodedFrame : IDisposable
+{
+    private IntPtr _handle;
+    private LrtcEncodedFrameInfo _info;
+    private bool _hasInfo;
+
+    internal EncodedFrame(IntPtr handle)
+    {
+        _handle = handle;
+    }
+
+    internal IntPtr Handle => ValidHandle();
+
+    private IntPtr ValidHandle()
+    {
+        if (_handle == IntPtr.Zero)
+            throw new ObjectDisposedException(nameof(EncodedFrame));
+        return _handle;
+    }
+
+    private ref readonly LrtcEncodedFrameInfo Info
+    {
+        get
+        {
+            if (!_hasInfo)
+            {
+                if (NativeMethods.lrtc_encoded_frame_get_info(ValidHandle(), out _info) != LrtcResult.Ok)
+                    throw new InvalidOperationException("Failed to read encoded frame info.");
+                _hasInfo = true;
+            }
+            return ref _info;
+        }
+    }
+
+    /// <summary>Payload, valid until the frame is disposed.</summary>
+    public unsafe ReadOnlySpan<byte> Data
+    {
+        get
+        {
+            var h = ValidHandle();
+            return new ReadOnlySpan<byte>(
+                (void*)NativeMethods.lrtc_encoded_frame_data(h),
+                (int)NativeMethods.lrtc_encoded_frame_size(h));
+        }
+    }
+
+    public MediaType MediaType => (MediaType)Info.media_type;
+    public uint RtpTimestamp => Info.rtp_timestamp;
+    public uint Ssrc => Info.ssrc;
+
+    /// <summary>Payload type on the receiving connection.</summary>
+    public int PayloadType => Info.payload_type;
+
+    /// <summary>For example <c>video/VP8</c> or <c>audio/opus</c>.</summary>
+    public string MimeType => NativeString.GetString(ValidHandle(), NativeMethods.lrtc_encoded_frame_get_mime_type);
+
+    /// <summary>Always false for audio.</summary>
+    public bool IsKeyFrame => Info.is_key_frame;
+    public int Width => Info.width;
+    public int Height => Info.height;
+
+    /// <summary>Frame id from the dependency descriptor or generic frame descriptor; -1 when there is neither.</summary>
+    public long FrameId => Info.frame_id;
+    public int SpatialIndex => Info.spatial_index;
+    public int TemporalIndex => Info.temporal_index;
+
+    /// <summary>Ids of the frames this one references.</summary>
+    public unsafe long[] Dependencies
+    {
+        get
+        {
+            var count = Info.dependency_count;
+            if (count == 0)
+                return Array.Empty<long>();
+            var ids = new long[count];
+            fixed (long* ptr = ids)
+            {
+                NativeMethods.lrtc_encoded_frame_get_dependencies(ValidHandle(), (IntPtr)ptr, count);
+            }
+            return ids;
+        }
+    }
+
+    /// <summary>
+    /// Retains a new handle to the same frame that outlives the sink callback. The decoder gets the frame only
+    /// after both are disposed.
+    /// </summary>
+    public EncodedFrame Retain()
+    {
+        var retained = NativeMethods.lrtc_encoded_frame_retain(ValidHandle());
+        if (retained == IntPtr.Zero)
+            throw new InvalidOperationException("Failed to retain encoded frame.");
+        return new EncodedFrame(retained);
+    }
+
+    public void Dispose()
+    {
+        var h = _handle;
+        _handle = IntPtr.Zero;
+        if (h != IntPtr.Zero)
+            NativeMethods.lrtc_encoded_frame_release(h);
+    }
+}
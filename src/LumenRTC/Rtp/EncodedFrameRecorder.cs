@@ -0,0 +1,48 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Records the encoded frames of an <see cref="RtpReceiver"/> to a file without decoding them; see
+/// <see cref="RtpReceiver.SetEncodedFrameRecorder"/>. The container follows the first frame's codec: IVF for VP8,
+/// VP9 and AV1, an Annex B stream for H.264 and H.265, and Ogg for Opus. Video starts at the first key frame.
+/// Formatting and file I/O run on a dedicated native thread. Disposing detaches the recorder from its receiver
+/// and completes the file if <see cref="Stop"/> was not called.
+/// </summary>
+public sealed partial class EncodedFrameRecorder : SafeHandle
+{
+    /// <summary>Creates or truncates <paramref name="path"/>.</summary>
+    public EncodedFrameRecorder(string path, EncodedFrameRecorderOptions? options = null)
+        : base(IntPtr.Zero, true)
+    {
+        if (string.IsNullOrEmpty(path)) throw new ArgumentException("Path is required.", nameof(path));
+        using var pathUtf8 = new Utf8String(path);
+        var native = (options ?? new EncodedFrameRecorderOptions()).ToNative();
+        var handle = NativeMethods.lrtc_encoded_frame_recorder_create(pathUtf8.Pointer, ref native);
+        if (handle == IntPtr.Zero)
+        {
+            throw new InvalidOperationException($"Failed to create recording '{path}'.");
+        }
+        SetHandle(handle);
+    }
+
+    public EncodedFrameRecorderStats Stats
+    {
+        get
+        {
+            var result = NativeMethods.lrtc_encoded_frame_recorder_get_stats(handle, out var stats);
+            if (result != LrtcResult.Ok)
+            {
+                throw new InvalidOperationException($"Getting recorder stats failed: {result}");
+            }
+            return EncodedFrameRecorderStats.FromNative(stats);
+        }
+    }
+
+    /// <summary>
+    /// Writes the queued frames, completes the container and closes the file; later frames are dropped.
+    /// Returns false if a write failed.
+    /// </summary>
+    public bool Stop()
+    {
+        return NativeMethods.lrtc_encoded_frame_recorder_stop(handle) == LrtcResult.Ok;
+    }
+}
@@ -0,0 +1,28 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Memory and durability limits of an <see cref="EncodedFrameRecorder"/>.
+/// </summary>
+public sealed class EncodedFrameRecorderOptions
+{
+    /// <summary>
+    /// Frames waiting for the writer thread beyond this many bytes are dropped; video then skips to the next key frame.
+    /// </summary>
+    public int MaxQueuedBytes { get; set; } = 8 * 1024 * 1024;
+
+    /// <summary>Size of the buffer in front of the file.</summary>
+    public int WriteBufferBytes { get; set; } = 256 * 1024;
+
+    public RecordingSyncPolicy SyncPolicy { get; set; } = RecordingSyncPolicy.OnStop;
+
+    /// <summary>Delay between a write and the sync that follows it under <see cref="RecordingSyncPolicy.Interval"/>.</summary>
+    public TimeSpan SyncInterval { get; set; } = TimeSpan.FromSeconds(1);
+
+    internal LrtcEncodedFrameRecorderOptions ToNative() => new LrtcEncodedFrameRecorderOptions
+    {
+        max_queued_bytes = (uint)Math.Max(MaxQueuedBytes, 0),
+        write_buffer_bytes = (uint)Math.Max(WriteBufferBytes, 0),
+        sync_policy = (int)SyncPolicy,
+        sync_interval_ms = (uint)Math.Clamp(Math.Ceiling(SyncInterval.TotalMilliseconds), 0, uint.MaxValue),
+    };
+}
@@ -0,0 +1,24 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Progress of an <see cref="EncodedFrameRecorder"/>.
+/// </summary>
+/// <param name="FramesWritten">Frames in the file.</param>
+/// <param name="BytesWritten">File size, container included.</param>
+/// <param name="FramesDropped">Frames not recorded: the queue was full, a video delta came before a key frame, or the codec changed.</param>
+/// <param name="QueuedBytes">Bytes of frames waiting for the writer thread.</param>
+/// <param name="WriteFailed">A write or sync failed; nothing is written after it.</param>
+public readonly record struct EncodedFrameRecorderStats(
+    ulong FramesWritten,
+    ulong BytesWritten,
+    ulong FramesDropped,
+    ulong QueuedBytes,
+    bool WriteFailed)
+{
+    internal static EncodedFrameRecorderStats FromNative(in LrtcEncodedFrameRecorderStats stats) => new(
+        stats.frames_written,
+        stats.bytes_written,
+        stats.frames_dropped,
+        stats.queued_bytes,
+        stats.write_failed);
+}
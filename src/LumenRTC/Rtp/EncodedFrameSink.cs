@@ -0,0 +1,29 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Receives the encoded frames of an <see cref="RtpReceiver"/>; see <see cref="RtpReceiver.SetEncodedFrameSink"/>.
+/// The handler runs on a WebRTC thread, one frame at a time, and the frame is disposed when it returns.
+/// Disposing the sink detaches it from every receiver it is set on.
+/// </summary>
+public sealed partial class EncodedFrameSink : SafeHandle
+{
+    // Kept alive for the native sink, which calls it until released.
+    private readonly LrtcEncodedFrameCb _callback;
+
+    public EncodedFrameSink(Action<EncodedFrame> onFrame)
+        : base(IntPtr.Zero, true)
+    {
+        if (onFrame == null) throw new ArgumentNullException(nameof(onFrame));
+        _callback = (_, frame) =>
+        {
+            using var encoded = new EncodedFrame(frame);
+            onFrame(encoded);
+        };
+        var handle = NativeMethods.lrtc_encoded_frame_sink_create(_callback, IntPtr.Zero);
+        if (handle == IntPtr.Zero)
+        {
+            throw new InvalidOperationException("Failed to create encoded frame sink.");
+        }
+        SetHandle(handle);
+    }
+}
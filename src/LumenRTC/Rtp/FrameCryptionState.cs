@@ -0,0 +1,17 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Outcome of the latest frame a <see cref="FrameCryptor"/> handled; reported when it changes.
+/// </summary>
+public enum FrameCryptionState
+{
+    New = 0,
+    Ok = 1,
+    EncryptionFailed = 2,
+    DecryptionFailed = 3,
+    /// <summary>The frame names a key index that was never set.</summary>
+    MissingKey = 4,
+    /// <summary>The sender ratcheted its key and the receiver followed within the ratchet window.</summary>
+    KeyRatcheted = 5,
+    InternalError = 6,
+}
@@ -0,0 +1,11 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Cipher a <see cref="FrameCryptor"/> encrypts frames with.
+/// </summary>
+public enum FrameCryptoAlgorithm
+{
+    AesGcm = 0,
+    /// <summary>Not supported; creating a cryptor with it fails.</summary>
+    AesCbc = 1,
+}
@@ -0,0 +1,64 @@
+namespace LumenRTC;
+
+/// <summary>
+/// End-to-end encrypts the frames of an <see cref="RtpSender"/>, or decrypts those of an <see cref="RtpReceiver"/>,
+/// with AES-GCM keys from a <see cref="KeyProvider"/>; see <see cref="RtpSender.CreateFrameCryptor"/> and
+/// <see cref="RtpReceiver.CreateFrameCryptor"/>. Frames pass unchanged until <see cref="Enabled"/> is set. AV1 frames
+/// cannot be encrypted. Disposing it stops the encryption.
+/// </summary>
+public sealed partial class FrameCryptor : SafeHandle
+{
+    private readonly object _sync = new();
+    // Called until replaced or the handle is released; both wait for a running call.
+    private LrtcFrameCryptionStateCb? _stateCb;
+
+    internal FrameCryptor(IntPtr handle) : base(IntPtr.Zero, true)
+    {
+        SetHandle(handle);
+    }
+
+    public bool Enabled
+    {
+        get => NativeMethods.lrtc_frame_cryptor_get_enabled(handle);
+        set
+        {
+            var result = NativeMethods.lrtc_frame_cryptor_set_enabled(handle, value);
+            if (result != LrtcResult.Ok)
+            {
+                throw new InvalidOperationException($"Setting frame cryptor enabled failed: {result}");
+            }
+        }
+    }
+
+    /// <summary>Key the sender encrypts with; receivers take the index from each frame.</summary>
+    public int KeyIndex
+    {
+        get => NativeMethods.lrtc_frame_cryptor_get_key_index(handle);
+        set
+        {
+            if (NativeMethods.lrtc_frame_cryptor_set_key_index(handle, value) != LrtcResult.Ok)
+            {
+                throw new ArgumentOutOfRangeException(nameof(value));
+            }
+        }
+    }
+
+    /// <summary>
+    /// Calls <paramref name="onStateChanged"/> on a WebRTC thread with the participant whenever the state changes;
+    /// null stops the calls.
+    /// </summary>
+    public void SetStateObserver(Action<string, FrameCryptionState>? onStateChanged)
+    {
+        lock (_sync)
+        {
+            LrtcFrameCryptionStateCb? callback = null;
+            if (onStateChanged != null)
+            {
+                callback = (_, participantId, state) =>
+                    onStateChanged(Utf8String.Read(participantId), (FrameCryptionState)state);
+            }
+            NativeMethods.lrtc_frame_cryptor_set_observer(handle, callback, IntPtr.Zero);
+            _stateCb = callback;
+        }
+    }
+}
@@ -0,0 +1,169 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Keys of the <see cref="FrameCryptor"/>s created with it, per participant or shared. Setting a key derives it with
+/// PBKDF2, which takes tens of milliseconds; frames already in flight keep using the previous keys meanwhile.
+/// </summary>
+public sealed partial class KeyProvider : SafeHandle
+{
+    /// <summary>Bytes <see cref="TryEncrypt"/> adds to a payload.</summary>
+    public const int Overhead = 30;
+
+    public KeyProvider(KeyProviderOptions? options = null)
+        : base(IntPtr.Zero, true)
+    {
+        options ??= new KeyProviderOptions();
+        IntPtr created;
+        unsafe
+        {
+            fixed (byte* salt = options.RatchetSalt)
+            fixed (byte* magic = options.UncryptedMagicBytes)
+            {
+                var native = new LrtcKeyProviderOptions
+                {
+                    shared_key = options.SharedKey,
+                    ratchet_salt = (IntPtr)salt,
+                    ratchet_salt_len = (uint)(options.RatchetSalt?.Length ?? 0),
+                    uncrypted_magic_bytes = (IntPtr)magic,
+                    uncrypted_magic_bytes_len = (uint)(options.UncryptedMagicBytes?.Length ?? 0),
+                    ratchet_window_size = options.RatchetWindowSize,
+                    failure_tolerance = options.FailureTolerance,
+                    key_ring_size = options.KeyRingSize,
+                    discard_frame_when_cryptor_not_ready = options.DiscardFrameWhenCryptorNotReady,
+                };
+                created = NativeMethods.lrtc_key_provider_create(ref native);
+            }
+        }
+        if (created == IntPtr.Zero)
+        {
+            throw new ArgumentException("Invalid key provider options.", nameof(options));
+        }
+        SetHandle(created);
+    }
+
+    /// <summary>Returns false for an index outside the key ring.</summary>
+    public bool SetSharedKey(int keyIndex, ReadOnlySpan<byte> key)
+    {
+        if (key.IsEmpty) throw new ArgumentException("Key is required.", nameof(key));
+        unsafe
+        {
+            fixed (byte* ptr = key)
+            {
+                return NativeMethods.lrtc_key_provider_set_shared_key(
+                    handle, keyIndex, (IntPtr)ptr, (uint)key.Length) == LrtcResult.Ok;
+            }
+        }
+    }
+
+    /// <summary>Returns false for an index outside the key ring.</summary>
+    public bool SetKey(string participantId, int keyIndex, ReadOnlySpan<byte> key)
+    {
+        if (participantId == null) throw new ArgumentNullException(nameof(participantId));
+        if (key.IsEmpty) throw new ArgumentException("Key is required.", nameof(key));
+        using var id = new Utf8String(participantId);
+        unsafe
+        {
+            fixed (byte* ptr = key)
+            {
+                return NativeMethods.lrtc_key_provider_set_key(
+                    handle, id.Pointer, keyIndex, (IntPtr)ptr, (uint)key.Length) == LrtcResult.Ok;
+            }
+        }
+    }
+
+    /// <summary>Replaces the shared key with its next ratchet step. Returns false if there is no such key.</summary>
+    public bool RatchetSharedKey(int keyIndex)
+    {
+        return NativeMethods.lrtc_key_provider_ratchet_shared_key(handle, keyIndex) == LrtcResult.Ok;
+    }
+
+    /// <summary>Replaces the key with its next ratchet step. Returns false if there is no such key.</summary>
+    public bool RatchetKey(string participantId, int keyIndex)
+    {
+        if (participantId == null) throw new ArgumentNullException(nameof(participantId));
+        using var id = new Utf8String(participantId);
+        return NativeMethods.lrtc_key_provider_ratchet_key(handle, id.Pointer, keyIndex) == LrtcResult.Ok;
+    }
+
+    /// <summary>The key as last set or ratcheted; empty if there is none.</summary>
+    public byte[] ExportSharedKey(int keyIndex)
+    {
+        return ExportBytes((buffer, length) =>
+            NativeMethods.lrtc_key_provider_export_shared_key(handle, keyIndex, buffer, length));
+    }
+
+    /// <summary>The key as last set or ratcheted, or the shared one; empty if there is none.</summary>
+    public byte[] ExportKey(string participantId, int keyIndex)
+    {
+        if (participantId == null) throw new ArgumentNullException(nameof(participantId));
+        using var id = new Utf8String(participantId);
+        return ExportBytes((buffer, length) =>
+            NativeMethods.lrtc_key_provider_export_key(handle, id.Pointer, keyIndex, buffer, length));
+    }
+
+    /// <summary>Received frames ending with <paramref name="trailer"/> are server-injected and passed on as they are.</summary>
+    public void SetSifTrailer(ReadOnlySpan<byte> trailer)
+    {
+        unsafe
+        {
+            fixed (byte* ptr = trailer)
+            {
+                NativeMethods.lrtc_key_provider_set_sif_trailer(handle, (IntPtr)ptr, (uint)trailer.Length);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Encrypts the first <paramref name="length"/> bytes of <paramref name="buffer"/> in place the way frames are,
+    /// for payloads sent outside RTP such as data channel messages. <paramref name="buffer"/> needs
+    /// <see cref="Overhead"/> bytes to spare.
+    /// </summary>
+    public bool TryEncrypt(string participantId, int keyIndex, Span<byte> buffer, int length, out int encryptedLength)
+    {
+        if (participantId == null) throw new ArgumentNullException(nameof(participantId));
+        if ((uint)length > (uint)buffer.Length) throw new ArgumentOutOfRangeException(nameof(length));
+        using var id = new Utf8String(participantId);
+        unsafe
+        {
+            fixed (byte* ptr = buffer)
+            {
+                encryptedLength = NativeMethods.lrtc_key_provider_encrypt(
+                    handle, id.Pointer, keyIndex, (IntPtr)ptr, (uint)length, (uint)buffer.Length);
+            }
+        }
+        return encryptedLength >= 0;
+    }
+
+    /// <summary>Decrypts in place what <see cref="TryEncrypt"/> made.</summary>
+    public bool TryDecrypt(string participantId, Span<byte> buffer, out int length)
+    {
+        if (participantId == null) throw new ArgumentNullException(nameof(participantId));
+        using var id = new Utf8String(participantId);
+        unsafe
+        {
+            fixed (byte* ptr = buffer)
+            {
+                length = NativeMethods.lrtc_key_provider_decrypt(handle, id.Pointer, (IntPtr)ptr, (uint)buffer.Length);
+            }
+        }
+        return length >= 0;
+    }
+
+    private static byte[] ExportBytes(Func<IntPtr, uint, int> export)
+    {
+        var length = export(IntPtr.Zero, 0);
+        if (length <= 0)
+        {
+            return Array.Empty<byte>();
+        }
+        var key = new byte[length];
+        unsafe
+        {
+            fixed (byte* ptr = key)
+            {
+                // A ratchet in between may have changed the key, never its length.
+                return export((IntPtr)ptr, (uint)key.Length) == length ? key : Array.Empty<byte>();
+            }
+        }
+    }
+}
@@ -0,0 +1,31 @@
+namespace LumenRTC;
+
+/// <summary>
+/// How a <see cref="KeyProvider"/> finds and ratchets keys.
+/// </summary>
+public sealed class KeyProviderOptions
+{
+    /// <summary>Participants without keys of their own use the shared keys.</summary>
+    public bool SharedKey { get; set; }
+
+    /// <summary>Salt of the key derivation, for ratcheting as well as for the frame keys.</summary>
+    public byte[]? RatchetSalt { get; set; }
+
+    /// <summary>Frames ending with these bytes are passed on unencrypted, with the bytes removed.</summary>
+    public byte[]? UncryptedMagicBytes { get; set; }
+
+    /// <summary>How many ratchet steps a receiver tries when a frame does not decrypt; 0 disables it.</summary>
+    public int RatchetWindowSize { get; set; }
+
+    /// <summary>
+    /// Frames in a row a receiver may fail to decrypt before it drops frames untried until a key changes;
+    /// -1 for no limit.
+    /// </summary>
+    public int FailureTolerance { get; set; } = -1;
+
+    /// <summary>Key indexes run from 0 to this minus one, at most 255.</summary>
+    public int KeyRingSize { get; set; } = 16;
+
+    /// <summary>Drops received frames while their key is missing instead of passing them on.</summary>
+    public bool DiscardFrameWhenCryptorNotReady { get; set; }
+}
@@ -0,0 +1,24 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Switches the simulcast layers, or SVC spatial layers, of a video sender natively as its connection's
+/// bandwidth estimate, loss, RTT and CPU state change; see <see cref="PeerConnection.CreateLayerController"/>.
+/// Disposing it stops the decisions and leaves the layers as they are.
+/// </summary>
+public sealed partial class LayerController : SafeHandle
+{
+    // Called until the handle is released; the release waits for a running call.
+    private readonly LrtcLayerDecisionCb? _decisionCb;
+
+    internal LayerController(IntPtr handle, LrtcLayerDecisionCb? decisionCb) : base(IntPtr.Zero, true)
+    {
+        _decisionCb = decisionCb;
+        SetHandle(handle);
+    }
+
+    /// <summary>Active simulcast layers, or spatial layers of the SVC encoding.</summary>
+    public int Level => NativeMethods.lrtc_layer_controller_get_level(handle);
+
+    /// <summary>Highest level, from the encodings the controller was created with.</summary>
+    public int MaxLevel => NativeMethods.lrtc_layer_controller_get_max_level(handle);
+}
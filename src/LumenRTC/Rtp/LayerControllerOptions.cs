@@ -0,0 +1,46 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Tuning of a <see cref="LayerController"/>. The defaults suit most senders.
+/// </summary>
+public sealed class LayerControllerOptions
+{
+    /// <summary>Period of the decisions.</summary>
+    public TimeSpan Interval { get; set; } = TimeSpan.FromMilliseconds(250);
+
+    /// <summary>Bandwidth estimate over the cost of the next layer needed to add it.</summary>
+    public double UpHeadroom { get; set; } = 1.25;
+
+    /// <summary>Bandwidth estimate over the cost of the active layers below which one is dropped.</summary>
+    public double DownHeadroom { get; set; } = 1.0;
+
+    /// <summary>How long a layer must fit before it is added.</summary>
+    public TimeSpan UpHold { get; set; } = TimeSpan.FromSeconds(3);
+
+    /// <summary>How long bandwidth, loss or RTT must be bad before a layer is dropped.</summary>
+    public TimeSpan DownHold { get; set; } = TimeSpan.FromMilliseconds(500);
+
+    /// <summary>Mean loss rate over the last two seconds that drops a layer.</summary>
+    public double MaxLossRate { get; set; } = 0.1;
+
+    /// <summary>RTT rise over the lowest RTT of the last ten seconds that drops a layer.</summary>
+    public TimeSpan MaxRttIncrease { get; set; } = TimeSpan.FromMilliseconds(150);
+
+    /// <summary>Keeps layers up even when the encoder reports being CPU limited.</summary>
+    public bool IgnoreCpu { get; set; }
+
+    internal LrtcLayerControllerOptions ToNative() => new LrtcLayerControllerOptions
+    {
+        interval_ms = ToMs(Interval),
+        up_headroom = UpHeadroom,
+        down_headroom = DownHeadroom,
+        up_hold_ms = ToMs(UpHold),
+        down_hold_ms = ToMs(DownHold),
+        max_loss_rate = MaxLossRate,
+        max_rtt_increase_ms = ToMs(MaxRttIncrease),
+        ignore_cpu = IgnoreCpu,
+    };
+
+    private static uint ToMs(TimeSpan value) =>
+        (uint)Math.Clamp(Math.Ceiling(value.TotalMilliseconds), 0, uint.MaxValue);
+}
@@ -0,0 +1,18 @@
+namespace LumenRTC;
+
+/// <summary>
+/// A layer change applied by a <see cref="LayerController"/>.
+/// </summary>
+/// <param name="Reason">What triggered the change.</param>
+/// <param name="PreviousLevel">Active simulcast layers, or SVC spatial layers, before the change.</param>
+/// <param name="Level">Active layers after the change.</param>
+/// <param name="TargetBitrateBps">Bandwidth estimate the decision was made on.</param>
+/// <param name="LossRate">Mean loss rate over the last two seconds.</param>
+/// <param name="RoundTripTime">Latest RTT estimate.</param>
+public readonly record struct LayerDecision(
+    LayerDecisionReason Reason,
+    int PreviousLevel,
+    int Level,
+    int TargetBitrateBps,
+    double LossRate,
+    TimeSpan RoundTripTime);
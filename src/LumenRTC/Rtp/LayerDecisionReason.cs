@@ -0,0 +1,15 @@
+namespace LumenRTC;
+
+/// <summary>
+/// Why a <see cref="LayerController"/> changed the active layers.
+/// </summary>
+public enum LayerDecisionReason
+{
+    /// <summary>The bandwidth estimate no longer covers the layers, or covers one more.</summary>
+    Bandwidth = 0,
+    Loss = 1,
+    /// <summary>The RTT rose over its recent minimum, a sign of queuing.</summary>
+    Rtt = 2,
+    /// <summary>The encoder reported being CPU limited.</summary>
+    Cpu = 3,
+}
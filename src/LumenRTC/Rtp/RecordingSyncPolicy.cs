@@ -0,0 +1,14 @@
+namespace LumenRTC;
+
+/// <summary>
+/// When an <see cref="EncodedFrameRecorder"/> forces its file to disk.
+/// </summary>
+public enum RecordingSyncPolicy
+{
+    /// <summary>Write-back is left to the OS; stopping only flushes.</summary>
+    None = 0,
+    /// <summary>Once, when the recording is stopped.</summary>
+    OnStop = 1,
+    /// <summary><see cref="EncodedFrameRecorderOptions.SyncInterval"/> after data was written, and when stopped.</summary>
+    Interval = 2,
+}
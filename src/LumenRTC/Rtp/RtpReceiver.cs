@@ -5,6 +5,10 @@ namespace LumenRTC;
 /// </summary>
 public sealed partial class RtpReceiver : SafeHandle
 {
+    // The attached encoded frame sink or recorder. Referenced so that it is
+    // not finalized, which would detach it, while the receiver feeds it.
+    private SafeHandle? _encodedFrameConsumer;
+
     internal RtpReceiver(IntPtr handle) : base(IntPtr.Zero, true)
     {
         SetHandle(handle);
@@ -137,6 +141,88 @@ public sealed partial class RtpReceiver : SafeHandle
         return TrySetJitterBufferMinimumDelay(delay.TotalSeconds, out error);
     }
 
+    /// <summary>
+    /// Delivers the receiver's frames to <paramref name="sink"/> before decoding; null detaches the current sink.
+    /// Each frame is decoded once the sink, and any sender it was forwarded to, has released it.
+    /// </summary>
+    public void SetEncodedFrameSink(EncodedFrameSink? sink)
+    {
+        var result = NativeMethods.lrtc_rtp_receiver_set_encoded_frame_sink(
+            handle, sink?.DangerousGetHandle() ?? IntPtr.Zero);
+        if (result != LrtcResult.Ok)
+        {
+            throw new InvalidOperationException($"Setting encoded frame sink failed: {result}");
+        }
+        _encodedFrameConsumer = sink;
+    }
+
+    /// <summary>
+    /// Records the receiver's frames with <paramref name="recorder"/> instead of delivering them to an encoded frame
+    /// sink; null detaches it. A receiver feeds one sink or recorder at a time.
+    /// </summary>
+    public void SetEncodedFrameRecorder(EncodedFrameRecorder? recorder)
+    {
+        var result = NativeMethods.lrtc_rtp_receiver_set_encoded_frame_recorder(
+            handle, recorder?.DangerousGetHandle() ?? IntPtr.Zero);
+        if (result != LrtcResult.Ok)
+        {
+            throw new InvalidOperationException($"Setting encoded frame recorder failed: {result}");
+        }
+        _encodedFrameConsumer = recorder;
+    }
+
+    /// <summary>
+    /// Decrypts the frames of <paramref name="participantId"/> before they are decoded, recorded or passed to an
+    /// encoded frame sink, with keys from <paramref name="keyProvider"/>. Frames pass unchanged until
+    /// <see cref="FrameCryptor.Enabled"/> is set; a later cryptor for this receiver replaces it.
+    /// </summary>
+    /// <exception cref="InvalidOperationException">The algorithm is not supported.</exception>
+    public FrameCryptor CreateFrameCryptor(
+        string participantId,
+        KeyProvider keyProvider,
+        FrameCryptoAlgorithm algorithm = FrameCryptoAlgorithm.AesGcm)
+    {
+        if (participantId == null) throw new ArgumentNullException(nameof(participantId));
+        if (keyProvider == null) throw new ArgumentNullException(nameof(keyProvider));
+        using var id = new Utf8String(participantId);
+        var cryptor = NativeMethods.lrtc_frame_cryptor_create_for_receiver(
+            handle, id.Pointer, (int)algorithm, keyProvider.DangerousGetHandle());
+        if (cryptor == IntPtr.Zero)
+        {
+            throw new InvalidOperationException($"Frame encryption with {algorithm} is not supported.");
+        }
+        return new FrameCryptor(cryptor);
+    }
+
+    /// <summary>Asks the remote sender for a key frame. Returns false for audio receivers.</summary>
+    public bool RequestKeyFrame()
+    {
+        return NativeMethods.lrtc_rtp_receiver_request_key_frame(handle) == LrtcResult.Ok;
+    }
+
+    /// <summary>
+    /// While enabled, video frames received while no <see cref="VideoSink"/> is attached to the receiver's track are
+    /// not decoded; attaching one requests a key frame and decoding resumes with it. Encoded frame sinks and recorders
+    /// still see every frame. Returns false for audio receivers.
+    /// </summary>
+    public bool SetDecodeOnDemand(bool enabled)
+    {
+        return NativeMethods.lrtc_rtp_receiver_set_decode_on_demand(handle, enabled) == LrtcResult.Ok;
+    }
+
+    public DecodeOnDemandStats DecodeStats
+    {
+        get
+        {
+            var result = NativeMethods.lrtc_rtp_receiver_get_decode_stats(handle, out var stats);
+            if (result != LrtcResult.Ok)
+            {
+                throw new InvalidOperationException($"Getting decode stats failed: {result}");
+            }
+            return DecodeOnDemandStats.FromNative(stats);
+        }
+    }
+
     public IReadOnlyList<RtpEncodingInfo> GetEncodings()
     {
         var count = NativeMethods.lrtc_rtp_receiver_encoding_count(handle);
@@ -298,6 +298,49 @@ public sealed partial class RtpSender : SafeHandle
         }
     }
 
+    /// <summary>
+    /// Applies settings to the first <c>settings.Count</c> encodings in one parameters transaction, so the encoder
+    /// is reconfigured at most once. A null entry leaves its encoding unchanged, and nothing is applied when no
+    /// value differs from the current parameters. The per-entry degradation preference is ignored in favor of
+    /// <paramref name="degradationPreference"/>.
+    /// </summary>
+    public unsafe void SetEncodings(IReadOnlyList<RtpEncodingSettings?> settings, DegradationPreference? degradationPreference = null)
+    {
+        if (settings == null) throw new ArgumentNullException(nameof(settings));
+        var natives = new LrtcRtpEncodingSettings[settings.Count];
+        var strings = new List<Utf8String>(settings.Count * 2);
+        try
+        {
+            for (var i = 0; i < natives.Length; i++)
+            {
+                natives[i] = (settings[i] ?? new RtpEncodingSettings()).ToNative(out var rid, out var scalabilityMode);
+                if (rid != null) strings.Add(rid);
+                if (scalabilityMode != null) strings.Add(scalabilityMode);
+            }
+
+            LrtcResult result;
+            fixed (LrtcRtpEncodingSettings* ptr = natives)
+            {
+                result = NativeMethods.lrtc_rtp_sender_set_encodings(
+                    handle,
+                    (IntPtr)ptr,
+                    (uint)natives.Length,
+                    degradationPreference.HasValue ? (int)degradationPreference.Value : -1);
+            }
+            if (result != LrtcResult.Ok)
+            {
+                throw new InvalidOperationException($"Setting sender encodings failed: {result}");
+            }
+        }
+        finally
+        {
+            foreach (var str in strings)
+            {
+                str.Dispose();
+            }
+        }
+    }
+
     public IReadOnlyList<RtpEncodingInfo> GetEncodings()
     {
         var count = NativeMethods.lrtc_rtp_sender_encoding_count(handle);
@@ -382,6 +425,73 @@ public sealed partial class RtpSender : SafeHandle
         }
     }
 
+    /// <summary>
+    /// Switches the sender to frames passed to <see cref="SendEncodedFrame"/>, dropping its own encoder's output
+    /// while enabled. Payload types are taken from the codecs negotiated at the time of the call.
+    /// </summary>
+    /// <exception cref="InvalidOperationException">Enabling before a codec has been negotiated.</exception>
+    public void SetEncodedFrameInput(bool enabled)
+    {
+        var result = NativeMethods.lrtc_rtp_sender_set_encoded_frame_input(handle, enabled);
+        if (result != LrtcResult.Ok)
+        {
+            throw new InvalidOperationException($"Setting encoded frame input failed: {result}");
+        }
+    }
+
+    /// <summary>
+    /// Sends a frame taken from a receiver without decoding or copying it; a simulcast sender sends it on its
+    /// first stream. Returns false when encoded frame input is off, the frame's codec was not negotiated on
+    /// this sender, or the sender is not sending yet. Safe to call from an <see cref="EncodedFrameSink"/>.
+    /// </summary>
+    public bool SendEncodedFrame(EncodedFrame frame)
+    {
+        if (frame == null) throw new ArgumentNullException(nameof(frame));
+        return NativeMethods.lrtc_rtp_sender_send_encoded_frame(handle, frame.Handle) == LrtcResult.Ok;
+    }
+
+    /// <summary>
+    /// Sends one encoded audio frame, such as an Opus packet read from a file, through an audio sender with
+    /// encoded frame input enabled. <paramref name="rtpTimestamp"/> advances in the codec's clock rate. The
+    /// sender needs a track to start sending; its own audio is dropped.
+    /// </summary>
+    public bool SendEncodedAudio(string mimeType, ReadOnlySpan<byte> data, uint rtpTimestamp)
+    {
+        if (mimeType == null) throw new ArgumentNullException(nameof(mimeType));
+        using var mimeUtf8 = new Utf8String(mimeType);
+        unsafe
+        {
+            fixed (byte* ptr = data)
+            {
+                return NativeMethods.lrtc_rtp_sender_send_encoded_audio(
+                    handle, mimeUtf8.Pointer, (IntPtr)ptr, (uint)data.Length, rtpTimestamp) == LrtcResult.Ok;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Encrypts the frames this sender sends as <paramref name="participantId"/>, whether encoded here or passed to
+    /// <see cref="SendEncodedFrame"/>, with keys from <paramref name="keyProvider"/>. Frames pass unchanged until
+    /// <see cref="FrameCryptor.Enabled"/> is set; a later cryptor for this sender replaces it.
+    /// </summary>
+    /// <exception cref="InvalidOperationException">The algorithm is not supported.</exception>
+    public FrameCryptor CreateFrameCryptor(
+        string participantId,
+        KeyProvider keyProvider,
+        FrameCryptoAlgorithm algorithm = FrameCryptoAlgorithm.AesGcm)
+    {
+        if (participantId == null) throw new ArgumentNullException(nameof(participantId));
+        if (keyProvider == null) throw new ArgumentNullException(nameof(keyProvider));
+        using var id = new Utf8String(participantId);
+        var cryptor = NativeMethods.lrtc_frame_cryptor_create_for_sender(
+            handle, id.Pointer, (int)algorithm, keyProvider.DangerousGetHandle());
+        if (cryptor == IntPtr.Zero)
+        {
+            throw new InvalidOperationException($"Frame encryption with {algorithm} is not supported.");
+        }
+        return new FrameCryptor(cryptor);
+    }
+
     private IReadOnlyList<string> GetStreamIds()
     {
         var count = NativeMethods.lrtc_rtp_sender_stream_id_count(handle);
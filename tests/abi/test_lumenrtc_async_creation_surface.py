@@ -0,0 +1,130 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+HEADER_PATH = REPO_ROOT / "native" / "include" / "lumenrtc.h"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_factory_create_audio_source_async": [
+        "lrtc_factory_t*",
+        "const char*",
+        "lrtc_audio_source_type",
+        "const lrtc_audio_options_t*",
+        "lrtc_audio_source_created_cb",
+        "void*",
+    ],
+    "lrtc_factory_create_video_source_async": [
+        "lrtc_factory_t*",
+        "lrtc_video_capturer_t*",
+        "const char*",
+        "lrtc_media_constraints_t*",
+        "lrtc_video_source_created_cb",
+        "void*",
+    ],
+    "lrtc_factory_create_desktop_source_async": [
+        "lrtc_factory_t*",
+        "lrtc_desktop_capturer_t*",
+        "const char*",
+        "lrtc_media_constraints_t*",
+        "lrtc_video_source_created_cb",
+        "void*",
+    ],
+    "lrtc_factory_create_audio_track_async": [
+        "lrtc_factory_t*",
+        "lrtc_audio_source_t*",
+        "const char*",
+        "lrtc_audio_track_created_cb",
+        "void*",
+    ],
+    "lrtc_factory_create_video_track_async": [
+        "lrtc_factory_t*",
+        "lrtc_video_source_t*",
+        "const char*",
+        "lrtc_video_track_created_cb",
+        "void*",
+    ],
+    "lrtc_video_device_create_capturer_async": [
+        "lrtc_video_device_t*",
+        "const char*",
+        "uint32_t",
+        "size_t",
+        "size_t",
+        "size_t",
+        "lrtc_video_capturer_created_cb",
+        "void*",
+    ],
+    "lrtc_video_capturer_start_async": [
+        "lrtc_video_capturer_t*",
+        "lrtc_video_capture_started_cb",
+        "void*",
+    ],
+    "lrtc_video_capturer_stop_async": ["lrtc_video_capturer_t*", "lrtc_void_cb", "void*"],
+    "lrtc_desktop_capturer_start_async": [
+        "lrtc_desktop_capturer_t*",
+        "uint32_t",
+        "lrtc_desktop_capture_state_cb",
+        "void*",
+    ],
+    "lrtc_desktop_capturer_start_region_async": [
+        "lrtc_desktop_capturer_t*",
+        "uint32_t",
+        "uint32_t",
+        "uint32_t",
+        "uint32_t",
+        "uint32_t",
+        "lrtc_desktop_capture_state_cb",
+        "void*",
+    ],
+    "lrtc_desktop_capturer_stop_async": ["lrtc_desktop_capturer_t*", "lrtc_void_cb", "void*"],
+}
+
+EXPECTED_CALLBACKS = {
+    "lrtc_audio_source_created_cb": "lrtc_audio_source_t* source",
+    "lrtc_audio_track_created_cb": "lrtc_audio_track_t* track",
+    "lrtc_video_source_created_cb": "lrtc_video_source_t* source",
+    "lrtc_video_track_created_cb": "lrtc_video_track_t* track",
+    "lrtc_video_capturer_created_cb": "lrtc_video_capturer_t* capturer",
+    "lrtc_video_capture_started_cb": "int started",
+    "lrtc_desktop_capture_state_cb": "int state",
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class AsyncCreationSurfaceTests(unittest.TestCase):
+    def test_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"Async creation functions missing from IDL: {missing}")
+        for name, params in EXPECTED_FUNCTIONS.items():
+            self.assertEqual(functions[name]["c_return_type"], "lrtc_result_t", name)
+            self.assertEqual([p["c_type"] for p in functions[name]["parameters"]], params, name)
+
+    def test_callback_typedefs(self) -> None:
+        header = HEADER_PATH.read_text(encoding="utf-8")
+        for name, param in EXPECTED_CALLBACKS.items():
+            self.assertIn(
+                f"typedef void (LUMENRTC_CALL *{name})(void* user_data, {param});",
+                header,
+                name,
+            )
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"Async creation functions missing from required list: {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,53 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+HEADER_PATH = REPO_ROOT / "native" / "include" / "lumenrtc.h"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_peer_connection_set_bandwidth_observer": (
+        "void",
+        ["lrtc_peer_connection_t*", "uint32_t", "lrtc_bandwidth_estimate_cb", "void*"],
+    ),
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class BandwidthEstimateSurfaceTests(unittest.TestCase):
+    def test_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"Bandwidth estimate functions missing from IDL: {missing}")
+        for name, (return_type, params) in EXPECTED_FUNCTIONS.items():
+            self.assertEqual(functions[name]["c_return_type"], return_type, name)
+            self.assertEqual([p["c_type"] for p in functions[name]["parameters"]], params, name)
+
+    def test_estimate_callback_typedef(self) -> None:
+        header = HEADER_PATH.read_text(encoding="utf-8")
+        self.assertIn(
+            "typedef void (LUMENRTC_CALL *lrtc_bandwidth_estimate_cb)(void* user_data, int target_bitrate_bps, "
+            "int stable_target_bitrate_bps, int encoder_target_bitrate_bps, int encoder_count, double rtt_ms, "
+            "double loss_rate);",
+            header,
+        )
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"Bandwidth estimate functions missing from required_native_functions: {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,59 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+HEADER_PATH = REPO_ROOT / "native" / "include" / "lumenrtc.h"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_factory_configure_certificate_cache": (
+        "lrtc_result_t",
+        ["lrtc_factory_t*", "const lrtc_certificate_cache_options_t*"],
+    ),
+    "lrtc_factory_export_certificate_pem": (
+        "int32_t",
+        ["lrtc_factory_t*", "char*", "uint32_t"],
+    ),
+    "lrtc_factory_import_certificate_pem": (
+        "lrtc_result_t",
+        ["lrtc_factory_t*", "const char*"],
+    ),
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class CertificateCacheSurfaceTests(unittest.TestCase):
+    def test_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"Certificate cache functions missing from IDL: {missing}")
+        for name, (return_type, params) in EXPECTED_FUNCTIONS.items():
+            self.assertEqual(functions[name]["c_return_type"], return_type, name)
+            self.assertEqual([p["c_type"] for p in functions[name]["parameters"]], params, name)
+
+    def test_options_struct_layout(self) -> None:
+        header = HEADER_PATH.read_text(encoding="utf-8")
+        options = header.split("typedef struct lrtc_certificate_cache_options_t {", 1)[1].split("}", 1)[0]
+        self.assertIn("bool enabled;", options)
+        self.assertIn("int size;", options)
+        self.assertIn("int64_t rotation_interval_ms;", options)
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"Certificate cache functions missing from required_native_functions: {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,78 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+SRC_ROOT = REPO_ROOT / "src" / "LumenRTC"
+VIDEO_SOURCE_PATH = SRC_ROOT / "Media" / "VideoSource.cs"
+FACTORY_PATH = SRC_ROOT / "Devices" / "PeerConnectionFactory.cs"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_factory_create_custom_video_source",
+    "lrtc_video_source_push_i420",
+    "lrtc_video_source_push_nv12",
+    "lrtc_video_source_push_argb",
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class CustomVideoSourceSurfaceTests(unittest.TestCase):
+    def test_push_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(EXPECTED_FUNCTIONS - set(functions))
+        self.assertFalse(missing, f"Custom video source functions missing from IDL: {missing}")
+
+        for name in EXPECTED_FUNCTIONS - {"lrtc_factory_create_custom_video_source"}:
+            params = {p["name"]: p["c_type"] for p in functions[name]["parameters"]}
+            self.assertEqual(params.get("timestamp_us"), "int64_t", name)
+            self.assertEqual(params.get("release"), "lrtc_void_cb", name)
+            self.assertEqual(params.get("user_data"), "void*", name)
+
+    def test_dropped_count_is_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        function = functions.get("lrtc_video_source_dropped_count")
+        self.assertIsNotNone(function, "lrtc_video_source_dropped_count missing from IDL")
+        self.assertEqual(function["c_return_type"], "uint64_t")
+
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        self.assertIn("lrtc_video_source_dropped_count", required)
+
+    def test_push_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(EXPECTED_FUNCTIONS - required)
+        self.assertFalse(missing, f"Custom video source functions missing from required_native_functions: {missing}")
+
+    def test_managed_surface_exposes_push_api(self) -> None:
+        factory = FACTORY_PATH.read_text(encoding="utf-8")
+        self.assertIn("public VideoSource CreateCustomVideoSource(string label, bool isScreencast = false)", factory)
+
+        source = VIDEO_SOURCE_PATH.read_text(encoding="utf-8")
+        expected_snippets = [
+            "public bool PushI420(",
+            "public bool PushNv12(",
+            "public bool PushArgb(",
+            "long timestampUs, Action release)",
+            "public ulong DroppedFrames",
+        ]
+        missing = [item for item in expected_snippets if item not in source]
+        self.assertFalse(missing, f"VideoSource push API is incomplete: missing {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,63 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_rtp_receiver_set_decode_on_demand": (
+        "lrtc_result_t",
+        ["lrtc_rtp_receiver_t*", "bool"],
+    ),
+    "lrtc_rtp_receiver_get_decode_stats": (
+        "lrtc_result_t",
+        ["lrtc_rtp_receiver_t*", "lrtc_decode_on_demand_stats_t*"],
+    ),
+}
+
+EXPECTED_STATS_FIELDS = [
+    "frames_decoded",
+    "frames_skipped",
+    "key_frame_requests",
+    "enabled",
+    "skipping",
+]
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class DecodeOnDemandSurfaceTests(unittest.TestCase):
+    def test_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"Decode on demand functions missing from IDL: {missing}")
+        for name, (return_type, params) in EXPECTED_FUNCTIONS.items():
+            self.assertEqual(functions[name]["c_return_type"], return_type, name)
+            self.assertEqual([p["c_type"] for p in functions[name]["parameters"]], params, name)
+
+    def test_stats_struct_keeps_field_order(self) -> None:
+        structs = load_json(IDL_PATH)["header_types"]["structs"]
+        self.assertIn("lrtc_decode_on_demand_stats_t", structs)
+        self.assertEqual(
+            [f["name"] for f in structs["lrtc_decode_on_demand_stats_t"]["fields"]],
+            EXPECTED_STATS_FIELDS,
+        )
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"Decode on demand functions missing from required_native_functions: {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,96 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_encoded_frame_recorder_create": (
+        "lrtc_encoded_frame_recorder_t*",
+        ["const char*", "const lrtc_encoded_frame_recorder_options_t*"],
+    ),
+    "lrtc_encoded_frame_recorder_get_stats": (
+        "lrtc_result_t",
+        ["lrtc_encoded_frame_recorder_t*", "lrtc_encoded_frame_recorder_stats_t*"],
+    ),
+    "lrtc_encoded_frame_recorder_stop": (
+        "lrtc_result_t",
+        ["lrtc_encoded_frame_recorder_t*"],
+    ),
+    "lrtc_encoded_frame_recorder_release": (
+        "void",
+        ["lrtc_encoded_frame_recorder_t*"],
+    ),
+    "lrtc_rtp_receiver_set_encoded_frame_recorder": (
+        "lrtc_result_t",
+        ["lrtc_rtp_receiver_t*", "lrtc_encoded_frame_recorder_t*"],
+    ),
+}
+
+EXPECTED_STRUCTS = {
+    "lrtc_encoded_frame_recorder_options_t": [
+        "max_queued_bytes",
+        "write_buffer_bytes",
+        "sync_policy",
+        "sync_interval_ms",
+    ],
+    "lrtc_encoded_frame_recorder_stats_t": [
+        "frames_written",
+        "bytes_written",
+        "frames_dropped",
+        "queued_bytes",
+        "write_failed",
+    ],
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class EncodedFrameRecorderSurfaceTests(unittest.TestCase):
+    def test_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"Recorder functions missing from IDL: {missing}")
+        for name, (return_type, params) in EXPECTED_FUNCTIONS.items():
+            self.assertEqual(functions[name]["c_return_type"], return_type, name)
+            self.assertEqual([p["c_type"] for p in functions[name]["parameters"]], params, name)
+
+    def test_structs_keep_field_order(self) -> None:
+        idl = load_json(IDL_PATH)
+        structs = idl["header_types"]["structs"]
+        for name, fields in EXPECTED_STRUCTS.items():
+            self.assertIn(name, structs)
+            self.assertEqual([f["name"] for f in structs[name]["fields"]], fields, name)
+
+    def test_sync_policy_values_are_stable(self) -> None:
+        idl = load_json(IDL_PATH)
+        enums = idl["header_types"]["enums"]
+        self.assertIn("lrtc_recording_sync_policy", enums)
+        values = {m["name"]: m["value"] for m in enums["lrtc_recording_sync_policy"]["members"]}
+        self.assertEqual(
+            values,
+            {
+                "LRTC_RECORDING_SYNC_NONE": 0,
+                "LRTC_RECORDING_SYNC_ON_STOP": 1,
+                "LRTC_RECORDING_SYNC_INTERVAL": 2,
+            },
+        )
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"Recorder functions missing from required_native_functions: {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,111 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+INTEROP_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.interop.json"
+HEADER_PATH = REPO_ROOT / "native" / "include" / "lumenrtc.h"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_encoded_frame_data": ("const uint8_t*", ["lrtc_encoded_frame_t*"]),
+    "lrtc_encoded_frame_size": ("uint32_t", ["lrtc_encoded_frame_t*"]),
+    "lrtc_encoded_frame_get_info": (
+        "lrtc_result_t",
+        ["lrtc_encoded_frame_t*", "lrtc_encoded_frame_info_t*"],
+    ),
+    "lrtc_encoded_frame_get_dependencies": (
+        "uint32_t",
+        ["lrtc_encoded_frame_t*", "int64_t*", "uint32_t"],
+    ),
+    "lrtc_encoded_frame_get_mime_type": (
+        "int32_t",
+        ["lrtc_encoded_frame_t*", "char*", "uint32_t"],
+    ),
+    "lrtc_encoded_frame_retain": ("lrtc_encoded_frame_t*", ["lrtc_encoded_frame_t*"]),
+    "lrtc_encoded_frame_release": ("void", ["lrtc_encoded_frame_t*"]),
+    "lrtc_encoded_frame_sink_create": (
+        "lrtc_encoded_frame_sink_t*",
+        ["lrtc_encoded_frame_cb", "void*"],
+    ),
+    "lrtc_encoded_frame_sink_release": ("void", ["lrtc_encoded_frame_sink_t*"]),
+    "lrtc_rtp_receiver_set_encoded_frame_sink": (
+        "lrtc_result_t",
+        ["lrtc_rtp_receiver_t*", "lrtc_encoded_frame_sink_t*"],
+    ),
+    "lrtc_rtp_receiver_request_key_frame": ("lrtc_result_t", ["lrtc_rtp_receiver_t*"]),
+    "lrtc_rtp_sender_set_encoded_frame_input": (
+        "lrtc_result_t",
+        ["lrtc_rtp_sender_t*", "bool"],
+    ),
+    "lrtc_rtp_sender_send_encoded_frame": (
+        "lrtc_result_t",
+        ["lrtc_rtp_sender_t*", "lrtc_encoded_frame_t*"],
+    ),
+}
+
+EXPECTED_INFO_FIELDS = [
+    "int media_type;",
+    "uint32_t rtp_timestamp;",
+    "uint32_t ssrc;",
+    "int payload_type;",
+    "bool is_key_frame;",
+    "int width;",
+    "int height;",
+    "int64_t frame_id;",
+    "int spatial_index;",
+    "int temporal_index;",
+    "uint32_t dependency_count;",
+]
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class EncodedFrameSurfaceTests(unittest.TestCase):
+    def test_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"Encoded frame functions missing from IDL: {missing}")
+        for name, (return_type, params) in EXPECTED_FUNCTIONS.items():
+            self.assertEqual(functions[name]["c_return_type"], return_type, name)
+            self.assertEqual([p["c_type"] for p in functions[name]["parameters"]], params, name)
+
+    def test_info_struct_layout(self) -> None:
+        header = HEADER_PATH.read_text(encoding="utf-8")
+        body = header.split("typedef struct lrtc_encoded_frame_info_t {", 1)[1]
+        body = body.split("} lrtc_encoded_frame_info_t;", 1)[0]
+        fields = [line.strip() for line in body.strip().splitlines()]
+        self.assertEqual(fields, EXPECTED_INFO_FIELDS)
+
+    def test_callback_hands_over_frame(self) -> None:
+        header = HEADER_PATH.read_text(encoding="utf-8")
+        self.assertIn(
+            "typedef void (LUMENRTC_CALL *lrtc_encoded_frame_cb)(void* user_data, lrtc_encoded_frame_t* frame);",
+            header,
+        )
+
+    def test_handles_have_release(self) -> None:
+        opaque = load_json(INTEROP_PATH).get("opaque_types", {})
+        self.assertEqual(opaque.get("lrtc_encoded_frame_t", {}).get("release"), "lrtc_encoded_frame_release")
+        self.assertEqual(opaque.get("lrtc_encoded_frame_t", {}).get("retain"), "lrtc_encoded_frame_retain")
+        self.assertEqual(
+            opaque.get("lrtc_encoded_frame_sink_t", {}).get("release"), "lrtc_encoded_frame_sink_release"
+        )
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"Encoded frame functions missing from required_native_functions: {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,60 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+BRIDGE_SOURCE_PATH = REPO_ROOT / "bridge" / "lumenrtc_bridge" / "include" / "rtc_video_source.h"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_factory_create_encoded_video_source": (
+        "lrtc_video_source_t*",
+        ["lrtc_factory_t*", "const char*", "const char*"],
+    ),
+    "lrtc_video_source_push_encoded": (
+        "int",
+        ["lrtc_video_source_t*", "const uint8_t*", "uint32_t", "int", "int", "bool", "int64_t"],
+    ),
+    "lrtc_video_source_set_key_frame_request_callback": (
+        "lrtc_result_t",
+        ["lrtc_video_source_t*", "lrtc_void_cb", "void*"],
+    ),
+    "lrtc_rtp_sender_send_encoded_audio": (
+        "lrtc_result_t",
+        ["lrtc_rtp_sender_t*", "const char*", "const uint8_t*", "uint32_t", "uint32_t"],
+    ),
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class EncodedIngestionSurfaceTests(unittest.TestCase):
+    def test_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"Encoded ingestion functions missing from IDL: {missing}")
+        for name, (return_type, params) in EXPECTED_FUNCTIONS.items():
+            self.assertEqual(functions[name]["c_return_type"], return_type, name)
+            self.assertEqual([p["c_type"] for p in functions[name]["parameters"]], params, name)
+
+    def test_bridge_source_type_is_appended(self) -> None:
+        header = BRIDGE_SOURCE_PATH.read_text(encoding="utf-8")
+        self.assertIn("enum SourceType { kCapturer, kCustom, kEncoded };", header)
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"Encoded ingestion functions missing from required_native_functions: {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,91 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+SRC_ROOT = REPO_ROOT / "src" / "LumenRTC"
+FACTORY_PATH = SRC_ROOT / "Devices" / "PeerConnectionFactory.cs"
+OPTIONS_PATH = SRC_ROOT / "Config" / "PeerConnectionFactoryOptions.cs"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_factory_create_with_options",
+    "lrtc_peer_connection_create_keyed",
+    "lrtc_factory_get_thread_report",
+    "lrtc_desktop_capturer_get_thread_report",
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class FactoryThreadingSurfaceTests(unittest.TestCase):
+    def test_options_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        names = {
+            item.get("name")
+            for item in idl.get("functions", [])
+            if isinstance(item, dict)
+        }
+        missing = sorted(EXPECTED_FUNCTIONS - names)
+        self.assertFalse(missing, f"Factory threading functions missing from IDL: {missing}")
+
+        header_types = idl.get("header_types", {})
+        mode = header_types.get("enums", {}).get("lrtc_factory_thread_mode", {})
+        members = {m["name"]: m["value"] for m in mode.get("members", [])}
+        self.assertEqual(members.get("LRTC_FACTORY_THREADS_DEDICATED"), 0)
+        self.assertIn("LRTC_FACTORY_THREADS_SHARED", members)
+        self.assertIn("LRTC_FACTORY_THREADS_POOLED", members)
+
+        options = header_types.get("structs", {}).get("lrtc_factory_options_t", {})
+        fields = {f["name"] for f in options.get("fields", [])}
+        expected_fields = {
+            "thread_mode",
+            "thread_pool_size",
+            "network_thread_count",
+            "pin_network_threads",
+            "network_first_cpu",
+            "worker_thread",
+            "signaling_thread",
+            "network_thread",
+            "capture_thread",
+        }
+        self.assertTrue(expected_fields <= fields, fields)
+
+        structs = header_types.get("structs", {})
+        self.assertIn("lrtc_thread_config_t", structs)
+        report = {f["name"] for f in structs.get("lrtc_thread_report_t", {}).get("fields", [])}
+        self.assertTrue({"applied", "cpu_mask", "failures"} <= report, report)
+        roles = {m["name"] for m in header_types.get("enums", {}).get("lrtc_thread_role", {}).get("members", [])}
+        self.assertIn("LRTC_THREAD_CAPTURE", roles)
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(EXPECTED_FUNCTIONS - required)
+        self.assertFalse(missing, f"Factory threading functions missing from required_native_functions: {missing}")
+
+    def test_managed_surface_exposes_options(self) -> None:
+        factory = FACTORY_PATH.read_text(encoding="utf-8")
+        self.assertIn("public static PeerConnectionFactory Create(PeerConnectionFactoryOptions options)", factory)
+        self.assertIn("string networkKey, RtcConfiguration? config = null", factory)
+        self.assertIn("public ThreadReport? GetThreadReport(ThreadRole role, int index = 0)", factory)
+
+        options = OPTIONS_PATH.read_text(encoding="utf-8")
+        expected_snippets = [
+            "public FactoryThreadMode ThreadMode",
+            "public PeerConnectionFactory? ShareWith",
+            "public int ThreadPoolSize",
+            "public int NetworkThreadCount",
+            "public int? NetworkThreadFirstCpu",
+            "public ThreadTuning? WorkerThread",
+            "public ThreadTuning? CaptureThread",
+        ]
+        missing = [item for item in expected_snippets if item not in options]
+        self.assertFalse(missing, f"PeerConnectionFactoryOptions is incomplete: missing {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
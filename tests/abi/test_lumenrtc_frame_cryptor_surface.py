@@ -0,0 +1,153 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+HEADER_PATH = REPO_ROOT / "native" / "include" / "lumenrtc.h"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_key_provider_create": (
+        "lrtc_key_provider_t*",
+        ["const lrtc_key_provider_options_t*"],
+    ),
+    "lrtc_key_provider_set_shared_key": (
+        "lrtc_result_t",
+        ["lrtc_key_provider_t*", "int", "const uint8_t*", "uint32_t"],
+    ),
+    "lrtc_key_provider_set_key": (
+        "lrtc_result_t",
+        ["lrtc_key_provider_t*", "const char*", "int", "const uint8_t*", "uint32_t"],
+    ),
+    "lrtc_key_provider_ratchet_shared_key": (
+        "lrtc_result_t",
+        ["lrtc_key_provider_t*", "int"],
+    ),
+    "lrtc_key_provider_ratchet_key": (
+        "lrtc_result_t",
+        ["lrtc_key_provider_t*", "const char*", "int"],
+    ),
+    "lrtc_key_provider_export_shared_key": (
+        "int32_t",
+        ["lrtc_key_provider_t*", "int", "uint8_t*", "uint32_t"],
+    ),
+    "lrtc_key_provider_export_key": (
+        "int32_t",
+        ["lrtc_key_provider_t*", "const char*", "int", "uint8_t*", "uint32_t"],
+    ),
+    "lrtc_key_provider_set_sif_trailer": (
+        "void",
+        ["lrtc_key_provider_t*", "const uint8_t*", "uint32_t"],
+    ),
+    "lrtc_key_provider_encrypt": (
+        "int32_t",
+        ["lrtc_key_provider_t*", "const char*", "int", "uint8_t*", "uint32_t", "uint32_t"],
+    ),
+    "lrtc_key_provider_decrypt": (
+        "int32_t",
+        ["lrtc_key_provider_t*", "const char*", "uint8_t*", "uint32_t"],
+    ),
+    "lrtc_key_provider_release": (
+        "void",
+        ["lrtc_key_provider_t*"],
+    ),
+    "lrtc_frame_cryptor_create_for_sender": (
+        "lrtc_frame_cryptor_t*",
+        ["lrtc_rtp_sender_t*", "const char*", "int", "lrtc_key_provider_t*"],
+    ),
+    "lrtc_frame_cryptor_create_for_receiver": (
+        "lrtc_frame_cryptor_t*",
+        ["lrtc_rtp_receiver_t*", "const char*", "int", "lrtc_key_provider_t*"],
+    ),
+    "lrtc_frame_cryptor_set_enabled": (
+        "lrtc_result_t",
+        ["lrtc_frame_cryptor_t*", "bool"],
+    ),
+    "lrtc_frame_cryptor_get_enabled": (
+        "bool",
+        ["lrtc_frame_cryptor_t*"],
+    ),
+    "lrtc_frame_cryptor_set_key_index": (
+        "lrtc_result_t",
+        ["lrtc_frame_cryptor_t*", "int"],
+    ),
+    "lrtc_frame_cryptor_get_key_index": (
+        "int",
+        ["lrtc_frame_cryptor_t*"],
+    ),
+    "lrtc_frame_cryptor_set_observer": (
+        "void",
+        ["lrtc_frame_cryptor_t*", "lrtc_frame_cryption_state_cb", "void*"],
+    ),
+    "lrtc_frame_cryptor_release": (
+        "void",
+        ["lrtc_frame_cryptor_t*"],
+    ),
+}
+
+EXPECTED_STATES = {
+    "LRTC_FRAME_CRYPTION_NEW": 0,
+    "LRTC_FRAME_CRYPTION_OK": 1,
+    "LRTC_FRAME_CRYPTION_ENCRYPTION_FAILED": 2,
+    "LRTC_FRAME_CRYPTION_DECRYPTION_FAILED": 3,
+    "LRTC_FRAME_CRYPTION_MISSING_KEY": 4,
+    "LRTC_FRAME_CRYPTION_KEY_RATCHETED": 5,
+    "LRTC_FRAME_CRYPTION_INTERNAL_ERROR": 6,
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class FrameCryptorSurfaceTests(unittest.TestCase):
+    def test_functions_are_present_in_idl(self) -> None:
+        functions = {
+            item.get("name"): item
+            for item in load_json(IDL_PATH).get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"Frame crypto functions missing from IDL: {missing}")
+        for name, (return_type, params) in EXPECTED_FUNCTIONS.items():
+            self.assertEqual(functions[name]["c_return_type"], return_type, name)
+            self.assertEqual([p["c_type"] for p in functions[name]["parameters"]], params, name)
+
+    def test_enum_values_are_stable(self) -> None:
+        enums = load_json(IDL_PATH)["header_types"]["enums"]
+        states = {m["name"]: int(m["value"]) for m in enums["lrtc_frame_cryption_state"]["members"]}
+        self.assertEqual(states, EXPECTED_STATES)
+        algorithms = {m["name"]: int(m["value"]) for m in enums["lrtc_frame_crypto_algorithm"]["members"]}
+        self.assertEqual(algorithms, {"LRTC_FRAME_CRYPTO_AES_GCM": 0, "LRTC_FRAME_CRYPTO_AES_CBC": 1})
+
+    def test_options_struct_keeps_field_order(self) -> None:
+        structs = load_json(IDL_PATH)["header_types"]["structs"]
+        self.assertEqual(
+            [f["name"] for f in structs["lrtc_key_provider_options_t"]["fields"]],
+            [
+                "shared_key",
+                "ratchet_salt",
+                "ratchet_salt_len",
+                "uncrypted_magic_bytes",
+                "uncrypted_magic_bytes_len",
+                "ratchet_window_size",
+                "failure_tolerance",
+                "key_ring_size",
+                "discard_frame_when_cryptor_not_ready",
+            ],
+        )
+
+    def test_overhead_matches_the_trailer(self) -> None:
+        # GCM tag, IV, IV length and key index.
+        self.assertIn("#define LRTC_FRAME_CRYPTO_OVERHEAD 30", HEADER_PATH.read_text(encoding="utf-8"))
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"Frame crypto functions missing from required_native_functions: {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,67 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+INTEROP_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.interop.json"
+HEADER_PATH = REPO_ROOT / "native" / "include" / "lumenrtc.h"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_peer_connection_add_ice_candidates": (
+        "int",
+        ["lrtc_peer_connection_t*", "const char**", "const int*", "const char**", "uint32_t", "int*"],
+    ),
+    "lrtc_peer_connection_set_ice_candidate_batching": (
+        "void",
+        ["lrtc_peer_connection_t*", "uint32_t", "lrtc_ice_candidates_cb", "void*"],
+    ),
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class IceCandidateBatchSurfaceTests(unittest.TestCase):
+    def test_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"ICE candidate batch functions missing from IDL: {missing}")
+        for name, (return_type, params) in EXPECTED_FUNCTIONS.items():
+            self.assertEqual(functions[name]["c_return_type"], return_type, name)
+            self.assertEqual([p["c_type"] for p in functions[name]["parameters"]], params, name)
+
+    def test_batch_callback_typedef(self) -> None:
+        header = HEADER_PATH.read_text(encoding="utf-8")
+        self.assertIn(
+            "typedef void (LUMENRTC_CALL *lrtc_ice_candidates_cb)(void* user_data, const char** sdp_mids, "
+            "const int* sdp_mline_indexes, const char** candidates, uint32_t count);",
+            header,
+        )
+
+    def test_index_array_is_passed_as_pointer(self) -> None:
+        functions = load_json(INTEROP_PATH).get("functions", {})
+        params = functions.get("lrtc_peer_connection_add_ice_candidates", {}).get("parameters", {})
+        self.assertEqual(params.get("sdp_mline_indexes", {}).get("managed_type"), "IntPtr")
+
+    def test_per_candidate_results_are_passed_as_pointer(self) -> None:
+        functions = load_json(INTEROP_PATH).get("functions", {})
+        params = functions.get("lrtc_peer_connection_add_ice_candidates", {}).get("parameters", {})
+        self.assertEqual(params.get("out_applied", {}).get("managed_type"), "IntPtr")
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"ICE candidate batch functions missing from required_native_functions: {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,66 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+SRC_ROOT = REPO_ROOT / "src" / "LumenRTC"
+TRACER_PATH = SRC_ROOT / "Core" / "LatencyTracer.cs"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_trace_start",
+    "lrtc_trace_stop",
+    "lrtc_trace_drain",
+    "lrtc_trace_dropped_count",
+    "lrtc_trace_format_chrome_json",
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class LatencyTracerSurfaceTests(unittest.TestCase):
+    def test_trace_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(EXPECTED_FUNCTIONS - set(functions))
+        self.assertFalse(missing, f"Latency tracer functions missing from IDL: {missing}")
+
+        params = {p["name"]: p["c_type"] for p in functions["lrtc_trace_format_chrome_json"]["parameters"]}
+        self.assertEqual(params.get("buffer"), "char*")
+        self.assertEqual(params.get("buffer_len"), "uint32_t")
+
+        header_types = idl.get("header_types", {})
+        event = header_types.get("structs", {}).get("lrtc_trace_event_t", {})
+        fields = {f["name"] for f in event.get("fields", [])}
+        self.assertTrue({"start_us", "duration_us", "frame_timestamp_us", "stage"} <= fields, fields)
+        stages = {m["name"] for m in header_types.get("enums", {}).get("lrtc_trace_stage", {}).get("members", [])}
+        self.assertIn("LRTC_TRACE_DESKTOP_CAPTURE", stages)
+        self.assertIn("LRTC_TRACE_VIDEO_SINK_CALLBACK", stages)
+
+    def test_trace_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(EXPECTED_FUNCTIONS - required)
+        self.assertFalse(missing, f"Latency tracer functions missing from required_native_functions: {missing}")
+
+    def test_managed_surface_exposes_tracer(self) -> None:
+        tracer = TRACER_PATH.read_text(encoding="utf-8")
+        expected_snippets = [
+            "public static void Start(int capacity = DefaultCapacity)",
+            "public static void Stop()",
+            "public static TraceEvent[] Drain(",
+            "public static string ToChromeTraceJson(",
+        ]
+        missing = [item for item in expected_snippets if item not in tracer]
+        self.assertFalse(missing, f"LatencyTracer API is incomplete: missing {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,93 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+INTEROP_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.interop.json"
+HEADER_PATH = REPO_ROOT / "native" / "include" / "lumenrtc.h"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_layer_controller_get_level": ("int", ["lrtc_layer_controller_t*"]),
+    "lrtc_layer_controller_get_max_level": ("int", ["lrtc_layer_controller_t*"]),
+    "lrtc_layer_controller_release": ("void", ["lrtc_layer_controller_t*"]),
+    "lrtc_peer_connection_create_layer_controller": (
+        "lrtc_layer_controller_t*",
+        [
+            "lrtc_peer_connection_t*",
+            "lrtc_rtp_sender_t*",
+            "const lrtc_layer_controller_options_t*",
+            "lrtc_layer_decision_cb",
+            "void*",
+        ],
+    ),
+}
+
+EXPECTED_OPTIONS_FIELDS = [
+    "uint32_t interval_ms;",
+    "double up_headroom;",
+    "double down_headroom;",
+    "uint32_t up_hold_ms;",
+    "uint32_t down_hold_ms;",
+    "double max_loss_rate;",
+    "uint32_t max_rtt_increase_ms;",
+    "bool ignore_cpu;",
+]
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class LayerControllerSurfaceTests(unittest.TestCase):
+    def test_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"Layer controller functions missing from IDL: {missing}")
+        for name, (return_type, params) in EXPECTED_FUNCTIONS.items():
+            self.assertEqual(functions[name]["c_return_type"], return_type, name)
+            self.assertEqual([p["c_type"] for p in functions[name]["parameters"]], params, name)
+
+    def test_options_struct_layout(self) -> None:
+        header = HEADER_PATH.read_text(encoding="utf-8")
+        body = header.split("typedef struct lrtc_layer_controller_options_t {", 1)[1]
+        body = body.split("} lrtc_layer_controller_options_t;", 1)[0]
+        fields = [line.strip() for line in body.strip().splitlines()]
+        self.assertEqual(fields, EXPECTED_OPTIONS_FIELDS)
+
+    def test_decision_reasons_match_callback(self) -> None:
+        header = HEADER_PATH.read_text(encoding="utf-8")
+        self.assertIn(
+            "typedef void (LUMENRTC_CALL *lrtc_layer_decision_cb)(void* user_data, int reason, int previous_level, "
+            "int level, int target_bitrate_bps, double loss_rate, double rtt_ms);",
+            header,
+        )
+        for member in (
+            "LRTC_LAYER_DECISION_BANDWIDTH = 0",
+            "LRTC_LAYER_DECISION_LOSS = 1",
+            "LRTC_LAYER_DECISION_RTT = 2",
+            "LRTC_LAYER_DECISION_CPU = 3",
+        ):
+            self.assertIn(member, header)
+
+    def test_handle_has_release(self) -> None:
+        opaque = load_json(INTEROP_PATH).get("opaque_types", {})
+        self.assertEqual(
+            opaque.get("lrtc_layer_controller_t", {}).get("release"), "lrtc_layer_controller_release"
+        )
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"Layer controller functions missing from required_native_functions: {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
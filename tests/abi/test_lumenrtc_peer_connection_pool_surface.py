@@ -0,0 +1,70 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+INTEROP_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.interop.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+HEADER_PATH = REPO_ROOT / "native" / "include" / "lumenrtc.h"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_factory_configure_peer_connection_pool": [
+        "lrtc_factory_t*",
+        "const lrtc_rtc_config_t*",
+        "lrtc_media_constraints_t*",
+        "int",
+    ],
+    "lrtc_factory_get_peer_connection_pool_stats": [
+        "lrtc_factory_t*",
+        "lrtc_peer_connection_pool_stats_t*",
+    ],
+    "lrtc_peer_connection_create_pooled": [
+        "lrtc_factory_t*",
+        "const lrtc_peer_connection_callbacks_t*",
+        "void*",
+    ],
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class PeerConnectionPoolSurfaceTests(unittest.TestCase):
+    def test_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"Peer connection pool functions missing from IDL: {missing}")
+        for name, params in EXPECTED_FUNCTIONS.items():
+            self.assertEqual([p["c_type"] for p in functions[name]["parameters"]], params, name)
+
+    def test_stats_struct_reports_hits_and_misses(self) -> None:
+        header = HEADER_PATH.read_text(encoding="utf-8")
+        stats = header.split("typedef struct lrtc_peer_connection_pool_stats_t {", 1)[1].split("}", 1)[0]
+        for field in ("uint64_t hits;", "uint64_t misses;", "uint32_t available;"):
+            self.assertIn(field, stats)
+
+    def test_interop_overrides(self) -> None:
+        functions = load_json(INTEROP_PATH)["functions"]
+        self.assertEqual(
+            functions["lrtc_factory_get_peer_connection_pool_stats"]["parameters"]["out_stats"]["modifier"], "out"
+        )
+        self.assertEqual(
+            functions["lrtc_factory_configure_peer_connection_pool"]["parameters"]["config"]["managed_type"], "IntPtr"
+        )
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"Peer connection pool functions missing from required_native_functions: {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,51 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+PEER_CONNECTION_PATH = REPO_ROOT / "src" / "LumenRTC" / "PeerConnection" / "PeerConnection.cs"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_peer_connection_get_transceivers": "lrtc_rtp_transceiver_t**",
+    "lrtc_peer_connection_get_senders": "lrtc_rtp_sender_t**",
+    "lrtc_peer_connection_get_receivers": "lrtc_rtp_receiver_t**",
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class RtpSnapshotSurfaceTests(unittest.TestCase):
+    def test_snapshot_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"RTP snapshot functions missing from IDL: {missing}")
+
+        for name, out_type in EXPECTED_FUNCTIONS.items():
+            params = [p["c_type"] for p in functions[name]["parameters"]]
+            self.assertEqual(params, ["lrtc_peer_connection_t*", out_type, "uint32_t"], name)
+            self.assertEqual(functions[name]["c_return_type"], "uint32_t", name)
+
+    def test_snapshot_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"RTP snapshot functions missing from required_native_functions: {missing}")
+
+    def test_managed_enumeration_uses_snapshots(self) -> None:
+        text = PEER_CONNECTION_PATH.read_text(encoding="utf-8")
+        for name in EXPECTED_FUNCTIONS:
+            self.assertIn(f"NativeMethods.{name}", text)
+        self.assertNotIn("lrtc_peer_connection_get_transceiver(handle, i)", text)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,49 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+INTEROP_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.interop.json"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_rtp_sender_set_encodings": (
+        "lrtc_result_t",
+        ["lrtc_rtp_sender_t*", "const lrtc_rtp_encoding_settings_t*", "uint32_t", "int"],
+    ),
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class SenderEncodingsSurfaceTests(unittest.TestCase):
+    def test_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"Sender encoding functions missing from IDL: {missing}")
+        for name, (return_type, params) in EXPECTED_FUNCTIONS.items():
+            self.assertEqual(functions[name]["c_return_type"], return_type, name)
+            self.assertEqual([p["c_type"] for p in functions[name]["parameters"]], params, name)
+
+    def test_settings_array_is_passed_as_pointer(self) -> None:
+        functions = load_json(INTEROP_PATH).get("functions", {})
+        params = functions.get("lrtc_rtp_sender_set_encodings", {}).get("parameters", {})
+        self.assertEqual(params.get("settings", {}).get("managed_type"), "IntPtr")
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"Sender encoding functions missing from required_native_functions: {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
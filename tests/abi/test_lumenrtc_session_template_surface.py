@@ -0,0 +1,110 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+MANAGED_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed.json"
+INTEROP_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.interop.json"
+HEADER_PATH = REPO_ROOT / "native" / "include" / "lumenrtc.h"
+TEMPLATE_IMPL_PATH = (
+    REPO_ROOT / "bridge" / "lumenrtc_bridge" / "src" / "rtc_session_template_impl.cc"
+)
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_session_template_create": ("lrtc_session_template_t*", []),
+    "lrtc_session_template_get_stats": (
+        "lrtc_result_t",
+        ["lrtc_session_template_t*", "lrtc_session_template_stats_t*"],
+    ),
+    "lrtc_session_template_release": ("void", ["lrtc_session_template_t*"]),
+    "lrtc_session_template_reset": ("void", ["lrtc_session_template_t*"]),
+    "lrtc_peer_connection_create_templated_offer": (
+        "void",
+        [
+            "lrtc_peer_connection_t*",
+            "lrtc_session_template_t*",
+            "lrtc_sdp_success_cb",
+            "lrtc_sdp_error_cb",
+            "void*",
+            "lrtc_media_constraints_t*",
+        ],
+    ),
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class SessionTemplateSurfaceTests(unittest.TestCase):
+    def test_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"Session template functions missing from IDL: {missing}")
+        for name, (return_type, params) in EXPECTED_FUNCTIONS.items():
+            self.assertEqual(functions[name]["c_return_type"], return_type, name)
+            self.assertEqual([p["c_type"] for p in functions[name]["parameters"]], params, name)
+
+    def test_handle_and_stats_layout(self) -> None:
+        header = HEADER_PATH.read_text(encoding="utf-8")
+        self.assertIn("typedef struct lrtc_session_template_t lrtc_session_template_t;", header)
+        stats = header.split("typedef struct lrtc_session_template_stats_t {", 1)[1].split("}", 1)[0]
+        self.assertIn("uint64_t hits;", stats)
+        self.assertIn("uint64_t misses;", stats)
+        self.assertIn("uint32_t template_size;", stats)
+
+    def test_handle_is_released_by_managed_wrapper(self) -> None:
+        handles = load_json(INTEROP_PATH).get("opaque_types", {})
+        self.assertEqual(
+            handles.get("lrtc_session_template_t", {}).get("release"),
+            "lrtc_session_template_release",
+        )
+        managed = {
+            item.get("c_handle_type"): item for item in load_json(MANAGED_PATH).get("handles", [])
+        }
+        self.assertEqual(managed.get("lrtc_session_template_t*", {}).get("cs_type"), "SessionTemplate")
+
+    def test_stats_are_an_out_parameter(self) -> None:
+        functions = load_json(INTEROP_PATH).get("functions", {})
+        params = functions.get("lrtc_session_template_get_stats", {}).get("parameters", {})
+        self.assertEqual(params.get("out_stats", {}).get("modifier"), "out")
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"Session template functions missing from required_native_functions: {missing}")
+
+    def test_simulcast_and_rid_changes_miss_the_cache(self) -> None:
+        source = TEMPLATE_IMPL_PATH.read_text(encoding="utf-8")
+        same_media = source.split("bool SameMedia(", 1)[1].split("\n}\n", 1)[0]
+        for accessor in (
+            "simulcast_description()",
+            "receive_rids()",
+            "conference_mode()",
+            "connection_address()",
+        ):
+            self.assertIn(accessor, same_media)
+        same_rids = source.split("bool SameRids(", 1)[1].split("\n}\n", 1)[0]
+        for member in (".rid", ".direction", ".payload_types", ".restrictions"):
+            self.assertIn(member, same_rids)
+        same_streams = source.split("bool SameStreams(", 1)[1].split("\n}\n", 1)[0]
+        self.assertIn("SameRids(a[i].rids(), b[i].rids())", same_streams)
+
+    def test_slots_come_from_marked_serialization(self) -> None:
+        source = TEMPLATE_IMPL_PATH.read_text(encoding="utf-8")
+        rebuild = source.split("void RTCSessionTemplateImpl::Rebuild(", 1)[1].split("\n}\n", 1)[0]
+        self.assertIn("MarkFields(", rebuild)
+        self.assertIn("marker_index", rebuild)
+        self.assertNotIn("field_index", rebuild)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,65 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+INTEROP_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.interop.json"
+HEADER_PATH = REPO_ROOT / "native" / "include" / "lumenrtc.h"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_factory_configure_udp_mux": (
+        "lrtc_result_t",
+        ["lrtc_factory_t*", "const lrtc_udp_mux_options_t*"],
+    ),
+    "lrtc_factory_get_udp_mux_stats": (
+        "lrtc_result_t",
+        ["lrtc_factory_t*", "lrtc_udp_mux_stats_t*"],
+    ),
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class UdpMuxSurfaceTests(unittest.TestCase):
+    def test_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"UDP mux functions missing from IDL: {missing}")
+        for name, (return_type, params) in EXPECTED_FUNCTIONS.items():
+            self.assertEqual(functions[name]["c_return_type"], return_type, name)
+            self.assertEqual([p["c_type"] for p in functions[name]["parameters"]], params, name)
+
+    def test_struct_layouts(self) -> None:
+        header = HEADER_PATH.read_text(encoding="utf-8")
+        options = header.split("typedef struct lrtc_udp_mux_options_t {", 1)[1].split("}", 1)[0]
+        self.assertIn("bool enabled;", options)
+        self.assertIn("int port;", options)
+        stats = header.split("typedef struct lrtc_udp_mux_stats_t {", 1)[1].split("}", 1)[0]
+        for field in ("address_hits", "ufrag_hits", "misses"):
+            self.assertIn(f"uint64_t {field};", stats)
+        for field in ("endpoints", "ports"):
+            self.assertIn(f"uint32_t {field};", stats)
+
+    def test_stats_are_an_out_parameter(self) -> None:
+        functions = load_json(INTEROP_PATH).get("functions", {})
+        params = functions.get("lrtc_factory_get_udp_mux_stats", {}).get("parameters", {})
+        self.assertEqual(params.get("out_stats", {}).get("modifier"), "out")
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"UDP mux functions missing from required_native_functions: {missing}")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,57 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+
+FUNCTION = "lrtc_video_frame_format"
+EXPECTED_FORMATS = {
+    "LRTC_VIDEO_PIXEL_FORMAT_NATIVE": 0,
+    "LRTC_VIDEO_PIXEL_FORMAT_I420": 1,
+    "LRTC_VIDEO_PIXEL_FORMAT_NV12": 2,
+    "LRTC_VIDEO_PIXEL_FORMAT_ARGB": 3,
+    "LRTC_VIDEO_PIXEL_FORMAT_BGRA": 4,
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class VideoSinkFormatSurfaceTests(unittest.TestCase):
+    def test_pixel_format_enum_values_are_stable(self) -> None:
+        enums = load_json(IDL_PATH)["header_types"]["enums"]
+        self.assertIn("lrtc_video_pixel_format", enums)
+        members = {
+            m["name"]: int(m["value"]) for m in enums["lrtc_video_pixel_format"]["members"]
+        }
+        self.assertEqual(members, EXPECTED_FORMATS)
+
+    def test_wants_struct_carries_format_and_size(self) -> None:
+        structs = load_json(IDL_PATH)["header_types"]["structs"]
+        fields = {f["name"] for f in structs["lrtc_video_sink_wants_t"]["fields"]}
+        self.assertTrue({"format", "width", "height"} <= fields)
+
+    def test_frame_format_is_present_in_idl(self) -> None:
+        functions = {
+            item.get("name"): item
+            for item in load_json(IDL_PATH).get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        self.assertIn(FUNCTION, functions)
+        self.assertEqual(functions[FUNCTION]["c_return_type"], "int")
+        self.assertEqual(
+            [p["c_type"] for p in functions[FUNCTION]["parameters"]],
+            ["lrtc_video_frame_t*"],
+        )
+
+    def test_function_is_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        self.assertIn(FUNCTION, required)
+
+
+if __name__ == "__main__":
+    unittest.main()
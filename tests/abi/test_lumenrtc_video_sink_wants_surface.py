@@ -0,0 +1,58 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+
+FUNCTION = "lrtc_video_sink_create_with_wants"
+EXPECTED_PARAMS = [
+    "const lrtc_video_sink_callbacks_t*",
+    "const lrtc_video_sink_wants_t*",
+    "void*",
+]
+EXPECTED_FIELDS = [
+    "max_pixel_count",
+    "max_framerate",
+    "resolution_alignment",
+    "format",
+    "width",
+    "height",
+]
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class VideoSinkWantsSurfaceTests(unittest.TestCase):
+    def test_create_with_wants_is_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        self.assertIn(FUNCTION, functions)
+        self.assertEqual(functions[FUNCTION]["c_return_type"], "lrtc_video_sink_t*")
+        self.assertEqual([p["c_type"] for p in functions[FUNCTION]["parameters"]], EXPECTED_PARAMS)
+        # The original constructor keeps its signature.
+        self.assertEqual(
+            [p["c_type"] for p in functions["lrtc_video_sink_create"]["parameters"]],
+            ["const lrtc_video_sink_callbacks_t*", "void*"],
+        )
+
+    def test_wants_struct_keeps_field_order(self) -> None:
+        structs = load_json(IDL_PATH)["header_types"]["structs"]
+        self.assertIn("lrtc_video_sink_wants_t", structs)
+        self.assertEqual([f["name"] for f in structs["lrtc_video_sink_wants_t"]["fields"]], EXPECTED_FIELDS)
+
+    def test_function_is_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        self.assertIn(FUNCTION, required)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,63 @@
+import json
+import unittest
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+IDL_PATH = REPO_ROOT / "abi" / "generated" / "lumenrtc" / "lumenrtc.idl.json"
+MANAGED_API_PATH = REPO_ROOT / "abi" / "bindings" / "lumenrtc.managed_api.json"
+HEADER_PATH = REPO_ROOT / "native" / "include" / "lumenrtc.h"
+
+EXPECTED_FUNCTIONS = {
+    "lrtc_factory_set_virtual_network_conditions": [
+        "lrtc_factory_t*",
+        "const lrtc_virtual_network_options_t*",
+    ],
+    "lrtc_peer_connection_connect_loopback": [
+        "lrtc_peer_connection_t*",
+        "lrtc_peer_connection_t*",
+        "lrtc_void_cb",
+        "lrtc_sdp_error_cb",
+        "void*",
+    ],
+}
+
+
+def load_json(path: Path) -> dict:
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+class VirtualNetworkSurfaceTests(unittest.TestCase):
+    def test_functions_are_present_in_idl(self) -> None:
+        idl = load_json(IDL_PATH)
+        functions = {
+            item.get("name"): item
+            for item in idl.get("functions", [])
+            if isinstance(item, dict) and isinstance(item.get("name"), str)
+        }
+        missing = sorted(set(EXPECTED_FUNCTIONS) - set(functions))
+        self.assertFalse(missing, f"Virtual network functions missing from IDL: {missing}")
+        for name, params in EXPECTED_FUNCTIONS.items():
+            self.assertEqual([p["c_type"] for p in functions[name]["parameters"]], params, name)
+
+    def test_factory_options_embed_virtual_network(self) -> None:
+        header = HEADER_PATH.read_text(encoding="utf-8")
+        options = header.split("typedef struct lrtc_factory_options_t {", 1)[1].split("}", 1)[0]
+        self.assertIn("lrtc_virtual_network_options_t virtual_network;", options)
+        self.assertLess(
+            header.index("typedef struct lrtc_virtual_network_options_t {"),
+            header.index("typedef struct lrtc_factory_options_t {"),
+        )
+
+    def test_functions_are_in_required_native_list(self) -> None:
+        required = set(load_json(MANAGED_API_PATH).get("required_native_functions", []))
+        missing = sorted(set(EXPECTED_FUNCTIONS) - required)
+        self.assertFalse(missing, f"Virtual network functions missing from required_native_functions: {missing}")
+
+    def test_managed_async_loopback_is_declared(self) -> None:
+        text = json.dumps(load_json(MANAGED_API_PATH))
+        self.assertIn("public Task ConnectLoopbackAsync(PeerConnection answerer", text)
+
+
+if __name__ == "__main__":
+    unittest.main()